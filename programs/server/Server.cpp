@@ -83,6 +83,7 @@
 #include <Common/CurrentMetrics.h>
 #include <Common/DNSResolver.h>
 #include <Common/Elf.h>
+#include <Common/FaultInjection.h>
 #include <Common/Macros.h>
 #include <Common/SensitiveDataMasker.h>
 #include <Common/StatusFile.h>
@@ -953,6 +954,7 @@ int Server::main(const std::vector<std::string> & /*args*/)
                     max_server_memory_usage_to_ram_ratio);
             }
             BrpcApplication::getInstance().reloadConfig(*config);
+            FaultInjection::instance().reloadConfig(*config);
 
             total_memory_tracker.setHardLimit(max_server_memory_usage);
             total_memory_tracker.setDescription("(total)");
@@ -1073,6 +1075,11 @@ int Server::main(const std::vector<std::string> & /*args*/)
     global_context->setPrimaryIndexCache(mark_cache_size);
     global_context->setChecksumsCache(config().getUInt64("checksum_cache_size", 10737418240)); // 10GB
 
+    /// Optionally let the cache governor rebalance the budgets of the caches above
+    /// from their observed hit rates; the total stays within the configured sum.
+    if (config().getBool("cache_governor.enable", false))
+        global_context->startCacheGovernor(config().getUInt64("cache_governor.interval_seconds", 60));
+
     /// Size of cache for query. It is not necessary.
     size_t query_cache_size = config().getUInt64("query_cache_size", 0);
     if (query_cache_size)
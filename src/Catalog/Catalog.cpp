@@ -32,6 +32,7 @@
 #include <Common/Status.h>
 #include <Common/RpcClientPool.h>
 #include <Common/serverLocality.h>
+#include <Common/ThreadPool.h>
 #include <Common/ScanWaitFreeMap.h>
 #include <Core/Types.h>
 // #include <Access/MaskingPolicyDataModel.h>
@@ -49,6 +50,9 @@
 #include <Storages/MergeTree/DeleteBitmapMeta.h>
 #include <IO/WriteHelpers.h>
 #include <IO/ReadHelpers.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+#include <Storages/MergeTree/IMergeTreeDataPart.h>
 #include <brpc/server.h>
 #include <Catalog/CatalogMetricHelper.h>
 #include <Statistics/ExportSymbols.h>
@@ -141,6 +145,8 @@ namespace ProfileEvents
     extern const Event GetAllDeleteBitmapsFailed;
     extern const Event GetStagedPartsSuccess;
     extern const Event GetStagedPartsFailed;
+    extern const Event GetStagedServerDataPartsSuccess;
+    extern const Event GetStagedServerDataPartsFailed;
     extern const Event GetDeleteBitmapsInPartitionsSuccess;
     extern const Event GetDeleteBitmapsInPartitionsFailed;
     extern const Event GetDeleteBitmapByKeysSuccess;
@@ -169,6 +175,8 @@ namespace ProfileEvents
     extern const Event GetPartitionListFailed;
     extern const Event GetPartitionsFromMetastoreSuccess;
     extern const Event GetPartitionsFromMetastoreFailed;
+    extern const Event GetPartitionMinMaxSuccess;
+    extern const Event GetPartitionMinMaxFailed;
     extern const Event GetPartitionIDsSuccess;
     extern const Event GetPartitionIDsFailed;
     extern const Event CreateDictionarySuccess;
@@ -201,6 +209,8 @@ namespace ProfileEvents
     extern const Event SetTransactionRecordFailed;
     extern const Event SetTransactionRecordWithRequestsSuccess;
     extern const Event SetTransactionRecordWithRequestsFailed;
+    extern const Event SetTransactionRecordsBatchSuccess;
+    extern const Event SetTransactionRecordsBatchFailed;
     extern const Event SetTransactionRecordCleanTimeSuccess;
     extern const Event SetTransactionRecordCleanTimeFailed;
     extern const Event SetTransactionRecordStatusWithOffsetsSuccess;
@@ -469,6 +479,8 @@ namespace Catalog
 
                 meta_proxy = std::make_shared<MetastoreProxy>(config);
                 max_commit_size_one_batch = context.getSettingsRef().catalog_max_commit_size;
+                final_txn_record_cache = std::make_unique<FinalTxnRecordCache>(
+                    context.getConfigRef().getUInt64("catalog_final_txn_record_cache_size", 100000));
             },
             ProfileEvents::CatalogConstructorSuccess,
             ProfileEvents::CatalogConstructorFailed);
@@ -796,52 +808,86 @@ namespace Catalog
         const TxnTimestamp & previous_version,
         const TxnTimestamp & txnID,
         const TxnTimestamp & ts)
+    {
+        alterTables({AlterTableRequest{storage, new_create, previous_version}}, txnID, ts);
+    }
+
+    void Catalog::alterTables(const std::vector<AlterTableRequest> & requests, const TxnTimestamp & txnID, const TxnTimestamp & ts)
     {
         runWithMetricSupport(
             [&] {
-                String table_uuid = meta_proxy->getTableUUID(name_space, storage->getDatabaseName(), storage->getTableName());
+                if (requests.empty())
+                    return;
 
-                if (table_uuid.empty())
-                    throw Exception("Table not found.", ErrorCodes::UNKNOWN_TABLE);
+                std::vector<Protos::DataModelTable> new_tables(requests.size());
 
-                /// get latest version of the table.
-                auto table = tryGetTableFromMetastore(table_uuid, UINT64_MAX);
+                /// Validation is read-only metastore traffic; for batched schema
+                /// migrations it dominates the wall time, so spread it over a pool.
+                auto validate_one = [&, this](size_t i)
+                {
+                    const auto & request = requests[i];
+                    const auto & storage = request.storage;
 
-                if (!table)
-                    throw Exception(
-                        "Cannot get metadata of table " + storage->getDatabaseName() + "." + storage->getTableName()
-                            + " by UUID : " + table_uuid,
-                        ErrorCodes::CATALOG_SERVICE_INTERNAL_ERROR);
+                    String table_uuid = meta_proxy->getTableUUID(name_space, storage->getDatabaseName(), storage->getTableName());
 
-                if (table->commit_time() >= ts.toUInt64())
-                    throw Exception("Cannot alter table with an earlier timestamp", ErrorCodes::CATALOG_SERVICE_INTERNAL_ERROR);
+                    if (table_uuid.empty())
+                        throw Exception("Table not found.", ErrorCodes::UNKNOWN_TABLE);
 
-                auto host_port = context.getCnchTopologyMaster()
-                                     ->getTargetServer(UUIDHelpers::UUIDToString(storage->getStorageID().uuid), false)
-                                     .getRPCAddress();
-                if (!isLocalServer(host_port, std::to_string(context.getRPCPort())))
-                    throw Exception(
-                        "Cannot alter table because of choosing wrong server according to current topology, chosen server: " + host_port,
-                        ErrorCodes::CNCH_TOPOLOGY_NOT_MATCH_ERROR);
+                    /// get latest version of the table.
+                    auto table = tryGetTableFromMetastore(table_uuid, UINT64_MAX);
 
-                table->set_definition(new_create);
-                table->set_txnid(txnID.toUInt64());
-                table->set_commit_time(ts.toUInt64());
-                table->set_previous_version(previous_version.toUInt64());
+                    if (!table)
+                        throw Exception(
+                            "Cannot get metadata of table " + storage->getDatabaseName() + "." + storage->getTableName()
+                                + " by UUID : " + table_uuid,
+                            ErrorCodes::CATALOG_SERVICE_INTERNAL_ERROR);
+
+                    if (table->commit_time() >= ts.toUInt64())
+                        throw Exception("Cannot alter table with an earlier timestamp", ErrorCodes::CATALOG_SERVICE_INTERNAL_ERROR);
+
+                    auto host_port = context.getCnchTopologyMaster()
+                                         ->getTargetServer(UUIDHelpers::UUIDToString(storage->getStorageID().uuid), false)
+                                         .getRPCAddress();
+                    if (!isLocalServer(host_port, std::to_string(context.getRPCPort())))
+                        throw Exception(
+                            "Cannot alter table because of choosing wrong server according to current topology, chosen server: " + host_port,
+                            ErrorCodes::CNCH_TOPOLOGY_NOT_MATCH_ERROR);
+
+                    table->set_definition(request.new_create);
+                    table->set_txnid(txnID.toUInt64());
+                    table->set_commit_time(ts.toUInt64());
+                    table->set_previous_version(request.previous_version.toUInt64());
+
+                    new_tables[i] = std::move(*table);
+                };
+
+                if (requests.size() == 1)
+                {
+                    validate_one(0);
+                }
+                else
+                {
+                    ThreadPool validate_pool(std::min(requests.size(), 16UL));
+                    for (size_t i = 0; i < requests.size(); ++i)
+                        validate_pool.scheduleOrThrowOnError([&validate_one, i] { validate_one(i); });
+                    validate_pool.wait();
+                }
 
-                // auto res = meta_proxy->alterTable(
-                //     name_space, *table, storage->getOutDatedMaskingPolicy(), storage->getColumns().getAllMaskingPolicy());
+                /// one metastore commit for the whole batch
                 ///FIXME: if masking policy is ready @guanzhe.andy
-                auto res = meta_proxy->alterTable(
-                    name_space, *table, {}, {});
+                auto res = meta_proxy->alterTables(name_space, new_tables);
                 if (!res)
                     throw Exception("Alter table failed.", ErrorCodes::CATALOG_ALTER_TABLE_FAILURE);
 
                 if (context.getCnchStorageCache())
                 {
                     /// update cache with nullptr and latest table commit_time to prevent an old version be inserted into cache. the cache will be reloaded in following getTable
-                    context.getCnchStorageCache()->insert(
-                        storage->getDatabaseName(), storage->getTableName(), table->commit_time(), nullptr);
+                    for (size_t i = 0; i < requests.size(); ++i)
+                        context.getCnchStorageCache()->insert(
+                            requests[i].storage->getDatabaseName(),
+                            requests[i].storage->getTableName(),
+                            new_tables[i].commit_time(),
+                            nullptr);
                 }
             },
             ProfileEvents::AlterTableSuccess,
@@ -1218,6 +1264,69 @@ namespace Catalog
         return outRes;
     }
 
+    DB::ServerDataPartsVector Catalog::getStagedServerDataParts(const StoragePtr & table, const TxnTimestamp & ts, const NameSet * partitions)
+    {
+        ServerDataPartsVector outRes;
+        runWithMetricSupport(
+            [&] {
+                auto * storage = dynamic_cast<MergeTreeMetaBase *>(table.get());
+                if (!storage)
+                    throw Exception("Table is not a merge tree", ErrorCodes::BAD_ARGUMENTS);
+                String table_uuid = UUIDHelpers::UUIDToString(table->getStorageUUID());
+
+                IMetaStore::IteratorPtr mIt;
+                bool need_partitions_check = false;
+                if (partitions && partitions->size() == 1)
+                {
+                    mIt = meta_proxy->getStagedPartsInPartition(name_space, table_uuid, *(partitions->begin()));
+                }
+                else
+                {
+                    /// TODO: find out more efficient way to scan staged parts only in the requested partitions.
+                    /// currently seems not a bottleneck because the total number of staged parts won't be very large
+                    mIt = meta_proxy->getStagedParts(name_space, table_uuid);
+                    need_partitions_check = (partitions != nullptr);
+                }
+
+                ServerDataPartsVector res;
+                while (mIt->next())
+                {
+                    /// if ts is set, exclude model whose txn id > ts
+                    if (ts.toUInt64())
+                    {
+                        const auto & key = mIt->key();
+                        auto pos = key.find_last_of('_');
+                        if (pos != String::npos)
+                        {
+                            UInt64 txn_id = std::stoull(key.substr(pos + 1, String::npos), nullptr);
+                            if (txn_id > ts)
+                                continue;
+                        }
+                    }
+
+                    DataModelPartPtr model = std::make_shared<Protos::DataModelPart>();
+                    model->ParseFromString(mIt->value());
+                    /// exclude model whose commit ts > ts
+                    if (ts.toUInt64() && model->has_commit_time() && model->commit_time() > ts.toUInt64())
+                        continue;
+                    /// exclude model not belong to the given partitions
+                    if (need_partitions_check && !partitions->count(model->part_info().partition_id()))
+                        continue;
+                    res.push_back(std::make_shared<ServerDataPart>(createPartWrapperFromModelPtr(*storage, std::move(model))));
+                }
+
+                /// remove uncommitted parts
+                if (ts)
+                {
+                    getCommittedServerDataParts(res, ts, this);
+                }
+                outRes = res;
+            },
+            ProfileEvents::GetStagedServerDataPartsSuccess,
+            ProfileEvents::GetStagedServerDataPartsFailed);
+        return outRes;
+    }
+
     DB::ServerDataPartsVector Catalog::getServerDataPartsInPartitions(
         const ConstStoragePtr & storage, const Strings & partitions, const TxnTimestamp & ts, const Context * session_context)
     {
@@ -1710,6 +1819,9 @@ namespace Catalog
         if (!parts.empty())
         {
             Strings current_partitions = getPartitionIDs(storage, nullptr);
+            std::unordered_map<String, String> aggregated_minmax;
+            if (context.getSettingsRef().enable_partition_minmax_in_catalog)
+                aggregated_minmax = prepareAggregatedPartitionMinMax(storage, parts);
             meta_proxy->prepareAddDataParts(
                 name_space,
                 UUIDHelpers::UUIDToString(storage->getStorageID().uuid),
@@ -1717,6 +1829,7 @@ namespace Catalog
                 parts,
                 batch_writes,
                 expected_parts,
+                aggregated_minmax,
                 preallocate_mode);
         }
         meta_proxy->prepareAddDeleteBitmaps(
@@ -1745,6 +1858,71 @@ namespace Catalog
         }
     }
 
+    std::unordered_map<String, String> Catalog::prepareAggregatedPartitionMinMax(
+        const StoragePtr & storage, const google::protobuf::RepeatedPtrField<Protos::DataModelPart> & parts)
+    {
+        std::unordered_map<String, String> res;
+        const auto * data = dynamic_cast<const MergeTreeMetaBase *>(storage.get());
+        if (!data)
+            return res;
+        auto metadata_snapshot = data->getInMemoryMetadataPtr();
+        const auto & partition_key = metadata_snapshot->getPartitionKey();
+        if (MergeTreeMetaBase::getMinMaxColumnsNames(partition_key).empty())
+            return res;
+
+        /// Merge the minmax indexes of the committed parts per partition. The part's partition_minmax
+        /// blob stores the partition values followed by the part's minmax index; empty parts carry no
+        /// minmax index (see IMergeTreeDataPart::storePartitionAndMinMaxIndex).
+        std::unordered_map<String, IMergeTreeDataPart::MinMaxIndex> merged;
+        for (const auto & part : parts)
+        {
+            if (part.has_deleted() && part.deleted())
+                continue;
+            auto info_ptr = createPartInfoFromModel(part.part_info());
+            ReadBufferFromString buf(part.partition_minmax());
+            MergeTreePartition partition;
+            partition.load(*data, buf);
+            if (buf.eof())
+                continue;
+            IMergeTreeDataPart::MinMaxIndex minmax_idx;
+            minmax_idx.load(*data, buf);
+            merged[info_ptr->partition_id].merge(minmax_idx);
+        }
+        if (merged.empty())
+            return res;
+
+        /// Widen with the aggregate already stored in the partition metas. The read-merge-write is safe
+        /// because commits of one table are serialized by its host server; the merge is widen-only, so
+        /// dropped data may leave the range wider than the live data, which only costs pruning precision.
+        Strings touched_partitions;
+        touched_partitions.reserve(merged.size());
+        for (const auto & [partition_id, _] : merged)
+            touched_partitions.push_back(partition_id);
+        Strings partition_metas = meta_proxy->getPartitionMetas(
+            name_space, UUIDHelpers::UUIDToString(storage->getStorageID().uuid), touched_partitions);
+        for (size_t i = 0; i < partition_metas.size(); ++i)
+        {
+            if (partition_metas[i].empty())
+                continue;
+            Protos::PartitionMeta partition_meta;
+            partition_meta.ParseFromString(partition_metas[i]);
+            if (!partition_meta.has_aggregated_minmax() || partition_meta.aggregated_minmax().empty())
+                continue;
+            ReadBufferFromString buf(partition_meta.aggregated_minmax());
+            IMergeTreeDataPart::MinMaxIndex stored_minmax;
+            stored_minmax.load(*data, buf);
+            merged[touched_partitions[i]].merge(stored_minmax);
+        }
+
+        for (const auto & [partition_id, minmax_idx] : merged)
+        {
+            WriteBufferFromOwnString out;
+            minmax_idx.store(*data, partition_id, out);
+            res.emplace(partition_id, out.str());
+        }
+        return res;
+    }
+
 
     void Catalog::dropAllPart(const StoragePtr & storage, const TxnTimestamp & txnID, const TxnTimestamp & ts)
     {
@@ -1809,6 +1987,29 @@ namespace Catalog
         return partition_list;
     }
 
+    std::unordered_map<String, String> Catalog::getPartitionMinMax(const ConstStoragePtr & table)
+    {
+        std::unordered_map<String, String> res;
+        runWithMetricSupport(
+            [&] {
+                if (const auto * cnch_table = dynamic_cast<const MergeTreeMetaBase *>(table.get()))
+                {
+                    /// Always read from the metastore: cached partition infos keep the aggregate that was
+                    /// current when they were loaded and a stale (narrower) range must not be used for pruning.
+                    PartitionMap partitions;
+                    getPartitionsFromMetastore(*cnch_table, partitions);
+                    for (auto it = partitions.begin(); it != partitions.end(); it++)
+                    {
+                        if (!it->second->aggregated_minmax.empty())
+                            res.emplace(it->first, it->second->aggregated_minmax);
+                    }
+                }
+            },
+            ProfileEvents::GetPartitionMinMaxSuccess,
+            ProfileEvents::GetPartitionMinMaxFailed);
+        return res;
+    }
+
     Strings Catalog::getPartitionIDs(const ConstStoragePtr & storage, const Context * session_context)
     {
         Strings partition_ids;
@@ -1843,7 +2044,10 @@ namespace Catalog
                     Protos::PartitionMeta partition_meta;
                     partition_meta.ParseFromString(it->value());
                     auto partition_ptr = createPartitionFromMetaModel(table, partition_meta);
-                    partition_list.emplace(partition_meta.id(), std::make_shared<CnchPartitionInfo>(partition_ptr, partition_meta.id()));
+                    auto partition_info = std::make_shared<CnchPartitionInfo>(partition_ptr, partition_meta.id());
+                    if (partition_meta.has_aggregated_minmax())
+                        partition_info->aggregated_minmax = partition_meta.aggregated_minmax();
+                    partition_list.emplace(partition_meta.id(), std::move(partition_info));
                 }
             },
             ProfileEvents::GetPartitionsFromMetastoreSuccess,
@@ -2132,6 +2336,78 @@ namespace Catalog
         return outRes;
     }
 
+    bool Catalog::setTransactionRecordStatusWithOffsetsAndParts(
+        const TransactionRecord & expected_record,
+        TransactionRecord & target_record,
+        const String & consumer_group,
+        const cppkafka::TopicPartitionList & tpl,
+        const StoragePtr & table,
+        const CommitItems & commit_data)
+    {
+        bool outRes;
+        runWithMetricSupport(
+            [&] {
+                if (!isHostServer(table))
+                    mayUpdateUHUT(table);
+
+                /// Set commit time up front: the parts become visible in the very metastore
+                /// commit that flips the transaction record, so no later rewrite is needed.
+                TxnTimestamp commit_ts = target_record.commitTs();
+                for (const auto & part : commit_data.data_parts)
+                    part->commit_time = commit_ts;
+                for (const auto & bitmap : commit_data.delete_bitmaps)
+                    bitmap->updateCommitTime(commit_ts);
+                for (const auto & part : commit_data.staged_parts)
+                    part->commit_time = commit_ts;
+
+                Protos::DataModelPartVector part_models;
+                fillPartsModel(*table, commit_data.data_parts, *part_models.mutable_parts());
+                Protos::DataModelPartVector staged_part_models;
+                fillPartsModel(*table, commit_data.staged_parts, *staged_part_models.mutable_parts());
+
+                const String uuid = UUIDHelpers::UUIDToString(table->getStorageID().uuid);
+                BatchCommitRequest batch_write;
+                BatchCommitResponse resp;
+
+                if (!part_models.parts().empty())
+                {
+                    Strings current_partitions = getPartitionIDs(table, nullptr);
+                    std::unordered_map<String, String> aggregated_minmax;
+                    if (context.getSettingsRef().enable_partition_minmax_in_catalog)
+                        aggregated_minmax = prepareAggregatedPartitionMinMax(table, part_models.parts());
+                    meta_proxy->prepareAddDataParts(
+                        name_space,
+                        uuid,
+                        current_partitions,
+                        part_models.parts(),
+                        batch_write,
+                        std::vector<String>(part_models.parts().size()),
+                        aggregated_minmax);
+                }
+                meta_proxy->prepareAddDeleteBitmaps(
+                    name_space, uuid, commit_data.delete_bitmaps, batch_write, std::vector<String>(commit_data.delete_bitmaps.size()));
+                meta_proxy->prepareAddStagedParts(
+                    name_space, uuid, staged_part_models.parts(), batch_write, std::vector<String>(staged_part_models.parts().size()));
+
+                batch_write.AddPut(SinglePutRequest(
+                    MetastoreProxy::transactionRecordKey(name_space, expected_record.txnID().toUInt64()),
+                    target_record.serialize(),
+                    expected_record.serialize()));
+                for (const auto & tp : tpl)
+                    batch_write.AddPut(SinglePutRequest(
+                        MetastoreProxy::kafkaOffsetsKey(name_space, consumer_group, tp.get_topic(), tp.get_partition()),
+                        std::to_string(tp.get_offset())));
+
+                outRes = meta_proxy->batchWrite(batch_write, resp);
+
+                if (outRes && context.getPartCacheManager() && !part_models.parts().empty())
+                    context.getPartCacheManager()->insertDataPartsIntoCache(*table, part_models.parts(), false, true);
+            },
+            ProfileEvents::SetTransactionRecordStatusWithOffsetsSuccess,
+            ProfileEvents::SetTransactionRecordStatusWithOffsetsFailed);
+        return outRes;
+    }
+
     /// commit and abort can reuse this API. set record status to targetStatus if current record.status is Running
     bool Catalog::setTransactionRecord(const TransactionRecord & expected_record, TransactionRecord & target_record)
     {
@@ -2202,6 +2478,28 @@ namespace Catalog
         return res;
     }
 
+    std::vector<bool> Catalog::setTransactionRecords(const std::vector<std::pair<TransactionRecord, TransactionRecord>> & expected_and_target)
+    {
+        std::vector<bool> res;
+        runWithMetricSupport(
+            [&] {
+                res.assign(expected_and_target.size(), true);
+                std::vector<std::pair<UInt64, std::pair<String, String>>> txns_data;
+                txns_data.reserve(expected_and_target.size());
+                for (const auto & [expected_record, target_record] : expected_and_target)
+                    txns_data.emplace_back(
+                        expected_record.txnID().toUInt64(), std::make_pair(expected_record.serialize(), target_record.serialize()));
+                BatchCommitResponse response;
+                meta_proxy->updateTransactionRecords(name_space, txns_data, response);
+                /// conflicting indexes are reported in the response, all other records are committed.
+                for (const auto & [index, value] : response.puts)
+                    res[index] = false;
+            },
+            ProfileEvents::SetTransactionRecordsBatchSuccess,
+            ProfileEvents::SetTransactionRecordsBatchFailed);
+        return res;
+    }
+
     void Catalog::setTransactionRecordCleanTime(TransactionRecord record, const TxnTimestamp & clean_ts, UInt64 ttl)
     {
         runWithMetricSupport(
@@ -2874,6 +3172,36 @@ namespace Catalog
         return records;
     }
 
+    std::vector<TransactionRecord> Catalog::getTransactionRecordsCached(const std::vector<TxnTimestamp> & txn_ids, size_t batch_size)
+    {
+        std::vector<TransactionRecord> records;
+        records.reserve(txn_ids.size());
+
+        std::vector<TxnTimestamp> missed;
+        for (const auto & txn_id : txn_ids)
+        {
+            if (auto cached = final_txn_record_cache->get(txn_id.toUInt64()))
+                records.push_back(*cached);
+            else
+                missed.push_back(txn_id);
+        }
+
+        if (missed.empty())
+            return records;
+
+        auto fetched = getTransactionRecords(missed, batch_size);
+        for (auto & record : fetched)
+        {
+            /// Finished and Aborted are terminal states, so the cached copy can never go stale.
+            /// Records in other states (including not-found placeholders) must be re-fetched
+            /// next time because their status may still change.
+            if (record.status() == CnchTransactionStatus::Finished || record.status() == CnchTransactionStatus::Aborted)
+                final_txn_record_cache->set(record.txnID().toUInt64(), std::make_shared<TransactionRecord>(record));
+            records.push_back(std::move(record));
+        }
+        return records;
+    }
+
     std::vector<TransactionRecord> Catalog::getTransactionRecordsForGC(size_t max_result_number)
     {
         std::vector<TransactionRecord> res;
@@ -4255,22 +4583,44 @@ namespace Catalog
         meta_proxy->createDictionary(name_space, database, name, dic_model.SerializeAsString());
     }
 
+    /// Parse one serialized part model from a metastore scan. With zero_copy, messages are parsed
+    /// straight into a per-thread arena slab and keep it alive through the returned pointer; the
+    /// slab is rotated once it has grown so a few surviving messages cannot pin a huge arena.
+    static DataModelPartPtr parseDataModelPart(const String & meta, bool zero_copy)
+    {
+        if (zero_copy)
+        {
+            thread_local PartModelSlabPtr slab;
+            if (!slab || slab->allocatedBytes() >= PartModelSlab::DEFAULT_ROTATE_BYTES)
+                slab = std::make_shared<PartModelSlab>();
+            return slab->parse(meta);
+        }
+
+        auto model = std::make_shared<Protos::DataModelPart>();
+        if (!model->ParseFromString(meta))
+            return nullptr;
+        return model;
+    }
+
     DataModelPartPtrVector Catalog::getDataPartsMetaFromMetastore(
         const ConstStoragePtr & storage, const Strings & required_partitions, const Strings & full_partitions, const TxnTimestamp & ts)
     {
-        auto createDataModelPartPtr = [&](const String & meta) {
-            Protos::DataModelPart part_model;
-            part_model.ParseFromString(meta);
+        bool zero_copy = context.getSettingsRef().enable_zero_copy_part_parsing;
+        auto createDataModelPartPtr = [&, zero_copy](const String & meta) {
+            DataModelPartPtr model = parseDataModelPart(meta, zero_copy);
             std::shared_ptr<Protos::DataModelPart> res_ptr;
-            if (ts.toUInt64() && part_model.has_commit_time() && TxnTimestamp{part_model.commit_time()} > ts)
+            if (!model)
+                return res_ptr;
+            if (ts.toUInt64() && model->has_commit_time() && TxnTimestamp{model->commit_time()} > ts)
                 return res_ptr;
             // compatible with old parts from alpha, old part doesn't have commit time field, the mutation is its commit time
-            else if (ts.toUInt64() && !part_model.has_commit_time() && UInt64(part_model.part_info().mutation()) > ts)
+            else if (ts.toUInt64() && !model->has_commit_time() && UInt64(model->part_info().mutation()) > ts)
                 return res_ptr;
-            return createPtrFromModel(std::move(part_model));
+            return model;
         };
 
         UInt32 time_out_ms = 1000 * (context.getSettingsRef().cnch_fetch_parts_timeout.totalSeconds());
+        size_t max_scan_threads = context.getSettingsRef().cnch_fetch_parts_max_threads;
 
         return getDataModelsByPartitions<DataModelPartPtr>(
             storage,
@@ -4279,7 +4629,42 @@ namespace Catalog
             full_partitions,
             createDataModelPartPtr,
             ts,
-            time_out_ms);
+            time_out_ms,
+            max_scan_threads);
+    }
+
+    std::unordered_map<String, UInt64> Catalog::getPartitionsPartsVersion(const ConstStoragePtr & storage, const Strings & partitions)
+    {
+        return meta_proxy->getPartitionsPartsVersion(name_space, UUIDHelpers::UUIDToString(storage->getStorageID().uuid), partitions);
+    }
+
+    DataModelPartPtrVector Catalog::getDataPartsDeltaInPartitions(
+        const ConstStoragePtr & storage, const Strings & partitions, const TxnTimestamp & since, const TxnTimestamp & ts)
+    {
+        bool zero_copy = context.getSettingsRef().enable_zero_copy_part_parsing;
+        auto createDataModelPartPtr = [&, zero_copy](const String & meta) {
+            DataModelPartPtr model = parseDataModelPart(meta, zero_copy);
+            std::shared_ptr<Protos::DataModelPart> res_ptr;
+            if (!model)
+                return res_ptr;
+            if (ts.toUInt64() && model->has_commit_time() && TxnTimestamp{model->commit_time()} > ts)
+                return res_ptr;
+            return model;
+        };
+
+        UInt32 time_out_ms = 1000 * (context.getSettingsRef().cnch_fetch_parts_timeout.totalSeconds());
+        size_t max_scan_threads = context.getSettingsRef().cnch_fetch_parts_max_threads;
+
+        return getDataModelsByPartitions<DataModelPartPtr>(
+            storage,
+            MetastoreProxy::dataPartPrefix(name_space, UUIDHelpers::UUIDToString(storage->getStorageID().uuid)),
+            partitions,
+            partitions,
+            createDataModelPartPtr,
+            ts,
+            time_out_ms,
+            max_scan_threads,
+            since.toUInt64());
     }
 
     DeleteBitmapMetaPtrVector Catalog::getDeleteBitmapByKeys(const StoragePtr & storage, const NameSet & keys)
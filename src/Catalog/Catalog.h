@@ -32,6 +32,8 @@
 #include <cppkafka/cppkafka.h>
 #include <Common/DNSResolver.h>
 #include <Common/HostWithPorts.h>
+#include <Common/LRUCache.h>
+#include <Common/ThreadPool.h>
 #include <common/getFQDNOrHostName.h>
 #include <Transaction/TransactionCommon.h>
 #include <ResourceManagement/CommonData.h>
@@ -129,6 +131,18 @@ public:
         const TxnTimestamp & txnID,
         const TxnTimestamp & ts);
 
+    struct AlterTableRequest
+    {
+        StoragePtr storage;
+        String new_create;
+        TxnTimestamp previous_version;
+    };
+
+    /// Batched variant of alterTable: validates all requests (in parallel for larger
+    /// batches) and applies the schema changes with a single metastore commit, so a
+    /// schema migration pays the metastore latency once per batch instead of per table.
+    void alterTables(const std::vector<AlterTableRequest> & requests, const TxnTimestamp & txnID, const TxnTimestamp & ts);
+
 
     void renameTable(
         const String & from_database,
@@ -160,6 +174,13 @@ public:
     ServerDataPartsVector getServerDataPartsInPartitions(const ConstStoragePtr & storage, const Strings & partitions, const TxnTimestamp & ts, const Context * session_context);
 
     ServerDataPartsVector getAllServerDataParts(const ConstStoragePtr & storage, const TxnTimestamp & ts, const Context * session_context);
+
+    /// Incremental sync support for the server part cache. Each parts commit records a
+    /// per-partition commit version; cache holders compare it with their synced version and
+    /// fetch only the part models committed after `since` instead of reloading the partition.
+    std::unordered_map<String, UInt64> getPartitionsPartsVersion(const ConstStoragePtr & storage, const Strings & partitions);
+    DataModelPartPtrVector getDataPartsDeltaInPartitions(
+        const ConstStoragePtr & storage, const Strings & partitions, const TxnTimestamp & since, const TxnTimestamp & ts = TxnTimestamp{0});
     DataPartsVector getDataPartsByNames(const NameSet & names, const StoragePtr & table, const TxnTimestamp & ts);
     DataPartsVector getStagedDataPartsByNames(const NameSet & names, const StoragePtr & table, const TxnTimestamp & ts);
     DeleteBitmapMetaPtrVector getAllDeleteBitmaps(const StoragePtr & table, const TxnTimestamp & ts);
@@ -167,6 +188,9 @@ public:
     // return table's committed staged parts. if partitions != null, ignore staged parts not belong to `partitions`.
     DataPartsVector getStagedParts(const StoragePtr & table, const TxnTimestamp & ts, const NameSet * partitions = nullptr);
 
+    // same as getStagedParts, but returns lightweight server parts suitable for the read path.
+    ServerDataPartsVector getStagedServerDataParts(const StoragePtr & table, const TxnTimestamp & ts, const NameSet * partitions = nullptr);
+
     /// (UNIQUE KEY) fetch all delete bitmaps <= ts in the given partitions
     DeleteBitmapMetaPtrVector
     getDeleteBitmapsInPartitions(const ConstStoragePtr & storage, const Strings & partitions, const TxnTimestamp & ts = 0);
@@ -197,6 +221,10 @@ public:
 
     std::vector<std::shared_ptr<MergeTreePartition>> getPartitionList(const ConstStoragePtr & table, const Context * session_context);
 
+    /// Get the aggregated minmax index (serialized) of each partition that has one maintained in its
+    /// partition meta, keyed by partition id. Used for planning time partition pruning.
+    std::unordered_map<String, String> getPartitionMinMax(const ConstStoragePtr & table);
+
     template<typename Map>
     void getPartitionsFromMetastore(const MergeTreeMetaBase & table, Map & partition_list);
 
@@ -244,6 +272,11 @@ public:
     bool setTransactionRecordWithRequests(
         const TransactionRecord & expected_record, TransactionRecord & record, BatchCommitRequest & request, BatchCommitResponse & response);
 
+    /// Batched CAS operation for group commit. Writes the records of several independent
+    /// transactions in one metastore batch. Returns one flag per record; a CAS conflict only
+    /// fails the conflicting record, the rest of the batch still commits.
+    std::vector<bool> setTransactionRecords(const std::vector<std::pair<TransactionRecord, TransactionRecord>> & expected_and_target);
+
     void setTransactionRecordCleanTime(TransactionRecord record, const TxnTimestamp & ts, UInt64 ttl);
 
     bool setTransactionRecordStatusWithOffsets(
@@ -252,6 +285,18 @@ public:
         const String & consumer_group,
         const cppkafka::TopicPartitionList & tpl);
 
+    /// Commit a Kafka ingestion transaction with exactly one metastore write: the part
+    /// metadata (with commit time already set), the consumed offsets and the record flip
+    /// all go into a single CAS batch, so neither a separate writeParts() during precommit
+    /// nor a setCommitTime() rewrite afterwards is needed.
+    bool setTransactionRecordStatusWithOffsetsAndParts(
+        const TransactionRecord & expected_record,
+        TransactionRecord & record,
+        const String & consumer_group,
+        const cppkafka::TopicPartitionList & tpl,
+        const StoragePtr & table,
+        const CommitItems & commit_data);
+
     /// just set transaction status to aborted
     void rollbackTransaction(TransactionRecord record);
 
@@ -319,6 +364,12 @@ public:
     /// For zombie record, the intents to be clear can be scanned from intents space with txnid. The parts can be get from undo buffer.
     std::vector<TransactionRecord> getTransactionRecords();
     std::vector<TransactionRecord> getTransactionRecords(const std::vector<TxnTimestamp> & txn_ids, size_t batch_size = 0);
+    /// Same as getTransactionRecords(txn_ids) but serves transactions already known to be in a
+    /// final state (Finished/Aborted) from an in-memory cache. Final states are terminal, so
+    /// cached entries can never go stale; records in any other state are always fetched from
+    /// the metastore. Intended for visibility resolution paths which look up the same
+    /// recently-committed transactions over and over.
+    std::vector<TransactionRecord> getTransactionRecordsCached(const std::vector<TxnTimestamp> & txn_ids, size_t batch_size = 0);
     /// clean zombie records. If the total transaction record number is too large, it may be impossible to get all of them. We can
     /// pass a max_result_number to only get part of them and clean zombie records repeatedlly
     std::vector<TransactionRecord> getTransactionRecordsForGC(size_t max_result_number);
@@ -513,6 +564,11 @@ private:
     const String name_space;
 
     UInt32 max_commit_size_one_batch {2000};
+
+    /// Caches records of transactions that reached a final state; see getTransactionRecordsCached().
+    using FinalTxnRecordCache = LRUCache<UInt64, TransactionRecord>;
+    std::unique_ptr<FinalTxnRecordCache> final_txn_record_cache;
+
     std::unordered_map<UUID, std::shared_ptr<std::mutex>> nhut_mutex;
     std::mutex all_storage_nhut_mutex;
     UInt32 max_drop_size_one_batch {10000};
@@ -545,6 +601,12 @@ private:
 
     bool canUseCache(const ConstStoragePtr & storage, const Context * session_context);
 
+    /// Merge the minmax indexes of the parts being committed with the aggregated minmax already stored
+    /// in the partition metas of the touched partitions. Returns the new serialized aggregate per
+    /// partition id; empty if the table has no minmax columns.
+    std::unordered_map<String, String> prepareAggregatedPartitionMinMax(
+        const StoragePtr & storage, const google::protobuf::RepeatedPtrField<Protos::DataModelPart> & parts);
+
     void finishCommitInBatch(
         const StoragePtr & storage,
         const TxnTimestamp & txnID,
@@ -583,10 +645,11 @@ private:
         const Strings & full_partitions_,
         const std::function<T(const String &)> & create_func,
         const TxnTimestamp & ts,
-        UInt32 time_out_ms = 0)
+        UInt32 time_out_ms = 0,
+        size_t max_scan_threads = 1,
+        UInt64 min_commit_time = 0)
     {
         Stopwatch watch;
-        std::vector<T> res;
 
         String table_uuid = UUIDHelpers::UUIDToString(storage->getStorageID().uuid);
         UInt64 timestamp = ts.toUInt64();
@@ -601,15 +664,17 @@ private:
         auto plist_start = full_partitions.begin();
         auto plist_end = full_partitions.end();
 
+        /// Coalesce adjacent requested partitions into as few key ranges as possible, then open
+        /// iterators for all ranges in one metastore call so the backend can pipeline the reads.
+        std::vector<IMetaStore::RangeRequest> ranges;
         for (auto partition_it = request_partitions.begin(); partition_it != request_partitions.end();)
         {
-            IMetaStore::IteratorPtr mIt;
             while (plist_start != plist_end && *partition_it != *plist_start)
                 plist_start++;
 
             if (plist_start == plist_end)
             {
-                mIt = meta_proxy->getMetaInRange(meta_prefix, *partition_it + "_", *partition_it + "_", true, true);
+                ranges.push_back({*partition_it + "_", *partition_it + "_", true, true});
                 partition_it++;
             }
             else
@@ -622,9 +687,13 @@ private:
                     partition_it++;
                     plist_start++;
                 }
-                mIt = meta_proxy->getMetaInRange(meta_prefix, start_partition + "_", end_partition + "_", true, true);
+                ranges.push_back({start_partition + "_", end_partition + "_", true, true});
             }
+        }
+
+        auto iterators = meta_proxy->getMetaInRanges(meta_prefix, ranges);
 
+        auto consume_iterator = [&](const IMetaStore::IteratorPtr & mIt, std::vector<T> & out) {
             size_t counter = 0;
             while (mIt->next())
             {
@@ -632,25 +701,71 @@ private:
                 {
                     throw Exception("Get data from metastore reached timeout " + toString(time_out_ms) + "ms.", ErrorCodes::TIMEOUT_EXCEEDED);
                 }
-                /// if timestamp is set, only return the meta where commit time <= timestamp
-                if (timestamp)
+                /// if timestamp is set, only return the meta where commit time <= timestamp;
+                /// if min_commit_time is set (delta fetch), skip the meta committed before it
+                /// without even deserializing the value.
+                if (timestamp || min_commit_time)
                 {
                     const auto & key = mIt->key();
                     auto pos = key.find_last_of('_');
                     if (pos != String::npos)
                     {
                         UInt64 commit_time = std::stoull(key.substr(pos + 1, String::npos), nullptr);
-                        if (commit_time > timestamp)
+                        if (timestamp && commit_time > timestamp)
+                            continue;
+                        if (min_commit_time && commit_time <= min_commit_time)
                             continue;
                     }
                 }
 
                 T data_model = create_func(mIt->value());
                 if (data_model)
-                    res.emplace_back(std::move(data_model));
+                    out.emplace_back(std::move(data_model));
+            }
+        };
+
+        std::vector<std::vector<T>> partial_results(iterators.size());
+        size_t num_threads = std::min(max_scan_threads, iterators.size());
+        if (num_threads > 1)
+        {
+            /// Drain iterators with bounded parallelism. Each task writes into its own slot so no
+            /// locking is needed on the result path; exceptions are rethrown after the pool drains.
+            ThreadPool pool(num_threads);
+            std::vector<std::exception_ptr> exceptions(iterators.size());
+            for (size_t i = 0; i < iterators.size(); ++i)
+            {
+                pool.scheduleOrThrowOnError([&, i] {
+                    try
+                    {
+                        consume_iterator(iterators[i], partial_results[i]);
+                    }
+                    catch (...)
+                    {
+                        exceptions[i] = std::current_exception();
+                    }
+                });
             }
+            pool.wait();
+            for (auto & exception : exceptions)
+            {
+                if (exception)
+                    std::rethrow_exception(exception);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < iterators.size(); ++i)
+                consume_iterator(iterators[i], partial_results[i]);
         }
 
+        std::vector<T> res;
+        for (auto & partial : partial_results)
+        {
+            if (res.empty())
+                res = std::move(partial);
+            else
+                res.insert(res.end(), std::make_move_iterator(partial.begin()), std::make_move_iterator(partial.end()));
+        }
         return res;
     }
 
@@ -157,7 +157,9 @@ UInt64 ServerDataPart::getVirtualPartSize() const { return virtual_part_size; }
 
 const ImmutableDeleteBitmapPtr & ServerDataPart::getDeleteBitmap(const MergeTreeMetaBase & storage, bool is_unique_new_part) const
 {
-    if (!storage.getInMemoryMetadataPtr()->hasUniqueKey() || deleted())
+    /// Parts of tables without UNIQUE KEY normally have no bitmap, but lightweight
+    /// deletes may leave one (see enable_delete_bitmap_for_normal_table).
+    if (deleted() || (!storage.getInMemoryMetadataPtr()->hasUniqueKey() && delete_bitmap_metas.empty()))
     {
         if (delete_bitmap != nullptr)
             throw Exception("Delete bitmap for part " + name() + " is not null", ErrorCodes::LOGICAL_ERROR);
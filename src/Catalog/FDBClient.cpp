@@ -14,13 +14,17 @@
  */
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string.h>
 #include <Catalog/FDBClient.h>
 #include <Catalog/FDBError.h>
 #include <Common/Exception.h>
 #include <Catalog/MetastoreFDBImpl.h>
+#include <Common/FaultInjection.h>
 #include <common/logger_useful.h>
+#include <bthread/condition_variable.h>
+#include <bthread/mutex.h>
 
 
 namespace DB
@@ -44,6 +48,59 @@ namespace FDB
         throw Exception("Error occurs while initializing fdb client. code: " + std::to_string(code) + ", msg: " \
                 + std::string(fdb_get_error(code)), ErrorCodes::METASTORE_EXCEPTION)
 
+/// Simulated metastore degradation for staging stress tests (see Common/FaultInjection.h).
+/// The injected timeout takes the same retry path as a real fdb timeout.
+#define INJECT_METASTORE_FAULT() \
+    if (FaultInjection::instance().inject(FaultInjection::METASTORE)) \
+        return FDBError::FDB_transaction_timed_out
+
+namespace
+{
+    struct FutureWaitState
+    {
+        bthread::Mutex mutex;
+        bthread::ConditionVariable cv;
+        bool ready = false;
+    };
+}
+
+static void OnFutureReady(FDBFuture *, void * param)
+{
+    /// Owns one reference to the wait state (see WaitFutureReady): the waiter may
+    /// observe ready == true and destroy its reference while this callback is still
+    /// running on the fdb network thread, so the state must not die under us.
+    std::unique_ptr<std::shared_ptr<FutureWaitState>> holder(static_cast<std::shared_ptr<FutureWaitState> *>(param));
+    FutureWaitState & state = **holder;
+    std::unique_lock lock(state.mutex);
+    state.ready = true;
+    state.cv.notify_one();
+}
+
+/// Drop-in replacement for fdb_future_block_until_ready that does not pin the
+/// calling thread. Catalog calls issued from brpc handlers run on bthreads, and
+/// parking the underlying pthread in the fdb client starves the bthread worker
+/// pool once a few hundred metadata operations are in flight; waiting on bthread
+/// primitives instead lets the worker run other ready bthreads meanwhile. On
+/// plain server threads this degrades to an ordinary blocking wait.
+static fdb_error_t WaitFutureReady(FDBFuture * future)
+{
+    if (fdb_future_is_ready(future))
+        return 0;
+
+    auto state = std::make_shared<FutureWaitState>();
+    /// The callback gets its own reference, released by OnFutureReady itself.
+    auto callback_ref = std::make_unique<std::shared_ptr<FutureWaitState>>(state);
+    /// fdb invokes the callback immediately when the future got ready in between
+    if (fdb_error_t code = fdb_future_set_callback(future, OnFutureReady, callback_ref.get()))
+        return code;
+    callback_ref.release();
+
+    std::unique_lock lock(state->mutex);
+    while (!state->ready)
+        state->cv.wait(lock);
+    return 0;
+}
+
 static void AssertTrsansactionStatus(FDBTransactionPtr tr)
 {
     if (!tr || !tr->transaction)
@@ -102,9 +159,10 @@ fdb_error_t FDBClient::CreateTransaction(FDBTransactionPtr tr)
 fdb_error_t FDBClient::Get(FDBTransactionPtr tr, const std::string & key, GetResponse & res)
 {
     AssertTrsansactionStatus(tr);
+    INJECT_METASTORE_FAULT();
     const uint8_t* p_key = reinterpret_cast<const uint8_t*>(key.c_str());
     FDBFuturePtr f_read = std::make_shared<FDBFutureRAII>(fdb_transaction_get(tr->transaction, p_key, key.size(), 1));
-    RETURN_ON_ERROR(fdb_future_block_until_ready(f_read->future));
+    RETURN_ON_ERROR(WaitFutureReady(f_read->future));
     RETURN_ON_ERROR(fdb_future_get_error(f_read->future));
     fdb_bool_t present;
     uint8_t const *outValue;
@@ -122,6 +180,7 @@ fdb_error_t FDBClient::Get(FDBTransactionPtr tr, const std::string & key, GetRes
 fdb_error_t FDBClient::Put(FDBTransactionPtr tr, const PutRequest & put)
 {
     AssertTrsansactionStatus(tr);
+    INJECT_METASTORE_FAULT();
     if (put.if_not_exists || put.expected_value)
     {
         GetResponse get_res;
@@ -134,7 +193,7 @@ fdb_error_t FDBClient::Put(FDBTransactionPtr tr, const PutRequest & put)
 
     fdb_transaction_set(tr->transaction, reinterpret_cast<const uint8_t*>(put.key.data), put.key.size, reinterpret_cast<const uint8_t*>(put.value.data), put.value.size);
     FDBFuturePtr f = std::make_shared<FDBFutureRAII>(fdb_transaction_commit(tr->transaction));
-    RETURN_ON_ERROR(fdb_future_block_until_ready(f->future));
+    RETURN_ON_ERROR(WaitFutureReady(f->future));
     RETURN_ON_ERROR(fdb_future_get_error(f->future));
 
     return 0;
@@ -152,6 +211,7 @@ values: <string, UInt64> pair, the string is the value string and UInt64 is the
 fdb_error_t FDBClient::MultiGet(FDBTransactionPtr tr, const std::vector<std::string> & keys, std::vector<std::pair<std::string, UInt64>> & values)
 {
     AssertTrsansactionStatus(tr);
+    INJECT_METASTORE_FAULT();
     RETURN_ON_ERROR(fdb_database_create_transaction(fdb, &(tr->transaction)));
     std::vector<FDBFuturePtr> future_list;
     for (auto & key : keys)
@@ -166,7 +226,7 @@ fdb_error_t FDBClient::MultiGet(FDBTransactionPtr tr, const std::vector<std::str
     int outValueLength;
     for (FDBFuturePtr f_read : future_list)
     {
-        RETURN_ON_ERROR(fdb_future_block_until_ready(f_read->future));
+        RETURN_ON_ERROR(WaitFutureReady(f_read->future));
         RETURN_ON_ERROR(fdb_future_get_value(f_read->future, &present, &outValue, &outValueLength));
         if (present)
             values.emplace_back(std::make_pair(std::string(outValue, outValue+outValueLength), outValueLength));
@@ -180,6 +240,7 @@ fdb_error_t FDBClient::MultiGet(FDBTransactionPtr tr, const std::vector<std::str
 fdb_error_t FDBClient::MultiWrite(FDBTransactionPtr tr, const Catalog::BatchCommitRequest & req, Catalog::BatchCommitResponse & resp)
 {
     AssertTrsansactionStatus(tr);
+    INJECT_METASTORE_FAULT();
     std::vector<int> index_of_cas_req;
     std::vector<FDBFuturePtr> future_list;
 
@@ -216,7 +277,7 @@ fdb_error_t FDBClient::MultiWrite(FDBTransactionPtr tr, const Catalog::BatchComm
     // check for puts
     for (size_t i = 0; i < puts_cas_size; ++i)
     {
-        RETURN_ON_ERROR(fdb_future_block_until_ready(future_list[i]->future));
+        RETURN_ON_ERROR(WaitFutureReady(future_list[i]->future));
         RETURN_ON_ERROR(fdb_future_get_error(future_list[i]->future));
         RETURN_ON_ERROR(fdb_future_get_value(future_list[i]->future, &present, &outValue, &outValueLength));
 
@@ -244,7 +305,7 @@ fdb_error_t FDBClient::MultiWrite(FDBTransactionPtr tr, const Catalog::BatchComm
     // check for deletes
     for (size_t i = puts_cas_size; i < puts_cas_size + deletes_cas_size; ++i)
     {
-        RETURN_ON_ERROR(fdb_future_block_until_ready(future_list[i]->future));
+        RETURN_ON_ERROR(WaitFutureReady(future_list[i]->future));
         RETURN_ON_ERROR(fdb_future_get_error(future_list[i]->future));
         RETURN_ON_ERROR(fdb_future_get_value(future_list[i]->future, &present, &outValue, &outValueLength));
 
@@ -282,7 +343,7 @@ fdb_error_t FDBClient::MultiWrite(FDBTransactionPtr tr, const Catalog::BatchComm
         fdb_transaction_clear(tr->transaction, reinterpret_cast<const uint8_t*>(req.deletes[i].key.c_str()), req.deletes[i].key.size());
 
     FDBFuturePtr f = std::make_shared<FDBFutureRAII>(fdb_transaction_commit(tr->transaction));
-    RETURN_ON_ERROR(fdb_future_block_until_ready(f->future));
+    RETURN_ON_ERROR(WaitFutureReady(f->future));
     fdb_error_t error_code = fdb_future_get_error(f->future);
 
     /// The commit would still fail due to conflict (CAS), so we need to read for the conflicted value again.
@@ -344,10 +405,11 @@ fdb_error_t FDBClient::MultiWrite(FDBTransactionPtr tr, const Catalog::BatchComm
 fdb_error_t FDBClient::Delete(FDBTransactionPtr tr, const std::string & key, const std::string & expected)
 {
     AssertTrsansactionStatus(tr);
+    INJECT_METASTORE_FAULT();
     if (!expected.empty())
     {
         FDBFuturePtr f_read = std::make_shared<FDBFutureRAII>(fdb_transaction_get(tr->transaction, reinterpret_cast<const uint8_t*>(key.c_str()), key.size(), 0));
-        RETURN_ON_ERROR(fdb_future_block_until_ready(f_read->future));
+        RETURN_ON_ERROR(WaitFutureReady(f_read->future));
         RETURN_ON_ERROR(fdb_future_get_error(f_read->future));
         fdb_bool_t present;
         uint8_t const *outValue;
@@ -360,7 +422,7 @@ fdb_error_t FDBClient::Delete(FDBTransactionPtr tr, const std::string & key, con
 
     fdb_transaction_clear(tr->transaction, reinterpret_cast<const uint8_t*>(key.c_str()), key.size());
     FDBFuturePtr f = std::make_shared<FDBFutureRAII>(fdb_transaction_commit(tr->transaction));
-    RETURN_ON_ERROR(fdb_future_block_until_ready(f->future));
+    RETURN_ON_ERROR(WaitFutureReady(f->future));
     fdb_error_t error_code = fdb_future_get_error(f->future);
     return error_code;
 }
@@ -368,9 +430,10 @@ fdb_error_t FDBClient::Delete(FDBTransactionPtr tr, const std::string & key, con
 fdb_error_t FDBClient::Clear(FDBTransactionPtr tr, const std::string & start_key, const std::string & end_key)
 {
     AssertTrsansactionStatus(tr);
+    INJECT_METASTORE_FAULT();
     fdb_transaction_clear_range(tr->transaction, reinterpret_cast<const uint8_t*>(start_key.c_str()), start_key.size(), reinterpret_cast<const uint8_t*>(end_key.c_str()), end_key.size());
     FDBFuturePtr f = std::make_shared<FDBFutureRAII>(fdb_transaction_commit(tr->transaction));
-    RETURN_ON_ERROR(fdb_future_block_until_ready(f->future));
+    RETURN_ON_ERROR(WaitFutureReady(f->future));
     RETURN_ON_ERROR(fdb_future_get_error(f->future));
     return 0;
 }
@@ -390,6 +453,14 @@ Iterator::Iterator(FDBClient * client_, FDBTransactionPtr tr_, const ScanRequest
 
 bool Iterator::Next(fdb_error_t & code)
 {
+    /// Only charge injected latency/errors when a new batch is fetched; stepping
+    /// within an already fetched batch does not touch the metastore.
+    if (batch_count <= batch_read_index && FaultInjection::instance().inject(FaultInjection::METASTORE))
+    {
+        code = FDBError::FDB_transaction_timed_out;
+        return false;
+    }
+
     if (batch_count > batch_read_index)
     {
         batch_read_index++;
@@ -417,8 +488,7 @@ bool Iterator::Next(fdb_error_t & code)
                     req.row_limit, 0, FDB_STREAMING_MODE_LARGE, iteration, 1, req.reverse_order));
             }
 
-            code = fdb_future_block_until_ready(batch_future->future);
-            if (code = fdb_future_block_until_ready(batch_future->future); code)
+            if (code = WaitFutureReady(batch_future->future); code)
                 return false;
             if (code = fdb_future_get_error(batch_future->future); code)
             {
@@ -43,6 +43,18 @@ public:
     };
 
     using IteratorPtr = std::shared_ptr<Iterator>;
+
+    /***
+     * Describes one key range for multi-range scan requests.
+     */
+    struct RangeRequest
+    {
+        String start_key;
+        String end_key;
+        bool include_start = true;
+        bool include_end = true;
+    };
+
     IMetaStore(){}
     virtual ~IMetaStore() {}
 
@@ -90,6 +102,20 @@ public:
      */
     virtual IteratorPtr getByRange(const String & start_key, const String & end_key, const bool include_start, const bool include_end) = 0;
 
+    /***
+     * Open iterators over multiple key ranges in one call. Implementations may pipeline the
+     * underlying reads so that scanning many small ranges is bounded by backend throughput
+     * rather than by the number of ranges. The default implementation opens ranges one by one.
+     */
+    virtual std::vector<IteratorPtr> multiGetByRanges(const std::vector<RangeRequest> & ranges)
+    {
+        std::vector<IteratorPtr> res;
+        res.reserve(ranges.size());
+        for (const auto & range : ranges)
+            res.push_back(getByRange(range.start_key, range.end_key, range.include_start, range.include_end));
+        return res;
+    }
+
     /***
      * Claer all metainfo in the metastore start with specification prefix;
      */
@@ -141,6 +141,25 @@ MetastoreFDBImpl::IteratorPtr MetastoreFDBImpl::getByRange(const String & range_
     return std::make_shared<FDBIterator>(fdb_iter);
 }
 
+std::vector<MetastoreFDBImpl::IteratorPtr> MetastoreFDBImpl::multiGetByRanges(const std::vector<RangeRequest> & ranges)
+{
+    /// Open one transaction per range up front so that the per-range read pipelines (readahead of
+    /// the first batch) are all in flight before the caller starts to consume any iterator.
+    std::vector<IteratorPtr> res;
+    res.reserve(ranges.size());
+    for (const auto & range : ranges)
+    {
+        FDB::ScanRequest scan_req;
+        scan_req.start_key = range.include_start ? range.start_key : getNextKey(range.start_key);
+        scan_req.end_key = range.include_end ? getNextKey(range.end_key) : range.end_key;
+
+        FDB::FDBTransactionPtr tr = std::make_shared<FDB::FDBTransactionRAII>();
+        check_fdb_op(fdb_client->CreateTransaction(tr));
+        res.push_back(std::make_shared<FDBIterator>(fdb_client->Scan(tr, scan_req)));
+    }
+    return res;
+}
+
 bool MetastoreFDBImpl::batchWrite(const BatchCommitRequest & req, BatchCommitResponse & response)
 {
     FDB::FDBTransactionPtr tr = std::make_shared<FDB::FDBTransactionRAII>();
@@ -86,6 +86,8 @@ public:
 
     IteratorPtr getByRange(const String & range_start, const String & range_end, const bool include_start, const bool include_end) override;
 
+    std::vector<IteratorPtr> multiGetByRanges(const std::vector<RangeRequest> & ranges) override;
+
     void clean(const String & prefix) override;
 
     void close() override {}
@@ -597,6 +597,20 @@ bool MetastoreProxy::alterTable(const String & name_space, const Protos::DataMod
     return metastore_ptr->batchWrite(batch_write, resp);
 }
 
+bool MetastoreProxy::alterTables(const String & name_space, const std::vector<Protos::DataModelTable> & tables)
+{
+    BatchCommitRequest batch_write;
+
+    for (const auto & table : tables)
+    {
+        String table_uuid = UUIDHelpers::UUIDToString(RPCHelpers::createUUID(table.uuid()));
+        batch_write.AddPut(SinglePutRequest(tableStoreKey(name_space, table_uuid, table.commit_time()), table.SerializeAsString(), true));
+    }
+
+    BatchCommitResponse resp;
+    return metastore_ptr->batchWrite(batch_write, resp);
+}
+
 Strings MetastoreProxy::getAllTablesInDB(const String & name_space, const String & database)
 {
     Strings res;
@@ -659,7 +673,8 @@ void MetastoreProxy::setNonHostUpdateTimeStamp(const String & name_space, const
 
 void MetastoreProxy::prepareAddDataParts(const String & name_space, const String & table_uuid, const Strings & current_partitions,
         const google::protobuf::RepeatedPtrField<Protos::DataModelPart> & parts, BatchCommitRequest & batch_write,
-        const std::vector<String> & expected_parts, bool update_sync_list)
+        const std::vector<String> & expected_parts,
+        const std::unordered_map<String, String> & aggregated_minmax, bool update_sync_list)
 {
     if (parts.empty())
         return;
@@ -673,6 +688,7 @@ void MetastoreProxy::prepareAddDataParts(const String & name_space, const String
     if (expected_parts_size != static_cast<size_t>(parts.size()))
         throw Exception("Part size wants to write does not match the expected part size.", ErrorCodes::LOGICAL_ERROR);
 
+    std::unordered_set<String> touched_partitions;
     for (auto it = parts.begin(); it != parts.end(); it++)
     {
         auto info_ptr = createPartInfoFromModel(it->part_info());
@@ -683,13 +699,21 @@ void MetastoreProxy::prepareAddDataParts(const String & name_space, const String
 
         batch_write.AddPut(SinglePutRequest(dataPartKey(name_space, table_uuid, info_ptr->getPartName()), part_meta, expected_parts[it - parts.begin()]));
 
-        if (!existing_partitions.count(info_ptr->partition_id) && !partition_map.count(info_ptr->partition_id))
+        touched_partitions.insert(info_ptr->partition_id);
+        /// Existing partitions get their meta rewritten only when there is a new aggregated minmax for them.
+        if (!partition_map.count(info_ptr->partition_id)
+            && (!existing_partitions.count(info_ptr->partition_id) || aggregated_minmax.count(info_ptr->partition_id)))
             partition_map.emplace(info_ptr->partition_id, it->partition_minmax());
     }
 
     if (update_sync_list)
         batch_write.AddPut(SinglePutRequest(syncListKey(name_space, table_uuid, commit_time), std::to_string(commit_time)));
 
+    /// Record the parts commit version of every touched partition within the same batch so that
+    /// part cache holders can detect staleness and fetch only the delta since their synced version.
+    for (const auto & partition_id : touched_partitions)
+        batch_write.AddPut(SinglePutRequest(partitionPartsVersionKey(name_space, table_uuid, partition_id), std::to_string(commit_time)));
+
     Protos::PartitionMeta partition_model;
     for (auto it = partition_map.begin(); it != partition_map.end(); it++)
     {
@@ -699,11 +723,47 @@ void MetastoreProxy::prepareAddDataParts(const String & name_space, const String
 
         partition_model.set_id(it->first);
         partition_model.set_partition_minmax(it->second);
+        if (auto agg_it = aggregated_minmax.find(it->first); agg_it != aggregated_minmax.end())
+            partition_model.set_aggregated_minmax(agg_it->second);
+        else
+            partition_model.clear_aggregated_minmax();
 
         batch_write.AddPut(SinglePutRequest(ss.str(), partition_model.SerializeAsString()));
     }
 }
 
+std::unordered_map<String, UInt64> MetastoreProxy::getPartitionsPartsVersion(const String & name_space, const String & uuid, const Strings & partitions)
+{
+    Strings keys;
+    keys.reserve(partitions.size());
+    for (const auto & partition_id : partitions)
+        keys.push_back(partitionPartsVersionKey(name_space, uuid, partition_id));
+
+    std::unordered_map<String, UInt64> res;
+    auto values = metastore_ptr->multiGet(keys);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        if (!values[i].first.empty())
+            res.emplace(partitions[i], std::stoull(values[i].first, nullptr));
+    }
+    return res;
+}
+
+Strings MetastoreProxy::getPartitionMetas(const String & name_space, const String & uuid, const Strings & partitions)
+{
+    Strings keys;
+    keys.reserve(partitions.size());
+    for (const auto & partition_id : partitions)
+        keys.push_back(tablePartitionInfoPrefix(name_space, uuid) + partition_id + '_');
+
+    Strings res;
+    res.reserve(partitions.size());
+    auto values = metastore_ptr->multiGet(keys);
+    for (auto & value : values)
+        res.emplace_back(std::move(value.first));
+    return res;
+}
+
 void MetastoreProxy::prepareAddStagedParts(
     const String & name_space, const String & table_uuid,
     const google::protobuf::RepeatedPtrField<Protos::DataModelPart> & parts,
@@ -881,6 +941,16 @@ std::pair<bool, String> MetastoreProxy::updateTransactionRecord(const String & n
     return metastore_ptr->putCAS(transactionRecordKey(name_space, txn_id), txn_data_new, txn_data_old, true);
 }
 
+void MetastoreProxy::updateTransactionRecords(
+    const String & name_space, const std::vector<std::pair<UInt64, std::pair<String, String>>> & txns_data, BatchCommitResponse & response)
+{
+    BatchCommitRequest batch_write(true, true);
+    for (const auto & [txn_id, txn_data] : txns_data)
+        batch_write.AddPut(SinglePutRequest(transactionRecordKey(name_space, txn_id), txn_data.second, txn_data.first));
+
+    metastore_ptr->batchWrite(batch_write, response);
+}
+
 bool MetastoreProxy::updateTransactionRecordWithOffsets(const String &name_space, const UInt64 &txn_id,
                                                         const String &txn_data_old, const String &txn_data_new,
                                                         const String & consumer_group,
@@ -1469,6 +1539,15 @@ IMetaStore::IteratorPtr MetastoreProxy::getMetaInRange(const String & prefix, co
     return metastore_ptr->getByRange(prefix + range_start, prefix + range_end, include_start, include_end);
 }
 
+std::vector<IMetaStore::IteratorPtr> MetastoreProxy::getMetaInRanges(const String & prefix, const std::vector<IMetaStore::RangeRequest> & ranges)
+{
+    std::vector<IMetaStore::RangeRequest> full_ranges;
+    full_ranges.reserve(ranges.size());
+    for (const auto & range : ranges)
+        full_ranges.push_back({prefix + range.start_key, prefix + range.end_key, range.include_start, range.include_end});
+    return metastore_ptr->multiGetByRanges(full_ranges);
+}
+
 void MetastoreProxy::prepareAddDeleteBitmaps(const String & name_space, const String & table_uuid,
                                              const DeleteBitmapMetaPtrVector & bitmaps,
                                              BatchCommitRequest & batch_write,
@@ -51,6 +51,7 @@ namespace DB::Catalog
 #define PART_STORE_PREFIX "PT_"
 #define STAGED_PART_STORE_PREFIX "STG_PT_"
 #define TABLE_PARTITION_INFO_PREFIX "TP_"
+#define PARTITION_PARTS_VERSION_PREFIX "PPV_"
 #define WORKER_GROUP_STORE_PREFIX "WC_"
 #define RM_VW_PREFIX "RMVW_" /// Resource Management Virtual Warehouse
 #define RM_WG_PREFIX "RMWG_" /// Resource Management Worker Group
@@ -292,6 +293,18 @@ public:
         return escapeString(name_space) + '_' + TABLE_PARTITION_INFO_PREFIX + uuid + '_';
     }
 
+    /// Per-partition commit version records used by the incremental part cache sync protocol.
+    /// The value is the commit timestamp of the latest batch of parts written to the partition.
+    static std::string partitionPartsVersionPrefix(const std::string & name_space, const std::string & uuid)
+    {
+        return escapeString(name_space) + '_' + PARTITION_PARTS_VERSION_PREFIX + uuid + '_';
+    }
+
+    static std::string partitionPartsVersionKey(const std::string & name_space, const std::string & uuid, const std::string & partition_id)
+    {
+        return partitionPartsVersionPrefix(name_space, uuid) + partition_id;
+    }
+
     static std::string tableMutationPrefix(const std::string & name_space)
     {
         return escapeString(name_space) + "_" + TABLE_MUTATION_PREFIX;
@@ -552,6 +565,9 @@ public:
     String getTransactionRecord(const String & name_space, const UInt64 & txn_id);
     IMetaStore::IteratorPtr getAllTransactionRecord(const String & name_space, const size_t & max_result_number = 0);
     std::pair<bool, String> updateTransactionRecord(const String & name_space, const UInt64 & txn_id, const String & txn_data_old, const String & txn_data_new);
+    /// CAS update of several independent transaction records in one batch write. Conflicting
+    /// records are reported through `response` by their index in `txns_data`.
+    void updateTransactionRecords(const String & name_space, const std::vector<std::pair<UInt64, std::pair<String, String>>> & txns_data, BatchCommitResponse & response);
     std::vector<std::pair<String, UInt64>> getTransactionRecords(const String & name_space, const std::vector<TxnTimestamp> & txn_ids);
 
     bool updateTransactionRecordWithOffsets(const String & name_space, const UInt64 & txn_id, const String & txn_data_old, const String & txn_data_new, const String & consumer_group, const cppkafka::TopicPartitionList &);
@@ -609,6 +625,7 @@ public:
     void clearTableMeta(const String & name_space, const String & database, const String & table, const String & uuid, const Strings & dependencies, const UInt64 & ts = 0);
     void renameTable(const String & name_space, Protos::DataModelTable & table, const String & old_db_name, const String & old_table_name, const String & uuid, BatchCommitRequest & batch_write);
     bool alterTable(const String & name_space, const Protos::DataModelTable & table, const Strings & masks_to_remove, const Strings & masks_to_add);
+    bool alterTables(const String & name_space, const std::vector<Protos::DataModelTable> & tables);
     Strings getAllTablesInDB(const String & name_space, const String & database);
     IMetaStore::IteratorPtr getAllTablesMeta(const String & name_space);
     IMetaStore::IteratorPtr getAllUDFsMeta(const String & name_space, const String & database_name = "");
@@ -628,12 +645,25 @@ public:
     IMetaStore::IteratorPtr getAllDictionaryMeta(const String & name_space);
     std::vector<std::shared_ptr<DB::Protos::DataModelDictionary>> getDictionariesFromTrash(const String & name_space, const String & database);
 
+    /// `aggregated_minmax` maps partition id to the serialized minmax index aggregated over all parts of
+    /// the partition including the ones being committed. Partition metas of touched partitions present in
+    /// the map are (re)written with the new aggregate; an empty map keeps the old behavior of writing
+    /// partition metas only for partitions seen for the first time.
     void prepareAddDataParts(const String & name_space, const String & table_uuid, const Strings & current_partitions,
                              const google::protobuf::RepeatedPtrField<Protos::DataModelPart> & parts, BatchCommitRequest & batch_write,
-                             const std::vector<String> & expected_parts, bool update_sync_list = false);
+                             const std::vector<String> & expected_parts,
+                             const std::unordered_map<String, String> & aggregated_minmax = {}, bool update_sync_list = false);
     void prepareAddStagedParts(const String & name_space, const String & table_uuid, const google::protobuf::RepeatedPtrField<Protos::DataModelPart> & parts,
                                BatchCommitRequest & batch_write, const std::vector<String> & expected_staged_parts);
 
+    /// Get the parts commit version of each requested partition. Partitions without a version
+    /// record (never written since the protocol was introduced) are absent from the result.
+    std::unordered_map<String, UInt64> getPartitionsPartsVersion(const String & name_space, const String & uuid, const Strings & partitions);
+
+    /// Get the serialized partition metas of the requested partitions, aligned with the input.
+    /// Partitions without a meta record yield an empty string.
+    Strings getPartitionMetas(const String & name_space, const String & uuid, const Strings & partitions);
+
     /// mvcc version drop part
     void dropDataPart(const String & name_space, const String & table_uuid, const String & part_name, const String & part_info);
     Strings getPartsByName(const String & name_space, const String & uuid, RepeatedFields & parts_name);
@@ -719,6 +749,7 @@ public:
     Strings getDeleteBitmapByKeys(const Strings & key);
 
     IMetaStore::IteratorPtr getMetaInRange(const String & prefix, const String & range_start, const String & range_end, bool include_start, bool include_end);
+    std::vector<IMetaStore::IteratorPtr> getMetaInRanges(const String & prefix, const std::vector<IMetaStore::RangeRequest> & ranges);
 
     void precommitInsertionLabel(const String & name_space, const InsertionLabelPtr & label);
     void commitInsertionLabel(const String & name_space, InsertionLabelPtr & label);
@@ -0,0 +1,238 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// Micro-benchmarks for the CNCH metadata hot paths: part model deserialization
+/// (the dominant cost of Catalog::getTableParts), part wrapper construction,
+/// visibility calculation, part-to-worker assignment and TxnTimestamp ordering.
+/// All inputs are synthetic, so the benchmarks run without a metastore or a
+/// server Context and can be compared between revisions to catch regressions.
+
+#pragma clang diagnostic ignored "-Wzero-as-null-pointer-constant"
+
+#include <benchmark/benchmark.h>
+
+#include <Catalog/DataModelPartWrapper.h>
+#include <CloudServices/CnchPartsHelper.h>
+#include <MergeTreeCommon/assignCnchParts.h>
+#include <Protos/DataModelHelpers.h>
+#include <Protos/data_models.pb.h>
+#include <Transaction/TxnTimestamp.h>
+#include <Common/ConsistentHashUtils/ConsistentHashRing.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace DB;
+
+namespace
+{
+
+Protos::DataModelPart makePartModel(const String & partition_id, Int64 min_block, Int64 max_block, UInt32 level, UInt64 commit_time)
+{
+    Protos::DataModelPart model;
+    auto * info = model.mutable_part_info();
+    info->set_partition_id(partition_id);
+    info->set_min_block(min_block);
+    info->set_max_block(max_block);
+    info->set_level(level);
+    info->set_mutation(0);
+    info->set_hint_mutation(0);
+    model.set_size(128 * 1024 * 1024);
+    model.set_rows_count(1048576);
+    model.set_partition_minmax("");
+    model.set_commit_time(commit_time);
+    /// Typical per-part payload so serialized sizes are representative.
+    model.set_columns("columns format version: 1\n3 columns:\n`id` UInt64\n`event` String\n`value` Float64\n");
+    return model;
+}
+
+/// Synthetic metadata of one table: `num_parts` parts spread over `num_partitions`
+/// partitions with a Zipf-like skew (0 = uniform; larger values concentrate parts
+/// in the first partitions, mimicking hot recent partitions). Every 16th block of
+/// a partition becomes a level-1 part covering the previous 8 blocks, so the
+/// visibility calculation has real covering chains to resolve.
+std::vector<Protos::DataModelPart> makeSyntheticPartModels(size_t num_parts, size_t num_partitions, double skew)
+{
+    std::mt19937_64 rng(42);
+    std::vector<double> weights(num_partitions);
+    for (size_t i = 0; i < num_partitions; ++i)
+        weights[i] = 1.0 / std::pow(i + 1, skew);
+    std::discrete_distribution<size_t> pick_partition(weights.begin(), weights.end());
+
+    std::vector<Int64> next_block(num_partitions, 1);
+    std::vector<Protos::DataModelPart> models;
+    models.reserve(num_parts);
+
+    UInt64 commit_time = 1;
+    for (size_t i = 0; i < num_parts; ++i)
+    {
+        size_t p = pick_partition(rng);
+        Int64 block = next_block[p]++;
+        if (block % 16 == 0)
+            models.push_back(makePartModel(std::to_string(p), block - 8, block - 1, 1, commit_time++));
+        else
+            models.push_back(makePartModel(std::to_string(p), block, block, 0, commit_time++));
+    }
+    return models;
+}
+
+std::vector<String> serializeModels(const std::vector<Protos::DataModelPart> & models)
+{
+    std::vector<String> res;
+    res.reserve(models.size());
+    for (const auto & model : models)
+        res.push_back(model.SerializeAsString());
+    return res;
+}
+
+ServerDataPartsVector makeServerParts(const std::vector<Protos::DataModelPart> & models)
+{
+    ServerDataPartsVector parts;
+    parts.reserve(models.size());
+    for (const auto & model : models)
+        parts.push_back(std::make_shared<ServerDataPart>(createPartWrapperFromModelBasic(model)));
+    return parts;
+}
+
+/// Part model deserialization into standalone heap messages — the unit of work of
+/// Catalog::getTableParts when metadata comes back from the metastore.
+void BM_PartModelDeserialize(benchmark::State & state)
+{
+    auto serialized = serializeModels(makeSyntheticPartModels(state.range(0), state.range(1), /*skew*/ 1.0));
+    for (auto _ : state)
+    {
+        for (const auto & meta : serialized)
+        {
+            Protos::DataModelPart model;
+            bool ok = model.ParseFromString(meta);
+            benchmark::DoNotOptimize(ok);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * serialized.size());
+}
+BENCHMARK(BM_PartModelDeserialize)->Args({100000, 100})->Args({1000000, 1000})->Unit(benchmark::kMillisecond);
+
+/// Same parse, but straight into a shared arena — the part cache fill path.
+void BM_PartModelDeserializeIntoSlab(benchmark::State & state)
+{
+    auto serialized = serializeModels(makeSyntheticPartModels(state.range(0), state.range(1), /*skew*/ 1.0));
+    for (auto _ : state)
+    {
+        auto slab = std::make_shared<PartModelSlab>();
+        for (const auto & meta : serialized)
+        {
+            auto parsed = slab->parse(meta);
+            benchmark::DoNotOptimize(parsed);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * serialized.size());
+}
+BENCHMARK(BM_PartModelDeserializeIntoSlab)->Args({100000, 100})->Args({1000000, 1000})->Unit(benchmark::kMillisecond);
+
+void BM_CreatePartWrapper(benchmark::State & state)
+{
+    auto models = makeSyntheticPartModels(state.range(0), state.range(1), /*skew*/ 1.0);
+    for (auto _ : state)
+    {
+        for (const auto & model : models)
+        {
+            auto wrapper = createPartWrapperFromModelBasic(model);
+            benchmark::DoNotOptimize(wrapper);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * models.size());
+}
+BENCHMARK(BM_CreatePartWrapper)->Args({100000, 100})->Args({1000000, 1000})->Unit(benchmark::kMillisecond);
+
+/// Args: {num_parts, num_partitions, skew * 10}.
+void BM_CalcVisibleParts(benchmark::State & state)
+{
+    auto base = makeServerParts(makeSyntheticPartModels(state.range(0), state.range(1), state.range(2) / 10.0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        ServerDataPartsVector parts = base;
+        state.ResumeTiming();
+        auto visible = CnchPartsHelper::calcVisibleParts(parts, /*flatten*/ false);
+        benchmark::DoNotOptimize(visible);
+    }
+    state.SetItemsProcessed(state.iterations() * base.size());
+}
+BENCHMARK(BM_CalcVisibleParts)
+    ->Args({1000000, 1000, 0})
+    ->Args({1000000, 1000, 10})
+    ->Args({1000000, 1000, 20})
+    ->Unit(benchmark::kMillisecond);
+
+/// Args: {num_parts, num_workers}.
+void BM_AssignCnchPartsJump(benchmark::State & state)
+{
+    auto parts = makeServerParts(makeSyntheticPartModels(state.range(0), /*num_partitions*/ 1000, /*skew*/ 1.0));
+    WorkerList workers;
+    for (Int64 i = 0; i < state.range(1); ++i)
+        workers.push_back("worker_" + std::to_string(i));
+
+    for (auto _ : state)
+    {
+        auto assignment = assignCnchPartsWithJump(workers, parts);
+        benchmark::DoNotOptimize(assignment);
+    }
+    state.SetItemsProcessed(state.iterations() * parts.size());
+}
+BENCHMARK(BM_AssignCnchPartsJump)->Args({1000000, 8})->Args({1000000, 64})->Unit(benchmark::kMillisecond);
+
+/// Args: {num_parts, num_workers}. Ring parameters mirror the defaults of
+/// WorkerGroupHandleImpl::buildRing.
+void BM_AssignCnchPartsRing(benchmark::State & state)
+{
+    auto parts = makeServerParts(makeSyntheticPartModels(state.range(0), /*num_partitions*/ 1000, /*skew*/ 1.0));
+    ConsistentHashRing ring(/*replicas*/ 16, /*num_probes*/ 21, /*load_factor*/ 1.15);
+    for (Int64 i = 0; i < state.range(1); ++i)
+        ring.insert("worker_" + std::to_string(i));
+
+    for (auto _ : state)
+    {
+        auto assignment = assignCnchPartsWithRingAndBalance(ring, parts);
+        benchmark::DoNotOptimize(assignment);
+    }
+    state.SetItemsProcessed(state.iterations() * parts.size());
+}
+BENCHMARK(BM_AssignCnchPartsRing)->Args({1000000, 8})->Args({1000000, 64})->Unit(benchmark::kMillisecond);
+
+void BM_TxnTimestampSort(benchmark::State & state)
+{
+    std::mt19937_64 rng(42);
+    std::vector<TxnTimestamp> base(state.range(0));
+    for (auto & ts : base)
+        ts = TxnTimestamp(rng());
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto timestamps = base;
+        state.ResumeTiming();
+        std::sort(timestamps.begin(), timestamps.end());
+        benchmark::DoNotOptimize(timestamps.data());
+    }
+    state.SetItemsProcessed(state.iterations() * base.size());
+}
+BENCHMARK(BM_TxnTimestampSort)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+}
+
+BENCHMARK_MAIN();
@@ -200,8 +200,13 @@ Strings CnchBGThreadPartitionSelector::selectForMerge(const StoragePtr & storage
         return {res.begin(), res.end()};
     }
 
+    time_t now = time(nullptr);
     for (const auto & [_, estimator] : estimators)
     {
+        /// Write-cold partitions with no merge backlog only waste a visit;
+        /// the periodic round-robin pass still covers them eventually.
+        if (estimator->currentInsertRate(now) < INSERT_RATE_NEGLIGIBLE && estimator->merge_speed >= 1.0)
+            continue;
         if (estimator->eligibleForMerge())
             candidates.push_back(estimator);
     }
@@ -232,12 +237,20 @@ Strings CnchBGThreadPartitionSelector::selectForMerge(const StoragePtr & storage
     size_t i = 0;
     size_t k = only_realtime_partitions ? n : (n + 1) / 2;
 
-    /// Sort k partitions in insert_time order.
+    /// Sort k partitions in EWMA insert rate order, so the partitions absorbing the
+    /// current write traffic get visits proportionally often. Tie-break on insert time.
     std::nth_element(
         candidates.begin(),
         candidates.begin() + k,
         candidates.end(),
-        [](auto & lhs, auto & rhs) { return lhs->last_insert_time > rhs->last_insert_time; }
+        [now](auto & lhs, auto & rhs)
+        {
+            auto lhs_rate = lhs->currentInsertRate(now);
+            auto rhs_rate = rhs->currentInsertRate(now);
+            if (lhs_rate != rhs_rate)
+                return lhs_rate > rhs_rate;
+            return lhs->last_insert_time > rhs->last_insert_time;
+        }
     );
 
     /// Sort following k partitions in merge_speed order.
@@ -5,6 +5,7 @@
 #include <Poco/Logger.h>
 #include <Storages/IStorage_fwd.h>
 
+#include <cmath>
 #include <mutex>
 #include <set>
 #include <unordered_map>
@@ -22,6 +23,11 @@ constexpr double GC_SPEED_FAST_ENOUGH = 0.95;
 constexpr double MERGE_SPEED_FAST_ENOUGH = 1.2;
 constexpr size_t MIN_GC_PART_SIZE = 100;
 constexpr size_t POSTPONE_DURATION_SEC = 30;
+/// Half-life of the per-partition EWMA insert rate. One hour keeps yesterday's
+/// daily partition hot for a few hours after writes move on, then lets it decay.
+constexpr double INSERT_RATE_HALFLIFE_SEC = 3600;
+/// Below this rate a partition is considered write-cold (one insert decays to it in ~18h).
+constexpr double INSERT_RATE_NEGLIGIBLE = 1e-9;
 
 struct MergeGCSpeedEstimator
 {
@@ -35,6 +41,12 @@ struct MergeGCSpeedEstimator
     double merge_speed{0}; // merge_parts / insert_parts
     double gc_speed{0};    // gc_parts / merge_parts
 
+    /// Exponentially-decayed insert rate (roughly parts per second), as of insert_rate_time.
+    /// Lets the selector share background visits proportionally to the current write traffic
+    /// instead of revisiting long-cold partitions.
+    double insert_rate{0};
+    time_t insert_rate_time{0};
+
     /// We need to stop selecting the partition for some reasons:
     /// - the partition is selected at last schedule. Need to wait tasks finish to correct the speed.
     /// - feedback from the merge selector that currently it could not select any part range from this partition.
@@ -45,15 +57,28 @@ struct MergeGCSpeedEstimator
     {
         update_merge_speed();
         update_gc_speed();
+
+        /// Seed the rate from the loaded digest, which covers the last 7 days.
+        insert_rate = static_cast<double>(insert_) / (7 * 86400);
+        insert_rate_time = insert_time;
     }
 
     inline void insert(size_t num, time_t ts)
     {
         insert_parts += num;
         last_insert_time = ts;
+        update_insert_rate(num, ts);
         update_merge_speed();
     }
 
+    /// The EWMA insert rate decayed to `now`.
+    double currentInsertRate(time_t now) const
+    {
+        if (!insert_rate_time || now <= insert_rate_time)
+            return insert_rate;
+        return insert_rate * std::exp2(-difftime(now, insert_rate_time) / INSERT_RATE_HALFLIFE_SEC);
+    }
+
     inline void merge(size_t num)
     {
         merge_parts += num;
@@ -83,6 +108,15 @@ struct MergeGCSpeedEstimator
     }
 
 private:
+    inline void update_insert_rate(size_t num, time_t ts)
+    {
+        if (insert_rate_time && ts > insert_rate_time)
+            insert_rate *= std::exp2(-difftime(ts, insert_rate_time) / INSERT_RATE_HALFLIFE_SEC);
+        if (ts > insert_rate_time)
+            insert_rate_time = ts;
+        insert_rate += static_cast<double>(num) / INSERT_RATE_HALFLIFE_SEC;
+    }
+
     inline void update_merge_speed()
     {
         if (insert_parts == 0)
@@ -18,6 +18,7 @@
 #include <Catalog/Catalog.h>
 #include <Catalog/DataModelPartWrapper.h>
 #include <CloudServices/CnchPartsHelper.h>
+#include <CloudServices/commitCnchParts.h>
 #include <CloudServices/selectPartsToMerge.h>
 #include <CloudServices/CnchWorkerClient.h>
 #include <CloudServices/CnchWorkerClientPools.h>
@@ -403,6 +404,7 @@ void CnchMergeMutateThread::runImpl()
             std::lock_guard lock(worker_pool_mutex);
             vw_name = storage.getSettings()->cnch_vw_write;
             /// TODO: pick_worker_algo = storage.getSettings()->cnch_merge_pick_worker_algo;
+            max_bytes_inflight_per_worker = storage.getSettings()->cnch_merge_max_bytes_inflight_per_worker;
             vw_handle = getContext()->getVirtualWarehousePool().get(vw_name);
         }
 
@@ -617,6 +619,12 @@ bool CnchMergeMutateThread::trySelectPartsToMerge(StoragePtr & istorage, Storage
     metrics.elapsed_calc_visible_parts = watch.elapsedMicroseconds();
     watch.restart();
 
+    /// Parts whose recorded rows-TTL upper bound has passed contain only expired rows:
+    /// mark them dropped in the Catalog instead of sending them through a TTL-aware merge.
+    /// Physical deletion is deferred to the part GC.
+    if (storage.getInMemoryMetadataPtr()->hasRowsTTL())
+        tryDropExpiredParts(storage, visible_parts, merging_mutating_parts_snapshot);
+
     if (visible_parts.size() <= 1)
     {
         LOG_TRACE(log, "There is only {} part in visible_parts, exit merge selection.", visible_parts.size());
@@ -681,6 +689,52 @@ bool CnchMergeMutateThread::trySelectPartsToMerge(StoragePtr & istorage, Storage
     return true;
 }
 
+void CnchMergeMutateThread::tryDropExpiredParts(
+    StorageCnchMergeTree & storage, ServerDataPartsVector & visible_parts, const NameSet & merging_mutating_parts_snapshot)
+{
+    time_t now = time(nullptr);
+
+    ServerDataPartsVector expired_parts;
+    auto erase_it = std::remove_if(
+        visible_parts.begin(),
+        visible_parts.end(),
+        [&](const auto & part)
+        {
+            const auto & part_model = part->part_model();
+            if (!part_model.has_rows_ttl_max() || time_t(part_model.rows_ttl_max()) > now)
+                return false;
+            if (part->deleted() || merging_mutating_parts_snapshot.count(part->name()))
+                return false;
+            expired_parts.push_back(part);
+            return true;
+        });
+
+    if (expired_parts.empty())
+        return;
+    visible_parts.erase(erase_it, visible_parts.end());
+
+    ContextMutablePtr query_context = Context::createCopy(storage.getContext());
+
+    auto txn = query_context->getCnchTransactionCoordinator().createTransaction(
+        CreateTransactionOption().setInitiator(CnchTransactionInitiator::Merge).setPriority(CnchTransactionPriority::low));
+    SCOPE_EXIT({
+        if (txn)
+            query_context->getCnchTransactionCoordinator().finishTransaction(txn);
+    });
+
+    query_context->setCurrentTransaction(txn, false);
+    query_context->getHdfsConnectionParams().lookupOnNeed();
+    query_context->setQueryContext(query_context);
+
+    auto part_tombstones = storage.createPartTombstones(expired_parts, txn);
+    auto bitmap_tombstones = storage.createDeleteBitmapTombstones(part_tombstones, txn->getTransactionID());
+
+    auto cnch_writer = CnchDataWriter(storage, query_context, ManipulationType::Drop);
+    cnch_writer.dumpAndCommitCnchParts(part_tombstones, bitmap_tombstones);
+
+    LOG_DEBUG(log, "Dropped {} fully expired parts in Catalog by the TTL fast path", expired_parts.size());
+}
+
 Strings CnchMergeMutateThread::removeLockedPartition(const Strings & partitions)
 {
     constexpr UInt64 SLOW_THRESHOLD_MS = 200;
@@ -905,6 +959,7 @@ String CnchMergeMutateThread::triggerPartMerge(
             std::lock_guard pool_lock(worker_pool_mutex);
             vw_name = storage_settings->cnch_vw_write;
             /// pick_worker_algo = storage_settings->cnch_merge_pick_worker_algo;
+            max_bytes_inflight_per_worker = storage_settings->cnch_merge_max_bytes_inflight_per_worker;
             vw_handle = getContext()->getVirtualWarehousePool().get(vw_name);
         }
 
@@ -1052,9 +1107,73 @@ void CnchMergeMutateThread::finishTask(const String & task_id, const MergeTreeDa
     LOG_TRACE(log, "Finish manipulation task {}", task_id);
 }
 
-CnchWorkerClientPtr CnchMergeMutateThread::getWorker([[maybe_unused]] ManipulationType type, [[maybe_unused]] const ServerDataPartsVector & all_parts)
+CnchWorkerClientPtr CnchMergeMutateThread::getWorker([[maybe_unused]] ManipulationType type, const ServerDataPartsVector & all_parts)
 {
+    UInt64 task_bytes = 0;
+    for (const auto & part : all_parts)
+        task_bytes += part->part_model().size();
+
+    /// Bytes of source parts already dispatched to each worker and not yet finished.
+    std::unordered_map<String, UInt64> inflight_bytes;
+    {
+        std::lock_guard lock(task_records_mutex);
+        for (const auto & [_, record] : task_records)
+        {
+            if (!record->worker)
+                continue;
+            auto & bytes = inflight_bytes[record->worker->getRPCAddress()];
+            for (const auto & part : record->parts)
+                bytes += part->part_model().size();
+        }
+    }
+
     std::lock_guard lock(worker_pool_mutex);
+
+    /// Place the task on the worker with the most I/O headroom according to RM,
+    /// skipping workers that already have too many in-flight merge bytes.
+    ResourceRequirement requirement;
+    requirement.request_disk_bytes = task_bytes;
+    for (size_t attempt = 0; attempt < 3; ++attempt)
+    {
+        auto host_port = vw_handle->tryPickWorkerFromRM(VWScheduleAlgo::GlobalLowIO, requirement);
+        if (!host_port)
+            break;
+
+        auto it = inflight_bytes.find(host_port->getRPCAddress());
+        UInt64 worker_inflight = it == inflight_bytes.end() ? 0 : it->second;
+        if (!max_bytes_inflight_per_worker || worker_inflight + task_bytes <= max_bytes_inflight_per_worker)
+            return getContext()->getCnchWorkerClientPools().getWorker(*host_port);
+
+        LOG_DEBUG(
+            log,
+            "Worker {} already has {} in-flight bytes (cap {}), try to pick another one",
+            host_port->getRPCAddress(),
+            worker_inflight,
+            max_bytes_inflight_per_worker);
+
+        if (host_port->id.empty())
+            break; /// can't exclude this worker from the next pick
+        requirement.blocklist.insert(host_port->id);
+    }
+
+    /// RM is unavailable or every candidate is over the in-flight cap: fall back to
+    /// the known worker with the fewest in-flight bytes.
+    auto all_workers = vw_handle->getAllWorkers();
+    CnchWorkerClientPtr res;
+    UInt64 min_inflight = std::numeric_limits<UInt64>::max();
+    for (const auto & worker : all_workers)
+    {
+        auto it = inflight_bytes.find(worker->getRPCAddress());
+        UInt64 worker_inflight = it == inflight_bytes.end() ? 0 : it->second;
+        if (worker_inflight < min_inflight)
+        {
+            min_inflight = worker_inflight;
+            res = worker;
+        }
+    }
+    if (res)
+        return res;
+
     return vw_handle->getWorker();
 }
 
@@ -1102,19 +1221,54 @@ bool CnchMergeMutateThread::tryMutateParts([[maybe_unused]] StoragePtr & istorag
     if (current_mutations_by_version.empty())
         return false;
 
+    /// Fold pending compatible mutations into one working entry, so each part is rewritten
+    /// once with the concatenated command list and stamped with the newest commit time,
+    /// instead of being rewritten once per queued mutation. Recluster mutations change part
+    /// placement and always run as their own pass, so folding stops at the first one.
+    auto make_batched_entry = [&](std::lock_guard<std::mutex> &)
+    {
+        auto it = current_mutations_by_version.begin();
+        current_mutate_entry = std::make_optional<CnchMergeTreeMutationEntry>(it->second);
+        current_mutate_batch = {it->first};
+
+        if (!storage.getSettings()->cnch_merge_enable_batch_mutations || current_mutate_entry->isReclusterMutation())
+            return;
+
+        for (++it; it != current_mutations_by_version.end(); ++it)
+        {
+            const auto & next_entry = it->second;
+            if (next_entry.isReclusterMutation())
+                break;
+
+            current_mutate_entry->commands.insert(
+                current_mutate_entry->commands.end(), next_entry.commands.begin(), next_entry.commands.end());
+            current_mutate_entry->commit_time = next_entry.commit_time;
+            current_mutate_entry->columns_commit_time
+                = std::max(current_mutate_entry->columns_commit_time, next_entry.columns_commit_time);
+            current_mutate_batch.push_back(it->first);
+        }
+
+        if (current_mutate_batch.size() > 1)
+            LOG_DEBUG(
+                log,
+                "Batched {} pending mutations into one rewrite pass, combined version {}",
+                current_mutate_batch.size(),
+                current_mutate_entry->commit_time);
+    };
+
     const auto & entry = current_mutations_by_version.begin()->second;
     /// Set the `current_mutate_entry` to the first mutate entry
     if (!current_mutate_entry.has_value())
     {
-        current_mutate_entry = std::make_optional<CnchMergeTreeMutationEntry>(entry);
+        make_batched_entry(lock);
     }
-    else if (current_mutate_entry->commit_time != entry.commit_time)
+    else if (current_mutate_batch.empty() || current_mutate_batch.front() != entry.commit_time)
     {
         /// Should not happen
         LOG_WARNING(log, "Current mutation entry missed: {}, found {}", current_mutate_entry->commit_time, entry.commit_time);
         scheduled_mutation_partitions.clear();
         finish_mutation_partitions.clear();
-        current_mutate_entry = std::make_optional<CnchMergeTreeMutationEntry>(entry);
+        make_batched_entry(lock);
     }
 
     auto generate_tasks = [&](const ServerDataPartsVector & visible_parts, const NameSet & merging_mutating_parts_snapshot)
@@ -1232,12 +1386,15 @@ bool CnchMergeMutateThread::tryMutateParts([[maybe_unused]] StoragePtr & istorag
         }
     }
 
-    removeMutationEntry(commit_ts, newest_cluster_by, lock);
+    /// All parts are stamped with the combined commit time, which covers every folded entry.
+    for (const auto & batched_commit_ts : current_mutate_batch)
+        removeMutationEntry(batched_commit_ts, newest_cluster_by, lock);
 
     /// clear
     scheduled_mutation_partitions.clear();
     finish_mutation_partitions.clear();
     current_mutate_entry.reset();
+    current_mutate_batch.clear();
 
     return false;
 }
@@ -1303,6 +1460,7 @@ void CnchMergeMutateThread::triggerPartMutate(StoragePtr storage)
         std::lock_guard pool_lock(worker_pool_mutex);
         vw_name = cnch->getSettings()->cnch_vw_write;
         /// pick_worker_algo = storage_settings->cnch_merge_pick_worker_algo;
+        max_bytes_inflight_per_worker = cnch->getSettings()->cnch_merge_max_bytes_inflight_per_worker;
         vw_handle = getContext()->getVirtualWarehousePool().get(vw_name);
         if (!vw_handle)
             return;
@@ -166,6 +166,8 @@ private:
 
     bool tryMergeParts(StoragePtr & istorage, StorageCnchMergeTree & storage);
     bool trySelectPartsToMerge(StoragePtr & istorage, StorageCnchMergeTree & storage, MergeSelectionMetrics & metrics);
+    /// TTL fast path: drop fully expired parts in the Catalog without reading their data.
+    void tryDropExpiredParts(StorageCnchMergeTree & storage, ServerDataPartsVector & visible_parts, const NameSet & merging_mutating_parts_snapshot);
     String submitFutureManipulationTask(FutureManipulationTask & future_task, bool maybe_sync_task = false);
 
     // Mutate
@@ -206,6 +208,9 @@ private:
     NameSet scheduled_mutation_partitions;
     NameSet finish_mutation_partitions;
     std::optional<CnchMergeTreeMutationEntry> current_mutate_entry;
+    /// Commit times of the pending mutations folded into current_mutate_entry, in commit
+    /// order. Holds a single element when mutation batching is disabled or not applicable.
+    std::vector<TxnTimestamp> current_mutate_batch;
     std::map<TxnTimestamp, CnchMergeTreeMutationEntry> current_mutations_by_version;
 
     /// Separate quota for merge & mutation tasks
@@ -223,6 +228,7 @@ private:
     std::mutex worker_pool_mutex;
     String vw_name;
     String pick_worker_algo;
+    UInt64 max_bytes_inflight_per_worker{0};
     VirtualWarehouseHandle vw_handle;
 
     std::atomic_bool shutdown_called{false};
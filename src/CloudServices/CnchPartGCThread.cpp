@@ -15,13 +15,17 @@
 
 #include <CloudServices/CnchPartGCThread.h>
 
+#include <atomic>
+#include <chrono>
 #include <random>
+#include <thread>
 #include <Catalog/Catalog.h>
 #include <CloudServices/CnchPartsHelper.h>
 #include <CloudServices/commitCnchParts.h>
 #include <Interpreters/ServerPartLog.h>
 #include <Storages/MergeTree/MergeTreeData.h>
 #include <Storages/MergeTree/MergeTreeDataPartCNCH.h>
+#include <Storages/PartCacheManager.h>
 #include <Storages/StorageCnchMergeTree.h>
 #include <WorkerTasks/ManipulationType.h>
 #include <Poco/Exception.h>
@@ -66,9 +70,7 @@ void CnchPartGCThread::runImpl()
             else
             {
                 /// Do GC partition by partition to avoid holding too many ServerParts.
-                for (const auto & p : partitions)
-                    clearOldPartsByPartition(istorage, storage, p, in_wakeup, gc_timestamp);
-
+                clearOldPartsInPartitions(istorage, storage, partitions, in_wakeup, gc_timestamp);
                 last_gc_timestamp = gc_timestamp;
             }
         }
@@ -100,6 +102,76 @@ void CnchPartGCThread::runImpl()
 void CnchPartGCThread::clearData()
 {
     removeCandidatePartitions();
+
+    std::lock_guard lock(gc_watermarks_mutex);
+    partition_gc_watermarks.clear();
+}
+
+void CnchPartGCThread::clearOldPartsInPartitions(
+    const StoragePtr & istorage, StorageCnchMergeTree & storage, const Strings & partitions, bool in_wakeup, TxnTimestamp gc_timestamp)
+{
+    auto storage_settings = storage.getSettings();
+
+    /// Rate limit shared by all scan workers of the table so a big GC backlog cannot
+    /// monopolize the metastore cluster and starve foreground reads.
+    UInt64 max_scan_rate = storage_settings->gc_partition_scan_max_rate;
+    std::mutex rate_mutex;
+    UInt64 next_slot_us = 0;
+    auto acquire_scan_slot = [&]()
+    {
+        if (!max_scan_rate)
+            return;
+        UInt64 interval_us = 1000000 / max_scan_rate;
+        UInt64 wait_us = 0;
+        {
+            std::lock_guard lock(rate_mutex);
+            UInt64 now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+            if (next_slot_us < now_us)
+                next_slot_us = now_us;
+            wait_us = next_slot_us - now_us;
+            next_slot_us += interval_us;
+        }
+        if (wait_us)
+            std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+    };
+
+    size_t scan_threads = std::min<size_t>(storage_settings->gc_partition_scan_thread_pool_size, partitions.size());
+    if (scan_threads <= 1)
+    {
+        for (const auto & p : partitions)
+        {
+            acquire_scan_slot();
+            clearOldPartsByPartition(istorage, storage, p, in_wakeup, gc_timestamp);
+        }
+        return;
+    }
+
+    /// Partitions are independent key ranges for GC purposes, so scan them concurrently.
+    /// Workers pull the next unscanned partition from a shared index, which keeps all of
+    /// them busy even when partition sizes are heavily skewed.
+    ThreadPool scan_pool(scan_threads);
+    std::atomic<size_t> next_partition{0};
+    for (size_t i = 0; i < scan_threads; ++i)
+    {
+        scan_pool.scheduleOrThrowOnError([&]
+        {
+            size_t index;
+            while ((index = next_partition++) < partitions.size())
+            {
+                acquire_scan_slot();
+                try
+                {
+                    clearOldPartsByPartition(istorage, storage, partitions[index], in_wakeup, gc_timestamp);
+                }
+                catch (...)
+                {
+                    tryLogCurrentException(log, __PRETTY_FUNCTION__);
+                }
+            }
+        });
+    }
+    scan_pool.wait();
 }
 
 void CnchPartGCThread::clearOldPartsByPartition(const StoragePtr & istorage, StorageCnchMergeTree & storage, const String & partition_id, bool in_wakeup, TxnTimestamp gc_timestamp)
@@ -107,6 +179,31 @@ void CnchPartGCThread::clearOldPartsByPartition(const StoragePtr & istorage, Sto
     auto storage_settings = storage.getSettings();
     auto now = time(nullptr);
 
+    /// Incremental GC: every part commit on the host server advances the partition's sync
+    /// version in the part cache. If it has not moved past the version this thread already
+    /// swept completely, rescanning the partition cannot find new garbage, so skip it.
+    /// Unique tables (delete bitmaps and staged parts don't bump the part sync version) and
+    /// tables with partition-level TTL (expiry is wall-time driven) are always scanned.
+    auto metadata_snapshot = storage.getInMemoryMetadataPtr();
+    bool may_use_watermark = !in_wakeup && !metadata_snapshot->hasUniqueKey() && !metadata_snapshot->hasPartitionLevelTTL();
+    UInt64 current_sync_version = 0;
+    if (may_use_watermark)
+    {
+        if (auto cache_manager = getContext()->getPartCacheManager())
+            current_sync_version = cache_manager->getPartitionLastSyncVersion(storage.getStorageUUID(), partition_id);
+
+        if (current_sync_version)
+        {
+            std::lock_guard lock(gc_watermarks_mutex);
+            auto it = partition_gc_watermarks.find(partition_id);
+            if (it != partition_gc_watermarks.end() && current_sync_version <= it->second)
+            {
+                LOG_TRACE(log, "Skip scanning partition {}: nothing committed since swept version {}", partition_id, it->second);
+                return;
+            }
+        }
+    }
+
     Stopwatch watch;
     auto all_parts = catalog->getServerDataPartsInPartitions(istorage, {partition_id}, gc_timestamp, nullptr);
     LOG_TRACE(log, "Get parts for {} from Catalog cost {} us, size: {}", partition_id, watch.elapsedMicroseconds(), all_parts.size());
@@ -125,6 +222,7 @@ void CnchPartGCThread::clearOldPartsByPartition(const StoragePtr & istorage, Sto
     /// Clear special old parts
     UInt64 old_parts_lifetime = in_wakeup ? 0ull : UInt64(storage_settings->old_parts_lifetime.totalSeconds());
 
+    size_t lifetime_deferred_parts = invisible_dropped_parts.size() + visible_alone_drop_ranges.size();
     invisible_dropped_parts.erase(
         std::remove_if(
             invisible_dropped_parts.begin(),
@@ -141,6 +239,8 @@ void CnchPartGCThread::clearOldPartsByPartition(const StoragePtr & istorage, Sto
         visible_alone_drop_ranges.end());
     pushToRemovingQueue(storage, visible_alone_drop_ranges, "visible alone drop range");
 
+    lifetime_deferred_parts -= invisible_dropped_parts.size() + visible_alone_drop_ranges.size();
+
     if (!visible_alone_drop_ranges.empty() || !invisible_dropped_parts.empty())
     {
         LOG_DEBUG(
@@ -215,6 +315,17 @@ void CnchPartGCThread::clearOldPartsByPartition(const StoragePtr & istorage, Sto
     {
         collectBetweenCheckpoints(storage, visible_parts, {}, checkpoints[i - 1], checkpoints[i]);
     }
+
+    /// Record the watermark only after a sweep that deferred nothing to old_parts_lifetime.
+    /// The scan only covers commit versions up to gc_timestamp (which trails the wall clock),
+    /// so cap the watermark there: parts committed later stay above it and get re-examined
+    /// once the GC horizon passes them.
+    if (may_use_watermark && current_sync_version && !lifetime_deferred_parts)
+    {
+        std::lock_guard lock(gc_watermarks_mutex);
+        auto & watermark = partition_gc_watermarks[partition_id];
+        watermark = std::max(watermark, std::min(current_sync_version, gc_timestamp.toUInt64()));
+    }
 }
 
 /// TODO: optimize me
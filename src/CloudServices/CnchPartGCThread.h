@@ -45,6 +45,10 @@ private:
     void runImpl() override;
     void clearData() override;
 
+    /// Scan the given partitions for garbage, concurrently when gc_partition_scan_thread_pool_size > 1
+    /// and throttled to gc_partition_scan_max_rate scans per second.
+    void clearOldPartsInPartitions(
+        const StoragePtr & istorage, StorageCnchMergeTree & storage, const Strings & partitions, bool in_wakeup, TxnTimestamp gc_timestamp);
     void clearOldPartsByPartition(const StoragePtr & istorage, StorageCnchMergeTree & storage, const String & partition_id, bool in_wakeup, TxnTimestamp gc_timestamp);
     void clearOldInsertionLabels(const StoragePtr & istorage, StorageCnchMergeTree & storage);
 
@@ -92,6 +96,13 @@ private:
     pcg64 rng;
     TxnTimestamp last_gc_timestamp{0};
 
+    /// Per-partition GC watermark: the highest part commit version up to which the partition
+    /// has been fully swept. When the part cache's sync version for the partition has not
+    /// advanced past the watermark, a new Catalog scan cannot find anything more to collect,
+    /// so the partition is skipped. Guarded by a mutex as partitions are scanned concurrently.
+    std::mutex gc_watermarks_mutex;
+    std::unordered_map<String, UInt64> partition_gc_watermarks;
+
     std::queue<IMergeTreeDataPartPtr> removing_queue;
 
     std::weak_ptr<ICnchBGThread> merge_thread;
@@ -18,6 +18,8 @@
 #include <Catalog/DataModelPartWrapper.h>
 #include <Interpreters/Context.h>
 #include <Storages/MergeTree/IMergeTreeDataPart.h>
+#include <Common/ThreadPool.h>
+#include <common/StringRef.h>
 
 #include <sstream>
 
@@ -58,18 +60,6 @@ namespace
         return oss.str();
     }
 
-    template <class T>
-    struct PartComparator
-    {
-        bool operator()(const T & lhs, const T & rhs) const
-        {
-            auto & l = lhs->get_info();
-            auto & r = rhs->get_info();
-            return std::forward_as_tuple(l.partition_id, l.min_block, l.max_block, l.level, lhs->get_commit_time(), l.storage_type)
-                < std::forward_as_tuple(r.partition_id, r.min_block, r.max_block, r.level, rhs->get_commit_time(), r.storage_type);
-        }
-    };
-
     /** Cnch parts classification:
      *  all parts:
      *  1) invisible parts
@@ -82,41 +72,66 @@ namespace
      *          ii) not alone
      */
 
+    /// Sort parts by (partition_id, min_block, max_block, level, commit_time, storage_type).
+    /// The sort keys are first extracted into one flat array so that the O(n log n) comparisons
+    /// run over contiguous memory instead of chasing part objects and re-reading commit times.
     template <class Vec>
-    Vec calcVisiblePartsImpl(
-        Vec & all_parts,
-        bool flatten,
-        bool skip_drop_ranges,
-        Vec * visible_alone_drop_ranges,
-        Vec * invisible_dropped_parts,
-        LoggingOption logging)
+    void sortPartsByInfo(Vec & parts)
     {
-        using Part = typename Vec::value_type;
-
-        Vec visible_parts;
-
-        if (all_parts.empty())
-            return visible_parts;
-
-        if (all_parts.size() == 1)
+        struct SortKey
         {
-            if (skip_drop_ranges && all_parts.front()->get_deleted())
-                ; /// do nothing
-            else
-                visible_parts = all_parts;
-
-            if (visible_alone_drop_ranges && all_parts.front()->get_deleted())
-                *visible_alone_drop_ranges = all_parts;
-            return visible_parts;
+            StringRef partition_id;
+            Int64 min_block;
+            Int64 max_block;
+            UInt32 level;
+            UInt64 commit_time;
+            UInt8 storage_type;
+            UInt32 index;
+        };
+
+        std::vector<SortKey> keys;
+        keys.reserve(parts.size());
+        for (size_t i = 0; i < parts.size(); ++i)
+        {
+            const auto & info = parts[i]->get_info();
+            keys.push_back(
+                {StringRef(info.partition_id),
+                 info.min_block,
+                 info.max_block,
+                 info.level,
+                 parts[i]->get_commit_time(),
+                 static_cast<UInt8>(info.storage_type),
+                 static_cast<UInt32>(i)});
         }
 
-        std::sort(all_parts.begin(), all_parts.end(), PartComparator<Part>{});
+        std::sort(keys.begin(), keys.end(), [](const SortKey & l, const SortKey & r) {
+            return std::forward_as_tuple(l.partition_id, l.min_block, l.max_block, l.level, l.commit_time, l.storage_type)
+                < std::forward_as_tuple(r.partition_id, r.min_block, r.max_block, r.level, r.commit_time, r.storage_type);
+        });
 
-        /// One-pass algorithm to construct delta chains
-        auto prev_it = all_parts.begin();
-        auto curr_it = std::next(prev_it);
+        Vec sorted;
+        sorted.reserve(parts.size());
+        for (const auto & key : keys)
+            sorted.push_back(std::move(parts[key.index]));
+        parts.swap(sorted);
+    }
 
-        while (prev_it != all_parts.end())
+    /// One-pass construction of delta chains over a sorted range of parts. The range may be the
+    /// whole sorted vector or one partition of it; the logic is identical since chains never
+    /// cross partition boundaries.
+    template <class Vec>
+    void buildPartsChains(
+        typename Vec::iterator range_begin,
+        typename Vec::iterator range_end,
+        bool skip_drop_ranges,
+        Vec & visible_parts,
+        Vec * visible_alone_drop_ranges,
+        Vec * invisible_dropped_parts)
+    {
+        auto prev_it = range_begin;
+        auto curr_it = prev_it == range_end ? range_end : std::next(prev_it);
+
+        while (prev_it != range_end)
         {
             auto & prev_part = *prev_it;
 
@@ -124,7 +139,7 @@ namespace
             if (prev_part->get_info().level == MergeTreePartInfo::MAX_LEVEL)
             {
                 /// a. curr_part is in same partition
-                if (curr_it != all_parts.end() && prev_part->get_info().partition_id == (*curr_it)->get_info().partition_id)
+                if (curr_it != range_end && prev_part->get_info().partition_id == (*curr_it)->get_info().partition_id)
                 {
                     /// i) curr_part is also a DROP RANGE mark, and must be the bigger one
                     if ((*curr_it)->get_info().level == MergeTreePartInfo::MAX_LEVEL)
@@ -171,7 +186,7 @@ namespace
                 prev_part->setPreviousPart(nullptr);
             }
             /// 2. curr_part contains the prev_part
-            else if (curr_it != all_parts.end() && (*curr_it)->containsExactly(*prev_part))
+            else if (curr_it != range_end && (*curr_it)->containsExactly(*prev_part))
             {
                 (*curr_it)->setPreviousPart(prev_part);
             }
@@ -189,9 +204,100 @@ namespace
             }
 
             prev_it = curr_it;
-            if (curr_it != all_parts.end())
+            if (curr_it != range_end)
                 ++curr_it;
         }
+    }
+
+    template <class Vec>
+    Vec calcVisiblePartsImpl(
+        Vec & all_parts,
+        bool flatten,
+        bool skip_drop_ranges,
+        Vec * visible_alone_drop_ranges,
+        Vec * invisible_dropped_parts,
+        LoggingOption logging)
+    {
+        Vec visible_parts;
+
+        if (all_parts.empty())
+            return visible_parts;
+
+        if (all_parts.size() == 1)
+        {
+            if (skip_drop_ranges && all_parts.front()->get_deleted())
+                ; /// do nothing
+            else
+                visible_parts = all_parts;
+
+            if (visible_alone_drop_ranges && all_parts.front()->get_deleted())
+                *visible_alone_drop_ranges = all_parts;
+            return visible_parts;
+        }
+
+        sortPartsByInfo(all_parts);
+
+        /// For large tables, build the chains of each partition in parallel; results are
+        /// concatenated in partition order so the output matches the serial pass.
+        static constexpr size_t min_parts_for_parallel_visibility = 100000;
+        static constexpr size_t max_visibility_threads = 16;
+
+        if (all_parts.size() >= min_parts_for_parallel_visibility)
+        {
+            std::vector<std::pair<typename Vec::iterator, typename Vec::iterator>> partition_ranges;
+            for (auto range_begin = all_parts.begin(); range_begin != all_parts.end();)
+            {
+                auto range_end = std::next(range_begin);
+                while (range_end != all_parts.end()
+                       && (*range_end)->get_info().partition_id == (*range_begin)->get_info().partition_id)
+                    ++range_end;
+                partition_ranges.emplace_back(range_begin, range_end);
+                range_begin = range_end;
+            }
+
+            if (partition_ranges.size() > 1)
+            {
+                std::vector<Vec> visible_by_range(partition_ranges.size());
+                std::vector<Vec> alone_drop_ranges_by_range(visible_alone_drop_ranges ? partition_ranges.size() : 0);
+                std::vector<Vec> invisible_dropped_by_range(invisible_dropped_parts ? partition_ranges.size() : 0);
+
+                ThreadPool pool(std::min(partition_ranges.size(), max_visibility_threads));
+                for (size_t i = 0; i < partition_ranges.size(); ++i)
+                {
+                    pool.scheduleOrThrowOnError([&, i] {
+                        buildPartsChains<Vec>(
+                            partition_ranges[i].first,
+                            partition_ranges[i].second,
+                            skip_drop_ranges,
+                            visible_by_range[i],
+                            visible_alone_drop_ranges ? &alone_drop_ranges_by_range[i] : nullptr,
+                            invisible_dropped_parts ? &invisible_dropped_by_range[i] : nullptr);
+                    });
+                }
+                pool.wait();
+
+                for (size_t i = 0; i < partition_ranges.size(); ++i)
+                {
+                    visible_parts.insert(visible_parts.end(), visible_by_range[i].begin(), visible_by_range[i].end());
+                    if (visible_alone_drop_ranges)
+                        visible_alone_drop_ranges->insert(
+                            visible_alone_drop_ranges->end(), alone_drop_ranges_by_range[i].begin(), alone_drop_ranges_by_range[i].end());
+                    if (invisible_dropped_parts)
+                        invisible_dropped_parts->insert(
+                            invisible_dropped_parts->end(), invisible_dropped_by_range[i].begin(), invisible_dropped_by_range[i].end());
+                }
+            }
+            else
+            {
+                buildPartsChains<Vec>(
+                    all_parts.begin(), all_parts.end(), skip_drop_ranges, visible_parts, visible_alone_drop_ranges, invisible_dropped_parts);
+            }
+        }
+        else
+        {
+            buildPartsChains<Vec>(
+                all_parts.begin(), all_parts.end(), skip_drop_ranges, visible_parts, visible_alone_drop_ranges, invisible_dropped_parts);
+        }
 
         if (flatten)
             flattenPartsVector(visible_parts);
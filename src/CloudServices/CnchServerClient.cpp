@@ -46,13 +46,15 @@ CnchServerClient::CnchServerClient(HostWithPorts host_ports_)
 
 CnchServerClient::~CnchServerClient() = default;
 
-std::pair<TxnTimestamp, TxnTimestamp> CnchServerClient::createTransaction(const TxnTimestamp & primary_txn_id)
+std::pair<TxnTimestamp, TxnTimestamp> CnchServerClient::createTransaction(const TxnTimestamp & primary_txn_id, bool read_only)
 {
     brpc::Controller cntl;
     Protos::CreateTransactionReq request;
     Protos::CreateTransactionResp response;
     if (primary_txn_id)
         request.set_primary_txn_id(primary_txn_id.toUInt64());
+    if (read_only)
+        request.set_read_only(read_only);
     stub->createTransaction(&cntl, &request, &response, nullptr);
 
     assertController(cntl);
@@ -490,6 +492,30 @@ void CnchServerClient::acquireLock(const LockInfoPtr & lock)
     lock->status = static_cast<LockStatus>(response.lock_status());
 }
 
+void CnchServerClient::acquireLocks(const std::vector<LockInfoPtr> & locks)
+{
+    brpc::Controller cntl;
+    Protos::AcquireLocksReq request;
+    Protos::AcquireLocksResp response;
+
+    UInt64 total_timeout = 0;
+    for (const auto & lock : locks)
+    {
+        total_timeout += lock->timeout;
+        fillLockInfoModel(*lock, *request.add_locks());
+    }
+    /// locks are granted sequentially on the server, so the waits may add up
+    cntl.set_timeout_ms(3000 + (10 * total_timeout));
+    cntl.set_max_retry(0);
+
+    stub->acquireLocks(&cntl, &request, &response, nullptr);
+    assertController(cntl);
+    RPCHelpers::checkResponse(response);
+
+    for (int i = 0; i < response.lock_statuses_size(); ++i)
+        locks[i]->status = static_cast<LockStatus>(response.lock_statuses(i));
+}
+
 void CnchServerClient::releaseLock(const LockInfoPtr & lock)
 {
     brpc::Controller cntl;
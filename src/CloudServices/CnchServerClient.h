@@ -46,7 +46,7 @@ public:
     ~CnchServerClient() override;
 
     /// Transaction RPCs related. TODO @canh: add implement when baseline rpc implementation is merged
-    std::pair<TxnTimestamp, TxnTimestamp> createTransaction(const TxnTimestamp & primary_txn_id = {0});
+    std::pair<TxnTimestamp, TxnTimestamp> createTransaction(const TxnTimestamp & primary_txn_id = {0}, bool read_only = false);
     std::pair<TxnTimestamp, TxnTimestamp> createTransactionForKafka(const StorageID & storage_id, const size_t consumer_index);
     TxnTimestamp commitTransaction(
         const ICnchTransaction & txn, const StorageID & kafka_storage_id = StorageID::createEmpty(), const size_t consumer_index = 0);
@@ -106,6 +106,9 @@ public:
     bool removeMergeMutateTasksOnPartitions(const StorageID &, const std::unordered_set<String> &);
 
     void acquireLock(const LockInfoPtr & info);
+    /// Acquire several locks in one round trip. Locks are granted one by one on the
+    /// server; if one of them cannot be granted the remaining ones keep LOCK_INIT.
+    void acquireLocks(const std::vector<LockInfoPtr> & locks);
     void releaseLock(const LockInfoPtr & info);
     void assertLockAcquired(const TxnTimestamp & txn_id, LockID lock_ids);
     void reportCnchLockHeartBeat(const TxnTimestamp & txn_id, UInt64 expire_time = 0);
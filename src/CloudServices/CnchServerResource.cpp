@@ -18,16 +18,22 @@
 #include <Catalog/DataModelPartWrapper.h>
 #include <CloudServices/CnchPartsHelper.h>
 #include <CloudServices/CnchWorkerResource.h>
+#include <CloudServices/DiskCacheSummaryCache.h>
+#include <Core/UUID.h>
+#include <Interpreters/BloomFilter.h>
 #include <Interpreters/Context.h>
 #include <MergeTreeCommon/assignCnchParts.h>
 #include <brpc/controller.h>
 #include <Common/Exception.h>
 #include "Catalog/DataModelPartWrapper_fwd.h"
 
+#include <Storages/DiskCache/DiskCacheLRU.h>
 #include <Storages/Hive/HiveDataPart.h>
 #include <Storages/StorageCnchHive.h>
 #include <Storages/StorageCnchMergeTree.h>
 
+#include <cmath>
+
 namespace DB
 {
 AssignedResource::AssignedResource(const StoragePtr & storage_) : storage(storage_)
@@ -123,6 +129,14 @@ static std::vector<brpc::CallId> processSend(
 
     std::vector<brpc::CallId> call_ids;
 
+    if (context->getSettingsRef().enable_batch_send_resources)
+    {
+        /// one rpc per worker instead of one per table; as in the unbatched path,
+        /// create queries are only shipped to remote workers
+        call_ids.emplace_back(client->sendResources(context, resource_to_send, handler, /* with_create_queries */ !is_local));
+        return call_ids;
+    }
+
     if (!is_local)
     {
         Strings create_queries;
@@ -238,6 +252,86 @@ void CnchServerResource::sendResource(const ContextPtr & context, WorkerAction a
     handler.throwIfException();
 }
 
+/// Move parts toward workers whose disk cache summary says they already hold the
+/// part's segments, bounded by the same headroom the ring uses so the bias cannot
+/// skew the balance beyond what hash placement itself allows. A part whose home
+/// worker published no fresh summary keeps its hash placement.
+static void biasAssignmentTowardCachedWorkers(
+    ServerAssignmentMap & assigned_map,
+    const Strings & worker_ids,
+    const DiskCacheSummaryMap & summaries,
+    const String & storage_uuid,
+    size_t total_parts,
+    Poco::Logger * log)
+{
+    if (summaries.empty() || worker_ids.size() < 2 || total_parts == 0)
+        return;
+
+    auto cap_limit = static_cast<size_t>(std::ceil(1.15 * total_parts / worker_ids.size()));
+
+    std::unordered_map<String, size_t> load;
+    for (const auto & [worker_id, parts] : assigned_map)
+        load[worker_id] = parts.size();
+
+    auto may_contain = [&summaries](const String & worker_id, const DiskCacheLRU::KeyType & key)
+    {
+        auto it = summaries.find(worker_id);
+        return it != summaries.end() && it->second.filter
+            && it->second.filter->find(reinterpret_cast<const char *>(&key), sizeof(key));
+    };
+
+    size_t moved = 0;
+    for (const auto & worker_id : worker_ids)
+    {
+        /// without a fresh summary we cannot tell a miss from a stale filter
+        if (!summaries.count(worker_id))
+            continue;
+
+        auto map_it = assigned_map.find(worker_id);
+        if (map_it == assigned_map.end())
+            continue;
+
+        auto & parts = map_it->second;
+        for (size_t i = 0; i < parts.size();)
+        {
+            /// probe with the checksums segment, it is cached for every part the worker has touched
+            auto key = DiskCacheLRU::hash(
+                IDiskCacheSegment::formatSegmentName(storage_uuid, parts[i]->name(), "", 0, "checksums.txt"));
+            if (may_contain(worker_id, key))
+            {
+                ++i;
+                continue;
+            }
+
+            String target;
+            for (const auto & candidate : worker_ids)
+            {
+                if (candidate != worker_id && load[candidate] < cap_limit && may_contain(candidate, key))
+                {
+                    target = candidate;
+                    break;
+                }
+            }
+
+            if (target.empty())
+            {
+                ++i;
+                continue;
+            }
+
+            assigned_map[target].emplace_back(std::move(parts[i]));
+            parts[i] = std::move(parts.back());
+            parts.pop_back();
+            ++load[target];
+            --load[worker_id];
+            ++moved;
+        }
+    }
+
+    if (moved)
+        LOG_DEBUG(log, "Moved {} of {} parts to workers which already cache them", moved, total_parts);
+}
+
 void CnchServerResource::allocateResource(const ContextPtr & context, std::lock_guard<std::mutex> &)
 {
     std::vector<AssignedResource> resource_to_allocate;
@@ -280,13 +374,29 @@ void CnchServerResource::allocateResource(const ContextPtr & context, std::lock_
                     assigned_bucket_numbers_map = assignment.bucket_number_assignment_map;
                 }
                 else
+                {
                     assigned_map = assignCnchParts(worker_group, server_parts);
+                    if (context->getSettingsRef().enable_disk_cache_aware_part_allocation)
+                        biasAssignmentTowardCachedWorkers(
+                            assigned_map,
+                            worker_group->getWorkerIDVec(),
+                            DiskCacheSummaryCache::instance().getFreshSummaries(*worker_group),
+                            UUIDHelpers::UUIDToString(storage->getStorageUUID()),
+                            server_parts.size(),
+                            log);
+                }
             }
             else if (auto * cnchhive = dynamic_cast<StorageCnchHive *>(storage.get()))
             {
                 bool use_simple_hash = cnchhive->settings.use_simple_hash;
                 LOG_TRACE(log, "CnchSessionResource use_simple_hash is: {}", use_simple_hash);
-                assigned_hive_map = assignCnchHiveParts(worker_group, resource.hive_parts);
+                /// Bucketed tables get a bucket-sticky assignment so every worker re-reads
+                /// the same file set query after query; the bucket set itself was already
+                /// pruned during file listing on the server.
+                if (cnchhive->isBucketTable())
+                    assigned_hive_map = assignCnchHivePartsForBucketTable(worker_group, resource.hive_parts);
+                else
+                    assigned_hive_map = assignCnchHiveParts(worker_group, resource.hive_parts);
             }
 
             for (const auto & host_ports : host_ports_vec)
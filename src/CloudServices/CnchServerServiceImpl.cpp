@@ -183,7 +183,8 @@ void CnchServerServiceImpl::createTransaction(
                 = global_context.getCnchTransactionCoordinator().createTransaction(CreateTransactionOption()
                                                                                         .setPrimaryTransactionId(primary_txn_id)
                                                                                         .setType(CnchTransactionType::Implicit)
-                                                                                        .setInitiator(initiator));
+                                                                                        .setInitiator(initiator)
+                                                                                        .setReadOnly(request->read_only()));
             auto & controller = static_cast<brpc::Controller &>(*cntl);
             transaction->setCreator(butil::endpoint2str(controller.remote_side()).c_str());
 
@@ -736,6 +737,35 @@ void CnchServerServiceImpl::acquireLock(
     });
 }
 
+void CnchServerServiceImpl::acquireLocks(
+    google::protobuf::RpcController * cntl,
+    const Protos::AcquireLocksReq * request,
+    Protos::AcquireLocksResp * response,
+    google::protobuf::Closure * done)
+{
+    RPCHelpers::serviceHandler(done, response, [req = request, resp = response, d = done, gc = getContext(), logger = log] {
+        brpc::ClosureGuard done_guard(d);
+        try
+        {
+            for (const auto & lock_model : req->locks())
+            {
+                LockInfoPtr info = createLockInfoFromModel(lock_model);
+                LockManager::instance().lock(info, *gc);
+                resp->add_lock_statuses(to_underlying(info->status));
+                /// Stop at the first lock that cannot be granted: the client treats the
+                /// batch as failed and releases whatever has been acquired so far.
+                if (info->status != LockStatus::LOCK_OK)
+                    break;
+            }
+        }
+        catch (...)
+        {
+            tryLogCurrentException(logger, __PRETTY_FUNCTION__);
+            RPCHelpers::handleException(resp->mutable_exception());
+        }
+    });
+}
+
 void CnchServerServiceImpl::releaseLock(
     google::protobuf::RpcController * cntl,
     const Protos::ReleaseLockReq * request,
@@ -169,6 +169,12 @@ public:
         Protos::AcquireLockResp * response,
         google::protobuf::Closure * done) override;
 
+    void acquireLocks(
+        google::protobuf::RpcController * cntl,
+        const Protos::AcquireLocksReq * request,
+        Protos::AcquireLocksResp * response,
+        google::protobuf::Closure * done) override;
+
     void releaseLock(
         google::protobuf::RpcController * cntl,
         const Protos::ReleaseLockReq * request,
@@ -15,6 +15,10 @@
 
 #include <CloudServices/CnchWorkerClient.h>
 
+#include <CloudServices/CnchPartsHelper.h>
+#include <CloudServices/CnchServerResource.h>
+#include <IO/ReadBufferFromString.h>
+#include <Interpreters/BloomFilter.h>
 #include <Interpreters/Context.h>
 #include <Protos/DataModelHelpers.h>
 #include <Protos/RPCHelpers.h>
@@ -27,6 +31,7 @@
 
 #include <brpc/channel.h>
 #include <brpc/controller.h>
+#include <google/protobuf/arena.h>
 
 namespace DB
 {
@@ -180,6 +185,58 @@ void CnchWorkerClient::sendCreateQueries(const ContextPtr & context, const std::
     RPCHelpers::checkResponse(response);
 }
 
+brpc::CallId CnchWorkerClient::sendResources(
+    const ContextPtr & context,
+    const std::vector<AssignedResource> & resources,
+    ExceptionHandler & handler,
+    bool with_create_queries)
+{
+    /// The request only lives until the stub call serialized it; an arena spares
+    /// the per-table heap churn of the repeated part models.
+    google::protobuf::Arena arena;
+    auto * request = google::protobuf::Arena::CreateMessage<Protos::SendResourcesReq>(&arena);
+
+    const auto & settings = context->getSettingsRef();
+    auto timeout = settings.max_execution_time.value.totalSeconds();
+
+    request->set_txn_id(context->getCurrentTransactionID());
+    request->set_primary_txn_id(context->getCurrentTransaction()->getPrimaryTransactionID());
+    request->set_timeout(timeout ? timeout : 3600); /// clean session resource if there exists Exception after 3600s
+    request->set_disk_cache_mode(settings.disk_cache_mode.toString());
+
+    for (const auto & resource : resources)
+    {
+        auto * table = request->mutable_tables()->Add();
+        table->set_database_name(resource.storage->getDatabaseName());
+        table->set_table_name(resource.worker_table_name);
+        if (with_create_queries && !resource.sent_create_query)
+            table->set_create_table_query(resource.create_table_query);
+
+        if (!resource.server_parts.empty())
+        {
+            auto data_parts = resource.server_parts;
+            CnchPartsHelper::flattenPartsVector(data_parts);
+            fillBasePartAndDeleteBitmapModels(*resource.storage, data_parts, *table->mutable_parts(), *table->mutable_bitmaps());
+        }
+        else if (!resource.hive_parts.empty())
+            fillCnchHivePartsModel(resource.hive_parts, *table->mutable_hive_parts());
+
+        for (const auto & bucket_num : resource.bucket_numbers)
+            *table->mutable_bucket_numbers()->Add() = bucket_num;
+    }
+
+    auto * cntl = new brpc::Controller();
+    auto * response = new Protos::SendResourcesResp();
+    /// adjust the timeout to prevent timeout if there are too many parts to send,
+    auto send_timeout = std::max(settings.max_execution_time.value.totalMilliseconds() >> 1, 30 * 1000L);
+    cntl->set_timeout_ms(send_timeout);
+
+    auto call_id = cntl->call_id();
+    stub->sendResources(cntl, request, response, brpc::NewCallback(RPCHelpers::onAsyncCallDone, response, cntl, &handler));
+
+    return call_id;
+}
+
 brpc::CallId CnchWorkerClient::sendCnchHiveDataParts(
     const ContextPtr & context,
     const StoragePtr & storage,
@@ -298,6 +355,59 @@ void CnchWorkerClient::removeWorkerResource(TxnTimestamp txn_id)
     RPCHelpers::checkResponse(response);
 }
 
+DiskCacheSummary CnchWorkerClient::getDiskCacheSummary()
+{
+    brpc::Controller cntl;
+    Protos::GetDiskCacheSummaryReq request;
+    Protos::GetDiskCacheSummaryResp response;
+
+    stub->getDiskCacheSummary(&cntl, &request, &response, nullptr);
+
+    assertController(cntl);
+    RPCHelpers::checkResponse(response);
+
+    DiskCacheSummary summary;
+    summary.key_count = response.key_count();
+    summary.fetch_time = time(nullptr);
+    if (response.has_index_filter() && !response.index_filter().empty())
+    {
+        ReadBufferFromString in(response.index_filter());
+        /// placeholder parameters, deserialize() restores the real ones
+        summary.filter = std::make_shared<BloomFilter>(1, 1, 0);
+        summary.filter->deserialize(in);
+    }
+    return summary;
+}
+
+size_t CnchWorkerClient::preWarmDiskCache(
+    const ContextPtr & context,
+    const IStorage & storage,
+    const String & create_local_table_query,
+    const ServerDataPartsVector & parts,
+    size_t max_parallel_downloads)
+{
+    brpc::Controller cntl;
+    Protos::PreWarmDiskCacheReq request;
+    Protos::PreWarmDiskCacheResp response;
+
+    auto * hot_set = request.add_hot_sets();
+    hot_set->set_create_table_query(create_local_table_query);
+    fillPartsModelForSend(storage, parts, *hot_set->mutable_parts());
+    if (max_parallel_downloads)
+        request.set_max_parallel_downloads(max_parallel_downloads);
+
+    /// Warming a cold cache downloads every hot part, which can take minutes
+    const auto & settings = context->getSettingsRef();
+    auto warm_timeout = std::max(settings.max_execution_time.value.totalMilliseconds() >> 1, 10 * 60 * 1000L);
+    cntl.set_timeout_ms(warm_timeout);
+
+    stub->preWarmDiskCache(&cntl, &request, &response, nullptr);
+
+    assertController(cntl);
+    RPCHelpers::checkResponse(response);
+    return response.warmed_parts();
+}
+
 void CnchWorkerClient::createDedupWorker(const StorageID & storage_id, const String & create_table_query, const HostWithPorts & host_ports_)
 {
     brpc::Controller cntl;
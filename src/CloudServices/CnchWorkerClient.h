@@ -16,6 +16,7 @@
 #pragma once
 
 #include <Catalog/DataModelPartWrapper_fwd.h>
+#include <CloudServices/DiskCacheSummaryCache.h>
 #include <CloudServices/RpcClientBase.h>
 #include <Interpreters/Context_fwd.h>
 #include <Storages/IStorage_fwd.h>
@@ -42,6 +43,7 @@ namespace IngestColumnCnch
 
 class MergeTreeMetaBase;
 struct StorageID;
+struct AssignedResource;
 struct ManipulationInfo;
 struct ManipulationTaskParams;
 struct DedupWorkerStatus;
@@ -68,6 +70,14 @@ public:
     /// send resource to worker async
     void sendCreateQueries(const ContextPtr & context, const std::vector<String> & create_queries);
 
+    /// Batched variant of sendCreateQueries + sendQueryDataParts/sendCnchHiveDataParts:
+    /// ships all tables of one query in a single rpc per worker.
+    brpc::CallId sendResources(
+        const ContextPtr & context,
+        const std::vector<AssignedResource> & resources,
+        ExceptionHandler & handler,
+        bool with_create_queries);
+
     brpc::CallId sendQueryDataParts(
         const ContextPtr & context,
         const StoragePtr & storage,
@@ -101,6 +111,19 @@ public:
 
     void removeWorkerResource(TxnTimestamp txn_id);
 
+    /// pull the summary of the worker's disk cache content, see DiskCacheSummaryCache
+    DiskCacheSummary getDiskCacheSummary();
+
+    /// Bulk-load the given hot parts into the worker's disk cache before it enters
+    /// service, e.g. when scaling up a worker group ahead of a traffic peak.
+    /// Blocks until the cache is warm; returns the number of parts loaded.
+    size_t preWarmDiskCache(
+        const ContextPtr & context,
+        const IStorage & storage,
+        const String & create_local_table_query,
+        const ServerDataPartsVector & parts,
+        size_t max_parallel_downloads = 0);
+
     void createDedupWorker(const StorageID & storage_id, const String & create_table_query, const HostWithPorts & host_ports);
     void dropDedupWorker(const StorageID & storage_id);
     DedupWorkerStatus getDedupWorkerStatus(const StorageID & storage_id);
@@ -21,8 +21,10 @@
 #include <Interpreters/InterpreterCreateQuery.h>
 #include <Parsers/ParserQueryWithOutput.h>
 #include <Parsers/ASTCreateQuery.h>
+#include <Parsers/formatAST.h>
 #include <Parsers/parseQuery.h>
 #include <Poco/Logger.h>
+#include <Processors/Transforms/JoiningTransform.h>
 #include <Storages/IStorage.h>
 #include <Databases/DatabaseMemory.h>
 #include <Storages/StorageFactory.h>
@@ -38,6 +40,63 @@ namespace ErrorCodes
     extern const int TABLE_ALREADY_EXISTS;
 }
 
+namespace
+{
+    /// Interpreting a create query (column, default-expression, index and constraint
+    /// analysis) is the expensive stateless half of building a cloud table and only
+    /// depends on the schema text, so it is shared process-wide across sessions.
+    /// The cache key is the create query with the per-query worker table name masked
+    /// out; any schema change alters the key and naturally invalidates the entry.
+    /// The storage object itself stays per session: it carries loaded parts,
+    /// required bucket numbers and other query state.
+    struct InterpretedCloudSchema
+    {
+        ColumnsDescription columns;
+        IndicesDescription indices;
+        ConstraintsDescription constraints;
+    };
+    using InterpretedCloudSchemaPtr = std::shared_ptr<const InterpretedCloudSchema>;
+
+    class CloudSchemaCache
+    {
+    public:
+        static constexpr size_t max_entries = 1024;
+
+        InterpretedCloudSchemaPtr get(const String & key)
+        {
+            std::lock_guard lock(mutex);
+            auto it = cache.find(key);
+            return it == cache.end() ? nullptr : it->second;
+        }
+
+        void set(const String & key, InterpretedCloudSchemaPtr schema)
+        {
+            std::lock_guard lock(mutex);
+            /// schemas are small; dropping everything on overflow is simpler than LRU
+            if (cache.size() >= max_entries)
+                cache.clear();
+            cache.emplace(key, std::move(schema));
+        }
+
+        static CloudSchemaCache & instance()
+        {
+            static CloudSchemaCache ret;
+            return ret;
+        }
+
+    private:
+        std::mutex mutex;
+        std::unordered_map<String, InterpretedCloudSchemaPtr> cache;
+    };
+
+    String cloudSchemaCacheKey(const ASTCreateQuery & ast_create_query)
+    {
+        auto masked = std::dynamic_pointer_cast<ASTCreateQuery>(ast_create_query.clone());
+        masked->table.clear();
+        return serializeAST(*masked);
+    }
+}
+
 void CnchWorkerResource::executeCreateQuery(ContextMutablePtr context, const String & create_query, bool skip_if_exists)
 {
     const char * begin = create_query.data();
@@ -66,33 +125,49 @@ void CnchWorkerResource::executeCreateQuery(ContextMutablePtr context, const Str
         }
     }
 
-    ColumnsDescription columns;
-    IndicesDescription indices;
-    ConstraintsDescription constraints;
+    if (!ast_create_query.columns_list)
+        throw Exception("Incorrect CREATE query: required list of column descriptions or AS section or SELECT.", ErrorCodes::INCORRECT_QUERY);
+
+    auto cache_key = cloudSchemaCacheKey(ast_create_query);
+    auto schema = CloudSchemaCache::instance().get(cache_key);
 
-    if (ast_create_query.columns_list)
+    if (!schema)
     {
+        auto interpreted = std::make_shared<InterpretedCloudSchema>();
+
         if (ast_create_query.columns_list->columns)
         {
             // Set attach = true to avoid making columns nullable due to ANSI settings, because the dialect change
             // should NOT affect existing tables.
-            columns = InterpreterCreateQuery::getColumnsDescription(*ast_create_query.columns_list->columns, context, /* attach= */ true);
+            interpreted->columns = InterpreterCreateQuery::getColumnsDescription(*ast_create_query.columns_list->columns, context, /* attach= */ true);
         }
 
         if (ast_create_query.columns_list->indices)
             for (const auto & index : ast_create_query.columns_list->indices->children)
-                indices.push_back(IndexDescription::getIndexFromAST(index->clone(), columns, context));
+                interpreted->indices.push_back(IndexDescription::getIndexFromAST(index->clone(), interpreted->columns, context));
 
         if (ast_create_query.columns_list->constraints)
             for (const auto & constraint : ast_create_query.columns_list->constraints->children)
-                constraints.constraints.push_back(std::dynamic_pointer_cast<ASTConstraintDeclaration>(constraint->clone()));
+                interpreted->constraints.constraints.push_back(std::dynamic_pointer_cast<ASTConstraintDeclaration>(constraint->clone()));
+
+        /// Check for duplicates
+        std::set<String> all_columns;
+        for (const auto & column : interpreted->columns)
+        {
+            if (!all_columns.emplace(column.name).second)
+                throw Exception("Column " + backQuoteIfNeed(column.name) + " already exists", ErrorCodes::DUPLICATE_COLUMN);
+        }
+
+        schema = interpreted;
+        CloudSchemaCache::instance().set(cache_key, schema);
     }
-    else
-        throw Exception("Incorrect CREATE query: required list of column descriptions or AS section or SELECT.", ErrorCodes::INCORRECT_QUERY);
+
+    const auto & columns = schema->columns;
+    const auto & constraints = schema->constraints;
 
     /// Even if query has list of columns, canonicalize it (unfold Nested columns).
     ASTPtr new_columns = InterpreterCreateQuery::formatColumns(columns);
-    ASTPtr new_indices = InterpreterCreateQuery::formatIndices(indices);
+    ASTPtr new_indices = InterpreterCreateQuery::formatIndices(schema->indices);
     ASTPtr new_constraints = InterpreterCreateQuery::formatConstraints(constraints);
 
     if (ast_create_query.columns_list->columns)
@@ -104,14 +179,6 @@ void CnchWorkerResource::executeCreateQuery(ContextMutablePtr context, const Str
     if (ast_create_query.columns_list->constraints)
         ast_create_query.columns_list->replace(ast_create_query.columns_list->constraints, new_constraints);
 
-    /// Check for duplicates
-    std::set<String> all_columns;
-    for (const auto & column : columns)
-    {
-        if (!all_columns.emplace(column.name).second)
-            throw Exception("Column " + backQuoteIfNeed(column.name) + " already exists", ErrorCodes::DUPLICATE_COLUMN);
-    }
-
     /// Table constructing
     StoragePtr res = StorageFactory::instance().get(ast_create_query, "", context, context->getGlobalContext(), columns, constraints, false);
     res->startup();
@@ -160,6 +227,23 @@ bool CnchWorkerResource::isCnchTableInWorker(const StorageID & table_id) const
     return cnch_tables.find({table_id.getDatabaseName(), table_id.getTableName()}) != cnch_tables.end();
 }
 
+SharedJoinBuildStatePtr CnchWorkerResource::getOrCreateSharedJoinBuild(const String & key, const JoinPtr & candidate_join, bool & is_builder)
+{
+    auto lock = getLock();
+
+    auto it = shared_join_builds.find(key);
+    if (it != shared_join_builds.end())
+    {
+        is_builder = false;
+        return it->second;
+    }
+
+    is_builder = true;
+    auto state = std::make_shared<SharedJoinBuildState>(candidate_join);
+    shared_join_builds.emplace(key, state);
+    return state;
+}
+
 void CnchWorkerResource::clearResource()
 {
     auto lock = getLock();
@@ -167,6 +251,7 @@ void CnchWorkerResource::clearResource()
     memory_databases.clear();
     cnch_tables.clear();
     worker_table_names.clear();
+    shared_join_builds.clear();
 }
 
 }
@@ -30,6 +30,11 @@ namespace DB
 class CnchWorkerServiceImpl;
 class CloudTablesBlockSource;
 
+class IJoin;
+using JoinPtr = std::shared_ptr<IJoin>;
+class SharedJoinBuildState;
+using SharedJoinBuildStatePtr = std::shared_ptr<SharedJoinBuildState>;
+
 class CnchWorkerResource
 {
 public:
@@ -38,6 +43,11 @@ public:
     DatabasePtr getDatabase(const String & database_name) const;
     bool isCnchTableInWorker(const StorageID & table_id) const;
 
+    /// Returns the shared build state for a broadcast join identified by `key`.
+    /// The first caller registers `candidate_join` and becomes the builder
+    /// (is_builder = true); later callers get the already registered state.
+    SharedJoinBuildStatePtr getOrCreateSharedJoinBuild(const String & key, const JoinPtr & candidate_join, bool & is_builder);
+
     void clearResource();
 
     auto getTables() const
@@ -81,6 +91,9 @@ private:
     TablesSet cnch_tables;
     std::map<UUID, String> worker_table_names;
 
+    /// build tables shared between plan segment instances of this query
+    std::unordered_map<String, SharedJoinBuildStatePtr> shared_join_builds;
+
     time_t create_time{time(nullptr)};
 };
 
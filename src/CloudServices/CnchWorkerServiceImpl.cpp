@@ -19,7 +19,10 @@
 #include <CloudServices/CnchWorkerResource.h>
 #include <CloudServices/CnchPartsHelper.h>
 #include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+#include <Interpreters/BloomFilter.h>
 #include <CloudServices/DedupWorkerStatus.h>
+#include <Storages/DiskCache/DiskCacheFactory.h>
 #include <CloudServices/CloudMergeTreeDedupWorker.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/executeQuery.h>
@@ -378,6 +381,88 @@ void CnchWorkerServiceImpl::sendCnchHiveDataParts(
     }
 }
 
+void CnchWorkerServiceImpl::sendResources(
+    google::protobuf::RpcController * cntl,
+    const Protos::SendResourcesReq * request,
+    Protos::SendResourcesResp * response,
+    google::protobuf::Closure * done)
+{
+    brpc::ClosureGuard done_guard(done);
+    try
+    {
+        LOG_TRACE(log, "Receiving resources of {} tables for Session: {}", request->tables_size(), request->txn_id());
+        /// set client_info.
+        auto rpc_context = RPCHelpers::createSessionContextForRPC(getContext(), *cntl);
+
+        auto timeout = std::chrono::seconds(request->timeout());
+        auto session = rpc_context->acquireNamedCnchSession(request->txn_id(), timeout, false);
+        auto & query_context = session->context;
+
+        /// executeQuery may change the settings, so we copy a new context.
+        auto create_context = Context::createCopy(query_context);
+        auto worker_resource = query_context->getCnchWorkerResource();
+        for (const auto & table : request->tables())
+        {
+            if (table.has_create_table_query())
+                worker_resource->executeCreateQuery(create_context, table.create_table_query());
+        }
+
+        for (const auto & table : request->tables())
+        {
+            if (!table.parts_size() && !table.hive_parts_size() && !table.bucket_numbers_size())
+                continue;
+
+            auto storage = DatabaseCatalog::instance().getTable({table.database_name(), table.table_name()}, query_context);
+
+            if (table.hive_parts_size())
+            {
+                auto & hive_table = dynamic_cast<StorageCloudHive &>(*storage);
+                auto data_parts = createCnchHiveDataParts(getContext(), table.hive_parts());
+                hive_table.loadDataParts(data_parts);
+                LOG_DEBUG(log, "Received and loaded {} hive parts for table {}", data_parts.size(), table.table_name());
+                continue;
+            }
+
+            auto & cloud_merge_tree = dynamic_cast<StorageCloudMergeTree &>(*storage);
+
+            MergeTreeMutableDataPartsVector data_parts;
+            if (cloud_merge_tree.getInMemoryMetadata().hasUniqueKey())
+                data_parts = createBasePartAndDeleteBitmapFromModelsForSend<IMergeTreeMutableDataPartPtr>(
+                    cloud_merge_tree, table.parts(), table.bitmaps());
+            else
+                data_parts = createPartVectorFromModelsForSend<IMergeTreeMutableDataPartPtr>(cloud_merge_tree, table.parts());
+
+            if (request->has_disk_cache_mode())
+            {
+                SettingFieldDiskCacheMode disk_cache_mode;
+                disk_cache_mode.parseFromString(request->disk_cache_mode());
+                if (disk_cache_mode.value != DiskCacheMode::AUTO)
+                {
+                    for (auto & part : data_parts)
+                        part->disk_cache_mode = disk_cache_mode;
+                }
+            }
+            cloud_merge_tree.loadDataParts(data_parts);
+
+            LOG_DEBUG(
+                log,
+                "Received and loaded {} server parts for table {}(txn_id: {})",
+                data_parts.size(), cloud_merge_tree.getStorageID().getNameForLogs(), request->txn_id());
+
+            std::set<Int64> required_bucket_numbers;
+            for (const auto & bucket_number : table.bucket_numbers())
+                required_bucket_numbers.insert(bucket_number);
+
+            cloud_merge_tree.setRequiredBucketNumbers(required_bucket_numbers);
+        }
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+        RPCHelpers::handleException(response->mutable_exception());
+    }
+}
+
 void CnchWorkerServiceImpl::checkDataParts(
     google::protobuf::RpcController * cntl,
     const Protos::CheckDataPartsReq * request,
@@ -498,6 +583,90 @@ void CnchWorkerServiceImpl::sendOffloading(
     }
 }
 
+void CnchWorkerServiceImpl::getDiskCacheSummary(
+    google::protobuf::RpcController *,
+    const Protos::GetDiskCacheSummaryReq *,
+    Protos::GetDiskCacheSummaryResp * response,
+    google::protobuf::Closure * done)
+{
+    brpc::ClosureGuard done_guard(done);
+    try
+    {
+        auto disk_cache = DiskCacheFactory::instance().getDefault().first;
+        if (!disk_cache)
+            return;
+
+        response->set_key_count(disk_cache->getKeyCount());
+        if (auto index_filter = disk_cache->cloneMergedIndexFilter())
+        {
+            WriteBufferFromString out(*response->mutable_index_filter());
+            index_filter->serializeToBuffer(out);
+        }
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+        RPCHelpers::handleException(response->mutable_exception());
+    }
+}
+
+void CnchWorkerServiceImpl::preWarmDiskCache(
+    [[maybe_unused]] google::protobuf::RpcController * cntl,
+    const Protos::PreWarmDiskCacheReq * request,
+    Protos::PreWarmDiskCacheResp * response,
+    google::protobuf::Closure * done)
+{
+    brpc::ClosureGuard done_guard(done);
+    try
+    {
+        Stopwatch watch;
+        auto rpc_context = RPCHelpers::createSessionContextForRPC(getContext(), *cntl);
+
+        size_t total_parts = 0;
+        for (const auto & hot_set : request->hot_sets())
+            total_parts += hot_set.parts_size();
+        if (total_parts == 0)
+            return;
+
+        size_t max_parallel = request->max_parallel_downloads() ? request->max_parallel_downloads() : 16UL;
+        ThreadPool pool(std::min(total_parts, max_parallel));
+
+        /// Keep storages and parts alive until all downloads scheduled on the pool finish;
+        /// parts only hold references to their storage.
+        std::vector<StoragePtr> storages;
+        std::vector<MutableMergeTreeDataPartsCNCHVector> parts_per_set;
+        for (const auto & hot_set : request->hot_sets())
+        {
+            StoragePtr storage = createStorageFromQuery(hot_set.create_table_query(), rpc_context);
+            auto & cloud_merge_tree = dynamic_cast<StorageCloudMergeTree &>(*storage);
+            auto data_parts = createPartVectorFromModelsForSend<MutableMergeTreeDataPartCNCHPtr>(cloud_merge_tree, hot_set.parts());
+
+            for (const auto & part : data_parts)
+                part->preload(pool);
+
+            storages.push_back(std::move(storage));
+            parts_per_set.push_back(std::move(data_parts));
+        }
+
+        /// Run synchronously: the scaling workflow keeps the worker out of service until
+        /// its cache is warm, so completion of this RPC is the ready signal.
+        pool.wait();
+        response->set_warmed_parts(total_parts);
+
+        LOG_DEBUG(
+            log,
+            "Pre-warmed disk cache with {} parts from {} hot sets in {} ms",
+            total_parts,
+            request->hot_sets_size(),
+            watch.elapsedMilliseconds());
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+        RPCHelpers::handleException(response->mutable_exception());
+    }
+}
+
 void CnchWorkerServiceImpl::removeWorkerResource(
     google::protobuf::RpcController *,
     const Protos::RemoveWorkerResourceReq * request,
@@ -173,6 +173,12 @@ public:
         Protos::SendCnchHiveDataPartsResp * response,
         google::protobuf::Closure * done) override;
 
+    void sendResources(
+        google::protobuf::RpcController * cntl,
+        const Protos::SendResourcesReq * request,
+        Protos::SendResourcesResp * response,
+        google::protobuf::Closure * done) override;
+
     void checkDataParts(
         google::protobuf::RpcController * cntl,
         const Protos::CheckDataPartsReq * request,
@@ -191,6 +197,18 @@ public:
         Protos::SendOffloadingResp * response,
         google::protobuf::Closure * done) override;
 
+    void getDiskCacheSummary(
+        google::protobuf::RpcController * cntl,
+        const Protos::GetDiskCacheSummaryReq * request,
+        Protos::GetDiskCacheSummaryResp * response,
+        google::protobuf::Closure * done) override;
+
+    void preWarmDiskCache(
+        google::protobuf::RpcController * cntl,
+        const Protos::PreWarmDiskCacheReq * request,
+        Protos::PreWarmDiskCacheResp * response,
+        google::protobuf::Closure * done) override;
+
 private:
     Poco::Logger * log;
 
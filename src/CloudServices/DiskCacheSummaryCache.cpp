@@ -0,0 +1,87 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <CloudServices/DiskCacheSummaryCache.h>
+
+#include <CloudServices/CnchWorkerClient.h>
+#include <Interpreters/WorkerGroupHandle.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+DiskCacheSummaryMap DiskCacheSummaryCache::getFreshSummaries(const WorkerGroupHandleImpl & worker_group)
+{
+    time_t now = time(nullptr);
+    DiskCacheSummaryMap ret;
+    std::vector<std::pair<String, CnchWorkerClientPtr>> to_refresh;
+
+    const auto & hosts = worker_group.getHostWithPortsVec();
+    const auto & clients = worker_group.getWorkerClients();
+
+    {
+        std::lock_guard lock(mutex);
+        for (size_t i = 0; i < hosts.size() && i < clients.size(); ++i)
+        {
+            const auto & worker_id = hosts[i].id;
+            auto it = summaries.find(worker_id);
+
+            if (it != summaries.end() && now - it->second.fetch_time <= STALENESS_LIMIT_SEC)
+                ret.emplace(worker_id, it->second);
+
+            bool needs_refresh = it == summaries.end() || now - it->second.fetch_time >= REFRESH_INTERVAL_SEC;
+            if (needs_refresh && !refreshing.count(worker_id))
+            {
+                refreshing.insert(worker_id);
+                to_refresh.emplace_back(worker_id, clients[i]);
+            }
+        }
+    }
+
+    for (auto & [worker_id, client] : to_refresh)
+    {
+        if (!refresh_pool.trySchedule([this, worker_id = worker_id, client = client] { refreshWorker(worker_id, client); }))
+        {
+            std::lock_guard lock(mutex);
+            refreshing.erase(worker_id);
+        }
+    }
+
+    return ret;
+}
+
+void DiskCacheSummaryCache::refreshWorker(const String & worker_id, const CnchWorkerClientPtr & client)
+{
+    DiskCacheSummary summary;
+    bool ok = false;
+    try
+    {
+        summary = client->getDiskCacheSummary();
+        ok = true;
+    }
+    catch (...)
+    {
+        /// e.g. worker restarting or running an older version; keep the previous
+        /// summary until it expires, the caller falls back to hash placement then
+        tryLogCurrentException(&Poco::Logger::get("DiskCacheSummaryCache"), __PRETTY_FUNCTION__);
+    }
+
+    std::lock_guard lock(mutex);
+    if (ok)
+        summaries[worker_id] = std::move(summary);
+    refreshing.erase(worker_id);
+}
+
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Core/Types.h>
+#include <Common/ThreadPool.h>
+#include <common/singleton.h>
+
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace DB
+{
+class BloomFilter;
+class CnchWorkerClient;
+using CnchWorkerClientPtr = std::shared_ptr<CnchWorkerClient>;
+class WorkerGroupHandleImpl;
+
+/// Compact summary of one worker's disk cache content: a bloom filter over the
+/// cached segment keys plus the number of cached segments
+struct DiskCacheSummary
+{
+    std::shared_ptr<BloomFilter> filter;
+    UInt64 key_count{0};
+    time_t fetch_time{0};
+};
+
+using DiskCacheSummaryMap = std::unordered_map<String, DiskCacheSummary>;
+
+/// Pulls disk cache summaries from workers and keeps them fresh in the background,
+/// so that part allocation can be biased toward workers which already cache the data.
+/// getFreshSummaries() never waits for an RPC: it returns whatever is fresh enough
+/// and schedules a refresh of the rest. A worker without a fresh summary is simply
+/// absent from the result, and the caller keeps its plain hash placement for it
+class DiskCacheSummaryCache : public ext::singleton<DiskCacheSummaryCache>
+{
+public:
+    DiskCacheSummaryMap getFreshSummaries(const WorkerGroupHandleImpl & worker_group);
+
+private:
+    void refreshWorker(const String & worker_id, const CnchWorkerClientPtr & client);
+
+    /// how often to re-pull a summary vs. how long an old one is still usable
+    static constexpr time_t REFRESH_INTERVAL_SEC = 60;
+    static constexpr time_t STALENESS_LIMIT_SEC = 5 * 60;
+
+    std::mutex mutex;
+    DiskCacheSummaryMap summaries;
+    /// workers with an in-flight refresh, to avoid piling up duplicate RPCs
+    std::unordered_set<String> refreshing;
+    ThreadPool refresh_pool{4};
+};
+
+}
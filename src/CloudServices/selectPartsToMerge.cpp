@@ -16,9 +16,15 @@
 #include <CloudServices/selectPartsToMerge.h>
 
 #include <Catalog/DataModelPartWrapper.h>
+#include <Interpreters/Context.h>
+#include <Interpreters/ServerMergeDecisionLog.h>
 #include <MergeTreeCommon/MergeTreeMetaBase.h>
 #include <Storages/MergeTree/DanceMergeSelector.h>
 #include <Storages/MergeTree/SimpleMergeSelector.h>
+#include <Common/Stopwatch.h>
+#include <Common/thread_local_rng.h>
+
+#include <random>
 
 namespace DB
 {
@@ -36,11 +42,42 @@ ServerSelectPartsDecision selectPartsToMerge(
 {
     const auto data_settings = data.getSettings();
     auto metadata_snapshot = data.getInMemoryMetadataPtr();
+    const auto & config = data.getContext()->getConfigRef();
+
+    /// Record this selection round in system.server_merge_decisions (sampled), so declined
+    /// rounds leave a queryable trace of how many candidates there were and why nothing merged.
+    Stopwatch watch;
+    auto decision_log = data.getContext()->getServerMergeDecisionLog();
+    if (decision_log)
+    {
+        double sample_ratio = config.getDouble("server_merge_decision_log.sample_ratio", 0.1);
+        if (std::uniform_real_distribution<double>(0.0, 1.0)(thread_local_rng) >= sample_ratio)
+            decision_log = nullptr;
+    }
+
+    ServerMergeDecisionLogElement decision_elem;
+    decision_elem.input_parts = data_parts.size();
+    decision_elem.max_total_size_to_merge = max_total_size_to_merge;
+    auto log_decision = [&](ServerMergeDecisionLogElement::Decision decision, String reason)
+    {
+        if (!decision_log)
+            return;
+        decision_elem.event_time = std::time(nullptr);
+        decision_elem.database_name = data.getDatabaseName();
+        decision_elem.table_name = data.getTableName();
+        decision_elem.uuid = data.getStorageUUID();
+        decision_elem.aggressive = aggressive;
+        decision_elem.decision = decision;
+        decision_elem.reason = std::move(reason);
+        decision_elem.elapsed_us = watch.elapsedMicroseconds();
+        decision_log->add(decision_elem);
+    };
 
     if (data_parts.empty())
     {
         if (log)
             LOG_DEBUG(log, "There are no parts in the table");
+        log_decision(ServerMergeDecisionLogElement::NOTHING_TO_MERGE, "no parts in the table");
         return ServerSelectPartsDecision::NOTHING_TO_MERGE;
     }
 
@@ -146,10 +183,17 @@ ServerSelectPartsDecision selectPartsToMerge(
         }
     }
 
+    decision_elem.candidate_parts = parts_selected_precondition;
+    for (const auto & range : parts_ranges)
+        decision_elem.candidate_ranges += !range.empty();
+
     if (parts_selected_precondition == 0)
     {
         if (log)
             LOG_DEBUG(log, "No parts satisfy preconditions for merge");
+        log_decision(
+            ServerMergeDecisionLogElement::CANNOT_SELECT,
+            "no parts satisfy preconditions (running merge/mutation, uncommitted transaction, ...)");
         return ServerSelectPartsDecision::CANNOT_SELECT;
     }
 
@@ -194,8 +238,8 @@ ServerSelectPartsDecision selectPartsToMerge(
     */
 
     std::unique_ptr<IMergeSelector> merge_selector;
-    const auto & config = data.getContext()->getConfigRef();
     auto merge_selector_str = config.getString("merge_selector", "dance");
+    decision_elem.selector = merge_selector_str;
     if (merge_selector_str == "dance")
     {
         DanceMergeSelector::Settings merge_settings;
@@ -223,6 +267,9 @@ ServerSelectPartsDecision selectPartsToMerge(
     if (ranges.empty())
     {
         LOG_DEBUG(log, "There is no need to merge parts according to merge selector algorithm: {}", merge_selector_str);
+        log_decision(
+            ServerMergeDecisionLogElement::CANNOT_SELECT,
+            "merge selector found no range worth merging (base/score threshold, size budget or concurrency limit)");
         return ServerSelectPartsDecision::CANNOT_SELECT;
     }
 
@@ -234,10 +281,17 @@ ServerSelectPartsDecision selectPartsToMerge(
 
         res.emplace_back();
         res.back().reserve(range.size());
+        UInt64 range_bytes = 0;
         for (auto & part : range)
+        {
+            range_bytes += part.size;
             res.back().push_back(*static_cast<const ServerDataPartPtr *>(part.data));
+        }
+        decision_elem.selected_range_parts.push_back(range.size());
+        decision_elem.selected_range_bytes.push_back(range_bytes);
     }
 
+    log_decision(ServerMergeDecisionLogElement::SELECTED, "");
     return ServerSelectPartsDecision::SELECTED;
 }
 
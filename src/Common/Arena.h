@@ -11,6 +11,7 @@
 #include <Common/memcpySmall.h>
 #include <Common/ProfileEvents.h>
 #include <Common/Allocator.h>
+#include <Common/ArenaChunkRecycler.h>
 
 
 namespace ProfileEvents
@@ -51,7 +52,11 @@ private:
             ProfileEvents::increment(ProfileEvents::ArenaAllocChunks);
             ProfileEvents::increment(ProfileEvents::ArenaAllocBytes, size_);
 
-            begin = reinterpret_cast<char *>(Allocator<false>::alloc(size_));
+            /// Common chunk sizes are recycled between arenas to avoid repeated
+            /// page faulting on hot aggregation paths.
+            begin = reinterpret_cast<char *>(ArenaChunkRecycler::tryTake(size_));
+            if (!begin)
+                begin = reinterpret_cast<char *>(Allocator<false>::alloc(size_));
             pos = begin;
             end = begin + size_ - pad_right;
             prev = prev_;
@@ -67,7 +72,8 @@ private:
             /// asan, it will correctly poison the memory by itself.
             ASAN_UNPOISON_MEMORY_REGION(begin, size());
 
-            Allocator<false>::free(begin, size());
+            if (!ArenaChunkRecycler::tryPut(begin, size()))
+                Allocator<false>::free(begin, size());
 
             if (prev)
                 delete prev;
@@ -0,0 +1,100 @@
+#include <Common/ArenaChunkRecycler.h>
+#include <Common/CurrentMemoryTracker.h>
+#include <Common/ProfileEvents.h>
+
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+namespace ProfileEvents
+{
+    extern const Event ArenaChunkRecycleHits;
+    extern const Event ArenaChunkRecycleStashes;
+}
+
+namespace DB
+{
+
+namespace
+{
+    constexpr bool isPowerOfTwo(size_t n)
+    {
+        return n && (n & (n - 1)) == 0;
+    }
+
+    static_assert(isPowerOfTwo(ArenaChunkRecycler::min_chunk_size));
+    static_assert(isPowerOfTwo(ArenaChunkRecycler::max_chunk_size));
+
+    constexpr size_t num_size_classes
+        = __builtin_ctzll(ArenaChunkRecycler::max_chunk_size) - __builtin_ctzll(ArenaChunkRecycler::min_chunk_size) + 1;
+
+    /// Index of the size class for a cacheable size; sizes must be checked with isCacheable() first.
+    size_t sizeClass(size_t size)
+    {
+        return __builtin_ctzll(size) - __builtin_ctzll(ArenaChunkRecycler::min_chunk_size);
+    }
+
+    bool isCacheable(size_t size)
+    {
+        return isPowerOfTwo(size) && size >= ArenaChunkRecycler::min_chunk_size && size <= ArenaChunkRecycler::max_chunk_size;
+    }
+
+    struct ThreadChunkPool
+    {
+        std::array<std::vector<void *>, num_size_classes> buckets;
+        size_t cached_bytes = 0;
+
+        ~ThreadChunkPool()
+        {
+            /// Stashed buffers were already released from memory trackers when they
+            /// entered the pool, so on thread exit they go straight to the allocator.
+            /// Cacheable sizes are far below MMAP_THRESHOLD, so they came from malloc.
+            for (auto & bucket : buckets)
+                for (void * buf : bucket)
+                    ::free(buf);
+        }
+    };
+
+    thread_local ThreadChunkPool thread_chunk_pool;
+}
+
+void * ArenaChunkRecycler::tryTake(size_t size)
+{
+    if (!isCacheable(size))
+        return nullptr;
+
+    auto & pool = thread_chunk_pool;
+    auto & bucket = pool.buckets[sizeClass(size)];
+    if (bucket.empty())
+        return nullptr;
+
+    /// Charge before popping: if the current query is over its memory limit,
+    /// this throws and the buffer stays in the pool.
+    CurrentMemoryTracker::alloc(size);
+
+    void * buf = bucket.back();
+    bucket.pop_back();
+    pool.cached_bytes -= size;
+
+    ProfileEvents::increment(ProfileEvents::ArenaChunkRecycleHits);
+    return buf;
+}
+
+bool ArenaChunkRecycler::tryPut(void * buf, size_t size)
+{
+    if (!isCacheable(size))
+        return false;
+
+    auto & pool = thread_chunk_pool;
+    if (pool.cached_bytes + size > max_cached_bytes_per_thread)
+        return false;
+
+    pool.buckets[sizeClass(size)].push_back(buf);
+    pool.cached_bytes += size;
+    CurrentMemoryTracker::free(size);
+
+    ProfileEvents::increment(ProfileEvents::ArenaChunkRecycleStashes);
+    return true;
+}
+
+}
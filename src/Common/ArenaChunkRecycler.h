@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+namespace DB
+{
+
+/** Process-wide recycler for Arena memory chunks.
+  *
+  * Aggregation allocates its states in arenas that live for one query; at a high
+  * query rate the chunks are unmapped and mapped again over and over, and the
+  * repeated page faulting shows up in profiles of hot aggregation paths. Instead
+  * of returning a freed chunk buffer to the allocator, it is stashed in a pool
+  * local to the freeing thread (so the hot path takes no locks) and handed to the
+  * next arena that asks for the same size class.
+  *
+  * Memory accounting stays exact: a stashed buffer is released from the memory
+  * tracker of the query that freed it and charged to the query that reuses it,
+  * so only the physical pages outlive the query, not its accounted memory.
+  *
+  * Only power-of-two sizes in [min_chunk_size, max_chunk_size] are cached, which
+  * covers the geometric growth sequence of Arena. Other sizes are rejected by
+  * tryPut() and follow the ordinary allocator path.
+  */
+class ArenaChunkRecycler
+{
+public:
+    /// Returns a buffer of exactly `size` bytes from the current thread's pool,
+    /// charging it to the current memory tracker, or nullptr on cache miss.
+    static void * tryTake(size_t size);
+
+    /// Takes ownership of `buf` (releasing it from the current memory tracker)
+    /// if its size is cacheable and the pool is not full; returns false otherwise
+    /// and the caller must free the buffer itself.
+    static bool tryPut(void * buf, size_t size);
+
+    static constexpr size_t min_chunk_size = 4096;
+    static constexpr size_t max_chunk_size = 1024 * 1024;
+
+    /// Upper bound on memory parked in one thread's pool.
+    static constexpr size_t max_cached_bytes_per_thread = 64 * 1024 * 1024;
+};
+
+}
@@ -80,6 +80,11 @@ BrpcChannelPoolConfigHolder::createTypedConfig(RawConfAutoPtr conf_ptr) noexcept
     BrpcChannelPoolOptions::PoolOptions stream_default_options = *BrpcChannelPoolOptions::getInstance().getDefaultPoolOptions("stream_default");
     stream_default_options.pool_name = BrpcChannelPoolOptions::STREAM_DEFAULT_CONFIG_KEY;
     option_unique_ptr->emplace(BrpcChannelPoolOptions::STREAM_DEFAULT_CONFIG_KEY, std::move(stream_default_options));
+
+    // make sure that a control_default config is in pool_options_map
+    BrpcChannelPoolOptions::PoolOptions control_default_options = *BrpcChannelPoolOptions::getInstance().getDefaultPoolOptions("control_default");
+    control_default_options.pool_name = BrpcChannelPoolOptions::CONTROL_DEFAULT_CONFIG_KEY;
+    option_unique_ptr->emplace(BrpcChannelPoolOptions::CONTROL_DEFAULT_CONFIG_KEY, std::move(control_default_options));
     return option_unique_ptr;
 }
 
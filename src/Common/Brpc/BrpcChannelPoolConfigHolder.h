@@ -43,6 +43,13 @@ namespace DB
 ///                  <timeout_ms>3000</timeout_ms>
 ///              </channel_options>
 ///          </stream_default>
+///          <control_default>
+///              <max_connections>2</max_connections>
+///              <load_balancer>rr</load_balancer>
+///              <channel_options>
+///                  <timeout_ms>3000</timeout_ms>
+///              </channel_options>
+///          </control_default>
 ///          <pool_name_1>
 ///              <max_connections>8</max_connections>
 ///              <load_balancer>rr</load_balancer>
@@ -22,10 +22,12 @@ namespace DB
 
 APPLY_FOR_RPC_PARAM(DEFINE)
 APPLY_FOR_STREAM_PARAM(DEFINE)
+APPLY_FOR_CONTROL_PARAM(DEFINE)
 
 #undef DEFINE
 const std::string BrpcChannelPoolOptions::DEFAULT_CONFIG_KEY = "rpc_default";
 const std::string BrpcChannelPoolOptions::STREAM_DEFAULT_CONFIG_KEY = "stream_default";
+const std::string BrpcChannelPoolOptions::CONTROL_DEFAULT_CONFIG_KEY = "control_default";
 
 std::ostream & operator<<(std::ostream & os, const BrpcChannelPoolOptions::PoolOptions & pool_options)
 {
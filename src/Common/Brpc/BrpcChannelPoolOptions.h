@@ -29,6 +29,10 @@ class BrpcChannelPoolOptions
 public:
     static const std::string DEFAULT_CONFIG_KEY;
     static const std::string STREAM_DEFAULT_CONFIG_KEY;
+    /// Latency-critical control rpc (plan segment dispatch, cancel, status report).
+    /// Kept in its own pool with dedicated connections so control traffic never
+    /// queues behind bulk exchange payloads on a shared socket.
+    static const std::string CONTROL_DEFAULT_CONFIG_KEY;
     struct PoolOptions
     {
         std::string pool_name;
@@ -96,11 +100,24 @@ public:
     M(bool, stream_default_log_succeed_without_server, true, "") \
     M(bool, stream_default_succeed_without_server, true, "")
 
+// control default config params
+#define APPLY_FOR_CONTROL_PARAM(M) \
+    M(uint16_t, control_default_max_connections, 2, "max connections") \
+    M(std::string, control_default_load_balancer, "rr", "") \
+    M(int32_t, control_default_connect_timeout_ms, 1000, "") \
+    M(int32_t, control_default_timeout_ms, 3000, "") \
+    M(int32_t, control_default_backup_request_ms, -1, "") \
+    M(int, control_default_max_retry, 3, "") \
+    M(bool, control_default_enable_circuit_breaker, false, "") \
+    M(bool, control_default_log_succeed_without_server, true, "") \
+    M(bool, control_default_succeed_without_server, true, "")
+
 
 #define DECLARE(TYPE, NAME, DEFAULT, DESCRIPTION) static const TYPE NAME;
 
     APPLY_FOR_RPC_PARAM(DECLARE)
     APPLY_FOR_STREAM_PARAM(DECLARE)
+    APPLY_FOR_CONTROL_PARAM(DECLARE)
 
 #undef DECLARE
 
@@ -120,10 +137,14 @@ public:
                 P##_pool_options.channel_options.max_retry = P##_default_max_retry; \
                 P##_pool_options.channel_options.enable_circuit_breaker = P##_default_enable_circuit_breaker; \
                 P##_pool_options.channel_options.log_succeed_without_server = P##_default_log_succeed_without_server; \
-                P##_pool_options.channel_options.succeed_without_server = P##_default_succeed_without_server;
+                P##_pool_options.channel_options.succeed_without_server = P##_default_succeed_without_server; \
+                /* single + per-pool connection_group gives each pool dedicated sockets \
+                   (see RpcChannelPool::getClient), instead of muxing onto a shared one */ \
+                P##_pool_options.channel_options.connection_type = "single";
 
                 FILL(rpc)
                 FILL(stream)
+                FILL(control)
             #undef FILL
         });
         return instance;
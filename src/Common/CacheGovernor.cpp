@@ -0,0 +1,118 @@
+#include <Common/CacheGovernor.h>
+
+#include <chrono>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+CacheGovernor::CacheGovernor() : log(&Poco::Logger::get("CacheGovernor"))
+{
+}
+
+CacheGovernor::~CacheGovernor()
+{
+    stop();
+}
+
+void CacheGovernor::start(UInt64 interval_seconds_)
+{
+    std::lock_guard lock(mutex);
+    if (thread)
+        return;
+
+    interval_seconds = std::max<UInt64>(interval_seconds_, 1);
+    shutdown = false;
+    thread.emplace([this] { threadFunction(); });
+    LOG_DEBUG(log, "Started with {} caches, rebalancing every {} seconds", caches.size(), interval_seconds);
+}
+
+void CacheGovernor::stop()
+{
+    {
+        std::lock_guard lock(mutex);
+        if (!thread)
+            return;
+        shutdown = true;
+    }
+    wake.notify_all();
+    thread->join();
+
+    std::lock_guard lock(mutex);
+    thread.reset();
+}
+
+void CacheGovernor::threadFunction()
+{
+    std::unique_lock lock(mutex);
+    while (true)
+    {
+        if (wake.wait_for(lock, std::chrono::seconds(interval_seconds), [this] { return shutdown; }))
+            break;
+        rebalanceUnlocked(lock);
+    }
+}
+
+void CacheGovernor::rebalance()
+{
+    std::unique_lock lock(mutex);
+    rebalanceUnlocked(lock);
+}
+
+void CacheGovernor::rebalanceUnlocked(std::unique_lock<std::mutex> &)
+{
+    if (caches.size() < 2)
+        return;
+
+    /// Utility of a cache is the hits it produced since the previous round per byte
+    /// of budget: an estimate of the marginal value of giving it more memory,
+    /// assuming the hit-rate-per-byte curve is concave.
+    std::vector<double> utility(caches.size());
+    for (size_t i = 0; i < caches.size(); ++i)
+    {
+        auto & cache = caches[i];
+        size_t hits = 0;
+        size_t misses = 0;
+        cache.get_stats(hits, misses);
+
+        size_t delta_hits = hits >= cache.last_hits ? hits - cache.last_hits : 0;
+        cache.last_hits = hits;
+        cache.last_misses = misses;
+
+        utility[i] = static_cast<double>(delta_hits) / std::max<size_t>(cache.get_max_size(), 1);
+    }
+
+    size_t donor = 0;
+    size_t receiver = 0;
+    for (size_t i = 1; i < caches.size(); ++i)
+    {
+        if (utility[i] < utility[donor])
+            donor = i;
+        if (utility[i] > utility[receiver])
+            receiver = i;
+    }
+
+    if (donor == receiver || utility[donor] == utility[receiver])
+        return;
+
+    size_t donor_size = caches[donor].get_max_size();
+    size_t movable = donor_size > caches[donor].min_size ? donor_size - caches[donor].min_size : 0;
+    size_t to_move = std::min(movable, donor_size / move_fraction_denominator);
+    if (to_move == 0)
+        return;
+
+    /// Shrink the donor first so the combined budget never exceeds the total.
+    caches[donor].set_max_size(donor_size - to_move);
+    caches[receiver].set_max_size(caches[receiver].get_max_size() + to_move);
+
+    LOG_TRACE(
+        log,
+        "Moved {} bytes from {} (utility {}) to {} (utility {})",
+        to_move,
+        caches[donor].name,
+        utility[donor],
+        caches[receiver].name,
+        utility[receiver]);
+}
+
+}
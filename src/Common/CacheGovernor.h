@@ -0,0 +1,88 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <Core/Types.h>
+#include <Common/ThreadPool.h>
+
+namespace Poco { class Logger; }
+
+namespace DB
+{
+
+/** Rebalances the memory budgets of the process-wide LRU caches (mark, primary index,
+  * uncompressed, checksums) from their observed hit rates. Each round the governor
+  * compares the hits produced per byte of budget since the previous round and moves a
+  * slice of capacity from the least useful cache to the most useful one, so a workload
+  * that hammers marks can borrow memory from an idle index cache and vice versa.
+  * The total budget across the registered caches is conserved and every cache keeps
+  * a floor of its configured size.
+  */
+class CacheGovernor
+{
+public:
+    CacheGovernor();
+    ~CacheGovernor();
+
+    /// Any cache built on LRUCache qualifies: we only need stats, weight and a resizable budget.
+    template <typename Cache>
+    void registerCache(const String & name, const std::shared_ptr<Cache> & cache)
+    {
+        ManagedCache entry;
+        entry.name = name;
+        entry.configured_size = cache->maxSize();
+        entry.min_size = std::max<size_t>(entry.configured_size / min_share_denominator, 1);
+        entry.get_stats = [cache](size_t & hits, size_t & misses) { cache->getStats(hits, misses); };
+        entry.get_max_size = [cache] { return cache->maxSize(); };
+        entry.set_max_size = [cache](size_t size) { cache->setMaxSize(size); };
+
+        std::lock_guard lock(mutex);
+        caches.push_back(std::move(entry));
+    }
+
+    void start(UInt64 interval_seconds_);
+    void stop();
+
+    /// One rebalancing round; public so tests can drive it without the background thread.
+    void rebalance();
+
+private:
+    struct ManagedCache
+    {
+        String name;
+        size_t configured_size = 0;
+        size_t min_size = 0;
+        std::function<void(size_t &, size_t &)> get_stats;
+        std::function<size_t()> get_max_size;
+        std::function<void(size_t)> set_max_size;
+        size_t last_hits = 0;
+        size_t last_misses = 0;
+    };
+
+    /// A cache never shrinks below 1/8 of its configured size and at most a tenth of
+    /// the donor's budget moves per round, so one burst cannot wipe out a cache that
+    /// is merely between two phases of its workload.
+    static constexpr size_t min_share_denominator = 8;
+    static constexpr size_t move_fraction_denominator = 10;
+
+    void rebalanceUnlocked(std::unique_lock<std::mutex> & lock);
+    void threadFunction();
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool shutdown = false;
+    UInt64 interval_seconds = 60;
+
+    std::vector<ManagedCache> caches;
+    std::optional<ThreadFromGlobalPool> thread;
+
+    Poco::Logger * log;
+};
+
+using CacheGovernorPtr = std::shared_ptr<CacheGovernor>;
+
+}
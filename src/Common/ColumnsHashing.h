@@ -57,6 +57,8 @@ struct HashMethodOneNumber
     using Self = HashMethodOneNumber<Value, Mapped, FieldType, use_cache, need_offset>;
     using Base = columns_hashing_impl::HashMethodBase<Self, Value, Mapped, use_cache, need_offset>;
 
+    static constexpr bool has_cheap_key_calculation = true;
+
     const char * vec;
 
     /// If the keys of a fixed length then key_sizes contains their lengths, empty otherwise.
@@ -102,6 +104,10 @@ struct HashMethodString
     using Self = HashMethodString<Value, Mapped, place_string_to_arena, use_cache, need_offset>;
     using Base = columns_hashing_impl::HashMethodBase<Self, Value, Mapped, use_cache, need_offset>;
 
+    /// getKeyHolder only wraps a reference to the chars, the key is copied to the
+    /// arena no earlier than on emplace.
+    static constexpr bool has_cheap_key_calculation = true;
+
     const IColumn::Offset * offsets;
     const UInt8 * chars;
 
@@ -150,6 +156,8 @@ struct HashMethodFixedString
     using Self = HashMethodFixedString<Value, Mapped, place_string_to_arena, use_cache, need_offset>;
     using Base = columns_hashing_impl::HashMethodBase<Self, Value, Mapped, use_cache, need_offset>;
 
+    static constexpr bool has_cheap_key_calculation = true;
+
     size_t n;
     const ColumnFixedString::Chars * chars;
 
@@ -515,6 +523,7 @@ struct HashMethodKeysFixed
 
     static constexpr bool has_nullable_keys = has_nullable_keys_;
     static constexpr bool has_low_cardinality = has_low_cardinality_;
+    static constexpr bool has_cheap_key_calculation = !has_nullable_keys_ && !has_low_cardinality_;
 
     LowCardinalityKeys<has_low_cardinality> low_cardinality_keys;
     Sizes key_sizes;
@@ -698,9 +707,12 @@ struct HashMethodSerialized
 
     ColumnRawPtrs key_columns;
     size_t keys_size;
+    /// Precomputed runs of fixed-width key columns, so serialization copies their
+    /// raw bytes instead of doing a virtual call per column and row.
+    SerializedKeysLayout layout;
 
     HashMethodSerialized(const ColumnRawPtrs & key_columns_, const Sizes & /*key_sizes*/, const HashMethodContextPtr &)
-        : key_columns(key_columns_), keys_size(key_columns_.size()) {}
+        : key_columns(key_columns_), keys_size(key_columns_.size()), layout(buildSerializedKeysLayout(key_columns_)) {}
 
 protected:
     friend class columns_hashing_impl::HashMethodBase<Self, Value, Mapped, false>;
@@ -708,7 +720,7 @@ protected:
     ALWAYS_INLINE SerializedKeyHolder getKeyHolder(size_t row, Arena & pool) const
     {
         return SerializedKeyHolder{
-            serializeKeysToPoolContiguous(row, keys_size, key_columns, pool),
+            serializeKeysToPoolContiguous(row, keys_size, key_columns, layout, pool),
             pool};
     }
 };
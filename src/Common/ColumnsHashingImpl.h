@@ -145,6 +145,11 @@ public:
     static constexpr bool has_mapped = !std::is_same<Mapped, void>::value;
     using Cache = LastElementCache<Value, consecutive_keys_optimization>;
 
+    /// Whether getKeyHolder is a side effect free read, so the hash of a row may be
+    /// computed ahead of the lookup (e.g. to prefetch the hash table cell) and the
+    /// key recomputed later. Overridden by the derived methods this holds for.
+    static constexpr bool has_cheap_key_calculation = false;
+
     static HashMethodContextPtr createContext(const HashMethodContext::Settings &) { return nullptr; }
 
     template <typename Data>
@@ -161,6 +166,15 @@ public:
         return findKeyImpl(keyHolderGetKey(key_holder), data);
     }
 
+    /// Same as findKey, but with the hash computed in advance (see getHash), so a
+    /// batched caller can prefetch the target cell between hashing and probing.
+    template <typename Data>
+    ALWAYS_INLINE FindResult findKey(Data & data, size_t row, Arena & pool, size_t hash_value)
+    {
+        auto key_holder = static_cast<Derived &>(*this).getKeyHolder(row, pool);
+        return findKeyImpl(keyHolderGetKey(key_holder), data, hash_value);
+    }
+
     template <typename Data>
     ALWAYS_INLINE size_t getHash(const Data & data, size_t row, Arena & pool)
     {
@@ -287,6 +301,53 @@ protected:
         else
             return FindResult(it != nullptr, offset);
     }
+
+    template <typename Data, typename Key>
+    ALWAYS_INLINE FindResult findKeyImpl(Key key, Data & data, size_t hash_value)
+    {
+        if constexpr (Cache::consecutive_keys_optimization)
+        {
+            static_assert(!FindResult::has_offset, "`consecutive_keys_optimization` and `has_offset` are conflicting options");
+            if (cache.check(key))
+            {
+                if constexpr (has_mapped)
+                    return FindResult(&cache.value.second, cache.found, 0);
+                else
+                    return FindResult(cache.found, 0);
+            }
+        }
+
+        auto it = data.find(key, hash_value);
+
+        if constexpr (consecutive_keys_optimization)
+        {
+            cache.found = it != nullptr;
+            cache.empty = false;
+
+            if constexpr (has_mapped)
+            {
+                cache.value.first = key;
+                if (it)
+                {
+                    cache.value.second = it->getMapped();
+                }
+            }
+            else
+            {
+                cache.value = key;
+            }
+        }
+
+        size_t offset = 0;
+        if constexpr (FindResult::has_offset)
+        {
+            offset = it ? data.offsetInternal(it) : 0;
+        }
+        if constexpr (has_mapped)
+            return FindResult(it ? &it->getMapped() : nullptr, it != nullptr, offset);
+        else
+            return FindResult(it != nullptr, offset);
+    }
 };
 
 
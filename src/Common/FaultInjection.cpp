@@ -0,0 +1,99 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Common/FaultInjection.h>
+
+#include <random>
+#include <Poco/Util/AbstractConfiguration.h>
+#include <common/logger_useful.h>
+#include <common/sleep.h>
+#include <Common/thread_local_rng.h>
+
+namespace DB
+{
+
+namespace
+{
+    const char * pointName(FaultInjection::Point point)
+    {
+        switch (point)
+        {
+            case FaultInjection::METASTORE:
+                return "metastore";
+            case FaultInjection::S3_READ:
+                return "s3_read";
+            case FaultInjection::S3_WRITE:
+                return "s3_write";
+            case FaultInjection::MAX_POINT:
+                break;
+        }
+        return "";
+    }
+
+    UInt64 probabilityToPpm(double probability)
+    {
+        if (probability <= 0)
+            return 0;
+        if (probability >= 1)
+            return 1000000;
+        return static_cast<UInt64>(probability * 1000000);
+    }
+
+    bool rollPpm(UInt64 ppm)
+    {
+        return ppm && std::uniform_int_distribution<UInt64>(0, 999999)(thread_local_rng) < ppm;
+    }
+}
+
+FaultInjection & FaultInjection::instance()
+{
+    static FaultInjection ret;
+    return ret;
+}
+
+void FaultInjection::reloadConfig(const Poco::Util::AbstractConfiguration & config)
+{
+    bool enabled = false;
+    for (int i = 0; i < MAX_POINT; ++i)
+    {
+        String prefix = String("fault_injection.") + pointName(static_cast<Point>(i));
+        auto & point = points[i];
+        point.latency_us = config.getUInt64(prefix + ".latency_ms", 0) * 1000;
+        point.latency_ppm = probabilityToPpm(config.getDouble(prefix + ".latency_probability", 1.0));
+        point.error_ppm = probabilityToPpm(config.getDouble(prefix + ".error_probability", 0.0));
+        if ((point.latency_us && point.latency_ppm) || point.error_ppm)
+        {
+            enabled = true;
+            LOG_WARNING(
+                &Poco::Logger::get("FaultInjection"),
+                "Fault injection enabled for {}: latency {}us (p={}), error p={}. This must never be on in production.",
+                pointName(static_cast<Point>(i)), point.latency_us, point.latency_ppm / 1e6, point.error_ppm / 1e6);
+        }
+    }
+    any_enabled = enabled;
+}
+
+bool FaultInjection::injectSlow(Point point)
+{
+    auto & settings = points[point];
+
+    UInt64 latency_us = settings.latency_us.load(std::memory_order_relaxed);
+    if (latency_us && rollPpm(settings.latency_ppm.load(std::memory_order_relaxed)))
+        sleepForMicroseconds(latency_us);
+
+    return rollPpm(settings.error_ppm.load(std::memory_order_relaxed));
+}
+
+}
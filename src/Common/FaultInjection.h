@@ -0,0 +1,83 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <common/types.h>
+
+namespace Poco::Util
+{
+class AbstractConfiguration;
+}
+
+namespace DB
+{
+
+/// Config-driven latency and error injection for staging stress tests: measure how query
+/// latency reacts to metastore or remote storage degradation before an incident does it
+/// for us. Disabled (all-zero) by default and cheap to probe when disabled.
+///
+/// Configuration (reloadable with the main server config):
+///     <fault_injection>
+///         <metastore>
+///             <latency_ms>20</latency_ms>
+///             <latency_probability>0.5</latency_probability>
+///             <error_probability>0.001</error_probability>
+///         </metastore>
+///         <s3_read>...</s3_read>
+///         <s3_write>...</s3_write>
+///     </fault_injection>
+class FaultInjection
+{
+public:
+    enum Point
+    {
+        METASTORE = 0,
+        S3_READ = 1,
+        S3_WRITE = 2,
+
+        MAX_POINT = 3,
+    };
+
+    static FaultInjection & instance();
+
+    void reloadConfig(const Poco::Util::AbstractConfiguration & config);
+
+    /// Sleeps for the configured latency (with its probability) and returns true if the
+    /// caller should fail the operation with an injected error.
+    bool inject(Point point)
+    {
+        if (likely(!any_enabled.load(std::memory_order_relaxed)))
+            return false;
+        return injectSlow(point);
+    }
+
+private:
+    bool injectSlow(Point point);
+
+    struct PointSettings
+    {
+        std::atomic<UInt64> latency_us{0};
+        /// Probabilities in parts per million, so settings stay lock-free atomics.
+        std::atomic<UInt64> latency_ppm{0};
+        std::atomic<UInt64> error_ppm{0};
+    };
+
+    PointSettings points[MAX_POINT];
+    std::atomic<bool> any_enabled{false};
+};
+
+}
@@ -404,6 +404,8 @@ public:
         return const_cast<std::decay_t<decltype(*this)> *>(this)->find(key, hash_value);
     }
 
+    void ALWAYS_INLINE prefetch(size_t hash_value) const { __builtin_prefetch(&buf[hash_value]); }
+
     bool ALWAYS_INLINE has(const Key & x) const { return !buf[x].isZero(*this); }
     bool ALWAYS_INLINE has(const Key &, size_t hash_value) const { return !buf[hash_value].isZero(*this); }
 
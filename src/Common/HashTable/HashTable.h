@@ -1113,6 +1113,13 @@ public:
         return const_cast<std::decay_t<decltype(*this)> *>(this)->find(x, hash_value);
     }
 
+    /// Issue a software prefetch of the cell where the key with this hash would
+    /// reside, so a batched caller can overlap the memory latency of several probes.
+    void ALWAYS_INLINE prefetch(size_t hash_value) const
+    {
+        __builtin_prefetch(&buf[grower.place(hash_value)]);
+    }
+
     std::enable_if_t<Grower::performs_linear_probing_with_single_step, bool>
     ALWAYS_INLINE erase(const Key & x)
     {
@@ -307,9 +307,19 @@ public:
 
     size_t maxSize() const
     {
+        std::lock_guard lock(mutex);
         return max_size;
     }
 
+    /// Change the cache budget at runtime, evicting down to the new size if needed.
+    /// Used by the cache governor to rebalance capacity between caches.
+    void setMaxSize(size_t max_size_)
+    {
+        std::lock_guard lock(mutex);
+        max_size = std::max(static_cast<size_t>(1), max_size_);
+        removeOverflow();
+    }
+
     void reset()
     {
         std::lock_guard lock(mutex);
@@ -417,7 +427,7 @@ private:
 
     /// Total weight of values.
     size_t current_size = 0;
-    const size_t max_size;
+    size_t max_size;
 
     std::atomic<size_t> hits {0};
     std::atomic<size_t> misses {0};
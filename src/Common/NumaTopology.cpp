@@ -0,0 +1,91 @@
+#include <Common/NumaTopology.h>
+
+#if defined(OS_LINUX)
+
+#include <IO/ReadBufferFromFile.h>
+#include <IO/ReadHelpers.h>
+
+#include <cctype>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace DB
+{
+
+namespace
+{
+
+/// Parse the sysfs cpu list format: comma-separated ranges, e.g. "0-23,48-71".
+std::vector<size_t> parseCpuList(const std::string & list)
+{
+    std::vector<size_t> cpus;
+    size_t pos = 0;
+    while (pos < list.size() && isdigit(list[pos]))
+    {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos)
+            end = list.size();
+
+        std::string range = list.substr(pos, end - pos);
+        size_t dash = range.find('-');
+        size_t first = std::stoul(range.substr(0, dash));
+        size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+        for (size_t cpu = first; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+
+        pos = end + 1;
+    }
+    return cpus;
+}
+
+}
+
+std::vector<std::vector<size_t>> getNumaNodeCpus()
+{
+    std::vector<std::vector<size_t>> nodes;
+
+    try
+    {
+        for (size_t node = 0;; ++node)
+        {
+            std::string path = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+            if (!fs::exists(path))
+                break;
+
+            ReadBufferFromFile in(path);
+            std::string list;
+            readStringUntilEOF(list, in);
+
+            auto cpus = parseCpuList(list);
+            if (cpus.empty())
+                break;
+            nodes.push_back(std::move(cpus));
+        }
+    }
+    catch (...)
+    {
+        return {};
+    }
+
+    if (nodes.size() < 2)
+        return {};
+    return nodes;
+}
+
+}
+
+#else
+
+namespace DB
+{
+
+std::vector<std::vector<size_t>> getNumaNodeCpus()
+{
+    return {};
+}
+
+}
+
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace DB
+{
+
+/// CPU ids of every NUMA node of the machine, read from sysfs.
+/// Returns an empty vector when the topology cannot be determined
+/// (non-Linux systems) or the machine has a single node.
+std::vector<std::vector<size_t>> getNumaNodeCpus();
+
+}
@@ -61,6 +61,8 @@
     M(IOBufferAllocBytes, "") \
     M(ArenaAllocChunks, "") \
     M(ArenaAllocBytes, "") \
+    M(ArenaChunkRecycleHits, "Number of arena chunks served from the per-thread recycled chunk pool instead of the allocator.") \
+    M(ArenaChunkRecycleStashes, "Number of freed arena chunks stashed into the per-thread pool for reuse.") \
     M(FunctionExecute, "") \
     M(TableFunctionExecute, "") \
     M(MarkCacheHits, "") \
@@ -69,8 +71,12 @@
     M(PrimaryIndexCacheMisses, "") \
     M(QueryCacheHits, "") \
     M(QueryCacheMisses, "") \
+    M(IntermediateResultCacheHits, "") \
+    M(IntermediateResultCacheMisses, "") \
     M(ChecksumsCacheHits, "") \
     M(ChecksumsCacheMisses, "") \
+    M(HiveChunkCacheHits, "") \
+    M(HiveChunkCacheMisses, "") \
     M(CreatedReadBufferOrdinary, "") \
     M(CreatedReadBufferAIO, "") \
     M(CreatedReadBufferAIOFailed, "") \
@@ -303,6 +309,8 @@
     M(WriteBufferFromHdfsWrite, "")\
     M(WriteBufferFromHdfsWriteFailed, "")\
     M(HdfsFileOpen, "")\
+    M(HdfsFsPoolHit, "Number of HDFS reads which reused a pooled filesystem connection")\
+    M(HdfsFsPoolMiss, "Number of HDFS reads which had to establish a new filesystem connection")\
     M(ReadBufferFromHdfsRead, "")\
     M(ReadBufferFromHdfsReadFailed, "")\
     M(ReadBufferFromHdfsReadBytes, "")\
@@ -320,6 +328,14 @@
     M(DiskCacheGetMetaMicroSeconds, "Total time for disk cache get operations") \
     M(DiskCacheGetTotalOps, "Total count of disk cache get operations") \
     M(DiskCacheSetTotalOps, "Total count of disk cache set operations") \
+    M(DiskCachePrefetchedSegments, "Total count of segments cached ahead of access by the prefetch strategy") \
+    M(DiskCacheOwnerQuotaSkippedSets, "Total count of disk cache inserts skipped because the owning virtual warehouse exceeded its cache quota") \
+    M(DiskCacheMarksHits, "Number of mark file segments served from the local disk cache") \
+    M(DiskCacheMarksMisses, "Number of mark file segments not found in the local disk cache (read from remote storage instead)") \
+    M(DiskCacheMetaHits, "Number of part metadata segments (checksums, primary index, metainfo) served from the local disk cache") \
+    M(DiskCacheMetaMisses, "Number of part metadata segments (checksums, primary index, metainfo) not found in the local disk cache") \
+    M(DiskCacheDataHits, "Number of column data segments served from the local disk cache") \
+    M(DiskCacheDataMisses, "Number of column data segments not found in the local disk cache (read from remote storage instead)") \
     \
     M(CnchTxnAborted, "Total number of aborted transactions (excludes preempting transactions)") \
     M(CnchTxnCommitted, "Total number of committed transactions") \
@@ -337,6 +353,9 @@
     M(CnchTxnAllTransactionRecord, "Total number of transaction records") \
     M(CnchTxnFinishedTransactionRecord, "Total number of finished transaction records") \
     \
+    M(LockManagerLockWaits, "Number of lock requests that conflicted with granted locks and entered a LockManager waiting queue") \
+    M(LockManagerLockWaitMilliseconds, "Total time lock requests spent queued in the LockManager before being granted") \
+    \
     M(IntentLockElapsedMilliseconds, "Total time spent to acquire intent locks") \
     M(IntentLockWriteIntentElapsedMilliseconds, "Total time spent to write intents") \
     M(IntentLockPreemptionElapsedMilliseconds, "Total time spent to preempt conflict locks") \
@@ -421,6 +440,8 @@
     M(GetAllDeleteBitmapsFailed, "") \
     M(GetStagedPartsSuccess, "") \
     M(GetStagedPartsFailed, "") \
+    M(GetStagedServerDataPartsSuccess, "") \
+    M(GetStagedServerDataPartsFailed, "") \
     M(GetDeleteBitmapsInPartitionsSuccess, "") \
     M(GetDeleteBitmapsInPartitionsFailed, "") \
     M(GetDeleteBitmapByKeysSuccess, "") \
@@ -449,6 +470,8 @@
     M(GetPartitionListFailed, "") \
     M(GetPartitionsFromMetastoreSuccess, "") \
     M(GetPartitionsFromMetastoreFailed, "") \
+    M(GetPartitionMinMaxSuccess, "") \
+    M(GetPartitionMinMaxFailed, "") \
     M(GetPartitionIDsSuccess, "") \
     M(GetPartitionIDsFailed, "") \
     M(CreateDictionarySuccess, "") \
@@ -487,6 +510,8 @@
     M(SetTransactionRecordFailed, "") \
     M(SetTransactionRecordWithRequestsSuccess, "") \
     M(SetTransactionRecordWithRequestsFailed, "") \
+    M(SetTransactionRecordsBatchSuccess, "") \
+    M(SetTransactionRecordsBatchFailed, "") \
     M(SetTransactionRecordCleanTimeSuccess, "") \
     M(SetTransactionRecordCleanTimeFailed, "") \
     M(SetTransactionRecordStatusWithOffsetsSuccess, "") \
@@ -727,7 +752,11 @@
     M(ReadBufferFromS3ReadFailed, "s3 read failed count") \
     M(ReadBufferFromS3ReadBytes, "s3 read op size") \
     M(ReadBufferFromS3ReadMicro, "s3 read op time") \
+    M(ReadBufferFromS3CoalescedSeeks, "s3 seeks merged into the previous ranged read instead of issuing a new small get") \
+    M(ReadBufferFromS3CoalescedGapBytes, "bytes of range gaps absorbed when merging s3 seeks") \
     M(ScheduleTimeMilliseconds, "Total time spent to schedule plan segment") \
+    M(ExchangeSendChunks, "Total number of chunks sent through exchange senders") \
+    M(ExchangeSendBytes, "Total bytes of chunks sent through exchange senders, divide by ExchangeSendChunks for the average payload size") \
     \
     M(ScheduledDedupTaskNumber, "Total number of scheduled dedup task") \
     M(DeleteBitmapCacheHit, "Total number of times to hit the cache to get delete bitmap for a part") \
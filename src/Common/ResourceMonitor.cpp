@@ -180,6 +180,93 @@ MemoryMonitor::Data MemoryMonitor::get() const
     return data;
 }
 
+IOMonitor::IOMonitor()
+{
+    fd = ::open(filename, O_RDONLY | O_CLOEXEC);
+
+    if (-1 == fd)
+        throwFromErrno("Cannot open file " + std::string(filename), errno == ENOENT ? ErrorCodes::FILE_DOESNT_EXIST : ErrorCodes::CANNOT_OPEN_FILE);
+}
+
+IOMonitor::~IOMonitor()
+{
+    if (0 != ::close(fd))
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+}
+
+IOMonitor::Data IOMonitor::get()
+{
+    size_t buf_size = 65536;
+    std::vector<char> buf(buf_size);
+
+    ssize_t res = 0;
+    int retry = 3;
+
+    while (retry--)
+    {
+        res = ::pread(fd, buf.data(), buf_size, 0);
+        if (-1 == res)
+        {
+            if (errno == EINTR)
+                continue;
+
+            throwFromErrno("Cannot read from file " + std::string(filename), ErrorCodes::CANNOT_READ_FROM_FILE_DESCRIPTOR);
+        }
+
+        if (res >= 0)
+            break;
+    }
+
+    if (res < 0)
+        throw Exception("Can't open file " + std::string(filename), ErrorCodes::CANNOT_READ_FROM_FILE_DESCRIPTOR);
+
+    ReadBufferFromMemory in(buf.data(), res);
+
+    UInt64 now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    double max_usage = 0;
+    while (!in.eof())
+    {
+        skipWhitespaceIfAny(in);
+        if (in.eof())
+            break;
+
+        UInt64 major, minor;
+        readIntText(major, in);
+        skipWhitespaceIfAny(in);
+        readIntText(minor, in);
+        skipWhitespaceIfAny(in);
+
+        String device;
+        readWord(device, in);
+        skipWhitespaceIfAny(in);
+
+        /// The 10th field after the device name is the time spent doing I/O (ms).
+        UInt64 io_ticks = 0;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            readIntText(io_ticks, in);
+            skipWhitespaceIfAny(in);
+        }
+        skipToNextLineOrEOF(in);
+
+        auto & prev_io_ticks = io_ticks_per_device[device];
+        /// Take the max over all devices: partitions never exceed their parent disk,
+        /// so there is no need to tell them apart from whole devices here.
+        if (last_time_ms && now_ms > last_time_ms && io_ticks >= prev_io_ticks)
+        {
+            double usage = 100.0 * (io_ticks - prev_io_ticks) / (now_ms - last_time_ms);
+            max_usage = std::max(max_usage, std::min(usage, 100.0));
+        }
+        prev_io_ticks = io_ticks;
+    }
+
+    last_time_ms = now_ms;
+    data.io_usage = max_usage;
+
+    return data;
+}
+
 UInt64 ResourceMonitor::getCPULimit()
 {
     if (getenv("POD_CPU_CORE_LIMIT"))
@@ -224,6 +311,7 @@ WorkerNodeResourceData ResourceMonitor::createResourceData(bool init)
     data.cpu_usage = cpu_data.cpu_usage;
     data.memory_usage = mem_data.memory_usage;
     data.memory_available = mem_data.memory_available;
+    data.io_usage = io_monitor.get().io_usage;
     data.disk_space = getDiskSpace();
     data.query_num = getQueryCount();
 
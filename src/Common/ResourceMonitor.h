@@ -18,6 +18,8 @@
 #include <Core/Types.h>
 #include <Interpreters/Context_fwd.h>
 
+#include <unordered_map>
+
 namespace DB
 {
 
@@ -70,10 +72,34 @@ private:
     int fd;
 };
 
+class IOMonitor
+{
+    static constexpr auto filename = "/proc/diskstats";
+
+public:
+    struct Data
+    {
+        /// Utilization of the busiest block device in percents: one saturated disk
+        /// makes the whole worker a bad target for I/O-heavy tasks.
+        double io_usage;
+    };
+
+    IOMonitor();
+    ~IOMonitor();
+
+    Data get();
+
+private:
+    int fd;
+    std::unordered_map<std::string, UInt64> io_ticks_per_device;
+    UInt64 last_time_ms{0};
+    Data data{};
+};
+
 class ResourceMonitor : protected WithContext
 {
 public:
-    explicit ResourceMonitor(const ContextPtr global_context_): WithContext(global_context_), mem_monitor(), cpu_monitor() {}
+    explicit ResourceMonitor(const ContextPtr global_context_): WithContext(global_context_), mem_monitor(), cpu_monitor(), io_monitor() {}
 
     WorkerNodeResourceData createResourceData(bool init = false);
 
@@ -88,6 +114,7 @@ private:
 private:
     MemoryMonitor mem_monitor;
     CPUMonitor cpu_monitor;
+    IOMonitor io_monitor;
 };
 
 }
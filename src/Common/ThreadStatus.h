@@ -92,6 +92,11 @@ public:
 
     String query;
     UInt64 normalized_query_hash = 0;
+
+    /// Distributed plan segment executed by this group's threads, 0 for the
+    /// coordinator/local part of the query. Attached threads copy it into
+    /// ThreadStatus::plan_segment_id so profiler samples can be attributed.
+    UInt64 plan_segment_id = 0;
 };
 
 using ThreadGroupStatusPtr = std::shared_ptr<ThreadGroupStatus>;
@@ -110,6 +115,9 @@ class ThreadStatus : public boost::noncopyable
 public:
     /// Linux's PID (or TGID) (the same id is shown by ps util)
     const UInt64 thread_id = 0;
+    /// Plan segment the thread currently works for (see ThreadGroupStatus::plan_segment_id).
+    /// Read from the query profiler signal handler, hence a plain per-thread copy.
+    UInt64 plan_segment_id = 0;
     /// Also called "nice" value. If it was changed to non-zero (when attaching query) - will be reset to zero when query is detached.
     Int32 os_thread_priority = 0;
 
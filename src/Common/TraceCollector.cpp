@@ -69,6 +69,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
         + sizeof(StackTrace::FramePointers)  /// Collected stack trace, maximum capacity
         + sizeof(TraceType)                  /// trace type
         + sizeof(UInt64)                     /// thread_id
+        + sizeof(UInt64)                     /// plan segment id
         + sizeof(Int64);                     /// size
 
     /// Write should be atomic to avoid overlaps
@@ -81,6 +82,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
 
     StringRef query_id;
     UInt64 thread_id;
+    UInt64 plan_segment_id = 0;
 
     if (CurrentThread::isInitialized())
     {
@@ -88,6 +90,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
         query_id.size = std::min(query_id.size, QUERY_ID_MAX_LEN);
 
         thread_id = CurrentThread::get().thread_id;
+        plan_segment_id = CurrentThread::get().plan_segment_id;
     }
     else
     {
@@ -107,6 +110,7 @@ void TraceCollector::collect(TraceType trace_type, const StackTrace & stack_trac
 
     writePODBinary(trace_type, out);
     writePODBinary(thread_id, out);
+    writePODBinary(plan_segment_id, out);
     writePODBinary(size, out);
 
     out.next();
@@ -166,6 +170,9 @@ void TraceCollector::run()
         UInt64 thread_id;
         readPODBinary(thread_id, in);
 
+        UInt64 plan_segment_id;
+        readPODBinary(plan_segment_id, in);
+
         Int64 size;
         readPODBinary(size, in);
 
@@ -178,7 +185,7 @@ void TraceCollector::run()
 
             UInt64 time = UInt64(ts.tv_sec * 1000000000LL + ts.tv_nsec);
             UInt64 time_in_microseconds = UInt64((ts.tv_sec * 1000000LL) + (ts.tv_nsec / 1000));
-            TraceLogElement element{time_t(time / 1000000000), time_in_microseconds, time, trace_type, thread_id, query_id, trace, size};
+            TraceLogElement element{time_t(time / 1000000000), time_in_microseconds, time, trace_type, thread_id, query_id, plan_segment_id, trace, size};
             trace_log->add(element);
         }
     }
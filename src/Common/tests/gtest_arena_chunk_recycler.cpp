@@ -0,0 +1,39 @@
+#include <Common/ArenaChunkRecycler.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+using namespace DB;
+
+TEST(ArenaChunkRecycler, TakeReturnsStashedBuffer)
+{
+    constexpr size_t size = ArenaChunkRecycler::min_chunk_size;
+
+    void * buf = ::malloc(size);
+    ASSERT_NE(buf, nullptr);
+    ASSERT_TRUE(ArenaChunkRecycler::tryPut(buf, size));
+
+    /// The same thread gets the stashed buffer back for the same size class.
+    void * reused = ArenaChunkRecycler::tryTake(size);
+    EXPECT_EQ(reused, buf);
+
+    /// The pool is now empty for this size class.
+    EXPECT_EQ(ArenaChunkRecycler::tryTake(size), nullptr);
+
+    ::free(buf);
+}
+
+TEST(ArenaChunkRecycler, RejectsUncacheableSizes)
+{
+    char stack_buf[16];
+
+    /// Not a power of two.
+    EXPECT_FALSE(ArenaChunkRecycler::tryPut(stack_buf, ArenaChunkRecycler::min_chunk_size + 1));
+    /// Outside the cached range.
+    EXPECT_FALSE(ArenaChunkRecycler::tryPut(stack_buf, ArenaChunkRecycler::min_chunk_size / 2));
+    EXPECT_FALSE(ArenaChunkRecycler::tryPut(stack_buf, ArenaChunkRecycler::max_chunk_size * 2));
+
+    EXPECT_EQ(ArenaChunkRecycler::tryTake(ArenaChunkRecycler::min_chunk_size + 1), nullptr);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <Common/CacheGovernor.h>
+#include <Common/LRUCache.h>
+
+using namespace DB;
+
+namespace
+{
+
+struct UnitWeight
+{
+    size_t operator()(const int &) const { return 1; }
+};
+
+using Cache = LRUCache<int, int, std::hash<int>, UnitWeight>;
+
+}
+
+TEST(CacheGovernor, MovesBudgetTowardsTheHotCache)
+{
+    auto hot = std::make_shared<Cache>(1000);
+    auto cold = std::make_shared<Cache>(1000);
+
+    CacheGovernor governor;
+    governor.registerCache("hot", hot);
+    governor.registerCache("cold", cold);
+
+    hot->set(1, std::make_shared<int>(1));
+    for (size_t i = 0; i < 100; ++i)
+        hot->get(1);
+
+    governor.rebalance();
+
+    /// A tenth of the cold budget migrates per round and the total is conserved.
+    EXPECT_EQ(cold->maxSize(), 900);
+    EXPECT_EQ(hot->maxSize(), 1100);
+    EXPECT_EQ(hot->maxSize() + cold->maxSize(), 2000);
+}
+
+TEST(CacheGovernor, NeverShrinksBelowTheFloor)
+{
+    auto hot = std::make_shared<Cache>(1000);
+    auto cold = std::make_shared<Cache>(1000);
+
+    CacheGovernor governor;
+    governor.registerCache("hot", hot);
+    governor.registerCache("cold", cold);
+
+    hot->set(1, std::make_shared<int>(1));
+    for (size_t round = 0; round < 100; ++round)
+    {
+        hot->get(1);
+        governor.rebalance();
+    }
+
+    /// The cold cache keeps 1/8 of its configured size no matter how long it stays idle.
+    EXPECT_GE(cold->maxSize(), 125);
+    EXPECT_EQ(hot->maxSize() + cold->maxSize(), 2000);
+}
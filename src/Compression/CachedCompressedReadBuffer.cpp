@@ -57,29 +57,59 @@ bool CachedCompressedReadBuffer::nextImpl()
     if (/*(storage_type == StorageType::Hdfs || */is_limit /*)*/ && file_pos >= limit_offset_in_file)
         return false;
 
-    /// Let's check for the presence of a decompressed block in the cache, grab the ownership of this block, if it exists.
-    UInt128 key = cache->hash(path, file_pos);
-
-    owned_cell = cache->getOrSet(key, [&]()
+    if (content_addressed_keys)
     {
+        /// The key is known only after the compressed block has been read, so the read
+        /// is not saved, but the decompression is, and the entry is shared by all parts
+        /// that contain a byte-identical block (e.g. the merged part and its sources).
         initInput();
         file_in->seek(file_pos, SEEK_SET);
 
-        auto cell = std::make_shared<UncompressedCacheCell>();
-
         size_t size_decompressed;
         size_t size_compressed_without_checksum;
-        cell->compressed_size = readCompressedData(size_decompressed, size_compressed_without_checksum, false);
+        size_t size_compressed = readCompressedData(size_decompressed, size_compressed_without_checksum, false);
 
-        if (cell->compressed_size)
+        if (!size_compressed)
+            return false;
+
+        owned_cell = cache->getOrSet(getLastBlockChecksum(), [&]()
         {
+            auto cell = std::make_shared<UncompressedCacheCell>();
+
+            cell->compressed_size = size_compressed;
             cell->additional_bytes = codec->getAdditionalSizeAtTheEndOfBuffer();
             cell->data.resize(size_decompressed + cell->additional_bytes);
             decompressTo(cell->data.data(), size_decompressed, size_compressed_without_checksum);
-        }
 
-        return cell;
-    });
+            return cell;
+        });
+    }
+    else
+    {
+        /// Let's check for the presence of a decompressed block in the cache, grab the ownership of this block, if it exists.
+        UInt128 key = cache->hash(path, file_pos);
+
+        owned_cell = cache->getOrSet(key, [&]()
+        {
+            initInput();
+            file_in->seek(file_pos, SEEK_SET);
+
+            auto cell = std::make_shared<UncompressedCacheCell>();
+
+            size_t size_decompressed;
+            size_t size_compressed_without_checksum;
+            cell->compressed_size = readCompressedData(size_decompressed, size_compressed_without_checksum, false);
+
+            if (cell->compressed_size)
+            {
+                cell->additional_bytes = codec->getAdditionalSizeAtTheEndOfBuffer();
+                cell->data.resize(size_decompressed + cell->additional_bytes);
+                decompressTo(cell->data.data(), size_decompressed, size_compressed_without_checksum);
+            }
+
+            return cell;
+        });
+    }
 
     if (owned_cell->data.size() == 0)
         return false;
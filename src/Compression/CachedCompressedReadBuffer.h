@@ -56,6 +56,10 @@ private:
     /// In compact map data, all implicit columns are stored in the same file. So when reading one implicit column data, it will be a range, which is [offset, offset + implicit col file size]. In this case, this parameter is true.
     bool is_limit = false;
 
+    /// Key the cache by the checksum of the compressed block instead of (path, offset).
+    /// See setContentAddressedKeys().
+    bool content_addressed_keys = false;
+
     /// A piece of data from the cache, or a piece of read data that we put into the cache.
     UncompressedCache::MappedPtr owned_cell;
 
@@ -78,6 +82,15 @@ public:
 
     void seek(size_t offset_in_compressed_file, size_t offset_in_decompressed_block);
 
+    /// Derive cache keys from the stored checksum of each compressed block instead of
+    /// the file path and offset. The compressed bytes still have to be read to learn
+    /// the key, but decompression is skipped on a hit, and entries survive merges:
+    /// a block rewritten byte-identical into a new part keeps its cache entry.
+    void setContentAddressedKeys()
+    {
+        content_addressed_keys = true;
+    }
+
     void setProfileCallback(const ReadBufferFromFileBase::ProfileCallback & profile_callback_, clockid_t clock_type_ = CLOCK_MONOTONIC_COARSE)
     {
         profile_callback = profile_callback_;
@@ -184,6 +184,19 @@ size_t CompressedReadBufferBase::readCompressedData(size_t & size_decompressed,
 }
 
 
+UInt128 CompressedReadBufferBase::getLastBlockChecksum() const
+{
+    /// readCompressedData always reads the checksum into the head of own_compressed_buffer,
+    /// even when the compressed data itself is referenced in place in 'compressed_in'.
+    const auto & checksum = *reinterpret_cast<const Checksum *>(own_compressed_buffer.data());
+
+    UInt128 res;
+    res.items[0] = checksum.first;
+    res.items[1] = checksum.second;
+    return res;
+}
+
+
 static void readHeaderAndGetCodec(const char * compressed_buffer, size_t size_decompressed, CompressionCodecPtr & codec, bool allow_different_codecs)
 {
     ProfileEvents::increment(ProfileEvents::CompressedReadBufferBlocks);
@@ -3,6 +3,7 @@
 #include <Common/PODArray.h>
 #include <Compression/LZ4_decompress_faster.h>
 #include <Compression/ICompressionCodec.h>
+#include <Core/Types.h>
 #include <IO/BufferBase.h>
 
 
@@ -59,6 +60,12 @@ public:
         disable_checksum = true;
     }
 
+    /// Checksum of the last block read by readCompressedData, as stored in the file.
+    /// Identical compressed blocks have identical checksums regardless of which file
+    /// or offset they were read from, which makes it usable as a content-addressed
+    /// key for caching the decompressed data.
+    UInt128 getLastBlockChecksum() const;
+
 public:
     CompressionCodecPtr codec;
 };
@@ -50,6 +50,10 @@ public:
         CompressionCodecPtr codec_ = CompressionCodecFactory::instance().getDefaultCodec(),
         size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE);
 
+    /// Takes effect from the next compressed block. Every block stores its own codec,
+    /// so readers do not depend on when the change happened.
+    void setCodec(CompressionCodecPtr codec_) { codec = std::move(codec_); }
+
     /// The amount of compressed data
     size_t getCompressedBytes()
     {
@@ -0,0 +1,106 @@
+#include <Compression/CompressionCodecZSTDDictionary.h>
+
+#include <Compression/CompressionInfo.h>
+#include <Parsers/ASTLiteral.h>
+#include <zdict.h>
+#include <zstd.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_COMPRESS;
+    extern const int CANNOT_DECOMPRESS;
+    extern const int BAD_ARGUMENTS;
+}
+
+CompressionCodecZSTDDictionary::CompressionCodecZSTDDictionary(String dictionary_, int level_)
+    : dictionary(std::move(dictionary_)), level(level_)
+{
+    if (dictionary.empty())
+        throw Exception("ZSTD dictionary codec requires a non-empty dictionary", ErrorCodes::BAD_ARGUMENTS);
+
+    setCodecDescription("ZSTDD", {std::make_shared<ASTLiteral>(static_cast<UInt64>(level))});
+
+    cdict = ZSTD_createCDict(dictionary.data(), dictionary.size(), level);
+    ddict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+    if (!cdict || !ddict)
+        throw Exception("Cannot digest ZSTD dictionary", ErrorCodes::BAD_ARGUMENTS);
+}
+
+CompressionCodecZSTDDictionary::~CompressionCodecZSTDDictionary()
+{
+    ZSTD_freeCDict(cdict);
+    ZSTD_freeDDict(ddict);
+}
+
+String CompressionCodecZSTDDictionary::train(const std::vector<std::string_view> & samples, size_t dict_capacity)
+{
+    String samples_buffer;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto & sample : samples)
+    {
+        samples_buffer.append(sample.data(), sample.size());
+        sample_sizes.push_back(sample.size());
+    }
+
+    String dictionary;
+    dictionary.resize(dict_capacity);
+
+    size_t dict_size = ZDICT_trainFromBuffer(
+        dictionary.data(), dict_capacity, samples_buffer.data(), sample_sizes.data(), sample_sizes.size());
+
+    /// Training legitimately fails on too few or too uniform samples; the caller falls
+    /// back to a plain codec in that case.
+    if (ZDICT_isError(dict_size))
+        return {};
+
+    dictionary.resize(dict_size);
+    return dictionary;
+}
+
+uint8_t CompressionCodecZSTDDictionary::getMethodByte() const
+{
+    return static_cast<uint8_t>(CompressionMethodByte::ZSTDDict);
+}
+
+void CompressionCodecZSTDDictionary::updateHash(SipHash & hash) const
+{
+    getCodecDesc()->updateTreeHash(hash);
+    hash.update(dictionary.data(), dictionary.size());
+}
+
+UInt32 CompressionCodecZSTDDictionary::getMaxCompressedDataSize(UInt32 uncompressed_size) const
+{
+    return ZSTD_compressBound(uncompressed_size);
+}
+
+UInt32 CompressionCodecZSTDDictionary::doCompressData(const char * source, UInt32 source_size, char * dest) const
+{
+    ZSTD_CCtx * cctx = ZSTD_createCCtx();
+    size_t compressed_size = ZSTD_compress_usingCDict(cctx, dest, ZSTD_compressBound(source_size), source, source_size, cdict);
+    ZSTD_freeCCtx(cctx);
+
+    if (ZSTD_isError(compressed_size))
+        throw Exception(
+            "Cannot compress block with dictionary ZSTD: " + std::string(ZSTD_getErrorName(compressed_size)),
+            ErrorCodes::CANNOT_COMPRESS);
+
+    return compressed_size;
+}
+
+void CompressionCodecZSTDDictionary::doDecompressData(const char * source, UInt32 source_size, char * dest, UInt32 uncompressed_size) const
+{
+    ZSTD_DCtx * dctx = ZSTD_createDCtx();
+    size_t res = ZSTD_decompress_usingDDict(dctx, dest, uncompressed_size, source, source_size, ddict);
+    ZSTD_freeDCtx(dctx);
+
+    if (ZSTD_isError(res))
+        throw Exception(
+            "Cannot decompress block with dictionary ZSTD: " + std::string(ZSTD_getErrorName(res)),
+            ErrorCodes::CANNOT_DECOMPRESS);
+}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <Compression/ICompressionCodec.h>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace DB
+{
+
+/** ZSTD with a pre-trained dictionary.
+  *
+  * Small blocks (index granules of narrow string columns) compress poorly on their
+  * own because every block has to rediscover the shared context. A dictionary
+  * trained on samples of the column data provides that context up front, which
+  * typically gives a 2-3x better ratio on such blocks at the same decode speed.
+  *
+  * The dictionary is NOT embedded into the compressed frames: it is stored
+  * out-of-band by whoever owns the stream, and the reader must construct this
+  * codec with the same dictionary and place it into CompressedReadBufferBase::codec
+  * before reading. For this reason the codec is not registered in
+  * CompressionCodecFactory and cannot be used in a column CODEC() declaration.
+  */
+class CompressionCodecZSTDDictionary : public ICompressionCodec
+{
+public:
+    static constexpr auto ZSTD_DEFAULT_LEVEL = 1;
+
+    explicit CompressionCodecZSTDDictionary(String dictionary_, int level_ = ZSTD_DEFAULT_LEVEL);
+    ~CompressionCodecZSTDDictionary() override;
+
+    /// Train a dictionary of at most dict_capacity bytes on the given sample values.
+    /// Returns an empty string if the samples are too few or too uniform to train on;
+    /// the caller should then fall back to a plain codec.
+    static String train(const std::vector<std::string_view> & samples, size_t dict_capacity);
+
+    uint8_t getMethodByte() const override;
+
+    UInt32 getMaxCompressedDataSize(UInt32 uncompressed_size) const override;
+
+    void updateHash(SipHash & hash) const override;
+
+    const String & getDictionary() const { return dictionary; }
+
+protected:
+    UInt32 doCompressData(const char * source, UInt32 source_size, char * dest) const override;
+
+    void doDecompressData(const char * source, UInt32 source_size, char * dest, UInt32 uncompressed_size) const override;
+
+    bool isCompression() const override { return true; }
+    bool isGenericCompression() const override { return true; }
+
+private:
+    const String dictionary;
+    const int level;
+
+    /// Digested forms of the dictionary, built once to keep per-block costs low.
+    ZSTD_CDict_s * cdict = nullptr;
+    ZSTD_DDict_s * ddict = nullptr;
+};
+
+}
@@ -30,6 +30,9 @@ namespace DB
   *
   * 0x90 - ZSTD
   *
+  * 0x96 - ZSTD with an out-of-band dictionary (see CompressionCodecZSTDDictionary).
+  *        The dictionary is not part of the frame and must be provided by the reader.
+  *
   * All sizes are little endian.
   */
 
@@ -43,6 +46,7 @@ enum class CompressionMethodByte : uint8_t
     T64      = 0x93,
     DoubleDelta  = 0x94,
     Gorilla      = 0x95,
+    ZSTDDict     = 0x96,
 };
 
 }
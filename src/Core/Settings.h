@@ -57,6 +57,7 @@ class IColumn;
     M(UInt64, min_compress_block_size, 65536, "The actual size of the block to compress, if the uncompressed data less than max_compress_block_size is no less than this value and no less than the volume of data for one mark.", 0) \
     M(UInt64, max_compress_block_size, 1048576, "The maximum size of blocks of uncompressed data before compressing for writing to a table.", 0) \
     M(UInt64, max_block_size, DEFAULT_BLOCK_SIZE, "Maximum block size for reading", 0) \
+    M(Bool, enable_adaptive_pipeline_batching, false, "Merge small chunks produced by selective filters back into blocks of roughly max_block_size rows before passing them downstream, so per-block overhead does not dominate.", 0) \
     M(UInt64, max_insert_block_size, DEFAULT_INSERT_BLOCK_SIZE, "The maximum block size for insertion, if we control the creation of blocks for insertion.", 0) \
     M(UInt64, max_insert_block_size_bytes, DEFAULT_BLOCK_SIZE_BYTES, "The maximum block bytes for insertion, if we control the creation of blocks for insertion.", 0) \
     M(UInt64, min_insert_block_size_rows, DEFAULT_INSERT_BLOCK_SIZE, "Squash blocks passed to INSERT query to specified size in rows, if blocks are not big enough.", 0) \
@@ -67,6 +68,7 @@ class IColumn;
     M(UInt64, max_insert_threads, 0, "The maximum number of threads to execute the INSERT SELECT query. Values 0 or 1 means that INSERT SELECT is not run in parallel. Higher values will lead to higher memory usage. Parallel INSERT SELECT has effect only if the SELECT part is run on parallel, see 'max_threads' setting.", 0) \
     M(UInt64, max_final_threads, 16, "The maximum number of threads to read from table with FINAL.", 0) \
     M(MaxThreads, max_threads, 0, "The maximum number of threads to execute the request. By default, it is determined automatically.", 0) \
+    M(Bool, enable_numa_aware_execution, false, "Bind pipeline executor threads to NUMA nodes and steal tasks across nodes only when the own node has none. Takes effect on machines with more than one NUMA node.", 0) \
     M(MaxThreads, max_alter_threads, 0, "The maximum number of threads to execute the ALTER requests. By default, it is determined automatically.", 0) \
     M(UInt64, max_read_buffer_size, DBMS_DEFAULT_BUFFER_SIZE, "The maximum size of the buffer to read from the filesystem.", 0) \
     M(UInt64, max_distributed_connections, 1024, "The maximum number of connections for distributed processing of one query (should be greater than max_threads).", 0) \
@@ -145,6 +147,7 @@ class IColumn;
     M(UInt64, min_count_to_compile_expression, 3, "The number of identical expressions before they are JIT-compiled", 0) \
     M(Bool, compile_aggregate_expressions, true, "Compile aggregate functions to native code.", 0) \
     M(UInt64, min_count_to_compile_aggregate_expression, 3, "The number of identical aggregate expressions before they are JIT-compiled", 0) \
+    M(Bool, enable_aggregation_offload, false, "Experimental: run eligible aggregations (fixed-width integer keys, sum/count) on a registered offload execution provider, falling back to CPU aggregation when no provider is registered or the device declines", 0) \
     M(UInt64, group_by_two_level_threshold, 100000, "From what number of keys, a two-level aggregation starts. 0 - the threshold is not set.", 0) \
     M(UInt64, group_by_two_level_threshold_bytes, 50000000, "From what size of the aggregation state in bytes, a two-level aggregation begins to be used. 0 - the threshold is not set. Two-level aggregation is used when at least one of the thresholds is triggered.", 0) \
     M(Bool, distributed_aggregation_memory_efficient, true, "Is the memory-saving mode of distributed aggregation enabled.", 0) \
@@ -192,7 +195,10 @@ class IColumn;
     \
     M(UInt64, min_bytes_to_use_direct_io, 0, "The minimum number of bytes for reading the data with O_DIRECT option during SELECT queries execution. 0 - disabled.", 0) \
     M(UInt64, min_bytes_to_use_mmap_io, 0, "The minimum number of bytes for reading the data with mmap option during SELECT queries execution. 0 - disabled.", 0) \
+    M(UInt64, min_bytes_to_use_aio_for_disk_cache, 0, "The minimum number of bytes for reading local disk cache segment files through the asynchronous AIO read buffer. 0 - disabled.", 0) \
     M(Bool, checksum_on_read, true, "Validate checksums on reading. It is enabled by default and should be always enabled in production. Please do not expect any benefits in disabling this setting. It may only be used for experiments and benchmarks. The setting only applicable for tables of MergeTree family. Checksums are always validated for other table engines and when receiving data over network.", 0) \
+    M(Bool, enable_adaptive_prewhere_conjuncts, false, "Evaluate top-level AND conjuncts of a PREWHERE condition one by one, ordered by selectivity observed during the query, so that the remaining conjuncts are computed only for rows that passed the previous ones.", 0) \
+    M(Bool, use_content_addressed_uncompressed_cache, false, "Key the cache of decompressed blocks by the checksum of the compressed block instead of the file path and offset. Blocks still have to be read from disk to learn the key, but decompression is skipped on a hit, and entries survive merges that rewrite parts with byte-identical blocks.", 0) \
     \
     M(Bool, force_index_by_date, 0, "Throw an exception if there is a partition key in a table, and it is not used.", 0) \
     M(Bool, force_primary_key, 0, "Throw an exception if there is primary key in a table, and it is not used.", 0) \
@@ -214,6 +220,7 @@ class IColumn;
     M(UInt64, log_queries_cut_to_length, 100000, "If query length is greater than specified threshold (in bytes), then cut query when writing to query log. Also limit length of printed query in ordinary text log.", 0) \
     \
     M(Bool, log_processors_profiles, false, "Log Processors profile events.", 0) \
+    M(Bool, log_plan_step_profiles, true, "Aggregate per plan step execution counters (rows, work and wait time) into query_log.", 0) \
     M(DistributedProductMode, distributed_product_mode, DistributedProductMode::DENY, "How are distributed subqueries performed inside IN or JOIN sections?", IMPORTANT) \
     \
     M(UInt64, max_concurrent_queries_for_all_users, 0, "The maximum number of concurrent requests for all users.", 0) \
@@ -301,9 +308,13 @@ class IColumn;
     M(Bool, prefer_column_name_to_alias, false, "Prefer using column names instead of aliases if possible.", 0) \
     M(Bool, prefer_global_in_and_join, false, "If enabled, all IN/JOIN operators will be rewritten as GLOBAL IN/JOIN. It's useful when the to-be-joined tables are only available on the initiator and we need to always scatter their data on-the-fly during distributed processing with the GLOBAL keyword. It's also useful to reduce the need to access the external sources joining external tables.", 0) \
     M(Bool, enable_query_cache, false, "Whether to enable query cache", 0) \
+    M(Bool, enable_index_advisor, false, "Record filter columns that no primary key or skip index covers and log suggested ALTER TABLE ... ADD INDEX statements once a column is filtered on often enough.", 0) \
+    M(Bool, enable_intermediate_result_cache, false, "Cache the result of leaf plan segments (scan + filter + partial aggregation) keyed by the sub-plan fingerprint, so repeated dashboards with different final projections reuse the heavy part of the work.", 0) \
     M(UInt64, connection_check_pool_size, 16, "Number of thread for connection check", 0) \
     M(Bool, query_worker_fault_tolerance, false, "Whether to retry when worker failures are detected when allocating metadata during query execution.", 0) \
     M(Bool, enable_partition_prune, true, "prune partition based on where expression analysis.", 0) \
+    M(Bool, enable_partition_minmax_in_catalog, false, "Maintain an aggregated minmax index per partition in the catalog's partition meta on every parts commit.", 0) \
+    M(Bool, enable_partition_minmax_prune, true, "Prune partitions by the aggregated minmax index maintained in the catalog, if any. Requires enable_partition_prune.", 0) \
     M(Bool, restore_table_expression_in_distributed, 1, "restore table expressions in distributed query to pass current database to remote query.", 0) \
     \
     /** Limits during query execution are part of the settings. \
@@ -326,6 +337,8 @@ class IColumn;
     M(UInt64, max_rows_to_group_by, 0, "", 0) \
     M(OverflowModeGroupBy, group_by_overflow_mode, OverflowMode::THROW, "What to do when the limit is exceeded.", 0) \
     M(UInt64, max_bytes_before_external_group_by, 0, "", 0) \
+    M(Bool, enable_selective_group_by_spill, false, "When external aggregation flushes to disk, spill only the largest buckets of the two-level hash table instead of the whole table, so hot buckets of a skewed key distribution keep aggregating in memory. Falls back to a full flush when too few buckets would stay resident.", 0) \
+    M(Bool, spill_columnar_format, false, "Write spill files of external aggregation, external sort and joins in the mark-indexed columnar format, which compresses every column independently and allows re-reading individual columns and block ranges during the merge phase. 0 - row-oriented native temp streams.", 0) \
     \
     M(UInt64, max_rows_to_sort, 0, "", 0) \
     M(UInt64, max_bytes_to_sort, 0, "", 0) \
@@ -370,6 +383,9 @@ class IColumn;
     M(Bool, join_any_take_last_row, false, "When disabled (default) ANY JOIN will take the first found row for a key. When enabled, it will take the last row seen if there are multiple rows for the same key.", IMPORTANT) \
     M(JoinAlgorithm, join_algorithm, JoinAlgorithm::HASH, "Specify join algorithm: 'auto', 'hash', 'partial_merge', 'prefer_partial_merge'. 'auto' tries to change HashJoin to MergeJoin on the fly to avoid out of memory.", 0) \
     M(Bool, join_parallel_left_right, true, "Enable joinTransform parallel for left input and right input", 0) \
+    M(Bool, enable_shared_broadcast_join_build, false, "Share one hash join build table between all plan segment instances of a broadcast join on the same worker: the first instance builds it, the others drain their copy of the build input and probe the shared table. Applies to LEFT and non-ANY INNER hash joins.", 0) \
+    M(Bool, enable_grace_hash_join, false, "With join_algorithm 'auto', use the partitioned grace hash join instead of switching the whole right table to merge join when the memory limit is hit: only the largest partitions are moved to disk and the rest keeps hash join speed.", 0) \
+    M(UInt64, grace_hash_join_buckets, 32, "Number of partitions the grace hash join splits both sides into. More buckets give finer spill granularity at a small bookkeeping cost.", 0) \
     M(Bool, partial_merge_join_optimizations, true, "Enable optimizations in partial merge join", 0) \
     M(UInt64, default_max_bytes_in_join, 1000000000, "Maximum size of right-side table if limit is required but max_bytes_in_join is not set.", 0) \
     M(UInt64, partial_merge_join_left_table_buffer_bytes, 32000000, "If not 0 group left table blocks in bigger ones for left-side table in partial merge join. It uses up to 2x of specified memory per joining thread. In current version work only with 'partial_merge_join_optimizations = 1'.", 0) \
@@ -555,6 +571,7 @@ class IColumn;
     M(Bool, enable_mv_estimate_read_cost, false, "Enable materialized view estimate with read cost", 0) \
     M(Bool, cascading_refresh_materialized_view, true, "Whether cascading refresh the materialized view", 0) \
     M(UInt64, max_rows_to_refresh_by_partition, 100000000, "The maximum rows to refresh a materialized view by partition. If exceed, we'll refresh the materialized view part by part.", 0) \
+    M(Bool, incremental_refresh_materialized_view, false, "Refresh materialized views incrementally: aggregate only base parts added since the last refresh and merge the delta into the target, rebuilding a partition wholesale only when no refresh watermark exists for it yet", 0) \
     M(UInt64, slow_query_ms, 0, "Slow query criterial in ms. 0 means all related function will not be executed", 0)\
     M(UInt64, max_rows_to_schedule_merge, 500000000, "Max rows of merged part for merge scheduler", 0)\
     M(UInt64, total_rows_to_schedule_merge, 0, "Max total rows of merged parts for merge scheduler, 0 means unlimit", 0)\
@@ -592,24 +609,34 @@ class IColumn;
     M(Bool, enable_write_non_host_server, true, "Whether to eable write on non-host server. Will root write request to host server.", 0) \
     M(UInt64, cnch_clear_parts_timeout, 10, "Wait for actions to clear the parts in workers within the specified number of seconds. 0 - wait unlimited time.", 0) \
     M(Seconds, cnch_fetch_parts_timeout, 60, "The timeout for gettting parts from metastore. 0 - wait unlimited time.", 0) \
+    M(UInt64, cnch_fetch_parts_max_threads, 16, "Max number of parallel range scans when fetching parts metadata from metastore. 1 - scan partitions serially.", 0) \
+    M(Bool, enable_zero_copy_part_parsing, false, "Parse part models fetched from the metastore straight into arena backed messages and hand them through to the part cache without intermediate copies.", 0) \
+    M(Bool, enable_query_metadata_prefetch, true, "Warm table and part metadata caches in the background while the optimizer is planning the query.", 0) \
     M(UInt64, cnch_sync_parts_timeout, 10, "Wait for actions to sync the parts in workers within the specified number of seconds. 0 - wait unlimited time.", 0) \
     M(UInt64, part_cache_manager_thread_pool_size, 16, "Number of thread performing background parts info collection in PartCacheManager.", 0) \
     M(String, username_for_internal_communication, "server", "Username to be used by server for authentication on worker side.", 0) \
     M(UInt64, cnch_part_allocation_algorithm, 2, "Part allocation algorithm, 0: jump consistent hashing, 1: bounded hash ring consistent hashing, 2: strict ring consistent hashing.", 0) \
+    M(Bool, enable_disk_cache_aware_part_allocation, true, "Bias part allocation toward workers whose disk cache already holds the part, based on cache summaries pulled from workers. Falls back to plain hash placement for workers without a fresh summary.", 0) \
+    M(Bool, enable_batch_send_resources, true, "Send create queries and data parts of all tables of a query to each worker in one batched rpc instead of one rpc per table.", 0) \
     M(UInt64, cnch_max_cached_storage, 2048, "Cnch storage cache size.", 0) \
     M(Bool, enable_multiple_tables_for_cnch_parts, 0, "Allow to query multiple tables for system.cnch_parts", 0) \
     M(Bool, enable_query_level_profiling, false, "Enable profiling at query and operator level", 0) \
     M(Bool, enable_kafka_log_profiling, false, "Enable query profiling for cnch_kafka_log table", 0) \
+    M(Bool, kafka_combined_metastore_commit, true, "Commit Kafka ingestion with a single metastore write carrying parts, offsets and the transaction record, instead of separate part write and commit time rewrite operations.", 0) \
     M(Bool, enable_query_metrics_tables_profiling, false, "Enable query profiling for query_metrics and query worker_metrics tables", 0) \
     M(UInt64, cloud_task_auto_stop_timeout, 60, "We will remove this task when heartbeat can't find this task more than retries_count times.", 0)\
     M(Bool, enable_preload_parts, false, "Enable preload parts", 0) \
     M(Bool, enable_async_preload_parts, true, "Allow to preload data parts asynchronously", 0) \
+    M(UInt64, insert_incremental_commit_bytes, 0, "For long-running INSERT SELECT into cnch tables, commit the accumulated parts and continue in a fresh implicit transaction every time this many bytes have been dumped, so readers see progress and a late failure only loses the last chunk. 0 - commit everything at the end of the insert.", 0) \
+    M(Bool, enable_insert_buffering, false, "Merge small INSERTs into cnch tables into a shared per-table in-memory buffer that is flushed through the part-dump path in the background, amortizing the per-query transaction and part-dump cost. The INSERT is acknowledged before its data is committed, so a server crash can lose the buffered rows. Not applied to unique tables.", 0) \
+    M(Bool, enable_insert_block_dedup, false, "Skip blocks of a retried INSERT into cnch tables: every written block precommits an insertion label derived from its content hash, so a block whose label already exists is dropped instead of being serialized and dumped again. Labels of failed inserts are removed, others expire after insertion_label_ttl. Not applied to unique tables.", 0) \
     M(DiskCacheMode, disk_cache_mode, DiskCacheMode::AUTO, "Whether to use local disk cache", 0) \
     M(Bool, enable_vw_customized_setting, false, "Allow vw customized overwrite profile settings", 0)\
     /** Settings for Unique Table */ \
     M(Bool, enable_unique_partial_update, true, "Whether to use partial column update for INSERT", 0) \
     M(Milliseconds, dedup_worker_heartbeat_ms, 3000, "Dedup worker heartbeat interval time", 0) \
     M(Bool, enable_staging_area_for_write, false, "Whether INSERTs on unique tables should commit to the staging area or not.", 0) \
+    M(Bool, enable_staging_area_for_read, false, "Whether SELECTs on unique tables should also read staged parts that the dedup worker has not published yet. Such reads see freshly ingested rows earlier, but may return duplicates that dedup will later remove.", 0) \
     M(UInt64, max_string_size_for_unique_key, 1048576, "Max string size limit for unique key.", 0) \
     M(Bool, enable_wait_attached_staged_parts_to_visible, true, "Enable wait for all staged parts become visible in attach process", 0) \
     M(Seconds, unique_key_attach_partition_timeout, 3600, "Default timeout (seconds) for attaching partition for unique key", 0) \
@@ -617,6 +644,9 @@ class IColumn;
     M(Bool, enable_unique_table_detach_ignore_delete_bitmap, false, "Enable ignore delete bitmap info when handling detach commands for unique table, for example: delete bitmap has been broken, we can just ignore it via this parameter.", 0) \
     \
     M(UInt64, resource_group_unmatched_behavior, 0, "The behavior when there is no resource group matched: 0 for let go, 1 for exception, 2 for the first root group.", 0) \
+    M(UInt64, query_estimated_memory_bytes, 0, "Estimated peak memory usage of the query in bytes, filled in by the optimizer from cardinality estimates and charged against resource group byte budgets at admission. 0 means unknown.", 0) \
+    M(Bool, enable_shared_scan_cache, true, "When several queries scan the same data part concurrently, serve their reads through the uncompressed cache even for scans larger than merge_tree_max_rows_to_use_cache, so identical granule reads collapse into a single physical read.", 0) \
+    M(Bool, enable_scan_quota_fairness, true, "Arbitrate scan task dispatch fairly across concurrent queries on a worker by estimated task bytes, so small queries get read slots promptly next to heavy scans.", 0) \
     /** Experimental functions */ \
     M(Bool, allow_experimental_funnel_functions, false, "Enable experimental functions for funnel analysis.", 0) \
     \
@@ -667,6 +697,7 @@ class IColumn;
     M(Bool, statistics_simplify_histogram, false, "Reduce buckets of histogram with simplifying", 0) \
     M(Float, statistics_simplify_histogram_ndv_density_threshold, 0.2, "Histogram simplifying threshold for ndv", 0) \
     M(Float, statistics_simplify_histogram_range_density_threshold, 0.2, "Histogram simplifying threshold for range", 0) \
+    M(Bool, statistics_enable_incremental_update, false, "Merge row counts, min/max and ndv sketches of inserted blocks into the statistics already collected for the table when an insert commits", 0) \
     M(Float, cost_calculator_table_scan_weight, 1, "Table scan cost weight for cost calculator", 0) \
     M(Float, cost_calculator_aggregating_weight, 7, "Aggregate output weight for cost calculator", 0) \
     M(Float, cost_calculator_join_probe_weight, 0.5, "Join probe side weight for cost calculator", 0) \
@@ -675,12 +706,17 @@ class IColumn;
     M(Float, cost_calculator_cte_weight, 1, "CTE output weight for cost calculator", 0) \
     M(Float, cost_calculator_cte_weight_for_join_build_side, 2.0, "Join build side weight for cost calculator", 0) \
     M(Float, cost_calculator_projection_weight, 0.1, "CTE output weight for cost calculator", 0) \
+    M(Float, cost_calculator_exchange_weight, 1, "Exchange output weight for cost calculator", 0) \
+    M(Bool, enable_cost_calibration, false, "Fit table scan and exchange cost weights from execution profiles of the current virtual warehouse and prefer them over the configured weights", 0) \
+    M(Bool, enable_materialized_view_advisor, false, "Collect aggregation shapes from optimized plans as materialized view candidates, reported by system.materialized_view_candidates", 0) \
+    M(UInt64, materialized_view_advisor_top_k, 50, "Max number of candidates reported by system.materialized_view_candidates", 0) \
     M(Bool, print_graphviz, false, "Whether print graphviz", 0) \
     M(String, graphviz_path, "/tmp/plan/", "The path of graphviz plan", 0) \
     M(Bool, eliminate_cross_joins, true, "Whether eliminate cross joins", 0) \
     M(Bool, enable_rewrite_alias_in_select, true, "Whether rewrite alias in select", 0) \
     M(UInt64, iterative_optimizer_timeout, 10000, "Max running time of a single iterative optimizer in ms", 0) \
     M(UInt64, cascades_optimizer_timeout, 10000, "Max running time of a single cascades optimizer in ms", 0) \
+    M(UInt64, cascades_optimizer_explore_threads, 1, "Number of threads exploring memo groups concurrently before the cost-based search, 1 disables parallel exploration", 0) \
     M(UInt64, plan_optimizer_timeout, 600000, "Max running time of a plan rewriter optimizer in ms", 0) \
     M(Bool, enable_nested_loop_join, true, "Whether enable nest loop join for outer join with filter", 0)\
     M(Bool, enable_cbo, true, "Whether enable CBO", 0) \
@@ -688,6 +724,7 @@ class IColumn;
     M(Bool, enum_repartition, true, "Enum repartition join", 0) \
     M(UInt64, max_replicate_build_size, 200000, "Max join build size, when enum replicate", 0) \
     M(UInt64, max_replicate_shuffle_size, 50000000, "Max join build size, when enum replicate", 0) \
+    M(Bool, enable_adaptive_replan, false, "Use runtime row counts reported by finished plan segments to re-plan subsequent executions, e.g. avoid broadcast joins whose build side overflowed max_replicate_shuffle_size at runtime", 0) \
     M(Bool, add_parallel_before_agg, false, "Add parallel before agg", 0) \
     M(Bool, add_parallel_after_join, false, "Add parallel after join", 0) \
     M(Bool, enforce_round_robin, false, "Whether add round robin exchange node", 0) \
@@ -700,10 +737,11 @@ class IColumn;
     M(UInt64, dynamic_filter_min_filter_rows, 10000, "Set minimum row to enable dynamic filter", 0) \
     M(Float, dynamic_filter_max_filter_factor, 0.7, "Set maximal filter factor to enable dynamic filter", 0) \
     M(Bool, enable_dynamic_filter_for_bloom_filter, true, "Whether enable dynamic filter for bloom filter", 0) \
+    M(Bool, enable_runtime_bloom_filter_in_prewhere, false, "Apply bloom filters built from the join build side inside PREWHERE of the probe side table scan, so granules whose key columns cannot match are skipped during reading", 0) \
     M(Bool, enable_dynamic_filter_for_join, true, "Whether enable dynamic filter for join", 0) \
     M(UInt64, dynamic_filter_default_bytes, 1024 * 256, "Whether enable dynamic filter for join", 0) \
     M(UInt64, dynamic_filter_default_hashes, 4, "Whether enable dynamic filter for join", 0) \
-    M(CTEMode, cte_mode, CTEMode::INLINED, "CTE mode: SHARED|INLINED|AUTO", 0) \
+    M(CTEMode, cte_mode, CTEMode::AUTO, "CTE mode: SHARED|INLINED|AUTO. AUTO decides inline vs. share by cost for each CTE referenced more than once", 0) \
     M(Bool, enable_cte_property_enum, false, "Whether enumerate all possible properties for cte", 0) \
     M(Bool, enable_cte_common_property, true, "Whether search common property for cte", 0) \
     M(UInt64 , max_graph_reorder_size, 10, "Max tables join order enum on graph", 0) \
@@ -725,9 +763,13 @@ class IColumn;
     M(Bool, enable_materialized_view_rewrite_verbose_log, false, "Whether enable materialized view based rewriter for query", 0) \
     M(Bool, enable_materialized_view_join_rewriting, false, "Whether enable materialized view based rewriter for query using join materialized views", 0) \
     M(Bool, enable_sharding_optimize, false, "Whether enable sharding optimization, eg. local join", 0) \
+    M(Bool, enable_bucket_table_optimize, false, "Derive the bucket distribution of clustered bucket tables in the optimizer, eliding exchanges for aggregations and joins aligned with the CLUSTER BY key", 0) \
     M(Bool, enable_filter_window_to_partition_topn, true, "Filter window to partition topn", 0) \
     M(Bool, optimizer_projection_support, false, "Use projection in optimizer mode", 0) \
     M(Bool, enable_topn_filtering_optimization, false, "Whether enable TopNFilterting optimization", 0) \
+    M(Bool, enable_optimizer_plan_cache, false, "Cache optimized plans and reuse them for repeated queries, skipping the analyze and optimize stages. Cached plans are revalidated against the metadata commit time of the tables they read", 0) \
+    M(UInt64, optimizer_plan_cache_ttl_seconds, 600, "Evict optimizer plan cache entries older than this many seconds. Bounds the staleness of expressions folded at optimization time (e.g. now()). 0 - no TTL", 0) \
+    M(Bool, enable_late_materialization_for_topn, false, "For top-N queries over a MergeTree table, scan only the sort-key columns plus a row locator, and fetch the remaining columns only for the rows that survive the sort", 0) \
     M(Bool, enable_execute_uncorrelated_subquery, false, "Whether enable execute uncorrelated subquery", 0) \
     M(UInt64, execute_uncorrelated_in_subquery_size, 10000, "Size of execute uncorrelated in subquery", 0) \
     M(Bool, enable_subcolumn_optimization_through_union, true, "Whether enable sub column optimization through set operation.", 0) \
@@ -737,16 +779,28 @@ class IColumn;
     M(UInt64, exchange_timeout_ms, 100000, "Exchange request timeout ms",0) \
     M(UInt64, exchange_local_receiver_queue_size, 300, "Queue size for local exchange receiver",0) \
     M(UInt64, exchange_remote_receiver_queue_size, 100, "Queue size for remote exchange receiver",0) \
+    M(UInt64, exchange_queue_bytes_limit, 0, "Byte budget of each exchange receive queue in addition to the queue size, senders block when the buffered bytes exceed it so wide rows cannot blow through worker memory. 0 - unlimited", 0) \
     M(Bool, exchange_enable_block_compress, false, "Whether enable exchange block compress ", 0) \
+    M(Bool, exchange_enable_zero_copy_send, false, "Attach large fixed width column payloads to the brpc IOBuf as refcounted slices instead of copying them, only effective when exchange block compress is disabled ", 0) \
+    M(Bool, exchange_enable_adaptive_compress, false, "Choose the exchange compression codec per link (NONE/LZ4/ZSTD) from the observed throughput and compression ratio, only effective when exchange block compress is enabled ", 0) \
+    M(Bool, exchange_enable_sparse_serialization, false, "Transmit mostly-default columns over exchange as delta-encoded row numbers plus the non-default values; receivers understand both encodings regardless of this setting ", 0) \
+    M(UInt64, exchange_parallel_deserialize_threads, 0, "Deserialize columns of wide exchange chunks in parallel on the receiver with up to this many threads; senders then prefix chunks with per-column sizes. 0 or 1 - serial", 0) \
     M(UInt64, exchange_stream_max_buf_size, 209715200, "Default 200M, -1 means no limit", 0) \
     M(UInt64, exchange_buffer_send_threshold_in_bytes, 1000000, "The minimum bytes when exchange will flush send buffer ", 0) \
     M(UInt64, exchange_buffer_send_threshold_in_row, 65505, "The minimum row num when exchange will flush send buffer", 0) \
+    M(UInt64, exchange_buffer_send_threshold_in_ms, 0, "The longest time a buffered chunk may wait in the exchange send buffer before it is flushed regardless of the size thresholds. 0 - no latency cap", 0) \
+    M(UInt64, exchange_buffer_total_bytes_limit, 0, "Upper bound of bytes buffered across all partitions of one repartition exchange sink, the largest partition buffers are flushed early when it is exceeded. 0 - unlimited", 0) \
     M(UInt64, exchange_unordered_output_parallel_size, 8, "The num of exchange sink for unorder exchange, ingoned if exchange need keep data order ", 0) \
     M(Bool, exchange_enable_keep_order_parallel_shuffle, false, "Whether enable parallel shuffle when exchange need keep order", 0) \
     M(Bool, exchange_enable_force_remote_mode, false, "Force exchange data transfer through network", 0) \
     M(Bool, exchange_enable_force_keep_order, false, "Force exchange keep data order", 0) \
     M(Bool, exchange_force_use_buffer, false, "Force exchange use buffer as possible", 0) \
     M(UInt64, distributed_max_parallel_size, false, "Max distributed execution parallel size", 0) \
+    M(Bool, enable_batch_send_plan_segments, false, "Ship all plan segments of a query destined for one worker in a single batched rpc during scheduling", 0) \
+    M(Bool, compress_plan_segment, true, "Compress serialized plan segments with ZSTD before dispatching them to workers", 0) \
+    M(Bool, enable_segment_dispatch_failover, false, "When dispatching a plan segment instance to a worker fails, retry that instance on the next worker of the shuffled list instead of failing the query; segments pinned by local exchanges are excluded", 0) \
+    M(UInt64, max_threads_per_plan_segment_group, 0, "Aggregate thread budget for all plan segment instances of one query on a worker, each starting instance is allotted its share of twice the budget. 0 - every instance uses max_threads", 0) \
+    M(Float, plan_segment_cpu_oversubscription_ratio, 0.0, "Cap pipeline parallelism of each starting plan segment so that the total number of query threads on the worker stays close to physical cores times this ratio. 0 - always use static max_threads", 0) \
     \
     /** Dynamic Filter settings */ \
     M(UInt64, wait_runtime_filter_timeout, 1000, "Execute filter wait for runtime filter timeout ms", 0) \
@@ -767,6 +821,8 @@ class IColumn;
     M(Bool, enable_sample_by_range, false, "Sample by range if it is true", 0) \
     M(Bool, enable_deterministic_sample_by_range, false, "Deterministic sample by range if it is true", 0) \
     M(Bool, enable_final_sample, false, "Sample from result rows if it is true", 0) \
+    M(Bool, enable_approximate_query, false, "Answer aggregate queries approximately: read only a SAMPLE of tables with a sampling key and scale additive aggregates back up by the realized sample factor", 0) \
+    M(Float, approximate_query_sample_ratio, 0.01, "Fraction of a table read per scan when enable_approximate_query rewrites a query", 0) \
     \
     /** clone strategy **/ \
     M(Bool, stop_clone_in_utc_time, false, "Enable stop executing clone log in utc time", 0) \
@@ -872,6 +928,7 @@ class IColumn;
     M(UInt64, cnch_part_attach_max_source_discover_level, 1, "Maximum levels of drill down to lookup for different sources", 0) \
     M(Bool, skip_table_definition_hash_check, false, "Whether skip table definition hash check when attach data parts.", 0)  \
     M(UInt64, cnch_part_attach_max_threads, 16, "Max threads to use when attach parts", 0) \
+    M(Bool, cnch_part_attach_manifest_only, false, "For ATTACH PARTITION FROM a path on shared storage: register the parts in the catalog at their current location instead of moving the data into the table namespace, making attach metadata-only work. The table takes ownership of the files: they are removed when the attached parts are dropped. Only supported for attach from path on non-unique tables.", 0) \
     M(UInt64, attach_failure_injection_knob, 0, "Attach failure injection knob, for test only", 0) \
     M(Bool, async_post_commit, false, "Txn post commit asynchronously", 0) \
     M(Bool, enable_auto_query_forwarding, false, "Auto forward query to target server when having multiple servers", 0) \
@@ -16,6 +16,7 @@
 #include <DaemonManager/BackgroudJobExecutor.h>
 #include <DaemonManager/BackgroundJob.h>
 #include <CloudServices/CnchServerClient.h>
+#include <Common/Stopwatch.h>
 
 namespace DB::DaemonManager
 {
@@ -23,16 +24,70 @@ namespace DB::DaemonManager
 namespace
 {
 
-void executeServerBGThreadAction(const StorageID & storage_id, const String & host_port, CnchBGThreadAction action, const Context & context, CnchBGThreadType type)
+/// Control RPCs normally finish within a few milliseconds; latencies of this order mean
+/// the server's scheduling queues are backed up.
+constexpr double DISPATCH_SLOW_LATENCY_MS = 1000;
+constexpr double DISPATCH_LATENCY_EWMA_ALPHA = 0.3;
+constexpr time_t DISPATCH_THROTTLE_STEP_SEC = 5;
+constexpr time_t DISPATCH_THROTTLE_MAX_SEC = 60;
+
+void executeServerBGThreadAction(
+    const StorageID & storage_id,
+    const String & host_port,
+    CnchBGThreadAction action,
+    const Context & context,
+    CnchBGThreadType type,
+    ServerDispatchFeedback & feedback)
 {
     CnchServerClientPtr server_client = context.getCnchServerClient(host_port);
-    server_client->controlCnchBGThread(storage_id, type, action);
+    Stopwatch watch;
+    try
+    {
+        server_client->controlCnchBGThread(storage_id, type, action);
+    }
+    catch (...)
+    {
+        feedback.recordFailure(host_port);
+        throw;
+    }
+    feedback.recordSuccess(host_port, watch.elapsedMilliseconds());
     LOG_DEBUG(&Poco::Logger::get(__func__), "Succeed to {} thread for {} on {}",
         toString(action), storage_id.getNameForLogs(), host_port);
 }
 
 } /// end anonymous namespace
 
+bool ServerDispatchFeedback::shouldThrottle(const String & host_port)
+{
+    std::lock_guard lock(mutex);
+    auto it = entries.find(host_port);
+    return it != entries.end() && time(nullptr) < it->second.throttled_until;
+}
+
+void ServerDispatchFeedback::recordSuccess(const String & host_port, UInt64 latency_ms)
+{
+    std::lock_guard lock(mutex);
+    auto & entry = entries[host_port];
+    entry.consecutive_failures = 0;
+    entry.latency_ewma_ms = entry.latency_ewma_ms
+        ? (1 - DISPATCH_LATENCY_EWMA_ALPHA) * entry.latency_ewma_ms + DISPATCH_LATENCY_EWMA_ALPHA * latency_ms
+        : latency_ms;
+
+    if (entry.latency_ewma_ms > DISPATCH_SLOW_LATENCY_MS)
+        entry.throttled_until = time(nullptr) + DISPATCH_THROTTLE_STEP_SEC;
+    else
+        entry.throttled_until = 0;
+}
+
+void ServerDispatchFeedback::recordFailure(const String & host_port)
+{
+    std::lock_guard lock(mutex);
+    auto & entry = entries[host_port];
+    ++entry.consecutive_failures;
+    time_t backoff = std::min<time_t>(DISPATCH_THROTTLE_MAX_SEC, DISPATCH_THROTTLE_STEP_SEC * entry.consecutive_failures);
+    entry.throttled_until = time(nullptr) + backoff;
+}
+
 bool IBackgroundJobExecutor::start(const BGJobInfo & info)
 {
     return start(info.storage_id, info.host_port);
@@ -64,31 +119,41 @@ BackgroundJobExecutor::BackgroundJobExecutor(const Context & context_, CnchBGThr
 
 bool BackgroundJobExecutor::start(const StorageID & storage_id, const String & host_port)
 {
-    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Start, context, type);
+    /// Starting a thread only adds load; postpone it while the server is saturated.
+    /// The daemon retries the action on a later iteration. Stop/remove/drop actions
+    /// relieve load and always go through.
+    if (dispatch_feedback.shouldThrottle(host_port))
+    {
+        LOG_WARNING(&Poco::Logger::get("BackgroundJobExecutor"),
+            "Server {} is saturated (slow or failing control RPCs), postpone start of {}",
+            host_port, storage_id.getNameForLogs());
+        return false;
+    }
+    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Start, context, type, dispatch_feedback);
     return true;
 }
 
 bool BackgroundJobExecutor::stop(const StorageID & storage_id, const String & host_port)
 {
-    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Stop, context, type);
+    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Stop, context, type, dispatch_feedback);
     return true;
 }
 
 bool BackgroundJobExecutor::remove(const StorageID & storage_id, const String & host_port)
 {
-    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Remove, context, type);
+    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Remove, context, type, dispatch_feedback);
     return true;
 }
 
 bool BackgroundJobExecutor::drop(const StorageID & storage_id, const String & host_port)
 {
-    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Drop, context, type);
+    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Drop, context, type, dispatch_feedback);
     return true;
 }
 
 bool BackgroundJobExecutor::wakeup(const StorageID & storage_id, const String & host_port)
 {
-    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Wakeup, context, type);
+    executeServerBGThreadAction(storage_id, host_port, CnchBGThreadAction::Wakeup, context, type, dispatch_feedback);
     return true;
 }
 
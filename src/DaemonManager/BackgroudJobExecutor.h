@@ -19,10 +19,37 @@
 #include <CloudServices/CnchBGThreadCommon.h>
 #include <Interpreters/StorageID.h>
 
+#include <map>
+#include <mutex>
+
 namespace DB::DaemonManager
 {
 
 struct BGJobInfo;
+
+/// Dispatch feedback collected from the control RPCs, per target server. The daemon
+/// cannot reroute a job (its target server is fixed by the topology), but it can stop
+/// piling start actions onto a server whose control RPCs are slow or failing and let
+/// the next iterations retry once the server has digested its backlog.
+class ServerDispatchFeedback
+{
+public:
+    bool shouldThrottle(const String & host_port);
+    void recordSuccess(const String & host_port, UInt64 latency_ms);
+    void recordFailure(const String & host_port);
+
+private:
+    struct Entry
+    {
+        double latency_ewma_ms{0};
+        size_t consecutive_failures{0};
+        time_t throttled_until{0};
+    };
+
+    std::mutex mutex;
+    std::map<String, Entry> entries;
+};
+
 class IBackgroundJobExecutor
 {
 public:
@@ -58,6 +85,7 @@ public:
 private:
     const Context & context;
     const CnchBGThreadType type;
+    ServerDispatchFeedback dispatch_feedback;
 };
 
 }
@@ -56,25 +56,36 @@ void DaemonJobTxnGC::cleanTxnRecords(const TransactionRecords & txn_records)
     TxnTimestamp current_time = context.getTimestamp();
 
     size_t num_threads = std::min(txn_records.size(), size_t(context.getConfigRef().getUInt("cnch_txn_gc_parallel", 16)));
+    size_t remove_batch_size = std::max(size_t(1), size_t(context.getConfigRef().getUInt64("cnch_txn_remove_batch_size", 10000)));
     ThreadPool thread_pool(num_threads);
 
-    size_t chunk_size = txn_records.size() / num_threads;
-
-    for (size_t chunk_begin = 0; chunk_begin < txn_records.size(); chunk_begin += chunk_size)
+    /// The records come from a key-ordered scan, i.e. oldest transactions first. Partition
+    /// them round robin so that every worker drains the oldest records of its share first
+    /// and stale records are not stuck behind one overloaded worker holding a whole chunk.
+    for (size_t thread_num = 0; thread_num < num_threads; ++thread_num)
     {
-        size_t chunk_end = std::min(txn_records.size(), chunk_begin + chunk_size);
         thread_pool.scheduleOrThrow(
-            [this, &txn_records, current_time, &summary, chunk_begin, chunk_end, & context] {
+            [this, &txn_records, current_time, &summary, thread_num, num_threads, remove_batch_size, & context] {
                 std::vector<TxnTimestamp> cleanTxnIds;
-                cleanTxnIds.reserve(chunk_end - chunk_begin);
+                cleanTxnIds.reserve(std::min(remove_batch_size, txn_records.size() / num_threads + 1));
+
+                auto flush_removed = [&] {
+                    context.getCnchCatalog()->removeTransactionRecords(cleanTxnIds);
+                    summary.cleaned += cleanTxnIds.size();
+                    cleanTxnIds.clear();
+                };
 
-                for (size_t i = chunk_begin; i < chunk_end; i++)
+                for (size_t i = thread_num; i < txn_records.size(); i += num_threads)
                 {
                     cleanTxnRecord(txn_records[i], current_time, cleanTxnIds, summary);
+                    /// Flush deletions in bounded multi-key commits instead of one commit per
+                    /// worker at the end, so a single metastore write stays within transaction
+                    /// limits no matter how many records piled up.
+                    if (cleanTxnIds.size() >= remove_batch_size)
+                        flush_removed();
                 }
 
-                context.getCnchCatalog()->removeTransactionRecords(cleanTxnIds);
-                summary.cleaned += cleanTxnIds.size();
+                flush_removed();
             }
             );
     }
@@ -811,5 +811,48 @@ TEST(backgroundjob, test_BackgroundJob_sync_with_persistent_status_case3)
     }
 }
 
+TEST(backgroundjob, test_ServerDispatchFeedback)
+{
+    const String server = "169.128.0.1:1223";
+    const String other_server = "169.128.0.2:1223";
+
+    {
+        /// Fast successful dispatches never throttle.
+        ServerDispatchFeedback feedback;
+        EXPECT_FALSE(feedback.shouldThrottle(server));
+        feedback.recordSuccess(server, 10);
+        EXPECT_FALSE(feedback.shouldThrottle(server));
+    }
+
+    {
+        /// A failing server is throttled, other servers are not affected.
+        ServerDispatchFeedback feedback;
+        feedback.recordFailure(server);
+        EXPECT_TRUE(feedback.shouldThrottle(server));
+        EXPECT_FALSE(feedback.shouldThrottle(other_server));
+    }
+
+    {
+        /// Slow control RPCs throttle, a fast one lifts the throttle.
+        ServerDispatchFeedback feedback;
+        feedback.recordSuccess(server, 100000);
+        EXPECT_TRUE(feedback.shouldThrottle(server));
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        feedback.recordSuccess(server, 0);
+        EXPECT_FALSE(feedback.shouldThrottle(server));
+    }
+}
+
 } // end namespace
 
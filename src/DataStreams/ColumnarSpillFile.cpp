@@ -0,0 +1,260 @@
+#include <DataStreams/ColumnarSpillFile.h>
+#include <DataStreams/NativeBlockInputStream.h>
+#include <Compression/CompressedReadBuffer.h>
+#include <Compression/CompressedWriteBuffer.h>
+#include <Compression/CompressionFactory.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+    extern const int CANNOT_READ_ALL_DATA;
+    extern const int QUERY_WAS_CANCELLED;
+}
+
+namespace
+{
+
+/// Fixed-width trailer: footer offset + magic, so the reader can locate the index.
+constexpr UInt64 COLUMNAR_SPILL_MAGIC = 0x4C50534E4D554C43ULL; /// "CLUMNSPL"
+constexpr size_t COLUMNAR_SPILL_TRAILER_SIZE = 2 * sizeof(UInt64);
+
+void writeColumnData(const IDataType & type, const ColumnPtr & column, WriteBuffer & ostr)
+{
+    /// Constant columns are materialized, same as in the native format:
+    /// serializations do not know how to handle constants.
+    ColumnPtr full_column = column->convertToFullColumnIfConst();
+
+    ISerialization::SerializeBinaryBulkSettings settings;
+    settings.getter = [&ostr](ISerialization::SubstreamPath) -> WriteBuffer * { return &ostr; };
+    settings.position_independent_encoding = false;
+    settings.low_cardinality_max_dictionary_size = 0; //-V1048
+
+    auto serialization = type.getDefaultSerialization();
+
+    ISerialization::SerializeBinaryBulkStatePtr state;
+    serialization->serializeBinaryBulkStatePrefix(settings, state);
+    serialization->serializeBinaryBulkWithMultipleStreams(*full_column, 0, 0, settings, state);
+    serialization->serializeBinaryBulkStateSuffix(settings, state);
+}
+
+}
+
+
+ColumnarSpillWriter::ColumnarSpillWriter(const std::string & path_, const Block & header_, const std::string & codec_name)
+    : header(header_)
+    , file_buf(path_)
+    , codec(codec_name.empty()
+        ? CompressionCodecFactory::instance().getDefaultCodec()
+        : CompressionCodecFactory::instance().get(codec_name, {}))
+{
+}
+
+void ColumnarSpillWriter::write(const Block & block)
+{
+    if (finished)
+        throw Exception("Cannot write to a finished columnar spill file", ErrorCodes::LOGICAL_ERROR);
+
+    /// Empty blocks are written too: external aggregation spills one block per
+    /// bucket and the merge phase expects every written block back.
+    Mark mark;
+    mark.rows = block.rows();
+    mark.info = block.info;
+    mark.columns.reserve(block.columns());
+
+    for (size_t i = 0; i < block.columns(); ++i)
+    {
+        const auto & column = block.getByPosition(i);
+
+        ColumnMark column_mark;
+        column_mark.offset = file_buf.count();
+        {
+            /// Each column payload is compressed independently so the reader can
+            /// seek to it and decompress it without touching its neighbours.
+            CompressedWriteBuffer compressed(file_buf, codec);
+            writeColumnData(*column.type, column.column, compressed);
+            compressed.next();
+            uncompressed_bytes += compressed.count();
+        }
+        column_mark.size = file_buf.count() - column_mark.offset;
+        mark.columns.emplace_back(column_mark);
+    }
+
+    marks.emplace_back(std::move(mark));
+}
+
+void ColumnarSpillWriter::finish()
+{
+    if (finished)
+        return;
+    finished = true;
+
+    UInt64 footer_offset = file_buf.count();
+
+    writeVarUInt(header.columns(), file_buf);
+    writeVarUInt(marks.size(), file_buf);
+    for (const auto & mark : marks)
+    {
+        writeVarUInt(mark.rows, file_buf);
+        mark.info.write(file_buf);
+        for (const auto & column_mark : mark.columns)
+        {
+            writeVarUInt(column_mark.offset, file_buf);
+            writeVarUInt(column_mark.size, file_buf);
+        }
+    }
+
+    writeIntBinary(footer_offset, file_buf);
+    writeIntBinary(COLUMNAR_SPILL_MAGIC, file_buf);
+    file_buf.next();
+
+    compressed_bytes = file_buf.count();
+}
+
+void ColumnarSpillWriter::write(const std::string & path, const Block & header, IBlockInputStream & input,
+                                std::atomic<bool> * is_cancelled, const std::string & codec_name)
+{
+    ColumnarSpillWriter writer(path, header, codec_name);
+    input.readPrefix();
+    while (Block block = input.read())
+    {
+        if (is_cancelled && is_cancelled->load(std::memory_order_relaxed))
+            throw Exception("Writing of columnar spill file was cancelled", ErrorCodes::QUERY_WAS_CANCELLED);
+        writer.write(block);
+    }
+    input.readSuffix();
+    writer.finish();
+}
+
+
+ColumnarSpillReader::ColumnarSpillReader(const std::string & path_, const Block & header_)
+    : header(header_)
+    , file_in(path_)
+{
+    size_t file_size = fs::file_size(path_);
+    if (file_size < COLUMNAR_SPILL_TRAILER_SIZE)
+        throw Exception("Columnar spill file " + path_ + " is truncated", ErrorCodes::CANNOT_READ_ALL_DATA);
+
+    file_in.seek(file_size - COLUMNAR_SPILL_TRAILER_SIZE, SEEK_SET);
+    UInt64 footer_offset;
+    UInt64 magic;
+    readIntBinary(footer_offset, file_in);
+    readIntBinary(magic, file_in);
+    if (magic != COLUMNAR_SPILL_MAGIC)
+        throw Exception("Bad magic in columnar spill file " + path_, ErrorCodes::CANNOT_READ_ALL_DATA);
+
+    file_in.seek(footer_offset, SEEK_SET);
+    size_t num_columns;
+    size_t num_marks;
+    readVarUInt(num_columns, file_in);
+    readVarUInt(num_marks, file_in);
+    if (num_columns != header.columns())
+        throw Exception(
+            "Columnar spill file " + path_ + " has " + toString(num_columns) + " columns, expected "
+                + toString(header.columns()),
+            ErrorCodes::LOGICAL_ERROR);
+
+    marks.resize(num_marks);
+    for (auto & mark : marks)
+    {
+        readVarUInt(mark.rows, file_in);
+        mark.info.read(file_in);
+        mark.columns.resize(num_columns);
+        for (auto & column_mark : mark.columns)
+        {
+            readVarUInt(column_mark.offset, file_in);
+            readVarUInt(column_mark.size, file_in);
+        }
+    }
+}
+
+Block ColumnarSpillReader::readMark(size_t mark_num, const std::vector<size_t> & column_positions)
+{
+    if (mark_num >= marks.size())
+        throw Exception("Mark " + toString(mark_num) + " is out of range in columnar spill file", ErrorCodes::LOGICAL_ERROR);
+
+    const auto & mark = marks[mark_num];
+
+    Block res;
+    res.info = mark.info;
+    auto read_one = [&](size_t position)
+    {
+        const auto & sample = header.getByPosition(position);
+
+        file_in.seek(mark.columns[position].offset, SEEK_SET);
+        CompressedReadBuffer compressed(file_in);
+
+        ColumnPtr column = sample.type->createColumn();
+        NativeBlockInputStream::readData(*sample.type, column, compressed, mark.rows, 0);
+        res.insert(ColumnWithTypeAndName(std::move(column), sample.type, sample.name));
+    };
+
+    if (column_positions.empty())
+    {
+        for (size_t i = 0; i < header.columns(); ++i)
+            read_one(i);
+    }
+    else
+    {
+        for (size_t position : column_positions)
+            read_one(position);
+    }
+
+    return res;
+}
+
+
+ColumnarSpillBlockInputStream::ColumnarSpillBlockInputStream(
+    const std::string & path_,
+    const Block & header_,
+    const Names & column_names,
+    size_t mark_begin_,
+    size_t mark_end_)
+    : path(path_)
+    , header(header_)
+    , mark_begin(mark_begin_)
+    , mark_end(mark_end_)
+{
+    if (column_names.empty())
+    {
+        read_header = header.cloneEmpty();
+    }
+    else
+    {
+        column_positions.reserve(column_names.size());
+        for (const auto & name : column_names)
+        {
+            column_positions.emplace_back(header.getPositionByName(name));
+            read_header.insert(header.getByName(name).cloneEmpty());
+        }
+    }
+    current_mark = mark_begin;
+}
+
+Block ColumnarSpillBlockInputStream::readImpl()
+{
+    if (done)
+        return {};
+
+    if (!reader)
+        reader = std::make_unique<ColumnarSpillReader>(path, header);
+
+    if (current_mark >= reader->numMarks() || current_mark >= mark_end)
+    {
+        done = true;
+        reader.reset();
+        return {};
+    }
+
+    return reader->readMark(current_mark++, column_positions);
+}
+
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+
+#include <Core/Names.h>
+#include <DataStreams/IBlockInputStream.h>
+#include <DataStreams/IBlockOutputStream.h>
+#include <Compression/ICompressionCodec.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/WriteBufferFromFile.h>
+
+namespace DB
+{
+
+/** Mark-indexed columnar format for operator spill files (external aggregation,
+  * external sort, join spills).
+  *
+  * Every block written becomes one "mark". Within a mark each column is an
+  * independently compressed payload stored contiguously, and a footer records
+  * {offset, size} of every payload plus the row count of every mark. The footer
+  * offset is a fixed-width trailer at the end of the file, so a reader can open
+  * the file, load the index, and then decompress only the columns and mark
+  * ranges it actually needs — unlike the row-oriented native temp streams which
+  * must be scanned front to back in full.
+  *
+  * The header is not stored in the file; as with TemporaryFileStream, the
+  * writer and the reader of a spill file always share the same sample block.
+  */
+class ColumnarSpillWriter
+{
+public:
+    ColumnarSpillWriter(const std::string & path_, const Block & header_, const std::string & codec_name = "");
+
+    void write(const Block & block);
+
+    /// Writes the footer and the trailer. No writes are allowed afterwards.
+    void finish();
+
+    const Block & getSampleBlock() const { return header; }
+    size_t getCompressedBytes() const { return compressed_bytes; }
+    size_t getUncompressedBytes() const { return uncompressed_bytes; }
+
+    /// Drain `input` into a spill file at `path`, the counterpart of TemporaryFileStream::write.
+    static void write(const std::string & path, const Block & header, IBlockInputStream & input,
+                      std::atomic<bool> * is_cancelled, const std::string & codec_name);
+
+private:
+    Block header;
+    WriteBufferFromFile file_buf;
+    CompressionCodecPtr codec;
+
+    struct ColumnMark
+    {
+        UInt64 offset = 0;
+        UInt64 size = 0;
+    };
+    struct Mark
+    {
+        UInt64 rows = 0;
+        /// Aggregation spills rely on BlockInfo surviving the round trip
+        /// (bucket alignment of two-level data during the merge phase).
+        BlockInfo info;
+        std::vector<ColumnMark> columns;
+    };
+    std::vector<Mark> marks;
+
+    size_t compressed_bytes = 0;
+    size_t uncompressed_bytes = 0;
+    bool finished = false;
+};
+
+/// To re-read spilled data, optionally restricted to a subset of columns and a range of marks.
+class ColumnarSpillReader
+{
+public:
+    ColumnarSpillReader(const std::string & path_, const Block & header_);
+
+    size_t numMarks() const { return marks.size(); }
+    size_t rowsInMark(size_t mark) const { return marks[mark].rows; }
+
+    /// Empty `column_positions` means all columns of the header.
+    Block readMark(size_t mark, const std::vector<size_t> & column_positions = {});
+
+private:
+    Block header;
+    ReadBufferFromFile file_in;
+
+    struct ColumnMark
+    {
+        UInt64 offset = 0;
+        UInt64 size = 0;
+    };
+    struct Mark
+    {
+        UInt64 rows = 0;
+        BlockInfo info;
+        std::vector<ColumnMark> columns;
+    };
+    std::vector<Mark> marks;
+};
+
+/// Lazily opens the spill file on first read, like TemporaryFileLazyInputStream.
+class ColumnarSpillBlockInputStream : public IBlockInputStream
+{
+public:
+    ColumnarSpillBlockInputStream(
+        const std::string & path_,
+        const Block & header_,
+        const Names & column_names = {},
+        size_t mark_begin_ = 0,
+        size_t mark_end_ = std::numeric_limits<size_t>::max());
+
+    String getName() const override { return "ColumnarSpill"; }
+    Block getHeader() const override { return read_header; }
+    void readSuffix() override {}
+
+protected:
+    Block readImpl() override;
+
+private:
+    const std::string path;
+    Block header;
+    Block read_header;
+    std::vector<size_t> column_positions;
+    size_t mark_begin;
+    size_t mark_end;
+
+    std::unique_ptr<ColumnarSpillReader> reader;
+    size_t current_mark = 0;
+    bool done = false;
+};
+
+/// IBlockOutputStream adapter over ColumnarSpillWriter, a drop-in replacement
+/// for NativeBlockOutputStream in spill write paths.
+class ColumnarSpillBlockOutputStream : public IBlockOutputStream
+{
+public:
+    ColumnarSpillBlockOutputStream(const std::string & path_, const Block & header_, const std::string & codec_name = "")
+        : writer(path_, header_, codec_name)
+    {}
+
+    Block getHeader() const override { return writer.getSampleBlock(); }
+    void write(const Block & block) override { writer.write(block); }
+    void writeSuffix() override { writer.finish(); }
+
+    size_t getCompressedBytes() const { return writer.getCompressedBytes(); }
+    size_t getUncompressedBytes() const { return writer.getUncompressedBytes(); }
+
+private:
+    ColumnarSpillWriter writer;
+};
+
+}
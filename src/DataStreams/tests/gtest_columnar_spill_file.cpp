@@ -0,0 +1,112 @@
+#include <Core/Block.h>
+#include <gtest/gtest.h>
+
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
+#include <DataStreams/ColumnarSpillFile.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Common/assert_cast.h>
+#include <Poco/TemporaryFile.h>
+
+
+using namespace DB;
+
+static Block getSampleBlock()
+{
+    Block block;
+    block.insert({ColumnUInt64::create(), std::make_shared<DataTypeUInt64>(), "key"});
+    block.insert({ColumnString::create(), std::make_shared<DataTypeString>(), "value"});
+    return block;
+}
+
+static Block getTestBlock(size_t rows, size_t shift)
+{
+    auto keys = ColumnUInt64::create();
+    auto values = ColumnString::create();
+    for (size_t i = 0; i < rows; ++i)
+    {
+        keys->insertValue(shift + i);
+        values->insertData(std::to_string(shift + i).data(), std::to_string(shift + i).size());
+    }
+
+    Block block = getSampleBlock().cloneEmpty();
+    block.getByPosition(0).column = std::move(keys);
+    block.getByPosition(1).column = std::move(values);
+    return block;
+}
+
+TEST(ColumnarSpillFile, RoundTrip)
+{
+    Poco::TemporaryFile tmp_file;
+    Block header = getSampleBlock();
+
+    {
+        ColumnarSpillWriter writer(tmp_file.path(), header);
+        writer.write(getTestBlock(100, 0));
+        writer.write(getTestBlock(50, 100));
+        writer.finish();
+    }
+
+    ColumnarSpillBlockInputStream stream(tmp_file.path(), header);
+    Block first = stream.read();
+    ASSERT_EQ(first.rows(), 100);
+    ASSERT_EQ(first.columns(), 2);
+    Block second = stream.read();
+    ASSERT_EQ(second.rows(), 50);
+    ASSERT_FALSE(stream.read());
+
+    const auto & keys = assert_cast<const ColumnUInt64 &>(*second.getByName("key").column);
+    EXPECT_EQ(keys.getElement(0), 100);
+    EXPECT_EQ(second.getByName("value").column->getDataAt(49).toString(), "149");
+}
+
+TEST(ColumnarSpillFile, SelectiveRead)
+{
+    Poco::TemporaryFile tmp_file;
+    Block header = getSampleBlock();
+
+    {
+        ColumnarSpillWriter writer(tmp_file.path(), header);
+        for (size_t i = 0; i < 4; ++i)
+            writer.write(getTestBlock(10, i * 10));
+        writer.finish();
+    }
+
+    /// Only the second column, only the last two marks.
+    ColumnarSpillBlockInputStream stream(tmp_file.path(), header, {"value"}, 2, 4);
+    ASSERT_EQ(stream.getHeader().columns(), 1);
+
+    Block block = stream.read();
+    ASSERT_EQ(block.columns(), 1);
+    ASSERT_EQ(block.rows(), 10);
+    EXPECT_EQ(block.getByPosition(0).column->getDataAt(0).toString(), "20");
+
+    block = stream.read();
+    ASSERT_EQ(block.rows(), 10);
+    EXPECT_EQ(block.getByPosition(0).column->getDataAt(9).toString(), "39");
+
+    ASSERT_FALSE(stream.read());
+}
+
+TEST(ColumnarSpillFile, BlockInfoSurvives)
+{
+    Poco::TemporaryFile tmp_file;
+    Block header = getSampleBlock();
+
+    {
+        Block block = getTestBlock(5, 0);
+        block.info.bucket_num = 42;
+        block.info.is_overflows = true;
+
+        ColumnarSpillWriter writer(tmp_file.path(), header);
+        writer.write(block);
+        writer.finish();
+    }
+
+    ColumnarSpillReader reader(tmp_file.path(), header);
+    ASSERT_EQ(reader.numMarks(), 1);
+    Block block = reader.readMark(0);
+    EXPECT_EQ(block.info.bucket_num, 42);
+    EXPECT_TRUE(block.info.is_overflows);
+}
@@ -46,6 +46,8 @@ class Field;
 struct FormatSettings;
 struct NameAndTypePair;
 
+class LowCardinalityDictionaryPool;
+
 class ISerialization
 {
 public:
@@ -166,6 +168,10 @@ public:
 
         /// If not zero, may be used to avoid reallocations while reading column of String type.
         double avg_value_size_hint = 0;
+
+        /// If set, decoded LowCardinality dictionaries are shared through this pool,
+        /// so readers of parts with identical dictionaries decode them only once.
+        std::shared_ptr<LowCardinalityDictionaryPool> low_cardinality_dictionary_pool;
     };
 
     /// Call before serializeBinaryBulkWithMultipleStreams chain to write something before first mark.
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Columns/IColumnUnique.h>
+#include <Common/HashTable/Hash.h>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace DB
+{
+
+/** Shares decoded LowCardinality dictionaries between readers of different parts
+  * within one operation, e.g. a merge over many small parts whose dictionaries are
+  * mostly identical. Entries are keyed by a hash of the serialized dictionary
+  * contents, so an identical dictionary is decoded (and its reverse index built)
+  * only once and the resulting ColumnUnique is reused by all subsequent readers.
+  *
+  * Cached dictionaries are immutable: the deserialization path only indexes into
+  * the global dictionary and never inserts into it, which is the same contract as
+  * ColumnLowCardinality::setSharedDictionary.
+  */
+class LowCardinalityDictionaryPool
+{
+public:
+    ColumnUniquePtr get(const UInt128 & key) const
+    {
+        std::lock_guard lock(mutex);
+        auto it = dictionaries.find(key);
+        return it == dictionaries.end() ? nullptr : it->second;
+    }
+
+    void set(const UInt128 & key, const ColumnUniquePtr & dictionary)
+    {
+        std::lock_guard lock(mutex);
+        /// Stop caching new dictionaries once the pool is full; lookups keep working.
+        if (total_bytes + dictionary->byteSize() > max_size_in_bytes)
+            return;
+        auto [it, inserted] = dictionaries.emplace(key, dictionary);
+        if (inserted)
+            total_bytes += dictionary->byteSize();
+    }
+
+private:
+    static constexpr size_t max_size_in_bytes = 128 * 1024 * 1024;
+
+    mutable std::mutex mutex;
+    std::unordered_map<UInt128, ColumnUniquePtr, UInt128Hash> dictionaries;
+    size_t total_bytes = 0;
+};
+
+using LowCardinalityDictionaryPoolPtr = std::shared_ptr<LowCardinalityDictionaryPool>;
+
+}
@@ -20,6 +20,7 @@
  */
 
 #include <DataTypes/Serializations/SerializationLowCardinality.h>
+#include <DataTypes/Serializations/LowCardinalityDictionaryPool.h>
 #include <DataTypes/DataTypeLowCardinality.h>
 #include <DataTypes/DataTypeNullable.h>
 #include <DataTypes/DataTypesNumber.h>
@@ -29,6 +30,7 @@
 #include <Columns/ColumnFixedString.h>
 #include <Columns/ColumnsCommon.h>
 #include <Common/HashTable/HashMap.h>
+#include <Common/SipHash.h>
 #include <Common/typeid_cast.h>
 #include <Common/assert_cast.h>
 #include <Core/Field.h>
@@ -639,7 +641,7 @@ void SerializationLowCardinality::deserializeBinaryBulkWithMultipleStreams(
 
     KeysSerializationVersion::checkVersion(low_cardinality_state->key_version.value);
 
-    auto read_dictionary = [this, low_cardinality_state, keys_stream]()
+    auto read_dictionary = [this, low_cardinality_state, keys_stream, &settings]()
     {
         UInt64 num_keys;
         readIntBinary(num_keys, *keys_stream);
@@ -648,6 +650,30 @@ void SerializationLowCardinality::deserializeBinaryBulkWithMultipleStreams(
         auto global_dict_keys = keys_type->createColumn();
         dict_inner_serialization->deserializeBinaryBulk(*global_dict_keys, *keys_stream, num_keys, 0);
 
+        if (const auto & pool = settings.low_cardinality_dictionary_pool)
+        {
+            /// Identical dictionaries are common across the parts of one merge:
+            /// reuse the decoded ColumnUnique instead of rebuilding it per part.
+            SipHash dict_hash;
+            dict_hash.update(dictionary_type->getName());
+            dict_hash.update(num_keys);
+            global_dict_keys->updateHashFast(dict_hash);
+
+            UInt128 pool_key;
+            dict_hash.get128(pool_key);
+
+            if (auto cached_dictionary = pool->get(pool_key))
+            {
+                low_cardinality_state->global_dictionary = std::move(cached_dictionary);
+                return;
+            }
+
+            ColumnUniquePtr column_unique = DataTypeLowCardinality::createColumnUnique(*dictionary_type, std::move(global_dict_keys));
+            pool->set(pool_key, column_unique);
+            low_cardinality_state->global_dictionary = std::move(column_unique);
+            return;
+        }
+
         auto column_unique = DataTypeLowCardinality::createColumnUnique(*dictionary_type, std::move(global_dict_keys));
         low_cardinality_state->global_dictionary = std::move(column_unique);
     };
@@ -128,7 +128,7 @@ ASTPtr DatabaseDictionary::getCreateTableQueryImpl(const String & table_name, Co
         buffer << ") Engine = Dictionary(" << backQuoteIfNeed(table_name) << ")";
     }
 
-    auto settings = getContext()->getSettingsRef();
+    auto & settings = getContext()->getSettingsRef();
     ParserCreateQuery parser(ParserSettings::valueOf(settings.dialect_type));
     const char * pos = query.data();
     std::string error_message;
@@ -148,7 +148,7 @@ ASTPtr DatabaseDictionary::getCreateDatabaseQuery() const
         WriteBufferFromString buffer(query);
         buffer << "CREATE DATABASE " << backQuoteIfNeed(getDatabaseName()) << " ENGINE = Dictionary";
     }
-    auto settings = getContext()->getSettingsRef();
+    auto & settings = getContext()->getSettingsRef();
     ParserCreateQuery parser(ParserSettings::valueOf(settings.dialect_type));
     return parseQuery(parser, query.data(), query.data() + query.size(), "", 0, settings.max_parser_depth);
 }
@@ -19,6 +19,7 @@
 #include <Common/filesystemHelpers.h>
 #include <Common/quoteString.h>
 #include <Common/formatReadable.h>
+#include <Common/FaultInjection.h>
 #include <Disks/DiskFactory.h>
 #include <Storages/S3/RAReadBufferFromS3.h>
 #include <Storages/S3/WriteBufferFromByteS3.h>
@@ -113,17 +114,25 @@ void DiskByteS3::listFiles(const String& path, std::vector<String>& file_names)
 std::unique_ptr<ReadBufferFromFileBase> DiskByteS3::readFile(const String& path,
     const ReadSettings& settings) const
 {
+    /// Simulated remote storage degradation for staging stress tests (see Common/FaultInjection.h)
+    if (FaultInjection::instance().inject(FaultInjection::S3_READ))
+        throw Exception("Injected S3 read fault for " + path, ErrorCodes::S3_ERROR);
+
     return std::make_unique<RAReadBufferFromS3>(s3_util.getClient(),
         s3_util.getBucket(), std::filesystem::path(root_prefix) / path, 3,
-        settings.buffer_size);
+        settings.buffer_size, nullptr, 0, nullptr, read_merge_gap_threshold);
 }
 
 std::unique_ptr<WriteBufferFromFileBase> DiskByteS3::writeFile(const String& path,
     const WriteSettings& settings)
 {
+    if (FaultInjection::instance().inject(FaultInjection::S3_WRITE))
+        throw Exception("Injected S3 write fault for " + path, ErrorCodes::S3_ERROR);
+
     return std::make_unique<WriteBufferFromByteS3>(s3_util.getClient(), s3_util.getBucket(),
         std::filesystem::path(root_prefix) / path, 16 * 1024 * 1024,
-        16 * 1024 * 1024, settings.file_meta, settings.buffer_size);
+        16 * 1024 * 1024, settings.file_meta, settings.buffer_size, nullptr, 0, false,
+        write_parallel_upload_streams);
 }
 
 void DiskByteS3::removeFile(const String& path)
@@ -153,8 +162,13 @@ void registerDiskByteS3(DiskFactory& factory)
         S3::S3Config s3_cfg(config, config_prefix);
         std::shared_ptr<Aws::S3::S3Client> client = s3_cfg.create();
 
+        size_t read_merge_gap_threshold = config.getUInt64(
+            config_prefix + ".read_merge_gap_threshold", 512 * 1024);
+        size_t write_parallel_upload_streams = config.getUInt64(
+            config_prefix + ".write_parallel_upload_streams", 1);
+
         return std::make_shared<DiskByteS3>(name, s3_cfg.root_prefix, s3_cfg.bucket,
-            client);
+            client, read_merge_gap_threshold, write_parallel_upload_streams);
     };
     factory.registerDiskType("bytes3", creator);
     factory.registerDiskType("s3", creator);
@@ -40,9 +40,12 @@ public:
     friend class DiskByteS3Reservation;
 
     DiskByteS3(const String& name_, const String& root_prefix_, const String& bucket_,
-        const std::shared_ptr<Aws::S3::S3Client>& client_):
+        const std::shared_ptr<Aws::S3::S3Client>& client_, size_t read_merge_gap_threshold_ = 0,
+        size_t write_parallel_upload_streams_ = 1):
             disk_id(next_disk_id.fetch_add(1)), name(name_), root_prefix(root_prefix_),
-            s3_util(client_, bucket_), reserved_bytes(0), reservation_count(0) {}
+            s3_util(client_, bucket_), read_merge_gap_threshold(read_merge_gap_threshold_),
+            write_parallel_upload_streams(write_parallel_upload_streams_),
+            reserved_bytes(0), reservation_count(0) {}
 
     virtual const String & getName() const override { return name; }
 
@@ -129,6 +132,12 @@ private:
     String root_prefix;
     S3::S3Util s3_util;
 
+    // Gap threshold for merging adjacent ranged reads of one object, see S3ReadAheadReader
+    size_t read_merge_gap_threshold;
+
+    // Number of concurrent part upload streams per written file, see WriteBufferFromByteS3
+    size_t write_parallel_upload_streams;
+
     UInt64 reserved_bytes;
     UInt64 reservation_count;
 
@@ -69,6 +69,42 @@ static inline bool likePatternIsStrstr(const String & pattern, String & res)
     return true;
 }
 
+/// Does the LIKE pattern start with a literal prefix, e.g. 'https://%'?
+/// Extracts the prefix; `is_exhaustive` is set when the pattern is the prefix followed
+/// by a single trailing '%', so the prefix comparison alone decides the match.
+static inline bool likePatternIsPrefix(const String & pattern, String & prefix, bool & is_exhaustive)
+{
+    prefix.clear();
+    is_exhaustive = false;
+
+    const char * pos = pattern.data();
+    const char * end = pos + pattern.size();
+
+    while (pos < end)
+    {
+        switch (*pos)
+        {
+            case '%':
+            case '_':
+                if (prefix.empty())
+                    return false;
+                is_exhaustive = (*pos == '%' && pos + 1 == end);
+                return true;
+            case '\\':
+                ++pos;
+                if (pos == end)
+                    return false;
+                [[fallthrough]];
+            default:
+                prefix += *pos;
+        }
+        ++pos;
+    }
+
+    /// No wildcards at all: LIKE degenerates to equality, which is still prefix-checkable.
+    return !prefix.empty();
+}
+
 /** 'like' - if true, treat pattern as SQL LIKE or ILIKE; if false - treat pattern as re2 regexp.
   * NOTE: We want to run regexp search for whole columns by one call (as implemented in function 'position')
   *  but for that, regexp engine must support \0 bytes and their interpretation as string boundaries.
@@ -99,6 +135,7 @@ struct MatchImpl
             return;
 
         String strstr_pattern;
+        bool prefix_is_exhaustive = false;
 
         /// A simple case where the [I]LIKE expression reduces to finding a substring in a string
         if (like && likePatternIsStrstr(pattern, strstr_pattern))
@@ -137,6 +174,43 @@ struct MatchImpl
             if (i < res.size())
                 memset(&res[i], revert, (res.size() - i) * sizeof(res[0]));
         }
+        else if (like && !case_insensitive && likePatternIsPrefix(pattern, strstr_pattern, prefix_is_exhaustive))
+        {
+            /// The pattern is anchored at the start of the string ('https://%...'):
+            /// matches can only begin at row starts, so compare the prefix row by row
+            /// instead of scanning the whole chunk for it, and run the regexp only on
+            /// rows that survive and only when wildcards follow the prefix.
+            size_t size = offsets.size();
+
+            Regexps::Pool::Pointer regexp;
+            if (!prefix_is_exhaustive)
+                regexp = Regexps::get<like, true, case_insensitive>(pattern);
+
+            size_t prev_offset = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                size_t str_size = offsets[i] - prev_offset - 1;
+                if (str_size >= strstr_pattern.size()
+                    && 0 == memcmp(&data[prev_offset], strstr_pattern.data(), strstr_pattern.size()))
+                {
+                    if (prefix_is_exhaustive)
+                        res[i] = !revert;
+                    else
+                        res[i] = revert
+                            ^ regexp->getRE2()->Match(
+                                  re2_st::StringPiece(reinterpret_cast<const char *>(&data[prev_offset]), str_size),
+                                  0,
+                                  str_size,
+                                  re2_st::RE2::UNANCHORED,
+                                  nullptr,
+                                  0);
+                }
+                else
+                    res[i] = revert;
+
+                prev_offset = offsets[i];
+            }
+        }
         else
         {
             size_t size = offsets.size();
@@ -198,7 +272,7 @@ struct MatchImpl
                     }
 
                     /// We check that the entry does not pass through the boundaries of strings.
-                    if (pos + strstr_pattern.size() < begin + offsets[i])
+                    if (pos + required_substring.size() < begin + offsets[i])
                     {
                         /// And if it does not, if necessary, we check the regexp.
 
@@ -342,7 +416,7 @@ struct MatchImpl
                 const UInt8 * next_pos = begin;
 
                 /// If required substring is larger than string size - it cannot be found.
-                if (strstr_pattern.size() <= n)
+                if (required_substring.size() <= n)
                 {
                     Searcher searcher(required_substring.data(), required_substring.size(), end - pos);
 
@@ -358,7 +432,9 @@ struct MatchImpl
                         }
                         next_pos += n;
 
-                        if (pos + strstr_pattern.size() <= next_pos)
+                        /// We check that the entry does not pass through the boundaries of strings
+                        /// (unlike the variable length case rows are not separated by zero bytes here).
+                        if (pos + required_substring.size() <= next_pos)
                         {
                             /// And if it does not, if necessary, we check the regexp.
 
@@ -2027,6 +2027,48 @@ ActionsDAGPtr ActionsDAG::cloneActionsForFilterPushDown(
     return actions;
 }
 
+std::vector<ActionsDAGPtr> ActionsDAG::splitIntoConjunctActions(const std::string & filter_name) const
+{
+    const auto * predicate = tryFindInIndex(filter_name);
+    if (!predicate || predicate->type != ActionType::FUNCTION || !predicate->function_base
+        || predicate->function_base->getName() != "and" || predicate->children.size() < 2)
+        return {};
+
+    std::vector<ActionsDAGPtr> res;
+    res.reserve(predicate->children.size());
+
+    for (const auto * child : predicate->children)
+    {
+        /// Collect the inputs this argument depends on. Array join changes the number of
+        /// rows, so such arguments cannot be evaluated independently of each other.
+        ColumnsWithTypeAndName child_inputs;
+        std::unordered_set<const Node *> visited_nodes;
+        std::stack<const Node *> stack;
+
+        stack.push(child);
+        visited_nodes.insert(child);
+        while (!stack.empty())
+        {
+            const auto * node = stack.top();
+            stack.pop();
+
+            if (node->type == ActionType::ARRAY_JOIN)
+                return {};
+
+            if (node->type == ActionType::INPUT)
+                child_inputs.emplace_back(node->column, node->result_type, node->result_name);
+
+            for (const auto * grand_child : node->children)
+                if (visited_nodes.insert(grand_child).second)
+                    stack.push(grand_child);
+        }
+
+        res.push_back(cloneActionsForConjunction({child}, child_inputs));
+    }
+
+    return res;
+}
+
 void ActionsDAG::serialize(WriteBuffer & buf) const
 {
     /**
@@ -302,6 +302,14 @@ public:
         const Names & available_inputs,
         const ColumnsWithTypeAndName & all_inputs);
 
+    /// If the filter column is a conjunction, create separate actions for every top-level
+    /// argument of AND. Each element calculates a single argument from the inputs it
+    /// actually depends on; the argument column is the first one in the result (see
+    /// cloneActionsForConjunction). Returns an empty list if the filter is not a
+    /// conjunction of at least two arguments or if some argument depends on array join.
+    /// Is used to evaluate prewhere conjuncts one by one.
+    std::vector<ActionsDAGPtr> splitIntoConjunctActions(const std::string & filter_name) const;
+
     void serialize(WriteBuffer & buf) const;
     static ActionsDAGPtr deserialize(ReadBuffer & buf, ContextPtr context);
 
@@ -304,6 +304,99 @@ static inline StringRef ALWAYS_INLINE serializeKeysToPoolContiguous(
 }
 
 
+/** Layout of key columns for serializeKeysToPoolContiguous, precomputed once per block.
+  * Consecutive fixed-width non-nullable columns form runs that are packed per row with
+  * a single arena allocation and raw byte copies, the remaining columns keep the
+  * generic virtual serialization. For a fixed-width value the serialized form is
+  * exactly its raw bytes, so packing the run produces the same blob.
+  */
+struct SerializedKeysLayout
+{
+    struct Run
+    {
+        size_t begin;           /// First column of the run.
+        size_t end;             /// One past the last column of the run.
+        size_t fixed_bytes;     /// Bytes one row of the run occupies, 0 for a generic run.
+    };
+
+    std::vector<Run> runs;
+    std::vector<const char *> raw_data;     /// Raw data begin per column, nullptr for generic columns.
+    std::vector<size_t> value_sizes;        /// Fixed value size per column, 0 for generic columns.
+    bool has_fixed_runs = false;
+};
+
+static inline SerializedKeysLayout buildSerializedKeysLayout(const ColumnRawPtrs & key_columns)
+{
+    SerializedKeysLayout layout;
+    size_t keys_size = key_columns.size();
+    layout.raw_data.resize(keys_size, nullptr);
+    layout.value_sizes.resize(keys_size, 0);
+
+    for (size_t j = 0; j < keys_size; ++j)
+    {
+        /// Const and full-state low cardinality columns report fixed-and-contiguous
+        /// but do not expose one raw value per row, keep them on the generic path.
+        bool is_fixed = key_columns[j]->isFixedAndContiguous()
+            && !isColumnConst(*key_columns[j])
+            && !key_columns[j]->lowCardinality();
+        if (is_fixed)
+        {
+            layout.raw_data[j] = key_columns[j]->getRawData().data;
+            layout.value_sizes[j] = key_columns[j]->sizeOfValueIfFixed();
+            layout.has_fixed_runs = true;
+        }
+
+        bool extends_run = !layout.runs.empty() && (layout.runs.back().fixed_bytes > 0) == is_fixed;
+        if (extends_run)
+        {
+            layout.runs.back().end = j + 1;
+            layout.runs.back().fixed_bytes += layout.value_sizes[j];
+        }
+        else
+            layout.runs.push_back({j, j + 1, layout.value_sizes[j]});
+    }
+
+    return layout;
+}
+
+/** Same as above, but copies the fixed-width runs of the layout with one allocation
+  * per run. The per-value copies compile down to single unaligned vector loads and
+  * stores for the common small sizes: reading past a value is safe because column
+  * data is padded, writing past the allocation is safe because of Arena::pad_right.
+  */
+static inline StringRef ALWAYS_INLINE serializeKeysToPoolContiguous(
+    size_t i, size_t keys_size, const ColumnRawPtrs & key_columns, const SerializedKeysLayout & layout, Arena & pool)
+{
+    if (!layout.has_fixed_runs)
+        return serializeKeysToPoolContiguous(i, keys_size, key_columns, pool);
+
+    const char * begin = nullptr;
+
+    size_t sum_size = 0;
+    for (const auto & run : layout.runs)
+    {
+        if (run.fixed_bytes)
+        {
+            char * place = pool.allocContinue(run.fixed_bytes, begin);
+            for (size_t j = run.begin; j < run.end; ++j)
+            {
+                size_t value_size = layout.value_sizes[j];
+                memcpySmallAllowReadWriteOverflow15(place, layout.raw_data[j] + i * value_size, value_size);
+                place += value_size;
+            }
+            sum_size += run.fixed_bytes;
+        }
+        else
+        {
+            for (size_t j = run.begin; j < run.end; ++j)
+                sum_size += key_columns[j]->serializeValueIntoArena(i, pool, begin).size;
+        }
+    }
+
+    return {begin, sum_size};
+}
+
+
 /** Pack elements with shuffle instruction.
   * See the explanation in ColumnsHashing.h
   */
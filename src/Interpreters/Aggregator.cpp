@@ -30,6 +30,7 @@
 #include <DataTypes/DataTypeLowCardinality.h>
 #include <Columns/ColumnArray.h>
 #include <Columns/ColumnTuple.h>
+#include <DataStreams/ColumnarSpillFile.h>
 #include <DataStreams/NativeBlockOutputStream.h>
 #include <DataStreams/materializeBlock.h>
 #include <IO/WriteBufferFromFile.h>
@@ -558,6 +559,8 @@ void Aggregator::Params::serialize(WriteBuffer & buf) const
     writeBinary(group_by_two_level_threshold_bytes, buf);
 
     writeBinary(max_bytes_before_external_group_by, buf);
+    writeBinary(enable_selective_spill, buf);
+    writeBinary(columnar_spill, buf);
 
     writeBinary(empty_result_for_aggregation_by_empty_set, buf);
 
@@ -600,6 +603,10 @@ Aggregator::Params Aggregator::Params::deserialize(ReadBuffer & buf, const Conte
 
     size_t max_bytes_before_external_group_by;
     readBinary(max_bytes_before_external_group_by, buf);
+    bool enable_selective_spill;
+    readBinary(enable_selective_spill, buf);
+    bool columnar_spill;
+    readBinary(columnar_spill, buf);
     bool empty_result_for_aggregation_by_empty_set;
     readBinary(empty_result_for_aggregation_by_empty_set, buf);
 
@@ -613,7 +620,7 @@ Aggregator::Params Aggregator::Params::deserialize(ReadBuffer & buf, const Conte
     size_t min_count_to_compile_aggregate_expression;
     readBinary(min_count_to_compile_aggregate_expression, buf);
 
-    return Aggregator::Params(src_header, keys, aggregates,
+    auto res = Aggregator::Params(src_header, keys, aggregates,
                               overflow_row, max_rows_to_group_by, group_by_overflow_mode,
                               group_by_two_level_threshold, group_by_two_level_threshold_bytes,
                               max_bytes_before_external_group_by,
@@ -624,6 +631,9 @@ Aggregator::Params Aggregator::Params::deserialize(ReadBuffer & buf, const Conte
                               compile_aggregate_expressions,
                               min_count_to_compile_aggregate_expression,
                               intermediate_header);
+    res.enable_selective_spill = enable_selective_spill;
+    res.columnar_spill = columnar_spill;
+    return res;
 }
 
 #if USE_EMBEDDED_COMPILER
@@ -919,7 +929,11 @@ AggregatedDataVariants::Type Aggregator::chooseAggregationMethod()
     {
         if (has_low_cardinality)
             return AggregatedDataVariants::Type::low_cardinality_key_fixed_string;
-        else
+        /// Short fixed strings (e.g. UUIDs or IPv6 stored as FixedString(16)) fit the
+        /// packed keysN variants below: the key is stored inline in the hash table and
+        /// compared as a wide integer instead of going through StringRef comparisons
+        /// and per-key arena copies.
+        else if (keys_bytes > 32)
             return AggregatedDataVariants::Type::key_fixed_string;
     }
 
@@ -1406,7 +1420,13 @@ bool Aggregator::executeOnBlock(Columns columns, UInt64 num_rows, AggregatedData
         if (!enoughSpaceInDirectory(tmp_path, size))
             throw Exception("Not enough space for external aggregation in " + tmp_path, ErrorCodes::NOT_ENOUGH_SPACE);
 
-        writeToTemporaryFile(result, tmp_path);
+        /// Try to release memory down to half of the threshold by spilling only the
+        /// largest buckets, so the hot buckets of a skewed distribution keep
+        /// aggregating in memory and the merge stage reads fewer spilled runs.
+        if (!params.enable_selective_spill
+            || !writeColdBucketsToTemporaryFile(
+                result, current_memory_usage - static_cast<Int64>(params.max_bytes_before_external_group_by / 2), tmp_path))
+            writeToTemporaryFile(result, tmp_path);
     }
 
     return true;
@@ -1420,9 +1440,21 @@ void Aggregator::writeToTemporaryFile(AggregatedDataVariants & data_variants, co
 
     auto file = createTemporaryFile(tmp_path);
     const std::string & path = file->path();
-    WriteBufferFromFile file_buf(path);
-    CompressedWriteBuffer compressed_buf(file_buf);
-    NativeBlockOutputStream block_out(compressed_buf, DBMS_TCP_PROTOCOL_VERSION, getHeader(false));
+
+    std::unique_ptr<WriteBufferFromFile> file_buf;
+    std::unique_ptr<CompressedWriteBuffer> compressed_buf;
+    std::unique_ptr<IBlockOutputStream> block_out_holder;
+    if (params.columnar_spill)
+    {
+        block_out_holder = std::make_unique<ColumnarSpillBlockOutputStream>(path, getHeader(false));
+    }
+    else
+    {
+        file_buf = std::make_unique<WriteBufferFromFile>(path);
+        compressed_buf = std::make_unique<CompressedWriteBuffer>(*file_buf);
+        block_out_holder = std::make_unique<NativeBlockOutputStream>(*compressed_buf, DBMS_TCP_PROTOCOL_VERSION, getHeader(false));
+    }
+    IBlockOutputStream & block_out = *block_out_holder;
 
     LOG_DEBUG(log, "Writing part of aggregation data into temporary file {}.", path);
     ProfileEvents::increment(ProfileEvents::ExternalAggregationWritePart);
@@ -1450,13 +1482,27 @@ void Aggregator::writeToTemporaryFile(AggregatedDataVariants & data_variants, co
         data_variants.without_key = place;
     }
 
+    block_out.writeSuffix();
     block_out.flush();
-    compressed_buf.next();
-    file_buf.next();
+    if (compressed_buf)
+        compressed_buf->next();
+    if (file_buf)
+        file_buf->next();
 
     double elapsed_seconds = watch.elapsedSeconds();
-    double compressed_bytes = file_buf.count();
-    double uncompressed_bytes = compressed_buf.count();
+    double compressed_bytes;
+    double uncompressed_bytes;
+    if (params.columnar_spill)
+    {
+        const auto & columnar_out = static_cast<const ColumnarSpillBlockOutputStream &>(block_out);
+        compressed_bytes = columnar_out.getCompressedBytes();
+        uncompressed_bytes = columnar_out.getUncompressedBytes();
+    }
+    else
+    {
+        compressed_bytes = file_buf->count();
+        uncompressed_bytes = compressed_buf->count();
+    }
 
     {
         std::lock_guard lock(temporary_files.mutex);
@@ -1585,6 +1631,147 @@ void Aggregator::writeToTemporaryFileImpl(
 }
 
 
+bool Aggregator::writeColdBucketsToTemporaryFile(AggregatedDataVariants & data_variants, Int64 bytes_to_release, const String & tmp_path) const
+{
+    Stopwatch watch;
+
+    auto file = createTemporaryFile(tmp_path);
+    const std::string & path = file->path();
+
+    std::unique_ptr<WriteBufferFromFile> file_buf;
+    std::unique_ptr<CompressedWriteBuffer> compressed_buf;
+    std::unique_ptr<IBlockOutputStream> block_out_holder;
+    if (params.columnar_spill)
+    {
+        block_out_holder = std::make_unique<ColumnarSpillBlockOutputStream>(path, getHeader(false));
+    }
+    else
+    {
+        file_buf = std::make_unique<WriteBufferFromFile>(path);
+        compressed_buf = std::make_unique<CompressedWriteBuffer>(*file_buf);
+        block_out_holder = std::make_unique<NativeBlockOutputStream>(*compressed_buf, DBMS_TCP_PROTOCOL_VERSION, getHeader(false));
+    }
+    IBlockOutputStream & block_out = *block_out_holder;
+
+    size_t spilled_buckets = 0;
+
+#define M(NAME) \
+    else if (data_variants.type == AggregatedDataVariants::Type::NAME) \
+        spilled_buckets = writeColdBucketsToTemporaryFileImpl(data_variants, *data_variants.NAME, bytes_to_release, block_out);
+
+    if (false) {} // NOLINT
+    APPLY_FOR_VARIANTS_TWO_LEVEL(M)
+#undef M
+    else
+        throw Exception("Unknown aggregated data variant.", ErrorCodes::UNKNOWN_AGGREGATED_DATA_VARIANT);
+
+    /// Selective spill was not worthwhile, the unused temporary file is removed by its holder.
+    if (!spilled_buckets)
+        return false;
+
+    ProfileEvents::increment(ProfileEvents::ExternalAggregationWritePart);
+
+    block_out.writeSuffix();
+    block_out.flush();
+    if (compressed_buf)
+        compressed_buf->next();
+    if (file_buf)
+        file_buf->next();
+
+    double elapsed_seconds = watch.elapsedSeconds();
+    double compressed_bytes;
+    double uncompressed_bytes;
+    if (params.columnar_spill)
+    {
+        const auto & columnar_out = static_cast<const ColumnarSpillBlockOutputStream &>(block_out);
+        compressed_bytes = columnar_out.getCompressedBytes();
+        uncompressed_bytes = columnar_out.getUncompressedBytes();
+    }
+    else
+    {
+        compressed_bytes = file_buf->count();
+        uncompressed_bytes = compressed_buf->count();
+    }
+
+    {
+        std::lock_guard lock(temporary_files.mutex);
+        temporary_files.files.emplace_back(std::move(file));
+        temporary_files.sum_size_uncompressed += uncompressed_bytes;
+        temporary_files.sum_size_compressed += compressed_bytes;
+    }
+
+    ProfileEvents::increment(ProfileEvents::ExternalAggregationCompressedBytes, compressed_bytes);
+    ProfileEvents::increment(ProfileEvents::ExternalAggregationUncompressedBytes, uncompressed_bytes);
+
+    LOG_DEBUG(log,
+        "Written {} cold buckets into temporary file {} in {:.3f} sec., {} uncompressed, {} compressed.",
+        spilled_buckets,
+        path,
+        elapsed_seconds,
+        ReadableSize(uncompressed_bytes),
+        ReadableSize(compressed_bytes));
+
+    return true;
+}
+
+
+template <typename Method>
+size_t Aggregator::writeColdBucketsToTemporaryFileImpl(
+    AggregatedDataVariants & data_variants,
+    Method & method,
+    Int64 bytes_to_release,
+    IBlockOutputStream & out) const
+{
+    /// Exact per-bucket sizes are available from the sub-tables, so no cardinality
+    /// sketch is needed to rank the buckets. Spilling the largest buckets first
+    /// releases the requested amount with the fewest spilled buckets, which keeps
+    /// the most buckets aggregating in memory under a skewed key distribution.
+    std::vector<std::pair<size_t, size_t>> buckets_by_size;
+    buckets_by_size.reserve(Method::Data::NUM_BUCKETS);
+    for (size_t bucket = 0; bucket < Method::Data::NUM_BUCKETS; ++bucket)
+    {
+        const auto & table = method.data.impls[bucket];
+        if (!table.size())
+            continue;
+        buckets_by_size.emplace_back(table.getBufferSizeInBytes() + table.size() * total_size_of_aggregate_states, bucket);
+    }
+    std::sort(
+        buckets_by_size.begin(),
+        buckets_by_size.end(),
+        [](const auto & lhs, const auto & rhs) { return lhs.first > rhs.first; });
+
+    size_t buckets_to_spill = 0;
+    Int64 released = 0;
+    for (const auto & [bucket_bytes, bucket] : buckets_by_size)
+    {
+        if (released >= bytes_to_release)
+            break;
+        released += bucket_bytes;
+        ++buckets_to_spill;
+    }
+
+    /// When almost nothing would stay resident a full flush is strictly better:
+    /// it also swaps the state arenas, which selective spill has to keep alive
+    /// because the retained states live in them.
+    if (!buckets_to_spill || buckets_to_spill * 4 >= buckets_by_size.size() * 3)
+        return 0;
+
+    for (size_t i = 0; i < buckets_to_spill; ++i)
+    {
+        size_t bucket = buckets_by_size[i].second;
+        Block block = convertOneBucketToBlock(data_variants, method, data_variants.aggregates_pool, false, bucket);
+        out.write(block);
+
+        /// The written block took ownership of this bucket's aggregate states and
+        /// destroys them on release; drop the sub-table so neither the following
+        /// inserts nor the variants destructor ever touch them again.
+        method.data.impls[bucket].clearAndShrink();
+    }
+
+    return buckets_to_spill;
+}
+
+
 bool Aggregator::checkLimits(size_t result_size, bool & no_more_keys) const
 {
     if (!no_more_keys && params.max_rows_to_group_by && result_size > params.max_rows_to_group_by)
@@ -2745,7 +2932,13 @@ bool Aggregator::mergeOnBlock(Block block, AggregatedDataVariants & result, bool
         if (!enoughSpaceInDirectory(tmp_path, size))
             throw Exception("Not enough space for external aggregation in " + tmp_path, ErrorCodes::NOT_ENOUGH_SPACE);
 
-        writeToTemporaryFile(result, tmp_path);
+        /// Try to release memory down to half of the threshold by spilling only the
+        /// largest buckets, so the hot buckets of a skewed distribution keep
+        /// aggregating in memory and the merge stage reads fewer spilled runs.
+        if (!params.enable_selective_spill
+            || !writeColdBucketsToTemporaryFile(
+                result, current_memory_usage - static_cast<Int64>(params.max_bytes_before_external_group_by / 2), tmp_path))
+            writeToTemporaryFile(result, tmp_path);
     }
 
     return true;
@@ -937,6 +937,14 @@ public:
         /// Settings to flush temporary data to the filesystem (external aggregation).
         const size_t max_bytes_before_external_group_by;        /// 0 - do not use external aggregation.
 
+        /// Spill only the largest buckets of the two-level hash table when external
+        /// aggregation triggers, keeping hot buckets aggregating in memory.
+        bool enable_selective_spill = false;
+
+        /// Write temporary files in the mark-indexed columnar spill format instead
+        /// of row-oriented native streams (see DataStreams/ColumnarSpillFile.h).
+        bool columnar_spill = false;
+
         /// Return empty result when aggregating without keys on empty set.
         bool empty_result_for_aggregation_by_empty_set;
 
@@ -1086,6 +1094,13 @@ public:
     void writeToTemporaryFile(AggregatedDataVariants & data_variants, const String & tmp_path) const;
     void writeToTemporaryFile(AggregatedDataVariants & data_variants) const;
 
+    /** Flush only the largest buckets of a two-level table to disk until bytes_to_release
+      * is projected to be released, leaving the remaining buckets aggregating in memory.
+      * Returns false when too few buckets would stay resident, the caller should then
+      * fall back to writeToTemporaryFile which also swaps the state arenas.
+      */
+    bool writeColdBucketsToTemporaryFile(AggregatedDataVariants & data_variants, Int64 bytes_to_release, const String & tmp_path) const;
+
     bool hasTemporaryFiles() const { return !temporary_files.empty(); }
 
     struct TemporaryFiles
@@ -1223,6 +1238,13 @@ private:
         Method & method,
         IBlockOutputStream & out) const;
 
+    template <typename Method>
+    size_t writeColdBucketsToTemporaryFileImpl(
+        AggregatedDataVariants & data_variants,
+        Method & method,
+        Int64 bytes_to_release,
+        IBlockOutputStream & out) const;
+
     /// Merge NULL key data from hash table `src` into `dst`.
     template <typename Method, typename Table>
     void mergeDataNullKey(
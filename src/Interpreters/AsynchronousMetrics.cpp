@@ -554,7 +554,12 @@ void AsynchronousMetrics::update(std::chrono::system_clock::time_point update_ti
         {
             auto part_cache_metrics = part_cache_manager->dumpPartCache();
             new_values["CnchPartCachePartitions"] = part_cache_metrics.first;
-            new_values["CnchPartCacheParts"] = part_cache_metrics.second;            
+            new_values["CnchPartCacheParts"] = part_cache_metrics.second;
+
+            auto audit_result = part_cache_manager->getCacheAuditResult();
+            new_values["CnchPartCacheAuditCheckedPartitions"] = audit_result.checked_partitions;
+            new_values["CnchPartCacheAuditStalePartitions"] = audit_result.stale_partitions;
+            new_values["CnchPartCacheAuditMaxStalenessSeconds"] = audit_result.max_staleness_seconds;
         }
     }
 
@@ -31,6 +31,7 @@
 #include "common/types.h"
 #include <CloudServices/ReclusteringManagerThread.h>
 #include <CloudServices/CnchMergeMutateThread.h>
+#include <Common/CacheGovernor.h>
 #include <Common/DNSResolver.h>
 #include <Common/Macros.h>
 #include <Common/escapeForFileName.h>
@@ -378,6 +379,9 @@ struct ContextSharedPart
     mutable ChecksumsCachePtr checksums_cache;
     /// Cache of primary indexes.
     mutable PrimaryIndexCachePtr primary_index_cache;
+    /// Rebalances budgets between the caches above; declared after them so that
+    /// its background thread stops before the caches it references are destroyed.
+    mutable CacheGovernorPtr cache_governor;
 
     mutable ServiceDiscoveryClientPtr sd;
     mutable PartCacheManagerPtr cache_manager;           /// Manage cache of parts for cnch tables.
@@ -1907,6 +1911,25 @@ void Context::dropPrimaryIndexCache() const
         shared->primary_index_cache->reset();
 }
 
+void Context::startCacheGovernor(UInt64 interval_seconds)
+{
+    auto lock = getLock();
+
+    if (shared->cache_governor)
+        throw Exception("Cache governor has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->cache_governor = std::make_shared<CacheGovernor>();
+    if (shared->mark_cache)
+        shared->cache_governor->registerCache("mark_cache", shared->mark_cache);
+    if (shared->primary_index_cache)
+        shared->cache_governor->registerCache("primary_index_cache", shared->primary_index_cache);
+    if (shared->uncompressed_cache)
+        shared->cache_governor->registerCache("uncompressed_cache", shared->uncompressed_cache);
+    if (shared->checksums_cache)
+        shared->cache_governor->registerCache("checksums_cache", shared->checksums_cache);
+    shared->cache_governor->start(interval_seconds);
+}
+
 void Context::setQueryCache(size_t cache_size_in_bytes)
 {
     auto lock = getLock();
@@ -2864,6 +2887,28 @@ std::shared_ptr<ServerPartLog> Context::getServerPartLog() const
     return shared->system_logs->server_part_log;
 }
 
+
+std::shared_ptr<ServerMergeDecisionLog> Context::getServerMergeDecisionLog() const
+{
+    auto lock = getLock();
+
+    if (!shared->system_logs || !shared->system_logs->server_merge_decision_log)
+        return {};
+
+    return shared->system_logs->server_merge_decision_log;
+}
+
+
+std::shared_ptr<ResourceGroupAdmissionLog> Context::getResourceGroupAdmissionLog() const
+{
+    auto lock = getLock();
+
+    if (!shared->system_logs || !shared->system_logs->resource_group_admission_log)
+        return {};
+
+    return shared->system_logs->resource_group_admission_log;
+}
+
 void Context::initializeCnchSystemLogs()
 {
     if ((shared->server_type != ServerType::cnch_server) &&
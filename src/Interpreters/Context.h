@@ -119,6 +119,8 @@ class QueryExchangeLog;
 class PartLog;
 class PartMergeLog;
 class ServerPartLog;
+class ServerMergeDecisionLog;
+class ResourceGroupAdmissionLog;
 class TextLog;
 class TraceLog;
 class MetricLog;
@@ -952,6 +954,11 @@ public:
     std::shared_ptr<PrimaryIndexCache> getPrimaryIndexCache() const;
     void dropPrimaryIndexCache() const;
 
+    /// Start the governor that rebalances budgets between the mark, primary index,
+    /// uncompressed and checksums caches from their observed hit rates.
+    /// Must be called after the caches are created. This can be done only once.
+    void startCacheGovernor(UInt64 interval_seconds);
+
     /// Create a cache of queries of specified size. This can be done only once.
     void setQueryCache(size_t cache_size_in_bytes);
     std::shared_ptr<QueryCache> getQueryCache() const;
@@ -1047,6 +1054,8 @@ public:
     std::shared_ptr<PartLog> getPartLog(const String & part_database) const;
     std::shared_ptr<PartMergeLog> getPartMergeLog() const;
     std::shared_ptr<ServerPartLog> getServerPartLog() const;
+    std::shared_ptr<ServerMergeDecisionLog> getServerMergeDecisionLog() const;
+    std::shared_ptr<ResourceGroupAdmissionLog> getResourceGroupAdmissionLog() const;
 
     void initializeCnchSystemLogs();
     std::shared_ptr<QueryMetricLog> getQueryMetricsLog() const;
@@ -0,0 +1,58 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Interpreters/DistributedStages/AdaptiveQueryFeedback.h>
+
+namespace DB
+{
+
+AdaptiveQueryFeedback & AdaptiveQueryFeedback::getInstance()
+{
+    static AdaptiveQueryFeedback instance;
+    return instance;
+}
+
+void AdaptiveQueryFeedback::registerQuery(const String & query_id, UInt64 query_hash)
+{
+    std::lock_guard lock(mutex);
+    running_query_hashes[query_id] = query_hash;
+}
+
+void AdaptiveQueryFeedback::unregisterQuery(const String & query_id)
+{
+    std::lock_guard lock(mutex);
+    running_query_hashes.erase(query_id);
+}
+
+void AdaptiveQueryFeedback::recordBroadcastOverflow(const String & query_id, UInt64 rows)
+{
+    std::lock_guard lock(mutex);
+    auto it = running_query_hashes.find(query_id);
+    if (it == running_query_hashes.end())
+        return;
+    if (broadcast_overflow_rows.size() >= max_entries)
+        broadcast_overflow_rows.clear();
+    UInt64 & recorded = broadcast_overflow_rows[it->second];
+    recorded = std::max(recorded, rows);
+}
+
+UInt64 AdaptiveQueryFeedback::getBroadcastOverflowRows(UInt64 query_hash)
+{
+    std::lock_guard lock(mutex);
+    auto it = broadcast_overflow_rows.find(query_hash);
+    return it == broadcast_overflow_rows.end() ? 0 : it->second;
+}
+
+}
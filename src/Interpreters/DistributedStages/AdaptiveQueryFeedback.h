@@ -0,0 +1,59 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <common/types.h>
+#include <Core/Types.h>
+
+namespace DB
+{
+
+/// Runtime feedback from plan segment execution to the optimizer, enabled by
+/// enable_adaptive_replan. Plan segments are dispatched all at once and stream
+/// through exchanges, so a mis-planned query cannot be re-planned in flight;
+/// instead the coordinator records queries whose broadcast build side turned
+/// out far larger than estimated, and the next execution of the same query
+/// (keyed by the AST tree hash) is planned without broadcast joins.
+class AdaptiveQueryFeedback
+{
+public:
+    static AdaptiveQueryFeedback & getInstance();
+
+    /// Remember the query hash of a running query so that segment status reports,
+    /// which only carry the query id, can be attributed to the query.
+    void registerQuery(const String & query_id, UInt64 query_hash);
+    void unregisterQuery(const String & query_id);
+
+    /// Record that a segment of the query pushed `rows` into a broadcast exchange
+    /// while exceeding the planner's broadcast threshold.
+    void recordBroadcastOverflow(const String & query_id, UInt64 rows);
+
+    /// Largest broadcast overflow ever observed for the query, 0 if none.
+    UInt64 getBroadcastOverflowRows(UInt64 query_hash);
+
+private:
+    /// Overflow entries are never aged out individually; the map is simply
+    /// dropped when it grows past the cap, losing at worst one re-plan hint.
+    static constexpr size_t max_entries = 100000;
+
+    std::mutex mutex;
+    std::unordered_map<String, UInt64> running_query_hashes;
+    std::unordered_map<UInt64, UInt64> broadcast_overflow_rows;
+};
+
+}
@@ -15,18 +15,124 @@
 
 #include <Interpreters/DistributedStages/ExchangeStepVisitor.h>
 #include <Interpreters/DistributedStages/ExchangeMode.h>
+#include <Analyzers/ASTEquals.h>
+#include <Catalog/Catalog.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/IJoin.h>
 #include <Interpreters/TableJoin.h>
+#include <Optimizer/ExpressionRewriter.h>
+#include <Optimizer/SymbolsExtractor.h>
+#include <Parsers/ASTLiteral.h>
 #include <QueryPlan/ExchangeStep.h>
 #include <QueryPlan/AggregatingStep.h>
+#include <QueryPlan/ExpressionStep.h>
+#include <QueryPlan/FilterStep.h>
 #include <QueryPlan/MergingAggregatedStep.h>
 #include <Processors/Transforms/AggregatingTransform.h>
 #include <QueryPlan/JoinStep.h>
+#include <QueryPlan/TableScanStep.h>
 
 namespace DB
 {
 
+namespace
+{
+    /// Bucket distribution of one join input: the CLUSTER BY columns in definition
+    /// order (translated through the scan's aliases), the bucket count, and the
+    /// cluster-by definition with identifiers rewritten to ordinals for comparison
+    /// across tables with different column names.
+    struct BucketDistribution
+    {
+        Names cluster_columns;
+        UInt64 buckets = 0;
+        ASTPtr sharding_expr;
+    };
+
+    std::optional<BucketDistribution> deriveBucketDistribution(QueryPlan::Node * node, const ContextPtr & context)
+    {
+        /// look through steps that neither redistribute rows nor rename the scan's
+        /// columns; anything else disqualifies the subtree
+        if (dynamic_cast<FilterStep *>(node->step.get()) || dynamic_cast<ExpressionStep *>(node->step.get()))
+            return node->children.size() == 1 ? deriveBucketDistribution(node->children[0], context) : std::nullopt;
+
+        const auto * scan = dynamic_cast<TableScanStep *>(node->step.get());
+        if (!scan)
+            return std::nullopt;
+
+        const auto & storage = scan->getStorage();
+        if (!storage->isBucketTable())
+            return std::nullopt;
+
+        auto metadata = storage->getInMemoryMetadataPtr();
+        BucketDistribution distribution;
+        distribution.cluster_columns = metadata->getColumnsForClusterByKey();
+        if (distribution.cluster_columns.empty())
+            return std::nullopt;
+
+        /// tables mid-recluster still carry unaligned parts, see isCnchBucketTable
+        if (!context->getCnchCatalog()->isTableClustered(storage->getStorageUUID()))
+            return std::nullopt;
+
+        NameToNameMap alias;
+        for (const auto & item : scan->getColumnAlias())
+            alias.emplace(item.first, item.second);
+        for (auto & column : distribution.cluster_columns)
+        {
+            auto it = alias.find(column);
+            if (it == alias.end())
+                return std::nullopt;
+            column = it->second;
+        }
+
+        auto cluster_by_ast = metadata->getClusterByKeyAST();
+        auto symbols = SymbolsExtractor::extract(cluster_by_ast);
+        ConstASTMap expression_map;
+        size_t index = 0;
+        for (const auto & symbol : symbols)
+        {
+            ASTPtr name = std::make_shared<ASTIdentifier>(symbol);
+            ASTPtr id = std::make_shared<ASTLiteral>(Field(index));
+            expression_map[name] = id;
+            index++;
+        }
+        distribution.sharding_expr = ExpressionRewriter::rewrite(cluster_by_ast, expression_map);
+        distribution.buckets = static_cast<UInt64>(metadata->getBucketNumberFromClusterByKey());
+        return distribution;
+    }
+
+    /// A join is colocated when both inputs read identically clustered bucket tables
+    /// and the join condition equates the cluster-by columns pairwise in definition
+    /// order. Bucket-sticky part assignment (assignCnchPartsForBucketTable) then
+    /// guarantees matching buckets land on the same worker, so no repartition is
+    /// needed.
+    bool isColocatedBucketJoin(QueryPlan::Node * node, const Names & left_keys, const Names & right_keys, const ContextPtr & context)
+    {
+        if (context->getServerType() != ServerType::cnch_server)
+            return false;
+
+        auto left = deriveBucketDistribution(node->children[0], context);
+        if (!left)
+            return false;
+        auto right = deriveBucketDistribution(node->children[1], context);
+        if (!right)
+            return false;
+
+        if (left->buckets != right->buckets || left->cluster_columns.size() != right->cluster_columns.size()
+            || !ASTEquality::compareTree(left->sharding_expr, right->sharding_expr))
+            return false;
+
+        for (size_t i = 0; i < left->cluster_columns.size(); ++i)
+        {
+            bool joined = false;
+            for (size_t j = 0; j < left_keys.size() && !joined; ++j)
+                joined = left_keys[j] == left->cluster_columns[i] && right_keys[j] == right->cluster_columns[i];
+            if (!joined)
+                return false;
+        }
+        return true;
+    }
+}
+
 ExchangeStepResult ExchangeStepVisitor::visitNode(QueryPlan::Node * node, ExchangeStepContext & exchange_context)
 {
     for (size_t i = 0; i < node->children.size(); ++i)
@@ -131,6 +237,13 @@ ExchangeStepResult ExchangeStepVisitor::visitJoinNode(QueryPlan::Node * node, Ex
         add_exchange(left_stream, 0, ExchangeMode::LOCAL_NO_NEED_REPARTITION, Names{});
         add_exchange(right_stream, 1, ExchangeMode::BROADCAST, Names{});
     }
+    else if (
+        exchange_context.context->getSettingsRef().enable_bucket_table_optimize
+        && isColocatedBucketJoin(node, left_keys, right_keys, exchange_context.context))
+    {
+        add_exchange(left_stream, 0, ExchangeMode::LOCAL_NO_NEED_REPARTITION, Names{});
+        add_exchange(right_stream, 1, ExchangeMode::LOCAL_NO_NEED_REPARTITION, Names{});
+    }
     else
     {
         add_exchange(left_stream, 0, ExchangeMode::REPARTITION, left_keys);
@@ -37,27 +37,51 @@
 #include <Processors/Exchange/ExchangeOptions.h>
 #include <Processors/Exchange/ExchangeSource.h>
 #include <Processors/Exchange/ExchangeUtils.h>
+#include <Processors/Exchange/IExchangeSink.h>
 #include <Processors/Exchange/LoadBalancedExchangeSink.h>
 #include <Processors/Exchange/MultiPartitionExchangeSink.h>
 #include <Processors/Exchange/RepartitionTransform.h>
 #include <Processors/Exchange/SinglePartitionExchangeSink.h>
 #include <Processors/Executors/PipelineExecutor.h>
+#include <Processors/Sources/SourceFromQueryCache.h>
 #include <Processors/Transforms/BufferedCopyTransform.h>
 #include <Processors/Transforms/CopyTransform.h>
+#include <Processors/Transforms/QueryCacheTransform.h>
 #include <Processors/ResizeProcessor.h>
+#include <Interpreters/DatabaseCatalog.h>
+#include <Interpreters/OpenTelemetrySpanLog.h>
+#include <Functions/IFunction.h>
+#include <IO/WriteBufferFromString.h>
+#include <Storages/MergeTree/MergeTreeData.h>
+#include <QueryPlan/ExpressionStep.h>
+#include <QueryPlan/FilterStep.h>
 #include <Protos/plan_segment_manager.pb.h>
 #include <QueryPlan/BuildQueryPipelineSettings.h>
 #include <QueryPlan/GraphvizPrinter.h>
 #include <QueryPlan/Optimizations/QueryPlanOptimizationSettings.h>
 #include <QueryPlan/QueryPlan.h>
 #include <Common/Brpc/BrpcChannelPoolOptions.h>
+#include <Common/CurrentMetrics.h>
 #include <Common/CurrentThread.h>
+#include <Common/getNumberOfPhysicalCPUCores.h>
 #include <Common/Exception.h>
+#include <Common/Stopwatch.h>
 #include <Common/ThreadStatus.h>
 #include <common/defines.h>
 #include <common/logger_useful.h>
 #include <common/types.h>
 
+namespace ProfileEvents
+{
+    extern const Event IntermediateResultCacheHits;
+    extern const Event IntermediateResultCacheMisses;
+}
+
+namespace CurrentMetrics
+{
+    extern const Metric QueryThread;
+}
+
 namespace DB
 {
 namespace ErrorCodes
@@ -91,8 +115,8 @@ RuntimeSegmentsStatus PlanSegmentExecutor::execute(ThreadGroupStatusPtr thread_g
     LOG_DEBUG(logger, "execute PlanSegment:\n" + plan_segment->toString());
     try
     {
-        doExecute(std::move(thread_group));
         RuntimeSegmentsStatus status(plan_segment->getQueryId(), plan_segment->getPlanSegmentId(), true, false, "execute success", 0);
+        doExecute(std::move(thread_group), status);
         sendSegmentStatus(status);
         return status;
     }
@@ -140,8 +164,9 @@ BlockIO PlanSegmentExecutor::lazyExecute(bool /*add_output_processors*/)
     return res;
 }
 
-void PlanSegmentExecutor::doExecute(ThreadGroupStatusPtr thread_group)
+void PlanSegmentExecutor::doExecute(ThreadGroupStatusPtr thread_group, RuntimeSegmentsStatus & status)
 {
+    Stopwatch execution_watch;
     std::optional<CurrentThread::QueryScope> query_scope;
 
     if (!thread_group)
@@ -169,11 +194,35 @@ void PlanSegmentExecutor::doExecute(ThreadGroupStatusPtr thread_group)
         CurrentThread::attachTo(thread_group);
     }
 
+    /// Attribute profiler samples of this thread and of the pipeline threads spawned
+    /// below to this plan segment (segment_id column of system.trace_log).
+    if (auto current_group = CurrentThread::getGroup())
+    {
+        current_group->plan_segment_id = plan_segment->getPlanSegmentId();
+        CurrentThread::get().plan_segment_id = plan_segment->getPlanSegmentId();
+    }
+
     PlanSegmentProcessList::EntryPtr process_plan_segment_entry = context->getPlanSegmentProcessList().insert(*plan_segment, context);
 
     QueryPipelinePtr pipeline;
     BroadcastSenderPtrs senders;
+
+    /// Phase spans go to system.opentelemetry_span_log under the trace id propagated
+    /// from the coordinator, so the timeline of a distributed query can be stitched
+    /// together across hosts. The thread span logged on detach covers the whole
+    /// segment; these children split it into startup and execution, and the dispatch
+    /// wait attribute exposes how long the segment sat between query start on the
+    /// coordinator and pipeline construction here.
+    std::optional<OpenTelemetrySpanHolder> phase_span;
+    phase_span.emplace("PlanSegmentExecutor::buildPipeline");
+    phase_span->attribute_names.push_back("clickhouse.plan_segment_id");
+    phase_span->attribute_values.push_back(plan_segment->getPlanSegmentId());
+    phase_span->attribute_names.push_back("clickhouse.segment_dispatch_wait_us");
+    phase_span->attribute_values.push_back(
+        phase_span->start_time_us - UInt64(context->getClientInfo().initial_query_start_time_microseconds.value));
+
     buildPipeline(pipeline, senders);
+    phase_span.reset();
 
     QueryStatus * query_status = &process_plan_segment_entry->get();
     context->setProcessListElement(query_status);
@@ -186,13 +235,45 @@ void PlanSegmentExecutor::doExecute(ThreadGroupStatusPtr thread_group)
         pipeline->setMaxThreads(max_threads);
     size_t num_threads = pipeline->getNumThreads();
 
+    size_t thread_budget = context->getSettingsRef().max_threads_per_plan_segment_group;
+    if (thread_budget)
+    {
+        /// Without a budget every segment instance of the query spawns its own
+        /// full thread allotment, so concurrent instances oversubscribe the worker
+        /// by their count. Allot each instance a share of twice the budget: the
+        /// overcommit keeps every instance runnable while instances blocked on
+        /// exchange sleep, letting the kernel migrate their cores to whichever
+        /// instance has runnable work
+        size_t running_segments = std::max<size_t>(context->getPlanSegmentProcessList().getGroupSegmentCount(plan_segment->getQueryId()), 1);
+        num_threads = std::min(num_threads, std::max<size_t>(2, thread_budget * 2 / running_segments));
+    }
+
+    double oversubscription_ratio = context->getSettingsRef().plan_segment_cpu_oversubscription_ratio;
+    if (oversubscription_ratio > 0)
+    {
+        /// Load-adaptive cap across queries: when many segments stack up their static
+        /// max_threads, the worker burns cpu on context switching. Size this segment
+        /// against the threads that are actually alive right now, so that the worker
+        /// total stays near cores * ratio. A floor of 2 keeps segments progressing
+        /// under overload; a drained worker gives new segments full parallelism back.
+        size_t target_total = std::max<size_t>(2, getNumberOfPhysicalCPUCores() * oversubscription_ratio);
+        size_t running_threads = CurrentMetrics::values[CurrentMetrics::QueryThread].load(std::memory_order_relaxed);
+        size_t available = target_total > running_threads ? target_total - running_threads : 0;
+        num_threads = std::max<size_t>(2, std::min(num_threads, available));
+    }
+
     LOG_DEBUG(
         logger,
         "Runing plansegment id {}, segment: {} pipeline with {} threads",
         plan_segment->getQueryId(),
         plan_segment->getPlanSegmentId(),
         num_threads);
+
+    phase_span.emplace("PlanSegmentExecutor::executePipeline");
+    phase_span->attribute_names.push_back("clickhouse.plan_segment_id");
+    phase_span->attribute_values.push_back(plan_segment->getPlanSegmentId());
     pipeline_executor->execute(num_threads);
+    phase_span.reset();
     GraphvizPrinter::printPipeline(
         pipeline_executor->getProcessors(),
         pipeline_executor->getExecutingGraph(),
@@ -201,6 +282,19 @@ void PlanSegmentExecutor::doExecute(ThreadGroupStatusPtr thread_group)
         extractExchangeStatusHostPort(plan_segment->getCurrentAddress()));
     for (const auto & sender : senders)
         sender->finish(BroadcastStatusCode::ALL_SENDERS_DONE, "Upstream pipeline finished");
+
+    /// Report the rows actually pushed into the output exchanges so the coordinator
+    /// can compare them with the optimizer's estimates.
+    for (const auto & processor : pipeline_executor->getProcessors())
+    {
+        if (dynamic_cast<const IExchangeSink *>(processor.get()))
+        {
+            auto stats = processor->getProcessorDataStats();
+            status.output_rows += stats.input_rows;
+            status.output_bytes += stats.input_bytes;
+        }
+    }
+    status.execution_time_ms = execution_watch.elapsedMilliseconds();
 }
 
 QueryPipelinePtr PlanSegmentExecutor::buildPipeline()
@@ -254,10 +348,36 @@ void PlanSegmentExecutor::buildPipeline(QueryPipelinePtr & pipeline, BroadcastSe
         senders_list.emplace_back(std::move(current_exchange_senders));
     }
 
-    pipeline = plan_segment->getQueryPlan().buildQueryPipeline(
-        QueryPlanOptimizationSettings::fromContext(context),
-        BuildQueryPipelineSettings::fromPlanSegment(plan_segment.get(), context)
-    );
+    initSegmentResultCache();
+
+    if (cached_segment_result)
+    {
+        /// The whole sub-plan is replaced by a replay of its cached result;
+        /// only the exchange sinks below are attached to it.
+        pipeline = std::make_unique<QueryPipeline>();
+        pipeline->init(Pipe(std::make_shared<SourceFromQueryCache>(
+            plan_segment->getPlanSegmentOutput()->getHeader(), cached_segment_result)));
+    }
+    else
+    {
+        pipeline = plan_segment->getQueryPlan().buildQueryPipeline(
+            QueryPlanOptimizationSettings::fromContext(context),
+            BuildQueryPipelineSettings::fromPlanSegment(plan_segment.get(), context)
+        );
+
+        if (segment_result_to_store)
+        {
+            pipeline->addSimpleTransform([&](const Block & header, QueryPipeline::StreamType stream_type) -> ProcessorPtr
+            {
+                if (stream_type != QueryPipeline::StreamType::Main)
+                    return nullptr;
+
+                return std::make_shared<QueryCacheTransform>(
+                    header, segment_result_cache, segment_result_key, segment_result_to_store,
+                    segment_ref_tables, segment_latest_update_time);
+            });
+        }
+    }
 
     registerAllExchangeReceivers(*pipeline, options.exhcange_timeout_ms / 3);
 
@@ -458,6 +578,10 @@ void PlanSegmentExecutor::buildPipeline(QueryPipelinePtr & pipeline, BroadcastSe
 
 void PlanSegmentExecutor::registerAllExchangeReceivers(const QueryPipeline & pipeline, UInt32 register_timeout_ms)
 {
+    /// Time spent waiting for upstream senders to come up — the exchange-wait part
+    /// of segment startup.
+    OpenTelemetrySpanHolder span("PlanSegmentExecutor::registerAllExchangeReceivers");
+
     const Processors & procesors = pipeline.getProcessors();
     std::vector<AsyncRegisterResult> async_results;
     std::vector<LocalBroadcastChannel *> local_receivers;
@@ -526,6 +650,89 @@ void PlanSegmentExecutor::registerAllExchangeReceivers(const QueryPipeline & pip
     }
 }
 
+void PlanSegmentExecutor::initSegmentResultCache()
+{
+    if (!context->getSettingsRef().enable_intermediate_result_cache)
+        return;
+
+    segment_result_cache = context->getQueryCache();
+    if (!segment_result_cache)
+        return;
+
+    /// Only leaf segments qualify: their result is a pure function of the tables they
+    /// scan, so table update times fully describe freshness. Segments with exchange
+    /// inputs depend on upstream instances whose state we cannot fingerprint here.
+    const auto & inputs = plan_segment->getPlanSegmentInputs();
+    if (inputs.empty())
+        return;
+
+    /// Replayed chunks do not keep the original order.
+    for (const auto & output : plan_segment_outputs)
+        if (output->needKeepOrder())
+            return;
+
+    for (const auto & input : inputs)
+    {
+        if (input->getPlanSegmentType() != PlanSegmentType::SOURCE)
+            return;
+
+        auto storage_id = input->getStorageID();
+        if (!storage_id || storage_id->database_name == "system")
+            return;
+
+        auto storage = DatabaseCatalog::instance().tryGetTable(*storage_id, context);
+        if (!storage || !dynamic_cast<MergeTreeData *>(storage.get()))
+            return;
+
+        segment_ref_tables.insert(storage_id->database_name + "." + storage_id->table_name);
+        segment_latest_update_time = std::max(segment_latest_update_time, storage->getTableUpdateTime());
+    }
+
+    /// Non-deterministic scalar functions make the result irreproducible,
+    /// same rule as QueryCacheStep applies on the full query.
+    for (const auto & node : plan_segment->getQueryPlan().getNodes())
+    {
+        ActionsDAGPtr actions;
+        if (auto * expression = dynamic_cast<ExpressionStep *>(node.step.get()))
+            actions = expression->getExpression();
+        else if (auto * filter = dynamic_cast<FilterStep *>(node.step.get()))
+            actions = filter->getExpression();
+
+        if (!actions)
+            continue;
+
+        for (const auto & action : actions->getNodes())
+            if (action.function_base && !action.function_base->isDeterministic())
+                return;
+    }
+
+    /// The fingerprint covers the serialized sub-plan and the slice of data this
+    /// instance processes: every instance scans its own share of parts, so the
+    /// entry is scoped to (plan, parallel size, parallel indexes).
+    WriteBufferFromOwnString plan_buf;
+    plan_segment->getQueryPlan().serialize(plan_buf);
+    const String & plan_repr = plan_buf.str();
+
+    SipHash hash;
+    hash.update(plan_repr.data(), plan_repr.size());
+    hash.update(plan_segment->getParallelSize());
+    for (const auto & input : inputs)
+        hash.update(input->getParallelIndex());
+    hash.get128(segment_result_key);
+
+    auto result = segment_result_cache->get(segment_result_key);
+    if (result && segment_latest_update_time <= result->update_time)
+    {
+        cached_segment_result = result->clone();
+        ProfileEvents::increment(ProfileEvents::IntermediateResultCacheHits);
+    }
+    else
+    {
+        segment_result_to_store = std::make_shared<QueryResult>();
+        ProfileEvents::increment(ProfileEvents::IntermediateResultCacheMisses);
+    }
+}
+
 Processors PlanSegmentExecutor::buildRepartitionExchangeSink(
     BroadcastSenderPtrs & senders, bool keep_order, size_t output_index, const Block &header, OutputPortRawPtrs &ports)
 {
@@ -643,7 +850,7 @@ void PlanSegmentExecutor::sendSegmentStatus(const RuntimeSegmentsStatus & status
         auto address = extractExchangeStatusHostPort(plan_segment->getCoordinatorAddress());
 
         std::shared_ptr<RpcClient> rpc_client
-            = RpcChannelPool::getInstance().getClient(address, BrpcChannelPoolOptions::DEFAULT_CONFIG_KEY, true);
+            = RpcChannelPool::getInstance().getClient(address, BrpcChannelPoolOptions::CONTROL_DEFAULT_CONFIG_KEY, true);
         Protos::PlanSegmentManagerService_Stub manager(&rpc_client->getChannel());
         brpc::Controller cntl;
         Protos::SendPlanSegmentStatusRequest request;
@@ -654,6 +861,9 @@ void PlanSegmentExecutor::sendSegmentStatus(const RuntimeSegmentsStatus & status
         request.set_is_canceled(status.is_canceled);
         request.set_code(status.code);
         request.set_message(status.message);
+        request.set_output_rows(status.output_rows);
+        request.set_output_bytes(status.output_bytes);
+        request.set_execution_time_ms(status.execution_time_ms);
 
         manager.sendPlanSegmentStatus(&cntl, &request, &response, nullptr);
         rpc_client->assertController(cntl);
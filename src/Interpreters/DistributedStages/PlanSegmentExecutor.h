@@ -22,6 +22,7 @@
 #include <Processors/Exchange/DataTrans/DataTrans_fwd.h>
 #include <Processors/Exchange/ExchangeOptions.h>
 #include <Processors/Executors/PipelineExecutor.h>
+#include <Processors/QueryCache.h>
 #include <Processors/QueryPipeline.h>
 #include <boost/core/noncopyable.hpp>
 #include <Poco/Logger.h>
@@ -47,6 +48,11 @@ struct RuntimeSegmentsStatus
     bool is_canceled;
     String message;
     int32_t code;
+    /// Actual rows/bytes the segment pushed into its output exchanges. The coordinator compares
+    /// them with the optimizer's estimates to re-plan subsequent executions of the query.
+    UInt64 output_rows = 0;
+    UInt64 output_bytes = 0;
+    UInt64 execution_time_ms = 0;
 };
 
 class PlanSegmentExecutor : private boost::noncopyable
@@ -61,7 +67,7 @@ public:
     static void registerAllExchangeReceivers(const QueryPipeline & pipeline, UInt32 register_timeout_ms);
 
 protected:
-    void doExecute(std::shared_ptr<ThreadGroupStatus> thread_group);
+    void doExecute(std::shared_ptr<ThreadGroupStatus> thread_group, RuntimeSegmentsStatus & status);
     QueryPipelinePtr buildPipeline();
     void buildPipeline(QueryPipelinePtr & pipeline, BroadcastSenderPtrs & senders);
 
@@ -72,6 +78,16 @@ private:
     ExchangeOptions options;
     Poco::Logger * logger;
 
+    /// Intermediate (sub-plan) result cache state, see initSegmentResultCache().
+    QueryCachePtr segment_result_cache;
+    UInt128 segment_result_key;
+    QueryResultPtr cached_segment_result;
+    QueryResultPtr segment_result_to_store;
+    std::set<String> segment_ref_tables;
+    UInt64 segment_latest_update_time = 0;
+
+    void initSegmentResultCache();
+
     Processors buildRepartitionExchangeSink(BroadcastSenderPtrs & senders, bool keep_order, size_t output_index, const Block &header, OutputPortRawPtrs &ports);
 
     Processors buildBroadcastExchangeSink(BroadcastSenderPtrs & senders, size_t output_index, const Block &header, OutputPortRawPtrs &ports);
@@ -14,7 +14,9 @@
  */
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <Compression/CompressedReadBuffer.h>
 #include <Interpreters/Context_fwd.h>
 #include <Interpreters/DistributedStages/PlanSegmentManagerRpcService.h>
 #include <Interpreters/DistributedStages/executePlanSegment.h>
@@ -30,6 +32,115 @@ namespace DB
 namespace ErrorCodes
 {
     extern const int BRPC_PROTOCOL_VERSION_UNSUPPORT;
+    extern const int LOGICAL_ERROR;
+}
+
+void PlanSegmentManagerRpcService::scheduleExecutePlanSegment(
+    const Protos::ExecutePlanSegmentRequest & request, butil::IOBuf plan_segment_buf)
+{
+    ContextMutablePtr query_context;
+    /// Create session context for worker
+    if (context->getServerType() == ServerType::cnch_worker)
+    {
+        UInt64 txn_id = request.txn_id();
+        auto named_session = context->acquireNamedCnchSession(txn_id, {}, true);
+        query_context = Context::createCopy(named_session->context);
+        query_context->setSessionContext(named_session->context);
+    }
+    else
+    {
+        query_context = Context::createCopy(context);
+    }
+
+    /// TODO: Authentication supports inter-server cluster secret, see https://github.com/ClickHouse/ClickHouse/commit/0159c74f217ec764060c480819e3ccc9d5a99a63
+    Poco::Net::SocketAddress initial_socket_address(request.coordinator_host(), request.coordinator_port());
+    query_context->setUser(request.user(), request.password(), initial_socket_address);
+
+    /// Set client info.
+    ClientInfo & client_info = query_context->getClientInfo();
+    client_info.brpc_protocol_major_version = request.brpc_protocol_major_revision();
+    client_info.brpc_protocol_minor_version = request.brpc_protocol_minor_revision();
+    if (client_info.brpc_protocol_major_version != DBMS_BRPC_PROTOCOL_MAJOR_VERSION)
+        throw Exception(
+            "brpc protocol major version different - current is " + std::to_string(client_info.brpc_protocol_major_version) +
+            "remote is " + std::to_string(DBMS_BRPC_PROTOCOL_MAJOR_VERSION) +
+            ", plan segment is not compatible", ErrorCodes::BRPC_PROTOCOL_VERSION_UNSUPPORT
+        );
+    client_info.query_kind = ClientInfo::QueryKind::SECONDARY_QUERY;
+    client_info.interface = ClientInfo::Interface::BRPC;
+    Decimal64 initial_query_start_time_microseconds {request.initial_query_start_time()};
+    client_info.initial_query_start_time = initial_query_start_time_microseconds / 1000000;
+    client_info.initial_query_start_time_microseconds = initial_query_start_time_microseconds;
+    client_info.initial_user = request.user();
+    client_info.initial_query_id = request.query_id();
+
+    client_info.initial_address = initial_socket_address;
+
+    client_info.current_address = Poco::Net::SocketAddress(request.current_host(), request.current_port());
+
+    /// OpenTelemetry trace context sent by the coordinator (see fillExecutePlanSegmentRequest).
+    if (request.has_open_telemetry_trace_id_low())
+    {
+        UInt128 trace_id;
+        trace_id.items[0] = request.open_telemetry_trace_id_low();
+        trace_id.items[1] = request.open_telemetry_trace_id_high();
+        client_info.client_trace_context.trace_id = UUID(trace_id);
+        client_info.client_trace_context.span_id = request.open_telemetry_span_id();
+        client_info.client_trace_context.tracestate = request.open_telemetry_tracestate();
+        client_info.client_trace_context.trace_flags = static_cast<UInt8>(request.open_telemetry_trace_flags());
+    }
+
+    /// Goes through setCurrentQueryId so query_trace_context is initialized from
+    /// the received client trace context and segment spans join the query's trace.
+    query_context->setCurrentQueryId(request.query_id() + "_" + std::to_string(request.plan_segment_id()));
+
+    /// Prepare settings.
+    SettingsChanges settings_changes;
+    settings_changes.reserve(request.settings_size());
+    for (const auto & [key, value] : request.settings())
+    {
+        settings_changes.push_back({key, value});
+    }
+
+    /// Sets an extra row policy based on `client_info.initial_user`
+    query_context->setInitialRowPolicy();
+
+    /// Quietly clamp to the constraints since it's a secondary query.
+    query_context->clampToSettingsConstraints(settings_changes);
+    query_context->applySettingsChanges(settings_changes);
+
+    /// Disable function name normalization when it's a secondary query, because queries are either
+    /// already normalized on initiator node, or not normalized and should remain unnormalized for
+    /// compatibility.
+    query_context->setSetting("normalize_function_names", Field(0));
+
+    /// Set quota
+    if (!request.has_quota())
+        query_context->setQuotaKey(request.quota());
+
+    if (!query_context->hasQueryContext())
+        query_context->makeQueryContext();
+
+    ThreadFromGlobalPool async_thread([query_context = std::move(query_context),
+                                       plan_segment_buf = std::make_shared<butil::IOBuf>(std::move(plan_segment_buf)),
+                                       compressed = request.compressed_plan_segment()]() {
+        try
+        {
+            /// Plan segment Deserialization can't run in bthread since checkStackSize method is not compatible with all user-space lightweight threads that manually allocated stacks.
+            ReadBufferFromBrpcBuf attachment_buf(*plan_segment_buf);
+            std::optional<CompressedReadBuffer> decompressed_buf;
+            if (compressed)
+                decompressed_buf.emplace(attachment_buf);
+            ReadBuffer & plan_segment_read_buf = compressed ? static_cast<ReadBuffer &>(*decompressed_buf) : attachment_buf;
+            auto plan_segment = PlanSegment::deserializePlanSegment(plan_segment_read_buf, query_context);
+            executePlanSegmentInternal(std::move(plan_segment), std::move(query_context), false);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(__PRETTY_FUNCTION__);
+        }
+    });
+    async_thread.detach();
 }
 
 void PlanSegmentManagerRpcService::executeQuery(
@@ -42,95 +153,48 @@ void PlanSegmentManagerRpcService::executeQuery(
     brpc::Controller * cntl = static_cast<brpc::Controller *>(controller);
     try
     {
-        ContextMutablePtr query_context;
-        /// Create session context for worker
-        if (context->getServerType() == ServerType::cnch_worker)
-        {
-            UInt64 txn_id = request->txn_id();
-            auto named_session = context->acquireNamedCnchSession(txn_id, {}, true);
-            query_context = Context::createCopy(named_session->context);
-            query_context->setSessionContext(named_session->context);
-        }
-        else
-        {
-            query_context = Context::createCopy(context);
-        }
-
-        /// TODO: Authentication supports inter-server cluster secret, see https://github.com/ClickHouse/ClickHouse/commit/0159c74f217ec764060c480819e3ccc9d5a99a63
-        Poco::Net::SocketAddress initial_socket_address(request->coordinator_host(), request->coordinator_port());
-        query_context->setUser(request->user(), request->password(), initial_socket_address);
+        scheduleExecutePlanSegment(*request, cntl->request_attachment().movable());
+    }
+    catch (...)
+    {
+        auto error_msg = getCurrentExceptionMessage(false);
+        cntl->SetFailed(error_msg);
+        LOG_ERROR(log, "executeQuery failed: {}", error_msg);
+    }
+}
 
-        /// Set client info.
-        ClientInfo & client_info = query_context->getClientInfo();
-        client_info.brpc_protocol_major_version = request->brpc_protocol_major_revision();
-        client_info.brpc_protocol_minor_version = request->brpc_protocol_minor_revision();
-        if (client_info.brpc_protocol_major_version != DBMS_BRPC_PROTOCOL_MAJOR_VERSION)
+void PlanSegmentManagerRpcService::executeQueryBatch(
+    ::google::protobuf::RpcController * controller,
+    const ::DB::Protos::ExecutePlanSegmentBatchRequest * request,
+    ::DB::Protos::ExecutePlanSegmentBatchResponse * /*response*/,
+    ::google::protobuf::Closure * done)
+{
+    brpc::ClosureGuard done_guard(done);
+    brpc::Controller * cntl = static_cast<brpc::Controller *>(controller);
+    try
+    {
+        if (request->requests_size() != request->attachment_sizes_size())
             throw Exception(
-                "brpc protocol major version different - current is " + std::to_string(client_info.brpc_protocol_major_version) +
-                "remote is " + std::to_string(DBMS_BRPC_PROTOCOL_MAJOR_VERSION) +
-                ", plan segment is not compatible", ErrorCodes::BRPC_PROTOCOL_VERSION_UNSUPPORT
-            );
-        client_info.query_kind = ClientInfo::QueryKind::SECONDARY_QUERY;
-        client_info.interface = ClientInfo::Interface::BRPC;
-        Decimal64 initial_query_start_time_microseconds {request->initial_query_start_time()};
-        client_info.initial_query_start_time = initial_query_start_time_microseconds / 1000000;
-        client_info.initial_query_start_time_microseconds = initial_query_start_time_microseconds;
-        client_info.initial_user = request->user();
-        client_info.initial_query_id = request->query_id();
-
-        client_info.initial_address = initial_socket_address;
-
-        client_info.current_query_id = request->query_id() + "_" + std::to_string(request->plan_segment_id());
-        client_info.current_address = Poco::Net::SocketAddress(request->current_host(), request->current_port());
-
-        /// Prepare settings.
-        SettingsChanges settings_changes;
-        settings_changes.reserve(request->settings_size());
-        for (const auto & [key, value] : request->settings())
+                "Plan segment batch is malformed: " + std::to_string(request->requests_size()) + " requests but "
+                    + std::to_string(request->attachment_sizes_size()) + " attachment sizes",
+                ErrorCodes::LOGICAL_ERROR);
+
+        for (int i = 0; i < request->requests_size(); ++i)
         {
-            settings_changes.push_back({key, value});
+            butil::IOBuf plan_segment_buf;
+            size_t attachment_size = request->attachment_sizes(i);
+            if (cntl->request_attachment().cutn(&plan_segment_buf, attachment_size) != attachment_size)
+                throw Exception(
+                    "Plan segment batch attachment is truncated at segment " + std::to_string(request->requests(i).plan_segment_id()),
+                    ErrorCodes::LOGICAL_ERROR);
+            scheduleExecutePlanSegment(request->requests(i), std::move(plan_segment_buf));
         }
-
-        /// Sets an extra row policy based on `client_info.initial_user`
-        query_context->setInitialRowPolicy();
-
-        /// Quietly clamp to the constraints since it's a secondary query.
-        query_context->clampToSettingsConstraints(settings_changes);
-        query_context->applySettingsChanges(settings_changes);
-
-        /// Disable function name normalization when it's a secondary query, because queries are either
-        /// already normalized on initiator node, or not normalized and should remain unnormalized for
-        /// compatibility.
-        query_context->setSetting("normalize_function_names", Field(0));
-
-        /// Set quota
-        if (!request->has_quota())
-            query_context->setQuotaKey(request->quota());
-
-        if (!query_context->hasQueryContext())
-            query_context->makeQueryContext();
-
-        ThreadFromGlobalPool async_thread([query_context = std::move(query_context),
-                                           plan_segment_buf = std::make_shared<butil::IOBuf>(cntl->request_attachment().movable())]() {
-            try
-            {
-                /// Plan segment Deserialization can't run in bthread since checkStackSize method is not compatible with all user-space lightweight threads that manually allocated stacks.
-                ReadBufferFromBrpcBuf plan_segment_read_buf(*plan_segment_buf);
-                auto plan_segment = PlanSegment::deserializePlanSegment(plan_segment_read_buf, query_context);
-                executePlanSegmentInternal(std::move(plan_segment), std::move(query_context), false);
-            }
-            catch (...)
-            {
-                tryLogCurrentException(__PRETTY_FUNCTION__);
-            }
-        });
-        async_thread.detach();
     }
     catch (...)
     {
         auto error_msg = getCurrentExceptionMessage(false);
         cntl->SetFailed(error_msg);
-        LOG_ERROR(log, "executeQuery failed: {}", error_msg);
+        LOG_ERROR(log, "executeQueryBatch failed: {}", error_msg);
     }
 }
 
@@ -36,6 +36,13 @@ public:
         ::DB::Protos::ExecutePlanSegmentResponse * response,
         ::google::protobuf::Closure * done) override;
 
+    /// execute all plan segments of a query shipped to this worker in one rpc
+    void executeQueryBatch(
+        ::google::protobuf::RpcController * controller,
+        const ::DB::Protos::ExecutePlanSegmentBatchRequest * request,
+        ::DB::Protos::ExecutePlanSegmentBatchResponse * response,
+        ::google::protobuf::Closure * done) override;
+
     /// receive exception report send terminate query (coordinate host ---> segment executor host)
     void cancelQuery(
         ::google::protobuf::RpcController * /*controller*/,
@@ -59,6 +66,9 @@ public:
         brpc::ClosureGuard done_guard(done);
         RuntimeSegmentsStatus status(
             request->query_id(), request->segment_id(), request->is_succeed(), request->is_canceled(), request->message(), request->code());
+        status.output_rows = request->output_rows();
+        status.output_bytes = request->output_bytes();
+        status.execution_time_ms = request->execution_time_ms();
         const SegmentSchedulerPtr & scheduler = context->getSegmentScheduler();
         scheduler->updateSegmentStatus(status);
         // this means exception happened during execution.
@@ -83,5 +93,8 @@ public:
 private:
     ContextMutablePtr context;
     Poco::Logger * log;
+
+    /// Build the query context from request and launch plan segment execution asynchronously
+    void scheduleExecutePlanSegment(const Protos::ExecutePlanSegmentRequest & request, butil::IOBuf plan_segment_buf);
 };
 }
@@ -19,6 +19,8 @@
 #include <Interpreters/ProcessList.h>
 #include <Interpreters/DistributedStages/AddressInfo.h>
 #include <IO/WriteBufferFromString.h>
+#include <Processors/Exchange/DataTrans/BroadcastSenderProxy.h>
+#include <Processors/Exchange/DataTrans/BroadcastSenderProxyRegistry.h>
 #include <Common/Exception.h>
 
 #include <memory>
@@ -136,6 +138,15 @@ PlanSegmentProcessList::insert(const PlanSegment & plan_segment, ContextMutableP
 }
 
 
+size_t PlanSegmentProcessList::getGroupSegmentCount(const String & initial_query_id) const
+{
+    std::lock_guard lock(mutex);
+    auto segment_group_it = initail_query_to_groups.find(initial_query_id);
+    if (segment_group_it == initail_query_to_groups.end())
+        return 0;
+    return segment_group_it->second.segment_queries.size();
+}
+
 CancellationCode PlanSegmentProcessList::tryCancelPlanSegmentGroup(const String & initial_query_id, String coordinator_address)
 {
     std::vector<ProcessList::EntryPtr> need_cancalled_queries;
@@ -188,6 +199,25 @@ CancellationCode PlanSegmentProcessList::tryCancelPlanSegmentGroup(const String
         }
     }
 
+    /// Tear down all exchange channels of the query in one pass. Executor threads
+    /// blocked on a full or empty exchange queue would otherwise only observe the
+    /// cancel flag after the exchange timeout; closing the channels wakes them
+    /// immediately and releases the buffered exchange memory
+    auto sender_proxies = BroadcastSenderProxyRegistry::instance().getQueryProxies(initial_query_id);
+    for (const auto & sender_proxy : sender_proxies)
+    {
+        try
+        {
+            sender_proxy->finish(BroadcastStatusCode::SEND_CANCELLED, "Query was cancelled");
+        }
+        catch (...)
+        {
+            tryLogCurrentException(logger);
+        }
+    }
+    if (!sender_proxies.empty())
+        LOG_DEBUG(logger, "Closed {} exchange channels for cancelled query {}", sender_proxies.size(), initial_query_id);
+
     return res;
 }
 
@@ -73,6 +73,9 @@ public:
 
     EntryPtr insert(const PlanSegment & plan_segment, ContextMutablePtr query_context, bool force = false);
 
+    /// Number of plan segment instances of one distributed query currently running on this server
+    size_t getGroupSegmentCount(const String & initial_query_id) const;
+
     CancellationCode tryCancelPlanSegmentGroup(const String & initial_query_id, String coordinator_address = "");
 
 private:
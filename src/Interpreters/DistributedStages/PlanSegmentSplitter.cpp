@@ -146,6 +146,12 @@ PlanSegmentResult PlanSegmentVisitor::visitExchangeNode(QueryPlan::Node * node,
     return plan_segment_context.query_plan.getLastNode();
 }
 
+/**
+ * A shared CTE becomes a single plan segment no matter how many consumers reference it:
+ * the first reference creates the segment, every further reference only appends another
+ * output to it. The definition is therefore evaluated exactly once per worker and its
+ * result streamed through the exchanges of the per-consumer outputs.
+ */
 PlanSegmentResult PlanSegmentVisitor::visitCTERefNode(QueryPlan::Node * node, PlanSegmentVisitorContext & split_context)
 {
     auto * step = dynamic_cast<CTERefStep *>(node->step.get());
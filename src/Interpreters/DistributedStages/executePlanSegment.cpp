@@ -15,6 +15,8 @@
 
 #include <memory>
 #include <string>
+#include <Compression/CompressedWriteBuffer.h>
+#include <Compression/CompressionFactory.h>
 #include <Core/Defines.h>
 #include <Core/Types.h>
 #include <DataStreams/BlockIO.h>
@@ -134,12 +136,8 @@ static void OnSendPlanSegmentCallback(Protos::ExecutePlanSegmentResponse * respo
             &Poco::Logger::get("executePlanSegment"), "send plansegment to {} success", butil::endpoint2str(cntl->remote_side()).c_str());
 }
 
-void executePlanSegmentRemotely(const PlanSegment & plan_segment, ContextPtr context, bool async)
+static void fillExecutePlanSegmentRequest(Protos::ExecutePlanSegmentRequest & request, const PlanSegment & plan_segment, const ContextPtr & context)
 {
-    auto execute_address = extractExchangeStatusHostPort(plan_segment.getCurrentAddress());
-    auto rpc_channel = RpcChannelPool::getInstance().getClient(execute_address, BrpcChannelPoolOptions::DEFAULT_CONFIG_KEY, true);
-    Protos::PlanSegmentManagerService_Stub manager_stub(&rpc_channel->getChannel());
-    Protos::ExecutePlanSegmentRequest request;
     request.set_brpc_protocol_major_revision(DBMS_BRPC_PROTOCOL_MAJOR_VERSION);
     request.set_brpc_protocol_minor_revision(DBMS_BRPC_PROTOCOL_MINOR_VERSION);
     request.set_query_id(plan_segment.getQueryId());
@@ -169,8 +167,12 @@ void executePlanSegmentRemotely(const PlanSegment & plan_segment, ContextPtr con
     if (!client_info.quota_key.empty())
         request.set_quota(quota_key);
 
-    //OpenTelemetry trace
-    const auto & trace_context = client_info.client_trace_context;
+    /// OpenTelemetry trace: hand the worker the coordinator's query span (when one
+    /// exists) rather than the raw client context, so segment spans recorded on the
+    /// worker become children of this query and the distributed timeline can be
+    /// reassembled under a single trace id.
+    const auto & trace_context
+        = context->query_trace_context.trace_id != UUID() ? context->query_trace_context : client_info.client_trace_context;
     if (trace_context.trace_id != UUID())
     {
         UInt128 trace_id = trace_context.trace_id.toUnderType();
@@ -183,9 +185,37 @@ void executePlanSegmentRemotely(const PlanSegment & plan_segment, ContextPtr con
 
     // Set cnch Transaction id as seesion id
     request.set_txn_id(context->getCurrentTransactionID().toUInt64());
+}
+
+/// Serialize the plan segment into the rpc attachment buffer. Segments of wide
+/// fan-out queries carry mostly repetitive ASTs and headers and shrink several
+/// times under zstd, which matters when one scheduling round dispatches the same
+/// segment to hundreds of workers. The request flag tells the receiver whether
+/// the attachment is compressed, so mixed-version clusters keep working.
+static void serializePlanSegmentToDispatchBuf(
+    const PlanSegment & plan_segment, Protos::ExecutePlanSegmentRequest & request, WriteBufferFromBrpcBuf & write_buf, ContextPtr context)
+{
+    if (context->getSettingsRef().compress_plan_segment)
+    {
+        CompressedWriteBuffer compressed_buf(write_buf, CompressionCodecFactory::instance().get("ZSTD", {}));
+        plan_segment.serialize(compressed_buf);
+        compressed_buf.next();
+        request.set_compressed_plan_segment(true);
+    }
+    else
+        plan_segment.serialize(write_buf);
+}
+
+void executePlanSegmentRemotely(const PlanSegment & plan_segment, ContextPtr context, bool async)
+{
+    auto execute_address = extractExchangeStatusHostPort(plan_segment.getCurrentAddress());
+    auto rpc_channel = RpcChannelPool::getInstance().getClient(execute_address, BrpcChannelPoolOptions::CONTROL_DEFAULT_CONFIG_KEY, true);
+    Protos::PlanSegmentManagerService_Stub manager_stub(&rpc_channel->getChannel());
+    Protos::ExecutePlanSegmentRequest request;
+    fillExecutePlanSegmentRequest(request, plan_segment, context);
 
     WriteBufferFromBrpcBuf write_buf;
-    plan_segment.serialize(write_buf);
+    serializePlanSegmentToDispatchBuf(plan_segment, request, write_buf, context);
     butil::IOBuf & iobuf = const_cast<butil::IOBuf &>(write_buf.getFinishedBuf());
 
     if (async)
@@ -207,6 +237,56 @@ void executePlanSegmentRemotely(const PlanSegment & plan_segment, ContextPtr con
     }
 }
 
+void preparePlanSegmentDispatch(PlanSegmentDispatch & dispatch, const PlanSegment & plan_segment, ContextPtr context)
+{
+    fillExecutePlanSegmentRequest(dispatch.request, plan_segment, context);
+
+    WriteBufferFromBrpcBuf write_buf;
+    serializePlanSegmentToDispatchBuf(plan_segment, dispatch.request, write_buf, context);
+    dispatch.plan_segment_buf.append(const_cast<butil::IOBuf &>(write_buf.getFinishedBuf()).movable());
+}
+
+static void OnSendPlanSegmentBatchCallback(
+    Protos::ExecutePlanSegmentBatchResponse * response, brpc::Controller * cntl, std::shared_ptr<RpcClient> rpc_channel)
+{
+    std::unique_ptr<brpc::Controller> cntl_guard(cntl);
+    std::unique_ptr<Protos::ExecutePlanSegmentBatchResponse> response_guard(response);
+
+    rpc_channel->checkAliveWithController(*cntl);
+    if (cntl->Failed())
+        LOG_ERROR(
+            &Poco::Logger::get("executePlanSegment"),
+            "send plansegment batch to {} failed, error: {},  msg: {}",
+            butil::endpoint2str(cntl->remote_side()).c_str(),
+            cntl->ErrorText(),
+            response->message());
+    else
+        LOG_TRACE(
+            &Poco::Logger::get("executePlanSegment"),
+            "send plansegment batch to {} success",
+            butil::endpoint2str(cntl->remote_side()).c_str());
+}
+
+void executePlanSegmentBatchRemotely(const AddressInfo & execute_address, std::vector<PlanSegmentDispatch> & dispatches, ContextPtr)
+{
+    auto address = extractExchangeStatusHostPort(execute_address);
+    auto rpc_channel = RpcChannelPool::getInstance().getClient(address, BrpcChannelPoolOptions::CONTROL_DEFAULT_CONFIG_KEY, true);
+    Protos::PlanSegmentManagerService_Stub manager_stub(&rpc_channel->getChannel());
+
+    brpc::Controller * cntl = new brpc::Controller();
+    Protos::ExecutePlanSegmentBatchRequest batch_request;
+    for (auto & dispatch : dispatches)
+    {
+        batch_request.add_attachment_sizes(dispatch.plan_segment_buf.size());
+        batch_request.add_requests()->Swap(&dispatch.request);
+        cntl->request_attachment().append(dispatch.plan_segment_buf.movable());
+    }
+
+    Protos::ExecutePlanSegmentBatchResponse * response = new Protos::ExecutePlanSegmentBatchResponse();
+    google::protobuf::Closure * done = brpc::NewCallback(&OnSendPlanSegmentBatchCallback, response, cntl, rpc_channel);
+    manager_stub.executeQueryBatch(cntl, &batch_request, response, done);
+}
+
 void executePlanSegmentLocally(const PlanSegment & plan_segment, ContextPtr initial_query_context)
 {
     PlanSegmentPtr plan_segment_clone
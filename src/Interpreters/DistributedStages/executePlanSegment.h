@@ -15,22 +15,42 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
+#include <vector>
 #include <DataStreams/BlockIO.h>
 #include <Interpreters/DistributedStages/PlanSegment.h>
 #include <Interpreters/Context_fwd.h>
 #include <Protos/plan_segment_manager.pb.h>
+#include <butil/iobuf.h>
 
 namespace DB
 {
 class Context;
 
+/// One plan segment instance prepared for a worker: the filled rpc request plus
+/// the serialized segment which travels in the rpc attachment
+struct PlanSegmentDispatch
+{
+    Protos::ExecutePlanSegmentRequest request;
+    butil::IOBuf plan_segment_buf;
+};
+
+/// Dispatches accumulated per worker while scheduling, flushed as one rpc per worker
+using PlanSegmentBatchMap = std::map<AddressInfo, std::vector<PlanSegmentDispatch>>;
+
 BlockIO lazyExecutePlanSegmentLocally(PlanSegmentPtr plan_segment, ContextMutablePtr context);
 
 void executePlanSegmentInternal(PlanSegmentPtr plan_segment, ContextMutablePtr context, bool async);
 
 void executePlanSegmentRemotely(const PlanSegment & plan_segment, ContextPtr context, bool async);
 
+/// Serialize plan_segment for its current address into dispatch instead of sending it right away
+void preparePlanSegmentDispatch(PlanSegmentDispatch & dispatch, const PlanSegment & plan_segment, ContextPtr context);
+
+/// Ship all accumulated dispatches of one worker in a single batched rpc
+void executePlanSegmentBatchRemotely(const AddressInfo & execute_address, std::vector<PlanSegmentDispatch> & dispatches, ContextPtr context);
+
 void executePlanSegmentLocally(const PlanSegment & plan_segment, ContextPtr initial_query_context);
 
 /**
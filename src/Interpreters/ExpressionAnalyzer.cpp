@@ -43,6 +43,7 @@
 #include <Interpreters/ExpressionActions.h>
 #include <Interpreters/ExpressionAnalyzer.h>
 #include <Interpreters/ExternalDictionariesLoader.h>
+#include <Interpreters/GraceHashJoin.h>
 #include <Interpreters/HashJoin.h>
 #include <Interpreters/JoinSwitcher.h>
 #include <Interpreters/MergeJoin.h>
@@ -1143,6 +1144,10 @@ static std::shared_ptr<IJoin> makeJoin(std::shared_ptr<TableJoin> analyzed_join,
         return std::make_shared<MergeJoin>(analyzed_join, sample_block);
     else if (analyzed_join->forceNestedLoopJoin())
         return std::make_shared<NestedLoopJoin>(analyzed_join, sample_block, context);
+
+    const auto & settings = context->getSettingsRef();
+    if (settings.enable_grace_hash_join && allow_merge_join)
+        return std::make_shared<GraceHashJoin>(analyzed_join, sample_block, settings.grace_hash_join_buckets);
     return std::make_shared<JoinSwitcher>(analyzed_join, sample_block);
 }
 
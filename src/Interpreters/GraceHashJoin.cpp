@@ -0,0 +1,381 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <Columns/ColumnNullable.h>
+#include <Common/typeid_cast.h>
+#include <common/logger_useful.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+#include <DataStreams/IBlockInputStream.h>
+#include <DataStreams/materializeBlock.h>
+#include <DataTypes/DataTypeLowCardinality.h>
+#include <Interpreters/GraceHashJoin.h>
+#include <Interpreters/HashJoin.h>
+#include <Interpreters/MergeJoin.h>
+#include <Interpreters/join_common.h>
+#include <QueryPlan/PlanSerDerHelper.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+}
+
+namespace
+{
+
+ColumnWithTypeAndName correctNullability(ColumnWithTypeAndName && column, bool nullable)
+{
+    if (nullable)
+        JoinCommon::convertColumnToNullable(column);
+    else
+        JoinCommon::removeColumnNullability(column);
+
+    return std::move(column);
+}
+
+void appendBlock(Block & to, const Block & from)
+{
+    size_t rows = from.rows();
+    if (!rows)
+        return;
+
+    if (!to.rows())
+    {
+        to = from;
+        return;
+    }
+
+    materializeBlockInplace(to);
+    MutableColumns columns = to.mutateColumns();
+    for (size_t i = 0; i < columns.size(); ++i)
+        columns[i]->insertRangeFrom(*from.getByPosition(i).column->convertToFullColumnIfConst(), 0, rows);
+    to.setColumns(std::move(columns));
+}
+
+/// Reads the non-joined rows of the in-memory part first, then of the on-disk part.
+class NonJoinedConcatBlockInputStream : public IBlockInputStream
+{
+public:
+    NonJoinedConcatBlockInputStream(Block header_, BlockInputStreamPtr first_, BlockInputStreamPtr second_)
+        : header(std::move(header_)), first(std::move(first_)), second(std::move(second_))
+    {}
+
+    String getName() const override { return "NonJoinedConcat"; }
+    Block getHeader() const override { return header; }
+
+protected:
+    Block readImpl() override
+    {
+        if (first)
+        {
+            if (Block block = first->read())
+                return block;
+            first.reset();
+        }
+
+        if (second)
+        {
+            if (Block block = second->read())
+                return block;
+            second.reset();
+        }
+
+        return {};
+    }
+
+private:
+    Block header;
+    BlockInputStreamPtr first;
+    BlockInputStreamPtr second;
+};
+
+}
+
+GraceHashJoin::GraceHashJoin(std::shared_ptr<TableJoin> table_join_, const Block & right_sample_block_, size_t num_buckets_)
+    : table_join(table_join_)
+    , right_sample_block(right_sample_block_.cloneEmpty())
+    , num_buckets(std::max<size_t>(2, num_buckets_))
+    , limits(table_join_->sizeLimits())
+    , hash_join(std::make_shared<HashJoin>(table_join_, right_sample_block))
+    , is_spilled(num_buckets, 0)
+    , bucket_bytes(num_buckets, 0)
+{
+    if (!limits.hasLimits())
+        limits.max_bytes = table_join->defaultMaxBytes();
+}
+
+WeakHash32 GraceHashJoin::keysHash(const Block & block, const Names & key_names) const
+{
+    WeakHash32 hash(block.rows());
+    for (const auto & name : key_names)
+    {
+        ColumnPtr column = recursiveRemoveLowCardinality(block.getByName(name).column->convertToFullColumnIfConst());
+
+        /// Null keys never match, so hashing the nested column keeps a nullable and a
+        /// plain key of the same type in the same bucket.
+        if (const auto * nullable = typeid_cast<const ColumnNullable *>(column.get()))
+            column = nullable->getNestedColumnPtr();
+
+        column->updateWeakHash32(hash);
+    }
+    return hash;
+}
+
+Block GraceHashJoin::filterByBuckets(const Block & block, const PaddedPODArray<UInt32> & hash_data, bool take_spilled) const
+{
+    size_t rows = block.rows();
+    IColumn::Filter mask(rows);
+    size_t result_rows = 0;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        mask[i] = (is_spilled[hash_data[i] % num_buckets] != 0) == take_spilled;
+        result_rows += mask[i];
+    }
+
+    if (result_rows == rows)
+        return block;
+
+    Block res = block.cloneEmpty();
+    for (size_t i = 0; i < block.columns(); ++i)
+        res.getByPosition(i).column = block.getByPosition(i).column->filter(mask, result_rows);
+    return res;
+}
+
+bool GraceHashJoin::addJoinedBlock(const Block & block, bool)
+{
+    std::lock_guard lock(add_mutex);
+
+    size_t rows = block.rows();
+    WeakHash32 hash = keysHash(block, table_join->keyNamesRight());
+
+    if (rows)
+    {
+        /// Rough per-bucket accounting, used to pick spill victims.
+        std::vector<size_t> rows_per_bucket(num_buckets, 0);
+        for (size_t i = 0; i < rows; ++i)
+            ++rows_per_bucket[hash.getData()[i] % num_buckets];
+
+        size_t bytes = block.bytes();
+        for (size_t bucket = 0; bucket < num_buckets; ++bucket)
+            bucket_bytes[bucket] += bytes * rows_per_bucket[bucket] / rows;
+    }
+
+    if (!num_spilled)
+    {
+        hash_join->addJoinedBlock(block, false);
+    }
+    else
+    {
+        Block resident = filterByBuckets(block, hash.getData(), false);
+        Block spilled = filterByBuckets(block, hash.getData(), true);
+
+        if (resident.rows())
+            hash_join->addJoinedBlock(resident, false);
+        if (spilled.rows())
+            merge_join->addJoinedBlock(spilled, false);
+    }
+
+    if (num_spilled < num_buckets
+        && !limits.softCheck(hash_join->getTotalRowCount(), hash_join->getTotalByteCount()))
+        spillLargestBuckets();
+
+    return true;
+}
+
+void GraceHashJoin::spillLargestBuckets()
+{
+    /// Choose the biggest resident buckets until about half of the resident data is picked.
+    std::vector<std::pair<size_t, size_t>> resident_buckets;
+    size_t resident_bytes = 0;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket)
+    {
+        if (!is_spilled[bucket])
+        {
+            resident_buckets.emplace_back(bucket_bytes[bucket], bucket);
+            resident_bytes += bucket_bytes[bucket];
+        }
+    }
+
+    std::sort(resident_buckets.begin(), resident_buckets.end(),
+              [](const auto & lhs, const auto & rhs) { return lhs.first > rhs.first; });
+
+    size_t chosen = 0;
+    size_t chosen_bytes = 0;
+    for (const auto & [bytes, bucket] : resident_buckets)
+    {
+        if (chosen && chosen_bytes * 2 >= resident_bytes)
+            break;
+
+        is_spilled[bucket] = 1;
+        ++num_spilled;
+        ++chosen;
+        chosen_bytes += bytes;
+    }
+
+    if (!merge_join)
+        merge_join = std::make_shared<MergeJoin>(table_join, right_sample_block);
+
+    /// Rebuild the in-memory join from the buckets that stay resident, routing the chosen
+    /// ones to the on-disk join. Blocks are restored the same way as in JoinSwitcher.
+    auto joined_data = static_cast<const HashJoin &>(*hash_join).getJoinedData();
+    BlocksList right_blocks = std::move(joined_data->blocks);
+    hash_join = std::make_shared<HashJoin>(table_join, right_sample_block);
+
+    std::vector<size_t> positions;
+    std::vector<bool> is_nullable;
+    if (!right_blocks.empty())
+    {
+        positions.reserve(right_sample_block.columns());
+        const Block & tmp_block = *right_blocks.begin();
+        for (const auto & sample_column : right_sample_block)
+        {
+            positions.emplace_back(tmp_block.getPositionByName(sample_column.name));
+            is_nullable.emplace_back(sample_column.type->isNullable());
+        }
+    }
+
+    for (Block & saved_block : right_blocks)
+    {
+        Block restored_block;
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            auto & column = saved_block.getByPosition(positions[i]);
+            restored_block.insert(correctNullability(std::move(column), is_nullable[i]));
+        }
+
+        WeakHash32 hash = keysHash(restored_block, table_join->keyNamesRight());
+        Block resident = filterByBuckets(restored_block, hash.getData(), false);
+        Block spilled = filterByBuckets(restored_block, hash.getData(), true);
+
+        if (resident.rows())
+            hash_join->addJoinedBlock(resident, false);
+        if (spilled.rows())
+            merge_join->addJoinedBlock(spilled, false);
+    }
+
+    LOG_DEBUG(
+        log,
+        "Memory limit exceeded: moved {} buckets ({} bytes) to disk, {} of {} buckets stay in memory",
+        chosen,
+        chosen_bytes,
+        num_buckets - num_spilled,
+        num_buckets);
+}
+
+Block GraceHashJoin::joinSubBlock(IJoin & sub_join, Block && block)
+{
+    Block res = std::move(block);
+    ExtraBlockPtr extra;
+    sub_join.joinBlock(res, extra);
+
+    /// Consume continuations the way JoiningTransform::readExecute does: the sub-join keeps
+    /// its position inside `extra`, we only concatenate the pieces it produces.
+    while (extra)
+    {
+        if (extra->empty())
+            throw Exception("Unexpected empty continuation block in GraceHashJoin", ErrorCodes::LOGICAL_ERROR);
+
+        Block next = std::move(extra->block);
+        sub_join.joinBlock(next, extra);
+        appendBlock(res, next);
+    }
+
+    return res;
+}
+
+void GraceHashJoin::joinBlock(Block & block, ExtraBlockPtr & not_processed)
+{
+    /// Nothing was spilled: behave exactly like a plain hash join,
+    /// including its chunked not_processed protocol.
+    if (!merge_join)
+    {
+        hash_join->joinBlock(block, not_processed);
+        return;
+    }
+
+    WeakHash32 hash = keysHash(block, table_join->keyNamesLeft());
+    Block resident = filterByBuckets(block, hash.getData(), false);
+    Block spilled = filterByBuckets(block, hash.getData(), true);
+
+    Block res = joinSubBlock(*hash_join, std::move(resident));
+    if (spilled.rows())
+        appendBlock(res, joinSubBlock(*merge_join, std::move(spilled)));
+
+    block.swap(res);
+}
+
+void GraceHashJoin::setTotals(const Block & block)
+{
+    hash_join->setTotals(block);
+    if (merge_join)
+        merge_join->setTotals(block);
+}
+
+const Block & GraceHashJoin::getTotals() const
+{
+    return hash_join->getTotals();
+}
+
+size_t GraceHashJoin::getTotalRowCount() const
+{
+    return hash_join->getTotalRowCount() + (merge_join ? merge_join->getTotalRowCount() : 0);
+}
+
+size_t GraceHashJoin::getTotalByteCount() const
+{
+    return hash_join->getTotalByteCount() + (merge_join ? merge_join->getTotalByteCount() : 0);
+}
+
+bool GraceHashJoin::alwaysReturnsEmptySet() const
+{
+    return hash_join->alwaysReturnsEmptySet() && (!merge_join || merge_join->alwaysReturnsEmptySet());
+}
+
+BlockInputStreamPtr GraceHashJoin::createStreamWithNonJoinedRows(const Block & result_sample_block, UInt64 max_block_size) const
+{
+    auto resident_stream = hash_join->createStreamWithNonJoinedRows(result_sample_block, max_block_size);
+    auto spilled_stream = merge_join ? merge_join->createStreamWithNonJoinedRows(result_sample_block, max_block_size) : nullptr;
+
+    if (!spilled_stream)
+        return resident_stream;
+    if (!resident_stream)
+        return spilled_stream;
+
+    return std::make_shared<NonJoinedConcatBlockInputStream>(result_sample_block, std::move(resident_stream), std::move(spilled_stream));
+}
+
+void GraceHashJoin::serialize(WriteBuffer & buf) const
+{
+    table_join->serialize(buf);
+    serializeBlock(right_sample_block, buf);
+    writeBinary(num_buckets, buf);
+}
+
+JoinPtr GraceHashJoin::deserialize(ReadBuffer & buf, ContextPtr context)
+{
+    auto table_join = TableJoin::deserialize(buf, context);
+    auto right_sample_block = deserializeBlock(buf);
+    size_t num_buckets = 0;
+    readBinary(num_buckets, buf);
+
+    return std::make_shared<GraceHashJoin>(table_join, right_sample_block, num_buckets);
+}
+
+}
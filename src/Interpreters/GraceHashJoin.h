@@ -0,0 +1,94 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include <Poco/Logger.h>
+#include <Core/Block.h>
+#include <Common/WeakHash.h>
+#include <DataStreams/SizeLimits.h>
+#include <Interpreters/IJoin.h>
+#include <Interpreters/TableJoin.h>
+
+namespace DB
+{
+
+/// Partitioned join with a gradual fallback to disk instead of JoinSwitcher's all-at-once
+/// switch. Rows of both sides are assigned to one of `num_buckets` partitions by a hash of
+/// the join keys. All partitions start inside a single in-memory HashJoin; every time the
+/// memory limit is exceeded during the build, only the largest resident partitions are moved
+/// into an on-disk MergeJoin and the in-memory part is rebuilt from the rest. On probe, rows
+/// of every left block are routed to the sub-join that holds their partition and the two
+/// outputs are concatenated. Hot partitions of a skewed key distribution keep hash join
+/// speed, cold ones pay the sort-merge price, so hitting the limit is a slowdown, not a
+/// multi-minute stall re-sorting the whole right table.
+class GraceHashJoin : public IJoin
+{
+public:
+    GraceHashJoin(std::shared_ptr<TableJoin> table_join_, const Block & right_sample_block_, size_t num_buckets_);
+
+    JoinType getType() const override { return JoinType::GraceHash; }
+
+    const TableJoin & getTableJoin() const override { return *table_join; }
+
+    bool addJoinedBlock(const Block & block, bool check_limits = true) override;
+    void joinBlock(Block & block, ExtraBlockPtr & not_processed) override;
+
+    /// Forwarded to both sub-joins: MergeJoin finalizes its sorted runs in setTotals().
+    void setTotals(const Block & block) override;
+    const Block & getTotals() const override;
+
+    size_t getTotalRowCount() const override;
+    size_t getTotalByteCount() const override;
+    bool alwaysReturnsEmptySet() const override;
+
+    BlockInputStreamPtr createStreamWithNonJoinedRows(const Block & result_sample_block, UInt64 max_block_size) const override;
+
+    void serialize(WriteBuffer & buf) const override;
+    static JoinPtr deserialize(ReadBuffer & buf, ContextPtr context);
+
+private:
+    /// Per-row hash of the join key columns, identical for matching keys of both sides.
+    WeakHash32 keysHash(const Block & block, const Names & key_names) const;
+    /// Rows of `block` that live in spilled (or resident) buckets.
+    Block filterByBuckets(const Block & block, const PaddedPODArray<UInt32> & hash_data, bool take_spilled) const;
+    /// Move the largest resident buckets to the on-disk join and rebuild the in-memory one.
+    void spillLargestBuckets();
+    /// Run a block through one sub-join, consuming its not_processed continuations.
+    static Block joinSubBlock(IJoin & sub_join, Block && block);
+
+    Poco::Logger * log = &Poco::Logger::get("GraceHashJoin");
+
+    std::shared_ptr<TableJoin> table_join;
+    const Block right_sample_block;
+    const size_t num_buckets;
+    SizeLimits limits;
+
+    /// Guards the build phase; probe only reads state created during the build.
+    mutable std::mutex add_mutex;
+
+    JoinPtr hash_join;  /// resident buckets
+    JoinPtr merge_join; /// spilled buckets, created on the first spill
+
+    std::vector<UInt8> is_spilled;
+    /// Rough bytes routed to every bucket, used to pick spill victims.
+    std::vector<size_t> bucket_bytes;
+    size_t num_spilled = 0;
+};
+
+}
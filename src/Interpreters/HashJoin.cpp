@@ -20,6 +20,7 @@
  */
 
 #include <any>
+#include <array>
 #include <limits>
 
 #include <common/logger_useful.h>
@@ -343,6 +344,7 @@ class KeyGetterForDict
 public:
     using Mapped = RowRef;
     using FindResult = ColumnsHashing::columns_hashing_impl::FindResultImpl<Mapped, true>;
+    static constexpr bool has_cheap_key_calculation = false;
 
     KeyGetterForDict(const TableJoin & table_join, const ColumnRawPtrs & key_columns)
     {
@@ -901,8 +903,35 @@ NO_INLINE IColumn::Filter joinRightColumns(
 
     IColumn::Offset current_offset = 0;
 
+    /// When the build side is much larger than the caches, every probe is a
+    /// dependent random load. Hashing the probe keys is cheap for these key
+    /// getters, so hash ahead of the probe position and prefetch the target
+    /// cells to overlap the miss latency of several lookups.
+    constexpr bool use_prefetch = KeyGetter::has_cheap_key_calculation;
+    constexpr size_t prefetch_look_ahead = 32;
+    [[maybe_unused]] std::array<size_t, prefetch_look_ahead> hashes;
+
+    if constexpr (use_prefetch)
+    {
+        size_t prefill = std::min(rows, prefetch_look_ahead);
+        for (size_t i = 0; i < prefill; ++i)
+        {
+            hashes[i] = key_getter.getHash(map, i, pool);
+            map.prefetch(hashes[i]);
+        }
+    }
+
     for (size_t i = 0; i < rows; ++i)
     {
+        if constexpr (use_prefetch)
+        {
+            if (size_t ahead = i + prefetch_look_ahead; ahead < rows)
+            {
+                hashes[ahead % prefetch_look_ahead] = key_getter.getHash(map, ahead, pool);
+                map.prefetch(hashes[ahead % prefetch_look_ahead]);
+            }
+        }
+
         if constexpr (has_null_map)
         {
             if ((*null_map)[i])
@@ -915,7 +944,13 @@ NO_INLINE IColumn::Filter joinRightColumns(
             }
         }
 
-        auto find_result = key_getter.findKey(map, i, pool);
+        auto find_result = [&]()
+        {
+            if constexpr (use_prefetch)
+                return key_getter.findKey(map, i, pool, hashes[i % prefetch_look_ahead]);
+            else
+                return key_getter.findKey(map, i, pool);
+        }();
 
         if (find_result.isFound())
         {
@@ -47,6 +47,7 @@ enum JoinType : UInt8
     Merge,
     NestedLoop,
     Switcher,
+    GraceHash,
 };
 
 class IJoin
@@ -143,6 +143,14 @@ BlockIO InterpreterAlterWarehouseQuery::execute()
             {
                 vw_alter_settings.cooldown_seconds_after_auto_unlink = change.value.safeGet<size_t>();
             }
+            else if (change.name == "spillover_vw")
+            {
+                vw_alter_settings.spillover_vw = change.value.safeGet<String>();
+            }
+            else if (change.name == "max_spillover_concurrent_queries")
+            {
+                vw_alter_settings.max_spillover_concurrent_queries = change.value.safeGet<size_t>();
+            }
             else
             {
                 throw Exception("Unknown setting " + change.name, ErrorCodes::RESOURCE_MANAGER_UNKNOWN_SETTING);
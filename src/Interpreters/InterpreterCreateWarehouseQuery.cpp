@@ -141,6 +141,14 @@ BlockIO InterpreterCreateWarehouseQuery::execute()
             {
                 vw_settings.cooldown_seconds_after_auto_unlink = change.value.safeGet<size_t>();
             }
+            else if (change.name == "spillover_vw")
+            {
+                vw_settings.spillover_vw = change.value.safeGet<String>();
+            }
+            else if (change.name == "max_spillover_concurrent_queries")
+            {
+                vw_settings.max_spillover_concurrent_queries = change.value.safeGet<size_t>();
+            }
             else
             {
                 throw Exception("Unknown setting " + change.name, ErrorCodes::RESOURCE_MANAGER_UNKNOWN_SETTING);
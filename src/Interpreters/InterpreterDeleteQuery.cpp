@@ -17,6 +17,7 @@
 #include <Storages/AlterCommands.h>
 #include <Storages/IStorage.h>
 #include <Storages/MutationCommands.h>
+#include <Storages/StorageCnchMergeTree.h>
 #include <fmt/format.h>
 
 
@@ -51,7 +52,8 @@ BlockIO InterpreterDeleteQuery::execute()
     auto table_lock = table->lockForShare(getContext()->getCurrentQueryId(), getContext()->getSettingsRef().lock_acquire_timeout);
     auto metadata_snapshot = table->getInMemoryMetadataPtr();
 
-    /// For now, we only support DELETE FROM CNCH unique table (CnchMergeTree with unique key).
+    /// We support DELETE FROM CNCH unique tables (converted to INSERT with _delete_flag_) and
+    /// CNCH tables that opted into delete bitmaps via enable_delete_bitmap_for_normal_table.
     if (table->supportsLightweightDelete())
     {
         if (!getContext()->getSettingsRef().enable_lightweight_delete)
@@ -60,6 +62,18 @@ BlockIO InterpreterDeleteQuery::execute()
         if (!delete_query.predicate)
             throw Exception(ErrorCodes::BAD_ARGUMENTS, "DELETE FROM without any predication is not supported. Please use TRUNCATE instead.");
 
+        if (!metadata_snapshot->hasUniqueKey())
+        {
+            /// Ordinary table: mark the matching rows in delete bitmaps instead of rewriting parts.
+            auto * cnch_table = dynamic_cast<StorageCnchMergeTree *>(table.get());
+            if (!cnch_table)
+                throw Exception(
+                    ErrorCodes::BAD_ARGUMENTS, "DELETE query is not supported for table {}", table->getStorageID().getFullTableName());
+
+            cnch_table->executeLightweightDelete(delete_query.predicate, getContext());
+            return {};
+        }
+
         /// Convert the DELETE FROM query to a INSERT query to mark target rows as deleted.
         Names unique_key_columns = metadata_snapshot->getColumnsRequiredForUniqueKey();
         NameSet all_key_columns(unique_key_columns.begin(), unique_key_columns.end());
@@ -30,6 +30,7 @@
 #include <Parsers/ASTOrderByElement.h>
 #include <Parsers/ASTSampleRatio.h>
 #include <Parsers/ASTSelectWithUnionQuery.h>
+#include <Parsers/ASTSubquery.h>
 #include <Parsers/ASTTablesInSelectQuery.h>
 #include <Parsers/ExpressionListParsers.h>
 #include <Parsers/parseQuery.h>
@@ -293,6 +294,104 @@ static bool shouldIgnoreQuotaAndLimits(const StorageID & table_id)
     return false;
 }
 
+/// Multiplies additive aggregates (count, sum) by any(_sample_factor) so that
+/// their values computed over a SAMPLE read scale back up to the full table.
+/// Returns false when the expression contains an aggregate (or a subquery) the
+/// rewrite cannot prove safe to run on a sample, see tryRewriteForApproximateQuery.
+static bool scaleAdditiveAggregates(ASTPtr & node, bool & found_aggregate)
+{
+    if (auto * function = node->as<ASTFunction>())
+    {
+        if (function->is_window_function)
+            return false;
+
+        auto lower_name = Poco::toLower(function->name);
+        if (lower_name == "count" || lower_name == "sum")
+        {
+            found_aggregate = true;
+            String alias = function->tryGetAlias();
+            auto inner = node->clone();
+            inner->setAlias("");
+            auto scaled = makeASTFunction("multiply", inner, makeASTFunction("any", std::make_shared<ASTIdentifier>("_sample_factor")));
+            scaled->setAlias(alias.empty() ? node->getColumnName() : alias);
+            node = scaled;
+            return true;
+        }
+
+        /// Estimators of per-row values are unaffected by uniform sampling.
+        if (lower_name == "avg" || lower_name == "min" || lower_name == "max")
+        {
+            found_aggregate = true;
+            return true;
+        }
+
+        if (AggregateFunctionFactory::instance().isAggregateFunctionName(function->name))
+            return false;
+
+        if (function->arguments)
+            for (auto & argument : function->arguments->children)
+                if (!scaleAdditiveAggregates(argument, found_aggregate))
+                    return false;
+        return true;
+    }
+
+    if (node->as<ASTSubquery>())
+        return false;
+
+    for (auto & child : node->children)
+        if (!scaleAdditiveAggregates(child, found_aggregate))
+            return false;
+    return true;
+}
+
+/// Approximate query mode: turn a plain aggregation over a table with a sampling
+/// key into the same aggregation over SAMPLE <ratio>, scaling the additive
+/// aggregates back up with the realized _sample_factor. The sampling key gives a
+/// precomputed pseudo-random subset clustered on disk, so scans touch roughly
+/// ratio of the data. Leaves the query untouched (and exact) whenever the scaled
+/// result would not be meaningful.
+static bool tryRewriteForApproximateQuery(ASTSelectQuery & query, Float64 sample_ratio)
+{
+    if (!(sample_ratio > 0.0 && sample_ratio < 1.0))
+        return false;
+
+    if (query.sampleSize() || query.final() || query.distinct || query.limitBy() || !query.select())
+        return false;
+
+    auto select_list = query.select()->clone();
+    auto having = query.having() ? query.having()->clone() : nullptr;
+    auto order_by = query.orderBy() ? query.orderBy()->clone() : nullptr;
+
+    bool found_aggregate = false;
+    for (auto & element : select_list->children)
+        if (!scaleAdditiveAggregates(element, found_aggregate))
+            return false;
+    if (having && !scaleAdditiveAggregates(having, found_aggregate))
+        return false;
+    if (order_by && !scaleAdditiveAggregates(order_by, found_aggregate))
+        return false;
+
+    /// Without an aggregate to scale there is nothing approximate to answer:
+    /// silently dropping rows from a plain SELECT is not acceptable.
+    if (!found_aggregate)
+        return false;
+
+    static constexpr UInt64 ratio_precision = 1000000;
+    ASTSampleRatio::Rational ratio;
+    ratio.numerator = static_cast<UInt64>(sample_ratio * ratio_precision);
+    ratio.denominator = ratio_precision;
+    if (ratio.numerator == 0)
+        return false;
+
+    query.setExpression(ASTSelectQuery::Expression::SELECT, std::move(select_list));
+    if (having)
+        query.setExpression(ASTSelectQuery::Expression::HAVING, std::move(having));
+    if (order_by)
+        query.setExpression(ASTSelectQuery::Expression::ORDER_BY, std::move(order_by));
+    query.setExpression(ASTSelectQuery::Expression::SAMPLE_SIZE, std::make_shared<ASTSampleRatio>(ratio));
+    return true;
+}
+
 InterpreterSelectQuery::InterpreterSelectQuery(
     const ASTPtr & query_ptr_,
     ContextPtr context_,
@@ -400,6 +499,17 @@ InterpreterSelectQuery::InterpreterSelectQuery(
     if (storage)
         view = dynamic_cast<StorageView *>(storage.get());
 
+    if (settings.enable_approximate_query && !has_input && storage && storage->supportsSampling()
+        && joined_tables.tablesCount() == 1 && !options.is_subquery && !options.is_projection_query)
+    {
+        if (tryRewriteForApproximateQuery(query, settings.approximate_query_sample_ratio))
+            LOG_DEBUG(
+                log,
+                "Approximate query mode: reading a {} sample of {} and scaling additive aggregates by _sample_factor",
+                settings.approximate_query_sample_ratio.value,
+                table_id.getNameForLogs());
+    }
+
     /// Reuse already built sets for multiple passes of analysis
     SubqueriesForSets subquery_for_sets;
     PreparedSets prepared_sets;
@@ -2209,7 +2319,7 @@ static Aggregator::Params getAggregatorParams(
         settings.max_entries_for_hash_table_stats,
         settings.max_size_to_preallocate_for_aggregation);
 
-    return Aggregator::Params
+    Aggregator::Params params
     {
         src_header_,
         keys,
@@ -2229,6 +2339,9 @@ static Aggregator::Params getAggregatorParams(
         Block{},
         stats_collecting_params
     };
+    params.enable_selective_spill = settings.enable_selective_group_by_spill;
+    params.columnar_spill = settings.spill_columnar_format;
+    return params;
 }
 
 static GroupingSetsParamsList getAggregatorGroupingSetsParams(
@@ -15,10 +15,17 @@
 
 #include <Analyzers/QueryAnalyzer.h>
 #include <Analyzers/QueryRewriter.h>
+#include <Catalog/Catalog.h>
+#include <Interpreters/DatabaseAndTableWithAlias.h>
+#include <Parsers/ASTTablesInSelectQuery.h>
+#include <Storages/PartCacheManager.h>
+#include <Common/ThreadPool.h>
 #include <Interpreters/Context.h>
+#include <Interpreters/DistributedStages/AdaptiveQueryFeedback.h>
 #include <Interpreters/DistributedStages/executePlanSegment.h>
 #include <Interpreters/InterpreterSelectQueryUseOptimizer.h>
 #include <Interpreters/SegmentScheduler.h>
+#include <Optimizer/PlanCacheManager.h>
 #include <Optimizer/PlanNodeSearcher.h>
 #include <Optimizer/PlanOptimizer.h>
 #include <QueryPlan/GraphvizPrinter.h>
@@ -30,6 +37,87 @@
 
 namespace DB
 {
+static void collectTablesForPrefetch(const ASTPtr & node, const String & current_database, std::vector<std::pair<String, String>> & tables)
+{
+    if (!node)
+        return;
+
+    if (const auto * table_expr = node->as<ASTTableExpression>())
+    {
+        if (table_expr->database_and_table_name)
+        {
+            DatabaseAndTableWithAlias db_and_table(table_expr->database_and_table_name, current_database);
+            if (!db_and_table.table.empty())
+                tables.emplace_back(db_and_table.database, db_and_table.table);
+        }
+    }
+
+    for (const auto & child : node->children)
+        collectTablesForPrefetch(child, current_database, tables);
+}
+
+void InterpreterSelectQueryUseOptimizer::prefetchTablesMetadata()
+{
+    if (!context->getSettingsRef().enable_query_metadata_prefetch)
+        return;
+    if (context->getServerType() != ServerType::cnch_server || !context->getCnchCatalog())
+        return;
+
+    std::vector<std::pair<String, String>> tables;
+    collectTablesForPrefetch(query_ptr, context->getCurrentDatabase(), tables);
+
+    for (auto & table_name : tables)
+    {
+        /// Fire-and-forget: the tasks only warm CnchStorageCache and the PartCacheManager table
+        /// meta entries, their results are discarded. Queries proceed unchanged if scheduling fails.
+        ContextMutablePtr query_context = context;
+        GlobalThreadPool::instance().trySchedule([query_context, database = table_name.first, table = table_name.second] {
+            try
+            {
+                auto catalog = query_context->getCnchCatalog();
+                if (!catalog)
+                    return;
+                auto storage = catalog->tryGetTable(*query_context, database, table);
+                if (storage)
+                {
+                    if (auto cache_manager = query_context->getPartCacheManager())
+                        cache_manager->mayUpdateTableMeta(*storage);
+                }
+            }
+            catch (...)
+            {
+                tryLogDebugCurrentException("MetadataPrefetcher");
+            }
+        });
+    }
+}
+
+void InterpreterSelectQueryUseOptimizer::applyAdaptiveReplanFeedback()
+{
+    if (!context->getSettingsRef().enable_adaptive_replan)
+        return;
+
+    /// Key the query by the tree hash of the unrewritten AST, so that every execution of the
+    /// same query text maps to the same feedback entry.
+    auto tree_hash = query_ptr->getTreeHash();
+    UInt64 query_hash = tree_hash.first ^ tree_hash.second;
+    auto & feedback = AdaptiveQueryFeedback::getInstance();
+    feedback.registerQuery(context->getCurrentQueryId(), query_hash);
+
+    if (UInt64 overflow_rows = feedback.getBroadcastOverflowRows(query_hash))
+    {
+        /// A previous execution broadcast far more rows than the planner expected. Disable
+        /// broadcast join enumeration so the re-plan uses repartition joins; joins that can
+        /// only be replicated (e.g. cross joins) keep broadcasting. The changed setting also
+        /// keys the plan cache, so the mis-planned cached plan is not reused.
+        LOG_INFO(
+            log,
+            "A previous execution pushed {} rows into a broadcast exchange, re-planning without broadcast joins",
+            overflow_rows);
+        context->setSetting("enum_replicate", false);
+    }
+}
+
 QueryPlanPtr InterpreterSelectQueryUseOptimizer::buildQueryPlan()
 {
         // When interpret sub query, reuse context info, e.g. PlanNodeIdAllocator, SymbolAllocator.
@@ -44,12 +132,24 @@ QueryPlanPtr InterpreterSelectQueryUseOptimizer::buildQueryPlan()
     context->createSymbolAllocator();
     context->createOptimizerMetrics();
 
+    applyAdaptiveReplanFeedback();
+
+    /// Warm metadata caches in the background while the optimizer stages below run.
+    prefetchTablesMetadata();
+
     Stopwatch stage_watch;
 
     stage_watch.start();
     query_ptr = QueryRewriter::rewrite(query_ptr, context);
     LOG_DEBUG(log, "optimizer stage run time: rewrite, {} ms", stage_watch.elapsedMillisecondsAsDouble());
- 
+
+    stage_watch.restart();
+    if (auto cached_plan = PlanCacheManager::instance().tryGetPlan(query_ptr, context))
+    {
+        LOG_DEBUG(log, "optimizer stage run time: plan cache hit, {} ms", stage_watch.elapsedMillisecondsAsDouble());
+        return cached_plan;
+    }
+
     stage_watch.restart();
     AnalysisPtr analysis = QueryAnalyzer::analyze(query_ptr, context);
     LOG_DEBUG(log, "optimizer stage run time: analyze, {} ms", stage_watch.elapsedMillisecondsAsDouble());
@@ -62,15 +162,35 @@ QueryPlanPtr InterpreterSelectQueryUseOptimizer::buildQueryPlan()
     PlanOptimizer::optimize(*query_plan, context);
     LOG_DEBUG(log, "optimizer stage run time: optimize, {} ms", stage_watch.elapsedMillisecondsAsDouble());
 
+    PlanCacheManager::instance().addPlan(query_ptr, *query_plan, context);
+
     return query_plan;
 }
 
+/// Largest estimated intermediate result in the plan, a proxy for the query's peak
+/// working set. Nodes without derived statistics contribute nothing.
+static UInt64 maxEstimatedNodeOutputBytes(const PlanNodePtr & node)
+{
+    UInt64 max_bytes = 0;
+    if (node->getStatistics().has_value())
+        max_bytes = node->getStatistics().value()->getOutputSizeInBytes();
+    for (const auto & child : node->getChildren())
+        max_bytes = std::max(max_bytes, maxEstimatedNodeOutputBytes(child));
+    return max_bytes;
+}
+
 BlockIO InterpreterSelectQueryUseOptimizer::execute()
 {
     Stopwatch stage_watch, total_watch;
     total_watch.start();
     QueryPlanPtr query_plan = buildQueryPlan();
 
+    /// Expose the planner's cost estimate to resource group admission. Downstream plan
+    /// segments inherit the setting with the rest of the query settings, so workers
+    /// charge them against byte budgets instead of the flat per-query floor.
+    if (UInt64 estimated_bytes = maxEstimatedNodeOutputBytes(query_plan->getPlanNode()))
+        context->setSetting("query_estimated_memory_bytes", estimated_bytes);
+
     stage_watch.start();
     QueryPlan plan = PlanNodeToNodeVisitor::convert(*query_plan);
 
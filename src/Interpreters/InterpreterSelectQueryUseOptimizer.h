@@ -49,12 +49,20 @@ public:
 
     BlockIO execute() override;
 
+    /// Kick off background warming of table and part metadata caches for the tables referenced
+    /// by the query, overlapping metastore I/O with the CPU-bound rewrite/analyze/optimize stages.
+    void prefetchTablesMetadata();
+
     void extendQueryLogElemImpl(QueryLogElement & elem, const ASTPtr &, ContextPtr) const override
     {
         elem.query_kind = "Select";
     }
 
 private:
+    /// Consult runtime feedback from previous executions of the query and adjust planning
+    /// settings before optimization, see AdaptiveQueryFeedback.
+    void applyAdaptiveReplanFeedback();
+
     ASTPtr query_ptr;
     PlanNodePtr sub_plan_ptr;
     CTEInfo cte_info;
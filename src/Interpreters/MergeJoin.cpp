@@ -29,6 +29,7 @@
 #include <Interpreters/sortBlock.h>
 #include <Interpreters/join_common.h>
 #include <DataStreams/materializeBlock.h>
+#include <DataStreams/ColumnarSpillFile.h>
 #include <DataStreams/TemporaryFileStream.h>
 #include <Processors/Sources/SourceFromInputStream.h>
 #include <Processors/QueryPipeline.h>
@@ -968,6 +969,11 @@ std::shared_ptr<Block> MergeJoin::loadRightBlock(size_t pos) const
     {
         auto load_func = [&]() -> std::shared_ptr<Block>
         {
+            if (table_join->columnarSpillFormat())
+            {
+                ColumnarSpillBlockInputStream input(flushed_right_blocks[pos]->path(), materializeBlock(right_sample_block));
+                return std::make_shared<Block>(input.read());
+            }
             TemporaryFileStream input(flushed_right_blocks[pos]->path(), materializeBlock(right_sample_block));
             return std::make_shared<Block>(input.block_in->read());
         };
@@ -982,7 +988,7 @@ void MergeJoin::initRightTableWriter()
 {
     disk_writer = std::make_unique<SortedBlocksWriter>(size_limits, table_join->getTemporaryVolume(),
                     right_sample_block, right_sort_description, max_rows_in_right_block, max_files_to_merge,
-                    table_join->temporaryFilesCodec());
+                    table_join->temporaryFilesCodec(), table_join->columnarSpillFormat());
     disk_writer->addBlocks(right_blocks);
     right_blocks.clear();
 }
@@ -140,7 +140,16 @@ NamesAndTypesList QueryLogElement::getNamesAndTypes()
         {"used_formats", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())},
         {"used_functions", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())},
         {"used_storages", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())},
-        {"used_table_functions", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())}
+        {"used_table_functions", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())},
+
+        {"plan_step_names", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())},
+        {"plan_step_input_rows", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"plan_step_input_bytes", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"plan_step_output_rows", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"plan_step_output_bytes", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"plan_step_elapsed_us", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"plan_step_input_wait_us", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"plan_step_output_wait_us", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())}
     };
 
 }
@@ -277,6 +286,38 @@ void QueryLogElement::appendToBlock(MutableColumns & columns) const
         fill_column(used_storages, column_storage_factory_objects);
         fill_column(used_table_functions, column_table_function_factory_objects);
     }
+
+    {
+        auto & column_step_names = typeid_cast<ColumnArray &>(*columns[i++]);
+        auto & column_step_input_rows = typeid_cast<ColumnArray &>(*columns[i++]);
+        auto & column_step_input_bytes = typeid_cast<ColumnArray &>(*columns[i++]);
+        auto & column_step_output_rows = typeid_cast<ColumnArray &>(*columns[i++]);
+        auto & column_step_output_bytes = typeid_cast<ColumnArray &>(*columns[i++]);
+        auto & column_step_elapsed_us = typeid_cast<ColumnArray &>(*columns[i++]);
+        auto & column_step_input_wait_us = typeid_cast<ColumnArray &>(*columns[i++]);
+        auto & column_step_output_wait_us = typeid_cast<ColumnArray &>(*columns[i++]);
+
+        auto fill_values = [this](ColumnArray & column, auto && getter)
+        {
+            for (const auto & step : plan_step_profiles)
+                column.getData().insert(getter(step));
+            auto & offsets = column.getOffsets();
+            offsets.push_back(offsets.back() + plan_step_profiles.size());
+        };
+
+        for (const auto & step : plan_step_profiles)
+            column_step_names.getData().insertData(step.name.data(), step.name.size());
+        auto & name_offsets = column_step_names.getOffsets();
+        name_offsets.push_back(name_offsets.back() + plan_step_profiles.size());
+
+        fill_values(column_step_input_rows, [](const auto & step) { return step.input_rows; });
+        fill_values(column_step_input_bytes, [](const auto & step) { return step.input_bytes; });
+        fill_values(column_step_output_rows, [](const auto & step) { return step.output_rows; });
+        fill_values(column_step_output_bytes, [](const auto & step) { return step.output_bytes; });
+        fill_values(column_step_elapsed_us, [](const auto & step) { return step.elapsed_us; });
+        fill_values(column_step_input_wait_us, [](const auto & step) { return step.input_wait_us; });
+        fill_values(column_step_output_wait_us, [](const auto & step) { return step.output_wait_us; });
+    }
 }
 
 void QueryLogElement::appendClientInfo(const ClientInfo & client_info, MutableColumns & columns, size_t & i)
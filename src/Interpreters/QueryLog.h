@@ -81,6 +81,22 @@ struct QueryLogElement
     std::shared_ptr<ProfileEvents::Counters> profile_counters;
     std::shared_ptr<Settings> query_settings;
 
+    /// Per plan step execution counters aggregated over the pipeline processors, used to
+    /// find the bottleneck stage of a logged query. Rows/bytes only count step boundaries,
+    /// not the edges between processors of the same step.
+    struct PlanStepProfile
+    {
+        String name;
+        UInt64 input_rows{};
+        UInt64 input_bytes{};
+        UInt64 output_rows{};
+        UInt64 output_bytes{};
+        UInt64 elapsed_us{};
+        UInt64 input_wait_us{};
+        UInt64 output_wait_us{};
+    };
+    std::vector<PlanStepProfile> plan_step_profiles;
+
     static std::string name() { return "QueryLog"; }
 
     static NamesAndTypesList getNamesAndTypes();
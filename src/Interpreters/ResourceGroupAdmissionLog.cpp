@@ -0,0 +1,76 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Interpreters/ResourceGroupAdmissionLog.h>
+
+#include <DataTypes/DataTypeDate.h>
+#include <DataTypes/DataTypeDateTime.h>
+#include <DataTypes/DataTypeEnum.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+
+namespace DB
+{
+
+NamesAndTypesList ResourceGroupAdmissionLogElement::getNamesAndTypes()
+{
+    auto outcome_datatype = std::make_shared<DataTypeEnum8>(DataTypeEnum8::Values{
+        {"RunImmediately", static_cast<Int8>(RUN_IMMEDIATELY)},
+        {"Dequeued", static_cast<Int8>(DEQUEUED)},
+        {"TimedOut", static_cast<Int8>(TIMED_OUT)},
+        {"Rejected", static_cast<Int8>(REJECTED)},
+    });
+
+    return {
+        {"event_date", std::make_shared<DataTypeDate>()},
+        {"event_time", std::make_shared<DataTypeDateTime>()},
+
+        {"query_id", std::make_shared<DataTypeString>()},
+        {"group", std::make_shared<DataTypeString>()},
+
+        {"outcome", std::move(outcome_datatype)},
+        {"wait_ms", std::make_shared<DataTypeUInt64>()},
+
+        {"running_queries", std::make_shared<DataTypeUInt64>()},
+        {"queued_queries", std::make_shared<DataTypeUInt64>()},
+        {"max_concurrent_queries", std::make_shared<DataTypeInt32>()},
+        {"max_queued", std::make_shared<DataTypeInt32>()},
+        {"cached_memory_usage_bytes", std::make_shared<DataTypeInt64>()},
+        {"estimated_memory_bytes", std::make_shared<DataTypeInt64>()},
+    };
+}
+
+void ResourceGroupAdmissionLogElement::appendToBlock(MutableColumns & columns) const
+{
+    size_t i = 0;
+
+    columns[i++]->insert(DateLUT::instance().toDayNum(event_time).toUnderType());
+    columns[i++]->insert(event_time);
+
+    columns[i++]->insert(query_id);
+    columns[i++]->insert(group);
+
+    columns[i++]->insert(outcome);
+    columns[i++]->insert(wait_ms);
+
+    columns[i++]->insert(running_queries);
+    columns[i++]->insert(queued_queries);
+    columns[i++]->insert(max_concurrent_queries);
+    columns[i++]->insert(max_queued);
+    columns[i++]->insert(cached_memory_usage_bytes);
+    columns[i++]->insert(estimated_memory_bytes);
+}
+
+}
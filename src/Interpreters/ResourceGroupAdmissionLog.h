@@ -0,0 +1,66 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Interpreters/SystemLog.h>
+
+namespace DB
+{
+
+/// One row per query admission decision of a resource group, so queue behavior
+/// can be analyzed (and concurrency limits tuned) from
+/// system.resource_group_admission_log instead of guessing. The rows are also
+/// the input format of utils/resource-group-simulator, which replays a logged
+/// workload against candidate limits.
+struct ResourceGroupAdmissionLogElement
+{
+    enum Outcome
+    {
+        RUN_IMMEDIATELY = 1,
+        DEQUEUED = 2,
+        TIMED_OUT = 3,
+        REJECTED = 4,
+    };
+
+    time_t event_time = 0;
+
+    String query_id;
+    /// Group the query was admitted to (the leaf it was submitted to).
+    String group;
+
+    Outcome outcome = RUN_IMMEDIATELY;
+    /// Time spent in the queue; 0 when the query got a slot immediately.
+    UInt64 wait_ms = 0;
+
+    /// Slot state of the group at the moment of the decision, descendants included.
+    UInt64 running_queries = 0;
+    UInt64 queued_queries = 0;
+    Int32 max_concurrent_queries = 0;
+    Int32 max_queued = 0;
+    Int64 cached_memory_usage_bytes = 0;
+    Int64 estimated_memory_bytes = 0;
+
+    static std::string name() { return "ResourceGroupAdmissionLog"; }
+    static NamesAndTypesList getNamesAndTypes();
+    static NamesAndAliases getNamesAndAliases() { return {}; }
+    void appendToBlock(MutableColumns & columns) const;
+};
+
+class ResourceGroupAdmissionLog : public SystemLog<ResourceGroupAdmissionLogElement>
+{
+    using SystemLog<ResourceGroupAdmissionLogElement>::SystemLog;
+};
+
+}
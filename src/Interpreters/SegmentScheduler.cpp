@@ -22,6 +22,7 @@
 #include <IO/MemoryReadWriteBuffer.h>
 #include <Interpreters/Cluster.h>
 #include <Interpreters/Context_fwd.h>
+#include <Interpreters/DistributedStages/AdaptiveQueryFeedback.h>
 #include <Interpreters/DistributedStages/PlanSegment.h>
 #include <Interpreters/DistributedStages/PlanSegmentManagerRpcService.h>
 #include <Interpreters/DistributedStages/executePlanSegment.h>
@@ -72,6 +73,8 @@ SegmentScheduler::insertPlanSegments(const String & query_id, PlanSegmentTree *
 {
     std::shared_ptr<DAGGraph> dag_ptr = std::make_shared<DAGGraph>();
     buildDAGGraph(plan_segments_ptr, dag_ptr);
+    if (query_context->getSettingsRef().enable_adaptive_replan)
+        dag_ptr->adaptive_broadcast_overflow_rows = query_context->getSettingsRef().max_replicate_shuffle_size;
     {
         std::unique_lock<bthread::Mutex> lock(mutex);
         if (query_map.find(query_id) != query_map.end())
@@ -170,7 +173,7 @@ void SegmentScheduler::cancelWorkerPlanSegments(const String & query_id, const D
     for (const auto & addr : dag_ptr->plan_send_addresses)
     {
         auto address = extractExchangeStatusHostPort(addr);
-        std::shared_ptr<RpcClient> rpc_client = RpcChannelPool::getInstance().getClient(address, BrpcChannelPoolOptions::DEFAULT_CONFIG_KEY, true);
+        std::shared_ptr<RpcClient> rpc_client = RpcChannelPool::getInstance().getClient(address, BrpcChannelPoolOptions::CONTROL_DEFAULT_CONFIG_KEY, true);
         Protos::PlanSegmentManagerService_Stub manager(&rpc_client->getChannel());
         brpc::Controller cntl;
         Protos::CancelQueryRequest request;
@@ -197,6 +200,7 @@ bool SegmentScheduler::finishPlanSegments(const String & query_id)
         segment_status_map.erase(seg_status_map_ite);
 
     query_to_exception_with_code.remove(query_id);
+    AdaptiveQueryFeedback::getInstance().unregisterQuery(query_id);
     return true;
 }
 
@@ -245,6 +249,48 @@ void SegmentScheduler::updateSegmentStatus(const RuntimeSegmentsStatus & segment
     status->is_canceled = segment_status.is_canceled;
     status->message = segment_status.message;
     status->code = segment_status.code;
+    /// Every parallel instance of the segment reports separately; accumulate them
+    status->output_rows += segment_status.output_rows;
+    status->output_bytes += segment_status.output_bytes;
+    status->execution_time_ms = std::max(status->execution_time_ms, segment_status.execution_time_ms);
+    UInt64 accumulated_output_rows = status->output_rows;
+    lock.unlock();
+
+    if (segment_status.is_succeed && accumulated_output_rows > 0)
+        checkBroadcastOverflow(segment_status.query_id, segment_status.segment_id, accumulated_output_rows);
+}
+
+void SegmentScheduler::checkBroadcastOverflow(const String & query_id, size_t segment_id, UInt64 output_rows)
+{
+    bool broadcast_overflow = false;
+    {
+        std::unique_lock<bthread::Mutex> lock(mutex);
+        auto query_iter = query_map.find(query_id);
+        if (query_iter == query_map.end())
+            return;
+        const auto & dag_ptr = query_iter->second;
+        if (!dag_ptr->adaptive_broadcast_overflow_rows || output_rows <= dag_ptr->adaptive_broadcast_overflow_rows)
+            return;
+        auto segment_iter = dag_ptr->id_to_segment.find(segment_id);
+        if (segment_iter == dag_ptr->id_to_segment.end())
+            return;
+        for (const auto & output : segment_iter->second->getPlanSegmentOutputs())
+        {
+            if (output->getExchangeMode() == ExchangeMode::BROADCAST)
+                broadcast_overflow = true;
+        }
+    }
+    if (broadcast_overflow)
+    {
+        LOG_WARNING(
+            log,
+            "Segment {} of query {} pushed {} rows into a broadcast exchange, the next execution will be re-planned without broadcast "
+            "joins",
+            segment_id,
+            query_id,
+            output_rows);
+        AdaptiveQueryFeedback::getInstance().recordBroadcastOverflow(query_id, output_rows);
+    }
 }
 
 void SegmentScheduler::updateException(const String & query_id, const String & exception, int code)
@@ -432,6 +478,7 @@ bool SegmentScheduler::scheduler(const String & query_id, ContextPtr query_conte
     {
         UInt64 total_send_time_ms = 0;
         Stopwatch watch;
+        dag_graph_ptr->batch_segment_dispatch = query_context->getSettingsRef().enable_batch_send_plan_segments;
         /// random pick workers
         const auto & worker_group = query_context->tryGetCurrentWorkerGroup();
         std::vector<size_t> random_worker_ids;
@@ -443,6 +490,10 @@ bool SegmentScheduler::scheduler(const String & query_id, ContextPtr query_conte
             std::iota(random_worker_ids.begin(), random_worker_ids.end(), 0);
             thread_local std::random_device rd;
             std::shuffle(random_worker_ids.begin(), random_worker_ids.end(), rd);
+            /// The shuffled order is reused for every segment of this query, so parallel
+            /// instance k of adjacent segments lands on the same worker. This keeps
+            /// LOCAL_* exchanges inside one process and makes 1/N of repartition traffic
+            /// take the zero-serialization local channel, see ExchangeUtils::isLocalExchange.
         }
 
         // scheduler source
@@ -515,6 +566,20 @@ bool SegmentScheduler::scheduler(const String & query_id, ContextPtr query_conte
                 }
             }
         }
+
+        /// Flush batched dispatch: every segment of this query destined for one worker
+        /// goes out in a single rpc. The scheduling loop above is pure local computation,
+        /// so all workers start their whole pipeline at once; senders and receivers
+        /// already tolerate data arriving before every registration through the proxies.
+        if (dag_graph_ptr->batch_segment_dispatch)
+        {
+            watch.restart();
+            for (auto & [address, dispatches] : dag_graph_ptr->plan_segment_batches)
+                executePlanSegmentBatchRemotely(address, dispatches, query_context);
+            dag_graph_ptr->plan_segment_batches.clear();
+            total_send_time_ms += watch.elapsedMilliseconds();
+        }
+
         LOG_DEBUG(log, "SegmentScheduler send plansegments takes:{}", total_send_time_ms);
 
         auto final_it = dag_graph_ptr->id_to_segment.find(dag_graph_ptr->final);
@@ -589,7 +654,16 @@ void sendPlanSegmentToRemote(
 {
     plan_segment_ptr->setCurrentAddress(addressinfo);
 
-    executePlanSegmentRemotely(*plan_segment_ptr, query_context, true);
+    if (dag_graph_ptr && dag_graph_ptr->batch_segment_dispatch)
+    {
+        /// Serialize now (the segment is mutated per worker) but ship later in one
+        /// rpc per worker, see SegmentScheduler::scheduler
+        auto & dispatches = dag_graph_ptr->plan_segment_batches[addressinfo];
+        dispatches.emplace_back();
+        preparePlanSegmentDispatch(dispatches.back(), *plan_segment_ptr, query_context);
+    }
+    else
+        executePlanSegmentRemotely(*plan_segment_ptr, query_context, true);
     if (dag_graph_ptr)
     {
         std::unique_lock<bthread::Mutex> lock(dag_graph_ptr->status_mutex);
@@ -597,6 +671,23 @@ void sendPlanSegmentToRemote(
     }
 }
 
+/// A segment wired to a LOCAL_* exchange must stay on the same worker as the
+/// matching instance of its neighbour segment: moving it to another worker would
+/// leave the local channel dangling. Only segments free of such pinning may be
+/// re-dispatched elsewhere when a worker refuses the segment.
+static bool segmentCanFailover(PlanSegment & plan_segment)
+{
+    for (const auto & input : plan_segment.getPlanSegmentInputs())
+        if (input->getExchangeMode() == ExchangeMode::LOCAL_NO_NEED_REPARTITION
+            || input->getExchangeMode() == ExchangeMode::LOCAL_MAY_NEED_REPARTITION)
+            return false;
+    for (const auto & output : plan_segment.getPlanSegmentOutputs())
+        if (output->getExchangeMode() == ExchangeMode::LOCAL_NO_NEED_REPARTITION
+            || output->getExchangeMode() == ExchangeMode::LOCAL_MAY_NEED_REPARTITION)
+            return false;
+    return true;
+}
+
 AddressInfos SegmentScheduler::sendPlanSegment(
     PlanSegment * plan_segment_ptr,
     bool  /*is_source*/,
@@ -644,19 +735,21 @@ AddressInfos SegmentScheduler::sendPlanSegment(
 
         const auto & worker_group = query_context->getCurrentWorkerGroup();
         const auto & worker_endpoints = worker_group->getHostWithPortsVec();
+        /// Batched dispatch defers the actual rpc, so there is nothing to catch here.
+        bool allow_failover = query_context->getSettingsRef().enable_segment_dispatch_failover
+            && !dag_graph_ptr->batch_segment_dispatch && segmentCanFailover(*plan_segment_ptr);
         size_t parallel_index_id_index = 0;
         // set ParallelIndexId and source address
         for (auto i : random_worker_ids)
         {
-            parallel_index_id_index++;
-            if (parallel_index_id_index > plan_segment_ptr->getParallelSize())
+            if (parallel_index_id_index >= plan_segment_ptr->getParallelSize())
                 break;
             const auto & worker_endpoint = worker_endpoints[i];
             for (const auto& plan_segment_input : plan_segment_ptr->getPlanSegmentInputs())
             {
                 if (plan_segment_input->getPlanSegmentType() != PlanSegmentType::EXCHANGE)
                     continue;
-                plan_segment_input->setParallelIndex(parallel_index_id_index);
+                plan_segment_input->setParallelIndex(parallel_index_id_index + 1);
 
                 // if input mode is local, set parallel index to 1
                 auto it = dag_graph_ptr->id_to_segment.find(plan_segment_input->getPlanSegmentId());
@@ -675,7 +768,27 @@ AddressInfos SegmentScheduler::sendPlanSegment(
                 }
             }
             auto worker_address = getRemoteAddress(worker_endpoint, query_context);
-            sendPlanSegmentToRemote(worker_address, query_context, plan_segment_ptr, dag_graph_ptr);
+            try
+            {
+                sendPlanSegmentToRemote(worker_address, query_context, plan_segment_ptr, dag_graph_ptr);
+            }
+            catch (...)
+            {
+                if (!allow_failover)
+                    throw;
+                /// Re-dispatch this parallel instance to the next worker of the
+                /// shuffled list; downstream wiring follows automatically since
+                /// the address is recorded only on success.
+                tryLogCurrentException(log);
+                LOG_WARNING(
+                    log,
+                    "Dispatch of segment {} instance {} to {} failed, trying the next worker",
+                    plan_segment_ptr->getPlanSegmentId(),
+                    parallel_index_id_index + 1,
+                    worker_address.toString());
+                continue;
+            }
+            ++parallel_index_id_index;
             addresses.emplace_back(std::move(worker_address));
 
 #if defined(TASK_ASSIGN_DEBUG)
@@ -694,6 +807,13 @@ AddressInfos SegmentScheduler::sendPlanSegment(
             }
 #endif
         }
+
+        if (parallel_index_id_index < std::min(plan_segment_ptr->getParallelSize(), random_worker_ids.size()))
+            throw Exception(
+                "Cannot dispatch plan segment " + std::to_string(plan_segment_ptr->getPlanSegmentId()) + ": only "
+                    + std::to_string(parallel_index_id_index) + " of " + std::to_string(plan_segment_ptr->getParallelSize())
+                    + " instances were accepted and no healthy worker is left",
+                ErrorCodes::UNKNOWN_EXCEPTION);
     }
 
 #if defined(TASK_ASSIGN_DEBUG)
@@ -27,6 +27,7 @@
 #include <Interpreters/DistributedStages/AddressInfo.h>
 #include <Interpreters/DistributedStages/PlanSegment.h>
 #include <Interpreters/DistributedStages/PlanSegmentExecutor.h>
+#include <Interpreters/DistributedStages/executePlanSegment.h>
 #include <Parsers/IAST_fwd.h>
 #include <Processors/Exchange/DataTrans/ConcurrentShardMap.h>
 #include <Protos/plan_segment_manager.pb.h>
@@ -85,6 +86,13 @@ struct DAGGraph {
     std::unordered_map<size_t, AddressInfos> id_to_address;
     std::set<AddressInfo> plan_send_addresses;
     PlanSegmentsStatusPtr plan_segment_status_ptr;
+    /// When enable_batch_send_plan_segments is on, dispatches are accumulated here
+    /// per worker during scheduling and flushed as one batched rpc per worker
+    bool batch_segment_dispatch = false;
+    PlanSegmentBatchMap plan_segment_batches;
+    /// When enable_adaptive_replan is on, rows pushed into a broadcast exchange beyond this
+    /// threshold are reported to AdaptiveQueryFeedback; 0 disables the check.
+    UInt64 adaptive_broadcast_overflow_rows = 0;
 #if defined(TASK_ASSIGN_DEBUG)
     std::unordered_map<size_t, std::vector<std::pair<size_t, AddressInfo>>> exchange_data_assign_node_mappings;
 #endif
@@ -132,6 +140,9 @@ private:
 
     void buildDAGGraph(PlanSegmentTree * plan_segments_ptr, std::shared_ptr<DAGGraph> graph);
     bool scheduler(const String & query_id, ContextPtr query_context, std::shared_ptr<DAGGraph> dag_graph);
+    /// Report a finished segment whose accumulated broadcast output exceeded the planner's
+    /// threshold to AdaptiveQueryFeedback, so the next execution is planned without broadcast.
+    void checkBroadcastOverflow(const String & query_id, size_t segment_id, UInt64 output_rows);
 
 protected:
     virtual AddressInfos sendPlanSegment(PlanSegment * plan_segment_ptr, bool is_source, ContextPtr query_context, std::shared_ptr<DAGGraph> dag_graph, std::vector<size_t> random_worker_ids);
@@ -0,0 +1,100 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Interpreters/ServerMergeDecisionLog.h>
+
+#include <Columns/ColumnArray.h>
+#include <DataTypes/DataTypeArray.h>
+#include <DataTypes/DataTypeDate.h>
+#include <DataTypes/DataTypeDateTime.h>
+#include <DataTypes/DataTypeEnum.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypeUUID.h>
+#include <DataTypes/DataTypesNumber.h>
+
+namespace DB
+{
+
+NamesAndTypesList ServerMergeDecisionLogElement::getNamesAndTypes()
+{
+    auto decision_datatype = std::make_shared<DataTypeEnum8>(DataTypeEnum8::Values{
+        {"Selected", static_cast<Int8>(SELECTED)},
+        {"CannotSelect", static_cast<Int8>(CANNOT_SELECT)},
+        {"NothingToMerge", static_cast<Int8>(NOTHING_TO_MERGE)},
+    });
+
+    return {
+        {"event_date", std::make_shared<DataTypeDate>()},
+        {"event_time", std::make_shared<DataTypeDateTime>()},
+
+        {"database", std::make_shared<DataTypeString>()},
+        {"table", std::make_shared<DataTypeString>()},
+        {"uuid", std::make_shared<DataTypeUUID>()},
+
+        {"selector", std::make_shared<DataTypeString>()},
+        {"aggressive", std::make_shared<DataTypeUInt8>()},
+        {"max_total_size_to_merge", std::make_shared<DataTypeUInt64>()},
+
+        {"input_parts", std::make_shared<DataTypeUInt64>()},
+        {"candidate_parts", std::make_shared<DataTypeUInt64>()},
+        {"candidate_ranges", std::make_shared<DataTypeUInt64>()},
+
+        {"decision", std::move(decision_datatype)},
+        {"reason", std::make_shared<DataTypeString>()},
+
+        {"selected_range_parts", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"selected_range_bytes", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+
+        {"elapsed_us", std::make_shared<DataTypeUInt64>()},
+    };
+}
+
+void ServerMergeDecisionLogElement::appendToBlock(MutableColumns & columns) const
+{
+    size_t i = 0;
+
+    columns[i++]->insert(DateLUT::instance().toDayNum(event_time).toUnderType());
+    columns[i++]->insert(event_time);
+
+    columns[i++]->insert(database_name);
+    columns[i++]->insert(table_name);
+    columns[i++]->insert(uuid);
+
+    columns[i++]->insert(selector);
+    columns[i++]->insert(aggressive);
+    columns[i++]->insert(max_total_size_to_merge);
+
+    columns[i++]->insert(input_parts);
+    columns[i++]->insert(candidate_parts);
+    columns[i++]->insert(candidate_ranges);
+
+    columns[i++]->insert(UInt64(decision));
+    columns[i++]->insert(reason);
+
+    auto fill_array = [](const std::vector<UInt64> & values, IColumn & column)
+    {
+        Array array;
+        array.reserve(values.size());
+        for (const auto & value : values)
+            array.emplace_back(value);
+        column.insert(array);
+    };
+    fill_array(selected_range_parts, *columns[i++]);
+    fill_array(selected_range_bytes, *columns[i++]);
+
+    columns[i++]->insert(elapsed_us);
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Interpreters/SystemLog.h>
+
+namespace DB
+{
+
+/// One row per merge part-selection round on the server, so "why does the part
+/// count climb but nothing merges" can be answered from system.server_merge_decisions
+/// instead of log grepping.
+struct ServerMergeDecisionLogElement
+{
+    enum Decision
+    {
+        SELECTED = 1,
+        CANNOT_SELECT = 2,
+        NOTHING_TO_MERGE = 3,
+    };
+
+    time_t event_time = 0;
+
+    String database_name;
+    String table_name;
+    UUID uuid{};
+
+    /// Merge selector algorithm used this round (dance/simple).
+    String selector;
+    UInt8 aggressive = 0;
+    UInt64 max_total_size_to_merge = 0;
+
+    /// Visible parts offered to this round.
+    UInt64 input_parts = 0;
+    /// Parts passing the can-merge precondition (no running merge, no uncommitted txn, ...).
+    UInt64 candidate_parts = 0;
+    /// Contiguous mergeable ranges the candidates formed.
+    UInt64 candidate_ranges = 0;
+
+    Decision decision = CANNOT_SELECT;
+    /// Why nothing was selected; empty when parts were selected.
+    String reason;
+
+    /// Per selected range: part count and total bytes.
+    std::vector<UInt64> selected_range_parts;
+    std::vector<UInt64> selected_range_bytes;
+
+    UInt64 elapsed_us = 0;
+
+    static std::string name() { return "ServerMergeDecisionLog"; }
+    static NamesAndTypesList getNamesAndTypes();
+    static NamesAndAliases getNamesAndAliases() { return {}; }
+    void appendToBlock(MutableColumns & columns) const;
+};
+
+class ServerMergeDecisionLog : public SystemLog<ServerMergeDecisionLogElement>
+{
+    using SystemLog<ServerMergeDecisionLogElement>::SystemLog;
+};
+
+}
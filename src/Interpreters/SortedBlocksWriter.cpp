@@ -2,6 +2,7 @@
 #include <Interpreters/SortedBlocksWriter.h>
 #include <DataStreams/MergingSortedBlockInputStream.h>
 #include <DataStreams/OneBlockInputStream.h>
+#include <DataStreams/ColumnarSpillFile.h>
 #include <DataStreams/TemporaryFileStream.h>
 #include <DataStreams/materializeBlock.h>
 #include <Disks/IVolume.h>
@@ -17,12 +18,16 @@ namespace ErrorCodes
 namespace
 {
 
-std::unique_ptr<TemporaryFile> flushToFile(const String & tmp_path, const Block & header, IBlockInputStream & stream, const String & codec)
+std::unique_ptr<TemporaryFile> flushToFile(const String & tmp_path, const Block & header, IBlockInputStream & stream,
+                                           const String & codec, bool columnar_spill)
 {
     auto tmp_file = createTemporaryFile(tmp_path);
 
     std::atomic<bool> is_cancelled{false};
-    TemporaryFileStream::write(tmp_file->path(), header, stream, &is_cancelled, codec);
+    if (columnar_spill)
+        ColumnarSpillWriter::write(tmp_file->path(), header, stream, &is_cancelled, codec);
+    else
+        TemporaryFileStream::write(tmp_file->path(), header, stream, &is_cancelled, codec);
     if (is_cancelled)
         throw Exception("Cannot flush MergeJoin data on disk. No space at " + tmp_path, ErrorCodes::NOT_ENOUGH_SPACE);
 
@@ -30,7 +35,8 @@ std::unique_ptr<TemporaryFile> flushToFile(const String & tmp_path, const Block
 }
 
 SortedBlocksWriter::SortedFiles flushToManyFiles(const String & tmp_path, const Block & header, IBlockInputStream & stream,
-                                                 const String & codec, std::function<void(const Block &)> callback = [](const Block &){})
+                                                 const String & codec, bool columnar_spill,
+                                                 std::function<void(const Block &)> callback = [](const Block &){})
 {
     std::vector<std::unique_ptr<TemporaryFile>> files;
 
@@ -42,7 +48,7 @@ SortedBlocksWriter::SortedFiles flushToManyFiles(const String & tmp_path, const
         callback(block);
 
         OneBlockInputStream block_stream(block);
-        auto tmp_file = flushToFile(tmp_path, header, block_stream, codec);
+        auto tmp_file = flushToFile(tmp_path, header, block_stream, codec, columnar_spill);
         files.emplace_back(std::move(tmp_file));
     }
 
@@ -124,7 +130,7 @@ SortedBlocksWriter::TmpFilePtr SortedBlocksWriter::flush(const BlocksList & bloc
     if (blocks.size() == 1)
     {
         OneBlockInputStream sorted_input(blocks.front());
-        return flushToFile(path, sample_block, sorted_input, codec);
+        return flushToFile(path, sample_block, sorted_input, codec, columnar_spill);
     }
 
     BlockInputStreams inputs;
@@ -134,7 +140,7 @@ SortedBlocksWriter::TmpFilePtr SortedBlocksWriter::flush(const BlocksList & bloc
             inputs.push_back(std::make_shared<OneBlockInputStream>(block));
 
     MergingSortedBlockInputStream sorted_input(inputs, sort_description, rows_in_block);
-    return flushToFile(path, sample_block, sorted_input, codec);
+    return flushToFile(path, sample_block, sorted_input, codec, columnar_spill);
 }
 
 SortedBlocksWriter::PremergedFiles SortedBlocksWriter::premerge()
@@ -174,7 +180,7 @@ SortedBlocksWriter::PremergedFiles SortedBlocksWriter::premerge()
                 if (inputs.size() == num_files_for_merge || &file == &files.back())
                 {
                     MergingSortedBlockInputStream sorted_input(inputs, sort_description, rows_in_block);
-                    new_files.emplace_back(flushToFile(getPath(), sample_block, sorted_input, codec));
+                    new_files.emplace_back(flushToFile(getPath(), sample_block, sorted_input, codec, columnar_spill));
                     inputs.clear();
                 }
             }
@@ -194,11 +200,13 @@ SortedBlocksWriter::SortedFiles SortedBlocksWriter::finishMerge(std::function<vo
 {
     PremergedFiles files = premerge();
     MergingSortedBlockInputStream sorted_input(files.streams, sort_description, rows_in_block);
-    return flushToManyFiles(getPath(), sample_block, sorted_input, codec, callback);
+    return flushToManyFiles(getPath(), sample_block, sorted_input, codec, columnar_spill, callback);
 }
 
 BlockInputStreamPtr SortedBlocksWriter::streamFromFile(const TmpFilePtr & file) const
 {
+    if (columnar_spill)
+        return std::make_shared<ColumnarSpillBlockInputStream>(file->path(), materializeBlock(sample_block));
     return std::make_shared<TemporaryFileLazyInputStream>(file->path(), materializeBlock(sample_block));
 }
 
@@ -70,6 +70,7 @@ struct SortedBlocksWriter
     const size_t rows_in_block;
     const size_t num_files_for_merge;
     const String & codec;
+    const bool columnar_spill = false;
     SortedFiles sorted_files;
     size_t row_count_in_flush = 0;
     size_t bytes_in_flush = 0;
@@ -77,7 +78,8 @@ struct SortedBlocksWriter
     size_t flush_inflight = 0;
 
     SortedBlocksWriter(const SizeLimits & size_limits_, VolumePtr volume_, const Block & sample_block_,
-                       const SortDescription & description, size_t rows_in_block_, size_t num_files_to_merge_, const String & codec_)
+                       const SortDescription & description, size_t rows_in_block_, size_t num_files_to_merge_, const String & codec_,
+                       bool columnar_spill_ = false)
         : size_limits(size_limits_)
         , volume(volume_)
         , sample_block(sample_block_)
@@ -85,6 +87,7 @@ struct SortedBlocksWriter
         , rows_in_block(rows_in_block_)
         , num_files_for_merge(num_files_to_merge_)
         , codec(codec_)
+        , columnar_spill(columnar_spill_)
     {}
 
     void addBlocks(const Blocks & blocks)
@@ -26,6 +26,7 @@
 #include <Interpreters/PartLog.h>
 #include <Interpreters/PartMergeLog.h>
 #include <Interpreters/ServerPartLog.h>
+#include <Interpreters/ServerMergeDecisionLog.h>
 #include <Interpreters/TextLog.h>
 #include <Interpreters/TraceLog.h>
 #include <Interpreters/CrashLog.h>
@@ -36,6 +37,7 @@
 #include <Interpreters/KafkaLog.h>
 #include <Interpreters/ProcessorsProfileLog.h>
 #include <Interpreters/ZooKeeperLog.h>
+#include <Interpreters/ResourceGroupAdmissionLog.h>
 
 #include <Poco/Util/AbstractConfiguration.h>
 #include <common/logger_useful.h>
@@ -131,6 +133,8 @@ SystemLogs::SystemLogs(ContextPtr global_context, const Poco::Util::AbstractConf
     part_log = createSystemLog<PartLog>(global_context, "system", "part_log", config, "part_log", on_worker);
     part_merge_log = createSystemLog<PartMergeLog>(global_context, "system", "part_merge_log", config, "part_merge_log", on_server);
     server_part_log = createSystemLog<ServerPartLog>(global_context, "system", "server_part_log", config, "server_part_log", on_server);
+    server_merge_decision_log = createSystemLog<ServerMergeDecisionLog>(
+        global_context, "system", "server_merge_decisions", config, "server_merge_decision_log", on_server);
     trace_log = createSystemLog<TraceLog>(global_context, "system", "trace_log", config, "trace_log", false);
     crash_log = createSystemLog<CrashLog>(global_context, "system", "crash_log", config, "crash_log", false);
     text_log = createSystemLog<TextLog>(global_context, "system", "text_log", config, "text_log", false);
@@ -145,6 +149,8 @@ SystemLogs::SystemLogs(ContextPtr global_context, const Poco::Util::AbstractConf
     kafka_log = createSystemLog<KafkaLog>(global_context, "system", "kafka_log", config, "kafka_log", true);
     processors_profile_log = createSystemLog<ProcessorsProfileLog>(global_context, "system", "processors_profile_log", config, "processors_profile_log", false);
     zookeeper_log = createSystemLog<ZooKeeperLog>(global_context, "system", "zookeeper_log", config, "zookeeper_log", false);
+    resource_group_admission_log = createSystemLog<ResourceGroupAdmissionLog>(
+        global_context, "system", "resource_group_admission_log", config, "resource_group_admission_log", false);
 
     if (query_log)
         logs.emplace_back(query_log.get());
@@ -159,6 +165,8 @@ SystemLogs::SystemLogs(ContextPtr global_context, const Poco::Util::AbstractConf
         logs.emplace_back(part_merge_log.get());
     if (server_part_log)
         logs.emplace_back(server_part_log.get());
+    if (server_merge_decision_log)
+        logs.emplace_back(server_merge_decision_log.get());
     if (trace_log)
         logs.emplace_back(trace_log.get());
     if (crash_log)
@@ -179,6 +187,8 @@ SystemLogs::SystemLogs(ContextPtr global_context, const Poco::Util::AbstractConf
         logs.emplace_back(processors_profile_log.get());
     if (zookeeper_log)
         logs.emplace_back(zookeeper_log.get());
+    if (resource_group_admission_log)
+        logs.emplace_back(resource_group_admission_log.get());
 
     try
     {
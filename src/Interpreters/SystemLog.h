@@ -107,6 +107,7 @@ class QueryExchangeLog;
 class PartLog;
 class PartMergeLog;
 class ServerPartLog;
+class ServerMergeDecisionLog;
 class TextLog;
 class TraceLog;
 class CrashLog;
@@ -117,6 +118,7 @@ class MutationLog;
 class KafkaLog;
 class ProcessorsProfileLog;
 class ZooKeeperLog;
+class ResourceGroupAdmissionLog;
 
 
 class ISystemLog
@@ -148,6 +150,8 @@ struct SystemLogs
     std::shared_ptr<PartLog> part_log;                  /// Used to log operations with parts
     std::shared_ptr<PartMergeLog> part_merge_log;
     std::shared_ptr<ServerPartLog> server_part_log;
+    /// Merge scheduler part-selection rounds with their outcome and reasons.
+    std::shared_ptr<ServerMergeDecisionLog> server_merge_decision_log;
     std::shared_ptr<TraceLog> trace_log;                /// Used to log traces from query profiler
     std::shared_ptr<CrashLog> crash_log;                /// Used to log server crashes.
     std::shared_ptr<TextLog> text_log;                  /// Used to log all text messages.
@@ -166,6 +170,9 @@ struct SystemLogs
     /// Used to log processors profiling
     std::shared_ptr<ProcessorsProfileLog> processors_profile_log;
 
+    /// Resource group admission decisions (queue waits, slot state at dispatch).
+    std::shared_ptr<ResourceGroupAdmissionLog> resource_group_admission_log;
+
     std::vector<ISystemLog *> logs;
 };
 
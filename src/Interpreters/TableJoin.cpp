@@ -61,6 +61,7 @@ TableJoin::TableJoin(const Settings & settings, VolumePtr tmp_volume_)
     , partial_merge_join_left_table_buffer_bytes(settings.partial_merge_join_left_table_buffer_bytes)
     , max_files_to_merge(settings.join_on_disk_max_files_to_merge)
     , temporary_files_codec(settings.temporary_files_codec)
+    , columnar_spill_format(settings.spill_columnar_format)
     , allow_extended_conversion(settings.allow_extended_type_conversion)
     , tmp_volume(tmp_volume_)
 {
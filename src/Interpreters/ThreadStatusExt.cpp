@@ -114,6 +114,7 @@ void ThreadStatus::setupState(const ThreadGroupStatusPtr & thread_group_)
         logs_queue_ptr = thread_group->logs_queue_ptr;
         fatal_error_callback = thread_group->fatal_error_callback;
         query_context = thread_group->query_context;
+        plan_segment_id = thread_group->plan_segment_id;
 
         if (global_context.expired())
             global_context = thread_group->global_context;
@@ -384,6 +385,7 @@ void ThreadStatus::detachQuery(bool exit_if_already_detached, bool thread_exits)
     query_context.reset();
     thread_trace_context.trace_id = 0;
     thread_trace_context.span_id = 0;
+    plan_segment_id = 0;
     thread_group.reset();
 
     thread_state = thread_exits ? ThreadState::Died : ThreadState::DetachedFromQuery;
@@ -33,6 +33,7 @@ NamesAndTypesList TraceLogElement::getNamesAndTypes()
         {"trace_type", std::make_shared<TraceDataType>(trace_values)},
         {"thread_id", std::make_shared<DataTypeUInt64>()},
         {"query_id", std::make_shared<DataTypeString>()},
+        {"segment_id", std::make_shared<DataTypeUInt64>()},
         {"trace", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
         {"size", std::make_shared<DataTypeInt64>()},
     };
@@ -50,6 +51,7 @@ void TraceLogElement::appendToBlock(MutableColumns & columns) const
     columns[i++]->insert(static_cast<UInt8>(trace_type));
     columns[i++]->insert(thread_id);
     columns[i++]->insertData(query_id.data(), query_id.size());
+    columns[i++]->insert(segment_id);
     columns[i++]->insert(trace);
     columns[i++]->insert(size);
 }
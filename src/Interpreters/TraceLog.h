@@ -23,6 +23,7 @@ struct TraceLogElement
     TraceType trace_type{};
     UInt64 thread_id{};
     String query_id{};
+    UInt64 segment_id{}; /// Plan segment the sampled thread worked for, 0 outside distributed execution
     Array trace{};
     Int64 size{}; /// Allocation size in bytes for TraceType::Memory
 
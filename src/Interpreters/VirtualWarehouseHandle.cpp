@@ -102,6 +102,10 @@ WorkerGroupHandle VirtualWarehouseHandleImpl::pickWorkerGroup(VWScheduleAlgo alg
     {
         auto worker_group_data = rm_client->pickWorkerGroup(name, algo, {});
 
+        /// A spillover group belongs to another vw, so it is never in our local list.
+        if (worker_group_data.is_spillover)
+            return std::make_shared<WorkerGroupHandleImpl>(worker_group_data, getContext());
+
         {
             std::lock_guard lock(state_mutex);
             auto it = worker_groups.find(worker_group_data.id);
@@ -116,10 +116,11 @@ WorkerGroupHandleImpl::WorkerGroupHandleImpl(const WorkerGroupData & data, const
     : WorkerGroupHandleImpl(data.id, WorkerGroupHandleSource::RM, data.vw_name, data.host_ports_vec, context_, data.metrics)
 {
     type = data.type;
+    is_spillover = data.is_spillover;
 }
 
 WorkerGroupHandleImpl::WorkerGroupHandleImpl(const WorkerGroupHandleImpl & from, [[maybe_unused]] const std::vector<size_t> & indices)
-    : WithContext(from.getContext()), id(from.getID()), vw_name(from.getVWName())
+    : WithContext(from.getContext()), id(from.getID()), vw_name(from.getVWName()), is_spillover(from.is_spillover)
 {
     auto current_context = context.lock();
     if (!current_context)
@@ -130,6 +130,9 @@ public:
     bool hasRing() const { return ring != nullptr; }
     const DB::ConsistentHashRing & getRing() const { return *ring; }
 
+    /// The group was picked by spillover scheduling, i.e. the query runs outside its own vw
+    bool isSpillover() const { return is_spillover; }
+
 private:
     /// Note: updating mutable fields (like `metrics`) should be guarded with lock.
     mutable std::mutex state_mutex;
@@ -140,6 +143,7 @@ private:
     String vw_name;
     HostWithPortsVec hosts;
     WorkerGroupMetrics metrics;
+    bool is_spillover{false};
 
     std::vector<CnchWorkerClientPtr> worker_clients;
 
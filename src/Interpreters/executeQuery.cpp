@@ -81,7 +81,13 @@
 #include <Interpreters/executeQuery.h>
 #include <Interpreters/trySetVirtualWarehouse.h>
 #include <Interpreters/CnchQueryMetrics/QueryMetricLogHelper.h>
+#include <Optimizer/CostModel/CostCalibration.h>
+#include <QueryPlan/ExchangeStep.h>
+#include <QueryPlan/FilterStep.h>
+#include <QueryPlan/ProjectionStep.h>
 #include <QueryPlan/QueryCacheStep.h>
+#include <QueryPlan/RemoteExchangeSourceStep.h>
+#include <QueryPlan/TableScanStep.h>
 #include <Common/ProfileEvents.h>
 #include <Common/RpcClientPool.h>
 
@@ -936,6 +942,7 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                     log_queries_min_type = settings.log_queries_min_type,
                     log_queries_min_query_duration_ms = settings.log_queries_min_query_duration_ms.totalMilliseconds(),
                     log_processors_profiles = settings.log_processors_profiles,
+                    log_plan_step_profiles = settings.log_plan_step_profiles,
                     status_info_to_query_log,
                     query_id,
                     finish_current_transaction,
@@ -1098,6 +1105,50 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                         elem.used_storages = factories_info.storages;
                         elem.used_table_functions = factories_info.table_functions;
 
+                        if (log_plan_step_profiles && query_pipeline)
+                        {
+                            /// Aggregate processor counters by the plan step the processor was created
+                            /// from. Rows/bytes only count edges crossing step boundaries, so internal
+                            /// resizes or forks of one step do not inflate its numbers.
+                            std::unordered_map<const IQueryPlanStep *, size_t> step_index;
+                            for (const auto & processor : query_pipeline->getProcessors())
+                            {
+                                const auto * step = processor->getQueryPlanStep();
+                                if (!step)
+                                    continue;
+
+                                auto [it, inserted] = step_index.emplace(step, elem.plan_step_profiles.size());
+                                if (inserted)
+                                {
+                                    QueryLogElement::PlanStepProfile profile;
+                                    profile.name = step->getStepDescription().empty()
+                                        ? step->getName()
+                                        : step->getName() + ": " + step->getStepDescription();
+                                    elem.plan_step_profiles.push_back(std::move(profile));
+                                }
+                                auto & profile = elem.plan_step_profiles[it->second];
+
+                                profile.elapsed_us += processor->getElapsedUs();
+                                profile.input_wait_us += processor->getInputWaitElapsedUs();
+                                profile.output_wait_us += processor->getOutputWaitElapsedUs();
+
+                                for (const auto & port : processor->getInputs())
+                                {
+                                    if (port.isConnected() && port.getOutputPort().getProcessor().getQueryPlanStep() == step)
+                                        continue;
+                                    profile.input_rows += port.getRows();
+                                    profile.input_bytes += port.getBytes();
+                                }
+                                for (const auto & port : processor->getOutputs())
+                                {
+                                    if (port.isConnected() && port.getInputPort().getProcessor().getQueryPlanStep() == step)
+                                        continue;
+                                    profile.output_rows += port.getRows();
+                                    profile.output_bytes += port.getBytes();
+                                }
+                            }
+                        }
+
                         if (log_queries && elem.type >= log_queries_min_type
                             && Int64(elem.query_duration_ms) >= log_queries_min_query_duration_ms)
                         {
@@ -1155,6 +1206,27 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                             }
                         }
 
+                        if (context->getSettingsRef().enable_cost_calibration && query_pipeline)
+                        {
+                            const String & virtual_warehouse = context->getSettingsRef().virtual_warehouse.value;
+                            auto & calibration = CostCalibration::instance();
+                            for (const auto & processor : query_pipeline->getProcessors())
+                            {
+                                const auto * step = processor->getQueryPlanStep();
+                                if (!step)
+                                    continue;
+
+                                auto stats = processor->getProcessorDataStats();
+                                UInt64 elapsed_us = processor->getElapsedUs();
+                                if (typeid_cast<const TableScanStep *>(step))
+                                    calibration.recordTableScan(virtual_warehouse, stats.output_rows, stats.output_bytes, elapsed_us);
+                                else if (typeid_cast<const ExchangeStep *>(step) || typeid_cast<const RemoteExchangeSourceStep *>(step))
+                                    calibration.recordExchange(virtual_warehouse, stats.output_rows, elapsed_us);
+                                else if (typeid_cast<const ProjectionStep *>(step) || typeid_cast<const FilterStep *>(step))
+                                    calibration.recordCpuBaseline(virtual_warehouse, stats.output_rows, elapsed_us);
+                            }
+                        }
+
                         if (auto opentelemetry_span_log = context->getOpenTelemetrySpanLog();
                             context->query_trace_context.trace_id != UUID() && opentelemetry_span_log)
                         {
@@ -1597,7 +1669,6 @@ void executeQueryByProxy(ContextMutablePtr context, const HostWithPorts & server
 
     /// Create connection to host
     const auto & query_client_info = context->getClientInfo();
-    auto settings = context->getSettingsRef();
     res.remote_execution_conn = std::make_shared<Connection>(
         server.getHost(), server.tcp_port, 
         context->getCurrentDatabase(), /*default_database_*/
@@ -136,13 +136,18 @@ ActionsDAGPtr createExpressions(
 
 }
 
-void performRequiredConversions(Block & block, const NamesAndTypesList & required_columns, ContextPtr context)
+ActionsDAGPtr createConversions(const Block & block, const NamesAndTypesList & required_columns, ContextPtr context)
 {
     ASTPtr conversion_expr_list = convertRequiredExpressions(block, required_columns);
     if (conversion_expr_list->children.empty())
-        return;
+        return nullptr;
 
-    if (auto dag = createExpressions(block, conversion_expr_list, true, required_columns, context))
+    return createExpressions(block, conversion_expr_list, true, required_columns, context);
+}
+
+void performRequiredConversions(Block & block, const NamesAndTypesList & required_columns, ContextPtr context)
+{
+    if (auto dag = createConversions(block, required_columns, context))
     {
         auto expression = std::make_shared<ExpressionActions>(std::move(dag), ExpressionActionsSettings::fromContext(context));
         expression->execute(block);
@@ -28,6 +28,10 @@ ActionsDAGPtr evaluateMissingDefaults(
     bool save_unneeded_columns = true,
     bool null_as_default = false);
 
+/// Create actions which convert columns of block to the types of required_columns.
+/// Return nullptr if no conversions are required.
+ActionsDAGPtr createConversions(const Block & block, const NamesAndTypesList & required_columns, ContextPtr context);
+
 /// Tries to convert columns in block to required_columns
 void performRequiredConversions(Block & block, const NamesAndTypesList & required_columns, ContextPtr context);
 
@@ -21,6 +21,7 @@
 
 #include <Common/ThreadPool.h>
 #include <Common/config.h>
+#include <Common/getNumberOfPhysicalCPUCores.h>
 
 #include <Poco/DirectoryIterator.h>
 
@@ -183,8 +184,21 @@ void loadMetadata(ContextMutablePtr context, const String & default_database_nam
     if (create_default_db_if_not_exists && !metadata_dir_for_default_db_already_exists)
         databases.emplace(default_database_name, path + "/" + escapeForFileName(default_database_name));
 
-    for (const auto & [name, db_path] : databases)
-        loadDatabase(context, name, db_path, has_force_restore_data_flag);
+    if (!databases.empty())
+    {
+        /// Databases are independent of each other here, so load them concurrently.
+        /// Each database keeps its own internal ordering (dictionaries are attached
+        /// before the tables that may use them) and its own table-level parallelism.
+        ThreadPool load_pool(std::min(databases.size(), static_cast<size_t>(getNumberOfPhysicalCPUCores())));
+        for (const auto & [name, db_path] : databases)
+        {
+            load_pool.scheduleOrThrowOnError([&, name = name, db_path = db_path]
+            {
+                loadDatabase(context, name, db_path, has_force_restore_data_flag);
+            });
+        }
+        load_pool.wait();
+    }
 
     if (has_force_restore_data_flag)
     {
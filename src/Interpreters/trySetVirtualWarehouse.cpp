@@ -196,6 +196,21 @@ bool trySetVirtualWarehouseAndWorkerGroup(const ASTPtr & ast, ContextMutablePtr
         auto worker_group = context->getCurrentVW()->pickWorkerGroup(algo);
         LOG_DEBUG(&Poco::Logger::get("trySetVirtualWarehouse"), "Picked worker group {}", worker_group->getQualifiedName());
 
+        if (worker_group->isSpillover())
+        {
+            /// A spilled query runs on workers whose disk cache knows nothing about its
+            /// tables: read it as cache-cold with larger scan batches and do not thrash
+            /// the host group's cache with segments the query will touch only once.
+            const auto & settings = context->getSettingsRef();
+            context->setSetting("disk_cache_mode", String("SKIP_DISK_CACHE"));
+            context->setSetting("merge_tree_min_rows_for_concurrent_read", settings.merge_tree_min_rows_for_concurrent_read * 4);
+            context->setSetting("merge_tree_min_bytes_for_concurrent_read", settings.merge_tree_min_bytes_for_concurrent_read * 4);
+            LOG_DEBUG(
+                &Poco::Logger::get("trySetVirtualWarehouse"),
+                "Query spilled over to {}, marked cache-cold",
+                worker_group->getQualifiedName());
+        }
+
         context->setCurrentWorkerGroup(std::move(worker_group));
         return true;
     }
@@ -21,6 +21,7 @@
 #include <Columns/ColumnConst.h>
 #include <iostream>
 #include <Common/assert_cast.h>
+#include <Common/typeid_cast.h>
 
 namespace DB
 {
@@ -137,41 +138,87 @@ ColumnPtr createColumnWithSipHash(Block & block, const Names & bucket_columns, c
 {
     auto result_column = ColumnUInt64::create();
     auto num_rows = block.rows();
+
+    /// Resolve the cluster by columns once: looking them up by name inside the row
+    /// loop made the scatter cost grow with the block width.
+    ColumnRawPtrs columns;
+    columns.reserve(bucket_columns.size());
+    for (const auto & column_name : bucket_columns)
+        columns.push_back(block.getByName(column_name).column.get());
+
+    result_column->reserve(num_rows);
     for (size_t i = 0; i < num_rows; i++)
     {
         SipHash hash;
-        for (auto column_name : bucket_columns)
-        {
-            block.getByName(column_name).column->updateHashWithValue(i, hash);
-        }
+        for (const auto * column : columns)
+            column->updateHashWithValue(i, hash);
         result_column->insertValue(hash.get64() % divisor);
     }
     return result_column;
 }
 
+namespace
+{
+
+/// Tight loops over the raw split values so that the division/modulo get vectorized.
+template <typename ColumnType>
+void fillBucketNumbers(
+    const ColumnType & split_values, PaddedPODArray<UInt64> & bucket_numbers, const bool is_with_range, const Int64 shard_ratio, const Int64 total_shard_num)
+{
+    const auto & values = split_values.getData();
+    size_t num_rows = values.size();
+    if (is_with_range)
+    {
+        for (size_t i = 0; i < num_rows; ++i)
+        {
+            // implicit floor for shard ratio.
+            // split_number has no constraint to match user requirement, so a shard_ratio(0), when split_number < total_shard_num , is ok for customer.
+            Int64 bucket_number = static_cast<Int64>(values[i]) / shard_ratio;
+            bucket_numbers[i] = bucket_number >= total_shard_num ? total_shard_num - 1 : bucket_number;
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < num_rows; ++i)
+            bucket_numbers[i] = static_cast<Int64>(values[i]) % total_shard_num;
+    }
+}
+
+}
+
 ColumnPtr createBucketNumberColumn(Block & block, const Int64 & split_number, const bool is_with_range, const Int64 total_shard_num)
 {
-    auto bucket_number_column = ColumnUInt64::create();
     auto split_value_column = block.getByPosition(block.columns() - 1).column;
     auto num_rows = block.rows();
-    Int64 bucket_number = -1;
     Int64 shard_ratio = split_number / total_shard_num;
     shard_ratio = shard_ratio == 0 ? 1 : shard_ratio;
-    for(size_t i = 0; i < num_rows; i++)
+
+    auto bucket_number_column = ColumnUInt64::create(num_rows);
+    auto & bucket_numbers = bucket_number_column->getData();
+
+    if (const auto * split_values_u64 = typeid_cast<const ColumnUInt64 *>(split_value_column.get()))
+        fillBucketNumbers(*split_values_u64, bucket_numbers, is_with_range, shard_ratio, total_shard_num);
+    else if (const auto * split_values_i64 = typeid_cast<const ColumnInt64 *>(split_value_column.get()))
+        fillBucketNumbers(*split_values_i64, bucket_numbers, is_with_range, shard_ratio, total_shard_num);
+    else
     {
-        auto current_split_value = split_value_column->getInt(i);
-        if (is_with_range)      /// TODO: Perform vectorization
-        {
-            // implicit floor for shard ratio.
-            // split_number has no constraint to match user requirement, so a shard_ratio(0), when split_number < total_shard_num , is ok for customer.
-            bucket_number = current_split_value / shard_ratio;
-            bucket_number = bucket_number >= total_shard_num ? total_shard_num - 1 : bucket_number;
-        }
-        else
+        for (size_t i = 0; i < num_rows; i++)
         {
-            bucket_number = current_split_value % total_shard_num;
+            auto current_split_value = split_value_column->getInt(i);
+            Int64 bucket_number;
+            if (is_with_range)
+            {
+                // implicit floor for shard ratio.
+                // split_number has no constraint to match user requirement, so a shard_ratio(0), when split_number < total_shard_num , is ok for customer.
+                bucket_number = current_split_value / shard_ratio;
+                bucket_number = bucket_number >= total_shard_num ? total_shard_num - 1 : bucket_number;
+            }
+            else
+            {
+                bucket_number = current_split_value % total_shard_num;
+            }
+            bucket_numbers[i] = bucket_number;
         }
-        bucket_number_column->insertValue(bucket_number);
     }
     return bucket_number_column;
 }
@@ -154,7 +154,24 @@ HostWithPorts CnchTopologyMaster::getTargetServerImpl(
             {
                 HostWithPorts server_in_new_topology = get_server_for_table(table_uuid, it->getServerList());
                 if (server_in_new_topology.isExactlySame(server_in_old_topology))
+                {
                     target_server = server_in_new_topology;
+                }
+                else
+                {
+                    /// Ownership is about to move. Hand the table off to the upcoming owner
+                    /// right away instead of failing for the rest of the transition window:
+                    /// every server resolves the same topology list, so new requests converge
+                    /// on the new owner (the old one forwards through the regular query
+                    /// forwarding path) while its in-flight queries drain.
+                    target_server = server_in_new_topology;
+                    LOG_DEBUG(
+                        log,
+                        "Table {} is moving from {} to {} with the upcoming topology, routing to the new owner",
+                        table_uuid,
+                        server_in_old_topology.toDebugString(),
+                        server_in_new_topology.toDebugString());
+                }
             }
             break;
         }
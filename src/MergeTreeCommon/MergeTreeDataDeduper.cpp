@@ -21,6 +21,7 @@
 #include <Storages/IndexFile/IndexFileMergeIterator.h>
 #include <Storages/UniqueKeyIndex.h>
 #include <Common/Coding.h>
+#include <Common/ThreadPool.h>
 
 namespace DB
 {
@@ -332,7 +333,8 @@ namespace
         const IMergeTreeDataPartsVector & parts,
         std::vector<UniqueKeyIndexPtr> & index_holders,
         bool fill_cache,
-        DeleteBitmapGetter delete_bitmap_getter)
+        DeleteBitmapGetter delete_bitmap_getter,
+        const String * min_relevant_key = nullptr)
     {
         index_holders.clear();
         index_holders.reserve(parts.size());
@@ -343,6 +345,20 @@ namespace
         iters.reserve(parts.size());
         for (size_t i = 0; i < parts.size(); ++i)
         {
+            /// A part whose whole key range lies below the smallest relevant key can never
+            /// produce a match, so give the merge an empty iterator for it instead of paying
+            /// a data block read per file when seeking. The bound comes from the in-memory
+            /// index block, so the check itself reads nothing.
+            if (min_relevant_key)
+            {
+                String largest_key_bound;
+                if (index_holders[i]->getLargestKeyBound(largest_key_bound) && largest_key_bound < *min_relevant_key)
+                {
+                    iters.push_back(std::unique_ptr<IndexFile::Iterator>(IndexFile::NewEmptyIterator()));
+                    continue;
+                }
+            }
+
             IndexFile::ReadOptions opts;
             opts.fill_cache = fill_cache;
             {
@@ -385,9 +401,16 @@ namespace
     {
         const IndexFile::Comparator * comparator = IndexFile::BytewiseComparator();
 
+        /// Position the new-parts iterator first: its smallest key bounds the range of
+        /// base parts that can possibly match, letting the open below skip parts that
+        /// end before it entirely.
+        keys.SeekToFirst();
+        const String * min_new_key = keys.Valid() ? &keys.CurrentKey() : nullptr;
+
         std::vector<UniqueKeyIndexPtr> key_indices;
         DeleteBitmapGetter delete_bitmap_getter = [](const IMergeTreeDataPartPtr & part) { return part->getDeleteBitmap(); };
-        IndexFileIterators base_input_iters = openUniqueKeyIndexIterators(parts, key_indices, /*fill_cache*/ true, delete_bitmap_getter);
+        IndexFileIterators base_input_iters
+            = openUniqueKeyIndexIterators(parts, key_indices, /*fill_cache*/ true, delete_bitmap_getter, min_new_key);
 
         std::vector<UInt64> base_implicit_versions(parts.size(), 0);
         if (version_mode == MergeTreeDataDeduper::VersionMode::PartitionValueAsVersion)
@@ -397,7 +420,6 @@ namespace
         }
 
         IndexFile::IndexFileMergeIterator base_iter(comparator, std::move(base_input_iters));
-        keys.SeekToFirst();
         if (keys.Valid())
             base_iter.Seek(keys.CurrentKey());
 
@@ -566,30 +588,64 @@ LocalDeleteBitmaps MergeTreeDataDeduper::dedupParts(
             });
         }
 
+        /// Group new parts with the visible parts of their partition first: partitions are
+        /// independent dedup scopes and can be processed concurrently.
+        struct PartitionDedupTask
+        {
+            String partition_id;
+            IMergeTreeDataPartsVector visible_parts;
+            IMergeTreeDataPartsVector new_parts;
+            DeleteBitmapVector bitmaps;
+            UInt64 dedup_cost_ms = 0;
+        };
+        std::vector<PartitionDedupTask> tasks;
+
         size_t i = 0;
         size_t j = 0;
         while (j < all_new_parts.size())
         {
-            Stopwatch watch;
-            String partition_id = all_new_parts[j]->info.partition_id;
-            IMergeTreeDataPartsVector visible_parts;
-            IMergeTreeDataPartsVector new_parts;
+            PartitionDedupTask task;
+            task.partition_id = all_new_parts[j]->info.partition_id;
             /// TODO(optimize): use binary search to speed up
-            while (i < all_visible_parts.size() && all_visible_parts[i]->info.partition_id == partition_id)
-                visible_parts.push_back(all_visible_parts[i++]);
-            while (j < all_new_parts.size() && all_new_parts[j]->info.partition_id == partition_id)
-                new_parts.push_back(all_new_parts[j++]);
+            while (i < all_visible_parts.size() && all_visible_parts[i]->info.partition_id == task.partition_id)
+                task.visible_parts.push_back(all_visible_parts[i++]);
+            while (j < all_new_parts.size() && all_new_parts[j]->info.partition_id == task.partition_id)
+                task.new_parts.push_back(all_new_parts[j++]);
+            tasks.push_back(std::move(task));
+        }
+
+        auto run_task = [&](PartitionDedupTask & task) {
+            Stopwatch watch;
+            log_dedup_detail(task.visible_parts, task.new_parts);
+            task.bitmaps = dedupImpl(task.visible_parts, task.new_parts);
+            task.dedup_cost_ms = watch.elapsedMilliseconds();
+        };
 
-            log_dedup_detail(visible_parts, new_parts);
-            DeleteBitmapVector bitmaps = dedupImpl(visible_parts, new_parts);
-            size_t num_bitmaps_to_dump = prepare_bitmaps_to_dump(visible_parts, new_parts, bitmaps);
+        size_t pool_size = std::min(tasks.size(), size_t(data.getSettings()->cnch_parallel_dedup_threads));
+        if (pool_size > 1)
+        {
+            ThreadPool dedup_pool(pool_size);
+            for (auto & task : tasks)
+                dedup_pool.scheduleOrThrowOnError([&run_task, &task] { run_task(task); });
+            dedup_pool.wait();
+        }
+        else
+        {
+            for (auto & task : tasks)
+                run_task(task);
+        }
+
+        /// dump preparation mutates shared state, keep it on the caller thread and in partition order
+        for (auto & task : tasks)
+        {
+            size_t num_bitmaps_to_dump = prepare_bitmaps_to_dump(task.visible_parts, task.new_parts, task.bitmaps);
             LOG_DEBUG(
                 log,
                 "Dedup partition {} in {} ms, visible parts={}, new parts={}, result bitmaps={}",
-                partition_id,
-                watch.elapsedMilliseconds(),
-                visible_parts.size(),
-                new_parts.size(),
+                task.partition_id,
+                task.dedup_cost_ms,
+                task.visible_parts.size(),
+                task.new_parts.size(),
                 num_bitmaps_to_dump);
         }
     }
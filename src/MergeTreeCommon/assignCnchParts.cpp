@@ -16,6 +16,7 @@
 #include <MergeTreeCommon/assignCnchParts.h>
 #include <Catalog/Catalog.h>
 #include <Catalog/DataModelPartWrapper.h>
+#include <Storages/Hive/HiveDataPart.h>
 #include <common/logger_useful.h>
 
 #include <sstream>
@@ -54,6 +55,8 @@ inline void reportStats(const M & map, const String & name, size_t num_workers)
 /// explicit instantiation for server part and cnch data part.
 template ServerAssignmentMap assignCnchParts<ServerDataPartsVector>(const WorkerGroupHandle & worker_group, const ServerDataPartsVector & parts);
 template AssignmentMap assignCnchParts<MergeTreeDataPartsCNCHVector>(const WorkerGroupHandle & worker_group, const MergeTreeDataPartsCNCHVector & parts);
+template ServerAssignmentMap assignCnchPartsWithJump<ServerDataPartsVector>(WorkerList workers, const ServerDataPartsVector & parts);
+template ServerAssignmentMap assignCnchPartsWithRingAndBalance<ServerDataPartsVector>(const ConsistentHashRing & ring, const ServerDataPartsVector & parts);
 
 template <typename DataPartsCnchVector>
 std::unordered_map<String, DataPartsCnchVector> assignCnchParts(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts)
@@ -117,26 +120,54 @@ std::unordered_map<String, DataPartsCnchVector> assignCnchPartsWithRingAndBalanc
     std::unordered_map<String, DataPartsCnchVector> ret;
     size_t num_parts = parts.size();
     auto cap_limit = ring.getCapLimit(num_parts);
-    DataPartsCnchVector exceed_parts;
-    std::unordered_map<String, UInt64> stats;
 
-    // first round, try respect original hash mapping as much as possible
+    auto part_hash = [](const auto & part)
+    {
+        auto part_name = part->get_info().getBasicPartName();
+        return fio_crc64(reinterpret_cast<const unsigned char *>(part_name.c_str()), part_name.length());
+    };
+
+    // first round, map every part to its home node regardless of the cap, so that the
+    // outcome does not depend on the order the parts were listed in
     for (auto & part : parts)
+        ret[ring.find(part->get_info().getBasicPartName())].emplace_back(part);
+
+    // second round, evict the overflow of each overloaded node. A node keeps the parts
+    // with the smallest hashes: which parts stay is decided by the hash alone, so
+    // consecutive queries and small changes of the part list keep each worker's cached
+    // working set intact instead of reshuffling it.
+    using KeyedPart = std::pair<UInt64, typename DataPartsCnchVector::value_type>;
+    auto by_hash = [](const KeyedPart & lhs, const KeyedPart & rhs) { return lhs.first < rhs.first; };
+    std::vector<KeyedPart> exceed_parts;
+    std::unordered_map<String, UInt64> stats;
+    for (auto & [hostname, node_parts] : ret)
     {
-        if (auto hostname = ring.tryFind(part->get_info().getBasicPartName(), cap_limit, stats); !hostname.empty())
-            ret[hostname].emplace_back(part);
-        else
-            exceed_parts.emplace_back(part);
+        if (node_parts.size() > cap_limit)
+        {
+            std::vector<KeyedPart> keyed;
+            keyed.reserve(node_parts.size());
+            for (auto & part : node_parts)
+                keyed.emplace_back(part_hash(part), part);
+            std::sort(keyed.begin(), keyed.end(), by_hash);
+
+            node_parts.clear();
+            for (size_t i = 0; i < cap_limit; ++i)
+                node_parts.emplace_back(std::move(keyed[i].second));
+            for (size_t i = cap_limit; i < keyed.size(); ++i)
+                exceed_parts.emplace_back(std::move(keyed[i]));
+        }
+        stats[hostname] = node_parts.size();
     }
 
-    // second round to assign the overloaded parts, reuse the one round apporach `findAndRebalance`.
-    for (auto & part: exceed_parts)
+    // final round to assign the evicted parts, reuse the one round apporach `findAndRebalance`.
+    // Sort them by hash first so the fill order does not depend on the map iteration order.
+    std::sort(exceed_parts.begin(), exceed_parts.end(), by_hash);
+    for (auto & exceed : exceed_parts)
     {
-        auto hostname = ring.findAndRebalance(part->get_info().getBasicPartName(), cap_limit, stats);
-        ret[hostname].emplace_back(part);
+        auto hostname = ring.findAndRebalance(exceed.second->get_info().getBasicPartName(), cap_limit, stats);
+        ret[hostname].emplace_back(std::move(exceed.second));
     }
 
-
     LOG_INFO(&Poco::Logger::get("Consistent Hash"),
              "Finish allocate part with bounded ring based hash policy, # of overloaded parts {}.", exceed_parts.size());
     return ret;
@@ -176,6 +207,35 @@ HivePartsAssignMap assignCnchHiveParts(const WorkerGroupHandle & worker_group, c
     return ret;
 }
 
+HivePartsAssignMap assignCnchHivePartsForBucketTable(const WorkerGroupHandle & worker_group, const HiveDataPartsCNCHVector & parts)
+{
+    auto workers = worker_group->getWorkerIDVec();
+    /// we don't know the order of workers returned from consul so sort them explicitly now
+    std::sort(workers.begin(), workers.end());
+    auto num_workers = workers.size();
+    HivePartsAssignMap ret;
+    for (const auto & part : parts)
+    {
+        /// Files of the same bucket go to the same worker, same scheme as assignCnchPartsForBucketTable.
+        Int64 bucket_number = part->getInfo().getBucketNumber();
+        size_t index;
+        if (bucket_number >= 0)
+        {
+            index = bucket_number % num_workers;
+        }
+        else
+        {
+            /// Not a bucketed file name; still keep the assignment stable across queries.
+            auto part_name = part->getInfo().getBasicPartName();
+            auto hash_val = fio_crc64(reinterpret_cast<const unsigned char *>(part_name.c_str()), part_name.length());
+            index = JumpConsistentHash(hash_val, num_workers);
+        }
+        ret[workers[index]].emplace_back(part);
+    }
+    reportStats(ret, "Hive Bucket Assignment", num_workers);
+    return ret;
+}
+
 
 bool isCnchBucketTable(const ContextPtr & context, const IStorage & storage, const ServerDataPartsVector & parts)
 {
@@ -41,9 +41,23 @@ struct BucketNumberAndServerPartsAssignment
 // the hive has different allocate logic, thus separate it.
 HivePartsAssignMap assignCnchHiveParts(const WorkerGroupHandle & worker_group, const HiveDataPartsCNCHVector & parts);
 
+/// For bucketed hive tables: files of the same bucket always land on the same worker,
+/// so point lookups hit one file set per worker with a warm cache. Files whose name
+/// does not carry a bucket index fall back to the jump consistent hash on the name.
+HivePartsAssignMap assignCnchHivePartsForBucketTable(const WorkerGroupHandle & worker_group, const HiveDataPartsCNCHVector & parts);
+
 template <typename DataPartsCnchVector>
 std::unordered_map<String, DataPartsCnchVector> assignCnchParts(const WorkerGroupHandle & worker_group, const DataPartsCnchVector & parts);
 
+/// Lower-level entry points behind assignCnchParts, taking a plain worker list or
+/// a prebuilt ring. Exposed so they can be exercised directly (e.g. by the
+/// metadata micro-benchmarks) without constructing a WorkerGroupHandle.
+template <typename DataPartsCnchVector>
+std::unordered_map<String, DataPartsCnchVector> assignCnchPartsWithJump(WorkerList workers, const DataPartsCnchVector & parts);
+
+template <typename DataPartsCnchVector>
+std::unordered_map<String, DataPartsCnchVector> assignCnchPartsWithRingAndBalance(const ConsistentHashRing & ring, const DataPartsCnchVector & parts);
+
 bool isCnchBucketTable(const ContextPtr & context, const IStorage & storage, const ServerDataPartsVector & parts);
 BucketNumberAndServerPartsAssignment assignCnchPartsForBucketTable(const ServerDataPartsVector & parts, WorkerList workers, std::set<Int64> required_bucket_numbers = {});
 
@@ -827,16 +827,95 @@ FilterEstimateResult FilterEstimator::estimateNotNullFilter(PlanNodeStatistics &
     return {selectivity, std::move(filtered_symbol_statistics)};
 }
 
-// TODO support dynamic sample for complex predicate @gouguiling
-FilterEstimateResult FilterEstimator::estimateLikeFilter(PlanNodeStatistics &, ConstASTPtr &, FilterEstimatorContext &)
+namespace
 {
-    return {DEFAULT_SELECTIVITY, {}};
+    bool hasLikeWildcard(const String & pattern)
+    {
+        for (size_t i = 0; i < pattern.size(); ++i)
+        {
+            if (pattern[i] == '\\')
+            {
+                ++i;
+                continue;
+            }
+            if (pattern[i] == '%' || pattern[i] == '_')
+                return true;
+        }
+        return false;
+    }
+
+    String unescapeLikePattern(const String & pattern)
+    {
+        String result;
+        result.reserve(pattern.size());
+        for (size_t i = 0; i < pattern.size(); ++i)
+        {
+            if (pattern[i] == '\\' && i + 1 < pattern.size())
+                ++i;
+            result += pattern[i];
+        }
+        return result;
+    }
+}
+
+FilterEstimateResult FilterEstimator::estimateLikeFilter(PlanNodeStatistics & stats, ConstASTPtr & predicate, FilterEstimatorContext & context)
+{
+    const auto & function = predicate->as<const ASTFunction &>();
+
+    ConstASTPtr left = tryGetIdentifier(function.arguments->getChildren()[0]);
+    std::optional<Field> field = context.calculateConstantExpression(function.arguments->getChildren()[1]);
+
+    if (!left->as<ASTIdentifier>() || !field.has_value() || field->getType() != Field::Types::String)
+    {
+        return {DEFAULT_SELECTIVITY, {}};
+    }
+
+    const auto & identifier = left->as<ASTIdentifier &>();
+    String symbol = identifier.name();
+
+    SymbolStatistics & symbol_statistics = *stats.getSymbolStatistics(symbol);
+    if (symbol_statistics.isUnknown() || !symbol_statistics.isString())
+    {
+        return {DEFAULT_SELECTIVITY, {}};
+    }
+
+    String pattern = field->safeGet<String>();
+
+    // A pattern without wildcards is an equality match, answered precisely by the
+    // hash-based string histogram, the same way estimateEqualityFilter does it.
+    if (!hasLikeWildcard(pattern))
+    {
+        String str = unescapeLikePattern(pattern);
+        double value = CityHash_v1_0_2::CityHash64(str.data(), str.size());
+        double selectivity = symbol_statistics.estimateEqualFilter(value);
+        std::unordered_map<std::string, SymbolStatisticsPtr> filtered_symbol_statistics
+            = {{symbol, symbol_statistics.createEqualFilter(value)}};
+        return {selectivity, std::move(filtered_symbol_statistics)};
+    }
+
+    double selectivity = symbol_statistics.estimateLikeFilter(pattern);
+    std::unordered_map<std::string, SymbolStatisticsPtr> filtered_symbol_statistics
+        = {{symbol, symbol_statistics.applySelectivity(selectivity)}};
+    return {selectivity, std::move(filtered_symbol_statistics)};
 }
 
-// TODO support dynamic sample for complex predicate @gouguiling
-FilterEstimateResult FilterEstimator::estimateNotLikeFilter(PlanNodeStatistics &, ConstASTPtr &, FilterEstimatorContext &)
+FilterEstimateResult FilterEstimator::estimateNotLikeFilter(PlanNodeStatistics & stats, ConstASTPtr & predicate, FilterEstimatorContext & context)
 {
-    return {DEFAULT_SELECTIVITY, {}};
+    FilterEstimateResult result = estimateLikeFilter(stats, predicate, context);
+
+    // no usable statistics, fall back to the conservative default instead of inverting it.
+    if (result.second.empty())
+    {
+        return {DEFAULT_SELECTIVITY, {}};
+    }
+
+    std::unordered_map<std::string, SymbolStatisticsPtr> not_symbol_statistics;
+    for (auto & symbol_statistics : result.second)
+    {
+        SymbolStatisticsPtr origin = stats.getSymbolStatistics(symbol_statistics.first);
+        not_symbol_statistics[symbol_statistics.first] = symbol_statistics.second->createNot(origin);
+    }
+    return {1.0 - result.first, std::move(not_symbol_statistics)};
 }
 
 }
@@ -179,6 +179,48 @@ double SymbolStatistics::estimateNotInFilter(std::set<String> & values, bool has
     return 1.0 - in_values_selectivity;
 }
 
+namespace
+{
+    /// Per-character match probabilities used for LIKE patterns that the hash-based
+    /// string histogram cannot answer directly. The constants follow the conventional
+    /// values used by other cost-based optimizers: every fixed pattern character
+    /// filters out most rows, '_' barely filters, and '%' compensates for the
+    /// pessimism of the fixed characters around it.
+    constexpr double FIXED_CHAR_SELECTIVITY = 0.2;
+    constexpr double ANY_CHAR_SELECTIVITY = 0.9;
+    constexpr double FULL_WILDCARD_SELECTIVITY = 5.0;
+}
+
+double SymbolStatistics::estimateLikeFilter(const String & pattern)
+{
+    double selectivity = 1.0;
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        char c = pattern[i];
+        if (c == '%')
+        {
+            selectivity *= FULL_WILDCARD_SELECTIVITY;
+            continue;
+        }
+        if (c == '_')
+        {
+            selectivity *= ANY_CHAR_SELECTIVITY;
+            continue;
+        }
+        // an escaped wildcard matches as a fixed character.
+        if (c == '\\' && i + 1 < pattern.size())
+            ++i;
+        selectivity *= FIXED_CHAR_SELECTIVITY;
+    }
+
+    // a pattern can never be more selective than a point lookup.
+    if (ndv > 0)
+    {
+        selectivity = std::max(selectivity, 1.0 / ndv);
+    }
+    return selectivity > 1 ? 1 : selectivity;
+}
+
 double SymbolStatistics::estimateNullFilter(UInt64 count) const
 {
     if (count == 0)
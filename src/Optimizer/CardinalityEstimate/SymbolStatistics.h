@@ -118,6 +118,7 @@ public:
     double estimateInFilter(std::set<String> & values, bool has_null_value, UInt64 count) const;
     double estimateNotInFilter(std::set<double> & values, bool has_null_value, UInt64 count);
     double estimateNotInFilter(std::set<String> & values, bool has_null_value, UInt64 count);
+    double estimateLikeFilter(const String & pattern);
     double estimateNullFilter(UInt64 count) const;
     double estimateNotNullFilter(UInt64 count) const;
 
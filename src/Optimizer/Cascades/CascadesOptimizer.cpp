@@ -16,6 +16,7 @@
 #include <Optimizer/Cascades/CascadesOptimizer.h>
 
 #include <Interpreters/DistributedStages/PlanSegmentSplitter.h>
+#include <Optimizer/Cascades/ParallelExplorer.h>
 #include <Optimizer/Cascades/Task.h>
 #include <Optimizer/Rule/Implementation/SetJoinDistribution.h>
 #include <Optimizer/Rule/Rewrite/InlineProjections.h>
@@ -78,6 +79,13 @@ Property CascadesOptimizer::optimize(GroupId root_group_id, CascadesContext & co
 {
     auto root_context = std::make_shared<OptimizationContext>(context, required_prop);
     auto root_group = context.getMemo().getGroupById(root_group_id);
+
+    // Explore memo groups concurrently before the cost-based search, the serial
+    // search below then finds all transformation rules already applied
+    size_t explore_threads = context.getContext()->getSettingsRef().cascades_optimizer_explore_threads;
+    if (explore_threads > 1)
+        ParallelExplorer::explore(root_group_id, context, required_prop, explore_threads);
+
     context.getTaskStack().push(std::make_shared<OptimizeGroup>(root_group, root_context));
 
     auto start_time = std::chrono::system_clock::now();
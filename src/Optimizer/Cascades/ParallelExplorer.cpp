@@ -0,0 +1,316 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Optimizer/Cascades/ParallelExplorer.h>
+
+#include <Optimizer/Cascades/Group.h>
+#include <Optimizer/Rule/Rule.h>
+#include <Common/ThreadPool.h>
+
+#include <optional>
+
+namespace DB
+{
+namespace ErrorCodes
+{
+    extern const int OPTIMIZER_TIMEOUT;
+}
+
+void ParallelExplorer::explore(GroupId root_group_id, CascadesContext & context, const Property & required_prop, size_t thread_count)
+{
+    ParallelExplorer explorer{context, required_prop, thread_count};
+    explorer.pending_groups.push_back(root_group_id);
+
+    // Warm up the lazily cached target types before the rules are shared between threads
+    for (const auto & rule : context.getTransformationRules())
+        rule->getTargetType();
+
+    ThreadPool pool(thread_count);
+    for (size_t i = 0; i < thread_count; ++i)
+        pool.scheduleOrThrowOnError([&explorer] { explorer.workerLoop(); });
+    pool.wait();
+
+    if (explorer.first_exception)
+        std::rethrow_exception(explorer.first_exception);
+}
+
+ParallelExplorer::ParallelExplorer(CascadesContext & context_, const Property & required_prop, size_t thread_count_)
+    : context(context_)
+    , opt_context(std::make_shared<OptimizationContext>(context_, required_prop))
+    , thread_count(thread_count_)
+    , deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(context_.getTaskExecutionTimeout()))
+{
+}
+
+void ParallelExplorer::workerLoop()
+{
+    while (true)
+    {
+        GroupId group_id;
+        {
+            std::unique_lock lock(queue_mutex);
+            queue_cv.wait(lock, [this] { return stop || !pending_groups.empty() || active_workers == 0; });
+            if (stop || (pending_groups.empty() && active_workers == 0))
+                break;
+            if (pending_groups.empty())
+                continue;
+            group_id = pending_groups.front();
+            pending_groups.pop_front();
+            ++active_workers;
+        }
+
+        try
+        {
+            exploreGroup(group_id, false);
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard lock(queue_mutex);
+                if (!first_exception)
+                    first_exception = std::current_exception();
+            }
+            stop = true;
+            state_cv.notify_all();
+        }
+
+        {
+            std::lock_guard lock(queue_mutex);
+            --active_workers;
+        }
+        queue_cv.notify_all();
+    }
+
+    // Wake the remaining workers so they can observe termination
+    queue_cv.notify_all();
+}
+
+void ParallelExplorer::exploreGroup(GroupId group_id, bool wait_if_claimed)
+{
+    {
+        std::unique_lock lock(state_mutex);
+        auto & state = group_states[group_id];
+        if (state == GroupState::Done)
+            return;
+        if (state == GroupState::InProgress)
+        {
+            if (wait_if_claimed)
+                state_cv.wait(lock, [&] { return group_states[group_id] == GroupState::Done || stop; });
+            return;
+        }
+        state = GroupState::InProgress;
+    }
+
+    try
+    {
+        GroupPtr group;
+        {
+            std::shared_lock lock(memo_mutex);
+            group = context.getMemo().getGroupById(group_id);
+        }
+
+        offerChildren(group);
+
+        while (!stop)
+        {
+            checkDeadline();
+
+            // Expressions recorded by the rules applied below are picked up by the
+            // next scan; their rule masks guarantee every pair is applied only once
+            auto pending_rules = collectPendingRules(group);
+            if (pending_rules.empty())
+                break;
+
+            for (auto & [group_expr, rule] : pending_rules)
+            {
+                if (stop)
+                    break;
+                applyRule(group_expr, rule);
+            }
+        }
+    }
+    catch (...)
+    {
+        // Mark the group finished anyway, otherwise waiters would hang
+        {
+            std::lock_guard lock(state_mutex);
+            group_states[group_id] = GroupState::Done;
+        }
+        state_cv.notify_all();
+        throw;
+    }
+
+    {
+        std::lock_guard lock(state_mutex);
+        group_states[group_id] = GroupState::Done;
+    }
+    state_cv.notify_all();
+}
+
+void ParallelExplorer::applyRule(const GroupExprPtr & group_expr, const RulePtr & rule)
+{
+    // Explore non-leaf children before applying the rule, like ExploreExpression does
+    int child_group_idx = 0;
+    for (const auto & child_pattern : rule->getPattern()->getChildrenPatterns())
+    {
+        if (!child_pattern->getChildrenPatterns().empty())
+            exploreGroup(group_expr->getChildrenGroups()[child_group_idx], true);
+        child_group_idx++;
+    }
+
+    if (stop)
+        return;
+
+    RuleContext rule_context{context.getContext(), context.getCTEInfo(), opt_context, group_expr->getGroupId()};
+
+    if (rule->mutatesMemo())
+    {
+        // The rule records into the memo inside transform(), run the whole
+        // binding + transform sequence under the exclusive lock
+        std::unique_lock lock(memo_mutex);
+        GroupExprBindingIterator iterator(context.getMemo(), group_expr, rule->getPattern(), opt_context);
+        while (iterator.hasNext())
+        {
+            auto before = iterator.next();
+            if (!rule->getPattern()->matches(before))
+                continue;
+            handleResult(group_expr, rule, rule->transform(before, rule_context));
+        }
+    }
+    else
+    {
+        // Materialize the bindings first, then transform concurrently with other
+        // readers and only take the exclusive lock to record the results
+        std::vector<PlanNodePtr> bindings;
+        {
+            std::shared_lock lock(memo_mutex);
+            GroupExprBindingIterator iterator(context.getMemo(), group_expr, rule->getPattern(), opt_context);
+            while (iterator.hasNext())
+            {
+                auto before = iterator.next();
+                if (rule->getPattern()->matches(before))
+                    bindings.emplace_back(before);
+            }
+        }
+
+        for (auto & before : bindings)
+        {
+            std::optional<TransformResult> result;
+            {
+                std::shared_lock lock(memo_mutex);
+                result = rule->transform(before, rule_context);
+            }
+            std::unique_lock lock(memo_mutex);
+            handleResult(group_expr, rule, *result);
+        }
+    }
+
+    group_expr->setRuleExplored(rule->getType());
+}
+
+void ParallelExplorer::handleResult(const GroupExprPtr & group_expr, const RulePtr & rule, const TransformResult & result)
+{
+    if (result.isEraseAll())
+    {
+        auto group = context.getMemo().getGroupById(group_expr->getGroupId());
+        group->deleteAllExpression();
+    }
+    else if (result.isEraseOld())
+    {
+        auto group = context.getMemo().getGroupById(group_expr->getGroupId());
+        group->deleteExpression(group_expr);
+    }
+
+    for (const auto & new_expr : result.getPlans())
+    {
+        GroupExprPtr new_group_expr = nullptr;
+        auto g_id = group_expr->getGroupId();
+        if (context.recordPlanNodeIntoGroup(new_expr, new_group_expr, rule->getType(), g_id))
+        {
+            for (auto type : rule->blockRules())
+                new_group_expr->setRuleExplored(type);
+        }
+    }
+}
+
+std::vector<std::pair<GroupExprPtr, RulePtr>> ParallelExplorer::collectPendingRules(const GroupPtr & group)
+{
+    std::vector<std::pair<GroupExprPtr, RulePtr>> pending;
+
+    std::shared_lock lock(memo_mutex);
+
+    // If there are no stats, we won't enum plan
+    if (!group->getStatistics())
+        return pending;
+
+    for (const auto & group_expr : group->getLogicalExpressions())
+    {
+        for (const auto & rule : context.getTransformationRules())
+        {
+            if (!rule->isEnabled(context.getContext()))
+                continue;
+            if (group_expr->hasRuleExplored(rule->getType()))
+                continue;
+            if (group_expr->getStep()->getType() != rule->getTargetType())
+                continue;
+
+            // Same "early" reject as OptimizerTask::constructValidRules, the full
+            // pattern is checked when the rule is actually applied
+            auto child_pattern_size = rule->getPattern()->getChildrenPatterns().size();
+            if (child_pattern_size > 0 && group_expr->getChildrenGroups().size() != child_pattern_size)
+                continue;
+
+            pending.emplace_back(group_expr, rule);
+        }
+    }
+    return pending;
+}
+
+void ParallelExplorer::offerChildren(const GroupPtr & group)
+{
+    std::vector<GroupId> children;
+    {
+        std::shared_lock lock(memo_mutex);
+        for (const auto & group_expr : group->getLogicalExpressions())
+            for (auto child_group_id : group_expr->getChildrenGroups())
+                children.emplace_back(child_group_id);
+    }
+
+    {
+        std::lock_guard state_lock(state_mutex);
+        std::lock_guard queue_lock(queue_mutex);
+        for (auto child_group_id : children)
+        {
+            if (group_states[child_group_id] == GroupState::NotStarted)
+                pending_groups.push_back(child_group_id);
+        }
+    }
+    queue_cv.notify_all();
+}
+
+void ParallelExplorer::checkDeadline()
+{
+    if (std::chrono::system_clock::now() < deadline)
+        return;
+
+    stop = true;
+    state_cv.notify_all();
+    queue_cv.notify_all();
+    throw Exception(
+        "Cascades exhausted the time limit of " + std::to_string(context.getTaskExecutionTimeout()) + " ms",
+        ErrorCodes::OPTIMIZER_TIMEOUT);
+}
+
+}
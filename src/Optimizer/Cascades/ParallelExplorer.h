@@ -0,0 +1,119 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Optimizer/Cascades/CascadesOptimizer.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
+namespace DB
+{
+/**
+ * Applies all transformation rules over the memo with several threads before the
+ * cost-based search starts. Independent memo groups are explored concurrently,
+ * bounded by `cascades_optimizer_explore_threads`.
+ *
+ * The memo is guarded by a shared mutex: rules that only read it (bindings and
+ * ordinary transforms) run concurrently under the shared lock, while recording
+ * new expressions and rules that mutate the memo inside transform() (see
+ * Rule::mutatesMemo) take the exclusive lock. Group exploration flags are NOT
+ * set here — only per-expression rule masks — so that the subsequent serial
+ * search still pushes OptimizeExpression tasks and applies implementation
+ * rules, finding all transformation rules already explored.
+ *
+ * Each group is claimed by exactly one thread which applies rules to its
+ * logical expressions until fixpoint; a thread that needs an already claimed
+ * child group waits for its owner. Since the group graph is acyclic, waits can
+ * not form a cycle.
+ */
+class ParallelExplorer
+{
+public:
+    static void explore(GroupId root_group_id, CascadesContext & context, const Property & required_prop, size_t thread_count);
+
+private:
+    ParallelExplorer(CascadesContext & context_, const Property & required_prop, size_t thread_count_);
+
+    enum class GroupState : UInt8
+    {
+        NotStarted,
+        InProgress,
+        Done,
+    };
+
+    void workerLoop();
+
+    /**
+     * Explore a group to fixpoint: apply every enabled transformation rule to
+     * every logical expression, including expressions recorded while exploring.
+     * If the group is claimed by another thread, either return immediately or
+     * wait until its owner finishes, depending on wait_if_claimed.
+     */
+    void exploreGroup(GroupId group_id, bool wait_if_claimed);
+
+    void applyRule(const GroupExprPtr & group_expr, const RulePtr & rule);
+
+    /**
+     * Record transformed plans into the owning group and handle expression
+     * erasure, mirroring ApplyRule::execute. Must be called with the memo
+     * locked exclusively.
+     */
+    void handleResult(const GroupExprPtr & group_expr, const RulePtr & rule, const TransformResult & result);
+
+    std::vector<std::pair<GroupExprPtr, RulePtr>> collectPendingRules(const GroupPtr & group);
+
+    /**
+     * Offer child groups of the logical expressions to idle workers.
+     */
+    void offerChildren(const GroupPtr & group);
+
+    void checkDeadline();
+
+    CascadesContext & context;
+    OptContextPtr opt_context;
+    size_t thread_count;
+    std::chrono::system_clock::time_point deadline;
+
+    /**
+     * Guards the memo: shared for reads, exclusive for mutations
+     */
+    std::shared_mutex memo_mutex;
+
+    /**
+     * Per-group claim state, so each group has a single owner
+     */
+    std::mutex state_mutex;
+    std::condition_variable state_cv;
+    std::unordered_map<GroupId, GroupState> group_states;
+
+    /**
+     * Groups offered to idle workers
+     */
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<GroupId> pending_groups;
+    size_t active_workers = 0;
+    std::exception_ptr first_exception;
+
+    std::atomic<bool> stop{false};
+};
+
+}
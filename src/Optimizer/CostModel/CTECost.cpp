@@ -26,7 +26,12 @@ PlanNodeCost CTECost::calculate(const CTERefStep &, CostContext & context)
     if (!stats)
         return PlanNodeCost::ZERO;
 
+    // Each reference re-reads the shared stream: cpu to decode and net to transfer it.
+    // The cost of evaluating the definition itself is charged only once, at the lowest
+    // common ancestor of all references, see PlanCostVisitor / OptimizeInput. Consumers
+    // don't buffer the whole result, so no memory is charged per reference, otherwise
+    // sharing would be penalized once per consumer and inlining preferred too often.
     return PlanNodeCost::cpuCost(stats->getRowCount()) * context.cost_model.getCTECostWeight()
-        + PlanNodeCost::netCost(stats->getRowCount()) + PlanNodeCost::memCost(stats->getRowCount());
+        + PlanNodeCost::netCost(stats->getRowCount());
 }
 }
@@ -0,0 +1,119 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Optimizer/CostModel/CostCalibration.h>
+
+#include <Optimizer/CostModel/CostModel.h>
+
+namespace DB
+{
+
+CostCalibration & CostCalibration::instance()
+{
+    static CostCalibration calibration;
+    return calibration;
+}
+
+void CostCalibration::Accumulator::add(UInt64 rows_, UInt64 bytes_, UInt64 elapsed_us_)
+{
+    if (rows > AGING_ROWS)
+    {
+        rows /= 2;
+        bytes /= 2;
+        elapsed_us /= 2;
+    }
+    rows += rows_;
+    bytes += bytes_;
+    elapsed_us += elapsed_us_;
+}
+
+std::optional<double> CostCalibration::Accumulator::usPerRow() const
+{
+    if (rows < MIN_ROWS || elapsed_us <= 0)
+        return std::nullopt;
+    return elapsed_us / rows;
+}
+
+void CostCalibration::recordTableScan(const String & virtual_warehouse, UInt64 rows, UInt64 bytes, UInt64 elapsed_us)
+{
+    std::lock_guard lock(mutex);
+    profiles[virtual_warehouse].scan.add(rows, bytes, elapsed_us);
+}
+
+void CostCalibration::recordExchange(const String & virtual_warehouse, UInt64 rows, UInt64 elapsed_us)
+{
+    std::lock_guard lock(mutex);
+    profiles[virtual_warehouse].exchange.add(rows, 0, elapsed_us);
+}
+
+void CostCalibration::recordCpuBaseline(const String & virtual_warehouse, UInt64 rows, UInt64 elapsed_us)
+{
+    std::lock_guard lock(mutex);
+    profiles[virtual_warehouse].cpu_baseline.add(rows, 0, elapsed_us);
+}
+
+std::optional<double> CostCalibration::getTableScanWeight(const String & virtual_warehouse, double projection_weight) const
+{
+    std::lock_guard lock(mutex);
+    auto it = profiles.find(virtual_warehouse);
+    if (it == profiles.end())
+        return std::nullopt;
+
+    auto scan_us = it->second.scan.usPerRow();
+    auto cpu_us = it->second.cpu_baseline.usPerRow();
+    if (!scan_us || !cpu_us)
+        return std::nullopt;
+    return projection_weight * *scan_us / *cpu_us;
+}
+
+std::optional<double> CostCalibration::getExchangeWeight(const String & virtual_warehouse, double projection_weight) const
+{
+    std::lock_guard lock(mutex);
+    auto it = profiles.find(virtual_warehouse);
+    if (it == profiles.end())
+        return std::nullopt;
+
+    auto exchange_us = it->second.exchange.usPerRow();
+    auto cpu_us = it->second.cpu_baseline.usPerRow();
+    if (!exchange_us || !cpu_us)
+        return std::nullopt;
+
+    // exchange cost enters the total as net cost, compensate the ratio so the
+    // fitted weight still represents measured time relative to the cpu baseline
+    return projection_weight * *exchange_us / *cpu_us * (CostModel::CPU_COST_RATIO / CostModel::NET_COST_RATIO);
+}
+
+std::vector<CostCalibration::ProfileSnapshot> CostCalibration::getSnapshots() const
+{
+    std::lock_guard lock(mutex);
+    std::vector<ProfileSnapshot> snapshots;
+    snapshots.reserve(profiles.size());
+    for (const auto & [virtual_warehouse, profile] : profiles)
+    {
+        ProfileSnapshot snapshot;
+        snapshot.virtual_warehouse = virtual_warehouse;
+        snapshot.scan_rows = static_cast<UInt64>(profile.scan.rows);
+        snapshot.scan_bytes = static_cast<UInt64>(profile.scan.bytes);
+        snapshot.scan_us_per_byte = profile.scan.bytes > 0 ? profile.scan.elapsed_us / profile.scan.bytes : 0;
+        snapshot.exchange_rows = static_cast<UInt64>(profile.exchange.rows);
+        snapshot.exchange_us_per_row = profile.exchange.usPerRow().value_or(0);
+        snapshot.cpu_baseline_rows = static_cast<UInt64>(profile.cpu_baseline.rows);
+        snapshot.cpu_baseline_us_per_row = profile.cpu_baseline.usPerRow().value_or(0);
+        snapshots.emplace_back(std::move(snapshot));
+    }
+    return snapshots;
+}
+
+}
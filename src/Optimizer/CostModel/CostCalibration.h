@@ -0,0 +1,112 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Core/Types.h>
+#include <boost/noncopyable.hpp>
+
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace DB
+{
+/**
+ * Fits cost model coefficients from actual execution profiles, per virtual
+ * warehouse. After a query finishes, the per-processor rows/bytes/time already
+ * collected for system.processors_profile_log are also folded into a profile
+ * keyed by the virtual warehouse the query ran on: time per scanned byte,
+ * time per exchanged row, and time per row of plain expression evaluation.
+ *
+ * The expression observation serves as the cpu baseline: the configured
+ * projection weight is taken to correspond to it, and the fitted table scan
+ * and exchange weights are scaled accordingly. This keeps the fitted weights
+ * in the same relative unit as the remaining cost_calculator_* settings, while
+ * the scan/cpu ratio reflects the warehouse actually measured — on S3-backed
+ * warehouses, where I/O dominates, scans get proportionally more expensive.
+ *
+ * Accumulators are halved once enough rows are collected, so the profile
+ * follows warehouse changes instead of averaging over its whole lifetime.
+ */
+class CostCalibration : private boost::noncopyable
+{
+public:
+    static CostCalibration & instance();
+
+    void recordTableScan(const String & virtual_warehouse, UInt64 rows, UInt64 bytes, UInt64 elapsed_us);
+    void recordExchange(const String & virtual_warehouse, UInt64 rows, UInt64 elapsed_us);
+    void recordCpuBaseline(const String & virtual_warehouse, UInt64 rows, UInt64 elapsed_us);
+
+    /**
+     * Fitted weights in the unit of the cost_calculator_* settings, anchored on
+     * the given projection weight. Nullopt until enough samples are collected.
+     */
+    std::optional<double> getTableScanWeight(const String & virtual_warehouse, double projection_weight) const;
+    std::optional<double> getExchangeWeight(const String & virtual_warehouse, double projection_weight) const;
+
+    struct ProfileSnapshot
+    {
+        String virtual_warehouse;
+        UInt64 scan_rows;
+        UInt64 scan_bytes;
+        Float64 scan_us_per_byte;
+        UInt64 exchange_rows;
+        Float64 exchange_us_per_row;
+        UInt64 cpu_baseline_rows;
+        Float64 cpu_baseline_us_per_row;
+    };
+
+    /**
+     * Snapshot of all profiles, for system.optimizer_cost_calibration
+     */
+    std::vector<ProfileSnapshot> getSnapshots() const;
+
+private:
+    CostCalibration() = default;
+
+    /**
+     * Minimum rows an accumulator needs before its per-unit cost is served
+     */
+    static constexpr double MIN_ROWS = 100000;
+
+    /**
+     * Accumulators are halved beyond this row count to age out old observations
+     */
+    static constexpr double AGING_ROWS = 1e9;
+
+    struct Accumulator
+    {
+        double rows = 0;
+        double bytes = 0;
+        double elapsed_us = 0;
+
+        void add(UInt64 rows_, UInt64 bytes_, UInt64 elapsed_us_);
+        std::optional<double> usPerRow() const;
+    };
+
+    struct Profile
+    {
+        Accumulator scan;
+        Accumulator exchange;
+        Accumulator cpu_baseline;
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<String, Profile> profiles;
+};
+
+}
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <Interpreters/Context.h>
+#include <Optimizer/CostModel/CostCalibration.h>
 
 namespace DB
 {
@@ -26,7 +27,12 @@ public:
     static constexpr double NET_COST_RATIO = 0.16;
     static constexpr double MEM_COST_RATIO = 0.1;
 
-    explicit CostModel(const Context & context) : context_settings(context.getSettingsRef()) { }
+    explicit CostModel(const Context & context)
+        : context_settings(context.getSettingsRef())
+        , virtual_warehouse(context_settings.virtual_warehouse.value)
+        , use_calibration(context_settings.enable_cost_calibration)
+    {
+    }
 
     double getAggregateCostWeight() const { return context_settings.cost_calculator_aggregating_weight; }
 
@@ -34,7 +40,23 @@ public:
     double getJoinBuildSideCostWeight() const { return context_settings.cost_calculator_join_build_weight; }
     double getJoinOutputCostWeight() const { return context_settings.cost_calculator_join_output_weight; }
 
-    double getTableScanCostWeight() const { return context_settings.cost_calculator_table_scan_weight; }
+    double getTableScanCostWeight() const
+    {
+        if (use_calibration)
+            if (auto fitted = CostCalibration::instance().getTableScanWeight(
+                    virtual_warehouse, context_settings.cost_calculator_projection_weight))
+                return *fitted;
+        return context_settings.cost_calculator_table_scan_weight;
+    }
+
+    double getExchangeCostWeight() const
+    {
+        if (use_calibration)
+            if (auto fitted = CostCalibration::instance().getExchangeWeight(
+                    virtual_warehouse, context_settings.cost_calculator_projection_weight))
+                return *fitted;
+        return context_settings.cost_calculator_exchange_weight;
+    }
 
     double getCTECostWeight() const { return context_settings.cost_calculator_cte_weight; }
 
@@ -42,6 +64,8 @@ public:
 
 private:
     const Settings & context_settings;
+    String virtual_warehouse;
+    bool use_calibration;
 };
 
 }
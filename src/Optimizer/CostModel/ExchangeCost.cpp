@@ -38,8 +38,9 @@ PlanNodeCost ExchangeCost::calculate(const ExchangeStep & step, CostContext & co
 
     auto single_worker_cost = context.stats->getRowCount() + base_cost;
     return PlanNodeCost::netCost(
-        step.getSchema().getPartitioningHandle() == Partitioning::Handle::FIXED_BROADCAST ? single_worker_cost * context.worker_size
-                                                                                          : single_worker_cost);
+               step.getSchema().getPartitioningHandle() == Partitioning::Handle::FIXED_BROADCAST ? single_worker_cost * context.worker_size
+                                                                                                 : single_worker_cost)
+        * context.cost_model.getExchangeCostWeight();
 }
 
 }
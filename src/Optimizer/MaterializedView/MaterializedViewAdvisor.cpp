@@ -0,0 +1,190 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Optimizer/MaterializedView/MaterializedViewAdvisor.h>
+
+#include <QueryPlan/AggregatingStep.h>
+#include <QueryPlan/TableScanStep.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace DB
+{
+
+namespace
+{
+    bool isPassThrough(IQueryPlanStep::Type type)
+    {
+        // steps an aggregation may sit on top of without changing what the MV
+        // has to materialize: stream shuffles and the phases of the aggregation
+        return type == IQueryPlanStep::Type::Projection || type == IQueryPlanStep::Type::Filter
+            || type == IQueryPlanStep::Type::Exchange || type == IQueryPlanStep::Type::RemoteExchangeSource
+            || type == IQueryPlanStep::Type::Aggregating || type == IQueryPlanStep::Type::MergingAggregated;
+    }
+
+    // the single table scan below the aggregation, nullptr if the shape doesn't match
+    PlanNodePtr findSingleTableScan(const PlanNodePtr & node)
+    {
+        if (node->getStep()->getType() == IQueryPlanStep::Type::TableScan)
+            return node;
+        if (!isPassThrough(node->getStep()->getType()) || node->getChildren().size() != 1)
+            return nullptr;
+        return findSingleTableScan(node->getChildren()[0]);
+    }
+
+    String describeAggregate(const AggregateDescription & desc)
+    {
+        std::stringstream ss;
+        ss << desc.function->getName() << '(';
+        for (size_t i = 0; i < desc.argument_names.size(); ++i)
+        {
+            if (i > 0)
+                ss << ", ";
+            ss << desc.argument_names[i];
+        }
+        ss << ')';
+        return ss.str();
+    }
+}
+
+MaterializedViewAdvisor & MaterializedViewAdvisor::instance()
+{
+    static MaterializedViewAdvisor advisor;
+    return advisor;
+}
+
+double MaterializedViewAdvisor::Candidate::projectedSpeedup() const
+{
+    if (estimated_result_rows == 0)
+        return 1;
+    return static_cast<double>(estimated_scan_rows) / estimated_result_rows;
+}
+
+String MaterializedViewAdvisor::Candidate::suggestedQuery() const
+{
+    std::stringstream ss;
+    ss << "SELECT ";
+    for (const auto & column : group_by_columns)
+        ss << column << ", ";
+    for (size_t i = 0; i < aggregates.size(); ++i)
+    {
+        if (i > 0)
+            ss << ", ";
+        ss << aggregates[i];
+    }
+    ss << " FROM " << database << '.' << table;
+    if (!group_by_columns.empty())
+    {
+        ss << " GROUP BY ";
+        for (size_t i = 0; i < group_by_columns.size(); ++i)
+        {
+            if (i > 0)
+                ss << ", ";
+            ss << group_by_columns[i];
+        }
+    }
+    return ss.str();
+}
+
+void MaterializedViewAdvisor::recordPlan(QueryPlan & plan, ContextMutablePtr context)
+{
+    if (plan.getPlanNode())
+        collectCandidates(plan.getPlanNode(), context);
+}
+
+void MaterializedViewAdvisor::collectCandidates(const PlanNodePtr & node, ContextMutablePtr context) // NOLINT(misc-no-recursion)
+{
+    if (node->getStep()->getType() == IQueryPlanStep::Type::Aggregating)
+    {
+        if (auto scan_node = findSingleTableScan(node))
+        {
+            const auto & agg_step = dynamic_cast<const AggregatingStep &>(*node->getStep());
+            const auto & scan_step = dynamic_cast<const TableScanStep &>(*scan_node->getStep());
+
+            Names group_by_columns = agg_step.getKeys();
+            std::sort(group_by_columns.begin(), group_by_columns.end());
+
+            Names aggregates;
+            for (const auto & desc : agg_step.getAggregates())
+                aggregates.emplace_back(describeAggregate(desc));
+            std::sort(aggregates.begin(), aggregates.end());
+
+            String key = scan_step.getDatabase() + "." + scan_step.getTable();
+            for (const auto & column : group_by_columns)
+                key += "|" + column;
+            for (const auto & aggregate : aggregates)
+                key += "|" + aggregate;
+
+            UInt64 scan_rows = 0;
+            UInt64 scan_bytes = 0;
+            if (auto scan_stats = scan_node->getStatistics().value_or(nullptr))
+            {
+                scan_rows = scan_stats->getRowCount();
+                scan_bytes = scan_stats->getOutputSizeInBytes();
+            }
+            UInt64 result_rows = 0;
+            if (auto agg_stats = node->getStatistics().value_or(nullptr))
+                result_rows = agg_stats->getRowCount();
+
+            std::lock_guard lock(mutex);
+            auto it = candidates.find(key);
+            if (it == candidates.end())
+            {
+                if (candidates.size() >= MAX_CANDIDATES)
+                    return;
+                Candidate candidate;
+                candidate.database = scan_step.getDatabase();
+                candidate.table = scan_step.getTable();
+                candidate.group_by_columns = std::move(group_by_columns);
+                candidate.aggregates = std::move(aggregates);
+                it = candidates.emplace(key, std::move(candidate)).first;
+            }
+
+            auto & candidate = it->second;
+            candidate.hits += 1;
+            candidate.estimated_scan_rows = std::max(candidate.estimated_scan_rows, scan_rows);
+            candidate.estimated_result_rows = std::max(candidate.estimated_result_rows, result_rows);
+            if (scan_rows > 0)
+            {
+                double saved_ratio = 1.0 - std::min(1.0, static_cast<double>(result_rows) / scan_rows);
+                candidate.estimated_bytes_saved_per_query
+                    = std::max(candidate.estimated_bytes_saved_per_query, static_cast<UInt64>(scan_bytes * saved_ratio));
+            }
+            return;
+        }
+    }
+
+    for (const auto & child : node->getChildren())
+        collectCandidates(child, context);
+}
+
+std::vector<MaterializedViewAdvisor::Candidate> MaterializedViewAdvisor::getTopCandidates(size_t top_k) const
+{
+    std::vector<Candidate> result;
+    {
+        std::lock_guard lock(mutex);
+        result.reserve(candidates.size());
+        for (const auto & [_, candidate] : candidates)
+            result.emplace_back(candidate);
+    }
+
+    std::sort(result.begin(), result.end(), [](const Candidate & lhs, const Candidate & rhs) { return lhs.score() > rhs.score(); });
+    if (result.size() > top_k)
+        result.resize(top_k);
+    return result;
+}
+
+}
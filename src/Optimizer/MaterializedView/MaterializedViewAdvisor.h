@@ -0,0 +1,85 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Interpreters/Context_fwd.h>
+#include <QueryPlan/QueryPlan.h>
+#include <boost/noncopyable.hpp>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace DB
+{
+/**
+ * Recommends aggregation materialized views from the workload actually seen.
+ * Every optimized plan is scanned for aggregations whose subtree bottoms out
+ * in a single table scan; such a shape, normalized to (table, group by keys,
+ * aggregate functions), is a candidate MV that would turn the repeated rollup
+ * into a lookup. Candidates accumulate hit counts and the cardinality
+ * estimates the optimizer already derived from the statistics catalog, and
+ * are scored by estimated scan bytes saved across their hits. The top
+ * candidates are reported through system.materialized_view_candidates
+ * together with the query defining the view.
+ */
+class MaterializedViewAdvisor : private boost::noncopyable
+{
+public:
+    static MaterializedViewAdvisor & instance();
+
+    /**
+     * Collect aggregation candidates from an optimized plan. Cheap: a single
+     * walk over the plan nodes, no extra statistics lookups.
+     */
+    void recordPlan(QueryPlan & plan, ContextMutablePtr context);
+
+    struct Candidate
+    {
+        String database;
+        String table;
+        Names group_by_columns;
+        Names aggregates;
+        UInt64 hits = 0;
+        UInt64 estimated_scan_rows = 0;
+        UInt64 estimated_result_rows = 0;
+        UInt64 estimated_bytes_saved_per_query = 0;
+
+        double projectedSpeedup() const;
+        double score() const { return static_cast<double>(hits) * estimated_bytes_saved_per_query; }
+        String suggestedQuery() const;
+    };
+
+    /**
+     * The top candidates ordered by score
+     */
+    std::vector<Candidate> getTopCandidates(size_t top_k) const;
+
+private:
+    MaterializedViewAdvisor() = default;
+
+    void collectCandidates(const PlanNodePtr & node, ContextMutablePtr context);
+
+    /**
+     * Candidates beyond this are dropped until old ones age out of the map
+     */
+    static constexpr size_t MAX_CANDIDATES = 10000;
+
+    mutable std::mutex mutex;
+    std::unordered_map<String, Candidate> candidates;
+};
+
+}
@@ -0,0 +1,149 @@
+#include <Optimizer/PlanCacheManager.h>
+
+#include <Interpreters/Context.h>
+#include <Interpreters/DatabaseCatalog.h>
+#include <Optimizer/PlanNodeSearcher.h>
+#include <Parsers/IAST.h>
+#include <QueryPlan/PlanNode.h>
+#include <QueryPlan/TableScanStep.h>
+#include <Common/FieldVisitors.h>
+#include <Common/SipHash.h>
+
+#include <ctime>
+
+namespace DB
+{
+
+PlanCacheManager & PlanCacheManager::instance()
+{
+    static PlanCacheManager cache;
+    return cache;
+}
+
+PlanCacheManager::Key PlanCacheManager::calculateKey(const ASTPtr & query, ContextPtr context)
+{
+    SipHash hash;
+    query->updateTreeHash(hash);
+    hash.update(context->getCurrentDatabase());
+
+    for (const auto & change : context->getSettingsRef().changes())
+    {
+        hash.update(change.name);
+        hash.update(applyVisitor(FieldVisitorToString(), change.value));
+    }
+
+    Key key;
+    hash.get128(key.first, key.second);
+    return key;
+}
+
+PlanNodePtr PlanCacheManager::copyPlan(const PlanNodePtr & node, ContextMutablePtr & context)
+{
+    PlanNodes children;
+    children.reserve(node->getChildren().size());
+    for (const auto & child : node->getChildren())
+        children.push_back(copyPlan(child, context));
+
+    return PlanNodeBase::createPlanNode(context->nextNodeId(), node->getStep()->copy(context), children, node->getStatistics());
+}
+
+void PlanCacheManager::remove(const Key & key)
+{
+    std::lock_guard lock(mutex);
+    auto it = cache_map.find(key);
+    if (it != cache_map.end())
+    {
+        lru.erase(it->second);
+        cache_map.erase(it);
+    }
+}
+
+QueryPlanPtr PlanCacheManager::tryGetPlan(const ASTPtr & query, ContextMutablePtr context)
+{
+    const auto & settings = context->getSettingsRef();
+    if (!settings.enable_optimizer_plan_cache)
+        return nullptr;
+
+    auto key = calculateKey(query, context);
+
+    CachedPlan cached;
+    {
+        std::lock_guard lock(mutex);
+        auto it = cache_map.find(key);
+        if (it == cache_map.end())
+            return nullptr;
+
+        if (settings.optimizer_plan_cache_ttl_seconds
+            && static_cast<UInt64>(time(nullptr)) > it->second->plan.created_at_seconds + settings.optimizer_plan_cache_ttl_seconds)
+        {
+            lru.erase(it->second);
+            cache_map.erase(it);
+            return nullptr;
+        }
+
+        lru.splice(lru.begin(), lru, it->second);
+        /// Shares the plan nodes with the cache; the deep copy below runs without the lock.
+        cached = it->second->plan;
+    }
+
+    for (const auto & [storage_id, version] : cached.table_versions)
+    {
+        auto storage = DatabaseCatalog::instance().tryGetTable(StorageID{storage_id.database_name, storage_id.table_name}, context);
+        if (!storage || storage->commit_time.toUInt64() != version
+            || (storage_id.uuid != UUIDHelpers::Nil && storage->getStorageID().uuid != storage_id.uuid))
+        {
+            remove(key);
+            return nullptr;
+        }
+    }
+
+    CTEInfo cte_info;
+    for (const auto & cte : cached.cte_plans)
+        cte_info.add(cte.first, copyPlan(cte.second, context));
+    auto root = copyPlan(cached.root, context);
+
+    return std::make_unique<QueryPlan>(std::move(root), std::move(cte_info), context->getPlanNodeIdAllocator());
+}
+
+void PlanCacheManager::addPlan(const ASTPtr & query, QueryPlan & plan, ContextMutablePtr context)
+{
+    if (!context->getSettingsRef().enable_optimizer_plan_cache)
+        return;
+
+    CachedPlan cached;
+
+    auto scans = PlanNodeSearcher::searchFrom(plan)
+                     .where([](PlanNodeBase & node) { return node.getStep()->getType() == IQueryPlanStep::Type::TableScan; })
+                     .findAll();
+    for (const auto & scan : scans)
+    {
+        const auto * scan_step = dynamic_cast<const TableScanStep *>(scan->getStep().get());
+        auto storage = scan_step->getStorage();
+        /// Cannot validate the plan later without the storage, don't cache.
+        if (!storage)
+            return;
+        cached.table_versions.emplace_back(storage->getStorageID(), storage->commit_time.toUInt64());
+    }
+
+    cached.root = copyPlan(plan.getPlanNode(), context);
+    for (const auto & cte : plan.getCTEInfo().getCTEs())
+        cached.cte_plans.emplace(cte.first, copyPlan(cte.second, context));
+    cached.created_at_seconds = time(nullptr);
+
+    auto key = calculateKey(query, context);
+
+    std::lock_guard lock(mutex);
+    if (cache_map.count(key))
+        return;
+
+    lru.push_front({key, std::move(cached)});
+    cache_map[key] = lru.begin();
+
+    while (lru.size() > max_cache_size)
+    {
+        cache_map.erase(lru.back().key);
+        lru.pop_back();
+    }
+}
+
+}
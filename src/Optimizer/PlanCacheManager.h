@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Interpreters/Context_fwd.h>
+#include <Interpreters/StorageID.h>
+#include <Parsers/IAST_fwd.h>
+#include <QueryPlan/QueryPlan.h>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace DB
+{
+
+/// Cache of optimized plans, so that repeated queries skip the analyze / plan /
+/// optimize stages entirely. Entries are keyed by the rewritten query AST, the
+/// current database and the changed settings, and are revalidated on every hit
+/// against the metadata commit time of the tables the plan reads. Plans are
+/// deep-copied both on insert and on reuse, so a cached plan is never mutated
+/// by query execution.
+class PlanCacheManager
+{
+public:
+    static PlanCacheManager & instance();
+
+    /// Returns a plan for the query, or nullptr on miss, when the cache is
+    /// disabled, or when a table the plan reads changed since the plan was built.
+    QueryPlanPtr tryGetPlan(const ASTPtr & query, ContextMutablePtr context);
+
+    /// Remember the optimized plan of the query.
+    void addPlan(const ASTPtr & query, QueryPlan & plan, ContextMutablePtr context);
+
+private:
+    using Key = std::pair<UInt64, UInt64>;
+
+    struct KeyHash
+    {
+        size_t operator()(const Key & key) const { return key.first ^ key.second; }
+    };
+
+    struct CachedPlan
+    {
+        PlanNodePtr root;
+        std::unordered_map<CTEId, PlanNodePtr> cte_plans;
+        /// Tables the plan reads together with their metadata commit times.
+        std::vector<std::pair<StorageID, UInt64>> table_versions;
+        UInt64 created_at_seconds = 0;
+    };
+
+    struct Entry
+    {
+        Key key;
+        CachedPlan plan;
+    };
+
+    static constexpr size_t max_cache_size = 1024;
+
+    static Key calculateKey(const ASTPtr & query, ContextPtr context);
+    static PlanNodePtr copyPlan(const PlanNodePtr & node, ContextMutablePtr & context);
+
+    void remove(const Key & key);
+
+    std::mutex mutex;
+    /// Most recently used entries first.
+    std::list<Entry> lru;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> cache_map;
+};
+
+}
@@ -32,6 +32,7 @@
 #include <Optimizer/Rewriter/UnifyNullableType.h>
 #include <Optimizer/Rewriter/RemoveUnusedCTE.h>
 #include <Optimizer/Rewriter/MaterializedViewRewriter.h>
+#include <Optimizer/MaterializedView/MaterializedViewAdvisor.h>
 #include <Optimizer/Rule/Rules.h>
 #include <QueryPlan/GraphvizPrinter.h>
 #include <QueryPlan/PlanPattern.h>
@@ -262,5 +263,8 @@ void PlanOptimizer::optimize(QueryPlan & plan, ContextMutablePtr context)
     // Check final plan to satisfy with :
     // 1 Symbol exist check
     PlanCheck::checkFinalPlan(plan, context);
+
+    if (context->getSettingsRef().enable_materialized_view_advisor)
+        MaterializedViewAdvisor::instance().recordPlan(plan, context);
 }
 }
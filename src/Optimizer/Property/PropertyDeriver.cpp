@@ -17,6 +17,7 @@
 #include <memory>
 #include <Optimizer/Property/PropertyDeriver.h>
 
+#include <Catalog/Catalog.h>
 #include <Core/Names.h>
 #include <Optimizer/ExpressionRewriter.h>
 #include <Optimizer/Property/Property.h>
@@ -73,6 +74,47 @@ Property PropertyDeriver::deriveStorageProperty(const StoragePtr & storage, Cont
         return Property{Partitioning(Partitioning::Handle::SINGLE), Partitioning(Partitioning::Handle::ARBITRARY)};
     }
 
+    if (context.getSettingsRef().enable_bucket_table_optimize && context.getServerType() == ServerType::cnch_server
+        && storage->isBucketTable())
+    {
+        auto metadata = storage->getInMemoryMetadataPtr();
+        Names cluster_keys = metadata->getColumnsForClusterByKey();
+
+        /// Parts written before the latest CLUSTER BY definition may not be clustered
+        /// yet; the bucket property only holds once the catalog marks the table as
+        /// fully clustered, otherwise fall through to the generic plan.
+        if (!cluster_keys.empty() && context.getCnchCatalog()->isTableClustered(storage->getStorageUUID()))
+        {
+            /// Rewrite identifiers in the cluster-by definition to ordinals, like the
+            /// sharding-key path below, so colocated tables with identical definitions
+            /// compare equal regardless of column names.
+            auto cluster_by_ast = metadata->getClusterByKeyAST();
+            auto symbols = SymbolsExtractor::extract(cluster_by_ast);
+
+            ConstASTMap expression_map;
+            size_t index = 0;
+            for (const auto & symbol : symbols)
+            {
+                ASTPtr name = std::make_shared<ASTIdentifier>(symbol);
+                ASTPtr id = std::make_shared<ASTLiteral>(Field(index));
+                expression_map[name] = id;
+                index++;
+            }
+
+            ASTPtr rewritten = ExpressionRewriter::rewrite(cluster_by_ast, expression_map);
+
+            std::sort(cluster_keys.begin(), cluster_keys.end());
+            return Property{
+                Partitioning{
+                    Partitioning::Handle::BUCKET_TABLE,
+                    cluster_keys,
+                    true,
+                    static_cast<UInt64>(metadata->getBucketNumberFromClusterByKey()),
+                    rewritten},
+                Partitioning{}};
+        }
+    }
+
     if (context.getSettingsRef().enable_sharding_optimize)
     {
         if (const auto * distribute_table = dynamic_cast<const StorageDistributed *>(storage.get()))
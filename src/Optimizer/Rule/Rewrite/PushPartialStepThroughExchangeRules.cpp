@@ -123,13 +123,17 @@ TransformResult PushPartialAggThroughExchange::transformImpl(PlanNodePtr node, c
         context.context->getSettingsRef().max_threads);
     auto transform_params = std::make_shared<AggregatingTransformParams>(new_params, step->isFinal());
     // TODO check
+    /// Bucket ids assigned by the partial aggregation survive the exchange
+    /// (AggregatedChunkInfo is carried by the serialized chunks), so the merge can
+    /// route every bucket to its own lane instead of unioning all exchange streams
+    /// into a single merging transform.
     QueryPlanStepPtr final_agg = std::make_shared<MergingAggregatedStep>(
         exchange_node->getStep()->getOutputStream(),
         step->getKeys(),
         step->getGroupingSetsParams(),
         step->getGroupings(),
         transform_params,
-        false,
+        context.context->getSettingsRef().distributed_aggregation_memory_efficient,
         context.context->getSettingsRef().max_threads,
         context.context->getSettingsRef().aggregation_memory_efficient_merge_threads);
     auto final_agg_node = PlanNodeBase::createPlanNode(context.context->nextNodeId(), std::move(final_agg), exchange, node->getStatistics());
@@ -1,7 +1,10 @@
+#include <MergeTreeCommon/MergeTreeMetaBase.h>
 #include <Optimizer/Rule/Patterns.h>
 #include <Optimizer/Rule/Rewrite/TopNRules.h>
 #include <QueryPlan/AggregatingStep.h>
+#include <QueryPlan/LateMaterializationStep.h>
 #include <QueryPlan/SortingStep.h>
+#include <QueryPlan/TableScanStep.h>
 #include <QueryPlan/TopNFilteringStep.h>
 #include <QueryPlan/ProjectionStep.h>
 #include <Optimizer/Utils.h>
@@ -123,4 +126,80 @@ TransformResult PushTopNFilteringThroughProjection::transformImpl(PlanNodePtr no
     return TransformResult{projection};
 }
 
+PatternPtr CreateLateMaterializationForTopN::getPattern() const
+{
+    return Patterns::topN()->withSingle(Patterns::tableScan());
+}
+
+TransformResult CreateLateMaterializationForTopN::transformImpl(PlanNodePtr node, const Captures &, RuleContext & context)
+{
+    if (!context.context->getSettingsRef().enable_late_materialization_for_topn)
+        return {};
+
+    const auto & topn_step = dynamic_cast<const SortingStep &>(*node->getStep());
+    auto & scan_node = node->getChildren()[0];
+    const auto * scan_step = dynamic_cast<const TableScanStep *>(scan_node->getStep().get());
+
+    // pushed-down steps change the scan output, give up on them
+    if (scan_step->getPushdownAggregation() || scan_step->getPushdownProjection() || scan_step->getPushdownFilter()
+        || scan_step->hasQueryInfoFilter())
+        return {};
+
+    if (!std::dynamic_pointer_cast<MergeTreeMetaBase>(scan_step->getStorage()))
+        return {};
+
+    NameSet sort_symbols;
+    for (const auto & sort_column_desc : topn_step.getSortDescription())
+        sort_symbols.emplace(sort_column_desc.column_name);
+
+    NamesWithAliases scan_columns;
+    NamesWithAliases fetch_columns;
+    for (const auto & item : scan_step->getColumnAlias())
+    {
+        // already rewritten (or the query reads the locator itself)
+        if (item.first == "_part" || item.first == "_part_row_number")
+            return {};
+
+        if (sort_symbols.count(item.second))
+            scan_columns.emplace_back(item);
+        else
+            fetch_columns.emplace_back(item);
+    }
+
+    // no benefit unless the scan can be narrowed
+    if (fetch_columns.empty())
+        return {};
+
+    auto part_name_symbol = context.context->getSymbolAllocator()->newSymbol("_part");
+    auto part_row_number_symbol = context.context->getSymbolAllocator()->newSymbol("_part_row_number");
+    scan_columns.emplace_back("_part", part_name_symbol);
+    scan_columns.emplace_back("_part_row_number", part_row_number_symbol);
+
+    auto new_scan_step = std::make_shared<TableScanStep>(
+        context.context,
+        scan_step->getStorageID(),
+        scan_columns,
+        scan_step->getQueryInfo(),
+        scan_step->getProcessedStage(),
+        scan_step->getMaxBlockSize());
+    auto new_scan_node = PlanNodeBase::createPlanNode(context.context->nextNodeId(), std::move(new_scan_step), {}, scan_node->getStatistics());
+
+    auto new_topn_step = std::make_shared<SortingStep>(
+        new_scan_node->getStep()->getOutputStream(), topn_step.getSortDescription(), topn_step.getLimit(), topn_step.isPartial());
+    auto new_topn_node
+        = PlanNodeBase::createPlanNode(context.context->nextNodeId(), std::move(new_topn_step), {new_scan_node}, node->getStatistics());
+
+    auto late_materialization_step = std::make_shared<LateMaterializationStep>(
+        new_topn_node->getStep()->getOutputStream(),
+        scan_step->getStorageID(),
+        fetch_columns,
+        part_name_symbol,
+        part_row_number_symbol,
+        node->getStep()->getOutputStream().header);
+    auto late_materialization_node = PlanNodeBase::createPlanNode(
+        context.context->nextNodeId(), std::move(late_materialization_step), {new_topn_node}, node->getStatistics());
+
+    return TransformResult{late_materialization_node};
+}
+
 }
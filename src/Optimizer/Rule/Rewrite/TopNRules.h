@@ -37,4 +37,19 @@ public:
     TransformResult transformImpl(PlanNodePtr node, const Captures & captures, RuleContext & context) override;
 };
 
+/// Rewrite TopN -> TableScan of a MergeTree table so that the scan reads only the
+/// sort-key columns plus a row locator (`_part`, `_part_row_number`), and a
+/// LateMaterialization step above the TopN fetches the remaining columns for the
+/// at most `limit` rows that survive the sort.
+class CreateLateMaterializationForTopN: public Rule
+{
+public:
+    RuleType getType() const override { return RuleType::CREATE_LATE_MATERIALIZATION_FOR_TOPN; }
+    String getName() const override { return "CREATE_LATE_MATERIALIZATION_FOR_TOPN"; }
+
+    PatternPtr getPattern() const override;
+
+    TransformResult transformImpl(PlanNodePtr node, const Captures & captures, RuleContext & context) override;
+};
+
 }
@@ -120,6 +120,7 @@ enum class RuleType : UInt32
 
     CREATE_TOPN_FILTERING_FOR_AGGREGATING,
     PUSH_TOPN_FILTERING_THROUGH_PROJECTION,
+    CREATE_LATE_MATERIALIZATION_FOR_TOPN,
 
     // Implementation
     SET_JOIN_DISTRIBUTION,
@@ -153,6 +154,11 @@ public:
         return empty;
     }
 
+    // Whether transformImpl() records expressions or auxiliary state into the memo
+    // directly instead of only returning rewritten plans. Such rules must be applied
+    // under an exclusive memo lock when groups are explored concurrently.
+    virtual bool mutatesMemo() const { return false; }
+
     IQueryPlanStep::Type getTargetType()
     {
         if (target_type == IQueryPlanStep::Type::UNDEFINED)
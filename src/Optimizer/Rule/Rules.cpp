@@ -80,6 +80,7 @@ std::vector<RulePtr> Rules::pushPartialStepRules()
         std::make_shared<PushPartialSortingThroughExchange>(),
         std::make_shared<PushPartialLimitThroughExchange>(),
         std::make_shared<FilterWindowToPartitionTopN>(),
+        std::make_shared<CreateLateMaterializationForTopN>(),
         std::make_shared<PushDynamicFilterBuilderThroughExchange>()};
 }
 
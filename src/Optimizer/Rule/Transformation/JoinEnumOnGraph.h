@@ -39,6 +39,9 @@ public:
 
     const std::vector<RuleType> & blockRules() const override;
 
+    // join enumeration records expressions and join sets into the memo inside transformImpl()
+    bool mutatesMemo() const override { return true; }
+
 private:
     TransformResult transformImpl(PlanNodePtr node, const Captures & captures, RuleContext & context) override;
     bool support_filter;
@@ -31,7 +31,7 @@ BroadcastExchangeSink::BroadcastExchangeSink(Block header_, BroadcastSenderPtrs
     , name(name_)
     , senders(std::move(senders_))
     , options(std::move(options_))
-    , buffer_chunk(getPort().getHeader(), options.send_threshold_in_bytes, options.send_threshold_in_row_num)
+    , buffer_chunk(getPort().getHeader(), options.send_threshold_in_bytes, options.send_threshold_in_row_num, options.send_flush_interval_ms)
     , logger(&Poco::Logger::get("BroadcastExchangeSink"))
 {
     if (options.force_use_buffer)
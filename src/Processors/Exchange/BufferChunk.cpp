@@ -24,11 +24,12 @@
 namespace DB
 {
 BufferChunk::BufferChunk(
-    const Block & header_, UInt64 threshold_in_bytes_, UInt64 threshold_in_row_num_)
+    const Block & header_, UInt64 threshold_in_bytes_, UInt64 threshold_in_row_num_, UInt64 flush_interval_ms_)
     : header(header_)
     , column_num(header_.getColumns().size())
     , threshold_in_bytes(threshold_in_bytes_)
     , threshold_in_row_num(threshold_in_row_num_)
+    , flush_interval_ms(flush_interval_ms_)
     , logger(&Poco::Logger::get("BufferChunk"))
 {
     resetBuffer();
@@ -43,7 +44,8 @@ Chunk BufferChunk::flush(bool force)
 
     if (!force)
     {
-        if (bufferBytes() < threshold_in_bytes && rows < threshold_in_row_num)
+        bool interval_expired = flush_interval_ms && buffer_age.elapsedMilliseconds() >= flush_interval_ms;
+        if (bufferBytes() < threshold_in_bytes && rows < threshold_in_row_num && !interval_expired)
             return empty;
     }
 
@@ -75,6 +77,7 @@ Chunk BufferChunk::add(Chunk chunk)
         auto res = flush(true);
         current_chunk_info = std::move(chunk.getChunkInfo());
         buffer_columns = chunk.mutateColumns();
+        buffer_age.restart();
         return res;
     }
 
@@ -83,9 +86,12 @@ Chunk BufferChunk::add(Chunk chunk)
     {
         current_chunk_info = std::move(chunk.getChunkInfo());
         buffer_columns = chunk.mutateColumns();
+        buffer_age.restart();
         return res;
     }
 
+    if (buffer_columns[0]->empty())
+        buffer_age.restart();
     MutableColumns columns = chunk.mutateColumns();
     for (size_t i = 0; i < buffer_columns.size(); i++)
     {
@@ -19,6 +19,7 @@
 #include <Columns/IColumn.h>
 #include <Core/Block.h>
 #include <Processors/Chunk.h>
+#include <Common/Stopwatch.h>
 #include <Poco/Logger.h>
 
 
@@ -27,7 +28,7 @@ namespace DB
 class BufferChunk
 {
 public:
-    BufferChunk(const Block & header, UInt64 threshold_in_bytes, UInt64 threshold_in_row_num);
+    BufferChunk(const Block & header, UInt64 threshold_in_bytes, UInt64 threshold_in_row_num, UInt64 flush_interval_ms_ = 0);
     Chunk add(Chunk chunk);
     Chunk flush(bool force);
     void resetBuffer();
@@ -37,6 +38,10 @@ private:
     size_t column_num;
     UInt64 threshold_in_bytes;
     UInt64 threshold_in_row_num;
+    /// Latency cap for coalescing, 0 - flush on size thresholds only
+    UInt64 flush_interval_ms;
+    /// Age of the oldest buffered row, restarted when the empty buffer gets data
+    Stopwatch buffer_age;
     MutableColumns buffer_columns;
     ChunkInfoPtr current_chunk_info;
     Poco::Logger * logger;
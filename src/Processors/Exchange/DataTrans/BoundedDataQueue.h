@@ -35,18 +35,22 @@ template <typename T>
 class BoundedDataQueue
 {
 public:
-    explicit BoundedDataQueue(size_t capacity_ = 20) : full_cv(), empty_cv(), capacity(capacity_) { }
+    explicit BoundedDataQueue(size_t capacity_ = 20, size_t bytes_capacity_ = 0)
+        : full_cv(), empty_cv(), capacity(capacity_), bytes_capacity(bytes_capacity_)
+    {
+    }
 
     void push(const T & x)
     {
         std::unique_lock<bthread::Mutex> lock(mutex);
-        while (queue.size() == capacity && !is_closed)
+        while (!hasSpaceFor(0) && !is_closed)
         {
             full_cv.wait(lock);
         }
         if (is_closed)
             throw Exception("Queue is closed", ErrorCodes::STD_EXCEPTION);
         queue.push(x);
+        recordPush(0);
         empty_cv.notify_all();
     }
 
@@ -61,13 +65,14 @@ public:
             throw Exception("Queue is closed", ErrorCodes::STD_EXCEPTION);
         ::detail::moveOrCopyIfThrow(std::move(queue.front()), x);
         queue.pop();
+        recordPop();
         full_cv.notify_all();
     }
 
     bool tryPush(const T & x, UInt64 milliseconds = 0)
     {
         std::unique_lock<bthread::Mutex> lock(mutex);
-        while (queue.size() == capacity && !is_closed)
+        while (!hasSpaceFor(0) && !is_closed)
         {
             if (ETIMEDOUT == full_cv.wait_for(lock, milliseconds * 1000))
                 return false;
@@ -75,6 +80,7 @@ public:
         if (is_closed)
             return false;
         queue.push(x);
+        recordPush(0);
         empty_cv.notify_all();
         return true;
     }
@@ -93,6 +99,7 @@ public:
 
         ::detail::moveOrCopyIfThrow(std::move(queue.front()), x);
         queue.pop();
+        recordPop();
         full_cv.notify_all();
         return true;
     }
@@ -101,7 +108,26 @@ public:
     bool tryEmplace(UInt64 milliseconds, Args &&... args)
     {
         std::unique_lock<bthread::Mutex> lock(mutex);
-        while (queue.size() == capacity && !is_closed)
+        while (!hasSpaceFor(0) && !is_closed)
+        {
+            if (ETIMEDOUT == full_cv.wait_for(lock, milliseconds * 1000))
+                return false;
+        }
+        if (is_closed)
+            return false;
+        queue.emplace(std::forward<Args>(args)...);
+        recordPush(0);
+        empty_cv.notify_all();
+        return true;
+    }
+
+    /// Same as tryEmplace but charges the element against the byte budget of the
+    /// queue, so producers of wide rows block earlier than producers of narrow rows
+    template <typename... Args>
+    bool tryEmplaceWithBytes(UInt64 milliseconds, size_t bytes, Args &&... args)
+    {
+        std::unique_lock<bthread::Mutex> lock(mutex);
+        while (!hasSpaceFor(bytes) && !is_closed)
         {
             if (ETIMEDOUT == full_cv.wait_for(lock, milliseconds * 1000))
                 return false;
@@ -109,6 +135,7 @@ public:
         if (is_closed)
             return false;
         queue.emplace(std::forward<Args>(args)...);
+        recordPush(bytes);
         empty_cv.notify_all();
         return true;
     }
@@ -134,6 +161,9 @@ public:
         }
         std::queue<T> empty_queue;
         std::swap(empty_queue, queue);
+        std::queue<size_t> empty_bytes_queue;
+        std::swap(empty_bytes_queue, element_bytes);
+        current_bytes = 0;
     }
 
     void setCapacity(size_t queue_capacity)
@@ -157,11 +187,46 @@ public:
     bool closed() { return is_closed; }
 
 private:
+    /// A push is admitted when there is a free slot and it fits the byte budget.
+    /// Zero-byte elements (sentinels) are never blocked by the budget and any
+    /// element is admitted into an empty queue, so one oversized chunk cannot
+    /// deadlock the exchange
+    bool hasSpaceFor(size_t bytes) const
+    {
+        if (queue.size() >= capacity)
+            return false;
+        if (bytes_capacity && bytes && !queue.empty() && current_bytes + bytes > bytes_capacity)
+            return false;
+        return true;
+    }
+
+    void recordPush(size_t bytes)
+    {
+        if (bytes_capacity)
+        {
+            element_bytes.push(bytes);
+            current_bytes += bytes;
+        }
+    }
+
+    void recordPop()
+    {
+        if (bytes_capacity)
+        {
+            current_bytes -= element_bytes.front();
+            element_bytes.pop();
+        }
+    }
+
     std::queue<T> queue;
+    /// Byte size recorded for each queued element, maintained only when bytes_capacity is set
+    std::queue<size_t> element_bytes;
     bthread::Mutex mutex;
     bthread::ConditionVariable full_cv;
     bthread::ConditionVariable empty_cv;
     size_t capacity;
+    size_t bytes_capacity;
+    size_t current_bytes = 0;
     bool is_closed = false;
 };
 
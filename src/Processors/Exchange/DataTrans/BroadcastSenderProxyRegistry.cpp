@@ -49,6 +49,20 @@ void BroadcastSenderProxyRegistry::remove(ExchangeDataKeyPtr data_key)
     LOG_TRACE(logger, "remove proxy {} with result: {} ", data_key->dump(), result);
 }
 
+BroadcastSenderProxyPtrs BroadcastSenderProxyRegistry::getQueryProxies(const String & query_id)
+{
+    std::lock_guard lock(mutex);
+    BroadcastSenderProxyPtrs res;
+    for (const auto & [key, entry] : proxies)
+    {
+        if (key.query_id != query_id)
+            continue;
+        if (auto proxy = entry.lock())
+            res.emplace_back(std::move(proxy));
+    }
+    return res;
+}
+
 size_t BroadcastSenderProxyRegistry::countProxies()
 {
     std::lock_guard lock(mutex);
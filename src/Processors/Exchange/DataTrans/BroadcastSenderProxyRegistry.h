@@ -47,6 +47,10 @@ public:
 
     void remove(ExchangeDataKeyPtr data_key);
 
+    /// All live proxies belonging to one distributed query, used to tear down
+    /// every channel of the query at once when it is cancelled
+    BroadcastSenderProxyPtrs getQueryProxies(const String & query_id);
+
     size_t countProxies();
 
 private:
@@ -46,7 +46,7 @@ BrpcRemoteBroadcastReceiver::BrpcRemoteBroadcastReceiver(
     , registry_address(std::move(registry_address_))
     , context(std::move(context_))
     , header(std::move(header_))
-    , queue(context->getSettingsRef().exchange_remote_receiver_queue_size)
+    , queue(context->getSettingsRef().exchange_remote_receiver_queue_size, context->getSettingsRef().exchange_queue_bytes_limit)
     , data_key(trans_key->getKey())
     , keep_order(keep_order_)
 {
@@ -141,7 +141,15 @@ void BrpcRemoteBroadcastReceiver::pushReceiveQueue(Chunk chunk)
 {
     if (queue.closed())
         return;
-    if (!queue.tryEmplace(context->getSettingsRef().exchange_timeout_ms, std::move(chunk)))
+    /// In keep order mode the payload lives in the chunk columns, otherwise the
+    /// still serialized block is carried by the attached IOBuf chunk info
+    size_t bytes = chunk.allocatedBytes();
+    if (const auto & info = chunk.getChunkInfo())
+    {
+        if (auto iobuf_info = std::dynamic_pointer_cast<const DeserializeBufTransform::IOBufChunkInfo>(info))
+            bytes += iobuf_info->io_buf.length();
+    }
+    if (!queue.tryEmplaceWithBytes(context->getSettingsRef().exchange_timeout_ms, bytes, std::move(chunk)))
         throw Exception(
             "Push exchange data to receiver for " + getName() + " timeout for "
                 + std::to_string(context->getSettingsRef().exchange_timeout_ms) + " ms.",
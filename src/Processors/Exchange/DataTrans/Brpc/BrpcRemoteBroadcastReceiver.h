@@ -57,6 +57,7 @@ public:
     RecvDataPacket recv(UInt32 timeout_ms) noexcept override;
     BroadcastStatus finish(BroadcastStatusCode status_code_, String message) override;
     String getName() const override;
+    BroadcastReceiverType getReceiverType() const override { return BroadcastReceiverType::Brpc; }
     void pushReceiveQueue(Chunk chunk);
     void setSendDoneFlag() { send_done_flag.test_and_set(std::memory_order_release); }
 
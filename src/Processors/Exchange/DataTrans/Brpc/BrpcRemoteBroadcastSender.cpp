@@ -21,9 +21,12 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <Compression/CompressedWriteBuffer.h>
 #include <Compression/CompressionFactory.h>
 #include <DataTypes/DataTypeFactory.h>
+#include <DataTypes/DataTypeLowCardinality.h>
+#include <IO/VarInt.h>
 #include <Interpreters/QueryExchangeLog.h>
 #include <Processors/Exchange/DataTrans/DataTransException.h>
 #include <Processors/Exchange/DataTrans/IBroadcastSender.h>
@@ -146,26 +149,185 @@ BroadcastStatus BrpcRemoteBroadcastSender::send(Chunk chunk) noexcept
     }
 }
 
+namespace
+{
+    /// Payloads smaller than this are cheaper to memcpy than to track as slices
+    constexpr size_t MIN_ZERO_COPY_SLICE_BYTES = 4096;
+
+    /// IOBuf::append_user_data hands only the payload pointer back to the deleter,
+    /// so the column refcount holders are parked here until brpc releases the slice
+    std::mutex zero_copy_holders_mutex;
+    std::unordered_multimap<const void *, ColumnPtr> zero_copy_holders;
+
+    void releaseZeroCopySlice(void * data)
+    {
+        std::lock_guard lock(zero_copy_holders_mutex);
+        auto it = zero_copy_holders.find(data);
+        if (it != zero_copy_holders.end())
+            zero_copy_holders.erase(it);
+    }
+}
+
+void BrpcRemoteBroadcastSender::serializeChunkZeroCopy(Chunk chunk, WriteBufferFromBrpcBuf & out) const
+{
+    const auto & settings = context->getSettingsRef();
+    bool remove_low_cardinality = !settings.low_cardinality_allow_in_native_format;
+
+    /// Chunk info and dimensions, identical to NativeChunkOutputStream::write
+    auto chunk_info = chunk.getChunkInfo();
+    if (chunk_info)
+    {
+        writeVarUInt(1, out);
+        writeVarUInt(static_cast<UInt8>(chunk_info->getType()), out);
+        chunk_info->write(out);
+    }
+    else
+    {
+        writeVarUInt(0, out);
+    }
+
+    size_t columns = chunk.getNumColumns();
+    size_t rows = chunk.getNumRows();
+    writeVarUInt(columns, out);
+    writeVarUInt(rows, out);
+
+    for (size_t i = 0; i < columns; ++i)
+    {
+        DataTypePtr data_type = header.getDataTypes().at(i);
+        ColumnPtr column_ptr = chunk.getColumns()[i];
+        if (remove_low_cardinality)
+        {
+            column_ptr = recursiveRemoveLowCardinality(column_ptr);
+            data_type = recursiveRemoveLowCardinality(data_type);
+        }
+
+        if (!rows)
+            continue;
+
+        /// For fixed width contiguous columns the native payload is the raw column
+        /// memory, so it can be attached to the IOBuf without a copy; the holder
+        /// keeps the column alive until brpc drops the last reference
+        ColumnPtr full_column = column_ptr->convertToFullColumnIfConst();
+        if (full_column->isFixedAndContiguous())
+        {
+            StringRef raw = full_column->getRawData();
+            if (raw.size >= MIN_ZERO_COPY_SLICE_BYTES)
+            {
+                {
+                    std::lock_guard lock(zero_copy_holders_mutex);
+                    zero_copy_holders.emplace(raw.data, full_column);
+                }
+                out.appendExternal(raw.data, raw.size, releaseZeroCopySlice);
+                continue;
+            }
+        }
+
+        NativeChunkOutputStream::writeData(*data_type, full_column, out, 0, 0);
+    }
+}
+
+namespace
+{
+    /// Re-evaluate the adaptive codec of a link after this many sends
+    constexpr size_t ADAPTIVE_COMPRESS_WINDOW = 32;
+    /// Links at or above this effective throughput are considered local, copying
+    /// through a codec there costs more than the bytes it saves
+    constexpr size_t ADAPTIVE_FAST_LINK_BYTES_PER_MS = 256 * 1024;
+    /// Links at or below this are considered cross AZ and worth harder compression
+    constexpr size_t ADAPTIVE_SLOW_LINK_BYTES_PER_MS = 32 * 1024;
+    /// Data saving less than this percentage is treated as incompressible
+    constexpr size_t ADAPTIVE_MIN_SAVED_PCT = 5;
+}
+
+CompressionCodecPtr BrpcRemoteBroadcastSender::chooseAdaptiveCodec() const
+{
+    size_t sends = metric.num_send_times.load(std::memory_order_relaxed);
+    if (sends >= ADAPTIVE_COMPRESS_WINDOW && sends % ADAPTIVE_COMPRESS_WINDOW == 0)
+    {
+        size_t sent_bytes = metric.send_bytes.load(std::memory_order_relaxed);
+        size_t uncompressed_bytes = metric.send_uncompressed_bytes.load(std::memory_order_relaxed);
+        size_t total_time_ms = metric.send_time_ms.load(std::memory_order_relaxed);
+        size_t ser_time_ms = metric.ser_time_ms.load(std::memory_order_relaxed);
+        /// send_time_ms includes serialization, subtract it to approximate the wire time
+        size_t wire_time_ms = total_time_ms > ser_time_ms ? total_time_ms - ser_time_ms : 1;
+        size_t bytes_per_ms = sent_bytes / std::max<size_t>(wire_time_ms, 1);
+
+        AdaptiveCodec choice = AdaptiveCodec::LZ4;
+        if (uncompressed_bytes > sent_bytes
+            && (uncompressed_bytes - sent_bytes) * 100 < uncompressed_bytes * ADAPTIVE_MIN_SAVED_PCT)
+            choice = AdaptiveCodec::None;
+        else if (bytes_per_ms >= ADAPTIVE_FAST_LINK_BYTES_PER_MS)
+            choice = AdaptiveCodec::None;
+        else if (bytes_per_ms <= ADAPTIVE_SLOW_LINK_BYTES_PER_MS)
+            choice = AdaptiveCodec::ZSTD;
+
+        if (choice != adaptive_codec.load(std::memory_order_relaxed))
+        {
+            LOG_DEBUG(
+                log,
+                "Adaptive exchange compression switched to {} after {} sends, link throughput {} bytes/ms",
+                choice == AdaptiveCodec::None ? "NONE" : (choice == AdaptiveCodec::ZSTD ? "ZSTD" : "LZ4"),
+                sends,
+                bytes_per_ms);
+            adaptive_codec.store(choice, std::memory_order_relaxed);
+        }
+    }
+
+    switch (adaptive_codec.load(std::memory_order_relaxed))
+    {
+        case AdaptiveCodec::None:
+            return CompressionCodecFactory::instance().get("NONE", {});
+        case AdaptiveCodec::ZSTD:
+            return CompressionCodecFactory::instance().get(
+                "ZSTD", static_cast<int>(context->getSettingsRef().network_zstd_compression_level));
+        case AdaptiveCodec::LZ4:
+            break;
+    }
+    return CompressionCodecFactory::instance().get("LZ4", {});
+}
+
 void BrpcRemoteBroadcastSender::serializeChunkToIoBuffer(Chunk chunk, WriteBufferFromBrpcBuf & out) const
 {
-    const auto settings = context->getSettingsRef();
+    const auto & settings = context->getSettingsRef();
     if (settings.exchange_enable_block_compress)
     {
-        std::string method = Poco::toUpper(settings.network_compression_method.toString());
-        std::optional<int> level;
-        if (method == "ZSTD")
-            level = settings.network_zstd_compression_level;
-        const CompressionCodecPtr & codec = CompressionCodecFactory::instance().get(method, level);
+        CompressionCodecPtr codec;
+        if (settings.exchange_enable_adaptive_compress)
+        {
+            codec = chooseAdaptiveCodec();
+        }
+        else
+        {
+            std::string method = Poco::toUpper(settings.network_compression_method.toString());
+            std::optional<int> level;
+            if (method == "ZSTD")
+                level = settings.network_zstd_compression_level;
+            codec = CompressionCodecFactory::instance().get(method, level);
+        }
         CompressedWriteBuffer compressed_out(out, codec, DBMS_DEFAULT_BUFFER_SIZE * 2);
         NativeChunkOutputStream chunk_out(
-            compressed_out, DBMS_TCP_PROTOCOL_VERSION, header, !settings.low_cardinality_allow_in_native_format);
+            compressed_out,
+            DBMS_TCP_PROTOCOL_VERSION,
+            header,
+            !settings.low_cardinality_allow_in_native_format,
+            settings.exchange_enable_sparse_serialization,
+            settings.exchange_parallel_deserialize_threads > 1);
         chunk_out.write(chunk);
         compressed_out.next();
     }
+    else if (settings.exchange_enable_zero_copy_send)
+    {
+        serializeChunkZeroCopy(std::move(chunk), out);
+    }
     else
     {
         NativeChunkOutputStream chunk_out(
-            out, DBMS_TCP_PROTOCOL_VERSION, header, !settings.low_cardinality_allow_in_native_format);
+            out,
+            DBMS_TCP_PROTOCOL_VERSION,
+            header,
+            !settings.low_cardinality_allow_in_native_format,
+            settings.exchange_enable_sparse_serialization,
+            settings.exchange_parallel_deserialize_threads > 1);
         chunk_out.write(chunk);
     }
 }
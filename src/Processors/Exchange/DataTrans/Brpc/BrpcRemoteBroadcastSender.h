@@ -18,6 +18,7 @@
 #include <atomic>
 #include <mutex>
 #include <vector>
+#include <Compression/ICompressionCodec.h>
 #include <Interpreters/Context.h>
 #include <Processors/Chunk.h>
 #include <Processors/Exchange/DataTrans/IBroadcastSender.h>
@@ -68,5 +69,26 @@ private:
 
     BroadcastStatus sendIOBuffer(const butil::IOBuf & io_buffer, brpc::StreamId stream_id, const String & data_key);
     void serializeChunkToIoBuffer(Chunk chunk, WriteBufferFromBrpcBuf & out) const;
+
+    /// Same wire format as NativeChunkOutputStream, but fixed width column payloads
+    /// are attached to the IOBuf as refcounted slices instead of being copied. Only
+    /// used when block compression is off
+    void serializeChunkZeroCopy(Chunk chunk, WriteBufferFromBrpcBuf & out) const;
+
+    enum class AdaptiveCodec : Int8
+    {
+        None,
+        LZ4,
+        ZSTD,
+    };
+
+    /// Codec currently chosen for this link by the adaptive heuristic; the codec
+    /// byte is carried in every compressed frame, so the receiver follows the
+    /// switches without any coordination
+    mutable std::atomic<AdaptiveCodec> adaptive_codec{AdaptiveCodec::LZ4};
+
+    /// Re-evaluate the codec for this link from the send metrics: skip compression
+    /// on fast links or incompressible data, compress harder on slow links
+    CompressionCodecPtr chooseAdaptiveCodec() const;
 };
 }
@@ -51,6 +51,27 @@ public:
         set(const_cast<Position>(block_view.data()), block_view.size());
     }
 
+    /// Attach externally owned memory to the IOBuf as a refcounted slice instead of
+    /// copying it through the working buffer. deleter is invoked with data once brpc
+    /// has released the last reference to the slice
+    void appendExternal(const void * data, size_t size, void (*deleter)(void *))
+    {
+        if (is_finished)
+            throw Exception("WriteBufferFromBrpcBuf is finished", ErrorCodes::CANNOT_WRITE_AFTER_END_OF_BUFFER);
+
+        /// Flush pending bytes of the working buffer, attach the slice, then
+        /// continue serializing into a fresh block
+        buf.resize(buf.size() - available());
+        if (buf.append_user_data(const_cast<void *>(data), size, deleter) != 0)
+            throw Exception("Cannot append user data of size " + std::to_string(size) + " to butil::IOBuf",
+                ErrorCodes::DISTRIBUTE_STAGE_QUERY_EXCEPTION);
+
+        auto block_view = buf.expand(initial_size);
+        if (block_view.empty())
+            throw Exception("Cannot resize butil::IOBuf to " + std::to_string(initial_size), ErrorCodes::DISTRIBUTE_STAGE_QUERY_EXCEPTION);
+        set(const_cast<Position>(block_view.data()), block_view.size());
+    }
+
     void finish()
     {
         if (is_finished)
@@ -0,0 +1,111 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include <Interpreters/Context.h>
+#include <Interpreters/DistributedStages/AddressInfo.h>
+#include <Interpreters/QueryExchangeLog.h>
+#include <Processors/Exchange/DataTrans/Brpc/BrpcRemoteBroadcastReceiver.h>
+#include <Processors/Exchange/DataTrans/ExchangeTransportFactory.h>
+#include <Processors/Exchange/DataTrans/IBroadcastReceiver.h>
+#include <Processors/Exchange/DataTrans/Local/LocalBroadcastChannel.h>
+#include <Processors/Exchange/ExchangeUtils.h>
+#include <Poco/Logger.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+BroadcastReceiverType ExchangeTransportFactory::chooseTransport(
+    const AddressInfo & read_address_info, const AddressInfo & write_address_info, const ExchangeOptions & options)
+{
+    if (ExchangeUtils::isLocalExchange(read_address_info, write_address_info) && !options.force_remote_mode)
+        return BroadcastReceiverType::Local;
+    return BroadcastReceiverType::Brpc;
+}
+
+BroadcastReceiverPtr ExchangeTransportFactory::createReceiver(
+    ContextPtr context,
+    ExchangeDataKeyPtr data_key,
+    const AddressInfo & read_address_info,
+    const AddressInfo & write_address_info,
+    const Block & header,
+    bool keep_order,
+    const LocalChannelOptions & local_options,
+    const ExchangeOptions & options,
+    size_t write_plan_segment_id,
+    size_t read_plan_segment_id)
+{
+    static auto * logger = &Poco::Logger::get("ExchangeTransportFactory");
+    String query_id = data_key->getQueryId();
+    size_t exchange_id = data_key->getExchangeId();
+    size_t partition_id = data_key->getParallelIndex();
+
+    switch (chooseTransport(read_address_info, write_address_info, options))
+    {
+        case BroadcastReceiverType::Local: {
+            LOG_DEBUG(
+                logger,
+                "Create local exchange source : {}@{} for plansegment {}->{}",
+                data_key->dump(),
+                extractExchangeHostPort(write_address_info),
+                write_plan_segment_id,
+                read_plan_segment_id);
+            std::shared_ptr<QueryExchangeLog> query_exchange_log = nullptr;
+            if (context->getSettingsRef().log_query_exchange && context->getQueryExchangeLog())
+                query_exchange_log = context->getQueryExchangeLog();
+            String name = LocalBroadcastChannel::generateName(
+                query_id, exchange_id, write_plan_segment_id, read_plan_segment_id, partition_id);
+            auto local_channel = std::make_shared<LocalBroadcastChannel>(std::move(data_key), local_options, name, query_exchange_log);
+            return std::dynamic_pointer_cast<IBroadcastReceiver>(local_channel);
+        }
+        case BroadcastReceiverType::Brpc: {
+            /// A forced remote channel between collocated segments registers to the
+            /// local exchange port, a genuine remote one to the sender host
+            String registry_address;
+            if (ExchangeUtils::isLocalExchange(read_address_info, write_address_info))
+            {
+                registry_address = context->getHostWithPorts().getExchangeAddress();
+                LOG_DEBUG(
+                    logger,
+                    "Force local exchange use remote source : {}@{} for plansegment {}->{}",
+                    data_key->dump(),
+                    registry_address,
+                    write_plan_segment_id,
+                    read_plan_segment_id);
+            }
+            else
+            {
+                registry_address = extractExchangeHostPort(write_address_info);
+                LOG_DEBUG(
+                    logger,
+                    "Create remote exchange source : {}@{} for plansegment {}->{}",
+                    data_key->dump(),
+                    registry_address,
+                    write_plan_segment_id,
+                    read_plan_segment_id);
+            }
+            String name = BrpcRemoteBroadcastReceiver::generateName(
+                query_id, exchange_id, write_plan_segment_id, read_plan_segment_id, partition_id);
+            auto brpc_receiver = std::make_shared<BrpcRemoteBroadcastReceiver>(
+                std::move(data_key), std::move(registry_address), std::move(context), header, keep_order, name);
+            return std::dynamic_pointer_cast<IBroadcastReceiver>(brpc_receiver);
+        }
+    }
+    __builtin_unreachable();
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Core/Block.h>
+#include <Interpreters/Context_fwd.h>
+#include <Interpreters/DistributedStages/AddressInfo.h>
+#include <Processors/Exchange/DataTrans/DataTrans_fwd.h>
+#include <Processors/Exchange/DataTrans/IBroadcastReceiver.h>
+#include <Processors/Exchange/DataTrans/Local/LocalChannelOptions.h>
+#include <Processors/Exchange/ExchangeDataKey.h>
+#include <Processors/Exchange/ExchangeOptions.h>
+
+namespace DB
+{
+/// Single place where the transport of one exchange channel is picked.
+///
+/// Every transport hides behind the IBroadcastSender/IBroadcastReceiver pair:
+/// the receiver side is built here and the matching sender side is resolved
+/// lazily through BroadcastSenderProxy when the receiver registers itself -
+/// in-process registration for the local channel, the registry rpc service for
+/// brpc. A transport for colocated workers (shared memory rings, RDMA verbs)
+/// plugs in by implementing the two interfaces, adding a value to
+/// BroadcastReceiverType and a branch to chooseTransport/createReceiver; code
+/// outside DataTrans only ever sees the interfaces.
+class ExchangeTransportFactory
+{
+public:
+    /// Chunks stay in process when source and sink run in the same server and
+    /// remote mode is not forced, every other channel rides brpc for now
+    static BroadcastReceiverType chooseTransport(
+        const AddressInfo & read_address_info, const AddressInfo & write_address_info, const ExchangeOptions & options);
+
+    static BroadcastReceiverPtr createReceiver(
+        ContextPtr context,
+        ExchangeDataKeyPtr data_key,
+        const AddressInfo & read_address_info,
+        const AddressInfo & write_address_info,
+        const Block & header,
+        bool keep_order,
+        const LocalChannelOptions & local_options,
+        const ExchangeOptions & options,
+        size_t write_plan_segment_id,
+        size_t read_plan_segment_id);
+};
+
+}
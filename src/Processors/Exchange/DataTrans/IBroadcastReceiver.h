@@ -23,6 +23,13 @@
 namespace DB
 {
 using RecvDataPacket = std::variant<Chunk, BroadcastStatus>;
+
+enum class BroadcastReceiverType
+{
+    Local = 0,
+    Brpc
+};
+
 class IBroadcastReceiver
 {
 public:
@@ -30,6 +37,7 @@ public:
     virtual RecvDataPacket recv(UInt32 timeout_ms) = 0;
     virtual BroadcastStatus finish(BroadcastStatusCode status_code_, String message) = 0;
     virtual String getName() const = 0;
+    virtual BroadcastReceiverType getReceiverType() const = 0;
     virtual ~IBroadcastReceiver() = default;
 };
 
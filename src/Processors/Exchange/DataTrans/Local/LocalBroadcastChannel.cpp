@@ -36,7 +36,7 @@ LocalBroadcastChannel::LocalBroadcastChannel(
     : name(name_)
     , data_key(std::move(data_key_))
     , options(std::move(options_))
-    , receive_queue(options.queue_size)
+    , receive_queue(options.queue_size, options.queue_bytes_limit)
     , logger(&Poco::Logger::get("LocalBroadcastChannel"))
     , query_exchange_log(query_exchange_log_)
 {
@@ -81,7 +81,7 @@ BroadcastStatus LocalBroadcastChannel::send(Chunk chunk)
 
     auto bytes = chunk.allocatedBytes();
     send_metric.send_uncompressed_bytes += bytes;
-    if (receive_queue.tryEmplace(options.max_timeout_ms / 2, std::move(chunk)))
+    if (receive_queue.tryEmplaceWithBytes(options.max_timeout_ms / 2, bytes, std::move(chunk)))
     {
         ExchangeUtils::transferThreadMemoryToGlobal(bytes);
         return *broadcast_status.load(std::memory_order_acquire);
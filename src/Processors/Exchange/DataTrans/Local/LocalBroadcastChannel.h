@@ -49,6 +49,7 @@ public:
     void merge(IBroadcastSender &&) override;
     String getName() const override;
     BroadcastSenderType getType() override { return BroadcastSenderType::Local; }
+    BroadcastReceiverType getReceiverType() const override { return BroadcastReceiverType::Local; }
     BroadcastStatus finish(BroadcastStatusCode status_code, String message) override;
     BroadcastStatus send(Chunk chunk) override;
     ~LocalBroadcastChannel() override;
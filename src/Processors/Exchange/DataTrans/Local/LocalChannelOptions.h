@@ -20,5 +20,7 @@ namespace DB {
 struct LocalChannelOptions{
     size_t queue_size;
     UInt32 max_timeout_ms;
+    /// Byte budget of the receive queue in addition to queue_size, 0 - unlimited
+    size_t queue_bytes_limit = 0;
 };
 }
@@ -14,12 +14,17 @@
  */
 
 #include "NativeChunkInputStream.h"
+#include "NativeChunkOutputStream.h"
 
 #include <DataTypes/DataTypeFactory.h>
 #include <DataTypes/DataTypeLowCardinality.h>
+#include <IO/BufferWithOwnMemory.h>
+#include <IO/ReadBufferFromMemory.h>
 #include <IO/ReadHelpers.h>
 #include <Processors/Transforms/AggregatingTransform.h>
+#include <Common/CurrentThread.h>
 #include <Common/typeid_cast.h>
+#include <common/scope_guard_safe.h>
 
 namespace DB
 {
@@ -30,7 +35,15 @@ namespace ErrorCodes
     extern const int CANNOT_READ_ALL_DATA;
 }
 
-NativeChunkInputStream::NativeChunkInputStream(ReadBuffer & istr_, const Block & header_) : istr(istr_), header(header_)
+namespace
+{
+    /// Column-parallel decode only pays off for genuinely wide and heavy chunks.
+    constexpr size_t MIN_COLUMNS_FOR_PARALLEL_DESERIALIZATION = 32;
+    constexpr size_t MIN_BYTES_FOR_PARALLEL_DESERIALIZATION = 1 << 20;
+}
+
+NativeChunkInputStream::NativeChunkInputStream(ReadBuffer & istr_, const Block & header_, ThreadPool * deserialize_pool_)
+    : istr(istr_), header(header_), deserialize_pool(deserialize_pool_)
 {
 }
 
@@ -56,6 +69,55 @@ void NativeChunkInputStream::readData(
             ErrorCodes::CANNOT_READ_ALL_DATA);
 }
 
+void NativeChunkInputStream::readDataMaybeSparse(
+    const IDataType & type, ColumnPtr & column, ReadBuffer & istr, size_t rows, double avg_value_size_hint)
+{
+    bool is_sparse = false;
+    readBinary(is_sparse, istr);
+    if (!is_sparse)
+    {
+        readData(type, column, istr, rows, avg_value_size_hint);
+        return;
+    }
+
+    size_t non_default_rows = 0;
+    readVarUInt(non_default_rows, istr);
+
+    /// Delta-encoded row numbers of the non-default values.
+    PODArray<UInt64> row_numbers(non_default_rows);
+    UInt64 prev_row = 0;
+    for (size_t i = 0; i < non_default_rows; ++i)
+    {
+        UInt64 gap;
+        readVarUInt(gap, istr);
+        prev_row += gap;
+        row_numbers[i] = prev_row;
+    }
+
+    ColumnPtr values = type.createColumn();
+    if (non_default_rows)
+        readData(type, values, istr, non_default_rows, avg_value_size_hint);
+
+    MutableColumnPtr dense = IColumn::mutate(std::move(column));
+    dense->reserve(rows);
+    size_t next_row = 0;
+    for (size_t i = 0; i < non_default_rows; ++i)
+    {
+        if (row_numbers[i] >= rows)
+            throw Exception(
+                "Sparse column row number " + toString(row_numbers[i]) + " is out of range, " + toString(rows) + " rows expected",
+                ErrorCodes::INCORRECT_INDEX);
+        if (row_numbers[i] > next_row)
+            dense->insertManyDefaults(row_numbers[i] - next_row);
+        dense->insertFrom(*values, i);
+        next_row = row_numbers[i] + 1;
+    }
+    if (next_row < rows)
+        dense->insertManyDefaults(rows - next_row);
+
+    column = std::move(dense);
+}
+
 Chunk NativeChunkInputStream::readImpl()
 {
     Chunk res;
@@ -64,10 +126,10 @@ Chunk NativeChunkInputStream::readImpl()
         return res;
     }
 
-    /// chunk info
-    UInt8 has_chunk_info;
-    readVarUInt(has_chunk_info, istr);
-    if (has_chunk_info == 1)
+    /// chunk info and format flags
+    UInt8 chunk_flags;
+    readVarUInt(chunk_flags, istr);
+    if (chunk_flags & NativeChunkOutputStream::HAS_CHUNK_INFO)
     {
         UInt8 chunk_info_type;
         readVarUInt(chunk_info_type, istr);
@@ -86,6 +148,28 @@ Chunk NativeChunkInputStream::readImpl()
     readVarUInt(col_num, istr);
     readVarUInt(row_num, istr);
 
+    bool sparse_columns = chunk_flags & NativeChunkOutputStream::SPARSE_COLUMNS;
+
+    std::vector<UInt64> column_sizes;
+    if (chunk_flags & NativeChunkOutputStream::COLUMN_SIZES)
+    {
+        column_sizes.resize(col_num);
+        for (auto & column_size : column_sizes)
+            readVarUInt(column_size, istr);
+    }
+
+    if (row_num && deserialize_pool && !column_sizes.empty() && col_num >= MIN_COLUMNS_FOR_PARALLEL_DESERIALIZATION)
+    {
+        size_t total_bytes = 0;
+        for (auto column_size : column_sizes)
+            total_bytes += column_size;
+        if (total_bytes >= MIN_BYTES_FOR_PARALLEL_DESERIALIZATION)
+        {
+            res.setColumns(readColumnsParallel(column_sizes, row_num, sparse_columns), row_num);
+            return res;
+        }
+    }
+
     Columns columns;
     for (size_t i = 0; i < col_num; ++i)
     {
@@ -96,12 +180,86 @@ Chunk NativeChunkInputStream::readImpl()
 
         double avg_value_size_hint = avg_value_size_hints.empty() ? 0 : avg_value_size_hints[i];
         if (row_num) /// If no row_num, nothing to read.
-            readData(*data_type, read_column, istr, row_num, avg_value_size_hint);
+        {
+            if (sparse_columns)
+                readDataMaybeSparse(*data_type, read_column, istr, row_num, avg_value_size_hint);
+            else
+                readData(*data_type, read_column, istr, row_num, avg_value_size_hint);
+        }
 
         columns.emplace_back(std::move(read_column));
     }
     res.setColumns(columns, row_num);
     return res;
 }
+
+Columns NativeChunkInputStream::readColumnsParallel(const std::vector<UInt64> & column_sizes, size_t row_num, bool sparse_columns)
+{
+    size_t col_num = column_sizes.size();
+    std::vector<size_t> offsets(col_num + 1, 0);
+    for (size_t i = 0; i < col_num; ++i)
+        offsets[i + 1] = offsets[i] + column_sizes[i];
+
+    /// One serial pass pulls (and, if need be, decompresses) the payload into
+    /// contiguous memory; after that the per-column slices decode independently.
+    Memory<> payload(offsets.back());
+    istr.readStrict(payload.data(), offsets.back());
+
+    Columns columns(col_num);
+    auto decode_range = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            ReadBufferFromMemory column_buf(payload.data() + offsets[i], column_sizes[i]);
+            DataTypePtr data_type = header.getDataTypes().at(i);
+            ColumnPtr read_column = data_type->createColumn();
+            double avg_value_size_hint = avg_value_size_hints.empty() ? 0 : avg_value_size_hints[i];
+            if (sparse_columns)
+                readDataMaybeSparse(*data_type, read_column, column_buf, row_num, avg_value_size_hint);
+            else
+                readData(*data_type, read_column, column_buf, row_num, avg_value_size_hint);
+            columns[i] = std::move(read_column);
+        }
+    };
+
+    /// Split the columns into contiguous ranges of roughly equal byte size,
+    /// one task per range; the first range is decoded on the calling thread.
+    size_t num_tasks = std::min(deserialize_pool->getMaxThreads(), col_num);
+    std::vector<size_t> range_bounds{0};
+    size_t target_bytes = (offsets.back() + num_tasks - 1) / num_tasks;
+    size_t accumulated = 0;
+    for (size_t i = 0; i < col_num; ++i)
+    {
+        accumulated += column_sizes[i];
+        if (accumulated >= target_bytes && i + 1 < col_num)
+        {
+            range_bounds.push_back(i + 1);
+            accumulated = 0;
+        }
+    }
+    range_bounds.push_back(col_num);
+
+    auto thread_group = CurrentThread::getGroup();
+    for (size_t task = 1; task + 1 < range_bounds.size(); ++task)
+        deserialize_pool->scheduleOrThrowOnError([&, thread_group, begin = range_bounds[task], end = range_bounds[task + 1]]
+        {
+            SCOPE_EXIT_SAFE(if (thread_group) CurrentThread::detachQueryIfNotDetached(););
+            if (thread_group)
+                CurrentThread::attachToIfDetached(thread_group);
+            decode_range(begin, end);
+        });
+
+    try
+    {
+        decode_range(range_bounds[0], range_bounds[1]);
+    }
+    catch (...)
+    {
+        deserialize_pool->wait();
+        throw;
+    }
+    deserialize_pool->wait();
+    return columns;
+}
 }
 
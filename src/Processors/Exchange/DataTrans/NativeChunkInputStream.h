@@ -20,6 +20,7 @@
 #include <DataStreams/NativeBlockInputStream.h>
 #include <Processors/Chunk.h>
 #include <Common/PODArray.h>
+#include <Common/ThreadPool.h>
 
 namespace DB
 {
@@ -31,16 +32,27 @@ class NativeChunkInputStream
 {
 public:
     /// For cases when data structure (header) is known in advance.
-    NativeChunkInputStream(ReadBuffer & istr_, const Block & header_);
+    /// When `deserialize_pool_` is given and the sender wrote per-column sizes,
+    /// wide chunks are decoded column-parallel on that pool.
+    NativeChunkInputStream(ReadBuffer & istr_, const Block & header_, ThreadPool * deserialize_pool_ = nullptr);
 
     static void readData(const IDataType & type, ColumnPtr & column, ReadBuffer & istr, size_t rows, double avg_value_size_hint);
 
+    /// Counterpart of NativeChunkOutputStream::writeDataMaybeSparse: reads the
+    /// per-column sparse prefix and restores a dense column of `rows` rows.
+    static void readDataMaybeSparse(const IDataType & type, ColumnPtr & column, ReadBuffer & istr, size_t rows, double avg_value_size_hint);
+
     Chunk readImpl();
 
 private:
+    /// Pulls the rest of the payload into contiguous memory and decodes the
+    /// column slices on the pool, balanced by bytes.
+    Columns readColumnsParallel(const std::vector<UInt64> & column_sizes, size_t row_num, bool sparse_columns);
+
     ReadBuffer & istr;
     Block header;
     PODArray<double> avg_value_size_hints;
+    ThreadPool * deserialize_pool;
 };
 
 }
@@ -18,7 +18,10 @@
 #include <Core/Block.h>
 #include <Core/ProtocolDefines.h>
 #include <DataTypes/DataTypeLowCardinality.h>
+#include <DataTypes/DataTypeNullable.h>
 #include <IO/VarInt.h>
+#include <IO/WriteBufferFromString.h>
+#include <IO/WriteHelpers.h>
 #include <Common/typeid_cast.h>
 
 namespace DB
@@ -30,12 +33,22 @@ namespace ErrorCodes
 
 
 NativeChunkOutputStream::NativeChunkOutputStream(
-    WriteBuffer & ostr_, UInt64 client_revision_, const Block & header_, bool remove_low_cardinality_)
-    : ostr(ostr_), client_revision(client_revision_), header(header_), remove_low_cardinality(remove_low_cardinality_)
+    WriteBuffer & ostr_,
+    UInt64 client_revision_,
+    const Block & header_,
+    bool remove_low_cardinality_,
+    bool enable_sparse_serialization_,
+    bool enable_column_sizes_)
+    : ostr(ostr_)
+    , client_revision(client_revision_)
+    , header(header_)
+    , remove_low_cardinality(remove_low_cardinality_)
+    , enable_sparse_serialization(enable_sparse_serialization_)
+    , enable_column_sizes(enable_column_sizes_)
 {
 }
 
-static void writeData(const IDataType & type, const ColumnPtr & column, WriteBuffer & ostr, UInt64 offset, UInt64 limit)
+void NativeChunkOutputStream::writeData(const IDataType & type, const ColumnPtr & column, WriteBuffer & ostr, UInt64 offset, UInt64 limit)
 {
     /** If there are columns-constants - then we materialize them.
       * (Since the data type does not know how to serialize / deserialize constants.)
@@ -55,21 +68,89 @@ static void writeData(const IDataType & type, const ColumnPtr & column, WriteBuf
     serialization->serializeBinaryBulkStateSuffix(settings, state);
 }
 
+namespace
+{
+    /// Sparse encoding only pays off with a sufficiently long run of rows.
+    constexpr size_t MIN_ROWS_FOR_SPARSE_SERIALIZATION = 64;
+
+    /// At most this share of rows may be non-default for a column to go sparse.
+    constexpr size_t SPARSE_SERIALIZATION_MAX_DENSITY_PERCENT = 10;
+
+    /// Restrict sparse detection to simple value types: their columns compare cheaply
+    /// against the default value and a default row actually means "no data" there.
+    bool typeCanBeSparseSerialized(const DataTypePtr & type)
+    {
+        WhichDataType which(removeNullable(type));
+        return which.isInt() || which.isUInt() || which.isFloat() || which.isDecimal() || which.isDateOrDateTime()
+            || which.isEnum() || which.isStringOrFixedString() || which.isUUID();
+    }
+}
+
+void NativeChunkOutputStream::writeDataMaybeSparse(const DataTypePtr & type, const ColumnPtr & column, WriteBuffer & ostr, size_t rows)
+{
+    ColumnPtr full_column = column->convertToFullColumnIfConst();
+
+    IColumn::Filter non_default_mask;
+    size_t non_default_rows = rows;
+    if (rows >= MIN_ROWS_FOR_SPARSE_SERIALIZATION && typeCanBeSparseSerialized(type))
+    {
+        auto default_column = full_column->cloneEmpty();
+        default_column->insertDefault();
+
+        non_default_mask.resize(rows);
+        non_default_rows = 0;
+        for (size_t i = 0; i < rows; ++i)
+        {
+            bool non_default = full_column->compareAt(i, 0, *default_column, 1) != 0;
+            non_default_mask[i] = non_default;
+            non_default_rows += non_default;
+        }
+    }
+
+    if (non_default_rows * 100 > rows * SPARSE_SERIALIZATION_MAX_DENSITY_PERCENT)
+    {
+        writeBinary(false, ostr);
+        writeData(*type, full_column, ostr, 0, 0);
+        return;
+    }
+
+    writeBinary(true, ostr);
+    writeVarUInt(non_default_rows, ostr);
+
+    /// Delta-encoded row numbers of the non-default values, then the values themselves.
+    size_t prev_row = 0;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (non_default_mask[i])
+        {
+            writeVarUInt(i - prev_row, ostr);
+            prev_row = i;
+        }
+    }
+
+    if (non_default_rows)
+        writeData(*type, full_column->filter(non_default_mask, non_default_rows), ostr, 0, 0);
+}
 
 void NativeChunkOutputStream::write(const Chunk & chunk)
 {
-    /// chunk info
+    /// chunk info and format flags
     auto chunk_info = chunk.getChunkInfo();
+    UInt8 chunk_flags = 0;
+    if (chunk_info)
+        chunk_flags |= HAS_CHUNK_INFO;
+    if (enable_sparse_serialization)
+        chunk_flags |= SPARSE_COLUMNS;
+    bool write_column_sizes = enable_column_sizes && chunk.getNumRows() && chunk.getNumColumns();
+    if (write_column_sizes)
+        chunk_flags |= COLUMN_SIZES;
+
+    writeVarUInt(chunk_flags, ostr);
     if (chunk_info)
     {
-        writeVarUInt(1, ostr);
         writeVarUInt(static_cast<UInt8>(chunk_info->getType()), ostr);
         chunk_info->write(ostr);
     }
-    else
-    {
-        writeVarUInt(0, ostr);
-    }
     /// Dimensions
     size_t columns = chunk.getNumColumns();
     size_t rows = chunk.getNumRows();
@@ -77,21 +158,60 @@ void NativeChunkOutputStream::write(const Chunk & chunk)
     writeVarUInt(columns, ostr);
     writeVarUInt(rows, ostr);
 
-    for (size_t i = 0; i < columns; ++i)
+    auto prepare_column = [&](size_t i, DataTypePtr & data_type, ColumnPtr & column_ptr)
     {
-        DataTypePtr data_type = header.getDataTypes().at(i);
-        ColumnPtr column_ptr = chunk.getColumns()[i];
+        data_type = header.getDataTypes().at(i);
+        column_ptr = chunk.getColumns()[i];
         /// Send data to old clients without low cardinality type.
         if (remove_low_cardinality || (client_revision && client_revision < DBMS_MIN_REVISION_WITH_LOW_CARDINALITY_TYPE))
         {
             column_ptr = recursiveRemoveLowCardinality(column_ptr);
             data_type = recursiveRemoveLowCardinality(data_type);
         }
+    };
+
+    if (write_column_sizes)
+    {
+        /// The sizes must precede the data, so serialize each column into its own
+        /// buffer first; the extra copy of the payload is what buys the receiver
+        /// the ability to decode columns in parallel.
+        std::vector<String> column_payloads(columns);
+        for (size_t i = 0; i < columns; ++i)
+        {
+            DataTypePtr data_type;
+            ColumnPtr column_ptr;
+            prepare_column(i, data_type, column_ptr);
+
+            WriteBufferFromOwnString column_out;
+            if (enable_sparse_serialization)
+                writeDataMaybeSparse(data_type, column_ptr, column_out, rows);
+            else
+                writeData(*data_type, column_ptr, column_out, 0, 0);
+            column_payloads[i] = std::move(column_out.str());
+        }
+
+        for (const auto & payload : column_payloads)
+            writeVarUInt(payload.size(), ostr);
+        for (const auto & payload : column_payloads)
+            ostr.write(payload.data(), payload.size());
+        return;
+    }
+
+    for (size_t i = 0; i < columns; ++i)
+    {
+        DataTypePtr data_type;
+        ColumnPtr column_ptr;
+        prepare_column(i, data_type, column_ptr);
 
         /// Name/Type, we don't need write name/type here.
         /// Data
         if (rows) /// Zero items of data is always represented as zero number of bytes.
-            writeData(*data_type, column_ptr, ostr, 0, 0);
+        {
+            if (enable_sparse_serialization)
+                writeDataMaybeSparse(data_type, column_ptr, ostr, rows);
+            else
+                writeData(*data_type, column_ptr, ostr, 0, 0);
+        }
     }
 }
 }
@@ -31,15 +31,43 @@ class CompressedWriteBuffer;
 class NativeChunkOutputStream
 {
 public:
-    NativeChunkOutputStream(WriteBuffer & ostr_, UInt64 client_revision_, const Block & header_, bool remove_low_cardinality_ = false);
+    /// Flag bits of the leading varuint of a serialized chunk. Legacy chunks carry
+    /// plain 0/1 there, so the low bit keeps its old meaning.
+    enum ChunkFlags : UInt8
+    {
+        HAS_CHUNK_INFO = 1,
+        /// Every column is prefixed with one byte telling whether it is sparse-encoded.
+        SPARSE_COLUMNS = 2,
+        /// The dimensions are followed by one varint per column giving the byte size
+        /// of its serialized data, so receivers can decode columns in parallel.
+        COLUMN_SIZES = 4,
+    };
+
+    NativeChunkOutputStream(
+        WriteBuffer & ostr_,
+        UInt64 client_revision_,
+        const Block & header_,
+        bool remove_low_cardinality_ = false,
+        bool enable_sparse_serialization_ = false,
+        bool enable_column_sizes_ = false);
 
     void write(const Chunk & chunk);
 
+    /// Serialize one column in native format, also used by callers which interleave
+    /// serialized headers with zero-copy payload slices
+    static void writeData(const IDataType & type, const ColumnPtr & column, WriteBuffer & ostr, UInt64 offset, UInt64 limit);
+
+    /// Write the per-column sparse prefix and either the dense payload or the
+    /// delta-encoded row numbers of non-default values followed by those values.
+    static void writeDataMaybeSparse(const DataTypePtr & type, const ColumnPtr & column, WriteBuffer & ostr, size_t rows);
+
 private:
     WriteBuffer & ostr;
     UInt64 client_revision;
     Block header;
     bool remove_low_cardinality;
+    bool enable_sparse_serialization;
+    bool enable_column_sizes;
 };
 
 }
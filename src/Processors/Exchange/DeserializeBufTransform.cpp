@@ -29,12 +29,14 @@
 
 namespace DB
 {
-DeserializeBufTransform::DeserializeBufTransform(const Block & header_, bool enable_block_compress_)
+DeserializeBufTransform::DeserializeBufTransform(const Block & header_, bool enable_block_compress_, size_t parallel_deserialize_threads_)
     : ISimpleTransform(Block(), header_, true)
     , header(getOutputPort().getHeader())
     , enable_block_compress(enable_block_compress_)
     , logger(&Poco::Logger::get("DeserializeBufTransform"))
 {
+    if (parallel_deserialize_threads_ > 1)
+        deserialize_pool = std::make_unique<ThreadPool>(parallel_deserialize_threads_);
 }
 
 void DeserializeBufTransform::transform(Chunk & chunk)
@@ -53,7 +55,7 @@ void DeserializeBufTransform::transform(Chunk & chunk)
         buf = std::make_unique<CompressedReadBuffer>(*read_buffer);
     else
         buf = std::move(read_buffer);
-    NativeChunkInputStream chunk_in(*buf, header);
+    NativeChunkInputStream chunk_in(*buf, header, deserialize_pool.get());
     chunk = chunk_in.readImpl();
 }
 
@@ -17,6 +17,7 @@
 #include <Processors/Chunk.h>
 #include <butil/iobuf.h>
 #include <Processors/ISimpleTransform.h>
+#include <Common/ThreadPool.h>
 
 namespace DB
 {
@@ -29,7 +30,7 @@ public:
         butil::IOBuf io_buf;
     };
 
-    explicit DeserializeBufTransform(const Block & header_, bool enable_block_compress_);
+    explicit DeserializeBufTransform(const Block & header_, bool enable_block_compress_, size_t parallel_deserialize_threads_ = 0);
 
     String getName() const override { return "DeserializeBufTransform"; }
 
@@ -39,6 +40,9 @@ protected:
 private:
     const Block & header;
     bool enable_block_compress;
+    /// Decodes columns of wide chunks in parallel when the sender wrote
+    /// per-column sizes; null when parallel deserialization is off.
+    std::unique_ptr<ThreadPool> deserialize_pool;
     Poco::Logger * logger;
 
 };
@@ -28,12 +28,13 @@
 namespace DB
 {
 ExchangeBufferedSender::ExchangeBufferedSender(
-    const Block & header_, BroadcastSenderPtr sender_, UInt64 threshold_in_bytes_, UInt64 threshold_in_row_num_)
+    const Block & header_, BroadcastSenderPtr sender_, UInt64 threshold_in_bytes_, UInt64 threshold_in_row_num_, UInt64 flush_interval_ms_)
     : header(header_)
     , column_num(header_.getColumns().size())
     , sender(sender_)
     , threshold_in_bytes(threshold_in_bytes_)
     , threshold_in_row_num(threshold_in_row_num_)
+    , flush_interval_ms(flush_interval_ms_)
     , logger(&Poco::Logger::get("ExchangeBufferedSender"))
 {
     resetBuffer();
@@ -48,7 +49,8 @@ BroadcastStatus ExchangeBufferedSender::flush(bool force)
 
     if (!force)
     {
-        if (bufferBytes() < threshold_in_bytes && rows < threshold_in_row_num)
+        bool interval_expired = flush_interval_ms && buffer_age.elapsedMilliseconds() >= flush_interval_ms;
+        if (bufferBytes() < threshold_in_bytes && rows < threshold_in_row_num && !interval_expired)
             return BroadcastStatus(BroadcastStatusCode::RUNNING);
     }
 
@@ -87,9 +89,16 @@ void ExchangeBufferedSender::resetBuffer()
 void ExchangeBufferedSender::appendSelective(
     size_t column_idx, const IColumn & source, const IColumn::Selector & selector, size_t from, size_t length)
 {
+    if (column_idx == 0 && partition_buffer[0]->empty())
+        buffer_age.restart();
     partition_buffer[column_idx]->insertRangeSelective(source, selector, from, length);
 }
 
+size_t ExchangeBufferedSender::getBufferBytes() const
+{
+    return bufferBytes();
+}
+
 size_t ExchangeBufferedSender::bufferBytes() const
 {
     size_t total = 0;
@@ -20,6 +20,7 @@
 #include <Core/Block.h>
 #include <Processors/Chunk.h>
 #include <Processors/Exchange/DataTrans/DataTrans_fwd.h>
+#include <Common/Stopwatch.h>
 #include <Poco/Logger.h>
 
 
@@ -28,12 +29,18 @@ namespace DB
 class ExchangeBufferedSender
 {
 public:
-    ExchangeBufferedSender(const Block & header, BroadcastSenderPtr sender_, UInt64 threshold_in_bytes, UInt64 threshold_in_row_num);
+    ExchangeBufferedSender(
+        const Block & header,
+        BroadcastSenderPtr sender_,
+        UInt64 threshold_in_bytes,
+        UInt64 threshold_in_row_num,
+        UInt64 flush_interval_ms_ = 0);
     void appendSelective(size_t column_idx, const IColumn & source, const IColumn::Selector & selector, size_t from, size_t length);
     BroadcastStatus sendThrough(Chunk chunk);
     BroadcastStatus flush(bool force);
     bool compareBufferChunkInfo(const ChunkInfoPtr & chunk_info) const;
     void updateBufferChunkInfo(ChunkInfoPtr chunk_info);
+    size_t getBufferBytes() const;
 
 private:
     const Block & header;
@@ -41,6 +48,10 @@ private:
     BroadcastSenderPtr sender;
     UInt64 threshold_in_bytes;
     UInt64 threshold_in_row_num;
+    /// Latency cap for coalescing, 0 - flush on size thresholds only
+    UInt64 flush_interval_ms;
+    /// Age of the oldest buffered row, restarted when the empty buffer gets data
+    Stopwatch buffer_age;
     MutableColumns partition_buffer;
     ChunkInfoPtr current_chunk_info;
     Poco::Logger * logger;
@@ -23,6 +23,12 @@ struct ExchangeOptions
     UInt32 exhcange_timeout_ms;
     UInt64 send_threshold_in_bytes;
     UInt64 send_threshold_in_row_num;
+    /// The longest time a buffered chunk may wait in a send buffer before it is
+    /// flushed regardless of the size thresholds, 0 - no latency cap
+    UInt64 send_flush_interval_ms = 0;
+    /// Upper bound of bytes buffered across all partitions of one repartition sink,
+    /// 0 - unlimited. When exceeded the largest partition buffers are flushed early
+    UInt64 buffer_total_bytes_limit = 0;
     bool force_remote_mode = false;
     bool need_send_plan_segment_status = true;
     bool force_use_buffer = false;
@@ -26,8 +26,15 @@
 #include <Common/CurrentMemoryTracker.h>
 #include <Common/Exception.h>
 #include <Common/MemoryTracker.h>
+#include <Common/ProfileEvents.h>
 #include <common/types.h>
 
+namespace ProfileEvents
+{
+    extern const Event ExchangeSendChunks;
+    extern const Event ExchangeSendBytes;
+}
+
 namespace DB
 {
 namespace ErrorCodes
@@ -53,12 +60,16 @@ public:
             .exhcange_timeout_ms = static_cast<UInt32>(settings.exchange_timeout_ms),
             .send_threshold_in_bytes = settings.exchange_buffer_send_threshold_in_bytes,
             .send_threshold_in_row_num = settings.exchange_buffer_send_threshold_in_row,
+            .send_flush_interval_ms = settings.exchange_buffer_send_threshold_in_ms,
+            .buffer_total_bytes_limit = settings.exchange_buffer_total_bytes_limit,
             .force_remote_mode = settings.exchange_enable_force_remote_mode,
             .force_use_buffer = settings.exchange_force_use_buffer};
     }
 
     static inline BroadcastStatus sendAndCheckReturnStatus(IBroadcastSender & sender, Chunk chunk)
     {
+        ProfileEvents::increment(ProfileEvents::ExchangeSendChunks);
+        ProfileEvents::increment(ProfileEvents::ExchangeSendBytes, chunk.bytes());
         BroadcastStatus status = sender.send(std::move(chunk));
         if (status.is_modifer && status.code > 0)
         {
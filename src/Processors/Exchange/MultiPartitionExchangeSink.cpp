@@ -47,7 +47,8 @@ MultiPartitionExchangeSink::MultiPartitionExchangeSink(
 {
     for(size_t i = 0; i < partition_num; ++i)
     {
-        ExchangeBufferedSender buffered_sender (header, partition_senders[i], options.send_threshold_in_bytes, options.send_threshold_in_row_num);
+        ExchangeBufferedSender buffered_sender (
+            header, partition_senders[i], options.send_threshold_in_bytes, options.send_threshold_in_row_num, options.send_flush_interval_ms);
         buffered_senders.emplace_back(std::move(buffered_sender));
     }
 }
@@ -110,6 +111,31 @@ void MultiPartitionExchangeSink::consume(Chunk chunk)
         if (status.code == BroadcastStatusCode::RUNNING)
             has_active_sender = true;
     }
+
+    /// With many partitions the per partition thresholds alone can add up to more
+    /// memory than a worker can afford; flush the largest buffers early until the
+    /// sink fits the total limit again, trading smaller sends for bounded memory
+    if (options.buffer_total_bytes_limit)
+    {
+        size_t total_buffered = 0;
+        for (size_t i = 0; i < partition_num; ++i)
+            total_buffered += buffered_senders[i].getBufferBytes();
+
+        while (total_buffered > options.buffer_total_bytes_limit)
+        {
+            size_t largest = 0;
+            for (size_t i = 1; i < partition_num; ++i)
+                if (buffered_senders[i].getBufferBytes() > buffered_senders[largest].getBufferBytes())
+                    largest = i;
+
+            size_t largest_bytes = buffered_senders[largest].getBufferBytes();
+            if (largest_bytes == 0)
+                break;
+            buffered_senders[largest].flush(true);
+            total_buffered -= largest_bytes;
+        }
+    }
+
     if (!has_active_sender)
         finish();
 }
@@ -15,9 +15,11 @@
 
 #include <memory>
 #include <utility>
+#include <Columns/ColumnLowCardinality.h>
 #include <Columns/ColumnsNumber.h>
 #include <Columns/FilterDescription.h>
 #include <Columns/IColumn.h>
+#include <DataTypes/DataTypeLowCardinality.h>
 #include <DataTypes/DataTypesNumber.h>
 #include <Functions/FunctionFactory.h>
 #include <Interpreters/Context_fwd.h>
@@ -63,33 +65,64 @@ std::pair<IColumn::Selector, RepartitionTransform::PartitionStartPoints> Reparti
     auto selector_column = ColumnUInt64::create(input_rows_count);
     const Columns & columns = chunk.getColumns();
 
-
-    ColumnsWithTypeAndName arguments;
-    arguments.reserve(repartition_keys.size());
-    for (size_t key_idx : repartition_keys)
-    {
-        const auto & type_and_name = header.getByPosition(key_idx);
-        arguments.emplace_back(ColumnWithTypeAndName(columns[key_idx], type_and_name.type, type_and_name.name));
-    }
-
-    ColumnPtr hash_result = repartition_func->execute(arguments, result_type, input_rows_count, false);
-
     PartitionStartPoints partition_row_idx_start_points(partition_num + 1, 0);
 
     IColumn::Selector repartition_selector(input_rows_count, 0);
     PODArrayWithStackMemory<UInt32, 32> partition_index(input_rows_count, 0);
 
-    for (size_t i = 0; i < input_rows_count; ++i)
+    /// With a single LowCardinality key the hash function would materialize the
+    /// full strings (the declared UInt64 result type disables the dictionary
+    /// shortcut of IFunction), so hash the dictionary once and fan the partition
+    /// out by codes: the work becomes per distinct value instead of per row.
+    const ColumnLowCardinality * low_cardinality_key = nullptr;
+    const DataTypeLowCardinality * low_cardinality_type = nullptr;
+    if (repartition_keys.size() == 1)
     {
-        partition_index[i] = hash_result->get64(i) % partition_num;
+        low_cardinality_key = typeid_cast<const ColumnLowCardinality *>(columns[repartition_keys[0]].get());
+        low_cardinality_type = typeid_cast<const DataTypeLowCardinality *>(header.getByPosition(repartition_keys[0]).type.get());
     }
 
-    if (hash_result->isNullable())
+    if (low_cardinality_key && low_cardinality_type && !low_cardinality_key->nestedIsNullable())
     {
+        ColumnPtr dictionary_column = low_cardinality_key->getDictionary().getNestedColumn();
+        size_t dictionary_size = dictionary_column->size();
+
+        ColumnsWithTypeAndName dictionary_arguments{ColumnWithTypeAndName(
+            dictionary_column, low_cardinality_type->getDictionaryType(), header.getByPosition(repartition_keys[0]).name)};
+        ColumnPtr dictionary_hash = repartition_func->execute(dictionary_arguments, result_type, dictionary_size, false);
+
+        PODArrayWithStackMemory<UInt32, 32> dictionary_partition(dictionary_size, 0);
+        for (size_t i = 0; i < dictionary_size; ++i)
+            dictionary_partition[i] = dictionary_hash->get64(i) % partition_num;
+
+        const auto & indexes = low_cardinality_key->getIndexes();
         for (size_t i = 0; i < input_rows_count; ++i)
+            partition_index[i] = dictionary_partition[indexes.getUInt(i)];
+    }
+    else
+    {
+        ColumnsWithTypeAndName arguments;
+        arguments.reserve(repartition_keys.size());
+        for (size_t key_idx : repartition_keys)
+        {
+            const auto & type_and_name = header.getByPosition(key_idx);
+            arguments.emplace_back(ColumnWithTypeAndName(columns[key_idx], type_and_name.type, type_and_name.name));
+        }
+
+        ColumnPtr hash_result = repartition_func->execute(arguments, result_type, input_rows_count, false);
+
+        for (size_t i = 0; i < input_rows_count; ++i)
+        {
+            partition_index[i] = hash_result->get64(i) % partition_num;
+        }
+
+        if (hash_result->isNullable())
         {
-            if (hash_result->isNullAt(i))
-                partition_index[i] = 0;
+            for (size_t i = 0; i < input_rows_count; ++i)
+            {
+                if (hash_result->isNullAt(i))
+                    partition_index[i] = 0;
+            }
         }
     }
 
@@ -19,14 +19,17 @@
  * All Bytedance's Modifications are Copyright (2023) Bytedance Ltd. and/or its affiliates.
  */
 
+#include <optional>
 #include <queue>
 #include <IO/WriteBufferFromString.h>
 #include <IO/WriteBufferFromFile.h>
 #include <Processors/printPipeline.h>
 #include <Common/EventCounter.h>
+#include <Common/CurrentMetrics.h>
 #include <Common/CurrentThread.h>
 #include <Common/setThreadName.h>
 #include <Common/MemoryTracker.h>
+#include <Common/NumaTopology.h>
 #include <Processors/Executors/PipelineExecutor.h>
 #include <Processors/printPipeline.h>
 #include <Processors/ISource.h>
@@ -39,6 +42,15 @@
     #include <Common/Stopwatch.h>
 #endif
 
+#if defined(OS_LINUX)
+    #include <sched.h>
+#endif
+
+namespace CurrentMetrics
+{
+    extern const Metric QueryThread;
+}
+
 namespace DB
 {
 
@@ -50,6 +62,36 @@ namespace ErrorCodes
     extern const int QUERY_WAS_CANCELLED;
 }
 
+#if defined(OS_LINUX)
+/// Binds the current thread to the given cpus and returns its previous affinity
+/// mask, so the caller can restore it. Pipeline workers come from the global
+/// thread pool and are reused by unrelated tasks afterwards; leaving the thread
+/// pinned would constrain everything scheduled onto it later.
+static std::optional<cpu_set_t> bindThreadToCpus(const std::vector<size_t> & cpus, Poco::Logger * log)
+{
+    cpu_set_t prev_cpu_set;
+    CPU_ZERO(&prev_cpu_set);
+    if (sched_getaffinity(0, sizeof(prev_cpu_set), &prev_cpu_set) != 0)
+    {
+        LOG_WARNING(log, "Cannot get thread affinity mask, errno: {}", errno);
+        return {};
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (size_t cpu : cpus)
+        CPU_SET(cpu, &cpu_set);
+
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0)
+    {
+        LOG_WARNING(log, "Cannot bind thread to NUMA node cpus, errno: {}", errno);
+        return {};
+    }
+
+    return prev_cpu_set;
+}
+#endif
+
 static bool checkCanAddAdditionalInfoToException(const DB::Exception & exception)
 {
     /// Don't add additional info to limits and quota exceptions, and in case of kill query (to pass tests).
@@ -793,6 +835,19 @@ void PipelineExecutor::initializeExecution(size_t num_threads)
     threads_queue.init(num_threads);
     task_queue.init(num_threads);
 
+    if (num_threads > 1 && process_list_element && process_list_element->getContext()
+        && process_list_element->getContext()->getSettingsRef().enable_numa_aware_execution)
+    {
+        numa_node_cpus = getNumaNodeCpus();
+        if (!numa_node_cpus.empty())
+        {
+            thread_numa_nodes.resize(num_threads);
+            for (size_t i = 0; i < num_threads; ++i)
+                thread_numa_nodes[i] = i % numa_node_cpus.size();
+            task_queue.setThreadGroups(thread_numa_nodes);
+        }
+    }
+
     {
         std::lock_guard guard(executor_contexts_mutex);
 
@@ -870,9 +925,28 @@ void PipelineExecutor::executeImpl(size_t num_threads)
 
                 setThreadName("QueryPipelineEx");
 
+#if defined(OS_LINUX)
+                /// Bind the thread to the cpus of its NUMA node. Memory the thread
+                /// allocates for chunks then lands on the same node via first touch.
+                /// The original mask is restored on exit: the thread returns to the
+                /// global pool when the query finishes.
+                std::optional<cpu_set_t> prev_cpu_set;
+                if (!thread_numa_nodes.empty())
+                    prev_cpu_set = bindThreadToCpus(numa_node_cpus[thread_numa_nodes[thread_num]], log);
+
+                SCOPE_EXIT_SAFE(
+                    if (prev_cpu_set && sched_setaffinity(0, sizeof(*prev_cpu_set), &*prev_cpu_set) != 0)
+                        LOG_WARNING(log, "Cannot restore thread affinity mask, errno: {}", errno);
+                );
+#endif
+
                 if (thread_group)
                     CurrentThread::attachTo(thread_group);
 
+                /// Keep the live pipeline-thread count accurate: it is what
+                /// load-adaptive parallelism on workers sizes new segments against.
+                CurrentMetrics::Increment query_thread_metric_increment{CurrentMetrics::QueryThread};
+
                 SCOPE_EXIT_SAFE(
                     if (thread_group)
                         CurrentThread::detachQueryIfNotDetached();
@@ -916,7 +990,10 @@ void PipelineExecutor::executeImpl(size_t num_threads)
                 thread.join();
     }
     else
+    {
+        CurrentMetrics::Increment query_thread_metric_increment{CurrentMetrics::QueryThread};
         executeSingleThread(0, num_threads);
+    }
 
     finished_flag = true;
 }
@@ -100,6 +100,12 @@ private:
     ThreadsQueue threads_queue;
     std::mutex task_queue_mutex;
 
+    /// CPU ids of every NUMA node and the node every worker thread is bound to.
+    /// Filled only when NUMA aware execution is enabled and the machine
+    /// actually has more than one node; empty otherwise.
+    std::vector<std::vector<size_t>> numa_node_cpus;
+    std::vector<size_t> thread_numa_nodes;
+
     /// Flag that checks that initializeExecution was called.
     bool is_execution_initialized = false;
     std::atomic_bool cancelled;
@@ -15,6 +15,11 @@ class TaskQueue
 public:
     void init(size_t num_threads) { queues.resize(num_threads); }
 
+    /// Partition threads into groups (e.g. by the NUMA node they are bound to).
+    /// A thread then steals tasks from its own group first and crosses group
+    /// boundaries only when every queue of its group is empty.
+    void setThreadGroups(std::vector<size_t> groups_) { groups = std::move(groups_); }
+
     void push(Task * task, size_t thread_num)
     {
         queues[thread_num].push(task);
@@ -26,6 +31,21 @@ public:
         if (num_tasks == 0)
             throw Exception("TaskQueue is empty.", ErrorCodes::LOGICAL_ERROR);
 
+        if (!groups.empty())
+        {
+            size_t group = groups[from_thread];
+            size_t thread = from_thread;
+            for (size_t i = 0; i < queues.size(); ++i)
+            {
+                if (groups[thread] == group && !queues[thread].empty())
+                    return thread;
+
+                ++thread;
+                if (thread >= queues.size())
+                    thread = 0;
+            }
+        }
+
         for (size_t i = 0; i < queues.size(); ++i)
         {
             if (!queues[from_thread].empty())
@@ -56,6 +76,8 @@ public:
 private:
     using Queue = std::queue<Task *>;
     std::vector<Queue> queues;
+    /// Group of every thread; empty if stealing should not prefer any threads.
+    std::vector<size_t> groups;
     size_t num_tasks = 0;
 };
 
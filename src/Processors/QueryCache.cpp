@@ -14,6 +14,7 @@
  */
 
 #include <Processors/QueryCache.h>
+#include <Core/NamesAndTypes.h>
 #include <thread>
 
 namespace DB
@@ -24,4 +25,32 @@ namespace ErrorCodes
     extern const int LOGICAL_ERROR;
 }
 
+bool isResultNeutralQuerySetting(const String & name)
+{
+    /// Execution tuning knobs: they change how a query runs, not what it returns.
+    static const NameSet result_neutral_settings
+    {
+        "max_threads",
+        "max_block_size",
+        "preferred_block_size_bytes",
+        "max_memory_usage",
+        "max_memory_usage_for_user",
+        "max_bytes_before_external_group_by",
+        "max_bytes_before_external_sort",
+        "max_bytes_before_remerge_sort",
+        "min_bytes_to_use_direct_io",
+        "min_bytes_to_use_mmap_io",
+        "use_uncompressed_cache",
+        "distributed_aggregation_memory_efficient",
+        "log_queries",
+        "log_profile_events",
+        "log_query_settings",
+        "send_logs_level",
+        "priority",
+        "enable_query_cache",
+    };
+
+    return result_neutral_settings.count(name) != 0;
+}
+
 }
@@ -24,6 +24,8 @@
 #include <Core/Settings.h>
 #include <Core/QueryProcessingStage.h>
 #include <IO/WriteBufferFromString.h>
+#include <IO/WriteHelpers.h>
+#include <mutex>
 #include <queue>
 
 
@@ -36,23 +38,43 @@ namespace ProfileEvents
 namespace DB
 {
 
+/// Settings that tune execution (threads, memory, spilling, logging) without
+/// affecting the query result do not participate in the cache key.
+bool isResultNeutralQuerySetting(const String & name);
+
 struct QueryKey
 {
     const String query;
     String settings_string;
     String stage;
-
-    QueryKey(const String & query_, const Settings & settings_, const QueryProcessingStage::Enum & stage_)
-        : query(query_)
+    String current_database;
+
+    QueryKey(
+        const String & query_,
+        const Settings & settings_,
+        const QueryProcessingStage::Enum & stage_,
+        const String & current_database_ = "")
+        : query(query_), current_database(current_database_)
     {
+        /// Only settings changed from their defaults participate in the key,
+        /// and result-neutral ones are skipped: otherwise running the same
+        /// query with, say, a different max_threads needlessly misses the cache.
         WriteBufferFromString buffer(settings_string);
-        settings_.write(buffer);
+        for (const auto & setting : settings_.allChanged())
+        {
+            if (isResultNeutralQuerySetting(setting.getName()))
+                continue;
+            writeString(setting.getName(), buffer);
+            writeChar('=', buffer);
+            writeString(setting.getValueString(), buffer);
+            writeChar(';', buffer);
+        }
         stage = QueryProcessingStage::toString(stage_);
     }
 
     String toString()
     {
-        return query+" : "+settings_string+ " : "+stage;
+        return query+" : "+settings_string+ " : "+stage+" : "+current_database;
     }
 };
 
@@ -74,6 +96,8 @@ struct QueryResult
 
     void addResult(Chunk & chunk)
     {
+        /// One collecting transform per output stream may share this result.
+        std::lock_guard lock(mutex);
         bytes += chunk.bytes();
         auto chunk_ptr = std::make_shared<Chunk>(chunk.clone());
         result.push(chunk_ptr);
@@ -98,6 +122,9 @@ struct QueryResult
         res->bytes = bytes;
         return res;
     }
+
+private:
+    std::mutex mutex;
 };
 
 using QueryKeyPtr = std::shared_ptr<QueryKey>;
@@ -137,6 +164,7 @@ public:
         hash.update(query_key.query.data(), query_key.query.size());
         hash.update(query_key.settings_string.data(), query_key.settings_string.size());
         hash.update(query_key.stage.data(), query_key.stage.size());
+        hash.update(query_key.current_database.data(), query_key.current_database.size());
         hash.get128(key);
 
         return key;
@@ -292,7 +292,9 @@ std::unique_ptr<QueryPipeline> QueryPipeline::joinPipelines(
     JoinPtr join,
     size_t max_block_size,
     bool join_parallel_left_right,
-    Processors * collected_processors)
+    Processors * collected_processors,
+    SharedJoinBuildStatePtr shared_join_build,
+    bool is_join_builder)
 {
     left->checkInitializedAndNotCompleted();
     right->checkInitializedAndNotCompleted();
@@ -325,7 +327,8 @@ std::unique_ptr<QueryPipeline> QueryPipeline::joinPipelines(
     size_t num_streams = left->getNumStreams();
     right->resize(1);
 
-    auto adding_joined = std::make_shared<FillingRightJoinSideTransform>(right->getHeader(), join);
+    auto adding_joined = std::make_shared<FillingRightJoinSideTransform>(
+        right->getHeader(), join, std::move(shared_join_build), is_join_builder);
     InputPort * totals_port = nullptr;
     if (right->hasTotals())
         totals_port = adding_joined->addTotalsPort();
@@ -51,6 +51,9 @@ struct ExpressionActionsSettings;
 class IJoin;
 using JoinPtr = std::shared_ptr<IJoin>;
 
+class SharedJoinBuildState;
+using SharedJoinBuildStatePtr = std::shared_ptr<SharedJoinBuildState>;
+
 using RuntimeFilterId = UInt64;
 
 class QueryPipeline
@@ -119,13 +122,17 @@ public:
 
     /// Join two pipelines together using JoinPtr.
     /// If collector is used, it will collect only newly-added processors, but not processors from pipelines.
+    /// If shared_join_build is set, the build table is shared between several local pipelines:
+    /// only the builder fills it, the others drain their build input and wait for the builder.
     static std::unique_ptr<QueryPipeline> joinPipelines(
         std::unique_ptr<QueryPipeline> left,
         std::unique_ptr<QueryPipeline> right,
         JoinPtr join,
         size_t max_block_size,
         bool join_parallel_left_right,
-        Processors * collected_processors = nullptr);
+        Processors * collected_processors = nullptr,
+        SharedJoinBuildStatePtr shared_join_build = nullptr,
+        bool is_join_builder = true);
 
     /// Add other pipeline and execute it before current one.
     /// Pipeline must have empty header, it should not generate any chunk.
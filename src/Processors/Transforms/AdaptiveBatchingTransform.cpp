@@ -0,0 +1,119 @@
+#include <Processors/Transforms/AdaptiveBatchingTransform.h>
+
+namespace DB
+{
+
+AdaptiveBatchingTransform::AdaptiveBatchingTransform(const Block & header, size_t min_batch_rows_, size_t max_batch_bytes_)
+    : IProcessor({header}, {header})
+    , input(inputs.front())
+    , output(outputs.front())
+    , min_batch_rows(min_batch_rows_)
+    , max_batch_bytes(max_batch_bytes_)
+{
+}
+
+IProcessor::Status AdaptiveBatchingTransform::prepare()
+{
+    if (output.isFinished())
+    {
+        input.close();
+        return Status::Finished;
+    }
+
+    if (!output.canPush())
+    {
+        input.setNotNeeded();
+        return Status::PortFull;
+    }
+
+    if (!ready_chunks.empty())
+    {
+        output.push(std::move(ready_chunks.front()));
+        ready_chunks.pop_front();
+        return Status::PortFull;
+    }
+
+    if (has_input || flush_requested)
+        return Status::Ready;
+
+    if (input.isFinished())
+    {
+        if (accumulated_rows)
+        {
+            /// Flush the tail batch before finishing.
+            flush_requested = true;
+            return Status::Ready;
+        }
+
+        output.finish();
+        return Status::Finished;
+    }
+
+    input.setNeeded();
+    if (!input.hasData())
+        return Status::NeedData;
+
+    current_chunk = input.pull(true);
+    has_input = true;
+    return Status::Ready;
+}
+
+void AdaptiveBatchingTransform::work()
+{
+    if (has_input)
+    {
+        has_input = false;
+        consume(std::move(current_chunk));
+    }
+    else if (flush_requested)
+    {
+        flush_requested = false;
+        flushAccumulated();
+    }
+}
+
+void AdaptiveBatchingTransform::consume(Chunk chunk)
+{
+    const size_t rows = chunk.getNumRows();
+    const size_t bytes = chunk.bytes();
+
+    /// Chunk info (e.g. aggregation bucket numbers) applies to the chunk as a
+    /// whole and cannot be merged; large chunks are already well-batched.
+    if (chunk.getChunkInfo() || rows >= min_batch_rows || (max_batch_bytes && bytes >= max_batch_bytes))
+    {
+        if (accumulated_rows)
+            flushAccumulated();
+        ready_chunks.push_back(std::move(chunk));
+        return;
+    }
+
+    if (accumulated_columns.empty())
+    {
+        accumulated_columns = chunk.mutateColumns();
+    }
+    else
+    {
+        auto columns = chunk.detachColumns();
+        for (size_t i = 0; i < accumulated_columns.size(); ++i)
+            accumulated_columns[i]->insertRangeFrom(*columns[i], 0, rows);
+    }
+
+    accumulated_rows += rows;
+    accumulated_bytes += bytes;
+
+    if (accumulated_rows >= min_batch_rows || (max_batch_bytes && accumulated_bytes >= max_batch_bytes))
+        flushAccumulated();
+}
+
+void AdaptiveBatchingTransform::flushAccumulated()
+{
+    if (!accumulated_rows)
+        return;
+
+    ready_chunks.emplace_back(std::move(accumulated_columns), accumulated_rows);
+    accumulated_columns.clear();
+    accumulated_rows = 0;
+    accumulated_bytes = 0;
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Processors/IProcessor.h>
+
+#include <deque>
+
+namespace DB
+{
+
+/** Re-batches the chunk stream to keep per-chunk processing cost in a sane range.
+  *
+  * A selective filter can shrink blocks to a handful of rows, after which every
+  * downstream stage pays its per-block overhead (virtual calls, column
+  * bookkeeping, prefetch warmup) for almost no data. This transform accumulates
+  * such small chunks into batches of roughly the requested size before passing
+  * them on. Chunks that are already large enough - or carry chunk info, which
+  * must not be merged - are passed through unchanged, so well-formed streams pay
+  * almost nothing.
+  *
+  * Used after FilterTransform when enable_adaptive_pipeline_batching is set.
+  */
+class AdaptiveBatchingTransform : public IProcessor
+{
+public:
+    /// Chunks with at least `min_batch_rows` rows (or `max_batch_bytes` bytes,
+    /// if non-zero) are passed through; smaller ones are merged up to that size.
+    AdaptiveBatchingTransform(const Block & header, size_t min_batch_rows_, size_t max_batch_bytes_);
+
+    String getName() const override { return "AdaptiveBatchingTransform"; }
+
+    Status prepare() override;
+    void work() override;
+
+private:
+    InputPort & input;
+    OutputPort & output;
+
+    Chunk current_chunk;
+    bool has_input = false;
+    bool flush_requested = false;
+
+    std::deque<Chunk> ready_chunks;
+
+    MutableColumns accumulated_columns;
+    size_t accumulated_rows = 0;
+    size_t accumulated_bytes = 0;
+
+    const size_t min_batch_rows;
+    const size_t max_batch_bytes;
+
+    void consume(Chunk chunk);
+    void flushAccumulated();
+};
+
+}
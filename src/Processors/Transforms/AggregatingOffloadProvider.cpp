@@ -0,0 +1,80 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Processors/Transforms/AggregatingOffloadProvider.h>
+
+#include <DataTypes/IDataType.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+}
+
+bool canOffloadAggregation(const Aggregator::Params & params)
+{
+    if (params.keys.empty() || params.overflow_row)
+        return false;
+
+    for (auto key : params.keys)
+    {
+        WhichDataType which(params.src_header.safeGetByPosition(key).type);
+        if (!which.isNativeUInt() && !which.isNativeInt())
+            return false;
+    }
+
+    for (const auto & aggregate : params.aggregates)
+    {
+        if (!aggregate.mask_column.empty() || !aggregate.parameters.empty())
+            return false;
+
+        const auto & name = aggregate.function->getName();
+        if (name != "sum" && name != "count")
+            return false;
+
+        for (auto argument : aggregate.arguments)
+        {
+            WhichDataType which(params.src_header.safeGetByPosition(argument).type);
+            if (!which.isNativeUInt() && !which.isNativeInt())
+                return false;
+        }
+    }
+
+    return true;
+}
+
+AggregatingOffloadProviderRegistry & AggregatingOffloadProviderRegistry::instance()
+{
+    static AggregatingOffloadProviderRegistry registry;
+    return registry;
+}
+
+void AggregatingOffloadProviderRegistry::registerProvider(std::unique_ptr<IAggregatingOffloadProvider> provider_)
+{
+    std::lock_guard lock(mutex);
+    if (provider)
+        throw Exception("Aggregating offload provider '" + provider->getName() + "' is already registered", ErrorCodes::LOGICAL_ERROR);
+    provider = std::move(provider_);
+}
+
+const IAggregatingOffloadProvider * AggregatingOffloadProviderRegistry::tryGet() const
+{
+    std::lock_guard lock(mutex);
+    return provider.get();
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <mutex>
+#include <Processors/Transforms/AggregatingTransform.h>
+#include <boost/core/noncopyable.hpp>
+
+namespace DB
+{
+
+/// Experimental seam for running eligible aggregations on an offload device
+/// (e.g. a spare GPU on the worker) instead of the regular AggregatingTransform.
+/// A provider is registered once at startup; AggregatingStep consults it when
+/// enable_aggregation_offload is set and falls back to CPU aggregation whenever
+/// no provider is registered or the provider declines the step.
+class IAggregatingOffloadProvider
+{
+public:
+    virtual ~IAggregatingOffloadProvider() = default;
+
+    virtual String getName() const = 0;
+
+    /// Whether the device can execute these params at all. Called once per step;
+    /// canOffloadAggregation() is the baseline any provider must satisfy.
+    virtual bool isEligible(const AggregatingTransformParams & params) const = 0;
+
+    /// Build the processor that batches input chunks to the device and turns the
+    /// device results back into exactly what AggregatingTransform would emit for
+    /// these params (serialized partial states when !params.final). May return
+    /// nullptr (device busy, out of device memory); the caller then uses the
+    /// regular CPU transform for that stream.
+    virtual ProcessorPtr createTransform(const Block & header, AggregatingTransformParamsPtr params) const = 0;
+};
+
+/// Conservative eligibility baseline: fixed-width integer keys aggregated with
+/// sum/count over fixed-width integer arguments. Providers may narrow this
+/// further but must not widen it.
+bool canOffloadAggregation(const Aggregator::Params & params);
+
+class AggregatingOffloadProviderRegistry : private boost::noncopyable
+{
+public:
+    static AggregatingOffloadProviderRegistry & instance();
+
+    void registerProvider(std::unique_ptr<IAggregatingOffloadProvider> provider_);
+
+    /// nullptr when no provider is registered.
+    const IAggregatingOffloadProvider * tryGet() const;
+
+private:
+    mutable std::mutex mutex;
+    std::unique_ptr<IAggregatingOffloadProvider> provider;
+};
+
+}
@@ -21,6 +21,7 @@
 
 #include <Processors/Transforms/AggregatingTransform.h>
 
+#include <DataStreams/ColumnarSpillFile.h>
 #include <DataStreams/NativeBlockInputStream.h>
 #include <Processors/ISource.h>
 #include <Processors/Pipe.h>
@@ -104,6 +105,38 @@ namespace
         CompressedReadBuffer compressed_in;
         BlockInputStreamPtr block_in;
     };
+
+    /// Reads chunks from a columnar spill file (see DataStreams/ColumnarSpillFile.h).
+    class SourceFromColumnarSpill : public ISource
+    {
+    public:
+        SourceFromColumnarSpill(const Block & header, const std::string & path)
+            : ISource(header), block_in(std::make_shared<ColumnarSpillBlockInputStream>(path, header))
+        {
+            block_in->readPrefix();
+        }
+
+        String getName() const override { return "SourceFromColumnarSpill"; }
+
+        Chunk generate() override
+        {
+            if (!block_in)
+                return {};
+
+            auto block = block_in->read();
+            if (!block)
+            {
+                block_in->readSuffix();
+                block_in.reset();
+                return {};
+            }
+
+            return convertToChunk(block);
+        }
+
+    private:
+        BlockInputStreamPtr block_in;
+    };
 }
 
 /// Worker which merges buckets for two-level aggregation.
@@ -636,7 +669,12 @@ void AggregatingTransform::initGenerate()
             Pipes pipes;
 
             for (const auto & file : files.files)
-                pipes.emplace_back(Pipe(std::make_unique<SourceFromNativeStream>(header, file->path())));
+            {
+                if (params->params.columnar_spill)
+                    pipes.emplace_back(Pipe(std::make_unique<SourceFromColumnarSpill>(header, file->path())));
+                else
+                    pipes.emplace_back(Pipe(std::make_unique<SourceFromNativeStream>(header, file->path())));
+            }
 
             pipe = Pipe::unitePipes(std::move(pipes));
         }
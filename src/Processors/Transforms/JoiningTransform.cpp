@@ -215,9 +215,12 @@ Block JoiningTransform::readExecute(Chunk & chunk)
     return res;
 }
 
-FillingRightJoinSideTransform::FillingRightJoinSideTransform(Block input_header, JoinPtr join_)
+FillingRightJoinSideTransform::FillingRightJoinSideTransform(
+    Block input_header, JoinPtr join_, SharedJoinBuildStatePtr shared_build_state_, bool is_builder_)
     : IProcessor({input_header}, {Block()})
     , join(std::move(join_))
+    , shared_build_state(std::move(shared_build_state_))
+    , is_builder(is_builder_)
 {}
 
 InputPort * FillingRightJoinSideTransform::addTotalsPort()
@@ -294,12 +297,32 @@ void FillingRightJoinSideTransform::work()
 {
     auto block = inputs.front().getHeader().cloneWithColumns(chunk.detachColumns());
 
+    if (shared_build_state && !is_builder)
+    {
+        /// Another local pipeline builds the shared table; we only drain our copy
+        /// of the build input. Before reporting the join as filled, wait for the
+        /// builder to finish, so probe pipelines never see a half-built table.
+        if (for_totals)
+        {
+            while (!shared_build_state->waitBuilt(100))
+            {
+                if (isCancelled())
+                    break;
+            }
+        }
+        set_totals = for_totals;
+        return;
+    }
+
     if (for_totals)
         join->setTotals(block);
     else
         stop_reading = !join->addJoinedBlock(block);
 
     set_totals = for_totals;
+
+    if (for_totals && shared_build_state)
+        shared_build_state->setBuilt();
 }
 
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <Processors/IProcessor.h>
 
+#include <condition_variable>
+#include <mutex>
 
 namespace DB
 {
@@ -8,6 +10,41 @@ namespace DB
 class IJoin;
 using JoinPtr = std::shared_ptr<IJoin>;
 
+/// Shares one broadcast join build table between several local pipelines of the
+/// same query (e.g. all plan segment instances on one worker). The pipeline that
+/// created the state builds the table and signals completion; the others reuse
+/// the join read-only, drain their copy of the build input and wait here before
+/// reporting the join as filled.
+class SharedJoinBuildState
+{
+public:
+    explicit SharedJoinBuildState(JoinPtr join_) : join(std::move(join_)) {}
+
+    JoinPtr getJoin() const { return join; }
+
+    void setBuilt()
+    {
+        std::lock_guard lock(mutex);
+        built = true;
+        cv.notify_all();
+    }
+
+    /// Returns whether the build finished within the timeout.
+    bool waitBuilt(UInt64 timeout_ms)
+    {
+        std::unique_lock lock(mutex);
+        return cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this] { return built; });
+    }
+
+private:
+    JoinPtr join;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool built = false;
+};
+
+using SharedJoinBuildStatePtr = std::shared_ptr<SharedJoinBuildState>;
+
 class IBlockInputStream;
 using BlockInputStreamPtr = std::shared_ptr<IBlockInputStream>;
 
@@ -93,7 +130,11 @@ private:
 class FillingRightJoinSideTransform : public IProcessor
 {
 public:
-    FillingRightJoinSideTransform(Block input_header, JoinPtr join_);
+    FillingRightJoinSideTransform(
+        Block input_header,
+        JoinPtr join_,
+        SharedJoinBuildStatePtr shared_build_state_ = nullptr,
+        bool is_builder_ = true);
     String getName() const override { return "FillingRightJoinSide"; }
 
     InputPort * addTotalsPort();
@@ -103,6 +144,9 @@ public:
 
 private:
     JoinPtr join;
+    /// Set when the build table is shared between several local pipelines.
+    SharedJoinBuildStatePtr shared_build_state;
+    bool is_builder = true;
     Chunk chunk;
     bool stop_reading = false;
     bool for_totals = false;
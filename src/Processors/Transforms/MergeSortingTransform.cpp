@@ -6,6 +6,8 @@
 #include <IO/ReadBufferFromFile.h>
 #include <Compression/CompressedReadBuffer.h>
 #include <Compression/CompressedWriteBuffer.h>
+#include <DataStreams/AsynchronousBlockInputStream.h>
+#include <DataStreams/ColumnarSpillFile.h>
 #include <DataStreams/NativeBlockInputStream.h>
 #include <DataStreams/NativeBlockOutputStream.h>
 #include <Disks/IVolume.h>
@@ -30,13 +32,23 @@ namespace ErrorCodes
 class BufferingToFileTransform : public IAccumulatingTransform
 {
 public:
-    BufferingToFileTransform(const Block & header, Poco::Logger * log_, std::string path_)
+    BufferingToFileTransform(const Block & header, Poco::Logger * log_, std::string path_, bool columnar_spill_)
         : IAccumulatingTransform(header, header), log(log_)
-        , path(std::move(path_)), file_buf_out(path), compressed_buf_out(file_buf_out)
-        , out_stream(std::make_shared<NativeBlockOutputStream>(compressed_buf_out, 0, header))
+        , path(std::move(path_)), columnar_spill(columnar_spill_)
     {
         LOG_INFO(log, "Sorting and writing part of data into temporary file {}", path);
         ProfileEvents::increment(ProfileEvents::ExternalSortWritePart);
+
+        if (columnar_spill)
+        {
+            out_stream = std::make_shared<ColumnarSpillBlockOutputStream>(path, header);
+        }
+        else
+        {
+            file_buf_out = std::make_unique<WriteBufferFromFile>(path);
+            compressed_buf_out = std::make_unique<CompressedWriteBuffer>(*file_buf_out);
+            out_stream = std::make_shared<NativeBlockOutputStream>(*compressed_buf_out, 0, header);
+        }
         out_stream->writePrefix();
     }
 
@@ -52,15 +64,29 @@ public:
         if (out_stream)
         {
             out_stream->writeSuffix();
-            compressed_buf_out.next();
-            file_buf_out.next();
+            if (compressed_buf_out)
+                compressed_buf_out->next();
+            if (file_buf_out)
+                file_buf_out->next();
             LOG_INFO(log, "Done writing part of data into temporary file {}", path);
 
             out_stream.reset();
 
-            file_in = std::make_unique<ReadBufferFromFile>(path);
-            compressed_in = std::make_unique<CompressedReadBuffer>(*file_in);
-            block_in = std::make_shared<NativeBlockInputStream>(*compressed_in, getOutputPort().getHeader(), 0);
+            /// Read and decompress the next block of this run in a background
+            /// thread while the merge consumes the current one, so the K-way
+            /// merge over the runs is not serialized behind disk reads.
+            if (columnar_spill)
+            {
+                block_in = std::make_shared<AsynchronousBlockInputStream>(
+                    std::make_shared<ColumnarSpillBlockInputStream>(path, getOutputPort().getHeader()));
+            }
+            else
+            {
+                file_in = std::make_unique<ReadBufferFromFile>(path);
+                compressed_in = std::make_unique<CompressedReadBuffer>(*file_in);
+                block_in = std::make_shared<AsynchronousBlockInputStream>(
+                    std::make_shared<NativeBlockInputStream>(*compressed_in, getOutputPort().getHeader(), 0));
+            }
         }
 
         if (!block_in)
@@ -81,8 +107,9 @@ public:
 private:
     Poco::Logger * log;
     std::string path;
-    WriteBufferFromFile file_buf_out;
-    CompressedWriteBuffer compressed_buf_out;
+    bool columnar_spill;
+    std::unique_ptr<WriteBufferFromFile> file_buf_out;
+    std::unique_ptr<CompressedWriteBuffer> compressed_buf_out;
     BlockOutputStreamPtr out_stream;
 
     std::unique_ptr<ReadBufferFromFile> file_in;
@@ -97,12 +124,14 @@ MergeSortingTransform::MergeSortingTransform(
     size_t max_bytes_before_remerge_,
     double remerge_lowered_memory_bytes_ratio_,
     size_t max_bytes_before_external_sort_, VolumePtr tmp_volume_,
-    size_t min_free_disk_space_)
+    size_t min_free_disk_space_,
+    bool columnar_spill_)
     : SortingTransform(header, description_, max_merged_block_size_, limit_)
     , max_bytes_before_remerge(max_bytes_before_remerge_)
     , remerge_lowered_memory_bytes_ratio(remerge_lowered_memory_bytes_ratio_)
     , max_bytes_before_external_sort(max_bytes_before_external_sort_), tmp_volume(tmp_volume_)
-    , min_free_disk_space(min_free_disk_space_) {}
+    , min_free_disk_space(min_free_disk_space_)
+    , columnar_spill(columnar_spill_) {}
 
 Processors MergeSortingTransform::expandPipeline()
 {
@@ -184,7 +213,7 @@ void MergeSortingTransform::consume(Chunk chunk)
 
         const std::string & path = temporary_files.back()->path();
         merge_sorter = std::make_unique<MergeSorter>(std::move(chunks), description, max_merged_block_size, limit);
-        auto current_processor = std::make_shared<BufferingToFileTransform>(header_without_constants, log, path);
+        auto current_processor = std::make_shared<BufferingToFileTransform>(header_without_constants, log, path, columnar_spill);
 
         processors.emplace_back(current_processor);
 
@@ -24,7 +24,8 @@ public:
                           size_t max_bytes_before_remerge_,
                           double remerge_lowered_memory_bytes_ratio_,
                           size_t max_bytes_before_external_sort_, VolumePtr tmp_volume_,
-                          size_t min_free_disk_space_);
+                          size_t min_free_disk_space_,
+                          bool columnar_spill_ = false);
 
     String getName() const override { return "MergeSortingTransform"; }
 
@@ -41,6 +42,7 @@ private:
     size_t max_bytes_before_external_sort;
     VolumePtr tmp_volume;
     size_t min_free_disk_space;
+    bool columnar_spill;
 
     size_t sum_rows_in_blocks = 0;
     size_t sum_bytes_in_blocks = 0;
@@ -303,9 +303,13 @@ WindowTransform::WindowTransform(const Block & input_header_,
                 aggregate_function->alignOfData());
             aggregate_function->create(workspace.aggregate_function_state.data());
         }
-        else if (workspace.window_function_impl->hasSecondStage())
+        else
         {
-            has_two_stage_exection = true;
+            only_plain_aggregates = false;
+            if (workspace.window_function_impl->hasSecondStage())
+            {
+                has_two_stage_exection = true;
+            }
         }
 
         workspaces.push_back(std::move(workspace));
@@ -1598,8 +1602,27 @@ void WindowTransform::work()
     // frame and the current row are already past them. Note that the frame
     // start can be further than current row for some frame specs (e.g. EXCLUDE
     // CURRENT ROW), so we have to check both.
+    auto first_needed_input_block = std::min(frame_start.block,
+        current_row.block);
+
+    if (only_plain_aggregates
+        && window_description.frame.begin_type
+            == WindowFrame::BoundaryType::Unbounded)
+    {
+        // A frame that starts at the partition start never resets the
+        // aggregation, so the rows already accumulated into the aggregate
+        // states are not read again, and there are no true window functions
+        // that could peek at arbitrary rows inside the frame. We only need the
+        // rows from the previous frame end onwards (and the current peer group,
+        // which is used as a reference for RANGE frame and partition boundary
+        // checks). This keeps memory bounded by the frame for running
+        // aggregates instead of materializing the entire partition.
+        first_needed_input_block = std::min({prev_frame_end.block,
+            current_row.block, peer_group_start.block});
+    }
+
     const auto first_used_block = std::min(next_output_block_number,
-        std::min(frame_start.block, current_row.block));
+        first_needed_input_block);
 
     if (first_block_number < first_used_block)
     {
@@ -1611,7 +1634,12 @@ void WindowTransform::work()
         first_block_number = first_used_block;
 
         assert(next_output_block_number >= first_block_number);
-        assert(frame_start.block >= first_block_number);
+        // With only plain aggregates over a partition-start frame, the frame
+        // start block is allowed to be dropped, see above.
+        assert(frame_start.block >= first_block_number
+            || (only_plain_aggregates
+                && window_description.frame.begin_type
+                    == WindowFrame::BoundaryType::Unbounded));
         assert(current_row.block >= first_block_number);
         assert(peer_group_start.block >= first_block_number);
     }
@@ -344,6 +344,11 @@ public:
     int64_t curr_offset[2];
     bool has_two_stage_exection = false;
 
+    // True if none of the functions is a true window function. Plain aggregates
+    // never look back at rows they have already accumulated, which allows
+    // dropping input blocks behind the frame end for partition-start frames.
+    bool only_plain_aggregates = true;
+
     // The frame is [frame_start, frame_end) if frame_ended && frame_started,
     // and unknown otherwise. Note that when we move to the next row, both the
     // frame_start and the frame_end may jump forward by an unknown amount of
@@ -0,0 +1,417 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// Benchmark harness for the exchange data transports. It pushes synthetic
+/// chunks through BroadcastSenderProxy / IBroadcastReceiver pairs and reports
+/// per-payload-size throughput and latency percentiles, so transport changes
+/// can be compared without running a whole distributed query.
+///
+/// Modes:
+///   local     LocalBroadcastChannel, sender and receiver in this process.
+///   brpc      Brpc transport over loopback, server and both sides in this process.
+///   sender    Serve the receiver registry and send; pair with a `receiver`
+///             process (possibly on another host) for a multi-process run.
+///   receiver  Register to a remote `sender` process and drain the streams.
+///
+/// End-to-end latency is only reported for the single-process modes where
+/// sender and receiver share a clock; the split modes report throughput.
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include <Columns/ColumnsNumber.h>
+#include <Core/Block.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Processors/Chunk.h>
+#include <Processors/Exchange/DataTrans/BroadcastSenderProxy.h>
+#include <Processors/Exchange/DataTrans/BroadcastSenderProxyRegistry.h>
+#include <Processors/Exchange/DataTrans/Brpc/BrpcExchangeReceiverRegistryService.h>
+#include <Processors/Exchange/DataTrans/Brpc/BrpcRemoteBroadcastReceiver.h>
+#include <Processors/Exchange/DataTrans/DataTrans_fwd.h>
+#include <Processors/Exchange/DataTrans/IBroadcastReceiver.h>
+#include <Processors/Exchange/DataTrans/IBroadcastSender.h>
+#include <Processors/Exchange/DataTrans/Local/LocalBroadcastChannel.h>
+#include <Processors/Exchange/DataTrans/Local/LocalChannelOptions.h>
+#include <Processors/Exchange/ExchangeDataKey.h>
+#include <brpc/server.h>
+#include <Poco/Util/MapConfiguration.h>
+#include <Common/Brpc/BrpcApplication.h>
+#include <Common/tests/gtest_global_context.h>
+
+using namespace DB;
+
+namespace
+{
+
+struct BenchmarkOptions
+{
+    String mode = "local";
+    /// Address of the sender-side registry the receivers connect to.
+    String registry = "127.0.0.1:8001";
+    /// Port the registry service listens on in brpc/sender modes.
+    int listen_port = 8001;
+    /// Rows per chunk for each measured payload size.
+    std::vector<size_t> rows_per_chunk = {64, 1024, 65536};
+    size_t columns = 8;
+    size_t chunks = 1000;
+    size_t streams = 1;
+    size_t queue_size = 32;
+    UInt32 timeout_ms = 30000;
+};
+
+[[noreturn]] void printUsageAndExit(const char * name)
+{
+    std::cerr << "Usage: " << name << " [options]\n"
+              << "  --mode local|brpc|sender|receiver   transport and process role (default local)\n"
+              << "  --registry HOST:PORT                sender registry address for receiver mode\n"
+              << "  --listen-port N                     registry port in brpc/sender modes (default 8001)\n"
+              << "  --rows N[,N...]                     rows per chunk, one run per value (default 64,1024,65536)\n"
+              << "  --columns N                         UInt64 columns per chunk (default 8)\n"
+              << "  --chunks N                          chunks per stream (default 1000)\n"
+              << "  --streams N                         concurrent sender/receiver pairs (default 1)\n"
+              << "  --queue-size N                      local channel queue size (default 32)\n"
+              << "  --timeout-ms N                      send/recv timeout (default 30000)\n";
+    exit(1);
+}
+
+BenchmarkOptions parseOptions(int argc, char ** argv)
+{
+    BenchmarkOptions res;
+    for (int i = 1; i < argc; ++i)
+    {
+        String arg = argv[i];
+        auto next = [&]() -> String
+        {
+            if (i + 1 >= argc)
+                printUsageAndExit(argv[0]);
+            return argv[++i];
+        };
+
+        if (arg == "--mode")
+            res.mode = next();
+        else if (arg == "--registry")
+            res.registry = next();
+        else if (arg == "--listen-port")
+            res.listen_port = std::stoi(next());
+        else if (arg == "--rows")
+        {
+            res.rows_per_chunk.clear();
+            String list = next();
+            size_t pos = 0;
+            while (pos < list.size())
+            {
+                size_t comma = list.find(',', pos);
+                res.rows_per_chunk.push_back(std::stoull(list.substr(pos, comma - pos)));
+                pos = comma == String::npos ? list.size() : comma + 1;
+            }
+        }
+        else if (arg == "--columns")
+            res.columns = std::stoull(next());
+        else if (arg == "--chunks")
+            res.chunks = std::stoull(next());
+        else if (arg == "--streams")
+            res.streams = std::stoull(next());
+        else if (arg == "--queue-size")
+            res.queue_size = std::stoull(next());
+        else if (arg == "--timeout-ms")
+            res.timeout_ms = std::stoul(next());
+        else
+            printUsageAndExit(argv[0]);
+    }
+    if (res.rows_per_chunk.empty() || res.columns == 0 || res.chunks == 0 || res.streams == 0)
+        printUsageAndExit(argv[0]);
+    return res;
+}
+
+Block makeHeader(size_t columns)
+{
+    ColumnsWithTypeAndName cols;
+    for (size_t i = 0; i < columns; ++i)
+        cols.emplace_back(ColumnUInt64::create(), std::make_shared<DataTypeUInt64>(), "c" + std::to_string(i));
+    return Block(cols);
+}
+
+Chunk makeChunk(size_t rows, size_t columns)
+{
+    Columns cols;
+    for (size_t i = 0; i < columns; ++i)
+    {
+        auto col = ColumnUInt64::create(rows);
+        auto & data = col->getData();
+        for (size_t row = 0; row < rows; ++row)
+            data[row] = row * columns + i;
+        cols.emplace_back(std::move(col));
+    }
+    return Chunk(std::move(cols), rows);
+}
+
+UInt64 nowMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// Per-run measurements. Send timestamps are published through the channel's
+/// own synchronization: a slot is written before send() and read only after
+/// recv() returned the matching chunk.
+struct StreamClocks
+{
+    explicit StreamClocks(size_t chunks) : send_ts(chunks, 0) { }
+    std::vector<UInt64> send_ts;
+    std::vector<UInt64> latencies_us;
+    size_t chunks_received = 0;
+    size_t bytes_received = 0;
+};
+
+void runSender(const BroadcastSenderPtr & sender, const Chunk & sample, size_t chunks, StreamClocks & clocks)
+{
+    for (size_t i = 0; i < chunks; ++i)
+    {
+        clocks.send_ts[i] = nowMicroseconds();
+        auto status = sender->send(sample.clone());
+        if (status.code != BroadcastStatusCode::RUNNING)
+        {
+            std::cerr << "send failed with code " << status.code << ": " << status.message << std::endl;
+            return;
+        }
+    }
+    sender->finish(BroadcastStatusCode::ALL_SENDERS_DONE, "exchange_benchmark sender done");
+}
+
+/// Drains the receiver until the senders-done status. With `clocks` from the
+/// sending side of the same process, also collects end-to-end latencies.
+void runReceiver(const BroadcastReceiverPtr & receiver, UInt32 timeout_ms, StreamClocks & clocks, bool measure_latency)
+{
+    while (true)
+    {
+        auto packet = receiver->recv(timeout_ms);
+        if (std::holds_alternative<BroadcastStatus>(packet))
+        {
+            const auto & status = std::get<BroadcastStatus>(packet);
+            if (status.code != BroadcastStatusCode::ALL_SENDERS_DONE)
+                std::cerr << "recv finished with code " << status.code << ": " << status.message << std::endl;
+            return;
+        }
+        const auto & chunk = std::get<Chunk>(packet);
+        if (measure_latency && clocks.chunks_received < clocks.send_ts.size())
+            clocks.latencies_us.push_back(nowMicroseconds() - clocks.send_ts[clocks.chunks_received]);
+        clocks.bytes_received += chunk.bytes();
+        ++clocks.chunks_received;
+    }
+}
+
+void report(const String & title, std::vector<StreamClocks> & streams, size_t chunk_bytes, UInt64 elapsed_us)
+{
+    size_t total_chunks = 0;
+    size_t total_bytes = 0;
+    std::vector<UInt64> latencies;
+    for (auto & clocks : streams)
+    {
+        total_chunks += clocks.chunks_received;
+        total_bytes += clocks.bytes_received;
+        latencies.insert(latencies.end(), clocks.latencies_us.begin(), clocks.latencies_us.end());
+    }
+
+    double seconds = elapsed_us / 1e6;
+    std::cout << title << " chunk_bytes=" << chunk_bytes << " chunks=" << total_chunks << std::endl;
+    std::cout << "  throughput: " << total_bytes / seconds / (1 << 20) << " MiB/s, " << total_chunks / seconds << " chunks/s"
+              << std::endl;
+
+    if (!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double q) { return latencies[std::min(latencies.size() - 1, size_t(q * latencies.size()))]; };
+        std::cout << "  latency_us: p50=" << percentile(0.50) << " p90=" << percentile(0.90) << " p99=" << percentile(0.99)
+                  << " max=" << latencies.back() << std::endl;
+    }
+}
+
+ExchangeDataKeyPtr makeKey(size_t rows, size_t stream)
+{
+    /// Distinct key per run and stream, so the proxy registry never aliases runs.
+    return std::make_shared<ExchangeDataKey>("exchange_benchmark_" + std::to_string(rows), 1, stream, "localhost:0");
+}
+
+void runLocal(const BenchmarkOptions & options)
+{
+    for (size_t rows : options.rows_per_chunk)
+    {
+        auto sample = makeChunk(rows, options.columns);
+        std::vector<StreamClocks> clocks(options.streams, StreamClocks(options.chunks));
+        std::vector<std::thread> threads;
+
+        UInt64 start_us = nowMicroseconds();
+        for (size_t stream = 0; stream < options.streams; ++stream)
+        {
+            auto key = makeKey(rows, stream);
+            LocalChannelOptions channel_options{options.queue_size, options.timeout_ms};
+            auto channel = std::make_shared<LocalBroadcastChannel>(key, channel_options, LocalBroadcastChannel::generateNameForTest());
+            auto sender = BroadcastSenderProxyRegistry::instance().getOrCreate(key);
+            sender->becomeRealSender(channel);
+            BroadcastReceiverPtr receiver = std::dynamic_pointer_cast<IBroadcastReceiver>(channel);
+
+            threads.emplace_back(
+                [&, sender, stream] { runSender(sender, sample, options.chunks, clocks[stream]); });
+            threads.emplace_back(
+                [&, receiver, stream] { runReceiver(receiver, options.timeout_ms, clocks[stream], /*measure_latency*/ true); });
+        }
+        for (auto & thread : threads)
+            thread.join();
+
+        report("mode=local streams=" + std::to_string(options.streams), clocks, sample.bytes(), nowMicroseconds() - start_us);
+    }
+}
+
+brpc::Server & startRegistryServer(int port)
+{
+    static BrpcExchangeReceiverRegistryService service_impl(73400320);
+    static brpc::Server server;
+    if (server.AddService(&service_impl, brpc::SERVER_DOESNT_OWN_SERVICE) != 0)
+    {
+        std::cerr << "failed to add receiver registry service" << std::endl;
+        exit(1);
+    }
+    brpc::ServerOptions server_options;
+    server_options.idle_timeout_sec = -1;
+    if (server.Start(port, &server_options) != 0)
+    {
+        std::cerr << "failed to start registry server on port " << port << std::endl;
+        exit(1);
+    }
+    return server;
+}
+
+void runBrpcSenders(
+    const BenchmarkOptions & options, size_t rows, const Block & header, const Chunk & sample, std::vector<StreamClocks> & clocks,
+    std::vector<std::thread> & threads)
+{
+    for (size_t stream = 0; stream < options.streams; ++stream)
+    {
+        auto sender = BroadcastSenderProxyRegistry::instance().getOrCreate(makeKey(rows, stream));
+        sender->accept(getContext().context, header);
+        threads.emplace_back([&, sender, stream] { runSender(sender, sample, options.chunks, clocks[stream]); });
+    }
+}
+
+void runBrpcReceivers(
+    const BenchmarkOptions & options, size_t rows, const Block & header, bool measure_latency, std::vector<StreamClocks> & clocks,
+    std::vector<std::thread> & threads)
+{
+    for (size_t stream = 0; stream < options.streams; ++stream)
+    {
+        threads.emplace_back(
+            [&, stream, measure_latency]
+            {
+                auto receiver = std::make_shared<BrpcRemoteBroadcastReceiver>(
+                    makeKey(rows, stream), options.registry, getContext().context, header, true,
+                    BrpcRemoteBroadcastReceiver::generateNameForTest());
+                receiver->registerToSenders(options.timeout_ms);
+                runReceiver(receiver, options.timeout_ms, clocks[stream], measure_latency);
+            });
+    }
+}
+
+void runBrpc(const BenchmarkOptions & options)
+{
+    startRegistryServer(options.listen_port);
+    auto header = makeHeader(options.columns);
+
+    for (size_t rows : options.rows_per_chunk)
+    {
+        auto sample = makeChunk(rows, options.columns);
+        std::vector<StreamClocks> clocks(options.streams, StreamClocks(options.chunks));
+        std::vector<std::thread> threads;
+
+        UInt64 start_us = nowMicroseconds();
+        runBrpcReceivers(options, rows, header, /*measure_latency*/ true, clocks, threads);
+        runBrpcSenders(options, rows, header, sample, clocks, threads);
+        for (auto & thread : threads)
+            thread.join();
+
+        report("mode=brpc streams=" + std::to_string(options.streams), clocks, sample.bytes(), nowMicroseconds() - start_us);
+    }
+}
+
+void runSplitSender(const BenchmarkOptions & options)
+{
+    startRegistryServer(options.listen_port);
+    auto header = makeHeader(options.columns);
+
+    for (size_t rows : options.rows_per_chunk)
+    {
+        auto sample = makeChunk(rows, options.columns);
+        std::vector<StreamClocks> clocks(options.streams, StreamClocks(options.chunks));
+        std::vector<std::thread> threads;
+
+        UInt64 start_us = nowMicroseconds();
+        runBrpcSenders(options, rows, header, sample, clocks, threads);
+        for (auto & thread : threads)
+            thread.join();
+
+        std::cout << "mode=sender streams=" << options.streams << " chunk_bytes=" << sample.bytes() << " sent "
+                  << options.streams * options.chunks << " chunks in " << (nowMicroseconds() - start_us) / 1e6 << " s" << std::endl;
+    }
+}
+
+void runSplitReceiver(const BenchmarkOptions & options)
+{
+    auto header = makeHeader(options.columns);
+
+    for (size_t rows : options.rows_per_chunk)
+    {
+        std::vector<StreamClocks> clocks(options.streams, StreamClocks(options.chunks));
+        std::vector<std::thread> threads;
+
+        UInt64 start_us = nowMicroseconds();
+        /// Clocks differ between processes, so only throughput is meaningful here.
+        runBrpcReceivers(options, rows, header, /*measure_latency*/ false, clocks, threads);
+        for (auto & thread : threads)
+            thread.join();
+
+        report("mode=receiver streams=" + std::to_string(options.streams), clocks, makeChunk(rows, options.columns).bytes(),
+               nowMicroseconds() - start_us);
+    }
+}
+
+}
+
+int main(int argc, char ** argv)
+{
+    auto options = parseOptions(argc, argv);
+
+    if (options.mode != "local")
+    {
+        Poco::AutoPtr<Poco::Util::MapConfiguration> map_config = new Poco::Util::MapConfiguration;
+        BrpcApplication::getInstance().initialize(*map_config);
+    }
+
+    if (options.mode == "local")
+        runLocal(options);
+    else if (options.mode == "brpc")
+        runBrpc(options);
+    else if (options.mode == "sender")
+        runSplitSender(options);
+    else if (options.mode == "receiver")
+        runSplitReceiver(options);
+    else
+        printUsageAndExit(argv[0]);
+
+    return 0;
+}
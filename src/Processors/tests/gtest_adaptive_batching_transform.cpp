@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <Processors/Executors/PipelineExecutor.h>
+#include <Processors/ISink.h>
+#include <Processors/ISource.h>
+#include <Processors/Transforms/AdaptiveBatchingTransform.h>
+
+#include <Columns/ColumnsNumber.h>
+#include <DataTypes/DataTypesNumber.h>
+
+using namespace DB;
+
+namespace
+{
+
+Block makeHeader()
+{
+    return Block{ColumnWithTypeAndName(ColumnUInt64::create(), std::make_shared<DataTypeUInt64>(), "x")};
+}
+
+Chunk makeChunk(size_t rows)
+{
+    Columns columns;
+    columns.emplace_back(ColumnUInt64::create(rows, 42));
+    return Chunk(std::move(columns), rows);
+}
+
+class ChunkQueueSource : public ISource
+{
+public:
+    ChunkQueueSource(const Block & header, std::vector<size_t> chunk_sizes_)
+        : ISource(header), chunk_sizes(std::move(chunk_sizes_))
+    {
+    }
+
+    String getName() const override { return "ChunkQueueSource"; }
+
+protected:
+    Chunk generate() override
+    {
+        if (next_chunk >= chunk_sizes.size())
+            return {};
+        return makeChunk(chunk_sizes[next_chunk++]);
+    }
+
+private:
+    std::vector<size_t> chunk_sizes;
+    size_t next_chunk = 0;
+};
+
+class ChunkSizesSink : public ISink
+{
+public:
+    ChunkSizesSink(const Block & header, std::vector<size_t> & chunk_sizes_)
+        : ISink(header), chunk_sizes(chunk_sizes_)
+    {
+    }
+
+    String getName() const override { return "ChunkSizesSink"; }
+
+protected:
+    void consume(Chunk chunk) override { chunk_sizes.push_back(chunk.getNumRows()); }
+
+private:
+    std::vector<size_t> & chunk_sizes;
+};
+
+std::vector<size_t> runBatching(const std::vector<size_t> & input_sizes, size_t min_batch_rows)
+{
+    Block header = makeHeader();
+
+    auto source = std::make_shared<ChunkQueueSource>(header, input_sizes);
+    auto batching = std::make_shared<AdaptiveBatchingTransform>(header, min_batch_rows, 0);
+
+    std::vector<size_t> output_sizes;
+    auto sink = std::make_shared<ChunkSizesSink>(header, output_sizes);
+
+    connect(source->getPort(), batching->getInputs().front());
+    connect(batching->getOutputs().front(), sink->getPort());
+
+    Processors processors{std::move(source), std::move(batching), std::move(sink)};
+    PipelineExecutor executor(processors);
+    executor.execute(1);
+
+    return output_sizes;
+}
+
+}
+
+TEST(AdaptiveBatchingTransform, MergesSmallChunks)
+{
+    /// 5 chunks of 10 rows with a 25-row target: flushed at 30, tail of 20 at end of input.
+    auto output = runBatching({10, 10, 10, 10, 10}, 25);
+    ASSERT_EQ(output, (std::vector<size_t>{30, 20}));
+}
+
+TEST(AdaptiveBatchingTransform, PassesLargeChunksThrough)
+{
+    /// The large chunk is not merged with the small ones around it.
+    auto output = runBatching({10, 100, 10, 10, 10}, 25);
+    ASSERT_EQ(output, (std::vector<size_t>{10, 100, 30}));
+}
@@ -182,6 +182,59 @@ TEST_F(ExchangeRemoteTest, SerDserChunk)
     EXPECT_EQ(col->getUInt(1), 7);
 }
 
+TEST_F(ExchangeRemoteTest, SerDserSparseChunk)
+{
+    /// Mostly-default column: only every 100-th row carries a value.
+    auto sparse_column = ColumnUInt8::create(1000, 0);
+    for (size_t i = 0; i < 1000; i += 100)
+        sparse_column->getData()[i] = 7;
+    Chunk origin_chunk(Columns{std::move(sparse_column)}, 1000);
+    auto header = getHeader(1);
+
+    // ser
+    WriteBufferFromBrpcBuf out;
+    NativeChunkOutputStream block_out(out, ClickHouseRevision::getVersionRevision(), header, false, /*enable_sparse_serialization*/ true);
+    block_out.write(origin_chunk);
+    auto send_buf = out.getFinishedBuf();
+
+    /// Dense payload would be 1000 value bytes alone.
+    EXPECT_LT(send_buf.size(), 100);
+
+    // dser
+    ReadBufferFromBrpcBuf read_buffer(send_buf);
+    NativeChunkInputStream chunk_in(read_buffer, header);
+    Chunk chunk = chunk_in.readImpl();
+    EXPECT_EQ(chunk.getNumRows(), 1000);
+    auto col = chunk.getColumns().at(0);
+    for (size_t i = 0; i < 1000; ++i)
+        EXPECT_EQ(col->getUInt(i), i % 100 == 0 ? 7 : 0);
+}
+
+TEST_F(ExchangeRemoteTest, SerDserColumnSizesParallel)
+{
+    constexpr size_t num_columns = 40;
+    constexpr size_t num_rows = 40000;
+    auto origin_chunk = createUInt8Chunk(num_rows, num_columns, 7);
+    auto header = getHeader(num_columns);
+
+    // ser
+    WriteBufferFromBrpcBuf out;
+    NativeChunkOutputStream block_out(
+        out, ClickHouseRevision::getVersionRevision(), header, false, /*enable_sparse_serialization*/ false, /*enable_column_sizes*/ true);
+    block_out.write(origin_chunk);
+    auto send_buf = out.getFinishedBuf();
+
+    // dser, column-parallel on a small task group
+    ThreadPool deserialize_pool(4);
+    ReadBufferFromBrpcBuf read_buffer(send_buf);
+    NativeChunkInputStream chunk_in(read_buffer, header, &deserialize_pool);
+    Chunk chunk = chunk_in.readImpl();
+    EXPECT_EQ(chunk.getNumRows(), num_rows);
+    EXPECT_EQ(chunk.getNumColumns(), num_columns);
+    for (size_t i = 0; i < num_columns; ++i)
+        EXPECT_EQ(chunk.getColumns().at(i)->getUInt(num_rows - 1), 7);
+}
+
 void sender_thread(BroadcastSenderProxyPtr sender, Chunk chunk)
 {
     BroadcastStatus status = sender->send(std::move(chunk));
@@ -29,6 +29,9 @@
 #include <Storages/MergeTree/MergeTreeDataPartCNCH.h>
 #include <Transaction/TxnTimestamp.h>
 #include <Common/Exception.h>
+#include <Common/HashTable/Hash.h>
+#include <Common/LRUCache.h>
+#include <Common/SipHash.h>
 #include <common/JSON.h>
 #include <Disks/HDFS/DiskByteHDFS.h>
 #include <Storages/HDFS/HDFSCommon.h>
@@ -43,9 +46,10 @@ namespace ErrorCodes
     extern const int EMPTY_PARTITION_IN_DATA_MODEL_PART;
 }
 
-DataModelPartWrapperPtr createPartWrapperFromModel(const MergeTreeMetaBase & storage, const Protos::DataModelPart & part_model)
+DataModelPartWrapperPtr createPartWrapperFromModel(
+    const MergeTreeMetaBase & storage, const Protos::DataModelPart & part_model, const PartModelSlabPtr & slab)
 {
-    DataModelPartWrapperPtr part_model_wrapper = createPartWrapperFromModelBasic(part_model);
+    DataModelPartWrapperPtr part_model_wrapper = createPartWrapperFromModelBasic(part_model, slab);
 
     /// Partition and Minmax index
     ReadBufferFromString partition_minmax_buf(part_model.partition_minmax());
@@ -62,14 +66,62 @@ DataModelPartWrapperPtr createPartWrapperFromModel(const MergeTreeMetaBase & sto
     return part_model_wrapper;
 }
 
-DataModelPartWrapperPtr createPartWrapperFromModelBasic(const Protos::DataModelPart & part_model)
+DataModelPartWrapperPtr createPartWrapperFromModelBasic(const Protos::DataModelPart & part_model, const PartModelSlabPtr & slab)
 {
     DataModelPartWrapperPtr part_model_wrapper = std::make_shared<DataModelPartWrapper>();
 
     part_model_wrapper->info = createPartInfoFromModel(part_model.part_info());
     part_model_wrapper->name = part_model_wrapper->info->getPartName();
 
-    part_model_wrapper->part_model = std::make_shared<Protos::DataModelPart>(part_model);
+    if (slab)
+        part_model_wrapper->part_model = slab->adopt(part_model);
+    else
+        part_model_wrapper->part_model = std::make_shared<Protos::DataModelPart>(part_model);
+    auto & inside_part_model = *(part_model_wrapper->part_model);
+    if (!inside_part_model.has_deleted())
+        inside_part_model.set_deleted(false);
+    if (!inside_part_model.has_data_path_id())
+        inside_part_model.set_data_path_id(0);
+    if (!inside_part_model.has_mutation_commit_time())
+        inside_part_model.set_mutation_commit_time(0);
+    if (!inside_part_model.has_commit_time())
+        inside_part_model.set_commit_time(part_model_wrapper->info->mutation);
+
+    if (inside_part_model.has_min_unique_key() && inside_part_model.min_unique_key().empty() && inside_part_model.rows_count() > 0)
+        throw Exception("min unique key of non empty part must be non empty", ErrorCodes::LOGICAL_ERROR);
+    if (inside_part_model.has_max_unique_key() && inside_part_model.max_unique_key().empty() && inside_part_model.rows_count() > 0)
+        throw Exception("max unique key of non empty part must be non empty", ErrorCodes::LOGICAL_ERROR);
+
+    return part_model_wrapper;
+}
+
+DataModelPartWrapperPtr createPartWrapperFromModelPtr(const MergeTreeMetaBase & storage, DataModelPartPtr part_model)
+{
+    DataModelPartWrapperPtr part_model_wrapper = createPartWrapperFromModelBasicPtr(std::move(part_model));
+
+    /// Partition and Minmax index
+    ReadBufferFromString partition_minmax_buf(part_model_wrapper->part_model->partition_minmax());
+    if (unlikely(storage.format_version < MERGE_TREE_DATA_MIN_FORMAT_VERSION_WITH_CUSTOM_PARTITIONING))
+        throw Exception("MergeTree data format is too old", ErrorCodes::FORMAT_VERSION_TOO_OLD);
+
+    part_model_wrapper->partition.load(storage, partition_minmax_buf);
+    if (part_model_wrapper->part_model->rows_count() > 0)
+    {
+        part_model_wrapper->minmax_idx = std::make_shared<IMergeTreeDataPart::MinMaxIndex>();
+        part_model_wrapper->minmax_idx->load(storage, partition_minmax_buf);
+    }
+
+    return part_model_wrapper;
+}
+
+DataModelPartWrapperPtr createPartWrapperFromModelBasicPtr(DataModelPartPtr part_model)
+{
+    DataModelPartWrapperPtr part_model_wrapper = std::make_shared<DataModelPartWrapper>();
+
+    part_model_wrapper->info = createPartInfoFromModel(part_model->part_info());
+    part_model_wrapper->name = part_model_wrapper->info->getPartName();
+
+    part_model_wrapper->part_model = std::move(part_model);
     auto & inside_part_model = *(part_model_wrapper->part_model);
     if (!inside_part_model.has_deleted())
         inside_part_model.set_deleted(false);
@@ -98,6 +150,15 @@ createPartFromModelCommon(const MergeTreeMetaBase & storage, const Protos::DataM
 
     DiskPtr remote_disk = getDiskForPathId(storage.getStoragePolicy(IStorage::StorageLocation::MAIN), path_id);
     auto mock_volume = std::make_shared<SingleDiskVolume>("volume_mock", remote_disk, 0);
+
+    /// Manifest-only attached parts record their out-of-namespace location in the model
+    bool from_external_path = false;
+    if (!relative_path.has_value() && part_model.has_relative_path())
+    {
+        relative_path = part_model.relative_path();
+        from_external_path = true;
+    }
+
     UUID part_id = UUIDHelpers::Nil;
     switch(remote_disk->getType())
     {
@@ -120,6 +181,7 @@ createPartFromModelCommon(const MergeTreeMetaBase & storage, const Protos::DataM
     }
     auto part = std::make_shared<MergeTreeDataPartCNCH>(storage, part_name, *info,
         mock_volume, relative_path, nullptr, part_id);
+    part->external_relative_path = from_external_path;
 
     if (part_model.has_staging_txn_id())
     {
@@ -195,6 +257,25 @@ DataPartInfoPtr createPartInfoFromModel(const Protos::DataModelPartInfo & part_i
     return part_info_ptr;
 }
 
+NamesAndTypesListPtr parsePartColumnsCached(const String & columns_str)
+{
+    /// Parts whose columns do not match any storage version (e.g. written in the middle
+    /// of a schema change) carry their full serialized column list in the part model.
+    /// Parsing it costs O(all columns) per part, which dominates part instantiation on
+    /// very wide tables, so identical lists are parsed once and shared between parts.
+    static LRUCache<UInt128, NamesAndTypesList, UInt128TrivialHash> parsed_columns_cache(256);
+
+    UInt128 key;
+    SipHash hash;
+    hash.update(columns_str.data(), columns_str.size());
+    hash.get128(key);
+
+    return parsed_columns_cache.getOrSet(key, [&]
+    {
+        return std::make_shared<NamesAndTypesList>(NamesAndTypesList::parse(columns_str));
+    }).first;
+}
+
 MutableMergeTreeDataPartCNCHPtr createPartFromModel(
     const MergeTreeMetaBase & storage,
     const Protos::DataModelPart & part_model,
@@ -204,7 +285,7 @@ MutableMergeTreeDataPartCNCHPtr createPartFromModel(
     /// Columns, required
     if (part_model.has_columns())
     {
-        part->setColumns(NamesAndTypesList::parse(part_model.columns()));
+        part->setColumnsPtr(parsePartColumnsCached(part_model.columns()));
         part->columns_commit_time = storage.getPartColumnsCommitTime(part->getColumns());
     }
     else
@@ -257,6 +338,9 @@ void fillPartModel(const IStorage & storage, const IMergeTreeDataPart & part, Pr
         part_model.set_delete_flag(part.delete_flag);
     if (part.low_priority)
         part_model.set_low_priority(part.low_priority);
+    /// Allows the server to drop fully expired parts without reading their data.
+    if (part.ttl_infos.table_ttl.max)
+        part_model.set_rows_ttl_max(part.ttl_infos.table_ttl.max);
 
     if (!ignore_column_commit_time && part.columns_commit_time)
     {
@@ -290,6 +374,11 @@ void fillPartModel(const IStorage & storage, const IMergeTreeDataPart & part, Pr
         part_model.set_staging_txn_id(part.staging_txn_id);
     }
 
+    if (part.external_relative_path)
+    {
+        part_model.set_relative_path(part.relative_path);
+    }
+
     if (part.virtual_part_size)
     {
         part_model.set_virtual_part_size(part.virtual_part_size);
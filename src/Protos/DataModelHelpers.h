@@ -42,6 +42,12 @@ namespace pb = google::protobuf;
 MutableMergeTreeDataPartCNCHPtr createPartFromModelCommon(
     const MergeTreeMetaBase & storage, const Protos::DataModelPart & part_model, std::optional<std::string> relative_path = std::nullopt);
 
+/// Parse a part model's serialized column list, sharing the parsed result between all
+/// parts that carry an identical list. On wide tables the parse is the dominant cost of
+/// instantiating a part object, and parts written between two schema versions all carry
+/// the same list.
+NamesAndTypesListPtr parsePartColumnsCached(const String & columns_str);
+
 MutableMergeTreeDataPartCNCHPtr createPartFromModel(
     const MergeTreeMetaBase & storage,
     const Protos::DataModelPart & part_model,
@@ -176,7 +182,7 @@ inline std::vector<T> createPartVectorFromModelsForSend(
         part->columns_commit_time = part_model.columns_commit_time();
         if (part_model.has_columns())
         {
-            part->setColumns(NamesAndTypesList::parse(part_model.columns()));
+            part->setColumnsPtr(parsePartColumnsCached(part_model.columns()));
             if (part_model.has_columns_commit_time())
             {
                 columns_versions[part_model.columns_commit_time()] = part->getColumnsPtr();
@@ -243,9 +249,18 @@ inline DeleteBitmapMetaPtr createFromModel(const MergeTreeMetaBase & storage, co
 void fillLockInfoModel(const LockInfo & lock_info, Protos::DataModelLockInfo & model);
 LockInfoPtr createLockInfoFromModel(const Protos::DataModelLockInfo & model);
 
-DataModelPartWrapperPtr createPartWrapperFromModel(const MergeTreeMetaBase & storage, const Protos::DataModelPart & part_model);
+/// If a slab is given, the copy of the part model kept by the wrapper is allocated inside it
+/// instead of being an individual heap allocation; used by the server part cache.
+DataModelPartWrapperPtr createPartWrapperFromModel(
+    const MergeTreeMetaBase & storage, const Protos::DataModelPart & part_model, const PartModelSlabPtr & slab = nullptr);
+
+DataModelPartWrapperPtr createPartWrapperFromModelBasic(const Protos::DataModelPart & part_model, const PartModelSlabPtr & slab = nullptr);
+
+/// Zero-copy variants: the wrapper takes ownership of the given model (individually heap
+/// allocated or arena backed) instead of copying it.
+DataModelPartWrapperPtr createPartWrapperFromModelPtr(const MergeTreeMetaBase & storage, DataModelPartPtr part_model);
 
-DataModelPartWrapperPtr createPartWrapperFromModelBasic(const Protos::DataModelPart & part_model);
+DataModelPartWrapperPtr createPartWrapperFromModelBasicPtr(DataModelPartPtr part_model);
 
 ServerDataPartsVector createServerPartsFromModels(const MergeTreeMetaBase & storage, const pb::RepeatedPtrField<Protos::DataModelPart> & parts_model);
 
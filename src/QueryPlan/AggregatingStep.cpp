@@ -24,6 +24,7 @@
 #include <Processors/ResizeProcessor.h>
 #include <Processors/Transforms/CopyTransform.h>
 #include <Processors/Transforms/AggregatingInOrderTransform.h>
+#include <Processors/Transforms/AggregatingOffloadProvider.h>
 #include <Processors/Transforms/AggregatingTransform.h>
 #include <Processors/Transforms/CubeTransform.h>
 #include <Processors/Transforms/ExpressionTransform.h>
@@ -383,6 +384,8 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
         settings.min_count_to_compile_aggregate_expression,
         Block{},
         params.stats_collecting_params);
+    new_params.enable_selective_spill = settings.enable_selective_group_by_spill;
+    new_params.columnar_spill = settings.spill_columnar_format;
 
     /// Forget about current totals and extremes. They will be calculated again after aggregation if needed.
     pipeline.dropTotalsAndExtremes();
@@ -401,6 +404,17 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
       */
     auto transform_params = std::make_shared<AggregatingTransformParams>(std::move(new_params), agg_final);
 
+    /// Experimental offload of eligible aggregations to a registered execution
+    /// provider; any stream the device declines keeps the CPU transform.
+    const IAggregatingOffloadProvider * offload_provider = nullptr;
+    if (settings.enable_aggregation_offload && grouping_sets_params.empty() && !group_by_info
+        && canOffloadAggregation(transform_params->params))
+    {
+        offload_provider = AggregatingOffloadProviderRegistry::instance().tryGet();
+        if (offload_provider && !offload_provider->isEligible(*transform_params))
+            offload_provider = nullptr;
+    }
+
     if (!grouping_sets_params.empty())
     {
         const auto prepared_sets_params = prepareGroupingSetsParams();
@@ -618,7 +632,10 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
         auto many_data = std::make_shared<ManyAggregatedData>(pipeline.getNumStreams());
 
         size_t counter = 0;
-        pipeline.addSimpleTransform([&](const Block & header) {
+        pipeline.addSimpleTransform([&](const Block & header) -> ProcessorPtr {
+            if (offload_provider)
+                if (auto offloaded = offload_provider->createTransform(header, transform_params))
+                    return offloaded;
             return std::make_shared<AggregatingTransform>(
                 header, transform_params, many_data, counter++, merge_max_threads, temporary_data_merge_threads);
         });
@@ -632,7 +649,12 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline, const BuildQue
     {
         pipeline.resize(1);
 
-        pipeline.addSimpleTransform([&](const Block & header) { return std::make_shared<AggregatingTransform>(header, transform_params); });
+        pipeline.addSimpleTransform([&](const Block & header) -> ProcessorPtr {
+            if (offload_provider)
+                if (auto offloaded = offload_provider->createTransform(header, transform_params))
+                    return offloaded;
+            return std::make_shared<AggregatingTransform>(header, transform_params);
+        });
 
         aggregating = collector.detachProcessors(0);
     }
@@ -33,6 +33,11 @@ struct BuildQueryPipelineSettings
     DistributedPipelineSettings distributed_settings;
     ContextPtr context;
 
+    /// Sequence number of joins built from this plan so far. Every instance of the same
+    /// plan segment traverses the plan identically, so the counter gives each join a
+    /// deterministic id that matches across instances (used to key shared build tables).
+    mutable size_t next_shared_join_id = 0;
+
     const ExpressionActionsSettings & getActionsSettings() const { return actions_settings; }
 
     static BuildQueryPipelineSettings fromSettings(const Settings & from);
@@ -21,6 +21,7 @@
 #include <Interpreters/ExpressionActions.h>
 #include <Parsers/ASTSerDerHelper.h>
 #include <Processors/QueryPipeline.h>
+#include <Processors/Transforms/AdaptiveBatchingTransform.h>
 #include <Processors/Transforms/ExpressionTransform.h>
 #include <Processors/Transforms/FilterTransform.h>
 #include <Common/JSONBuilder.h>
@@ -113,6 +114,19 @@ void FilterStep::transformPipeline(QueryPipeline & pipeline, const BuildQueryPip
         return std::make_shared<FilterTransform>(header, expression, filter_column_name, remove_filter_column, on_totals);
     });
 
+    const auto & query_settings = settings.context->getSettingsRef();
+    if (query_settings.enable_adaptive_pipeline_batching)
+    {
+        /// A selective filter can leave tiny chunks; merge them back into
+        /// reasonably sized batches so downstream per-block overhead does not dominate.
+        pipeline.addSimpleTransform([&](const Block & header, QueryPipeline::StreamType stream_type) -> ProcessorPtr {
+            if (stream_type != QueryPipeline::StreamType::Main)
+                return nullptr;
+            return std::make_shared<AdaptiveBatchingTransform>(
+                header, query_settings.max_block_size / 2, query_settings.preferred_block_size_bytes);
+        });
+    }
+
     if (!blocksHaveEqualStructure(pipeline.getHeader(), output_stream->header))
     {
         auto convert_actions_dag = ActionsDAG::makeConvertingActions(
@@ -91,6 +91,7 @@ static std::unordered_map<IQueryPlanStep::Type, std::string> NODE_COLORS = {
     {IQueryPlanStep::Type::AssignUniqueId, "bisque"},
     {IQueryPlanStep::Type::CTERef, "orange"},
     {IQueryPlanStep::Type::TopNFiltering, "fuchsia"},
+    {IQueryPlanStep::Type::LateMaterialization, "fuchsia"},
 };
 
 struct PrinterContext
@@ -407,6 +408,15 @@ Void PlanNodePrinter::visitTopNFilteringNode(TopNFilteringNode & node, PrinterCo
     return visitChildren(node, context);
 }
 
+Void PlanNodePrinter::visitLateMaterializationNode(LateMaterializationNode & node, PrinterContext & context)
+{
+    auto step = *node.getStep();
+    String color{NODE_COLORS[step.getType()]};
+    String label{"LateMaterializationNode"};
+    printNode(node, label, StepPrinter::printLateMaterializationStep(step), color, context);
+    return visitChildren(node, context);
+}
+
 void PlanNodePrinter::printNode(
     const PlanNodeBase & node, const String & label, const String & details, const String & color, PrinterContext & context)
 {
@@ -807,6 +817,16 @@ Void PlanSegmentNodePrinter::visitTopNFilteringNode(QueryPlan::Node * node, Prin
     return visitChildren(node, context);
 }
 
+Void PlanSegmentNodePrinter::visitLateMaterializationNode(QueryPlan::Node * node, PrinterContext & context)
+{
+    auto & step_ptr = node->step;
+    auto & step = dynamic_cast<const LateMaterializationStep &>(*step_ptr);
+    String label{"LateMaterializationNode"};
+    String color{NODE_COLORS.at(step_ptr->getType())};
+    printNode(node, label, StepPrinter::printLateMaterializationStep(step), color, context);
+    return visitChildren(node, context);
+}
+
 void PlanSegmentNodePrinter::printNode(
     QueryPlan::Node * node, const String & label, const String & details, const String & color, PrinterContext & context)
 {
@@ -1831,6 +1851,19 @@ String StepPrinter::printTopNFilteringStep(const TopNFilteringStep & step)
     return details.str();
 }
 
+String StepPrinter::printLateMaterializationStep(const LateMaterializationStep & step)
+{
+    std::stringstream details;
+    details << "Table: " << step.getStorageID().getFullTableName() << "\\n";
+    details << "|";
+    details << "Fetch Columns:\\n";
+    for (const auto & item : step.getFetchColumns())
+        details << item.first << ":" << item.second << "\\n";
+    details << "|";
+    details << "Locator: " << step.getPartNameSymbol() << ", " << step.getPartRowNumberSymbol();
+    return details.str();
+}
+
 Void PlanNodeEdgePrinter::visitCTERefNode(CTERefNode & node, Void & c)
 {
     const auto & step = dynamic_cast<const CTERefStep &>(*node.getStep().get());
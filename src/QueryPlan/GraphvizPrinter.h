@@ -74,6 +74,7 @@ public:
     Void visitCTERefNode(CTERefNode & node, PrinterContext & context) override;
     Void visitPartitionTopNNode(PartitionTopNNode & node, PrinterContext & context) override;
     Void visitTopNFilteringNode(TopNFilteringNode & node, PrinterContext & context) override;
+    Void visitLateMaterializationNode(LateMaterializationNode & node, PrinterContext & context) override;
 
 private:
     void printCTEDefNode(CTEId cte_id);
@@ -135,6 +136,7 @@ public:
     Void visitWindowNode(QueryPlan::Node * node, PrinterContext & context) override;
     Void visitPartitionTopNNode(QueryPlan::Node * node, PrinterContext & context) override;
     Void visitTopNFilteringNode(QueryPlan::Node * node, PrinterContext & context) override;
+    Void visitLateMaterializationNode(QueryPlan::Node * node, PrinterContext & context) override;
 
 private:
     std::stringstream & out;
@@ -184,6 +186,7 @@ public:
     static String printCTERefStep(const CTERefStep & node);
     static String printPartitionTopNStep(const PartitionTopNStep & node);
     static String printTopNFilteringStep(const TopNFilteringStep & step);
+    static String printLateMaterializationStep(const LateMaterializationStep & step);
 
 private:
     static String printFilter(const ConstASTPtr & filter);
@@ -145,7 +145,7 @@ ActionsDAGPtr IQueryPlanStep::createExpressionActions(
 {
     PreparedSets prepared_sets;
     SubqueriesForSets subqueries_for_sets;
-    auto settings = context->getSettingsRef();
+    auto & settings = context->getSettingsRef();
     SizeLimits size_limits_for_set(settings.max_rows_in_set, settings.max_bytes_in_set, settings.set_overflow_mode);
     auto actions = std::make_shared<ActionsDAG>(source);
     const NamesAndTypesList aggregation_keys;
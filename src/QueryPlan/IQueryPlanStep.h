@@ -147,7 +147,8 @@ public:
         M(Values) \
         M(Window) \
         M(CTERef) \
-        M(TopNFiltering)
+        M(TopNFiltering) \
+        M(LateMaterialization)
 
 #define ENUM_DEF(ITEM) ITEM,
 
@@ -14,6 +14,8 @@
  */
 
 #include <memory>
+#include <CloudServices/CnchWorkerResource.h>
+#include <Interpreters/GraceHashJoin.h>
 #include <Interpreters/HashJoin.h>
 #include <Interpreters/IJoin.h>
 #include <Interpreters/JoinSwitcher.h>
@@ -115,6 +117,8 @@ JoinPtr JoinStep::makeJoin(ContextPtr context)
         return std::make_shared<HashJoin>(table_join, sample_block);
     else if (table_join->forceMergeJoin() || (table_join->preferMergeJoin() && allow_merge_join))
         return std::make_shared<MergeJoin>(table_join, sample_block);
+    if (settings.enable_grace_hash_join && allow_merge_join)
+        return std::make_shared<GraceHashJoin>(table_join, sample_block, settings.grace_hash_join_buckets);
     return std::make_shared<JoinSwitcher>(table_join, sample_block);
 }
 
@@ -171,7 +175,40 @@ QueryPipelinePtr JoinStep::updatePipeline(QueryPipelines pipelines, const BuildQ
         max_block_size = settings.context->getSettingsRef().max_block_size;
     }
 
-    auto pipeline = QueryPipeline::joinPipelines(std::move(pipelines[0]), std::move(pipelines[1]), join, max_block_size, settings.context->getSettingsRef().join_parallel_left_right, &processors);
+    /// Every instance of a broadcast join segment on a worker receives the same build
+    /// side, so one hash table per worker can serve all local probe pipelines. Only
+    /// safe when the probe never writes into the table: LEFT of any strictness or
+    /// INNER except ANY (ANY INNER marks used rows during probe), and only for plain
+    /// hash joins (JoinSwitcher may switch the algorithm mid-build).
+    SharedJoinBuildStatePtr shared_join_build;
+    bool is_join_builder = true;
+    size_t shared_join_id = settings.next_shared_join_id++;
+    if (settings.context->getSettingsRef().enable_shared_broadcast_join_build
+        && settings.distributed_settings.is_distributed
+        && distribution_type == DistributionType::BROADCAST
+        && (kind == ASTTableJoin::Kind::Left
+            || (kind == ASTTableJoin::Kind::Inner && strictness != ASTTableJoin::Strictness::Any))
+        && join->getType() == JoinType::Hash)
+    {
+        if (auto worker_resource = settings.context->tryGetCnchWorkerResource())
+        {
+            auto key = settings.distributed_settings.query_id + "_"
+                + std::to_string(settings.distributed_settings.plan_segment_id) + "_" + std::to_string(shared_join_id);
+            shared_join_build = worker_resource->getOrCreateSharedJoinBuild(key, join, is_join_builder);
+            if (!is_join_builder)
+                join = shared_join_build->getJoin();
+        }
+    }
+
+    auto pipeline = QueryPipeline::joinPipelines(
+        std::move(pipelines[0]),
+        std::move(pipelines[1]),
+        join,
+        max_block_size,
+        settings.context->getSettingsRef().join_parallel_left_right,
+        &processors,
+        shared_join_build,
+        is_join_builder);
 
     // if NestLoopJoin is choose, no need to add filter stream.
     if (filter && !PredicateUtils::isTruePredicate(filter) && join->getType() != JoinType::NestedLoop)
@@ -321,6 +358,9 @@ QueryPlanStepPtr JoinStep::deserialize(ReadBuffer & buf, ContextPtr context)
             case JoinType::Switcher:
                 join = JoinSwitcher::deserialize(buf, context);
                 break;
+            case JoinType::GraceHash:
+                join = GraceHashJoin::deserialize(buf, context);
+                break;
         }
 
         size_t max_block_size;
@@ -476,6 +516,9 @@ QueryPlanStepPtr FilledJoinStep::deserialize(ReadBuffer & buf, ContextPtr contex
             case JoinType::Switcher:
                 join = JoinSwitcher::deserialize(buf, context);
                 break;
+            case JoinType::GraceHash:
+                join = GraceHashJoin::deserialize(buf, context);
+                break;
         }
     }
 
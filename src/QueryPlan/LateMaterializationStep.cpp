@@ -0,0 +1,99 @@
+#include <QueryPlan/LateMaterializationStep.h>
+
+#include <IO/Operators.h>
+#include <Interpreters/Context.h>
+#include <Interpreters/DatabaseCatalog.h>
+#include <Processors/QueryPipeline.h>
+#include <QueryPlan/PlanSerDerHelper.h>
+#include <Storages/MergeTree/MergeTreeLateMaterializationTransform.h>
+
+namespace DB
+{
+
+LateMaterializationStep::LateMaterializationStep(
+    const DataStream & input_stream_,
+    StorageID storage_id_,
+    NamesWithAliases fetch_columns_,
+    String part_name_symbol_,
+    String part_row_number_symbol_,
+    Block output_header_)
+    : ITransformingStep(input_stream_, std::move(output_header_), {})
+    , storage_id(std::move(storage_id_))
+    , fetch_columns(std::move(fetch_columns_))
+    , part_name_symbol(std::move(part_name_symbol_))
+    , part_row_number_symbol(std::move(part_row_number_symbol_))
+{}
+
+void LateMaterializationStep::setInputStreams(const DataStreams & input_streams_)
+{
+    input_streams = input_streams_;
+}
+
+void LateMaterializationStep::transformPipeline(QueryPipeline & pipeline, const BuildQueryPipelineSettings & build_context)
+{
+    auto storage = DatabaseCatalog::instance().getTable(storage_id, build_context.context);
+    pipeline.addSimpleTransform([&](const Block & header) {
+        return std::make_shared<MergeTreeLateMaterializationTransform>(
+            header,
+            output_stream->header,
+            storage,
+            fetch_columns,
+            part_name_symbol,
+            part_row_number_symbol,
+            build_context.context);
+    });
+}
+
+void LateMaterializationStep::describeActions(FormatSettings & settings) const
+{
+    settings.out << String(settings.offset, ' ') << "Table: " << storage_id.getNameForLogs() << '\n';
+}
+
+void LateMaterializationStep::describeActions(JSONBuilder::JSONMap &) const
+{
+}
+
+void LateMaterializationStep::serialize(WriteBuffer & buffer) const
+{
+    IQueryPlanStep::serializeImpl(buffer);
+    storage_id.serialize(buffer);
+    writeBinary(fetch_columns, buffer);
+    writeBinary(part_name_symbol, buffer);
+    writeBinary(part_row_number_symbol, buffer);
+    serializeBlock(output_stream->header, buffer);
+}
+
+QueryPlanStepPtr LateMaterializationStep::deserialize(ReadBuffer & buffer, ContextPtr context)
+{
+    String step_description;
+    readBinary(step_description, buffer);
+
+    DataStream input_stream = deserializeDataStream(buffer);
+
+    StorageID storage_id = StorageID::deserialize(buffer, context);
+
+    NamesWithAliases fetch_columns;
+    readBinary(fetch_columns, buffer);
+
+    String part_name_symbol;
+    readBinary(part_name_symbol, buffer);
+
+    String part_row_number_symbol;
+    readBinary(part_row_number_symbol, buffer);
+
+    Block output_header = deserializeBlock(buffer);
+
+    auto step = std::make_shared<LateMaterializationStep>(
+        input_stream, storage_id, std::move(fetch_columns), std::move(part_name_symbol), std::move(part_row_number_symbol), std::move(output_header));
+
+    step->setStepDescription(step_description);
+    return step;
+}
+
+std::shared_ptr<IQueryPlanStep> LateMaterializationStep::copy(ContextPtr) const
+{
+    return std::make_shared<LateMaterializationStep>(
+        input_streams[0], storage_id, fetch_columns, part_name_symbol, part_row_number_symbol, output_stream->header);
+}
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <Core/Names.h>
+#include <Interpreters/StorageID.h>
+#include <QueryPlan/ITransformingStep.h>
+
+namespace DB
+{
+
+/// LateMaterializationStep fetches the remaining columns of a top-N query after the
+/// partial sort has selected the winning rows.
+///
+/// It is created together with a narrowed TableScan which reads only the sort-key
+/// columns plus a row locator (the `_part` and `_part_row_number` virtual columns).
+/// Once the partial TopN below has reduced the stream to at most `limit` rows, this
+/// step looks up every surviving row in its part by the locator, reads the columns
+/// listed in fetch_columns and restores the original output header of the scan.
+class LateMaterializationStep : public ITransformingStep
+{
+public:
+    LateMaterializationStep(
+        const DataStream & input_stream_,
+        StorageID storage_id_,
+        NamesWithAliases fetch_columns_,
+        String part_name_symbol_,
+        String part_row_number_symbol_,
+        Block output_header_);
+
+    String getName() const override { return "LateMaterialization"; }
+    Type getType() const override { return Type::LateMaterialization; }
+
+    void setInputStreams(const DataStreams & input_streams_) override;
+    void transformPipeline(QueryPipeline & pipeline, const BuildQueryPipelineSettings &) override;
+    void describeActions(JSONBuilder::JSONMap & map) const override;
+    void describeActions(FormatSettings & settings) const override;
+    void serialize(WriteBuffer &) const override;
+    static QueryPlanStepPtr deserialize(ReadBuffer &, ContextPtr context_ = nullptr);
+    std::shared_ptr<IQueryPlanStep> copy(ContextPtr ptr) const override;
+
+    const StorageID & getStorageID() const { return storage_id; }
+    const NamesWithAliases & getFetchColumns() const { return fetch_columns; }
+    const String & getPartNameSymbol() const { return part_name_symbol; }
+    const String & getPartRowNumberSymbol() const { return part_row_number_symbol; }
+
+private:
+    StorageID storage_id;
+    /// Physical column name in the table -> symbol it has in the output header.
+    NamesWithAliases fetch_columns;
+    /// Symbols of the `_part` and `_part_row_number` virtual columns in the input header.
+    String part_name_symbol;
+    String part_row_number_symbol;
+};
+
+}
@@ -99,7 +99,8 @@ void MergeSortingStep::transformPipeline(QueryPipeline & pipeline, const BuildQu
                 remerge_lowered_memory_bytes_ratio,
                 max_bytes_before_external_sort,
                 tmp_volume,
-                min_free_disk_space);
+                min_free_disk_space,
+                settings.context->getSettingsRef().spill_columnar_format);
     });
 }
 
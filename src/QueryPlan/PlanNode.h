@@ -63,6 +63,7 @@
 #include <QueryPlan/Void.h>
 #include <QueryPlan/WindowStep.h>
 #include <QueryPlan/TopNFilteringStep.h>
+#include <QueryPlan/LateMaterializationStep.h>
 #include <Parsers/IAST_fwd.h>
 
 #include <memory>
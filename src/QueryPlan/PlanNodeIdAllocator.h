@@ -17,6 +17,7 @@
 
 #include <Core/Types.h>
 
+#include <atomic>
 #include <memory>
 
 namespace DB
@@ -36,6 +37,7 @@ public:
     PlanNodeId nextId() { return next_id++; }
 
 private:
-    PlanNodeId next_id;
+    // atomic: the allocator is shared by cascades exploration threads
+    std::atomic<PlanNodeId> next_id;
 };
 }
@@ -70,6 +70,7 @@
 #include <QueryPlan/ValuesStep.h>
 #include <QueryPlan/WindowStep.h>
 #include <QueryPlan/TopNFilteringStep.h>
+#include <QueryPlan/LateMaterializationStep.h>
 #include <Common/ClickHouseRevision.h>
 
 namespace DB
@@ -111,7 +111,7 @@ void QueryCacheStep::init()
         return;
 
     query_cache = context->getQueryCache();
-    auto key = std::make_shared<QueryKey>(queryToString(query_ptr), context->getSettings(), stage);
+    auto key = std::make_shared<QueryKey>(queryToString(query_ptr), context->getSettings(), stage, context->getCurrentDatabase());
     if (query_cache)
     {
         query_key = QueryCache::hash(*key);
@@ -13,11 +13,13 @@
  * limitations under the License.
  */
 
+#include <Interpreters/ExpressionActions.h>
 #include <Processors/Sources/NullSource.h>
 #include <QueryPlan/ReadFromCnchHive.h>
 #include <Storages/Hive/HiveDataSelectExecutor.h>
 #include <Storages/MergeTree/CnchHiveReadPool.h>
 #include <Storages/MergeTree/CnchHiveThreadSelectBlockInputProcessor.h>
+#include <Storages/MergeTree/KeyCondition.h>
 #include <common/scope_guard_safe.h>
 
 namespace DB
@@ -66,9 +68,48 @@ void ReadFromCnchHive::initializePipeline(QueryPipeline & pipeline, const BuildQ
 
     BlocksInDataParts parts_with_row_groups{data_parts.begin(), data_parts.end()};
 
-    auto process = [&](BlocksInDataParts data_parts_with_row_groups, int part_index) {
+    /// One KeyCondition over the WHERE clause shared by all parts; each row group whose
+    /// minmax statistics cannot satisfy it is dropped before scheduling, so pruned
+    /// groups cost neither a read thread nor an HDFS open.
+    std::optional<KeyCondition> blocks_condition;
+    NamesAndTypesList blocks_index_names_and_types;
+    if (data.settings.enable_skip_row_group && query_info.query)
+    {
+        blocks_index_names_and_types = metadata_snapshot->getColumns().getAllPhysical();
+        auto blocks_index_expr = std::make_shared<ExpressionActions>(std::make_shared<ActionsDAG>(blocks_index_names_and_types));
+        blocks_condition.emplace(query_info, context, blocks_index_names_and_types.getNames(), blocks_index_expr);
+        if (blocks_condition->alwaysUnknownOrTrue())
+            blocks_condition.reset();
+    }
+
+    auto process = [&](BlocksInDataParts & data_parts_with_row_groups, int part_index) {
         const auto & part = data_parts[part_index];
-        data_parts_with_row_groups[part_index].total_blocks = part->getTotalBlockNumber();
+        auto & part_with_row_groups = data_parts_with_row_groups[part_index];
+        part_with_row_groups.total_blocks = part->getTotalBlockNumber();
+
+        if (!data.settings.enable_skip_row_group)
+            return;
+
+        /// Splits already filtered out on the server never need to be scheduled either
+        for (const auto & skip_split : part->getSkipSplits())
+        {
+            if (skip_split >= 0 && static_cast<size_t>(skip_split) < part_with_row_groups.total_blocks)
+                part_with_row_groups.skipped_blocks.insert(skip_split);
+        }
+
+        if (blocks_condition && part->getFormat() == HiveDataPart::FileFormat::PARQUET)
+        {
+            part->loadSplitMinMaxIndexes(blocks_index_names_and_types);
+            const auto & split_idxes = part->getSubMinMaxIndexes();
+            for (size_t i = 0; i < split_idxes.size(); ++i)
+            {
+                if (split_idxes[i] && split_idxes[i]->initialized
+                    && !blocks_condition
+                            ->checkInHyperrectangle(split_idxes[i]->hyperrectangle, blocks_index_names_and_types.getTypes())
+                            .can_be_true)
+                    part_with_row_groups.skipped_blocks.insert(static_cast<Int64>(i));
+            }
+        }
     };
 
     size_t num_threads = std::min(size_t(num_streams), data_parts.size());
@@ -116,13 +157,18 @@ Pipe ReadFromCnchHive::spreadRowGroupsAmongStreams(
     const UInt64 & /*max_block_size*/)
 {
     size_t sum_row_groups = 0;
+    size_t sum_skipped_row_groups = 0;
     std::vector<size_t> sum_row_groups_in_parts(parts.size());
     for (size_t i = 0; i < parts.size(); ++i)
     {
-        sum_row_groups_in_parts[i] = parts[i].data_part->getTotalBlockNumber();
+        sum_row_groups_in_parts[i] = parts[i].total_blocks - parts[i].skipped_blocks.size();
         sum_row_groups += sum_row_groups_in_parts[i];
+        sum_skipped_row_groups += parts[i].skipped_blocks.size();
     }
 
+    if (sum_skipped_row_groups)
+        LOG_DEBUG(log, "Pruned {} of {} row groups by statistics", sum_skipped_row_groups, sum_row_groups + sum_skipped_row_groups);
+
     Pipes res;
     size_t max_threads = data.settings.max_read_row_group_threads;
 
@@ -146,6 +192,9 @@ Pipe ReadFromCnchHive::spreadRowGroupsAmongStreams(
         CnchHiveReadPoolPtr pool
             = std::make_shared<CnchHiveReadPool>(num_streams, sum_row_groups, std::move(parts), data, metadata_snapshot, column_names);
 
+        if (data.settings.max_hive_file_prefetch_threads)
+            pool->prefetchFirstWave(context);
+
         for (size_t i = 0; i < num_streams; ++i)
         {
             res.emplace_back(
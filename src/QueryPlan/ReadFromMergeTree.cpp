@@ -73,10 +73,13 @@ static MergeTreeReaderSettings getMergeTreeReaderSettings(const ContextPtr & con
     return {
         .min_bytes_to_use_direct_io = settings.min_bytes_to_use_direct_io,
         .min_bytes_to_use_mmap_io = settings.min_bytes_to_use_mmap_io,
+        .min_bytes_to_use_aio_for_disk_cache = settings.min_bytes_to_use_aio_for_disk_cache,
         .mmap_cache = context->getMMappedFileCache(),
         .max_read_buffer_size = settings.max_read_buffer_size,
         .save_marks_in_cache = true,
         .checksum_on_read = settings.checksum_on_read,
+        .use_content_addressed_uncompressed_cache = settings.use_content_addressed_uncompressed_cache,
+        .enable_adaptive_prewhere_conjuncts = settings.enable_adaptive_prewhere_conjuncts,
     };
 }
 
@@ -241,7 +244,9 @@ Pipe ReadFromMergeTree::readFromPool(
         required_columns,
         backoff_settings,
         settings.preferred_block_size_bytes,
-        false);
+        false,
+        settings.enable_shared_scan_cache,
+        settings.enable_scan_quota_fairness);
 
     auto * logger = &Poco::Logger::get(data.getLogName() + " (SelectExecutor)");
     LOG_DEBUG(logger, "Reading approx. {} rows with {} streams", total_rows, max_streams);
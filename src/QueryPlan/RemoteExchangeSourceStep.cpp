@@ -22,10 +22,9 @@
 #include <Interpreters/DistributedStages/PlanSegment.h>
 #include <Processors/Exchange/DataTrans/BroadcastSenderProxy.h>
 #include <Processors/Exchange/DataTrans/BroadcastSenderProxyRegistry.h>
-#include <Processors/Exchange/DataTrans/Brpc/BrpcRemoteBroadcastReceiver.h>
 #include <Processors/Exchange/DataTrans/DataTrans_fwd.h>
+#include <Processors/Exchange/DataTrans/ExchangeTransportFactory.h>
 #include <Processors/Exchange/DataTrans/IBroadcastReceiver.h>
-#include <Processors/Exchange/DataTrans/Local/LocalBroadcastChannel.h>
 #include <Processors/Exchange/DataTrans/Local/LocalChannelOptions.h>
 #include <Processors/Exchange/DeserializeBufTransform.h>
 #include <Processors/Exchange/ExchangeDataKey.h>
@@ -111,6 +110,7 @@ void RemoteExchangeSourceStep::initializePipeline(QueryPipeline & pipeline, cons
     Pipe pipe;
 
     size_t source_num = 0;
+    bool has_remote_receiver = false;
     bool keep_order = context->getSettingsRef().exchange_enable_force_keep_order;
     if (!keep_order)
     {
@@ -142,55 +142,32 @@ void RemoteExchangeSourceStep::initializePipeline(QueryPipeline & pipeline, cons
 
         size_t partition_id_start = (input->getParallelIndex() - 1) * exchange_parallel_size + 1;
         LocalChannelOptions local_options{
-            .queue_size = context->getSettingsRef().exchange_local_receiver_queue_size, .max_timeout_ms = options.exhcange_timeout_ms};
+            .queue_size = context->getSettingsRef().exchange_local_receiver_queue_size,
+            .max_timeout_ms = options.exhcange_timeout_ms,
+            .queue_bytes_limit = context->getSettingsRef().exchange_queue_bytes_limit};
         if (input->getSourceAddress().empty())
             throw Exception("No source address!", ErrorCodes::LOGICAL_ERROR);
         bool is_final_plan_segment = plan_segment_id == 0;
         for (const auto & source_address : input->getSourceAddress())
         {
-            auto write_address_info = extractExchangeHostPort(source_address);
             for (size_t i = 0; i < exchange_parallel_size; ++i)
             {
                 size_t partition_id = partition_id_start + i;
                 ExchangeDataKeyPtr data_key = std::make_shared<ExchangeDataKey>(
                     query_id, exchange_id, partition_id, coordinator_address);
-                BroadcastReceiverPtr receiver;
-                if (ExchangeUtils::isLocalExchange(read_address_info, source_address))
-                {
-                    if (!options.force_remote_mode)
-                    {
-                        LOG_DEBUG(logger, "Create local exchange source : {}@{} for plansegment {}->{}",
-                                  data_key->dump(), write_address_info, write_plan_segment_id, plan_segment_id);
-                        std::shared_ptr<QueryExchangeLog> query_exchange_log = nullptr;
-                        if (context->getSettingsRef().log_query_exchange && context->getQueryExchangeLog())
-                            query_exchange_log = context->getQueryExchangeLog();
-                        String name = LocalBroadcastChannel::generateName(
-                            query_id, exchange_id, write_plan_segment_id, plan_segment_id, partition_id);
-                        auto local_channel = std::make_shared<LocalBroadcastChannel>(data_key, local_options, name, query_exchange_log);
-                        receiver = std::dynamic_pointer_cast<IBroadcastReceiver>(local_channel);
-                    }
-                    else
-                    {
-                        String localhost_address = context->getHostWithPorts().getExchangeAddress();
-                        LOG_DEBUG(logger, "Force local exchange use remote source : {}@{} for plansegment {}->{}",
-                                  data_key->dump(), localhost_address, write_plan_segment_id, plan_segment_id);
-                        String name = BrpcRemoteBroadcastReceiver::generateName(
-                            query_id, exchange_id, write_plan_segment_id, plan_segment_id, partition_id);
-                        auto brpc_receiver = std::make_shared<BrpcRemoteBroadcastReceiver>(
-                            std::move(data_key), localhost_address, context, exchange_header, keep_order, name);
-                        receiver = std::dynamic_pointer_cast<IBroadcastReceiver>(brpc_receiver);
-                    }
-                }
-                else
-                {
-                    LOG_DEBUG(logger, "Create remote exchange source : {}@{} for plansegment {}->{}",
-                              data_key->dump(), write_address_info, write_plan_segment_id, plan_segment_id);
-                    String name = BrpcRemoteBroadcastReceiver::generateName(
-                        query_id, exchange_id, write_plan_segment_id, plan_segment_id, partition_id);
-                    auto brpc_receiver = std::make_shared<BrpcRemoteBroadcastReceiver>(
-                        std::move(data_key), write_address_info, context, exchange_header, keep_order, name);
-                    receiver = std::dynamic_pointer_cast<IBroadcastReceiver>(brpc_receiver);
-                }
+                BroadcastReceiverPtr receiver = ExchangeTransportFactory::createReceiver(
+                    context,
+                    std::move(data_key),
+                    read_address_info,
+                    source_address,
+                    exchange_header,
+                    keep_order,
+                    local_options,
+                    options,
+                    write_plan_segment_id,
+                    plan_segment_id);
+                if (receiver->getReceiverType() != BroadcastReceiverType::Local)
+                    has_remote_receiver = true;
                 auto source = std::make_shared<ExchangeSource>(source_header, std::move(receiver), options, is_final_plan_segment);
                 pipe.addSource(std::move(source));
                 source_num++;
@@ -202,8 +179,15 @@ void RemoteExchangeSourceStep::initializePipeline(QueryPipeline & pipeline, cons
     if (!keep_order)
     {
         pipeline.resize(context->getSettingsRef().exchange_source_pipeline_threads);
-        pipeline.addSimpleTransform([enable_compress = context->getSettingsRef().exchange_enable_block_compress, header = exchange_header](
-                                        const Block &) { return std::make_shared<DeserializeBufTransform>(header, enable_compress); });
+        /// Local channels hand over Chunks directly, only brpc receivers enqueue
+        /// serialized IOBuf blocks, so a fully local exchange can skip the
+        /// deserialize stage entirely
+        if (has_remote_receiver)
+            pipeline.addSimpleTransform([enable_compress = context->getSettingsRef().exchange_enable_block_compress,
+                                         parallel_threads = context->getSettingsRef().exchange_parallel_deserialize_threads,
+                                         header = exchange_header](const Block &) {
+                return std::make_shared<DeserializeBufTransform>(header, enable_compress, parallel_threads);
+            });
     }
     LOG_DEBUG(logger, "Total exchange source : {}, keep_order: {}", source_num, keep_order);
     pipeline.setMinThreads(source_num);
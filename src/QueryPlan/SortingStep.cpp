@@ -112,7 +112,8 @@ void SortingStep::transformPipeline(QueryPipeline & pipeline, const BuildQueryPi
                                         local_settings.remerge_sort_lowered_memory_bytes_ratio,
                                         local_settings.max_bytes_before_external_sort,
                                         settings.context->getTemporaryVolume(),
-                                        local_settings.min_free_disk_space_for_temporary_data);
+                                        local_settings.min_free_disk_space_for_temporary_data,
+                                        local_settings.spill_columnar_format);
                                 });
     if (!partial)
     {
@@ -38,6 +38,8 @@ String SymbolAllocator::newSymbol(String name_hint)
         }
     }
 
+    std::lock_guard lock(mutex);
+
     if (next_ids.find(name_hint) == next_ids.end())
         next_ids[name_hint] = 1;
 
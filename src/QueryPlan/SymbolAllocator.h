@@ -19,6 +19,7 @@
 #include <Parsers/IAST.h>
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -34,6 +35,8 @@ public:
     String newSymbol(const ASTPtr & expression);
 
 private:
+    // the allocator is shared by cascades exploration threads
+    std::mutex mutex;
     std::unordered_set<String> symbols;
     std::unordered_map<String, UInt32> next_ids;
 };
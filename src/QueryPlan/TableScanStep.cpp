@@ -742,7 +742,7 @@ ASTPtr TableScanExecutor::rewriteExpr(ASTPtr expr, ProjectionMatchContext & cand
 
 void TableScanStep::makeSetsForIndex(const ASTPtr & node, ContextPtr context, PreparedSets & prepared_sets) const
 {
-    auto settings = context->getSettingsRef();
+    auto & settings = context->getSettingsRef();
     SizeLimits size_limits_for_set(settings.max_rows_in_set, settings.max_bytes_in_set, settings.set_overflow_mode);
 
     if (!node || !storage || !storage->supportsIndexForIn())
@@ -996,10 +996,23 @@ void TableScanStep::initializePipeline(QueryPipeline & pipeline, const BuildQuer
 
     rewriteInForBucketTable(build_context.context);
     auto * query = query_info.query->as<ASTSelectQuery>();
+    std::vector<ConstASTPtr> runtime_bloom_filters;
     if (auto where = query->getWhere())
-        query->setExpression(ASTSelectQuery::Expression::WHERE, rewriteDynamicFilter(where, pipeline, build_context));
+        query->setExpression(ASTSelectQuery::Expression::WHERE, rewriteDynamicFilter(where, pipeline, build_context, runtime_bloom_filters));
     if (auto prewhere = query->getPrewhere())
-        query->setExpression(ASTSelectQuery::Expression::PREWHERE, rewriteDynamicFilter(prewhere, pipeline, build_context));
+        query->setExpression(
+            ASTSelectQuery::Expression::PREWHERE, rewriteDynamicFilter(prewhere, pipeline, build_context, runtime_bloom_filters));
+
+    /// Put runtime bloom filters from the join build side into PREWHERE, so that
+    /// MergeTreeRangeReader evaluates them right after the key columns are read and
+    /// skips the remaining columns of granules whose keys cannot match the build side.
+    if (!runtime_bloom_filters.empty())
+    {
+        auto target = storage->supportsPrewhere() ? ASTSelectQuery::Expression::PREWHERE : ASTSelectQuery::Expression::WHERE;
+        if (auto existing = (target == ASTSelectQuery::Expression::PREWHERE) ? query->getPrewhere() : query->getWhere())
+            runtime_bloom_filters.push_back(existing);
+        query->setExpression(target, PredicateUtils::combineConjuncts(runtime_bloom_filters));
+    }
 
     // todo support _shard_num rewrite
     // if ()
@@ -1692,8 +1705,11 @@ size_t TableScanStep::getMaxBlockSize() const
     return max_block_size;
 }
 
-ASTPtr
-TableScanStep::rewriteDynamicFilter(const ASTPtr & filter, QueryPipeline & pipeline, const BuildQueryPipelineSettings & build_context)
+ASTPtr TableScanStep::rewriteDynamicFilter(
+    const ASTPtr & filter,
+    QueryPipeline & pipeline,
+    const BuildQueryPipelineSettings & build_context,
+    std::vector<ConstASTPtr> & bloom_filters)
 {
     if (!filter)
         return nullptr;
@@ -1720,6 +1736,21 @@ TableScanStep::rewriteDynamicFilter(const ASTPtr & filter, QueryPipeline & pipel
                 "TableScan");
             predicates.insert(predicates.end(), dynamic_filters.begin(), dynamic_filters.end());
         }
+        else if (
+            description.type == DynamicFilterType::BloomFilter
+            && build_context.context->getSettingsRef().enable_runtime_bloom_filter_in_prewhere)
+        {
+            /// bloomFilterExist() degrades to constant `1` until the build side has
+            /// published the filter, so it is safe to evaluate during the scan.
+            auto dynamic_filters = DynamicFilters::createDynamicFilterRuntime(
+                description,
+                build_context.context->getInitialQueryId(),
+                build_context.distributed_settings.plan_segment_id,
+                build_context.context->getSettingsRef().wait_runtime_filter_timeout,
+                RuntimeFilterManager::getInstance(),
+                "TableScan");
+            bloom_filters.insert(bloom_filters.end(), dynamic_filters.begin(), dynamic_filters.end());
+        }
     }
 
     return PredicateUtils::combineConjuncts(predicates);
@@ -159,7 +159,14 @@ private:
 
     // Optimises the where clauses for a bucket table by rewriting the IN clause and hence reducing the IN set size
     void rewriteInForBucketTable(ContextPtr context) const;
-    static ASTPtr rewriteDynamicFilter(const ASTPtr & filter, QueryPipeline & pipeline, const BuildQueryPipelineSettings & build_context);
+    /// Bloom filter predicates built from the join build side are collected into
+    /// `bloom_filters` so the caller can put them into PREWHERE regardless of where
+    /// the dynamic filter originally sat.
+    static ASTPtr rewriteDynamicFilter(
+        const ASTPtr & filter,
+        QueryPipeline & pipeline,
+        const BuildQueryPipelineSettings & build_context,
+        std::vector<ConstASTPtr> & bloom_filters);
     void aliasColumns(QueryPipeline & pipeline, const BuildQueryPipelineSettings &);
     void setQuotaAndLimits(QueryPipeline & pipeline, const SelectQueryOptions & options, const BuildQueryPipelineSettings &);
 };
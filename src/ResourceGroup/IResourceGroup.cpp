@@ -17,9 +17,11 @@
 #include <Core/Settings.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/Context_fwd.h>
+#include <Interpreters/ResourceGroupAdmissionLog.h>
 #include <ResourceGroup/IResourceGroup.h>
 #include <ResourceGroup/VWResourceGroupManager.h>
 #include <Interpreters/ProcessList.h>
+#include <Common/Stopwatch.h>
 #include <chrono>
 
 namespace ProfileEvents
@@ -77,25 +79,69 @@ void IResourceGroup::queryFinished(IResourceGroup::Container::iterator it)
 IResourceGroup::Container::iterator IResourceGroup::run(const String & query, const Context & query_context)
 {
     std::unique_lock lock(root->mutex);
+    const auto & settings = query_context.getSettingsRef();
+    auto estimated_bytes = static_cast<Int64>(settings.query_estimated_memory_bytes);
     bool canRun = true;
     bool canQueue = true;
+    bool hasSlot = true;
     IResourceGroup *group = this;
     while (group)
     {
         canRun &= group->canRunMore();
         canQueue &= group->canQueueMore();
+        hasSlot &= group->hasRunSlot();
         group = group->parent;
     }
+    /// Record the admission decision together with the slot state it was based on;
+    /// root->mutex is held at every call site, so the counters are consistent.
+    auto log_admission = [&](ResourceGroupAdmissionLogElement::Outcome outcome, UInt64 wait_ms)
+    {
+        auto admission_log = query_context.getResourceGroupAdmissionLog();
+        if (!admission_log)
+            return;
+        try
+        {
+            ResourceGroupAdmissionLogElement log_element;
+            log_element.event_time = time(nullptr);
+            log_element.query_id = query_context.getCurrentQueryId();
+            log_element.group = name;
+            log_element.outcome = outcome;
+            log_element.wait_ms = wait_ms;
+            log_element.running_queries = running_queries.size() + descendent_running_queries;
+            log_element.queued_queries = queued_queries.size() + descendent_queued_queries;
+            log_element.max_concurrent_queries = max_concurrent_queries;
+            log_element.max_queued = max_queued;
+            log_element.cached_memory_usage_bytes = cached_memory_usage_bytes;
+            log_element.estimated_memory_bytes = std::max(min_query_memory_usage, estimated_bytes);
+            admission_log->add(log_element);
+        }
+        catch (...)
+        {
+            tryLogCurrentException("IResourceGroup");
+        }
+    };
+    /// A query the optimizer expects to stay within the per-query floor cannot meaningfully
+    /// grow the byte budget, so let it through on a free slot even when the budget is used
+    /// up; cheap queries then do not queue behind a single huge scan.
+    if (!canRun && hasSlot && estimated_bytes != 0 && estimated_bytes <= min_query_memory_usage)
+        canRun = true;
     if (!canQueue && !canRun)
     {
         ProfileEvents::increment(ProfileEvents::InsufficientConcurrencyQuery);
+        log_admission(ResourceGroupAdmissionLogElement::REJECTED, 0);
         throw Exception("The resource is not enough for group " + name, ErrorCodes::RESOURCE_NOT_ENOUGH);
     }
     IResourceGroup::Element element = std::make_shared<IResourceGroup::QueryEntity>(this, query, query_context);
+    element->estimated_memory_bytes = std::max(min_query_memory_usage, estimated_bytes);
     if (canRun)
-        return runQuery(element);
+    {
+        auto running_it = runQuery(element);
+        log_admission(ResourceGroupAdmissionLogElement::RUN_IMMEDIATELY, 0);
+        return running_it;
+    }
     auto it = enqueueQuery(element);
 
+    Stopwatch wait_watch;
     if (!root->can_run.wait_for(lock,
                                 std::chrono::milliseconds(max_queued_waiting_ms), [&]{ return element->status_type != QueryStatusType::WAITING;}))
     {
@@ -107,11 +153,13 @@ IResourceGroup::Container::iterator IResourceGroup::run(const String & query, co
             desc_group = desc_group->parent;
         }
         ProfileEvents::increment(ProfileEvents::InsufficientConcurrencyQuery);
+        log_admission(ResourceGroupAdmissionLogElement::TIMED_OUT, wait_watch.elapsedMilliseconds());
         throw Exception("Waiting for resource timeout in " + name, ErrorCodes::WAIT_FOR_RESOURCE_TIMEOUT);
     }
     auto res = std::find(running_queries.begin(), running_queries.end(), element);
     if (res == running_queries.end())
         throw Exception("The running query can not be found in the resource group " + name, ErrorCodes::RESOURCE_GROUP_INTERNAL_ERROR);
+    log_admission(ResourceGroupAdmissionLogElement::DEQUEUED, wait_watch.elapsedMilliseconds());
     return res;
 }
 
@@ -136,12 +184,13 @@ IResourceGroup::Container::iterator IResourceGroup::runQuery(IResourceGroup::Ele
     element->query_status = nullptr;
     Container::iterator it = running_queries.emplace(running_queries.end(), element);
     element->status_type = QueryStatusType::RUNNING;
-    cached_memory_usage_bytes += min_query_memory_usage;
+    Int64 charged_bytes = std::max(min_query_memory_usage, element->estimated_memory_bytes);
+    cached_memory_usage_bytes += charged_bytes;
     IResourceGroup *group = parent;
     while (group)
     {
         ++group->descendent_running_queries;
-        group->cached_memory_usage_bytes += min_query_memory_usage;
+        group->cached_memory_usage_bytes += charged_bytes;
         group = group->parent;
 
         group->setInUse(true);
@@ -167,7 +216,10 @@ void IResourceGroup::internalRefreshStats()
         queryMemoryUsage = 0;
         if (query->query_status != nullptr)
             queryMemoryUsage = query->query_status->getUsedMemory();
-        newCacheMemoryUsage += queryMemoryUsage < min_query_memory_usage ? min_query_memory_usage : queryMemoryUsage;
+        /// Keep the optimizer estimate as the floor while the query runs: actual usage
+        /// starts near zero, and releasing the budget early would over-admit.
+        Int64 floor_bytes = std::max(min_query_memory_usage, query->estimated_memory_bytes);
+        newCacheMemoryUsage += queryMemoryUsage < floor_bytes ? floor_bytes : queryMemoryUsage;
     }
     for (const auto & item : children)
     {
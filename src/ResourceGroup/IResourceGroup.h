@@ -96,6 +96,9 @@ public:
         QueryStatusType status_type = QueryStatusType::WAITING;
         Int32 id;
         UInt64 queue_timestamp;
+        /// Optimizer estimate of the query's peak memory, floored at the group's
+        /// min_query_memory_usage; charged against the group's byte budget while running
+        Int64 estimated_memory_bytes = 0;
         /// set after run
         QueryStatus * query_status;
     };
@@ -118,10 +121,15 @@ public:
     using Handle = std::shared_ptr<QueryEntityHandler>;
 
     virtual ResourceGroupType getType() const = 0;
-    virtual bool canRunMore() const = 0;
+    /// Whether a concurrency slot is free, ignoring the memory budget
+    virtual bool hasRunSlot() const = 0;
     virtual bool canQueueMore() const = 0;
     virtual ~IResourceGroup() {}
 
+    /// Whether the in-flight byte budget still has room
+    bool hasMemoryBudget() const { return soft_max_memory_usage == 0 || cached_memory_usage_bytes < soft_max_memory_usage; }
+    bool canRunMore() const { return hasRunSlot() && hasMemoryBudget(); }
+
     std::lock_guard<std::mutex> getLock() const {return std::lock_guard<std::mutex>(root->mutex);}
 
     Container::iterator run(const String & query, const Context & query_context);
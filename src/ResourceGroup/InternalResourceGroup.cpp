@@ -33,10 +33,9 @@ namespace ErrorCodes
     extern const int RESOURCE_GROUP_INTERNAL_ERROR;
 }
 
-bool InternalResourceGroup::canRunMore() const
+bool InternalResourceGroup::hasRunSlot() const
 {
-    return (max_concurrent_queries == 0 || static_cast<Int32>(running_queries.size()) + descendent_running_queries < max_concurrent_queries)
-        && (soft_max_memory_usage == 0 || cached_memory_usage_bytes < soft_max_memory_usage);
+    return max_concurrent_queries == 0 || static_cast<Int32>(running_queries.size()) + descendent_running_queries < max_concurrent_queries;
 }
 
 bool InternalResourceGroup::canQueueMore() const
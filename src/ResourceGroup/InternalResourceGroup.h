@@ -25,7 +25,7 @@ class InternalResourceGroup : public IResourceGroup
 public:
 
     ResourceGroupType getType() const override { return DB::ResourceGroupType::Internal; }
-    bool canRunMore() const override;
+    bool hasRunSlot() const override;
     bool canQueueMore() const override;
 
     void initCpu();
@@ -70,7 +70,7 @@ Int32 VWResourceGroup::getNumServers() const
     return current_topology.back().getServerSize();
 }
 
-bool VWResourceGroup::canRunMore() const
+bool VWResourceGroup::hasRunSlot() const
 {
     auto resource_group_mgr = getContext()->tryGetResourceGroupManager();
     if (!resource_group_mgr)
@@ -101,9 +101,8 @@ bool VWResourceGroup::canRunMore() const
             logged = true;
         }
         Int64 current_running_queries = running_queries.size();
-        return (max_concurrent_queries == 0 ||
-                (current_running_queries < std::ceil(double (max_concurrent_queries) / getNumServers())))
-        && (soft_max_memory_usage == 0 || cached_memory_usage_bytes < soft_max_memory_usage);
+        return max_concurrent_queries == 0 ||
+                (current_running_queries < std::ceil(double (max_concurrent_queries) / getNumServers()));
     }
     else
     {
@@ -135,10 +134,9 @@ bool VWResourceGroup::canRunMore() const
             running_limit_debug_logged = false;
         }
 
-        return (max_concurrent_queries == 0 ||
+        return max_concurrent_queries == 0 ||
             current_running_queries - last_sync_info.running_query_count <
-                std::ceil((double(max_concurrent_queries) - agg_queue_info.running_query_count) / getNumServers()))
-            && (soft_max_memory_usage == 0 || cached_memory_usage_bytes < soft_max_memory_usage);
+                std::ceil((double(max_concurrent_queries) - agg_queue_info.running_query_count) / getNumServers());
     }
 }
 
@@ -36,7 +36,7 @@ public:
     VWResourceGroup(ContextPtr context_);
 
     ResourceGroupType getType() const override { return DB::ResourceGroupType::VirtualWarehouse; }
-    bool canRunMore() const override;
+    bool hasRunSlot() const override;
     bool canQueueMore() const override;
 
     void setSyncExpiry(Int64 expiry) { sync_expiry = expiry; }
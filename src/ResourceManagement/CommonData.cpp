@@ -62,6 +62,10 @@ void VirtualWarehouseSettings::fillProto(Protos::VirtualWarehouseSettings & pb_s
         pb_settings.set_cooldown_seconds_after_auto_link(cooldown_seconds_after_auto_link);
     if (cooldown_seconds_after_auto_unlink)
         pb_settings.set_cooldown_seconds_after_auto_unlink(cooldown_seconds_after_auto_unlink);
+    if (!spillover_vw.empty())
+        pb_settings.set_spillover_vw(spillover_vw);
+    if (max_spillover_concurrent_queries)
+        pb_settings.set_max_spillover_concurrent_queries(max_spillover_concurrent_queries);
 }
 
 void VirtualWarehouseSettings::parseFromProto(const Protos::VirtualWarehouseSettings & pb_settings)
@@ -86,6 +90,8 @@ void VirtualWarehouseSettings::parseFromProto(const Protos::VirtualWarehouseSett
     mem_threshold_for_recall = pb_settings.mem_threshold_for_recall();
     cooldown_seconds_after_auto_link = pb_settings.cooldown_seconds_after_auto_link();
     cooldown_seconds_after_auto_unlink = pb_settings.cooldown_seconds_after_auto_unlink();
+    spillover_vw = pb_settings.spillover_vw();
+    max_spillover_concurrent_queries = pb_settings.max_spillover_concurrent_queries();
 }
 
 void VirtualWarehouseAlterSettings::fillProto(Protos::VirtualWarehouseAlterSettings & pb_settings) const
@@ -130,6 +136,10 @@ void VirtualWarehouseAlterSettings::fillProto(Protos::VirtualWarehouseAlterSetti
         pb_settings.set_cooldown_seconds_after_auto_link(*cooldown_seconds_after_auto_link);
     if (cooldown_seconds_after_auto_unlink)
         pb_settings.set_cooldown_seconds_after_auto_unlink(*cooldown_seconds_after_auto_unlink);
+    if (spillover_vw)
+        pb_settings.set_spillover_vw(*spillover_vw);
+    if (max_spillover_concurrent_queries)
+        pb_settings.set_max_spillover_concurrent_queries(*max_spillover_concurrent_queries);
 }
 
 void VirtualWarehouseAlterSettings::parseFromProto(const Protos::VirtualWarehouseAlterSettings & pb_settings)
@@ -174,6 +184,10 @@ void VirtualWarehouseAlterSettings::parseFromProto(const Protos::VirtualWarehous
         cooldown_seconds_after_auto_link = pb_settings.cooldown_seconds_after_auto_link();
     if (pb_settings.has_cooldown_seconds_after_auto_unlink())
         cooldown_seconds_after_auto_unlink = pb_settings.cooldown_seconds_after_auto_unlink();
+    if (pb_settings.has_spillover_vw())
+        spillover_vw = pb_settings.spillover_vw();
+    if (pb_settings.has_max_spillover_concurrent_queries())
+        max_spillover_concurrent_queries = pb_settings.max_spillover_concurrent_queries();
 }
 
 void VirtualWarehouseData::fillProto(Protos::VirtualWarehouseData & pb_data) const
@@ -271,6 +285,8 @@ void WorkerNodeResourceData::parseFromString(const std::string & s)
     memory_available = pb_data.memory_available();
     disk_space = pb_data.disk_space();
     query_num = pb_data.query_num();
+    if (pb_data.has_io_usage())
+        io_usage = pb_data.io_usage();
     cpu_limit = pb_data.cpu_limit();
     memory_limit = pb_data.memory_limit();
     last_update_time = pb_data.last_update_time();
@@ -291,6 +307,7 @@ void WorkerNodeResourceData::fillProto(Protos::WorkerNodeResourceData & resource
     resource_info.set_memory_available(memory_available);
     resource_info.set_disk_space(disk_space);
     resource_info.set_query_num(query_num);
+    resource_info.set_io_usage(io_usage);
 
     if (cpu_limit && memory_limit)
     {
@@ -314,6 +331,8 @@ void WorkerNodeResourceData::fillProto(Protos::WorkerNodeResourceData & resource
     if (register_time)
         resource_info.set_register_time(register_time);
     resource_info.set_state(static_cast<uint32_t>(state));
+    if (seq_no)
+        resource_info.set_seq_no(seq_no);
 }
 
 WorkerNodeResourceData WorkerNodeResourceData::createFromProto(const Protos::WorkerNodeResourceData & resource_info)
@@ -328,6 +347,9 @@ WorkerNodeResourceData WorkerNodeResourceData::createFromProto(const Protos::Wor
     res.disk_space = resource_info.disk_space();
     res.query_num = resource_info.query_num();
 
+    if (resource_info.has_io_usage())
+        res.io_usage = resource_info.io_usage();
+
     if (resource_info.has_cpu_limit())
         res.cpu_limit = resource_info.cpu_limit();
     if (resource_info.has_memory_limit())
@@ -349,6 +371,8 @@ WorkerNodeResourceData WorkerNodeResourceData::createFromProto(const Protos::Wor
     if (resource_info.has_register_time())
         res.register_time = resource_info.register_time();
     res.state = WorkerState(resource_info.state());
+    if (resource_info.has_seq_no())
+        res.seq_no = resource_info.seq_no();
 
     return res;
 }
@@ -473,6 +497,9 @@ void WorkerGroupData::fillProto(Protos::WorkerGroupData & pb_data, const bool wi
     pb_data.set_is_auto_linked(is_auto_linked);
     if (!linked_vw_name.empty())
         pb_data.set_linked_vw_name(linked_vw_name);
+
+    if (is_spillover)
+        pb_data.set_is_spillover(is_spillover);
 }
 
 void WorkerGroupData::parseFromProto(const Protos::WorkerGroupData & pb_data)
@@ -501,6 +528,9 @@ void WorkerGroupData::parseFromProto(const Protos::WorkerGroupData & pb_data)
 
     if (pb_data.has_linked_vw_name())
         linked_vw_name = pb_data.linked_vw_name();
+
+    if (pb_data.has_is_spillover())
+        is_spillover = pb_data.is_spillover();
 }
 
 void QueryQueueInfo::fillProto(Protos::QueryQueueInfo & pb_data) const
@@ -70,6 +70,10 @@ struct VirtualWarehouseSettings
     size_t mem_threshold_for_recall{100};
     size_t cooldown_seconds_after_auto_link{300};
     size_t cooldown_seconds_after_auto_unlink{300};
+    /// Overflow queries are routed to this vw when all own groups are saturated, empty - disabled
+    std::string spillover_vw;
+    /// Cap of concurrent queries the spillover target accepts from this vw, 0 - no cap
+    size_t max_spillover_concurrent_queries{0};
 
 
     void fillProto(Protos::VirtualWarehouseSettings & pb_settings) const;
@@ -105,6 +109,8 @@ struct VirtualWarehouseAlterSettings
     std::optional<size_t> mem_threshold_for_recall;
     std::optional<size_t> cooldown_seconds_after_auto_link;
     std::optional<size_t> cooldown_seconds_after_auto_unlink;
+    std::optional<std::string> spillover_vw;
+    std::optional<size_t> max_spillover_concurrent_queries;
 
     void fillProto(Protos::VirtualWarehouseAlterSettings & pb_settings) const;
     void parseFromProto(const Protos::VirtualWarehouseAlterSettings & pb_settings);
@@ -193,6 +199,8 @@ struct WorkerNodeResourceData
     UInt64 memory_available;
     UInt64 disk_space;
     UInt32 query_num;
+    /// Busiest local disk utilization in percents. Used to place I/O-heavy tasks (e.g. merges) by headroom.
+    double io_usage{0};
 
     UInt64 cpu_limit;
     UInt64 memory_limit;
@@ -206,6 +214,9 @@ struct WorkerNodeResourceData
     UInt32 reserved_cpu_cores;
     WorkerState state;
 
+    /// Monotonic per worker so that a delayed heartbeat cannot overwrite a fresher one
+    UInt64 seq_no{0};
+
     std::string serializeAsString() const;
     void parseFromString(const std::string & s);
 
@@ -227,6 +238,7 @@ struct WorkerNodeResourceData
         << ", cpu_usage:" << cpu_usage
         << ", memory_usage:" << memory_usage
         << ", memory_available:" << memory_available
+        << ", io_usage:" << io_usage
         << ", query_num:" << query_num
         << " }";
         return ss.str();
@@ -366,6 +378,9 @@ struct WorkerGroupData
     bool is_auto_linked {false};
     std::string linked_vw_name;
 
+    /// The group was picked by spillover scheduling, it is not part of the query's own vw
+    bool is_spillover {false};
+
     std::string serializeAsString() const;
     void parseFromString(const std::string & s);
 
@@ -56,6 +56,11 @@ static inline bool cmp_worker_disk(const WorkerNodePtr & a, const WorkerNodePtr
     return a->disk_space.load(std::memory_order_relaxed) > b->disk_space.load(std::memory_order_relaxed);
 }
 
+static inline bool cmp_worker_io(const WorkerNodePtr & a, const WorkerNodePtr & b)
+{
+    return a->io_usage.load(std::memory_order_relaxed) < b->io_usage.load(std::memory_order_relaxed);
+}
+
 QueryScheduler::QueryScheduler(VirtualWarehouse & vw_) : vw(vw_)
 {
     log = &Poco::Logger::get(vw.getName() + " (QueryScheduler)");
@@ -189,6 +194,10 @@ std::vector<WorkerNodePtr> QueryScheduler::selectWorkers(const VWScheduleAlgo &
             comparator = cmp_worker_disk;
             break;
 
+        case VWScheduleAlgo::GlobalLowIO:
+            comparator = cmp_worker_io;
+            break;
+
         default:
             throw Exception("Wrong vw_schedule_algo for query scheduler: " + std::string(toString(algo)), ErrorCodes::RESOURCE_MANAGER_WRONG_VW_SCHEDULE_ALGO);
     }
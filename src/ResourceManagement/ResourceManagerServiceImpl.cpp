@@ -477,13 +477,13 @@ void ResourceManagerServiceImpl::pickWorkerGroup(
             return;
 
         auto vw = vw_manager.getVirtualWarehouse(request->vw_name());
-        auto & query_scheduler = vw->getQueryScheduler();
         auto vw_schedule_algo = VWScheduleAlgo(request->vw_schedule_algo());
         auto requirement = ResourceRequirement::createFromProto(request->requirement());
         /// Default: at least a half of workers should be active.
         if (requirement.expected_workers == 0)
             requirement.expected_workers = vw->getExpectedNumWorkers() >> 1;
-        auto group = query_scheduler.pickWorkerGroup(vw_schedule_algo, requirement);
+        bool spilled = false;
+        auto group = vw_manager.pickWorkerGroup(vw, vw_schedule_algo, requirement, spilled);
         const auto & group_data = group->getData();
         if (group_data.host_ports_vec.empty() && group_data.psm.empty())
             throw Exception("No available worker group for " + request->vw_name(), ErrorCodes::RESOURCE_MANAGER_NO_AVAILABLE_WORKER_GROUP);
@@ -491,6 +491,8 @@ void ResourceManagerServiceImpl::pickWorkerGroup(
         LOG_TRACE(&Poco::Logger::get("ResourceManagerServiceImpl"), "Selected group {} with {} workers",
                     group->getID(), std::to_string(group->getNumWorkers()));
         group_data.fillProto(*response->mutable_worker_group_data(), true, true);
+        if (spilled)
+            response->mutable_worker_group_data()->set_is_spillover(true);
     }
     catch (...)
     {
@@ -19,6 +19,9 @@
 #include <ResourceManagement/CommonData.h>
 #include <ResourceManagement/ResourceManagerClient.h>
 #include <Common/HostWithPorts.h>
+#include <Common/Stopwatch.h>
+
+#include <cmath>
 
 
 
@@ -72,7 +75,7 @@ void ResourceReporterTask::run()
             }
         }
         //TODO: Change to config setting
-        background_task->scheduleAfter(1000);
+        background_task->scheduleAfter(CHECK_INTERVAL_MS);
     }
     catch (Exception & e)
     {
@@ -84,17 +87,39 @@ void ResourceReporterTask::run()
     }
 }
 
+bool ResourceReporterTask::significantChange(const WorkerNodeResourceData & data) const
+{
+    return std::abs(data.cpu_usage - last_sent_cpu_usage) >= SIGNIFICANT_USAGE_DELTA
+        || std::abs(data.memory_usage - last_sent_memory_usage) >= SIGNIFICANT_USAGE_DELTA;
+}
+
 bool ResourceReporterTask::sendHeartbeat()
 {
     auto resource_manager = getContext()->getResourceManagerClient();
     auto data = resource_monitor->createResourceData();
 
+    /// Report at the regular interval, and early when the load changed enough for
+    /// the scheduler to care - so placement runs on near-real-time usage instead
+    /// of a snapshot up to a full interval old.
+    UInt64 now_ms = clock_gettime_ns(CLOCK_MONOTONIC_COARSE) / 1'000'000;
+    if (last_send_ms && now_ms - last_send_ms < HEARTBEAT_INTERVAL_MS && !significantChange(data))
+        return true;
+
     LOG_TRACE(log, "Send heartbeat to RM: {} self: {}", resource_manager->leader_host_port, data.host_ports.toDebugString());
     ContextPtr context = getContext();
     data.id = getWorkerID(context);
     data.vw_name = getVirtualWareHouseID(context);
     data.worker_group_id = getWorkerGroupID(context);
-    return resource_manager->reportResourceUsage(data);
+    data.seq_no = ++next_seq_no;
+
+    bool sent = resource_manager->reportResourceUsage(data);
+    if (sent)
+    {
+        last_send_ms = now_ms;
+        last_sent_cpu_usage = data.cpu_usage;
+        last_sent_memory_usage = data.memory_usage;
+    }
+    return sent;
 }
 
 void ResourceReporterTask::sendRegister()
@@ -40,13 +40,30 @@ private:
     void sendRegister();
     void sendRemove();
 
+    /// Whether the snapshot differs enough from the last reported one to be worth
+    /// pushing ahead of the regular interval
+    bool significantChange(const WorkerNodeResourceData & data) const;
+
     inline String getenv(const char * name) { return std::getenv(name) ? std::getenv(name) : ""; }
 
 private:
+    /// Check for changes this often; a full heartbeat goes out at least
+    /// every HEARTBEAT_INTERVAL_MS even if nothing changed.
+    static constexpr UInt64 CHECK_INTERVAL_MS = 100;
+    static constexpr UInt64 HEARTBEAT_INTERVAL_MS = 1000;
+    /// CPU / memory usage change (in percent points) that triggers an early push
+    static constexpr double SIGNIFICANT_USAGE_DELTA = 10.0;
+
     bool init_request = true;
     Poco::Logger * log;
     std::unique_ptr<ResourceMonitor> resource_monitor;
     BackgroundSchedulePool::TaskHolder background_task;
+
+    /// Monotonic heartbeat sequence, lets the RM drop reports arriving out of order
+    UInt64 next_seq_no = 0;
+    UInt64 last_send_ms = 0;
+    double last_sent_cpu_usage = 0;
+    double last_sent_memory_usage = 0;
 };
 
 }
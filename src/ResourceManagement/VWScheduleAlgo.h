@@ -37,6 +37,7 @@ namespace VWScheduleAlgoImpl
         GlobalLowCpu = 103,
         GlobalLowMem = 104,
         GlobalLowDisk = 105, /// for pickWorker
+        GlobalLowIO = 106, /// for pickWorker
     };
 }
 using VWScheduleAlgo = VWScheduleAlgoImpl::Algo;
@@ -64,6 +65,8 @@ constexpr auto toString(VWScheduleAlgo algo)
             return "GlobalLowMem";
         case VWScheduleAlgo::GlobalLowDisk:
             return "GlobalLowDisk";
+        case VWScheduleAlgo::GlobalLowIO:
+            return "GlobalLowIO";
 
         default:
             return "Unknown";
@@ -97,6 +100,8 @@ constexpr auto toVWScheduleAlgo(char * algo_str)
         return VWScheduleAlgo::GlobalLowMem;
     else if (strcmp(algo_str,  "globallowdisk") == 0)
         return VWScheduleAlgo::GlobalLowDisk;
+    else if (strcmp(algo_str,  "globallowio") == 0)
+        return VWScheduleAlgo::GlobalLowIO;
     else
         return VWScheduleAlgo::Unknown;
 }
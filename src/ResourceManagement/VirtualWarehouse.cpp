@@ -90,6 +90,14 @@ void VirtualWarehouse::applySettings(const VirtualWarehouseAlterSettings & setti
         new_settings.cooldown_seconds_after_auto_link = *setting_changes.cooldown_seconds_after_auto_link;
     if (setting_changes.cooldown_seconds_after_auto_unlink)
         new_settings.cooldown_seconds_after_auto_unlink = *setting_changes.cooldown_seconds_after_auto_unlink;
+    if (setting_changes.spillover_vw)
+    {
+        if (*setting_changes.spillover_vw == name)
+            throw Exception("spillover_vw cannot point to the virtual warehouse itself", ErrorCodes::RESOURCE_MANAGER_INCORRECT_SETTING);
+        new_settings.spillover_vw = *setting_changes.spillover_vw;
+    }
+    if (setting_changes.max_spillover_concurrent_queries)
+        new_settings.max_spillover_concurrent_queries = *setting_changes.max_spillover_concurrent_queries;
 
     catalog->alterVirtualWarehouse(name, data);
     {
@@ -256,6 +256,57 @@ void VirtualWarehouseManager::updateQueryQueueMap(const String & server_id, cons
 
 }
 
+WorkerGroupPtr VirtualWarehouseManager::pickWorkerGroup(
+    const VirtualWarehousePtr & vw, VWScheduleAlgo algo, const ResourceRequirement & requirement, bool & out_spilled)
+{
+    out_spilled = false;
+    auto & scheduler = vw->getQueryScheduler();
+
+    const auto settings = vw->getSettings();
+    if (settings.spillover_vw.empty())
+        return scheduler.pickWorkerGroup(algo, requirement);
+
+    /// Queued queries reported by the servers' resource groups are the saturation signal:
+    /// as long as nothing queues, the vw handles its own load and no query is spilled.
+    auto queue_info = vw->getAggQueueInfo();
+    if (queue_info.queued_query_count == 0)
+        return scheduler.pickWorkerGroup(algo, requirement);
+
+    auto spillover_vw = tryGetVirtualWarehouse(settings.spillover_vw);
+    if (!spillover_vw || spillover_vw.get() == vw.get())
+    {
+        LOG_WARNING(log, "Spillover vw {} of {} not found, keep queries in their own vw", settings.spillover_vw, vw->getName());
+        return scheduler.pickWorkerGroup(algo, requirement);
+    }
+
+    /// Cap the load the spillover target takes on. Its own queue info counts every
+    /// query it runs, which is exactly the concurrency a shared overflow group sees.
+    if (settings.max_spillover_concurrent_queries)
+    {
+        auto spillover_queue_info = spillover_vw->getAggQueueInfo();
+        if (spillover_queue_info.running_query_count + spillover_queue_info.queued_query_count
+            >= settings.max_spillover_concurrent_queries)
+        {
+            LOG_DEBUG(
+                log,
+                "Spillover vw {} reached the cap of {} queries, keep query in {}",
+                settings.spillover_vw,
+                settings.max_spillover_concurrent_queries,
+                vw->getName());
+            return scheduler.pickWorkerGroup(algo, requirement);
+        }
+    }
+
+    LOG_DEBUG(
+        log,
+        "VW {} has {} queued queries, spilling query over to {}",
+        vw->getName(),
+        queue_info.queued_query_count,
+        settings.spillover_vw);
+    out_spilled = true;
+    return spillover_vw->getQueryScheduler().pickWorkerGroup(algo, requirement);
+}
+
 AggQueryQueueMap VirtualWarehouseManager::getAggQueryQueueMap() const
 {
     const auto vws = getAll();
@@ -46,6 +46,13 @@ public:
 
     AggQueryQueueMap getAggQueryQueueMap() const;
 
+    /// Pick a worker group for a query. When the vw has queries queued and a
+    /// spillover_vw is configured, overflow queries are routed to that vw instead,
+    /// capped by max_spillover_concurrent_queries. out_spilled tells the caller
+    /// whether the returned group belongs to the spillover vw
+    WorkerGroupPtr pickWorkerGroup(
+        const VirtualWarehousePtr & vw, VWScheduleAlgo algo, const ResourceRequirement & requirement, bool & out_spilled);
+
 private:
     ResourceManagerController & rm_controller;
     Poco::Logger * log{nullptr};
@@ -101,17 +101,28 @@ String WorkerNode::toDebugString() const
        << " memory_available:" << memory_available.load(std::memory_order_relaxed)
        << " reserved_memory_bytes:" << reserved_memory_bytes.load(std::memory_order_relaxed)
        << " disk_space:" << disk_space.load(std::memory_order_relaxed)
+       << " io_usage:" << io_usage.load(std::memory_order_relaxed)
        << " query_num:" << query_num.load(std::memory_order_relaxed);
     return ss.str();
 }
 
 void WorkerNode::update(const WorkerNodeResourceData & data, const size_t register_granularity)
 {
+    /// Heartbeats may arrive out of order (brpc retries, leader switches); an older
+    /// snapshot must not overwrite a fresher one, or the scheduler sees stale load.
+    if (data.seq_no)
+    {
+        if (data.seq_no <= last_seq_no.load(std::memory_order_relaxed))
+            return;
+        last_seq_no.store(data.seq_no, std::memory_order_relaxed);
+    }
+
     cpu_usage.store(data.cpu_usage, std::memory_order_relaxed);
     memory_usage.store(data.memory_usage, std::memory_order_relaxed);
     memory_available.store(data.memory_available, std::memory_order_relaxed);
     disk_space.store(data.disk_space, std::memory_order_relaxed);
     query_num.store(data.query_num, std::memory_order_relaxed);
+    io_usage.store(data.io_usage, std::memory_order_relaxed);
     auto now = time(nullptr);
     last_update_time = now;
 
@@ -160,6 +171,7 @@ WorkerNodeResourceData WorkerNode::getResourceData() const
     res.memory_available = memory_available.load(std::memory_order_relaxed);
     res.disk_space = disk_space.load(std::memory_order_relaxed);
     res.query_num = query_num.load(std::memory_order_relaxed);
+    res.io_usage = io_usage.load(std::memory_order_relaxed);
 
     res.cpu_limit = cpu_limit;
     res.memory_limit = memory_limit;
@@ -204,6 +216,7 @@ void WorkerNode::fillProto(Protos::WorkerNodeResourceData & entry) const
     entry.set_memory_usage(memory_usage.load(std::memory_order_relaxed));
     entry.set_disk_space(disk_space.load(std::memory_order_relaxed));
     entry.set_memory_available(memory_available.load(std::memory_order_relaxed));
+    entry.set_io_usage(io_usage.load(std::memory_order_relaxed));
 
     entry.set_id(id);
     entry.set_vw_name(vw_name);
@@ -216,6 +229,7 @@ void WorkerNode::fillProto(Protos::WorkerNodeResourceData & entry) const
     // coverity[store_truncates_time_t]
     entry.set_register_time(static_cast<UInt32>(register_time));
     entry.set_state(static_cast<UInt32>(state.load(std::memory_order_relaxed)));
+    entry.set_seq_no(last_seq_no.load(std::memory_order_relaxed));
 }
 
 }
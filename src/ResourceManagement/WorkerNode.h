@@ -77,7 +77,10 @@ struct WorkerNode
     std::atomic<UInt64> memory_available;
     std::atomic<UInt64> disk_space;
     std::atomic<UInt32> query_num;
+    std::atomic<double> io_usage{0};
     std::atomic<WorkerState> state{WorkerState::Registering};
+    /// Sequence number of the freshest heartbeat applied so far, see WorkerNodeResourceData::seq_no
+    std::atomic<UInt64> last_seq_no{0};
 
     UInt32 cpu_limit = 0;
     UInt32 memory_limit = 0;
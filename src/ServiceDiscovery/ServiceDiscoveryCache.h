@@ -62,6 +62,14 @@ public:
         std::lock_guard<std::shared_mutex> lock(mutex);
         cache[key] = value;
     }
+    // force the entry to be treated as outdated while keeping its endpoints servable
+    void markStale(const SDCacheKey & key)
+    {
+        std::lock_guard<std::shared_mutex> lock(mutex);
+        auto it = cache.find(key);
+        if (it != cache.end())
+            it->second.last_update = 0;
+    }
     void clear()
     {
         std::lock_guard<std::shared_mutex> lock(mutex);
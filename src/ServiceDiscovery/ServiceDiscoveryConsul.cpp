@@ -125,13 +125,17 @@ ServiceDiscoveryConsul::Endpoints ServiceDiscoveryConsul::fetchEndpointsFromCach
     SDCacheKey key {psm_name, vw_name};
     SDCacheValue<Endpoint> cache_res;
 
-    // Cache hit. endpoints exists in cache and not outdated
-    if (cache.get(key, cache_res) && time(nullptr) - cache_timeout < cache_res.last_update)
+    // Cache hit. Always serve from memory; when the entry is past its timeout,
+    // refresh it in the background (stale-while-revalidate) so lookups on
+    // connection setup paths never block on a consul round trip.
+    if (cache.get(key, cache_res))
     {
+        if (time(nullptr) - cache_timeout >= cache_res.last_update)
+            scheduleRefresh(psm_name, vw_name);
         return cache_res.endpoints;
     }
 
-    // Cache miss. We fetch entry and store in cache
+    // Cache miss. Only the very first lookup of a key fetches synchronously
     try
     {
         Endpoints res = fetchEndpointsFromUpstream(psm_name, vw_name);
@@ -148,6 +152,43 @@ ServiceDiscoveryConsul::Endpoints ServiceDiscoveryConsul::fetchEndpointsFromCach
     }
 }
 
+void ServiceDiscoveryConsul::scheduleRefresh(const String & psm_name, const String & vw_name)
+{
+    SDCacheKey key {psm_name, vw_name};
+    {
+        std::lock_guard lock(refresh_mutex);
+        if (!refreshing.insert(key).second)
+            return; /// a refresh of this key is already in flight
+    }
+
+    bool scheduled = refresh_pool.trySchedule([this, psm_name, vw_name, key]
+    {
+        try
+        {
+            Endpoints res = fetchEndpointsFromUpstream(psm_name, vw_name);
+            cache.put(key, SDCacheValue<Endpoint>{res, time(nullptr)});
+        }
+        catch (...)
+        {
+            LOG_WARNING(log, "background refresh of sd cache failed for [" + psm_name + "][" + vw_name + "], keeping stale entry");
+        }
+        std::lock_guard lock(refresh_mutex);
+        refreshing.erase(key);
+    });
+
+    if (!scheduled)
+    {
+        std::lock_guard lock(refresh_mutex);
+        refreshing.erase(key);
+    }
+}
+
+void ServiceDiscoveryConsul::invalidate(const String & psm_name, const String & vw_name)
+{
+    cache.markStale({psm_name, vw_name});
+    scheduleRefresh(psm_name, vw_name);
+}
+
 ServiceDiscoveryConsul::Endpoints ServiceDiscoveryConsul::fetchEndpointsFromUpstream(const String &, const String &)
 {
     return {};
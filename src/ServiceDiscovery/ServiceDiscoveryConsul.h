@@ -18,7 +18,10 @@
 #include <ServiceDiscovery/ServiceDiscoveryCache.h>
 #include <Poco/Util/AbstractConfiguration.h>
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 #include <Poco/Logger.h>
+#include <Common/ThreadPool.h>
 #include <ServiceDiscovery/ServiceDiscoveryHelper.h>
 
 namespace DB
@@ -44,11 +47,22 @@ public:
     // format results
     static HostWithPortsVec formatResult(const Endpoints & eps, ComponentType type);
 
+    /// Push invalidation hook: mark the cached entry outdated and refresh it in the
+    /// background; lookups keep being served the last known endpoints meanwhile.
+    void invalidate(const String & psm_name, const String & vw_name = "");
+
 private:
     Poco::Logger * log = &Poco::Logger::get("ServiceDiscoveryConsul");
 
     ServiceDiscoveryCache<Endpoint> cache;
 
+    /// refreshes outdated cache entries without blocking lookups
+    ThreadPool refresh_pool{2};
+    std::mutex refresh_mutex;
+    std::unordered_set<SDCacheKey, hash_fn> refreshing;
+
+    void scheduleRefresh(const String & psm_name, const String & vw_name);
+
     bool passCheckCluster(const Endpoint & e);
     bool passCheckVwName(const Endpoint & e, const String & vw_name);
 
@@ -20,6 +20,7 @@
 #include <ServiceDiscovery/ServiceDiscoveryFactory.h>
 #include <Common/ProfileEvents.h>
 #include <Common/CurrentMetrics.h>
+#include <Common/ThreadPool.h>
 #include <common/logger_useful.h>
 #include <mutex>
 
@@ -293,16 +294,25 @@ std::vector<String> ServiceDiscoveryDNS::resolveHost(const DNSClientPtr & client
 
 std::vector<String> ServiceDiscoveryDNS::resolveHostFromCache(const DNSClientPtr & client, const String & a4_query)
 {
-    std::lock_guard<std::mutex> lock(mutexHost);
-    auto it = cacheHost.find(a4_query);
-
-    // record exists in cache and is not timeout
-    if(it != cacheHost.end() && time(nullptr) - cache_timeout < it->second.last_update)
     {
-        return it->second.value;
+        std::lock_guard<std::mutex> lock(mutexHost);
+        auto it = cacheHost.find(a4_query);
+        if (it != cacheHost.end())
+        {
+            // expired records stay servable: hand out the stale endpoints at once and
+            // let a background refresher catch up, so connection fan-out never waits
+            // on dns. pod churn within one ttl only delays new endpoints by a lookup.
+            if (time(nullptr) - cache_timeout >= it->second.last_update && !it->second.refreshing)
+            {
+                it->second.refreshing = true;
+                refreshHostAsync(a4_query);
+            }
+            return it->second.value;
+        }
     }
 
-    // fetch from upstream as cache miss or cache record timeout
+    // first lookup of this name, nothing servable yet: fetch from upstream without
+    // holding the lock so lookups of other names proceed meanwhile
     // 1. in normal case, upstream_res size > 0
     // 2. DNS_E_NXDOMAIN: upstream_res size = 0
     // 3. DNS_E_TEMPFAIL: fallback to tcp, if tcp still fails and is not DNS_E_NXDOMAIN, throw out exception
@@ -310,10 +320,39 @@ std::vector<String> ServiceDiscoveryDNS::resolveHostFromCache(const DNSClientPtr
     std::vector<String> upstream_res = resolveHostFromUpstream(client, a4_query);
     // we will safely update the cache if upstream_res size > 0
     if(upstream_res.size() > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutexHost);
         cacheHost[a4_query] = {upstream_res, time(nullptr)};
+    }
     return upstream_res;
 }
 
+void ServiceDiscoveryDNS::refreshHostAsync(const String & a4_query)
+{
+    ThreadFromGlobalPool([this, a4_query] {
+        std::vector<String> upstream_res;
+        try
+        {
+            // dns_ctx is not thread safe, never share a client with the foreground
+            upstream_res = resolveHostFromUpstream(std::make_shared<DNSClient>(), a4_query);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Background refresh of A4 record " + a4_query + " failed, keep serving stale endpoints");
+        }
+        std::lock_guard<std::mutex> lock(mutexHost);
+        auto it = cacheHost.find(a4_query);
+        if (it == cacheHost.end())
+            return;
+        it->second.refreshing = false;
+        if (!upstream_res.empty())
+        {
+            it->second.value = std::move(upstream_res);
+            it->second.last_update = time(nullptr);
+        }
+    }).detach();
+}
+
 std::vector<String> ServiceDiscoveryDNS::resolveHostFromUpstream(const DNSClientPtr & client, const String & a4_query)
 {
     std::vector<String> result;
@@ -378,16 +417,22 @@ int ServiceDiscoveryDNS::resolvePort(const DNSClientPtr & client, const String &
 
 int ServiceDiscoveryDNS::resolvePortFromCache(const DNSClientPtr & client, const String & srv_query)
 {
-    std::lock_guard<std::mutex> lock(mutexPort);
-    auto it = cachePort.find(srv_query);
-
-    // record exists in cache and is not timeout
-    if(it != cachePort.end() && time(nullptr) - cache_timeout < it->second.last_update)
     {
-        return it->second.value;
+        std::lock_guard<std::mutex> lock(mutexPort);
+        auto it = cachePort.find(srv_query);
+        if (it != cachePort.end())
+        {
+            // serve stale, refresh in background (see resolveHostFromCache)
+            if (time(nullptr) - cache_timeout >= it->second.last_update && !it->second.refreshing)
+            {
+                it->second.refreshing = true;
+                refreshPortAsync(srv_query);
+            }
+            return it->second.value;
+        }
     }
 
-    // fetch from upstream as cache miss or cache record timeout
+    // first lookup, fetch from upstream without holding the lock
     // 1.in normal case, upstream_res is >0
     // 2.DNS_E_NXDOMAIN may have -1 returned.
     // 3.DNS_E_TEMPFAIL mat retry 3 times and throw out exception if 3 chances used up.
@@ -395,10 +440,38 @@ int ServiceDiscoveryDNS::resolvePortFromCache(const DNSClientPtr & client, const
     int upstream_res = resolvePortFromUpstream(client, srv_query);
     // we will safely update the cache if upstream_res > 0
     if (upstream_res > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutexPort);
         cachePort[srv_query] = {upstream_res, time(nullptr)};
+    }
     return upstream_res;
 }
 
+void ServiceDiscoveryDNS::refreshPortAsync(const String & srv_query)
+{
+    ThreadFromGlobalPool([this, srv_query] {
+        int upstream_res = 0;
+        try
+        {
+            upstream_res = resolvePortFromUpstream(std::make_shared<DNSClient>(), srv_query);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Background refresh of SRV record " + srv_query + " failed, keep serving stale port");
+        }
+        std::lock_guard<std::mutex> lock(mutexPort);
+        auto it = cachePort.find(srv_query);
+        if (it == cachePort.end())
+            return;
+        it->second.refreshing = false;
+        if (upstream_res > 0)
+        {
+            it->second.value = upstream_res;
+            it->second.last_update = time(nullptr);
+        }
+    }).detach();
+}
+
 int ServiceDiscoveryDNS::resolvePortFromUpstream(const DNSClientPtr & client, const String & srv_query) const
 {
     bool retry = true;
@@ -449,16 +522,22 @@ String ServiceDiscoveryDNS::resolveHostname(const DNSClientPtr & client, const S
 
 String ServiceDiscoveryDNS::resolveHostnameFromCache(const DNSClientPtr & client, const String & ptr_query)
 {
-    std::lock_guard<std::mutex> lock(mutexHostname);
-    auto it = cacheHostname.find(ptr_query);
-
-    // record exists in cache and is not timeout
-    if(it != cacheHostname.end() && time(nullptr) - cache_timeout < it->second.last_update)
     {
-        return it->second.value;
+        std::lock_guard<std::mutex> lock(mutexHostname);
+        auto it = cacheHostname.find(ptr_query);
+        if (it != cacheHostname.end())
+        {
+            // serve stale, refresh in background (see resolveHostFromCache)
+            if (time(nullptr) - cache_timeout >= it->second.last_update && !it->second.refreshing)
+            {
+                it->second.refreshing = true;
+                refreshHostnameAsync(ptr_query);
+            }
+            return it->second.value;
+        }
     }
 
-    // fetch from upstream as cache miss or cache record timeout
+    // first lookup, fetch from upstream without holding the lock
     // 1.in normal case, upstream_res len is >0
     // 2.DNS_E_NXDOMAIN may have "" returned. (This should not appear in dns mode, as each pod has hostname)
     // 3.DNS_E_TEMPFAIL mat retry 3 times and throw out exception if 3 chances used up.
@@ -466,10 +545,38 @@ String ServiceDiscoveryDNS::resolveHostnameFromCache(const DNSClientPtr & client
     String upstream_res = resolveHostnameFromUpstream(client, ptr_query);
     // so we will safely update the cache if upstream_res != ""
     if (upstream_res != "")
+    {
+        std::lock_guard<std::mutex> lock(mutexHostname);
         cacheHostname[ptr_query] = {upstream_res, time(nullptr)};
+    }
     return upstream_res;
 }
 
+void ServiceDiscoveryDNS::refreshHostnameAsync(const String & ptr_query)
+{
+    ThreadFromGlobalPool([this, ptr_query] {
+        String upstream_res;
+        try
+        {
+            upstream_res = resolveHostnameFromUpstream(std::make_shared<DNSClient>(), ptr_query);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Background refresh of PTR record " + ptr_query + " failed, keep serving stale hostname");
+        }
+        std::lock_guard<std::mutex> lock(mutexHostname);
+        auto it = cacheHostname.find(ptr_query);
+        if (it == cacheHostname.end())
+            return;
+        it->second.refreshing = false;
+        if (!upstream_res.empty())
+        {
+            it->second.value = std::move(upstream_res);
+            it->second.last_update = time(nullptr);
+        }
+    }).detach();
+}
+
 String ServiceDiscoveryDNS::resolveHostnameFromUpstream(const DNSClientPtr & client, const String & ptr_query) const
 {
     bool retry = true;
@@ -99,6 +99,12 @@ private:
     String resolveHostnameFromCache(const DNSClientPtr & client, const String & ptr_query);
     String resolveHostnameFromUpstream(const DNSClientPtr & client, const String & ptr_query) const;
 
+    /// Re-resolve an expired record on a background thread while lookups keep
+    /// serving the stale value; at most one refresher runs per key.
+    void refreshHostAsync(const String & a4_query);
+    void refreshPortAsync(const String & srv_query);
+    void refreshHostnameAsync(const String & ptr_query);
+
     ServicePair makeWorkerServicePair(const String & vw_name) const;
 
     static String makeSrvQuery(const String & service_name, const String & port_name);
@@ -112,6 +118,7 @@ private:
     {
         std::vector<String> value;
         time_t last_update;
+        bool refreshing = false;
         cacheValueHost() : value(), last_update() {}
         cacheValueHost(std::vector<String> value_, time_t last_update_) : value(std::move(value_)), last_update(last_update_) {}
     };
@@ -120,12 +127,14 @@ private:
     {
         int value;
         time_t last_update;
+        bool refreshing = false;
     };
 
     struct cacheValueHostname
     {
         String value;
         time_t last_update;
+        bool refreshing = false;
     };
 
     std::unordered_map<String, cacheValueHost> cacheHost;
@@ -49,6 +49,9 @@ void CollectStep::writeResult(TableStats & core_table_stats, ColumnStatsMap & co
         auto ndv_value_regulated = std::min<double>(std::llround(col_data.nonnull_count), col_data.ndv_value_opt.value());
         column_stats.basic->mutableProto().set_ndv_value(ndv_value_regulated);
         column_stats.basic->mutableProto().set_total_length(0);
+        // sampled collection leaves the sketch empty since it doesn't cover the full table
+        if (!col_data.ndv_sketch_blob.empty())
+            column_stats.basic->mutableProto().set_ndv_sketch_blob(col_data.ndv_sketch_blob);
 
         if (col_data.ndv_buckets_result_opt.has_value())
         {
@@ -31,6 +31,9 @@ struct HandlerColumnData
     double nonnull_count = 0;
     // when scaleNdv output unreliable result, this is null
     std::optional<double> ndv_value_opt = std::nullopt;
+    // serialized cpc sketch behind ndv_value_opt, kept only by full collection
+    // so that incremental updates can merge new values into it
+    String ndv_sketch_blob;
     double min_as_double = 0;
     double max_as_double = 0;
     std::shared_ptr<BucketBounds> bucket_bounds; // RowCountHandler will write this
@@ -80,6 +80,7 @@ public:
             double ndv = getNdvFromBase64(ndv_b64);
             result.nonnull_count = nonnull_count;
             result.ndv_value_opt = std::min(ndv, nonnull_count);
+            result.ndv_sketch_blob = base64Decode(ndv_b64);
             if (!histogram_b64.empty())
             {
                 auto histogram = createStatisticsTyped<StatsKllSketch>(StatisticsTag::KllSketch, base64Decode(histogram_b64));
@@ -0,0 +1,232 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Statistics/IncrementalStats.h>
+
+#include <city.h>
+#include <Columns/ColumnNullable.h>
+#include <Statistics/CachedStatsProxy.h>
+#include <Statistics/CatalogAdaptor.h>
+#include <Statistics/StatisticsBaseImpl.h>
+#include <Statistics/StatisticsCollectorObjects.h>
+#include <Common/Exception.h>
+
+#include <cmath>
+
+namespace DB::Statistics
+{
+
+namespace
+{
+    enum class ValueKind
+    {
+        Unsupported,
+        UnsignedInteger,
+        SignedInteger,
+        Floating,
+        String,
+    };
+
+    // Classify a decayed column type into the representation the cpc()/kll()
+    // aggregates see during full collection: strings are hashed with cityHash64,
+    // decimals (including DateTime64) are converted to Float64, the rest are fed
+    // as native numbers. Incremental updates must feed the sketch the same way,
+    // otherwise merging it with sketches from full scans would inflate ndv.
+    ValueKind classifyType(const DataTypePtr & decayed_type)
+    {
+        WhichDataType which(decayed_type);
+        if (isStringOrFixedString(decayed_type))
+            return ValueKind::String;
+        if (isColumnedAsDecimal(decayed_type) || which.isFloat())
+            return ValueKind::Floating;
+        if (which.isInt() || which.isEnum())
+            return ValueKind::SignedInteger;
+        if (which.isUInt() || which.isDateOrDateTime())
+            return ValueKind::UnsignedInteger;
+        return ValueKind::Unsupported;
+    }
+}
+
+IncrementalStatsCollector::IncrementalStatsCollector(
+    ContextPtr context_, StatsTableIdentifier table_info_, ColumnDescVector columns_desc_)
+    : context(std::move(context_))
+    , table_info(std::move(table_info_))
+    , columns_desc(std::move(columns_desc_))
+    , log(&Poco::Logger::get("IncrementalStatsCollector"))
+{
+}
+
+void IncrementalStatsCollector::update(const Block & block)
+{
+    row_count += block.rows();
+
+    for (const auto & col_desc : columns_desc)
+    {
+        if (!block.has(col_desc.name))
+            continue;
+
+        auto kind = classifyType(decayDataType(col_desc.type));
+        if (kind == ValueKind::Unsupported)
+            continue;
+
+        auto column = block.getByName(col_desc.name).column->convertToFullColumnIfLowCardinality();
+        const NullMap * null_map = nullptr;
+        if (const auto * nullable = checkAndGetColumn<ColumnNullable>(column.get()))
+        {
+            null_map = &nullable->getNullMapData();
+            column = nullable->getNestedColumnPtr();
+        }
+
+        auto & delta = column_deltas[col_desc.name];
+        for (size_t row = 0, rows = column->size(); row < rows; ++row)
+        {
+            if (null_map && (*null_map)[row])
+                continue;
+
+            double value_as_double = 0;
+            switch (kind)
+            {
+                case ValueKind::UnsignedInteger:
+                {
+                    UInt64 value = column->getUInt(row);
+                    delta.ndv_sketch.update(value);
+                    value_as_double = static_cast<double>(value);
+                    break;
+                }
+                case ValueKind::SignedInteger:
+                {
+                    Int64 value = column->getInt(row);
+                    delta.ndv_sketch.update(value);
+                    value_as_double = static_cast<double>(value);
+                    break;
+                }
+                case ValueKind::Floating:
+                {
+                    Float64 value = column->getFloat64(row);
+                    delta.ndv_sketch.update(value);
+                    value_as_double = value;
+                    break;
+                }
+                case ValueKind::String:
+                {
+                    auto data = column->getDataAt(row);
+                    UInt64 hash = CityHash_v1_0_2::CityHash64(data.data, data.size);
+                    delta.ndv_sketch.update(hash);
+                    value_as_double = static_cast<double>(hash);
+                    break;
+                }
+                case ValueKind::Unsupported:
+                    break;
+            }
+
+            ++delta.nonnull_count;
+            if (!delta.has_min_max)
+            {
+                delta.min_as_double = value_as_double;
+                delta.max_as_double = value_as_double;
+                delta.has_min_max = true;
+            }
+            else
+            {
+                delta.min_as_double = std::min(delta.min_as_double, value_as_double);
+                delta.max_as_double = std::max(delta.max_as_double, value_as_double);
+            }
+        }
+    }
+}
+
+void IncrementalStatsCollector::commit()
+{
+    if (row_count == 0)
+        return;
+
+    try
+    {
+        auto catalog = createCatalogAdaptor(context);
+        if (!catalog->hasStatsData(table_info))
+        {
+            // the table was never analyzed, a delta alone would misrepresent it
+            return;
+        }
+
+        auto proxy = createCachedStatsProxy(catalog);
+        auto data = proxy->get(table_info, true, columns_desc);
+
+        StatisticsImpl::TableStats table_stats;
+        table_stats.readFromCollection(data.table_stats);
+        if (!table_stats.basic)
+            return;
+        table_stats.basic->setRowCount(table_stats.basic->getRowCount() + row_count);
+
+        StatsData updated;
+        updated.table_stats = table_stats.writeToCollection();
+
+        for (auto & [col_name, delta] : column_deltas)
+        {
+            if (!data.column_stats.count(col_name))
+                continue;
+
+            StatisticsImpl::ColumnStats column_stats;
+            column_stats.readFromCollection(data.column_stats.at(col_name));
+            if (!column_stats.basic)
+                continue;
+
+            auto & proto = column_stats.basic->mutableProto();
+            auto nonnull_count = proto.nonnull_count() + static_cast<Int64>(delta.nonnull_count);
+            proto.set_nonnull_count(nonnull_count);
+
+            if (delta.has_min_max)
+            {
+                // persisted min/max are NaN when the column had no histogram
+                if (std::isnan(proto.min_as_double()) || delta.min_as_double < proto.min_as_double())
+                    proto.set_min_as_double(delta.min_as_double);
+                if (std::isnan(proto.max_as_double()) || delta.max_as_double > proto.max_as_double())
+                    proto.set_max_as_double(delta.max_as_double);
+            }
+
+            if (proto.has_ndv_sketch_blob())
+            {
+                auto sketch = createStatisticsTyped<StatsCpcSketch>(StatisticsTag::CpcSketch, proto.ndv_sketch_blob());
+                sketch->merge(delta.ndv_sketch);
+                proto.set_ndv_value(AdjustNdvWithCount(sketch->get_estimate(), nonnull_count));
+                proto.set_ndv_sketch_blob(sketch->serialize());
+            }
+
+            // histograms are not maintained incrementally, keep the persisted ones:
+            // writing only the ColumnBasic tag leaves other tags of the column untouched
+            column_stats.ndv_buckets_result = nullptr;
+            updated.column_stats[col_name] = column_stats.writeToCollection();
+        }
+
+        proxy->put(table_info, std::move(updated));
+        catalog->invalidateClusterStatsCache(table_info);
+
+        LOG_DEBUG(
+            log,
+            "Merged incremental statistics of {} rows ({} columns) into {}",
+            row_count,
+            column_deltas.size(),
+            table_info.getDbTableName());
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, "while updating statistics of " + table_info.getDbTableName() + " incrementally");
+    }
+
+    row_count = 0;
+    column_deltas.clear();
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Core/Block.h>
+#include <Interpreters/Context_fwd.h>
+#include <Statistics/StatsCpcSketch.h>
+#include <Statistics/StatsTableIdentifier.h>
+#include <Statistics/TypeUtils.h>
+#include <boost/noncopyable.hpp>
+#include <common/logger_useful.h>
+
+namespace DB::Statistics
+{
+
+// Maintains table statistics incrementally on the insert path, without extra scans.
+// Accumulates per-column deltas (nonnull counts, min/max, a cpc sketch for ndv)
+// over the inserted blocks, then merges them into the statistics persisted in the
+// catalog once the insert commits. Only tables that have already been analyzed are
+// updated: without a baseline the delta alone would misrepresent the table, and
+// columns whose persisted stats lack a cpc sketch only get counts and min/max
+// refreshed. Histograms are not maintained here, they stay until full collection.
+class IncrementalStatsCollector : private boost::noncopyable
+{
+public:
+    IncrementalStatsCollector(ContextPtr context_, StatsTableIdentifier table_info_, ColumnDescVector columns_desc_);
+
+    // accumulate statistics of a block about to be written, cheap enough to run inline
+    void update(const Block & block);
+
+    // merge the accumulated deltas into the catalog and invalidate stats caches.
+    // call once, after the inserted parts are committed. never throws: statistics
+    // maintenance must not fail the insert.
+    void commit();
+
+private:
+    struct ColumnDelta
+    {
+        UInt64 nonnull_count = 0;
+        bool has_min_max = false;
+        double min_as_double = 0;
+        double max_as_double = 0;
+        StatsCpcSketch ndv_sketch;
+    };
+
+    ContextPtr context;
+    StatsTableIdentifier table_info;
+    ColumnDescVector columns_desc;
+    UInt64 row_count = 0;
+    std::unordered_map<String, ColumnDelta> column_deltas;
+    Poco::Logger * log;
+};
+
+}
@@ -43,30 +43,44 @@ struct DataPartsWeightFunction
     }
 };
 
-class CnchDataPartCache : public LRUCache<TableWithPartition, DataPartModelsMap, TableWithPartitionHash, DataPartsWeightFunction>
+/**
+ * Part cache sitting on every query's part-resolution path. The cache is split into shards,
+ * each with its own LRU list and mutex, so concurrent lookups of different partitions only
+ * contend within their shard instead of on one global lock.
+ */
+class CnchDataPartCache
 {
-private:
-    using Base = LRUCache<TableWithPartition, DataPartModelsMap, TableWithPartitionHash, DataPartsWeightFunction>;
-
 public:
-    CnchDataPartCache(size_t max_parts_to_cache)
-        : Base(max_parts_to_cache) {
-        inner_container = std::make_unique<CacheContainer<Key>>();
+    using Shard = LRUCache<TableWithPartition, DataPartModelsMap, TableWithPartitionHash, DataPartsWeightFunction>;
+    using Key = Shard::Key;
+    using MappedPtr = Shard::MappedPtr;
+
+    static constexpr size_t DEFAULT_SHARD_COUNT = 16;
+
+    explicit CnchDataPartCache(size_t max_parts_to_cache, size_t num_shards_ = DEFAULT_SHARD_COUNT)
+        : num_shards(std::max(static_cast<size_t>(1), num_shards_))
+    {
+        size_t max_parts_per_shard = std::max(static_cast<size_t>(1), max_parts_to_cache / num_shards);
+        shards.reserve(num_shards);
+        inner_containers.reserve(num_shards);
+        for (size_t i = 0; i < num_shards; ++i)
+        {
+            shards.push_back(std::make_unique<Shard>(max_parts_per_shard));
+            inner_containers.push_back(std::make_unique<CacheContainer<Key>>());
+        }
     }
 
     template <typename LoadFunc>
     MappedPtr getOrSet(const Key & key, LoadFunc && load)
     {
-        auto result = Base::getOrSet(key, load);
+        size_t shard_idx = shardIndex(key);
+        auto result = shards[shard_idx]->getOrSet(key, load);
 
         if (result.second)
         {
             ProfileEvents::increment(ProfileEvents::CnchDataPartCacheHits);
-            if (inner_container)
-            {
-                String uuid_str = UUIDHelpers::UUIDToString(key.first);
-                inner_container->insert(uuid_str, key);
-            }
+            String uuid_str = UUIDHelpers::UUIDToString(key.first);
+            inner_containers[shard_idx]->insert(uuid_str, key);
         }
         else
             ProfileEvents::increment(ProfileEvents::CnchDataPartCacheMisses);
@@ -74,48 +88,63 @@ public:
         return result.first;
     }
 
+    MappedPtr get(const Key & key)
+    {
+        return shards[shardIndex(key)]->get(key);
+    }
+
+    void set(const Key & key, const MappedPtr & value)
+    {
+        shards[shardIndex(key)]->set(key, value);
+    }
+
     void insert(const Key & key, const MappedPtr & value)
     {
-        Base::set(key, value);
-        if (inner_container)
-        {
-            String uuid_str = UUIDHelpers::UUIDToString(key.first);
-            inner_container->insert(uuid_str, key);
-        }
+        size_t shard_idx = shardIndex(key);
+        shards[shard_idx]->set(key, value);
+        String uuid_str = UUIDHelpers::UUIDToString(key.first);
+        inner_containers[shard_idx]->insert(uuid_str, key);
     }
 
-    void dropCache(const UUID & uuid)
+    void remove(const Key & key)
     {
-        if (!inner_container)
-            return;
+        shards[shardIndex(key)]->remove(key);
+    }
 
+    void dropCache(const UUID & uuid)
+    {
         String uuid_str = UUIDHelpers::UUIDToString(uuid);
-        const auto & keys = inner_container->getKeys(uuid_str);
-        for (const auto & key : keys)
-            remove(key);
+        for (size_t i = 0; i < num_shards; ++i)
+        {
+            const auto & keys = inner_containers[i]->getKeys(uuid_str);
+            for (const auto & key : keys)
+                shards[i]->remove(key);
+        }
     }
 
     std::unordered_map<String, std::pair<size_t, size_t>> getTableCacheInfo()
     {
-        auto keys = inner_container->getAllKeys();
-
         std::unordered_map<String, std::pair<size_t, size_t>> res;
 
-        for (const auto & key : keys)
+        for (size_t i = 0; i < num_shards; ++i)
         {
-            auto cached = get(key);
-            if (cached)
+            auto keys = inner_containers[i]->getAllKeys();
+            for (const auto & key : keys)
             {
-                String uuid_str = UUIDHelpers::UUIDToString(key.first);
-                auto it = res.find(uuid_str);
-                if (it == res.end())
+                auto cached = shards[i]->get(key);
+                if (cached)
                 {
-                    res.emplace(uuid_str, std::make_pair(1, cached->size()));
-                }
-                else
-                {
-                    it->second.first++;
-                    it->second.second += cached->size();
+                    String uuid_str = UUIDHelpers::UUIDToString(key.first);
+                    auto it = res.find(uuid_str);
+                    if (it == res.end())
+                    {
+                        res.emplace(uuid_str, std::make_pair(1, cached->size()));
+                    }
+                    else
+                    {
+                        it->second.first++;
+                        it->second.second += cached->size();
+                    }
                 }
             }
         }
@@ -123,8 +152,38 @@ public:
         return res;
     }
 
-    void remove(const Key & key) { Base::remove(key); }
+    size_t count() const
+    {
+        size_t res = 0;
+        for (const auto & shard : shards)
+            res += shard->count();
+        return res;
+    }
+
+    size_t weight() const
+    {
+        size_t res = 0;
+        for (const auto & shard : shards)
+            res += shard->weight();
+        return res;
+    }
+
+    void reset()
+    {
+        for (auto & shard : shards)
+            shard->reset();
+    }
+
+private:
+    size_t shardIndex(const Key & key) const
+    {
+        return TableWithPartitionHash()(key) % num_shards;
+    }
 
+    const size_t num_shards;
+    std::vector<std::unique_ptr<Shard>> shards;
+    /// Per-shard uuid -> cached keys mapping, used to drop all entries of one table.
+    std::vector<std::unique_ptr<CacheContainer<Key>>> inner_containers;
 };
 
 using CnchDataPartCachePtr = std::shared_ptr<CnchDataPartCache>;
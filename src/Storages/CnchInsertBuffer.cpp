@@ -0,0 +1,188 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Storages/CnchInsertBuffer.h>
+
+#include <Interpreters/Context.h>
+#include <Interpreters/DatabaseCatalog.h>
+#include <Parsers/ASTInsertQuery.h>
+#include <Transaction/TransactionCoordinatorRcCnch.h>
+#include <Common/Exception.h>
+#include <common/logger_useful.h>
+#include <common/scope_guard.h>
+
+namespace DB
+{
+
+CnchInsertBuffer & CnchInsertBuffer::instance()
+{
+    static CnchInsertBuffer ret;
+    return ret;
+}
+
+CnchInsertBuffer::TableBufferPtr
+CnchInsertBuffer::getOrCreateBuffer(const StorageID & table_id, const FlushThresholds & thresholds, const ContextPtr & query_context)
+{
+    std::lock_guard lock(mutex);
+    auto & buffer = buffers[table_id.uuid];
+    if (!buffer)
+    {
+        buffer = std::make_shared<TableBuffer>();
+        buffer->table_id = table_id;
+        buffer->global_context = query_context->getGlobalContext();
+        buffer->flush_task = buffer->global_context->getBufferFlushSchedulePool().createTask(
+            "InsertBuffer(" + table_id.getNameForLogs() + ")", [buffer_weak = std::weak_ptr<TableBuffer>(buffer), this] {
+                if (auto buf = buffer_weak.lock())
+                    flushBuffer(*buf, /*background*/ true);
+            });
+    }
+    /// Thresholds follow the table settings of the latest insert.
+    buffer->thresholds = thresholds;
+    return buffer;
+}
+
+void CnchInsertBuffer::add(const StorageID & table_id, Block block, const FlushThresholds & thresholds, ContextPtr query_context)
+{
+    if (!block || !block.rows())
+        return;
+
+    auto buffer = getOrCreateBuffer(table_id, thresholds, query_context);
+
+    size_t block_bytes = block.bytes();
+    memory_tracker.alloc(block_bytes);
+
+    bool need_inline_flush = false;
+    {
+        std::lock_guard lock(buffer->mutex);
+        buffer->bytes += block_bytes;
+        buffer->rows += block.rows();
+        buffer->blocks.emplace_back(std::move(block));
+
+        need_inline_flush = (thresholds.max_bytes && buffer->bytes >= thresholds.max_bytes)
+            || (thresholds.max_rows && buffer->rows >= thresholds.max_rows);
+    }
+
+    if (need_inline_flush)
+        flushBuffer(*buffer, /*background*/ false);
+    else
+        buffer->flush_task->scheduleAfter(thresholds.flush_interval_ms);
+}
+
+void CnchInsertBuffer::flushBuffer(TableBuffer & buffer, bool background)
+{
+    BlocksList blocks;
+    {
+        std::lock_guard lock(buffer.mutex);
+        blocks.swap(buffer.blocks);
+        buffer.bytes = 0;
+        buffer.rows = 0;
+    }
+    if (blocks.empty())
+        return;
+
+    size_t flushed_bytes = 0;
+    for (const auto & block : blocks)
+        flushed_bytes += block.bytes();
+
+    try
+    {
+        writeBlocks(buffer, std::move(blocks));
+        memory_tracker.free(flushed_bytes);
+    }
+    catch (...)
+    {
+        if (!background)
+        {
+            memory_tracker.free(flushed_bytes);
+            throw;
+        }
+
+        /// Keep the data for the next flush attempt; the inserting clients have
+        /// already been acknowledged. The size cap eventually turns persistent
+        /// failures into inline flush errors, i.e. client backpressure.
+        tryLogCurrentException(log, "Failed to flush insert buffer of " + buffer.table_id.getNameForLogs());
+        std::lock_guard lock(buffer.mutex);
+        for (auto & block : blocks)
+        {
+            buffer.bytes += block.bytes();
+            buffer.rows += block.rows();
+            buffer.blocks.emplace_back(std::move(block));
+        }
+        buffer.flush_task->scheduleAfter(buffer.thresholds.flush_interval_ms);
+    }
+}
+
+void CnchInsertBuffer::writeBlocks(TableBuffer & buffer, BlocksList blocks)
+{
+    auto insert_context = Context::createCopy(buffer.global_context);
+    insert_context->makeQueryContext();
+
+    StoragePtr table = DatabaseCatalog::instance().tryGetTable(buffer.table_id, insert_context);
+    if (!table)
+    {
+        /// The table is gone; the buffered data has nowhere to go.
+        LOG_WARNING(log, "Dropping buffered inserts of {}: table no longer exists", buffer.table_id.getNameForLogs());
+        return;
+    }
+
+    auto & coordinator = insert_context->getCnchTransactionCoordinator();
+    auto txn = coordinator.createTransaction(CreateTransactionOption().setContext(insert_context));
+    insert_context->setCurrentTransaction(txn, false);
+    SCOPE_EXIT({ coordinator.finishTransaction(txn); });
+
+    auto metadata_snapshot = table->getInMemoryMetadataPtr();
+    auto insert_ast = std::make_shared<ASTInsertQuery>();
+    insert_ast->table_id = buffer.table_id;
+
+    auto out = table->write(insert_ast, metadata_snapshot, insert_context);
+    out->writePrefix();
+
+    /// Concatenate runs of structurally identical blocks so the writer dumps one
+    /// set of parts for the whole batch. A schema change mid-buffer starts a new run.
+    while (!blocks.empty())
+    {
+        Block merged = std::move(blocks.front());
+        blocks.pop_front();
+
+        MutableColumns columns = merged.mutateColumns();
+        while (!blocks.empty() && blocksHaveEqualStructure(merged, blocks.front()))
+        {
+            const Block & next = blocks.front();
+            for (size_t i = 0; i < columns.size(); ++i)
+                columns[i]->insertRangeFrom(*next.getByPosition(i).column, 0, next.rows());
+            blocks.pop_front();
+        }
+        merged.setColumns(std::move(columns));
+
+        out->write(merged);
+    }
+
+    out->writeSuffix();
+}
+
+void CnchInsertBuffer::flushAll()
+{
+    std::vector<TableBufferPtr> to_flush;
+    {
+        std::lock_guard lock(mutex);
+        to_flush.reserve(buffers.size());
+        for (auto & [_, buffer] : buffers)
+            to_flush.push_back(buffer);
+    }
+    for (auto & buffer : to_flush)
+        flushBuffer(*buffer, /*background*/ true);
+}
+
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Core/BackgroundSchedulePool.h>
+#include <Core/Block.h>
+#include <DataStreams/IBlockOutputStream.h>
+#include <Interpreters/Context_fwd.h>
+#include <Interpreters/StorageID.h>
+#include <Storages/StorageInMemoryMetadata.h>
+#include <Common/MemoryTracker.h>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace DB
+{
+
+/** Server-side accumulator for high-frequency small inserts into cnch tables.
+  *
+  * Agents inserting ~100-row batches spend almost all server time on per-query
+  * overhead: each micro-batch pays for a transaction, a part dump and a commit.
+  * With enable_insert_buffering, blocks of plain INSERTs are appended to a shared
+  * per-table buffer here and the query returns immediately; a background task (or
+  * the insert that crosses the size threshold) concatenates the accumulated blocks
+  * and pushes them through the normal part-dump path under a single transaction.
+  *
+  * The buffered data is not yet committed when the INSERT returns: a server crash
+  * loses the current buffer contents, and SELECTs do not see the rows until the
+  * flush. Buffered bytes are accounted in a dedicated MemoryTracker.
+  */
+class CnchInsertBuffer
+{
+public:
+    static CnchInsertBuffer & instance();
+
+    struct FlushThresholds
+    {
+        UInt64 flush_interval_ms;
+        size_t max_bytes;
+        size_t max_rows;
+    };
+
+    /// Append a block for the given table. Flushes inline (in the caller's thread,
+    /// propagating errors to the client) when the accumulated size crosses the
+    /// thresholds; otherwise schedules a background flush.
+    void add(const StorageID & table_id, Block block, const FlushThresholds & thresholds, ContextPtr query_context);
+
+    /// Synchronously flush all buffered data, e.g. on shutdown.
+    void flushAll();
+
+private:
+    CnchInsertBuffer() = default;
+
+    struct TableBuffer
+    {
+        StorageID table_id = StorageID::createEmpty();
+        ContextPtr global_context;
+        FlushThresholds thresholds{};
+
+        std::mutex mutex;
+        BlocksList blocks;
+        size_t bytes = 0;
+        size_t rows = 0;
+
+        BackgroundSchedulePool::TaskHolder flush_task;
+    };
+    using TableBufferPtr = std::shared_ptr<TableBuffer>;
+
+    TableBufferPtr getOrCreateBuffer(const StorageID & table_id, const FlushThresholds & thresholds, const ContextPtr & query_context);
+
+    /// Detaches the accumulated blocks and writes them. On a background flush the
+    /// blocks are re-queued on error so the next flush retries them; an inline
+    /// flush lets the exception reach the inserting client as backpressure.
+    void flushBuffer(TableBuffer & buffer, bool background);
+
+    void writeBlocks(TableBuffer & buffer, BlocksList blocks);
+
+    std::mutex mutex;
+    std::unordered_map<UUID, TableBufferPtr> buffers;
+
+    MemoryTracker memory_tracker{VariableContext::Process};
+
+    Poco::Logger * log = &Poco::Logger::get("CnchInsertBuffer");
+};
+
+/// Returned from StorageCnchMergeTree::write when insert buffering applies:
+/// forwards the blocks to the shared buffer instead of dumping parts.
+class CnchInsertBufferBlockOutputStream : public IBlockOutputStream
+{
+public:
+    CnchInsertBufferBlockOutputStream(
+        StorageID table_id_, StorageMetadataPtr metadata_snapshot_, CnchInsertBuffer::FlushThresholds thresholds_, ContextPtr context_)
+        : table_id(std::move(table_id_))
+        , metadata_snapshot(std::move(metadata_snapshot_))
+        , thresholds(thresholds_)
+        , context(std::move(context_))
+    {
+    }
+
+    Block getHeader() const override { return metadata_snapshot->getSampleBlock(); }
+
+    void write(const Block & block) override { CnchInsertBuffer::instance().add(table_id, block, thresholds, context); }
+
+private:
+    StorageID table_id;
+    StorageMetadataPtr metadata_snapshot;
+    CnchInsertBuffer::FlushThresholds thresholds;
+    ContextPtr context;
+};
+
+}
@@ -88,7 +88,13 @@ public:
     std::shared_ptr<MergeTreePartition> partition_ptr;
     std::string partition_id;
     std::atomic<UInt32> cache_status = CacheStatus::UINIT;
+    /// Highest parts commit version merged into the cache for this partition. Compared with the
+    /// version recorded by the Catalog on commit to fetch only the delta instead of reloading.
+    std::atomic<UInt64> last_sync_version{0};
     std::shared_ptr<PartitionMetrics> metrics_ptr = std::make_shared<PartitionMetrics>();
+    /// Serialized minmax index aggregated over all parts ever committed to the partition, as of the
+    /// moment the partition meta was loaded from the metastore. Empty if it was never maintained.
+    std::string aggregated_minmax;
 
     inline PartitionLockHolder readLock() const
     {
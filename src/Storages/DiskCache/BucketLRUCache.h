@@ -172,6 +172,22 @@ public:
         return false;
     }
 
+    // Iterate over all cached elements under the lru lock, used to dump
+    // a consistent snapshot of cache contents
+    void forEach(const std::function<void(const Key&, const MappedPtr&)>& func)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (const Key& key : queue)
+        {
+            std::optional<Cell> cell = container.get(key, false);
+            if (cell.has_value())
+            {
+                func(key, cell.value().value);
+            }
+        }
+    }
+
     void getStats(size_t& hit_counts, size_t& miss_counts)
     {
         hit_counts = hits;
@@ -18,8 +18,10 @@
 #include <Disks/IStoragePolicy.h>
 #include <Interpreters/Context.h>
 #include <Storages/DiskCache/DiskCacheLRU.h>
+#include <Storages/DiskCache/DiskCachePrefetchStrategy.h>
 #include <Storages/DiskCache/DiskCacheSettings.h>
 #include <Storages/DiskCache/DiskCacheSimpleStrategy.h>
+#include <Storages/DiskCache/DiskCacheTiered.h>
 
 namespace DB
 {
@@ -27,16 +29,34 @@ void DiskCacheFactory::init(Context & context)
 {
     const auto & config = context.getConfigRef();
     DiskCacheSettings cache_settings;
-    DiskCacheStrategySettings strategy_settings;
     cache_settings.loadFromConfig(config, "lru");
-    strategy_settings.loadFromConfig(config, "simple");
 
     // TODO: volume
-    VolumePtr disk_cache_volume = context.getStoragePolicy("default")->getVolume(0);
-    auto disk_cache = std::make_shared<DiskCacheLRU>(context, disk_cache_volume, cache_settings);
+    auto storage_policy = context.getStoragePolicy("default");
+    VolumePtr disk_cache_volume = storage_policy->getVolume(0);
+
+    IDiskCachePtr disk_cache;
+    if (cache_settings.tiered_enable)
+    {
+        VolumePtr data_tier_volume = storage_policy->getVolume(cache_settings.data_tier_volume_index);
+        disk_cache = std::make_shared<DiskCacheTiered>(context, disk_cache_volume, data_tier_volume, cache_settings);
+    }
+    else
+    {
+        disk_cache = std::make_shared<DiskCacheLRU>(context, disk_cache_volume, cache_settings);
+    }
     disk_cache->asyncLoad();
 
-    auto cache_strategy = std::make_shared<DiskCacheSimpleStrategy>(strategy_settings);
+    String strategy_name = config.getString("disk_cache_strategy.default_strategy", "simple");
+    DiskCacheStrategySettings strategy_settings;
+    strategy_settings.loadFromConfig(config, strategy_name);
+
+    IDiskCacheStrategyPtr cache_strategy;
+    if (strategy_name == "prefetch")
+        cache_strategy = std::make_shared<DiskCachePrefetchStrategy>(strategy_settings);
+    else
+        cache_strategy = std::make_shared<DiskCacheSimpleStrategy>(strategy_settings);
+
     default_cache = std::make_pair(std::move(disk_cache), std::move(cache_strategy));
 }
 
@@ -17,6 +17,7 @@
 #include <sys/stat.h>
 #include <atomic>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -24,9 +25,13 @@
 #include <Common/Throttler.h>
 #include <Common/setThreadName.h>
 #include "Interpreters/Context.h"
+#include <Interpreters/BloomFilter.h>
 #include <common/errnoToString.h>
 #include <Disks/IVolume.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/ReadHelpers.h>
 #include <IO/WriteBufferFromString.h>
+#include <IO/WriteHelpers.h>
 #include <IO/copyData.h>
 
 namespace fs = std::filesystem;
@@ -41,6 +46,7 @@ namespace ProfileEvents
     extern const Event DiskCacheGetMetaMicroSeconds;
     extern const Event DiskCacheGetTotalOps;
     extern const Event DiskCacheSetTotalOps;
+    extern const Event DiskCacheOwnerQuotaSkippedSets;
 }
 
 namespace DB
@@ -57,11 +63,17 @@ static constexpr auto TMP_SUFFIX_LEN = std::char_traits<char>::length(DISK_CACHE
 /// background load thread to migrate from old to new format
 static constexpr auto PREV_DISK_CACHE_DIR_NAME = "disk_cache";
 static constexpr auto DISK_CACHE_DIR_NAME = "disk_cache_v1";
+/// placed outside DISK_CACHE_DIR_NAME so the directory walk never sees it
+static constexpr auto DISK_CACHE_INDEX_FILE_NAME = "disk_cache_v1.index";
 
 namespace
 {
     constexpr size_t HEX_KEY_LEN = sizeof(DiskCacheLRU::KeyType) * 2;
 
+    constexpr UInt64 DISK_CACHE_INDEX_MAGIC = 0x444353494458494EUL;
+    constexpr UInt64 DISK_CACHE_INDEX_VERSION = 1;
+    constexpr size_t DISK_CACHE_INDEX_BLOOM_HASHES = 3;
+
     UInt64 unhex16(const char * data)
     {
         UInt64 res = 0;
@@ -116,6 +128,29 @@ DiskCacheLRU::DiskCacheLRU(
             "must be positive or -1", settings.cache_load_dispatcher_drill_down_level),
             ErrorCodes::BAD_ARGUMENTS);
     }
+
+    if (settings.cache_index_enable)
+    {
+        index_filters.reserve(settings.cache_shard_num);
+        for (size_t i = 0; i < settings.cache_shard_num; ++i)
+            index_filters.push_back(std::make_shared<BloomFilter>(
+                settings.cache_index_bloom_bytes, DISK_CACHE_INDEX_BLOOM_HASHES, 0));
+        index_filter_mutexes = std::make_unique<std::mutex[]>(settings.cache_shard_num);
+    }
+}
+
+DiskCacheLRU::~DiskCacheLRU()
+{
+    try
+    {
+        shutdown();
+        if (settings.cache_index_enable)
+            dumpIndex();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+    }
 }
 
 DiskCacheLRU::KeyType DiskCacheLRU::hash(const String & seg_key)
@@ -177,7 +212,17 @@ void DiskCacheLRU::set(const String& seg_name, ReadBuffer& value, size_t weight_
 
     ProfileEvents::increment(ProfileEvents::DiskCacheSetTotalOps);
 
+    String owner = currentCacheOwner();
+    if (isOwnerOverQuota(owner, weight_hint))
+    {
+        ProfileEvents::increment(ProfileEvents::DiskCacheOwnerQuotaSkippedSets);
+        LOG_TRACE(log, "Skip caching {} since owner {} is over its quota", seg_name, owner);
+        return;
+    }
+
     auto key = hash(seg_name);
+    // Add to filter before the map so the filter stays a superset of cached keys
+    addKeyToIndexFilter(key);
     auto& shard = containers.shard(key);
     // Insert cache meta first, if there is a entry already there, skip this insert
     bool inserted = shard.emplace(key, std::make_shared<DiskCacheMeta>(
@@ -204,8 +249,9 @@ void DiskCacheLRU::set(const String& seg_name, ReadBuffer& value, size_t weight_
         // Update meta in lru cache, it must still there, since it should get evicted
         // since it have 0 weight
         shard.update(key, std::make_shared<DiskCacheMeta>(
-            DiskCacheMeta::State::Cached, reserved_space->getDisk(), weight
+            DiskCacheMeta::State::Cached, reserved_space->getDisk(), weight, owner
         ));
+        addOwnerBytes(owner, weight);
     }
     catch(...)
     {
@@ -223,7 +269,20 @@ std::pair<DiskPtr, String> DiskCacheLRU::get(const String & seg_name)
     SCOPE_EXIT({ProfileEvents::increment(ProfileEvents::DiskCacheGetMetaMicroSeconds,
         watch.elapsedMicroseconds());});
 
+    auto res = getInternal(seg_name);
+    if (account_get_in_profile_events)
+        incrementGetProfileEvents(seg_name, res.first != nullptr);
+    return res;
+}
+
+std::pair<DiskPtr, String> DiskCacheLRU::getInternal(const String & seg_name)
+{
     auto key = hash(seg_name);
+    if (!mayContainSegment(key))
+    {
+        return {};
+    }
+
     auto& shard = containers.shard(key);
     std::shared_ptr<DiskCacheMeta> cache_meta = shard.get(key);
     if (cache_meta == nullptr || cache_meta->state != DiskCacheMeta::State::Cached)
@@ -241,6 +300,42 @@ std::pair<DiskPtr, String> DiskCacheLRU::get(const String & seg_name)
     return {cache_meta->disk, getRelativePath(key)};
 }
 
+bool DiskCacheLRU::mayContainSegment(const KeyType & key) const
+{
+    if (index_filters.empty())
+        return true;
+
+    // Lock free read; bits of a concurrent add may be missed, which only
+    // turns into a cache miss
+    return index_filters[containers.shardIndex(key)]->find(reinterpret_cast<const char *>(&key), sizeof(key));
+}
+
+void DiskCacheLRU::addKeyToIndexFilter(const KeyType & key)
+{
+    if (index_filters.empty())
+        return;
+
+    size_t shard_id = containers.shardIndex(key);
+    // Serialize writers, a bit lost to a concurrent add would become a false negative
+    std::lock_guard lock(index_filter_mutexes[shard_id]);
+    index_filters[shard_id]->add(reinterpret_cast<const char *>(&key), sizeof(key));
+}
+
+std::shared_ptr<BloomFilter> DiskCacheLRU::cloneMergedIndexFilter() const
+{
+    if (index_filters.empty())
+        return nullptr;
+
+    // All shard filters are built with the same parameters, OR them into one summary
+    auto merged = std::make_shared<BloomFilter>(settings.cache_index_bloom_bytes, DISK_CACHE_INDEX_BLOOM_HASHES, 0);
+    for (size_t shard_id = 0; shard_id < index_filters.size(); ++shard_id)
+    {
+        std::lock_guard lock(index_filter_mutexes[shard_id]);
+        merged->merge(*index_filters[shard_id]);
+    }
+    return merged;
+}
+
 size_t DiskCacheLRU::writeSegment(const String& seg_key, ReadBuffer& buffer, ReservationPtr& reservation)
 {
     DiskPtr disk = reservation->getDisk();
@@ -283,8 +378,51 @@ std::pair<bool, std::shared_ptr<DiskCacheMeta>> DiskCacheLRU::onEvictSegment(
         return {false, nullptr};
     }
 
+    releaseOwnerBytes(meta->owner, meta->size);
+
     return {false, std::make_shared<DiskCacheMeta>(DiskCacheMeta::State::Deleting,
-        meta->disk, 0)};
+        meta->disk, 0, meta->owner)};
+}
+
+bool DiskCacheLRU::isOwnerOverQuota(const String & owner, size_t weight_hint)
+{
+    if (owner.empty() || settings.owner_quota_percent == 0 || settings.owner_quota_percent >= 100)
+        return false;
+
+    // Unused capacity is a shared free pool, quotas only apply once inserts
+    // would start evicting
+    if (containers.weight() + weight_hint < settings.lru_max_size)
+        return false;
+
+    size_t quota = settings.lru_max_size / 100 * settings.owner_quota_percent;
+
+    std::lock_guard lock(owner_bytes_mutex);
+    auto it = owner_bytes.find(owner);
+    return it != owner_bytes.end() && it->second + weight_hint > quota;
+}
+
+void DiskCacheLRU::addOwnerBytes(const String & owner, size_t bytes)
+{
+    if (owner.empty())
+        return;
+
+    std::lock_guard lock(owner_bytes_mutex);
+    owner_bytes[owner] += bytes;
+}
+
+void DiskCacheLRU::releaseOwnerBytes(const String & owner, size_t bytes)
+{
+    if (owner.empty())
+        return;
+
+    std::lock_guard lock(owner_bytes_mutex);
+    auto it = owner_bytes.find(owner);
+    if (it == owner_bytes.end())
+        return;
+
+    it->second -= std::min(it->second, bytes);
+    if (it->second == 0)
+        owner_bytes.erase(it);
 }
 
 // NOTE(wsy) This is called outside lru's lock, maybe we can remove evict thread pool
@@ -351,6 +489,8 @@ void DiskCacheLRU::load()
         {
             dispatcher_pool.scheduleOrThrowOnError(createExceptionHandledJob(
                 [this, disk] {
+                    if (tryLoadFromIndex(disk))
+                        return;
                     auto loader = std::make_unique<DiskCacheLoader>(
                         *this, disk, settings.cache_loader_per_disk, 1, 1);
                     loader->exec(fs::path(DISK_CACHE_DIR_NAME) / "");
@@ -374,6 +514,8 @@ void DiskCacheLRU::load()
 
         for (const DiskPtr & disk : disks)
         {
+            if (tryLoadFromIndex(disk))
+                continue;
             auto loader = std::make_unique<DiskCacheLoader>(*this, disk, settings.cache_loader_per_disk, 1, 1);
             loader->exec(fs::path(DISK_CACHE_DIR_NAME) / "");
         }
@@ -386,6 +528,118 @@ void DiskCacheLRU::load()
     }
 }
 
+void DiskCacheLRU::dumpIndex()
+{
+    // Collect cached segments per disk, the index file on each disk only
+    // describes its own segments
+    std::map<DiskPtr, std::vector<std::pair<KeyType, size_t>>> entries_per_disk;
+    for (size_t i = 0; i < containers.shardCount(); ++i)
+    {
+        containers.shardByIndex(i).forEach([&entries_per_disk](const KeyType & key, const std::shared_ptr<DiskCacheMeta> & meta) {
+            if (meta->state == DiskCacheMeta::State::Cached && meta->disk != nullptr)
+                entries_per_disk[meta->disk].emplace_back(key, meta->size);
+        });
+    }
+
+    for (const auto & [disk, entries] : entries_per_disk)
+    {
+        String temp_rel_path = String(DISK_CACHE_INDEX_FILE_NAME) + DISK_CACHE_TEMP_FILE_SUFFIX;
+        try
+        {
+            {
+                WriteBufferFromFile out(fs::path(disk->getPath()) / temp_rel_path);
+                writeIntBinary(DISK_CACHE_INDEX_MAGIC, out);
+                writeIntBinary(DISK_CACHE_INDEX_VERSION, out);
+                writeVarUInt(entries.size(), out);
+                for (const auto & [key, file_size] : entries)
+                {
+                    writeIntBinary(key, out);
+                    writeVarUInt(file_size, out);
+                }
+                out.next();
+                out.sync();
+            }
+            disk->replaceFile(temp_rel_path, DISK_CACHE_INDEX_FILE_NAME);
+            LOG_INFO(log, fmt::format("Dumped index with {} segs to disk {}", entries.size(), disk->getPath()));
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, fmt::format("Failed to dump cache index to disk {}", disk->getPath()));
+            try
+            {
+                disk->removeFileIfExists(temp_rel_path);
+            }
+            catch (...) {}
+        }
+    }
+}
+
+bool DiskCacheLRU::tryLoadFromIndex(const DiskPtr & disk)
+{
+    if (!settings.cache_index_enable || !disk->exists(DISK_CACHE_INDEX_FILE_NAME))
+        return false;
+
+    // The index only describes the state at the last clean shutdown, consume it
+    // at most once so a crashed run falls back to the directory walk next time
+    SCOPE_EXIT({
+        try
+        {
+            disk->removeFileIfExists(DISK_CACHE_INDEX_FILE_NAME);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log);
+        }
+    });
+
+    Stopwatch watch;
+    std::vector<std::pair<KeyType, size_t>> entries;
+    try
+    {
+        ReadBufferFromFile in(fs::path(disk->getPath()) / DISK_CACHE_INDEX_FILE_NAME);
+        UInt64 magic = 0;
+        UInt64 version = 0;
+        readIntBinary(magic, in);
+        readIntBinary(version, in);
+        if (magic != DISK_CACHE_INDEX_MAGIC || version != DISK_CACHE_INDEX_VERSION)
+        {
+            LOG_WARNING(log, fmt::format("Unrecognized cache index on disk {}, fall back to directory walk", disk->getPath()));
+            return false;
+        }
+
+        size_t num_entries = 0;
+        readVarUInt(num_entries, in);
+        entries.reserve(num_entries);
+        for (size_t i = 0; i < num_entries; ++i)
+        {
+            KeyType key{};
+            size_t file_size = 0;
+            readIntBinary(key, in);
+            readVarUInt(file_size, in);
+            entries.emplace_back(key, file_size);
+        }
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, fmt::format("Failed to read cache index from disk {}, "
+            "fall back to directory walk", disk->getPath()));
+        return false;
+    }
+
+    // Only populate after the whole index parsed fine, a partially applied index
+    // would leave entries pointing to files that may not exist
+    for (const auto & [key, file_size] : entries)
+    {
+        ProfileEvents::increment(ProfileEvents::DiskCacheSetTotalOps);
+        addKeyToIndexFilter(key);
+        containers.shard(key).emplace(key, std::make_shared<DiskCacheMeta>(DiskCacheMeta::State::Cached, disk, file_size));
+    }
+
+    LOG_INFO(log, fmt::format("Recovered {} segs from index on disk {} in {} ms",
+        entries.size(), disk->getPath(), watch.elapsedMilliseconds()));
+    return true;
+}
+
 DiskCacheLRU::DiskIterator::DiskIterator(
     DiskCacheLRU & cache_, DiskPtr disk_, size_t worker_per_disk_, int min_depth_parallel_, int max_depth_parallel_)
     : disk_cache(cache_)
@@ -537,6 +791,7 @@ void DiskCacheLRU::DiskCacheLoader::iterateFile(fs::path file_path, size_t file_
     else
     {
         ProfileEvents::increment(ProfileEvents::DiskCacheSetTotalOps);
+        disk_cache.addKeyToIndexFilter(key);
         if (disk_cache.containers.shard(key).emplace(key, std::make_shared<DiskCacheMeta>(DiskCacheMeta::State::Cached, disk, file_size)))
             ++total_loaded;
     }
@@ -582,6 +837,7 @@ void DiskCacheLRU::DiskCacheMigrator::iterateFile(fs::path rel_path, size_t file
     }
 
     auto key = hash(seg_name);
+    disk_cache.addKeyToIndexFilter(key);
     auto& shard = disk_cache.containers.shard(key);
     // Insert cache meta first, if there is a entry already there, skip this insert
 
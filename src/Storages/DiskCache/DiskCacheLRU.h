@@ -17,6 +17,8 @@
 
 #include <atomic>
 #include <filesystem>
+#include <mutex>
+#include <unordered_map>
 #include <Storages/DiskCache/IDiskCache.h>
 #include <Storages/DiskCache/BucketLRUCache.h>
 #include <Storages/DiskCache/ShardCache.h>
@@ -25,6 +27,7 @@
 
 namespace DB
 {
+class BloomFilter;
 
 class DiskCacheMeta
 {
@@ -36,12 +39,14 @@ public:
         Deleting,
     };
 
-    DiskCacheMeta(State state_, const DiskPtr & disk_, size_t size_):
-        state(state_), disk(disk_), size(size_) {}
+    DiskCacheMeta(State state_, const DiskPtr & disk_, size_t size_, const String & owner_ = {}):
+        state(state_), disk(disk_), size(size_), owner(owner_) {}
 
     State state;
     DiskPtr disk;
     size_t size;
+    /// Virtual warehouse which cached this segment, empty for recovered or untagged entries
+    String owner;
 };
 
 struct DiskCacheWeightFunction
@@ -67,6 +72,7 @@ public:
     using KeyType = UInt128;
 
     DiskCacheLRU(Context & context_, const VolumePtr & volume, const DiskCacheSettings & settings);
+    ~DiskCacheLRU() override;
 
     void set(const String& seg_name, ReadBuffer& value, size_t weight_hint) override;
     std::pair<DiskPtr, String> get(const String& seg_name) override;
@@ -75,6 +81,8 @@ public:
     size_t getKeyCount() const override { return containers.count(); }
     size_t getCachedSize() const override { return containers.weight(); }
 
+    std::shared_ptr<BloomFilter> cloneMergedIndexFilter() const override;
+
     /// for test
     static KeyType hash(const String & seg_name);
     static String hexKey(const KeyType & key);
@@ -82,8 +90,27 @@ public:
     static std::filesystem::path getRelativePath(const KeyType & key);
 
 private:
+    std::pair<DiskPtr, String> getInternal(const String & seg_name);
+
     size_t writeSegment(const String& seg_name, ReadBuffer& buffer, ReservationPtr& reservation);
 
+    /// Per owner admission quota: once inserts would start evicting, owners above
+    /// their share of lru_max_size get new inserts skipped rather than pushing
+    /// other owners' entries out. Free capacity stays a shared pool
+    bool isOwnerOverQuota(const String & owner, size_t weight_hint);
+    void addOwnerBytes(const String & owner, size_t bytes);
+    void releaseOwnerBytes(const String & owner, size_t bytes);
+
+    /// Bloom prefilter over cached keys, answers negative lookups without taking
+    /// the shard lock. Only populated when settings.cache_index_enable is on
+    bool mayContainSegment(const KeyType & key) const;
+    void addKeyToIndexFilter(const KeyType & key);
+
+    /// Persisted index of cached segments, written on clean shutdown and consumed
+    /// at most once at startup, so a crashed run falls back to the directory walk
+    void dumpIndex();
+    bool tryLoadFromIndex(const DiskPtr & disk);
+
     std::pair<bool, std::shared_ptr<DiskCacheMeta>> onEvictSegment(const KeyType & key,
         const std::shared_ptr<DiskCacheMeta>& meta, size_t);
     void afterEvictSegment(const std::vector<std::pair<KeyType, std::shared_ptr<DiskCacheMeta>>>& removed_elements,
@@ -142,6 +169,14 @@ private:
     ThrottlerPtr set_rate_throttler;
     Poco::Logger * log {&Poco::Logger::get("DiskCacheLRU")};
     ShardCache<KeyType, UInt128Hash, BucketLRUCache<KeyType, DiskCacheMeta, UInt128Hash, DiskCacheWeightFunction>> containers;
+
+    /// One filter per shard of containers, adds are serialized by the matching mutex
+    std::vector<std::shared_ptr<BloomFilter>> index_filters;
+    std::unique_ptr<std::mutex[]> index_filter_mutexes;
+
+    /// Cached bytes per owner, maintained on insert and eviction
+    std::mutex owner_bytes_mutex;
+    std::unordered_map<String, size_t> owner_bytes;
 };
 
 }
@@ -0,0 +1,100 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DiskCachePrefetchStrategy.h"
+
+#include <algorithm>
+#include <Common/ProfileEvents.h>
+#include <Common/Stopwatch.h>
+#include <common/logger_useful.h>
+#include <common/scope_guard.h>
+
+namespace ProfileEvents
+{
+extern const Event DiskCacheUpdateStatsMicroSeconds;
+extern const Event DiskCachePrefetchedSegments;
+}
+
+namespace DB
+{
+String DiskCachePrefetchStrategy::streamKeyOf(const String & segment_name)
+{
+    /// uuid/part_name/stream_name#<segment_number><extension>
+    size_t pos = segment_name.find_last_of('#');
+    return pos == String::npos ? segment_name : segment_name.substr(0, pos);
+}
+
+IDiskCacheSegmentsVector DiskCachePrefetchStrategy::getCacheSegments(const IDiskCacheSegmentsVector & segments)
+{
+    Stopwatch update_stats_watch;
+    SCOPE_EXIT({ ProfileEvents::increment(ProfileEvents::DiskCacheUpdateStatsMicroSeconds, update_stats_watch.elapsedMicroseconds()); });
+
+    if (segments.empty())
+        return {};
+
+    /// Batches produced by transferRangesToSegments are sorted and belong to one
+    /// stream, so comparing the batch head against the stream history is enough
+    /// to tell a sequential scan from a point access
+    const auto & first_segment = segments.front();
+    String stream_key = streamKeyOf(first_segment->getSegmentName());
+    size_t first_number = first_segment->getSegmentNumber();
+    size_t last_number = segments.back()->getSegmentNumber();
+
+    bool sequential = false;
+    StreamStatistics & stats = stream_statistics.getStreamStats(stream_key);
+    {
+        std::lock_guard lock(stats.stats_mutex);
+        auto it = stats.last_access.find(stream_key);
+        sequential = it != stats.last_access.end() && first_number == it->second + 1;
+        stats.last_access[stream_key] = last_number;
+    }
+
+    if (sequential)
+    {
+        IDiskCacheSegmentsVector res = segments;
+        for (size_t k = 1; k <= prefetch_segments; ++k)
+        {
+            if (auto next = segments.back()->nextSegment(k))
+                res.push_back(std::move(next));
+            else
+                break;
+        }
+
+        if (res.size() > segments.size())
+        {
+            ProfileEvents::increment(ProfileEvents::DiskCachePrefetchedSegments, res.size() - segments.size());
+            LOG_TRACE(logger, "Sequential scan on {}, prefetching {} segments after #{}", stream_key, res.size() - segments.size(), last_number);
+        }
+        return res;
+    }
+
+    /// not sequential, keep the hit counting behaviour of the simple strategy
+    auto filter_cache_segments = [this, &stats](const auto & segment) {
+        std::lock_guard lock(stats.stats_mutex);
+        auto segment_hit_count = ++stats.access_stats[segment->getSegmentName()];
+        if (segment_hit_count >= segment_hits_to_cache)
+        {
+            stats.access_stats.erase(segment->getSegmentName());
+            return true;
+        }
+        return false;
+    };
+
+    IDiskCacheSegmentsVector res;
+    std::copy_if(segments.begin(), segments.end(), std::back_inserter(res), filter_cache_segments);
+    return res;
+}
+
+}
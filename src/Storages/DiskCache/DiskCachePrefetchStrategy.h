@@ -0,0 +1,73 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Storages/DiskCache/IDiskCache.h>
+#include <Storages/DiskCache/IDiskCacheStrategy.h>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace DB
+{
+/// Recognizes sequential scans over a column stream. When a batch of segments
+/// directly extends the previously accessed range of the same stream, all
+/// segments of the batch are cached right away and the next prefetch_segments
+/// siblings are scheduled ahead of access, so a scan finds them warm. Random
+/// accesses fall back to the same hit counting as DiskCacheSimpleStrategy
+class DiskCachePrefetchStrategy : public IDiskCacheStrategy
+{
+public:
+    explicit DiskCachePrefetchStrategy(const DiskCacheStrategySettings & settings_)
+        : IDiskCacheStrategy(settings_)
+        , stream_statistics(settings_.stats_bucket_size)
+        , segment_hits_to_cache(settings_.hits_to_cache)
+        , prefetch_segments(settings_.prefetch_segments)
+        , logger(&Poco::Logger::get("DiskCachePrefetchStrategy"))
+    {
+    }
+
+    virtual IDiskCacheSegmentsVector getCacheSegments(const IDiskCacheSegmentsVector & segments) override;
+
+private:
+    struct StreamStatistics
+    {
+        std::mutex stats_mutex;
+        /// last accessed segment number per column stream
+        std::unordered_map<String, size_t> last_access;
+        /// hit counters for segments accessed non sequentially
+        std::unordered_map<String, UInt32> access_stats;
+    };
+
+    struct CacheStatistics
+    {
+        explicit CacheStatistics(size_t bucket_size) : buckets(bucket_size) { }
+        StreamStatistics & getStreamStats(const String & key) { return buckets[hasher(key) % buckets.size()]; }
+
+        std::hash<String> hasher;
+        std::vector<StreamStatistics> buckets;
+    };
+
+    static String streamKeyOf(const String & segment_name);
+
+    CacheStatistics stream_statistics;
+
+    size_t segment_hits_to_cache;
+    size_t prefetch_segments;
+    Poco::Logger * logger;
+};
+
+}
@@ -68,6 +68,23 @@ String DiskCacheSegment::getSegmentName() const
         UUIDHelpers::UUIDToString(storage->getStorageUUID()), data_part->getUniquePartName(), stream_name, segment_number, extension);
 }
 
+IDiskCacheSegmentPtr DiskCacheSegment::nextSegment(size_t advance) const
+{
+    size_t next_number = segment_number + advance;
+    if (next_number * segment_size >= marks_count)
+        return nullptr;
+
+    return std::make_shared<DiskCacheSegment>(
+        static_cast<UInt32>(next_number),
+        static_cast<UInt32>(segment_size),
+        data_part,
+        mrk_file_pos,
+        marks_count,
+        stream_name,
+        extension,
+        stream_file_pos);
+}
+
 void DiskCacheSegment::cacheToDisk(IDiskCache & disk_cache)
 {
     Poco::Logger * log = disk_cache.getLogger();
@@ -54,6 +54,7 @@ public:
 
     String getSegmentName() const override;
     void cacheToDisk(IDiskCache & cache) override;
+    IDiskCacheSegmentPtr nextSegment(size_t advance) const override;
 
 private:
     IMergeTreeDataPartPtr data_part;
@@ -31,6 +31,13 @@ void DiskCacheSettings::loadFromConfig(const Poco::Util::AbstractConfiguration &
     cache_loader_per_disk = config.getUInt(config_prefix + ".cache_loader_per_disk", 2);
     cache_load_dispatcher_drill_down_level = config.getInt(config_prefix + ".cache_load_dispatcher_drill_down_level", 1);
     cache_set_rate_limit = config.getUInt64(config_prefix + ".cache_set_rate_limit", 0);
+    tiered_enable = config.getBool(config_prefix + ".tiered_enable", false);
+    data_tier_volume_index = config.getUInt64(config_prefix + ".data_tier_volume_index", 1);
+    data_tier_min_bytes = config.getUInt64(config_prefix + ".data_tier_min_bytes", 1048576);
+    meta_tier_max_size = config.getUInt64(config_prefix + ".meta_tier_max_size", 0);
+    owner_quota_percent = config.getUInt64(config_prefix + ".owner_quota_percent", 0);
+    cache_index_enable = config.getBool(config_prefix + ".cache_index_enable", false);
+    cache_index_bloom_bytes = config.getUInt64(config_prefix + ".cache_index_bloom_bytes", 1048576);
 }
 
 void DiskCacheStrategySettings::loadFromConfig(const Poco::Util::AbstractConfiguration & config, const std::string & disk_cache_strategy_name)
@@ -39,6 +46,7 @@ void DiskCacheStrategySettings::loadFromConfig(const Poco::Util::AbstractConfigu
     segment_size = config.getUInt64(config_prefix + ".segment_size", 8192);
     hits_to_cache = config.getUInt64(config_prefix + ".hits_to_cache", 2);
     stats_bucket_size = config.getUInt64(config_prefix + ".stats_bucket_size", 10000);
+    prefetch_segments = config.getUInt64(config_prefix + ".prefetch_segments", 4);
 }
 
 }
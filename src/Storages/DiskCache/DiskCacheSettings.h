@@ -42,6 +42,27 @@ struct DiskCacheSettings
     size_t cache_loader_per_disk {2};
     int cache_load_dispatcher_drill_down_level {1};
     size_t cache_set_rate_limit {0};
+
+    // Split the cache into a fast tier and a capacity tier (see DiskCacheTiered),
+    // the capacity tier is the volume with this index in the storage policy
+    bool tiered_enable {false};
+    size_t data_tier_volume_index {1};
+    // Segments at least this large are admitted to the capacity tier
+    size_t data_tier_min_bytes {1048576};
+    // Max size of the fast tier's lru, 0 - same as lru_max_size
+    size_t meta_tier_max_size {0};
+
+    // Per owner (virtual warehouse of the query) share of lru_max_size, in percent.
+    // Unused capacity acts as a shared free pool: quotas only kick in once inserts
+    // start evicting, then over quota owners get their inserts skipped instead of
+    // evicting other owners' entries. 0 disables isolation
+    size_t owner_quota_percent {0};
+
+    // Persist a compact index of cached segments on clean shutdown and recover
+    // from it at startup instead of walking the whole cache directory
+    bool cache_index_enable {false};
+    // Size in bytes of each shard's bloom filter used for negative lookups
+    size_t cache_index_bloom_bytes {1048576};
 };
 
 struct DiskCacheStrategySettings
@@ -53,6 +74,9 @@ struct DiskCacheStrategySettings
     size_t hits_to_cache {2};
     // Size of disk cache statistics bucket size
     size_t stats_bucket_size {10000};
+    // Number of segments cached ahead of access when a sequential scan is
+    // detected, only used by the prefetch strategy
+    size_t prefetch_segments {4};
 };
 
 }
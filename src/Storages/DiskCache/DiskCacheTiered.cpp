@@ -0,0 +1,83 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DiskCacheTiered.h"
+
+#include <Storages/MergeTree/MergeTreeSuffix.h>
+#include <Common/StringUtils/StringUtils.h>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+namespace
+{
+    DiskCacheSettings metaTierSettings(const DiskCacheSettings & settings)
+    {
+        DiskCacheSettings meta_settings = settings;
+        if (settings.meta_tier_max_size)
+            meta_settings.lru_max_size = settings.meta_tier_max_size;
+        return meta_settings;
+    }
+}
+
+DiskCacheTiered::DiskCacheTiered(
+    Context & context_, const VolumePtr & meta_volume_, const VolumePtr & data_volume_, const DiskCacheSettings & settings_)
+    : IDiskCache(context_, meta_volume_, settings_)
+    , data_tier_min_bytes(settings_.data_tier_min_bytes)
+    , meta_tier(std::make_shared<DiskCacheLRU>(context_, meta_volume_, metaTierSettings(settings_)))
+    , data_tier(std::make_shared<DiskCacheLRU>(context_, data_volume_, settings_))
+{
+    /// A get may probe both tiers; count hit/miss once at this level.
+    meta_tier->setAccountGetInProfileEvents(false);
+    data_tier->setAccountGetInProfileEvents(false);
+}
+
+bool DiskCacheTiered::isMetaSegment(const String & seg_name)
+{
+    return endsWith(seg_name, MARKS_FILE_EXTENSION) || endsWith(seg_name, "checksums.txt") || endsWith(seg_name, "primary.idx")
+        || endsWith(seg_name, "metainfo.txt");
+}
+
+void DiskCacheTiered::set(const String & seg_name, ReadBuffer & value, size_t weight_hint)
+{
+    // Pin marks and meta files to the fast tier regardless of size, small data
+    // segments are admitted there too, everything else overflows to the capacity tier
+    if (isMetaSegment(seg_name) || weight_hint < data_tier_min_bytes)
+        meta_tier->set(seg_name, value, weight_hint);
+    else
+        data_tier->set(seg_name, value, weight_hint);
+}
+
+std::pair<DiskPtr, String> DiskCacheTiered::get(const String & seg_name)
+{
+    auto res = meta_tier->get(seg_name);
+    if (!res.first)
+        res = data_tier->get(seg_name);
+
+    incrementGetProfileEvents(seg_name, res.first != nullptr);
+    return res;
+}
+
+void DiskCacheTiered::load()
+{
+    meta_tier->load();
+    data_tier->load();
+
+    LOG_INFO(log, fmt::format("Loaded tiered disk cache, fast tier {} segs, capacity tier {} segs",
+        meta_tier->getKeyCount(), data_tier->getKeyCount()));
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <Storages/DiskCache/DiskCacheLRU.h>
+#include <Storages/DiskCache/IDiskCache.h>
+
+#include <Poco/Logger.h>
+
+namespace DB
+{
+
+/// Two level disk cache: a small fast tier (e.g. NVMe, the first volume of the
+/// storage policy) keeps marks, checksums, primary index and other small hot
+/// segments, a capacity tier (e.g. HDD) absorbs large column data segments.
+/// Admission is by segment kind and size, so the fast tier's capacity no longer
+/// caps the cacheable working set
+class DiskCacheTiered : public IDiskCache
+{
+public:
+    DiskCacheTiered(
+        Context & context_, const VolumePtr & meta_volume_, const VolumePtr & data_volume_, const DiskCacheSettings & settings_);
+
+    void set(const String & seg_name, ReadBuffer & value, size_t weight_hint) override;
+    std::pair<DiskPtr, String> get(const String & seg_name) override;
+    void load() override;
+
+    size_t getKeyCount() const override { return meta_tier->getKeyCount() + data_tier->getKeyCount(); }
+    size_t getCachedSize() const override { return meta_tier->getCachedSize() + data_tier->getCachedSize(); }
+
+    /// for test
+    static bool isMetaSegment(const String & seg_name);
+
+private:
+    size_t data_tier_min_bytes;
+
+    std::shared_ptr<DiskCacheLRU> meta_tier;
+    std::shared_ptr<DiskCacheLRU> data_tier;
+
+    Poco::Logger * log {&Poco::Logger::get("DiskCacheTiered")};
+};
+
+}
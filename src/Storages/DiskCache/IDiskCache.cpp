@@ -17,16 +17,55 @@
 
 #include <random>
 #include <Interpreters/Context.h>
+#include <IO/ReadBufferFromMemory.h>
+#include <Storages/MergeTree/MergeTreeSuffix.h>
+#include <Common/CurrentThread.h>
 #include <Common/Stopwatch.h>
+#include <Common/StringUtils/StringUtils.h>
 #include <common/logger_useful.h>
+#include <common/scope_guard.h>
 
 namespace ProfileEvents
 {
 extern const Event DiskCacheScheduleCacheTaskMicroSeconds;
+extern const Event DiskCacheMarksHits;
+extern const Event DiskCacheMarksMisses;
+extern const Event DiskCacheMetaHits;
+extern const Event DiskCacheMetaMisses;
+extern const Event DiskCacheDataHits;
+extern const Event DiskCacheDataMisses;
 }
 
 namespace DB
 {
+thread_local String IDiskCache::task_cache_owner;
+
+String IDiskCache::currentCacheOwner()
+{
+    if (!task_cache_owner.empty())
+        return task_cache_owner;
+
+    if (CurrentThread::isInitialized())
+    {
+        if (auto query_context = CurrentThread::get().getQueryContext())
+            return query_context->getSettingsRef().virtual_warehouse;
+    }
+
+    return {};
+}
+
+void IDiskCache::incrementGetProfileEvents(const String & key, bool hit)
+{
+    /// Segment names end with the extension of the file they cache,
+    /// see IDiskCacheSegment::formatSegmentName and its callers.
+    if (endsWith(key, MARKS_FILE_EXTENSION) || endsWith(key, ".mrk2"))
+        ProfileEvents::increment(hit ? ProfileEvents::DiskCacheMarksHits : ProfileEvents::DiskCacheMarksMisses);
+    else if (endsWith(key, "checksums.txt") || endsWith(key, "primary.idx") || endsWith(key, "metainfo.txt"))
+        ProfileEvents::increment(hit ? ProfileEvents::DiskCacheMetaHits : ProfileEvents::DiskCacheMetaMisses);
+    else
+        ProfileEvents::increment(hit ? ProfileEvents::DiskCacheDataHits : ProfileEvents::DiskCacheDataMisses);
+}
+
 IDiskCache::IDiskCache(Context & context_, VolumePtr volume_, const DiskCacheSettings & settings_)
     : context(context_)
     , volume(std::move(volume_))
@@ -48,6 +87,24 @@ void IDiskCache::shutdown()
         sync_task->deactivate();
 }
 
+void IDiskCache::setWriteBehind(const String & key, const std::shared_ptr<Memory<>> & value, size_t size)
+{
+    bool scheduled = scheduleCacheTask([this, key, value, size] {
+        try
+        {
+            ReadBufferFromMemory read_buffer(value->data(), size);
+            set(key, read_buffer, size);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, __PRETTY_FUNCTION__);
+        }
+    });
+
+    if (!scheduled)
+        LOG_TRACE(log, "Dropped write behind task for key {}", key);
+}
+
 void IDiskCache::cacheSegmentsToLocalDisk(IDiskCacheSegmentsVector hit_segments)
 {
     if (hit_segments.empty())
@@ -83,6 +140,14 @@ bool IDiskCache::scheduleCacheTask(const std::function<void()> & task)
     if (shutdown_called)
         return false;
 
+    // Carry the scheduling query's owner into the pool thread for quota accounting
+    auto wrapped_task = [owner = currentCacheOwner(), task]
+    {
+        task_cache_owner = owner;
+        SCOPE_EXIT({ task_cache_owner.clear(); });
+        task();
+    };
+
     auto & thread_pool = context.getLocalDiskCacheThreadPool();
     size_t active_task_size = thread_pool.active();
     size_t max_queue_size = thread_pool.getMaxQueueSize();
@@ -91,7 +156,7 @@ bool IDiskCache::scheduleCacheTask(const std::function<void()> & task)
 
     if (current_ratio <= settings.random_drop_threshold || settings.random_drop_threshold >= 100)
     {
-        return thread_pool.trySchedule(task);
+        return thread_pool.trySchedule(wrapped_task);
     }
     else
     {
@@ -110,7 +175,7 @@ bool IDiskCache::scheduleCacheTask(const std::function<void()> & task)
         }
         else
         {
-            return thread_pool.trySchedule(task);
+            return thread_pool.trySchedule(wrapped_task);
         }
     }
 }
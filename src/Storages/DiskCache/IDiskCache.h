@@ -17,6 +17,7 @@
 
 #include <Core/BackgroundSchedulePool.h>
 #include <Disks/IDisk.h>
+#include <IO/BufferWithOwnMemory.h>
 #include <Storages/DiskCache/DiskCacheSettings.h>
 #include <Storages/DiskCache/IDiskCacheSegment.h>
 
@@ -25,6 +26,7 @@
 
 namespace DB
 {
+class BloomFilter;
 class Context;
 class ReadBuffer;
 class WriteBuffer;
@@ -58,6 +60,11 @@ public:
     /// set segment name in cache and write value to disk cache
     virtual void set(const String & key, ReadBuffer & value, size_t weight_hint) = 0;
 
+    /// queue an already fetched value for asynchronous caching (write behind).
+    /// The buffer is refcounted and handed to the cache thread pool as is, so the
+    /// read path pays neither a second remote read nor a copy nor the local file io
+    void setWriteBehind(const String & key, const std::shared_ptr<Memory<>> & value, size_t size);
+
     /// get segment from cache and return local path if exists.
     virtual std::pair<DiskPtr, String> get(const String & key) = 0;
 
@@ -70,13 +77,34 @@ public:
     /// get cached files size
     virtual size_t getCachedSize() const = 0;
 
+    /// Snapshot of the key index filter, used as a compact summary of the cache
+    /// content. Returns nullptr when the cache keeps no such filter
+    virtual std::shared_ptr<BloomFilter> cloneMergedIndexFilter() const { return nullptr; }
+
     void cacheSegmentsToLocalDisk(IDiskCacheSegmentsVector hit_segments);
 
+    /// Owner (virtual warehouse name) of the query driving the current thread, used
+    /// for per owner cache quotas. Resolved from the query context on query threads
+    /// and captured at schedule time for cache thread pool tasks
+    static String currentCacheOwner();
+
     VolumePtr getStorageVolume() const { return volume; }
     ThrottlerPtr getDiskCacheThrottler() const { return disk_cache_throttler; }
     Poco::Logger * getLogger() const { return log; }
 
+    /// Tier caches owned by DiskCacheTiered keep this off so a lookup probing
+    /// both tiers is counted once, at the tiered level.
+    void setAccountGetInProfileEvents(bool value) { account_get_in_profile_events = value; }
+
 protected:
+    /// Hit/miss counters for the get path, split by segment type (marks / part
+    /// metadata / column data) so cache efficiency can be reviewed per segment
+    /// kind. Per-query attribution comes for free through the ProfileEvents
+    /// snapshot in system.query_log.
+    static void incrementGetProfileEvents(const String & key, bool hit);
+
+    bool account_get_in_profile_events = true;
+
     Context & context;
     VolumePtr volume;
     DiskCacheSettings settings;
@@ -87,6 +115,9 @@ protected:
 private:
     bool scheduleCacheTask(const std::function<void()> & task);
 
+    /// Owner propagated into cache thread pool tasks, empty outside of them
+    static thread_local String task_cache_owner;
+
     Poco::Logger * log = &Poco::Logger::get("DiskCache");
 };
 
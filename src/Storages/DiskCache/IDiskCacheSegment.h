@@ -25,6 +25,9 @@ namespace DB
 {
 class IDiskCache;
 
+class IDiskCacheSegment;
+using IDiskCacheSegmentPtr = std::shared_ptr<IDiskCacheSegment>;
+
 class IDiskCacheSegment
 {
 public:
@@ -34,6 +37,12 @@ public:
     virtual String getSegmentName() const = 0;
     virtual void cacheToDisk(IDiskCache & diskcache) = 0;
 
+    size_t getSegmentNumber() const { return segment_number; }
+
+    /// Segments that can be prefetched ahead of access return the sibling covering
+    /// the mark range `advance` segments after this one, others return nullptr
+    virtual IDiskCacheSegmentPtr nextSegment(size_t /*advance*/) const { return nullptr; }
+
     static String formatSegmentName(
         const String & uuid, const String & part_name, const String & column_name, UInt32 segment_number, const String & extension);
 
@@ -42,7 +51,6 @@ protected:
     size_t segment_size;
 };
 
-using IDiskCacheSegmentPtr = std::shared_ptr<IDiskCacheSegment>;
 using IDiskCacheSegmentsVector = std::vector<IDiskCacheSegmentPtr>;
 
 }
@@ -37,11 +37,26 @@ public:
         }
     }
 
-    inline CacheType& shard(const Key& key)
+    inline size_t shardIndex(const Key& key) const
     {
         size_t shard_id = hasher(key);
         shard_id ^= shard_id + 0x9e3779b9 + (shard_id << 6) + (shard_id >> 2);
-        return *(containers[shard_id % shard_num]);
+        return shard_id % shard_num;
+    }
+
+    inline CacheType& shard(const Key& key)
+    {
+        return *(containers[shardIndex(key)]);
+    }
+
+    inline CacheType& shardByIndex(size_t shard_id)
+    {
+        return *(containers[shard_id]);
+    }
+
+    size_t shardCount() const
+    {
+        return shard_num;
     }
 
     size_t count() const
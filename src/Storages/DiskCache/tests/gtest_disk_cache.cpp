@@ -148,3 +148,51 @@ TEST_F(DiskCacheTest, Collect)
         }
     }
 }
+
+TEST_F(DiskCacheTest, IndexRecovery)
+{
+    auto volume = newDualDiskVolume();
+    int total_cache_num = 0;
+    std::vector<std::pair<DB::DiskPtr, std::vector<std::string>>> metas;
+    for (const DB::DiskPtr & disk : volume->getDisks())
+    {
+        std::vector<String> metas_in_disk = generateData(disk, 2, 4);
+        metas.push_back({disk, metas_in_disk});
+        total_cache_num += metas_in_disk.size();
+    }
+
+    DB::DiskCacheSettings settings;
+    settings.cache_index_enable = true;
+
+    {
+        DB::DiskCacheLRU cache(*getContext().context, volume, settings);
+        cache.load();
+        EXPECT_EQ(cache.getKeyCount(), total_cache_num);
+        // index is dumped on destruction
+    }
+
+    for (const DB::DiskPtr & disk : volume->getDisks())
+        ASSERT_TRUE(disk->exists("disk_cache_v1.index"));
+
+    DB::DiskCacheLRU recovered(*getContext().context, volume, settings);
+    recovered.load();
+    EXPECT_EQ(recovered.getKeyCount(), total_cache_num);
+
+    for (const auto & meta_in_disk : metas) {
+        auto disk = meta_in_disk.first;
+        for (const String & name : meta_in_disk.second) {
+            auto [cache_disk, cached_file] = recovered.get(name);
+            ASSERT_TRUE(!cached_file.empty());
+            ASSERT_TRUE(cache_disk->getName() == disk->getName());
+            ASSERT_TRUE(cache_disk->exists(cached_file));
+        }
+    }
+
+    // negative lookup should be answered by the bloom filter
+    auto [miss_disk, miss_file] = recovered.get("no_such_part/no_such_stream");
+    ASSERT_TRUE(miss_disk == nullptr);
+
+    // the index is consumed at most once
+    for (const DB::DiskPtr & disk : volume->getDisks())
+        ASSERT_TRUE(!disk->exists("disk_cache_v1.index"));
+}
@@ -27,6 +27,9 @@
 #include <Common/ShellCommand.h>
 #include <Common/Exception.h>
 #include <Common/formatIPv6.h>
+#include <Common/ProfileEvents.h>
+#include <map>
+#include <mutex>
 #include <random>
 #include <IO/WriteBufferFromString.h>
 #include <IO/Operators.h>
@@ -35,6 +38,12 @@
 #include <ServiceDiscovery/ServiceDiscoveryConsul.h>
 
 
+namespace ProfileEvents
+{
+    extern const Event HdfsFsPoolHit;
+    extern const Event HdfsFsPoolMiss;
+}
+
 namespace DB
 {
 namespace ErrorCodes
@@ -221,6 +230,41 @@ HDFSFSPtr createHDFSFS(hdfsBuilder * builder)
     return fs;
 }
 
+namespace
+{
+    std::mutex hdfs_fs_cache_mutex;
+    std::map<String, HDFSFSPtr> hdfs_fs_cache;
+}
+
+HDFSFSPtr getHDFSFSFromCache(const String & key, hdfsBuilder * builder)
+{
+    {
+        std::lock_guard lock(hdfs_fs_cache_mutex);
+        auto it = hdfs_fs_cache.find(key);
+        if (it != hdfs_fs_cache.end())
+        {
+            ProfileEvents::increment(ProfileEvents::HdfsFsPoolHit);
+            return it->second;
+        }
+    }
+
+    // Connect outside the lock. Concurrent misses on the same key may connect
+    // twice, the loser just overwrites the entry and its connection is released
+    // together with the buffers holding it
+    auto fs = createHDFSFS(builder);
+    ProfileEvents::increment(ProfileEvents::HdfsFsPoolMiss);
+
+    std::lock_guard lock(hdfs_fs_cache_mutex);
+    hdfs_fs_cache[key] = fs;
+    return fs;
+}
+
+void removeHDFSFSFromCache(const String & key)
+{
+    std::lock_guard lock(hdfs_fs_cache_mutex);
+    hdfs_fs_cache.erase(key);
+}
+
 std::pair<std::string, size_t> getNameNodeNNProxy(const std::string & nnproxy)
 {
     HostWithPortsVec nnproxys;
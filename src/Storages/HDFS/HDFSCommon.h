@@ -310,6 +310,12 @@ extern TTLBrokenNameNodes brokenNNs; // NameNode blacklist - TODO: make it singl
 HDFSBuilderWrapper createHDFSBuilder(const String & uri_str, const Poco::Util::AbstractConfiguration &);
 HDFSFSPtr createHDFSFS(hdfsBuilder * builder);
 
+/// Process wide pool of hdfsFS connections keyed by connection endpoint, so that
+/// concurrent read buffers of one query share filesystem connections instead of
+/// storming the namenode. hdfsFS handles are thread safe in libhdfs3.
+HDFSFSPtr getHDFSFSFromCache(const String & key, hdfsBuilder * builder);
+void removeHDFSFSFromCache(const String & key);
+
 String getNameNodeUrl(const String & hdfs_url);
 String getNameNodeCluster(const String & hdfs_url);
 
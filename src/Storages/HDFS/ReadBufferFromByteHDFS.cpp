@@ -221,9 +221,13 @@ void ReadBufferFromByteHDFS::tryConnect()
         Poco::URI uri(uriPrefix);
         do{
             // add retry on failure.
-            fs = createHDFSFS(builder.get());
-            if (fs == nullptr)
+            try
             {
+                fs = getHDFSFSFromCache(fsCacheKey(), builder.get());
+            }
+            catch (...)
+            {
+                removeHDFSFSFromCache(fsCacheKey());
                 hdfs_params.setNNProxyBroken();
                 hdfs_params.lookupOnNeed();
                 builder = hdfs_params.createBuilder(uri);
@@ -251,6 +255,10 @@ void ReadBufferFromByteHDFS::tryConnect()
 
         if (fin == nullptr)
         {
+            // The pooled connection may be stale, drop it so the next attempt reconnects
+            removeHDFSFSFromCache(fsCacheKey());
+            fs = nullptr;
+
             const char * last_err = hdfsGetLastError();
             String err_msg = last_err == nullptr ? "" : String(last_err);
             throw Exception("ReadBufferFromByteHDFS::cannot open file, " + err_msg, ErrorCodes::CANNOT_OPEN_FILE);
@@ -173,6 +173,12 @@ namespace ErrorCodes
             void tryConnect();
             off_t doSeek(off_t offset, int whence) ;
 
+            /// Pool key of the filesystem connection, see getHDFSFSFromCache
+            String fsCacheKey() const
+            {
+                return hdfs_params.toString() + "#" + uriPrefix;
+            }
+
             /// Get the position of the file corresponding to the data in buffer.
             off_t getPositionInFile()
             {
@@ -0,0 +1,95 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <Core/Block.h>
+#include <Common/HashTable/Hash.h>
+#include <Common/LRUCache.h>
+#include <Common/ProfileEvents.h>
+#include <Common/SipHash.h>
+
+namespace ProfileEvents
+{
+    extern const Event HiveChunkCacheHits;
+    extern const Event HiveChunkCacheMisses;
+}
+
+namespace DB
+{
+
+/// Estimate of the memory held by one cached decoded block.
+struct HiveChunkWeightFunction
+{
+    /// We spend additional bytes on key in hashmap, linked lists, shared pointers, etc ...
+    static constexpr size_t CHUNK_CACHE_OVERHEAD = 128;
+
+    size_t operator()(const Block & block) const { return block.allocatedBytes() + CHUNK_CACHE_OVERHEAD; }
+};
+
+/** Worker-local cache of blocks decoded from hive parquet/orc files.
+  *
+  * Decoding dominates the CPU of repeated federation queries over slowly-changing
+  * tables, while the underlying files are immutable once written. Entries are keyed
+  * by (file path, row group / stripe, read column names and types), so a schema
+  * change or a different column set never returns a stale block.
+  */
+class HiveChunkCache : public LRUCache<UInt128, Block, UInt128TrivialHash, HiveChunkWeightFunction>
+{
+private:
+    using Base = LRUCache<UInt128, Block, UInt128TrivialHash, HiveChunkWeightFunction>;
+
+public:
+    explicit HiveChunkCache(size_t max_size_in_bytes) : Base(max_size_in_bytes) { }
+
+    /// Shared by all hive tables of the process; created on first use, sized by the
+    /// hive_decoded_chunk_cache_bytes setting of the first table that enables it.
+    static HiveChunkCache & instance(size_t max_size_in_bytes)
+    {
+        static HiveChunkCache cache(max_size_in_bytes);
+        return cache;
+    }
+
+    static UInt128 hash(const String & part_path, size_t block_index, const Block & header)
+    {
+        SipHash hash;
+        hash.update(part_path.data(), part_path.size() + 1);
+        hash.update(block_index);
+        for (const auto & column : header)
+        {
+            hash.update(column.name.data(), column.name.size() + 1);
+            const auto type_name = column.type->getName();
+            hash.update(type_name.data(), type_name.size() + 1);
+        }
+
+        UInt128 key;
+        hash.get128(key);
+        return key;
+    }
+
+    MappedPtr get(const Key & key)
+    {
+        auto result = Base::get(key);
+        if (result)
+            ProfileEvents::increment(ProfileEvents::HiveChunkCacheHits);
+        else
+            ProfileEvents::increment(ProfileEvents::HiveChunkCacheMisses);
+        return result;
+    }
+};
+
+}
@@ -146,10 +146,11 @@ size_t HiveDataPart::getTotalBlockNumber() const
     return res;
 }
 
-void HiveDataPart::loadSplitMinMaxIndexes()
+void HiveDataPart::loadSplitMinMaxIndexes(const NamesAndTypesList & names_and_types) const
 {
     if (split_minmax_idxes_loaded)
         return;
+    index_names_and_types = names_and_types;
     loadSplitMinMaxIndexesImpl();
     split_minmax_idxes_loaded = true;
 }
@@ -192,7 +193,7 @@ size_t HiveParquetFile::getTotalRowGroups() const
     return res;
 }
 
-void HiveParquetFile::loadSplitMinMaxIndexesImpl()
+void HiveParquetFile::loadSplitMinMaxIndexesImpl() const
 {
     if (!disk)
         throw Exception(ErrorCodes::LOGICAL_ERROR, "Hive disk is not set");
@@ -217,7 +218,8 @@ void HiveParquetFile::loadSplitMinMaxIndexesImpl()
     {
         auto row_group_meta = meta->RowGroup(static_cast<int>(i));
         split_minmax_idxes[i] = std::make_shared<IMergeTreeDataPart::MinMaxIndex>();
-        split_minmax_idxes[i]->hyperrectangle.resize(num_cols, Range());
+        /// One range per index column, so the hyperrectangle lines up with index_names_and_types
+        split_minmax_idxes[i]->hyperrectangle.resize(index_names_and_types.size(), Range());
 
         size_t j = 0;
         auto it = index_names_and_types.begin();
@@ -308,7 +310,7 @@ void HiveORCFile::loadFileMinMaxIndexImpl()
     throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Unsupported currently");
 }
 
-void HiveORCFile::loadSplitMinMaxIndexesImpl()
+void HiveORCFile::loadSplitMinMaxIndexesImpl() const
 {
     throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Unsupported currently");
 }
@@ -101,6 +101,24 @@ struct HivePartInfo
     {
         return name;
     }
+
+    /// Bucket index encoded in the file name by hive bucketing,
+    /// e.g. part-00000-5cf7580f-a3f6-4beb-90a6-e9f4de61c887_00003.c000 -> 3.
+    /// Returns -1 when the file does not follow the bucketed layout.
+    Int64 getBucketNumber() const
+    {
+        auto slash_pos = name.find_last_of('/');
+        String file_name = slash_pos == String::npos ? name : name.substr(slash_pos + 1);
+        if (!startsWith(file_name, "part-"))
+            return -1;
+
+        auto underscore_pos = file_name.find_last_of('_');
+        auto dot_pos = file_name.find_last_of('.');
+        if (underscore_pos == String::npos || dot_pos == String::npos || dot_pos <= underscore_pos + 1)
+            return -1;
+
+        return std::atoi(file_name.substr(underscore_pos + 1, dot_pos - underscore_pos - 1).c_str());
+    }
 };
 
 class HiveDataPart : public std::enable_shared_from_this<HiveDataPart>
@@ -175,7 +193,12 @@ public:
     virtual FileFormat getFormat() const = 0;
 
     void loadFileMinMaxIndex();
-    void loadSplitMinMaxIndexes();
+
+    /// Reads per-split (row group / stripe) statistics from the file footer into
+    /// split_minmax_idxes, one hyperrectangle entry per column of names_and_types.
+    /// Parts are shared as const pointers on workers, so the loading is const with
+    /// mutable caches behind it.
+    void loadSplitMinMaxIndexes(const NamesAndTypesList & names_and_types) const;
 
 protected:
     virtual void loadFileMinMaxIndexImpl()
@@ -183,7 +206,7 @@ protected:
         throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Method loadFileMinMaxIndexImpl is not supported by hive file:{}", getFormatName());
     }
 
-    virtual void loadSplitMinMaxIndexesImpl()
+    virtual void loadSplitMinMaxIndexesImpl() const
     {
         throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Method loadSplitMinMaxIndexesImpl is not supported by hive file:{}", getFormatName());
     }
@@ -196,10 +219,10 @@ protected:
     HivePartInfo info;
 
     std::unordered_set<Int64> skip_splits = {};
-    NamesAndTypesList index_names_and_types = {};
+    mutable NamesAndTypesList index_names_and_types = {};
 
     mutable std::vector<MinMaxIndexPtr> split_minmax_idxes;
-    std::atomic<bool> split_minmax_idxes_loaded{false};
+    mutable std::atomic<bool> split_minmax_idxes_loaded{false};
 
     mutable std::atomic<bool> initialized{false};
 };
@@ -226,7 +249,7 @@ public:
 
 private:
     void loadFileMinMaxIndexImpl() override;
-    void loadSplitMinMaxIndexesImpl() override;
+    void loadSplitMinMaxIndexesImpl() const override;
 
     mutable size_t total_stripes = 0;
 };
@@ -252,10 +275,10 @@ public:
     arrow::Status tryGetTotalRowGroups(size_t & num_row_groups) const;
 
 private:
-    void loadSplitMinMaxIndexesImpl() override;
+    void loadSplitMinMaxIndexesImpl() const override;
 
     mutable size_t total_row_groups = 0;
-    std::map<String, size_t> parquet_column_positions;
+    mutable std::map<String, size_t> parquet_column_positions;
 };
 
 }
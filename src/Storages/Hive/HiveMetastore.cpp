@@ -103,6 +103,39 @@ String HiveMetastoreClient::escapeHiveTablePrefix(const String & fullpath, const
     return path.substr(fullpath.size(), path.size());
 }
 
+void HiveMetastoreClient::fetchPartitionsFromMetastore(
+    std::vector<Partition> & partitions, const String & db_name, const String & table_name, int16_t max_parts)
+{
+    const size_t batch_size = settings.hive_metastore_client_partition_batch_size;
+
+    /// A bounded listing is cheap enough for a single call; batching only pays off for full listings
+    if (batch_size == 0 || max_parts >= 0)
+    {
+        auto client_call
+            = [&](ThriftHiveMetastoreClientPool::Entry & client) { client->get_partitions(partitions, db_name, table_name, max_parts); };
+        tryCallHiveClient(client_call);
+        return;
+    }
+
+    Strings partition_names;
+    auto names_call = [&](ThriftHiveMetastoreClientPool::Entry & client) {
+        client->get_partition_names(partition_names, db_name, table_name, max_parts);
+    };
+    tryCallHiveClient(names_call);
+
+    partitions.reserve(partition_names.size());
+    for (size_t i = 0; i < partition_names.size(); i += batch_size)
+    {
+        Strings batch(partition_names.begin() + i, partition_names.begin() + std::min(partition_names.size(), i + batch_size));
+        std::vector<Partition> fetched;
+        auto batch_call = [&](ThriftHiveMetastoreClientPool::Entry & client) {
+            client->get_partitions_by_names(fetched, db_name, table_name, batch);
+        };
+        tryCallHiveClient(batch_call);
+        partitions.insert(partitions.end(), std::make_move_iterator(fetched.begin()), std::make_move_iterator(fetched.end()));
+    }
+}
+
 Strings HiveMetastoreClient::getPartitionIDsFromMetastore(
     [[maybe_unused]] const StoragePtr & storage,
     const String & db_name,
@@ -112,9 +145,7 @@ Strings HiveMetastoreClient::getPartitionIDsFromMetastore(
 {
     std::vector<Partition> partitions;
     Strings res;
-    auto client_call
-        = [&](ThriftHiveMetastoreClientPool::Entry & client) { client->get_partitions(partitions, db_name, table_name, max_parts); };
-    tryCallHiveClient(client_call);
+    fetchPartitionsFromMetastore(partitions, db_name, table_name, max_parts);
 
     for (const auto & partition : partitions)
     {
@@ -147,9 +178,7 @@ HivePartitionVector HiveMetastoreClient::getPartitionsFromMetastore(
     int16_t max_parts)
 {
     std::vector<Partition> partitions;
-    auto client_call
-        = [&](ThriftHiveMetastoreClientPool::Entry & client) { client->get_partitions(partitions, db_name, table_name, max_parts); };
-    tryCallHiveClient(client_call);
+    fetchPartitionsFromMetastore(partitions, db_name, table_name, max_parts);
 
     if (partitions.empty())
         return {};
@@ -201,7 +230,7 @@ HivePartitionVector HiveMetastoreClient::getPartitionsFromMetastore(
     return res;
 }
 
-HivePartitionVector HiveMetastoreClient::getPartitionsByFilter(
+HivePartitionVector HiveMetastoreClient::getPartitionsByFilterFromMetastore(
     [[maybe_unused]] const StoragePtr & storage,
     const String & db_name,
     const String & table_name,
@@ -264,11 +293,122 @@ HivePartitionVector HiveMetastoreClient::getPartitionsByFilter(
     return res;
 }
 
+String HiveMetastoreClient::getTableVersion(const String & db_name, const String & table_name)
+{
+    Table table;
+    getTable(table, db_name, table_name);
+
+    String version;
+    auto it = table.parameters.find("transient_lastDdlTime");
+    if (it != table.parameters.end())
+        version = it->second;
+
+    auto nit = table.parameters.find("numPartitions");
+    if (nit != table.parameters.end())
+        version += "_" + nit->second;
+
+    if (version.empty())
+        version = std::to_string(table.createTime) + "_" + std::to_string(table.lastAccessTime);
+
+    return version;
+}
+
+bool HiveMetastoreClient::isCacheEntryValid(const PartitionCacheEntry & entry, const String & table_version, time_t now) const
+{
+    if (entry.table_version != table_version)
+        return false;
+    UInt64 ttl = settings.hive_partition_cache_ttl_sec;
+    return ttl == 0 || now <= entry.load_time + static_cast<time_t>(ttl);
+}
+
 HivePartitionVector HiveMetastoreClient::getPartitionList(
     const StoragePtr & storage, const String & db_name, const String & table_name, const String & table_path, int16_t max_parts)
 {
-    //if no cache
-    return getPartitionsFromMetastore(storage, db_name, table_name, table_path, max_parts);
+    /// Bounded listings are not cached: the result depends on max_parts
+    if (!settings.enable_hive_partition_cache || max_parts >= 0)
+        return getPartitionsFromMetastore(storage, db_name, table_name, table_path, max_parts);
+
+    /// One cheap get_table call validates the cache instead of a full partition listing
+    const String cache_key = db_name + "." + table_name;
+    const String table_version = getTableVersion(db_name, table_name);
+    const time_t now = time(nullptr);
+
+    {
+        std::lock_guard lock(mutex);
+        auto it = partition_cache.find(cache_key);
+        if (it != partition_cache.end() && isCacheEntryValid(it->second, table_version, now) && it->second.all_partitions)
+        {
+            LOG_TRACE(
+                &Poco::Logger::get("HiveMetastoreClient"),
+                "Partition cache hit for {} with {} partitions",
+                cache_key,
+                it->second.all_partitions->size());
+            return *it->second.all_partitions;
+        }
+    }
+
+    auto partitions = getPartitionsFromMetastore(storage, db_name, table_name, table_path, max_parts);
+
+    {
+        std::lock_guard lock(mutex);
+        auto & entry = partition_cache[cache_key];
+        if (entry.table_version != table_version)
+            entry = {};
+        entry.table_version = table_version;
+        entry.load_time = now;
+        entry.all_partitions = partitions;
+    }
+
+    return partitions;
+}
+
+HivePartitionVector HiveMetastoreClient::getPartitionsByFilter(
+    const StoragePtr & storage,
+    const String & db_name,
+    const String & table_name,
+    const String & table_path,
+    const String & filter,
+    int16_t max_parts)
+{
+    if (!settings.enable_hive_partition_cache || max_parts >= 0)
+        return getPartitionsByFilterFromMetastore(storage, db_name, table_name, table_path, filter, max_parts);
+
+    const String cache_key = db_name + "." + table_name;
+    const String table_version = getTableVersion(db_name, table_name);
+    const time_t now = time(nullptr);
+
+    {
+        std::lock_guard lock(mutex);
+        auto it = partition_cache.find(cache_key);
+        if (it != partition_cache.end() && isCacheEntryValid(it->second, table_version, now))
+        {
+            auto fit = it->second.partitions_by_filter.find(filter);
+            if (fit != it->second.partitions_by_filter.end())
+            {
+                LOG_TRACE(
+                    &Poco::Logger::get("HiveMetastoreClient"),
+                    "Partition cache hit for {} filter '{}' with {} partitions",
+                    cache_key,
+                    filter,
+                    fit->second.size());
+                return fit->second;
+            }
+        }
+    }
+
+    auto partitions = getPartitionsByFilterFromMetastore(storage, db_name, table_name, table_path, filter, max_parts);
+
+    {
+        std::lock_guard lock(mutex);
+        auto & entry = partition_cache[cache_key];
+        if (entry.table_version != table_version)
+            entry = {};
+        entry.table_version = table_version;
+        entry.load_time = now;
+        entry.partitions_by_filter[filter] = partitions;
+    }
+
+    return partitions;
 }
 
 bool HiveMetastoreClient::getDataPartIndex(const String & part_name, Int64 & index)
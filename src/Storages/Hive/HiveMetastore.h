@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <optional>
+#include <unordered_map>
 #include <thrift/protocol/TBinaryProtocol.h>
 #include <thrift/transport/TSocket.h>
 #include <thrift/transport/TTransportUtils.h>
@@ -134,6 +136,18 @@ private:
 
     HivePartitionVector getPartitionsFromMetastore(
         const StoragePtr & storage, const String & db_name, const String & table_name, const String & table_path, int16_t max_parts = -1);
+    HivePartitionVector getPartitionsByFilterFromMetastore(
+        const StoragePtr & storage,
+        const String & db_name,
+        const String & table_name,
+        const String & table_path,
+        const String & filter,
+        int16_t max_parts = -1);
+
+    /// Fetches partition metadata in batches of hive_metastore_client_partition_batch_size names,
+    /// so listings of 100k-partition tables do not hit thrift response limits or HMS timeouts
+    void fetchPartitionsFromMetastore(
+        std::vector<Apache::Hadoop::Hive::Partition> & partitions, const String & db_name, const String & table_name, int16_t max_parts);
     Strings getPartitionIDsFromMetastore(
         [[maybe_unused]] const StoragePtr & storage,
         const String & db_name,
@@ -147,9 +161,26 @@ private:
     DataTypePtr
     parseColumnType(const std::unordered_map<String, std::shared_ptr<IDataType>> & hive_type_to_internal_type, const String & hive_type);
 
+    /// Client-side partition cache. Listings are keyed by table (and filter string for
+    /// filtered listings) and stay valid while the table version - derived from the
+    /// transient_lastDdlTime parameter - is unchanged and the TTL has not expired.
+    /// The TTL guards against files added to existing partitions, which does not bump
+    /// the DDL time.
+    struct PartitionCacheEntry
+    {
+        String table_version;
+        time_t load_time = 0;
+        std::optional<HivePartitionVector> all_partitions;
+        std::unordered_map<String, HivePartitionVector> partitions_by_filter;
+    };
+
+    String getTableVersion(const String & db_name, const String & table_name);
+    bool isCacheEntryValid(const PartitionCacheEntry & entry, const String & table_version, time_t now) const;
+
     ThriftHiveMetastoreClientPool client_pool;
     const CnchHiveSettings settings;
     mutable std::mutex mutex;
+    std::unordered_map<String, PartitionCacheEntry> partition_cache;
     // Poco::Logger * log{};
 };
 
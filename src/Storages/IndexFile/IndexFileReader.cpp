@@ -58,6 +58,20 @@ Status IndexFileReader::Get(const ReadOptions & options, const Slice & key, Stri
     return rep->table_reader->Get(options, key, value);
 }
 
+Status IndexFileReader::MultiGet(const ReadOptions & options, const std::vector<Slice> & keys, std::vector<String> * values, std::vector<Status> * statuses)
+{
+    if (!rep->table_reader)
+        return Status::InvalidArgument("File is not opened");
+    return rep->table_reader->MultiGet(options, keys, values, statuses);
+}
+
+Status IndexFileReader::LargestKeyUpperBound(String * key) const
+{
+    if (!rep->table_reader)
+        return Status::InvalidArgument("File is not opened");
+    return rep->table_reader->LargestKeyUpperBound(key);
+}
+
 Status IndexFileReader::NewIterator(const ReadOptions & options, std::unique_ptr<Iterator> * out)
 {
     if (!rep->table_reader)
@@ -41,6 +41,17 @@ public:
     /// May return some other Status on an error.
     Status Get(const ReadOptions & options, const Slice & key, String * value);
 
+    /// Batched version of Get() for a key set sorted by the table comparator.
+    /// Fills a value and a per-key status (OK/NotFound/error) for each key.
+    /// Keys sharing a data block are answered with one block read while the
+    /// block is pinned in the block cache. See Table::MultiGet.
+    Status MultiGet(const ReadOptions & options, const std::vector<Slice> & keys, std::vector<String> * values, std::vector<Status> * statuses);
+
+    /// Sets *key to an upper bound of the largest key in the file without
+    /// reading any data block. Returns NotFound if the file contains no
+    /// entries. See Table::LargestKeyUpperBound.
+    Status LargestKeyUpperBound(String * key) const;
+
     /// Return an iterator over KVs in this file.
     /// Note: client should make sure this IndexFileRead lives longer than the returned iterator.
     Status NewIterator(const ReadOptions & options, std::unique_ptr<Iterator> * out);
@@ -308,6 +308,70 @@ Status Table::Get(const ReadOptions & options, const Slice & k, std::string * va
     return notfound;
 }
 
+Status Table::MultiGet(const ReadOptions & options, const std::vector<Slice> & keys, std::vector<std::string> * values, std::vector<Status> * statuses)
+{
+    values->resize(keys.size());
+    statuses->assign(keys.size(), Status::NotFound(Slice()));
+
+    std::unique_ptr<Iterator> iiter(rep_->index_block->NewIterator(rep_->options.comparator));
+    FilterBlockReader * filter = rep_->filter;
+
+    size_t i = 0;
+    while (i < keys.size())
+    {
+        /// Seek the index block once per data block: every remaining key not greater
+        /// than the current index entry falls into the same block.
+        iiter->Seek(keys[i]);
+        if (Status s = iiter->status(); !s.ok())
+            return s;
+        if (!iiter->Valid())
+            break; /// remaining keys are past the last block, leave them NotFound
+
+        Slice handle_value = iiter->value();
+        BlockHandle handle;
+        bool has_handle = handle.DecodeFrom(&handle_value).ok();
+
+        /// Opened lazily since the bloom filter may reject every key in this range.
+        /// Its cleanup holds the block cache handle, so the block stays pinned until
+        /// the whole batch for this block is answered.
+        std::unique_ptr<Iterator> block_iter;
+        for (; i < keys.size() && rep_->options.comparator->Compare(keys[i], iiter->key()) <= 0; ++i)
+        {
+            if (filter != nullptr && has_handle && !filter->KeyMayMatch(handle.offset(), keys[i]))
+                continue;
+
+            if (!block_iter)
+                block_iter.reset(BlockReader(this, options, iiter->value()));
+            block_iter->Seek(keys[i]);
+            if (Status s = block_iter->status(); !s.ok())
+            {
+                (*statuses)[i] = s;
+                continue;
+            }
+            if (block_iter->Valid() && rep_->options.comparator->Compare(keys[i], block_iter->key()) == 0)
+            {
+                Slice value_slice = block_iter->value();
+                (*values)[i].assign(value_slice.data(), value_slice.size());
+                (*statuses)[i] = Status::OK();
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status Table::LargestKeyUpperBound(std::string * key) const
+{
+    std::unique_ptr<Iterator> iiter(rep_->index_block->NewIterator(rep_->options.comparator));
+    iiter->SeekToLast();
+    if (Status s = iiter->status(); !s.ok())
+        return s;
+    if (!iiter->Valid())
+        return Status::NotFound(Slice());
+    Slice last = iiter->key();
+    key->assign(last.data(), last.size());
+    return Status::OK();
+}
+
 size_t Table::ResidentMemoryUsage() const
 {
     return sizeof(Rep) + rep_->index_block->size() + rep_->filter_size;
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <Storages/IndexFile/Iterator.h>
 
@@ -51,6 +52,21 @@ public:
     /// Return other error status otherwise.
     Status Get(const ReadOptions &, const Slice & key, std::string * value);
 
+    /// Batched point lookups. `keys' must be sorted by the table comparator.
+    /// Resizes *values and *statuses to keys.size() and fills, for each key,
+    /// either OK (with the value set), NotFound, or an error status.
+    /// Consecutive keys that fall into the same data block are answered with a
+    /// single block read, and the block stays pinned in the block cache until
+    /// all keys of the batch are resolved.
+    /// Returns a non-ok status only when reading the index block fails.
+    Status MultiGet(const ReadOptions &, const std::vector<Slice> & keys, std::vector<std::string> * values, std::vector<Status> * statuses);
+
+    /// Sets *key to an upper bound of the largest key in the table: the last
+    /// separator of the in-memory index block, which is not necessarily an
+    /// existing key. Cheap, no data block is read.
+    /// Returns NotFound if the table contains no entries.
+    Status LargestKeyUpperBound(std::string * key) const;
+
     /// Total bytes of resident memory usage.
     /// This will exclude memory used by data in block cache.
     size_t ResidentMemoryUsage() const;
@@ -529,7 +529,7 @@ IngestPartition::IngestSources IngestPartition::generateSourceBlocks(MergeTreeDa
                                                     const MergeTreeData::DataPartsVector & parts_to_read,
                                                     const Names & all_columns_with_partition_key)
 {
-    auto settings = context->getSettingsRef();
+    auto & settings = context->getSettingsRef();
     IngestPartition::IngestSources src_blocks;
     auto match_type = std::make_shared<DataTypeUInt8>();
 
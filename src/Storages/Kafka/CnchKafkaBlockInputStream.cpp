@@ -169,6 +169,20 @@ void CnchKafkaBlockInputStream::readPrefixImpl()
     storage.subscribeBuffer(delimited_buffer);
     const auto * sub_buffer = delimited_buffer->subBufferAs<CnchReadBufferFromKafkaConsumer>();
 
+#if USE_SIMDJSON
+    /// Flat JSONEachRow schemas can skip the generic row format entirely and let simdjson
+    /// scan each payload straight into the columns; per-row read callbacks and defaults
+    /// calculation are incompatible with whole-payload parsing, so those keep the row path
+    if (storage.settings.enable_simd_json_parsing && storage.settings.format.value == "JSONEachRow"
+        && virtual_column_names.empty() && !(context->getSettingsRef().insert_null_as_default && need_add_defaults)
+        && KafkaFlatJSONParser::isSupportedSchema(non_virtual_header))
+    {
+        flat_json_parser = std::make_unique<KafkaFlatJSONParser>(non_virtual_header);
+        broken = true;
+        return;
+    }
+#endif
+
     FormatFactory::ReadCallback read_callback;
     if (!virtual_column_names.empty())
     {
@@ -183,7 +197,18 @@ void CnchKafkaBlockInputStream::readPrefixImpl()
         };
     }
 
-    auto child = FormatFactory::instance().getInput(storage.settings.format.value,
+    /// A single librdkafka consumer may feed a pool of parser threads: messages are still
+    /// polled serially by the segmentating thread, so the offsets committed after the block
+    /// is written reflect poll order as before — only parsing is fanned out. Per-row read
+    /// callbacks cannot run in parser threads, so virtual columns force a single parser.
+    const bool parallel_parsing = storage.settings.enable_parallel_parsing && virtual_column_names.empty();
+
+    InputFormatPtr child;
+    if (parallel_parsing)
+        child = FormatFactory::instance().getInput(storage.settings.format.value,
+                                                 *delimited_buffer, non_virtual_header, context, max_block_size);
+    else
+        child = FormatFactory::instance().getInputFormat(storage.settings.format.value,
                                                  *delimited_buffer, non_virtual_header, context, max_block_size);
 
     if (auto *row_input = dynamic_cast<IRowInputFormat*>(child.get()))
@@ -202,7 +227,7 @@ void CnchKafkaBlockInputStream::readPrefixImpl()
                                           }
                                        });
     }
-    else
+    else if (!parallel_parsing)
         throw Exception("An input format based on IRowInputFormat is expected, but provided: " + child->getName(), ErrorCodes::LOGICAL_ERROR);
 
     if (context->getSettingsRef().insert_null_as_default && need_add_defaults)
@@ -226,8 +251,38 @@ void CnchKafkaBlockInputStream::readPrefixImpl()
     broken = true;
 }
 
+#if USE_SIMDJSON
+Block CnchKafkaBlockInputStream::readWithFlatJSONParser()
+{
+    auto * read_buf = delimited_buffer->subBufferAs<CnchReadBufferFromKafkaConsumer>();
+    MutableColumns columns = non_virtual_header.cloneEmptyColumns();
+
+    /// Each buffer window is exactly one message payload pointing into the librdkafka
+    /// message, so parsing happens directly on the polled data
+    size_t rows = 0;
+    while (rows < max_block_size && !read_buf->eof())
+    {
+        rows += flat_json_parser->parseMessage(read_buf->position(), read_buf->available(), columns);
+        read_buf->position() += read_buf->available();
+    }
+
+    if (!rows)
+        return {};
+
+    Block block = non_virtual_header.cloneWithColumns(std::move(columns));
+    return ConvertingBlockInputStream(
+        std::make_shared<OneBlockInputStream>(block), getHeader(),
+        ConvertingBlockInputStream::MatchColumnsMode::Name).read();
+}
+#endif
+
 Block CnchKafkaBlockInputStream::readImpl()
 {
+#if USE_SIMDJSON
+    if (flat_json_parser)
+        return readWithFlatJSONParser();
+#endif
+
     Block block = children.back()->read();
     if (!block)
         return block;
@@ -22,6 +22,7 @@
 #include <Interpreters/KafkaLog.h>
 
 #include <Storages/Kafka/StorageCloudKafka.h>
+#include <Storages/Kafka/KafkaFlatJSONParser.h>
 
 namespace DB
 {
@@ -62,6 +63,12 @@ private:
     BufferPtr delimited_buffer;
     bool broken = true, claimed = false;
 
+#if USE_SIMDJSON
+    /// Fast path for flat JSONEachRow schemas, see KafkaFlatJSONParser
+    std::unique_ptr<KafkaFlatJSONParser> flat_json_parser;
+    Block readWithFlatJSONParser();
+#endif
+
     const Block non_virtual_header, virtual_header;
 };
 
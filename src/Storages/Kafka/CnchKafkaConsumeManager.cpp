@@ -198,6 +198,7 @@ void CnchKafkaConsumeManager::iterate(StorageCnchKafka & kafka_table)
 
     bool partitions_changed{false};
     updatePartitionCountOfTopics(kafka_table, partitions_changed);
+    updateConsumersTargetByLag(kafka_table, partitions_changed);
 
     if (partitions_changed)
         assignPartitionsToConsumers(kafka_table);
@@ -399,7 +400,7 @@ void CnchKafkaConsumeManager::updatePartitionCountOfTopics(StorageCnchKafka & ka
 
 void CnchKafkaConsumeManager::assignPartitionsToConsumers(StorageCnchKafka & kafka_table)
 {
-    size_t consumers_num = kafka_table.getConsumersNum();
+    size_t consumers_num = consumers_target ? consumers_target : kafka_table.getConsumersNum();
     consumers_num = std::min(consumers_num, max_needed_consumers);
 
     std::lock_guard lock(consumer_info_mutex);
@@ -425,6 +426,82 @@ void CnchKafkaConsumeManager::assignPartitionsToConsumers(StorageCnchKafka & kaf
     }
 }
 
+void CnchKafkaConsumeManager::updateConsumersTargetByLag(StorageCnchKafka & kafka_table, bool & partitions_changed)
+{
+    const auto & settings = kafka_table.getSettings();
+    const size_t base_consumers = std::min<size_t>(kafka_table.getConsumersNum(), max_needed_consumers);
+    const size_t max_consumers = std::min<size_t>(settings.max_auto_consumers.value, max_needed_consumers);
+    if (max_consumers <= base_consumers)
+    {
+        consumers_target = 0;
+        return;
+    }
+
+    /// Sample the total lag: broker high watermarks vs. offsets committed to catalog
+    cppkafka::TopicPartitionList tpl;
+    for (const auto & [topic, partition_cnt] : num_partitions_of_topics)
+        for (size_t p = 0; p < partition_cnt; ++p)
+            tpl.emplace_back(topic, p);
+    getContext()->getCnchCatalog()->getKafkaOffsets(kafka_table.getGroupForBytekv(), tpl);
+
+    Int64 total_lag = 0;
+    for (const auto & tp : tpl)
+    {
+        try
+        {
+            auto [low, high] = tool_consumer->query_offsets(tp);
+            const Int64 committed = tp.get_offset() >= 0 ? tp.get_offset() : low;
+            total_lag += std::max<Int64>(0, high - committed);
+        }
+        catch (const cppkafka::Exception & e)
+        {
+            LOG_WARNING(log, "Failed to query watermark offsets for {}[{}]: {}", tp.get_topic(), tp.get_partition(), e.what());
+            return; /// keep the current target on incomplete samples
+        }
+    }
+
+    const time_t now = time(nullptr);
+    Int64 slope = 0;
+    if (last_lag_sample_time && now > last_lag_sample_time && last_total_lag >= 0)
+        slope = (total_lag - last_total_lag) / (now - last_lag_sample_time);
+    const bool first_sample = last_total_lag < 0;
+    last_total_lag = total_lag;
+    last_lag_sample_time = now;
+    if (first_sample)
+        return;
+
+    const size_t current = consumers_target ? consumers_target : base_consumers;
+    size_t new_target = current;
+
+    if (total_lag > static_cast<Int64>(settings.auto_scale_lag_threshold.value) && slope >= 0 && current < max_consumers)
+    {
+        new_target = current + 1;
+        lag_low_ticks = 0;
+    }
+    else if (total_lag < static_cast<Int64>(settings.auto_scale_lag_threshold.value) / 2 && current > base_consumers)
+    {
+        /// Scale down conservatively: each resize restarts all consumers,
+        /// so require several consecutive low-lag samples first
+        if (++lag_low_ticks >= 5)
+        {
+            new_target = current - 1;
+            lag_low_ticks = 0;
+        }
+    }
+    else
+        lag_low_ticks = 0;
+
+    if (new_target != current)
+    {
+        LOG_INFO(log, "Autoscaling consumers of {} from {} to {} (total lag {}, slope {}/s)",
+                 storage_id.getNameForLogs(), current, new_target, total_lag, slope);
+        consumers_target = new_target;
+        partitions_changed = true;
+    }
+    else
+        consumers_target = (current == base_consumers) ? 0 : current;
+}
+
 static String replaceCreateTableQuery(ContextPtr context, String & query, const String & new_table_name, const bool change_engine, bool enable_staging_area)
 {
     const auto & context_settings = context->getSettings();
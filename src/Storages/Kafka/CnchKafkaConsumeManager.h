@@ -86,6 +86,7 @@ private:
 
     CnchWorkerClientPtr selectWorker(size_t index, const String & table_suffix);
     void assignPartitionsToConsumers(StorageCnchKafka & kafka_table);
+    void updateConsumersTargetByLag(StorageCnchKafka & kafka_table, bool & partitions_changed);
 
     bool checkTargetTable(const StorageCnchMergeTree *);
     void checkConsumerStatus(ConsumerInfo & info);
@@ -107,6 +108,13 @@ private:
 
     size_t max_needed_consumers{1};
     std::vector<ConsumerInfo> consumer_infos;
+
+    /// Lag-slope based consumer autoscaling, see updateConsumersTargetByLag().
+    /// 0 means "use the num_consumers table setting as-is".
+    size_t consumers_target{0};
+    Int64 last_total_lag{-1};
+    time_t last_lag_sample_time{0};
+    size_t lag_low_ticks{0};
     KafkaConsumerSchedulerPtr consumer_scheduler;
 
     std::atomic<bool> cloud_table_has_unique_key{false};
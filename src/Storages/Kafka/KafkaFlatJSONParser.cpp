@@ -0,0 +1,168 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Storages/Kafka/KafkaFlatJSONParser.h>
+
+#if USE_RDKAFKA && USE_SIMDJSON
+
+#include <Common/Exception.h>
+#include <DataTypes/DataTypeNullable.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int INCORRECT_DATA;
+    extern const int LOGICAL_ERROR;
+}
+
+std::optional<KafkaFlatJSONParser::Kind> KafkaFlatJSONParser::classify(const IDataType & type)
+{
+    WhichDataType which(type);
+    if (which.isStringOrFixedString())
+        return Kind::String;
+    if (which.isNativeInt())
+        return Kind::Int;
+    if (which.isNativeUInt())
+        return Kind::UInt;
+    if (which.isFloat())
+        return Kind::Float;
+    return {};
+}
+
+bool KafkaFlatJSONParser::isSupportedSchema(const Block & header)
+{
+    if (!header.columns())
+        return false;
+    for (const auto & column : header)
+        if (!classify(*removeNullable(column.type)))
+            return false;
+    return true;
+}
+
+KafkaFlatJSONParser::KafkaFlatJSONParser(const Block & header)
+{
+    specs.reserve(header.columns());
+    for (const auto & column : header)
+    {
+        auto kind = classify(*removeNullable(column.type));
+        if (!kind)
+            throw Exception(
+                "Column " + column.name + " of type " + column.type->getName() + " is not supported by the flat JSON parser",
+                ErrorCodes::LOGICAL_ERROR);
+        specs.push_back({column.name, *kind});
+    }
+}
+
+void KafkaFlatJSONParser::insertValue(IColumn & column, const ColumnSpec & spec, const simdjson::dom::element & value) const
+{
+    auto throw_type_mismatch = [&]
+    {
+        throw Exception(
+            "Cannot parse JSON value of field " + spec.name + " as " + (spec.kind == Kind::String ? "string" : "number"),
+            ErrorCodes::INCORRECT_DATA);
+    };
+
+    switch (spec.kind)
+    {
+        case Kind::Int:
+        {
+            int64_t v{};
+            bool b{};
+            if (!value.get(v))
+                column.insert(v);
+            else if (!value.get(b))
+                column.insert(static_cast<Int64>(b));
+            else
+                throw_type_mismatch();
+            break;
+        }
+        case Kind::UInt:
+        {
+            uint64_t v{};
+            int64_t sv{};
+            bool b{};
+            if (!value.get(v))
+                column.insert(v);
+            else if (!value.get(sv) && sv >= 0)
+                column.insert(static_cast<UInt64>(sv));
+            else if (!value.get(b))
+                column.insert(static_cast<UInt64>(b));
+            else
+                throw_type_mismatch();
+            break;
+        }
+        case Kind::Float:
+        {
+            double v{};
+            int64_t sv{};
+            uint64_t uv{};
+            if (!value.get(v))
+                column.insert(v);
+            else if (!value.get(sv))
+                column.insert(static_cast<Float64>(sv));
+            else if (!value.get(uv))
+                column.insert(static_cast<Float64>(uv));
+            else
+                throw_type_mismatch();
+            break;
+        }
+        case Kind::String:
+        {
+            std::string_view v;
+            if (value.get(v))
+                throw_type_mismatch();
+            column.insert(String(v));
+            break;
+        }
+    }
+}
+
+size_t KafkaFlatJSONParser::parseMessage(const char * data, size_t size, MutableColumns & columns)
+{
+    simdjson::dom::document_stream stream;
+    /// simdjson copies the payload into its own padded buffer once; all field scanning
+    /// then happens in place without per-field allocations
+    if (auto error = parser.parse_many(reinterpret_cast<const uint8_t *>(data), size, simdjson::dom::DEFAULT_BATCH_SIZE).get(stream))
+        throw Exception(String("Cannot parse JSON: ") + simdjson::error_message(error), ErrorCodes::INCORRECT_DATA);
+
+    size_t rows = 0;
+    for (auto doc_result : stream)
+    {
+        simdjson::dom::element doc;
+        if (auto error = doc_result.get(doc))
+            throw Exception(String("Cannot parse JSON document: ") + simdjson::error_message(error), ErrorCodes::INCORRECT_DATA);
+
+        for (size_t i = 0; i < specs.size(); ++i)
+        {
+            const auto & spec = specs[i];
+            auto & column = *columns[i];
+
+            simdjson::dom::element value;
+            /// Missing or null fields become NULL for Nullable columns and the default value otherwise
+            if (doc.at_key(spec.name).get(value) || value.is_null())
+                column.insertDefault();
+            else
+                insertValue(column, spec, value);
+        }
+        ++rows;
+    }
+    return rows;
+}
+
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <Common/config.h>
+#if !defined(ARCADIA_BUILD)
+#    include "config_functions.h"
+#endif
+
+#if USE_RDKAFKA && USE_SIMDJSON
+
+#include <Core/Block.h>
+#include <simdjson.h>
+
+namespace DB
+{
+
+/** Parses flat NDJSON Kafka message payloads straight into columns with simdjson.
+  *
+  * The generic JSONEachRow path tokenizes every field with per-character reads and
+  * per-field allocations; simdjson scans the whole payload with SIMD instead, so this
+  * is used as a fast path by CnchKafkaBlockInputStream when the table settings allow
+  * it. Only flat schemas with plain (optionally Nullable) numeric and string columns
+  * are supported; richer schemas keep the generic row-format path.
+  */
+class KafkaFlatJSONParser
+{
+public:
+    /// Whether every column of the header can be filled by this parser
+    static bool isSupportedSchema(const Block & header);
+
+    explicit KafkaFlatJSONParser(const Block & header);
+
+    /// Parses all JSON documents of one message payload, appending one row per document.
+    /// Returns the number of rows added; throws on malformed or type-mismatched input.
+    size_t parseMessage(const char * data, size_t size, MutableColumns & columns);
+
+private:
+    enum class Kind
+    {
+        Int,
+        UInt,
+        Float,
+        String,
+    };
+
+    struct ColumnSpec
+    {
+        String name;
+        Kind kind;
+    };
+
+    static std::optional<Kind> classify(const IDataType & type);
+
+    void insertValue(IColumn & column, const ColumnSpec & spec, const simdjson::dom::element & value) const;
+
+    std::vector<ColumnSpec> specs;
+    simdjson::dom::parser parser;
+};
+
+}
+
+#endif
@@ -52,6 +52,12 @@ class ASTStorage;
     M(String, format_schema_path, "", "Path for schema (used by schema-based formats) and usually be hdfs path", 0) \
     M(UInt64, skip_broken_messages, 0, "Skip at least this number of broken messages from Kafka topic per block", 0) \
     M(Bool, thread_per_consumer, false, "Provide independent thread for each consumer", 0) \
+    M(Bool, enable_parallel_parsing, false, "Fan polled messages out to a pool of parser threads within each consumer; requires a row-based format and takes effect only when no virtual column is consumed", 0) \
+    M(UInt64, write_batch_min_bytes, 0, "Accumulate consumed blocks up to this many bytes before dumping parts, to reduce the number of tiny parts; 0 disables batching", 0) \
+    M(Milliseconds, write_batch_timeout_ms, 5000, "Flush an accumulated write batch that has not reached write_batch_min_bytes after this long", 0) \
+    M(UInt64, max_auto_consumers, 0, "Upper bound for lag-based consumer autoscaling; 0 disables autoscaling and num_consumers stays fixed", 0) \
+    M(UInt64, auto_scale_lag_threshold, 1000000, "Total lag in messages above which a growing lag adds one consumer; dropping below half of it eventually removes one", 0) \
+    M(Bool, enable_simd_json_parsing, false, "Parse JSONEachRow payloads with simdjson straight into columns; takes effect only for flat numeric/string schemas without virtual columns", 0) \
     M(HandleKafkaErrorMode, kafka_handle_error_mode, HandleKafkaErrorMode::DEFAULT, "How to handle errors for Kafka engine. Passible values: default, stream.", 0) \
     \
     /* Settings added for Bytedance kafka */ \
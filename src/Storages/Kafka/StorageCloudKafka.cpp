@@ -25,6 +25,7 @@
 #include <Common/SettingsChanges.h>
 #include <Core/Settings.h>
 #include <DataStreams/CountingBlockOutputStream.h>
+#include <DataStreams/SquashingTransform.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/DatabaseCatalog.h>
 #include <Interpreters/loadMetadata.h>
@@ -464,6 +465,15 @@ bool StorageCloudKafka::streamToViews(/* required_column_names */)
     //consume_context.setSetting("min_insert_block_size_rows", UInt64(1));
     consume_context->applySettingsChanges(settings_adjustments);
 
+    if (settings.enable_parallel_parsing)
+    {
+        /// Required by FormatFactory::getInput to fan parsing out to a thread pool
+        /// (segmentator + at least two parsers + reader), see CnchKafkaBlockInputStream
+        consume_context->setSetting("input_format_parallel_parsing", true);
+        if (consume_context->getSettingsRef().max_threads < 4)
+            consume_context->setSetting("max_threads", UInt64(4));
+    }
+
     consume_context->setSessionContext(consume_context);
 
     auto server_client = consume_context->getCnchServerClient(server_client_address);
@@ -564,7 +574,7 @@ void StorageCloudKafka::streamCopyData(IBlockInputStream &from, IBlockOutputStre
     to.writePrefix();
 
     UInt64 commit_rows{0}, commit_bytes{0};
-    while (Block block = from.read())
+    auto write_block = [&] (Block & block)
     {
         /// Add group and tpl in transaction for committing
         current_txn->setKafkaTpl(getGroupForBytekv(), getCurrentConsumptionOffsets());
@@ -584,6 +594,38 @@ void StorageCloudKafka::streamCopyData(IBlockInputStream &from, IBlockOutputStre
 
         commit_rows += kafka_write_log.metric;
         commit_bytes += kafka_write_log.bytes;
+    };
+
+    /// Optionally accumulate polled blocks before writing: every write dumps one part per
+    /// partition key, so squashing small poll batches keeps the merge pipeline sane.
+    /// Accumulation never crosses the transaction: offsets are committed atomically with
+    /// the parts, so everything consumed here must be written before writeSuffix().
+    std::optional<SquashingTransform> squashing;
+    const auto batch_timeout_ms = static_cast<UInt64>(settings.write_batch_timeout_ms.totalMilliseconds());
+    if (settings.write_batch_min_bytes.value)
+        squashing.emplace(/* min_block_size_rows */ 0, settings.write_batch_min_bytes.value);
+    Stopwatch batch_watch;
+
+    while (Block block = from.read())
+    {
+        if (squashing)
+        {
+            const bool timed_out = batch_timeout_ms && batch_watch.elapsedMilliseconds() >= batch_timeout_ms;
+            block = squashing->add(std::move(block));
+            if (!block && timed_out)
+                block = squashing->add({});
+            if (!block)
+                continue;
+            batch_watch.restart();
+        }
+
+        write_block(block);
+    }
+
+    if (squashing)
+    {
+        if (Block block = squashing->add({}))
+            write_block(block);
     }
 
     if (from.getProfileInfo().hasAppliedLimit())
@@ -0,0 +1,258 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// Ingestion micro benchmark for the CnchKafka consume path.
+///
+/// Drives produce -> poll -> batch -> offset-commit through the same
+/// CnchReadBufferFromKafkaConsumer the consume manager uses, and reports
+/// messages/sec, MiB/s and the produce-to-consume latency distribution.
+/// By default it runs fully self contained against librdkafka's embedded
+/// mock cluster (test.mock.num.brokers); pass --brokers to point it at a
+/// real cluster instead.
+///
+/// The dump/commit-to-catalog stage needs a live CNCH server and is not
+/// exercised here; the numbers cover everything up to the committed offset,
+/// which is where consume side regressions show up first.
+///
+/// Examples:
+///     kafka_ingest_benchmark --partitions 4 --messages 200000 --message-bytes 512
+///     kafka_ingest_benchmark --brokers 127.0.0.1:9092 --topic ingest_bench
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cppkafka/cppkafka.h>
+#include <librdkafka/rdkafka_mock.h>
+
+#include <Storages/Kafka/CnchReadBufferFromKafkaConsumer.h>
+#include <Storages/Kafka/KafkaConsumer.h>
+
+using namespace DB;
+
+namespace
+{
+
+struct BenchmarkOptions
+{
+    std::string brokers; /// empty = embedded mock cluster
+    std::string topic = "kafka_ingest_benchmark";
+    size_t partitions = 4;
+    size_t messages = 100000;
+    size_t message_bytes = 256;
+    size_t batch_size = 65536;
+    size_t poll_timeout_ms = 500;
+    size_t commit_every_batches = 1;
+};
+
+[[noreturn]] void usage(const char * argv0)
+{
+    std::cerr << "Usage: " << argv0
+              << " [--brokers host:port] [--topic name] [--partitions N] [--messages N]"
+                 " [--message-bytes N] [--batch-size N] [--poll-timeout-ms N] [--commit-every-batches N]\n";
+    exit(1);
+}
+
+BenchmarkOptions parseOptions(int argc, char ** argv)
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (++i >= argc)
+                usage(argv[0]);
+            return argv[i];
+        };
+
+        if (arg == "--brokers")
+            options.brokers = next();
+        else if (arg == "--topic")
+            options.topic = next();
+        else if (arg == "--partitions")
+            options.partitions = std::stoull(next());
+        else if (arg == "--messages")
+            options.messages = std::stoull(next());
+        else if (arg == "--message-bytes")
+            options.message_bytes = std::max<size_t>(std::stoull(next()), sizeof(int64_t));
+        else if (arg == "--batch-size")
+            options.batch_size = std::stoull(next());
+        else if (arg == "--poll-timeout-ms")
+            options.poll_timeout_ms = std::stoull(next());
+        else if (arg == "--commit-every-batches")
+            options.commit_every_batches = std::max<size_t>(std::stoull(next()), 1);
+        else
+            usage(argv[0]);
+    }
+    return options;
+}
+
+int64_t nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+/// Messages carry their produce time in the first 8 bytes of the payload,
+/// so latency can be measured without relying on broker-side timestamps.
+void produce(cppkafka::Producer & producer, const BenchmarkOptions & options)
+{
+    std::string payload(options.message_bytes, 'x');
+
+    for (size_t i = 0; i < options.messages; ++i)
+    {
+        int64_t ts = nowUs();
+        memcpy(payload.data(), &ts, sizeof(ts));
+
+        cppkafka::MessageBuilder builder(options.topic);
+        builder.partition(i % options.partitions).payload(payload);
+        while (true)
+        {
+            try
+            {
+                producer.produce(builder);
+                break;
+            }
+            catch (const cppkafka::HandleException &) /// local queue full
+            {
+                producer.poll(std::chrono::milliseconds(10));
+            }
+        }
+
+        if (i % 1000 == 0)
+            producer.poll(std::chrono::milliseconds(0));
+    }
+    producer.flush(std::chrono::milliseconds(30000));
+}
+
+void report(const BenchmarkOptions & options, std::vector<int64_t> & latencies_us, size_t bytes, double elapsed_sec)
+{
+    std::sort(latencies_us.begin(), latencies_us.end());
+    auto quantile = [&](double q) -> int64_t
+    {
+        if (latencies_us.empty())
+            return 0;
+        return latencies_us[std::min(latencies_us.size() - 1, static_cast<size_t>(q * latencies_us.size()))];
+    };
+
+    std::cout << "messages: " << latencies_us.size() << ", partitions: " << options.partitions
+              << ", message_bytes: " << options.message_bytes << "\n"
+              << "throughput: " << static_cast<size_t>(latencies_us.size() / elapsed_sec) << " msg/s, "
+              << (bytes / elapsed_sec) / (1024.0 * 1024.0) << " MiB/s\n"
+              << "produce-to-consume latency us: p50 " << quantile(0.5) << ", p90 " << quantile(0.9) << ", p99 "
+              << quantile(0.99) << ", max " << (latencies_us.empty() ? 0 : latencies_us.back()) << std::endl;
+}
+
+int run(const BenchmarkOptions & options)
+{
+    cppkafka::Configuration consumer_config;
+    consumer_config.set("group.id", "kafka_ingest_benchmark");
+    consumer_config.set("enable.auto.commit", "false");
+    consumer_config.set("auto.offset.reset", "earliest");
+    if (options.brokers.empty())
+        consumer_config.set("test.mock.num.brokers", "1");
+    else
+        consumer_config.set("metadata.broker.list", options.brokers);
+
+    auto consumer = std::make_shared<KafkaConsumer>(consumer_config);
+
+    /// With the embedded mock cluster the producer must join the cluster the
+    /// consumer spawned, not spawn its own; fetch its bootstrap address.
+    std::string brokers = options.brokers;
+    if (brokers.empty())
+    {
+        auto * mock_cluster = rd_kafka_handle_mock_cluster(consumer->get_handle());
+        if (!mock_cluster)
+        {
+            std::cerr << "librdkafka was built without mock cluster support, pass --brokers" << std::endl;
+            return 1;
+        }
+        rd_kafka_mock_topic_create(mock_cluster, options.topic.c_str(), options.partitions, 1);
+        brokers = rd_kafka_mock_cluster_bootstraps(mock_cluster);
+    }
+
+    cppkafka::Configuration producer_config;
+    producer_config.set("metadata.broker.list", brokers);
+    cppkafka::Producer producer(producer_config);
+
+    cppkafka::TopicPartitionList assignment;
+    for (size_t partition = 0; partition < options.partitions; ++partition)
+        assignment.emplace_back(options.topic, partition);
+
+    std::atomic_bool run_flag{true};
+    /// The expire timeout only bounds how long a lost-message stall can block the poll loop.
+    CnchReadBufferFromKafkaConsumer buffer(
+        consumer, "KafkaIngestBenchmark", options.batch_size, options.poll_timeout_ms, /* expire_timeout_ */ 30000, &run_flag);
+    buffer.assign(assignment);
+
+    produce(producer, options);
+
+    std::vector<int64_t> latencies_us;
+    latencies_us.reserve(options.messages);
+    size_t consumed_bytes = 0;
+    size_t batches = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    while (latencies_us.size() < options.messages)
+    {
+        size_t batch_begin = latencies_us.size();
+        while (latencies_us.size() < options.messages && buffer.next())
+        {
+            const auto & message = buffer.currentMessage();
+            const auto & payload = message.get_payload();
+            int64_t produced_us;
+            memcpy(&produced_us, payload.get_data(), sizeof(produced_us));
+            latencies_us.push_back(nowUs() - produced_us);
+            consumed_bytes += payload.get_size();
+        }
+
+        if (latencies_us.size() == batch_begin)
+        {
+            std::cerr << "consumer stalled after " << latencies_us.size() << " messages" << std::endl;
+            break;
+        }
+
+        /// Same cadence as the consume manager: commit processed offsets per batch,
+        /// then reset the buffer for the next one (next() stalls at a batch boundary).
+        if (++batches % options.commit_every_batches == 0)
+            buffer.commit();
+        buffer.reset();
+    }
+    buffer.commit();
+    double elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    buffer.unassign();
+    report(options, latencies_us, consumed_bytes, elapsed_sec);
+    return 0;
+}
+
+}
+
+int main(int argc, char ** argv)
+try
+{
+    return run(parseOptions(argc, argv));
+}
+catch (const std::exception & e)
+{
+    std::cerr << e.what() << std::endl;
+    return 1;
+}
@@ -138,8 +138,16 @@ try
 
     auto metric_decrementor = std::make_shared<ParanoidMetricDecrementor>(pool_config.tasks_metric);
 
+    /// Priority tiers (see JobPriority): only high-priority jobs may fill the pool
+    /// completely; normal ones leave a slot free for them and low ones take at most half.
+    Int64 priority_max_pool_size = max_pool_size;
+    if (job_and_pool.priority == JobPriority::NORMAL && max_pool_size > 1)
+        priority_max_pool_size = max_pool_size - 1;
+    else if (job_and_pool.priority == JobPriority::LOW)
+        priority_max_pool_size = std::max<Int64>(1, max_pool_size / 2);
+
     /// If corresponding pool is not full increment metric and assign new job
-    if (incrementMetricIfLessThanMax(CurrentMetrics::values[pool_config.tasks_metric], max_pool_size))
+    if (incrementMetricIfLessThanMax(CurrentMetrics::values[pool_config.tasks_metric], priority_max_pool_size))
     {
         metric_decrementor->alarm();
         try /// this try required because we have to manually decrement metric
@@ -57,6 +57,19 @@ enum class PoolType
     FETCH,
 };
 
+/// Scheduling priority of a background job within its pool.
+/// - HIGH jobs (TTL drops, cleanup after failed operations) may occupy the whole pool.
+/// - NORMAL jobs leave one slot of the pool free, so a high-priority job never waits
+///   for a long merge to finish before it can start.
+/// - LOW jobs (e.g. mutations) are limited to half of the pool, so a burst of them
+///   cannot starve normal merges and explode the part count.
+enum class JobPriority
+{
+    HIGH,
+    NORMAL,
+    LOW,
+};
+
 using BackgroundJobFunc = std::function<bool()>;
 
 /// Result from background job providers. Function which will be executed in pool and pool type.
@@ -64,6 +77,7 @@ struct JobAndPool
 {
     BackgroundJobFunc job;
     PoolType pool_type;
+    JobPriority priority = JobPriority::NORMAL;
 };
 
 /// Background jobs executor which execute heavy-weight background tasks for MergTree tables, like
@@ -15,16 +15,20 @@
 
 #include <Storages/MergeTree/CloudMergeTreeBlockOutputStream.h>
 
+#include <Catalog/Catalog.h>
 #include <CloudServices/CnchDedupHelper.h>
 #include <CloudServices/CnchPartsHelper.h>
 #include <CloudServices/commitCnchParts.h>
+#include <Common/SipHash.h>
 #include <Interpreters/PartLog.h>
 #include <MergeTreeCommon/MergeTreeDataDeduper.h>
 #include <Storages/MergeTree/IMergeTreeDataPart.h>
 #include <Storages/MergeTree/IMergeTreeDataPart_fwd.h>
 #include <Storages/StorageCloudMergeTree.h>
 #include <Storages/StorageCnchMergeTree.h>
+#include <Transaction/CnchServerTransaction.h>
 #include <Transaction/CnchWorkerTransaction.h>
+#include <Transaction/TransactionCoordinatorRcCnch.h>
 #include <WorkerTasks/ManipulationType.h>
 
 namespace DB
@@ -53,6 +57,45 @@ CloudMergeTreeBlockOutputStream::CloudMergeTreeBlockOutputStream(
 {
     if (!metadata_snapshot->hasUniqueKey() && to_staging_area)
         throw Exception("Table doesn't have UNIQUE KEY specified, can't write to staging area", ErrorCodes::LOGICAL_ERROR);
+
+    /// Parallel INSERT SELECT creates several streams over the same transaction;
+    /// register on it so that only the last stream to finish commits.
+    if (!metadata_snapshot->hasUniqueKey() || to_staging_area)
+    {
+        if (auto server_txn = dynamic_pointer_cast<CnchServerTransaction>(context->getCurrentTransaction()))
+        {
+            server_txn->registerInsertSink();
+            registered_in_txn = true;
+        }
+    }
+
+    /// Unique tables are skipped: dedup drops rows after they were counted.
+    if (context->getSettingsRef().statistics_enable_incremental_update && !metadata_snapshot->hasUniqueKey() && !to_staging_area)
+    {
+        /// Statistics live in the catalog under the cnch table uuid; cloud tables
+        /// created for Kafka tasks carry it in the cnch_table_uuid setting.
+        String uuid_str = storage.getSettings()->cnch_table_uuid.value;
+        auto uuid = uuid_str.empty() ? storage.getStorageUUID() : UUIDHelpers::toUUID(uuid_str);
+        if (uuid != UUIDHelpers::Nil)
+        {
+            auto stats_table_id = storage.getStorageID();
+            stats_table_id.uuid = uuid;
+            Statistics::ColumnDescVector columns_desc;
+            for (const auto & col_desc : metadata_snapshot->getColumns().getAll())
+                if (Statistics::isCollectableType(col_desc.type))
+                    columns_desc.emplace_back(col_desc);
+            stats_collector = std::make_unique<Statistics::IncrementalStatsCollector>(
+                context, Statistics::StatsTableIdentifier(stats_table_id), std::move(columns_desc));
+        }
+    }
+}
+
+CloudMergeTreeBlockOutputStream::~CloudMergeTreeBlockOutputStream()
+{
+    /// Labels still around here belong to blocks whose transaction did not commit
+    /// (an exception before or during the write suffix); remove them so a retry
+    /// of the insert is not wrongly skipped.
+    abortDedupLabels();
 }
 
 Block CloudMergeTreeBlockOutputStream::getHeader() const
@@ -64,6 +107,10 @@ void CloudMergeTreeBlockOutputStream::write(const Block & block)
 {
     Stopwatch watch;
     LOG_DEBUG(storage.getLogger(), "Start to write new block");
+    if (context->getSettingsRef().enable_insert_block_dedup && isDuplicateBlock(block))
+        return;
+    if (stats_collector)
+        stats_collector->update(block);
     auto parts = convertBlockIntoDataParts(block);
     /// Generate delete bitmaps, delete bitmap is valid only when using delete_flag info for unique table
     LocalDeleteBitmaps bitmaps;
@@ -100,15 +147,157 @@ void CloudMergeTreeBlockOutputStream::write(const Block & block)
         watch.elapsedMilliseconds(),
         res.size());
 
+    for (const auto & part : res)
+        bytes_since_last_commit += part->bytes_on_disk;
+
     // batch all part to preload_parts for batch preloading in writeSuffix
     std::move(res.begin(), res.end(), std::back_inserter(preload_parts));
+
+    commitChunkIfNeeded();
+}
+
+void CloudMergeTreeBlockOutputStream::commitChunkIfNeeded()
+{
+    const auto threshold = context->getSettingsRef().insert_incremental_commit_bytes;
+    if (!threshold || bytes_since_last_commit < threshold)
+        return;
+
+    /// Only the plain insert path may make parts visible early: staged and unique
+    /// writes defer visibility to dedup, and when the commit is driven from outside
+    /// (explicit transactions, Kafka) the stream must not commit on its own.
+    if (disable_transaction_commit || to_staging_area || metadata_snapshot->hasUniqueKey())
+        return;
+
+    auto txn = context->getCurrentTransaction();
+    auto server_txn = dynamic_pointer_cast<CnchServerTransaction>(txn);
+    if (!server_txn || server_txn->isSecondary())
+        return;
+
+    /// With parallel insert sinks the transaction is shared; committing it from
+    /// under the other sinks would corrupt their in-flight parts.
+    if (server_txn->getActiveInsertSinks() > 1)
+        return;
+
+    /// Preload the chunk while its parts are still at hand; the rest of the insert
+    /// continues under a fresh transaction.
+    cnch_writer.preload(preload_parts);
+    preload_parts.clear();
+
+    txn->setMainTableUUID(storage.getStorageUUID());
+    txn->commitV2();
+    commitDedupLabels();
+    LOG_DEBUG(
+        log,
+        "Committed intermediate chunk of {} bytes in transaction {}, continuing in a new transaction",
+        bytes_since_last_commit,
+        txn->getTransactionID());
+    bytes_since_last_commit = 0;
+
+    auto new_txn = context->getCnchTransactionCoordinator().createTransaction(
+        CreateTransactionOption().setContext(context).setAsyncPostCommit(context->getSettingsRef().async_post_commit));
+    if (registered_in_txn)
+        new_txn->registerInsertSink();
+    /// The stream shares its context with the writer and the conversion helpers,
+    /// all of which pick up the transaction per call; swap the transaction in place
+    /// (finishing the committed one) so the remaining blocks land in the new one.
+    std::const_pointer_cast<Context>(context)->setCurrentTransaction(std::move(new_txn));
+}
+
+bool CloudMergeTreeBlockOutputStream::isDuplicateBlock(const Block & block)
+{
+    /// Upserts already deduplicate by unique key, and the labels would outlive the
+    /// version semantics of a retried delete_flag block; keep them out of this path.
+    if (metadata_snapshot->hasUniqueKey() || !block.rows())
+        return false;
+
+    /// prefer to get cnch table uuid from settings as CloudMergeTree has no uuid for Kafka task
+    String uuid_str = storage.getSettings()->cnch_table_uuid.value;
+    auto table_uuid = uuid_str.empty() ? storage.getStorageUUID() : UUIDHelpers::toUUID(uuid_str);
+    if (table_uuid == UUIDHelpers::Nil)
+        return false;
+
+    SipHash hash;
+    block.updateHash(hash);
+    union
+    {
+        char bytes[16];
+        UInt64 words[2];
+    } hash_value;
+    hash.get128(hash_value.bytes);
+    auto label_name = "block-" + toString(hash_value.words[0]) + "-" + toString(hash_value.words[1]);
+
+    auto catalog = context->getCnchCatalog();
+    if (catalog->getInsertionLabel(table_uuid, label_name))
+    {
+        LOG_INFO(log, "Skipping duplicate block of {} rows: label {} already exists", block.rows(), label_name);
+        return true;
+    }
+
+    auto label = std::make_shared<InsertionLabel>(table_uuid, label_name, context->getCurrentTransactionID().toUInt64());
+    try
+    {
+        catalog->precommitInsertionLabel(label);
+    }
+    catch (...)
+    {
+        /// Lost the race to a concurrent insert of the same block.
+        if (catalog->getInsertionLabel(table_uuid, label_name))
+        {
+            LOG_INFO(log, "Skipping duplicate block of {} rows: label {} was created concurrently", block.rows(), label_name);
+            return true;
+        }
+        throw;
+    }
+    block_dedup_labels.push_back(std::move(label));
+    return false;
+}
+
+void CloudMergeTreeBlockOutputStream::commitDedupLabels()
+{
+    if (block_dedup_labels.empty())
+        return;
+
+    /// The data is already durable at this point; a label left in Precommitted
+    /// state still dedups by existence, so failures here are only logged.
+    auto catalog = context->getCnchCatalog();
+    for (auto & label : block_dedup_labels)
+    {
+        try
+        {
+            catalog->commitInsertionLabel(label);
+        }
+        catch (...)
+        {
+            tryLogCurrentException(log, "Failed to commit insertion label " + label->name);
+        }
+    }
+    block_dedup_labels.clear();
+}
+
+void CloudMergeTreeBlockOutputStream::abortDedupLabels()
+{
+    if (block_dedup_labels.empty())
+        return;
+
+    try
+    {
+        auto catalog = context->getCnchCatalog();
+        for (auto & label : block_dedup_labels)
+            catalog->removeInsertionLabel(label->table_uuid, label->name);
+    }
+    catch (...)
+    {
+        /// Leftover labels are removed by the part GC thread after insertion_label_ttl.
+        tryLogCurrentException(log, "Failed to remove insertion labels of an aborted insert");
+    }
+    block_dedup_labels.clear();
 }
 
 MergeTreeMutableDataPartsVector CloudMergeTreeBlockOutputStream::convertBlockIntoDataParts(const Block & block, bool use_inner_block_id)
 {
     auto part_log = context->getGlobalContext()->getPartLog(storage.getDatabaseName());
     auto merge_tree_settings = storage.getSettings();
-    auto settings = context->getSettingsRef();
+    auto & settings = context->getSettingsRef();
 
     BlocksWithPartition part_blocks;
 
@@ -244,8 +433,17 @@ void CloudMergeTreeBlockOutputStream::writeSuffixForInsert()
     if (dynamic_pointer_cast<CnchServerTransaction>(txn) && !disable_transaction_commit)
     {
         txn->setMainTableUUID(storage.getStorageUUID());
-        txn->commitV2();
-        LOG_DEBUG(storage.getLogger(), "Finishing insert values commit in cnch server.");
+        if (!registered_in_txn || txn->deregisterInsertSink() == 0)
+        {
+            txn->commitV2();
+            commitDedupLabels();
+            LOG_DEBUG(storage.getLogger(), "Finishing insert values commit in cnch server.");
+        }
+        else
+            LOG_DEBUG(
+                storage.getLogger(),
+                "Deferring commit of transaction {} to the remaining parallel insert sinks",
+                txn->getTransactionID());
     }
     else if (auto worker_txn = dynamic_pointer_cast<CnchWorkerTransaction>(txn))
     {
@@ -255,6 +453,7 @@ void CloudMergeTreeBlockOutputStream::writeSuffixForInsert()
             txn->setMainTableUUID(UUIDHelpers::toUUID(storage.getSettings()->cnch_table_uuid.value));
             Stopwatch watch;
             txn->commitV2();
+            commitDedupLabels();
             LOG_TRACE(
                 storage.getLogger(), "Committed Kafka transaction {} elapsed {} ms", txn->getTransactionID(), watch.elapsedMilliseconds());
         }
@@ -264,6 +463,14 @@ void CloudMergeTreeBlockOutputStream::writeSuffixForInsert()
             /// And a exception should be threw in the last `else` clause, otherwise there might be some potential bugs.
         }
     }
+
+    if (stats_collector)
+        stats_collector->commit();
+
+    /// When the commit belongs to someone else (another parallel sink, an explicit
+    /// transaction), hand the precommitted labels off: they dedup by existence and
+    /// the part GC thread removes them after insertion_label_ttl.
+    block_dedup_labels.clear();
 }
 
 void CloudMergeTreeBlockOutputStream::writeSuffixForUpsert()
@@ -18,6 +18,8 @@
 #include <CloudServices/CnchDedupHelper.h>
 #include <CloudServices/commitCnchParts.h>
 #include <DataStreams/IBlockOutputStream.h>
+#include <MergeTreeCommon/InsertionLabel.h>
+#include <Statistics/IncrementalStats.h>
 #include <Storages/MergeTree/MergeTreeCNCHDataDumper.h>
 #include <Storages/MergeTree/MergeTreeDataWriter.h>
 #include <common/logger_useful.h>
@@ -39,6 +41,8 @@ public:
         ContextPtr context_,
         bool to_staging_area_ = false);
 
+    ~CloudMergeTreeBlockOutputStream() override;
+
     Block getHeader() const override;
 
     void write(const Block & block) override;
@@ -55,6 +59,21 @@ private:
     void writeSuffixForInsert();
     void writeSuffixForUpsert();
 
+    /// Commit the parts dumped so far and continue in a fresh implicit transaction
+    /// once insert_incremental_commit_bytes worth of data has accumulated.
+    void commitChunkIfNeeded();
+
+    /// Block-level dedup against retried inserts, see enable_insert_block_dedup.
+    /// Precommits an insertion label named after the block's content hash and
+    /// returns true (skip the block) when such a label already exists.
+    bool isDuplicateBlock(const Block & block);
+    /// Flip the labels of the blocks written so far to Committed; called right
+    /// after this stream commits the transaction.
+    void commitDedupLabels();
+    /// Remove precommitted labels of an insert that did not commit, so a retry
+    /// is not wrongly skipped. Never throws; called from the destructor.
+    void abortDedupLabels();
+
     MergeTreeMetaBase & storage;
     Poco::Logger * log;
     StorageMetadataPtr metadata_snapshot;
@@ -67,7 +86,18 @@ private:
     // if we want to do batch preload indexing in write suffix
     MutableMergeTreeDataPartsCNCHVector preload_parts;
 
+    // bytes dumped since the last incremental commit, see insert_incremental_commit_bytes
+    size_t bytes_since_last_commit = 0;
+
+    // maintains table statistics over the written blocks, nullptr when disabled
+    std::unique_ptr<Statistics::IncrementalStatsCollector> stats_collector;
+
+    // precommitted per-block dedup labels not yet committed or handed off
+    std::vector<InsertionLabelPtr> block_dedup_labels;
+
     bool disable_transaction_commit{false};
+    // whether this stream joined the transaction's parallel sink commit barrier
+    bool registered_in_txn{false};
     SimpleIncrement increment;
 };
 
@@ -312,6 +312,11 @@ void CnchAttachProcessor::exec()
     if (is_unique_tbl && command.replace)
         throw Exception("Replace partition or part is not supported for unique table", ErrorCodes::NOT_IMPLEMENTED);
 
+    if (query_ctx->getSettingsRef().cnch_part_attach_manifest_only
+        && (is_unique_tbl || command.from_zookeeper_path.empty()))
+        throw Exception("Manifest only attach is only supported when attaching from a path to a non-unique table",
+            ErrorCodes::NOT_IMPLEMENTED);
+
     AttachContext attach_ctx(*query_ctx, 8,
         query_ctx->getSettingsRef().cnch_part_attach_max_threads, logger);
 
@@ -1087,6 +1092,11 @@ MutableMergeTreeDataPartsCNCHVector CnchAttachProcessor::prepareParts(
 
     injectFailure(AttachFailurePoint::PREPARE_WRITE_UNDO_FAIL);
 
+    // In manifest only mode parts stay at their source location and are registered
+    // in the catalog with a relative path pointing there, so there is no file
+    // movement to record or undo; a rollback only needs to revert the metadata
+    const bool manifest_only = query_ctx->getSettingsRef().cnch_part_attach_manifest_only;
+
     // Write rename record to kv first
     for (auto & parts_and_infos : parts_and_infos_from_sources)
     {
@@ -1097,7 +1107,8 @@ MutableMergeTreeDataPartsCNCHVector CnchAttachProcessor::prepareParts(
             String part_name = part_info.getPartNameWithHintMutation();
             String tbl_rel_path = target_tbl.getRelativeDataPath(IStorage::StorageLocation::MAIN);
             String target_path = std::filesystem::path(tbl_rel_path) / part_name / "";
-            attach_ctx.writeRenameRecord(part->volume->getDefaultDisk(), part->getFullRelativePath(), target_path);
+            if (!manifest_only)
+                attach_ctx.writeRenameRecord(part->volume->getDefaultDisk(), part->getFullRelativePath(), target_path);
             if (is_unique_tbl)
             {
                 loadUniqueDeleteMeta(part, part_info);
@@ -1136,12 +1147,13 @@ MutableMergeTreeDataPartsCNCHVector CnchAttachProcessor::prepareParts(
     {
         for (auto & part_and_info : parts_and_infos)
         {
-            worker_pool.scheduleOrThrowOnError([&prepared_parts, table_def_hash, offset, part = part_and_info.first, part_info = part_and_info.second, this]() {
+            worker_pool.scheduleOrThrowOnError([&prepared_parts, table_def_hash, manifest_only, offset, part = part_and_info.first, part_info = part_and_info.second, this]() {
                 String part_name = part_info.getPartNameWithHintMutation();
                 String tbl_rel_path = target_tbl.getRelativeDataPath(IStorage::StorageLocation::MAIN);
                 String target_path = std::filesystem::path(tbl_rel_path) / part_name / "";
                 const auto & disk = part->volume->getDisk();
-                disk->moveDirectory(part->getFullRelativePath(), target_path);
+                if (!manifest_only)
+                    disk->moveDirectory(part->getFullRelativePath(), target_path);
                 DataModelDeleteBitmapPtr attach_meta;
                 if (is_unique_tbl)
                 {
@@ -1177,7 +1189,18 @@ MutableMergeTreeDataPartsCNCHVector CnchAttachProcessor::prepareParts(
 
                 // Discard part's commit time
                 part_model.set_commit_time(IMergeTreeDataPart::NOT_INITIALIZED_COMMIT_TIME);
-                prepared_parts[offset] = createPartFromModel(target_tbl, part_model, part_name);
+                if (manifest_only)
+                {
+                    // Register the part at its source location: the catalog records the
+                    // path relative to the table's data path and the table takes
+                    // ownership of the files from now on
+                    String external_path = relativePathTo(tbl_rel_path, part->getFullRelativePath());
+                    part_model.set_relative_path(external_path);
+                    prepared_parts[offset] = createPartFromModel(target_tbl, part_model, external_path);
+                    prepared_parts[offset]->external_relative_path = true;
+                }
+                else
+                    prepared_parts[offset] = createPartFromModel(target_tbl, part_model, part_name);
                 prepared_parts[offset]->table_definition_hash = table_def_hash;
 
                 if (is_unique_tbl && attach_meta)
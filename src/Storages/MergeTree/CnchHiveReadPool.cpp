@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <DataStreams/IBlockInputStream.h>
 #include <Storages/HDFS/ReadBufferFromByteHDFS.h>
 #include <Storages/MergeTree/CnchHiveReadPool.h>
+#include <Common/Exception.h>
 namespace ProfileEvents
 {
 extern const Event SlowRead;
@@ -63,6 +65,7 @@ void CnchHiveReadPool::fillPerThreadInfo(const size_t & threads, const size_t &
     {
         const auto part_idx = data_parts.size() - 1;
         const auto & part = data_parts.back().data_part;
+        const auto & skipped_blocks = data_parts.back().skipped_blocks;
         size_t row_groups_in_part = part->getTotalBlockNumber();
         std::string path = part->getFullDataPartPath();
 
@@ -96,6 +99,13 @@ void CnchHiveReadPool::fillPerThreadInfo(const size_t & threads, const size_t &
 
         while (need_row_groups > 0 && (current_row_group_index < row_groups_in_part))
         {
+            /// Row groups pruned by statistics are never scheduled
+            if (skipped_blocks.count(static_cast<Int64>(current_row_group_index)))
+            {
+                current_row_group_index++;
+                continue;
+            }
+
             threads_tasks[i].parts_and_groups.push_back({part_idx, current_row_group_index});
             threads_row_groups_sum[i]++;
             current_row_group_index++;
@@ -155,6 +165,63 @@ void CnchHiveReadPool::fillPerThreadInfo(const size_t & threads, const size_t &
     }
 }
 
+void CnchHiveReadPool::prefetchFirstWave(const ContextPtr & context)
+{
+    Strings paths;
+    {
+        const std::lock_guard lock{mutex};
+        for (const auto & thread_task : threads_tasks)
+        {
+            if (thread_task.parts_and_groups.empty())
+                continue;
+
+            /// getTask() pops from the back, so the back entry is the first file each thread opens
+            const auto & path = parts[thread_task.parts_and_groups.back().part_idx].data_part->getFullDataPartPath();
+            if (std::find(paths.begin(), paths.end(), path) == paths.end())
+                paths.push_back(path);
+        }
+    }
+
+    if (paths.empty())
+        return;
+
+    size_t pool_size = std::min<size_t>(paths.size(), data.settings.max_hive_file_prefetch_threads);
+    prefetch_pool = std::make_unique<ThreadPool>(pool_size);
+    auto hdfs_params = context->getHdfsConnectionParams();
+
+    for (const auto & path : paths)
+    {
+        prefetch_pool->scheduleOrThrowOnError([this, path, hdfs_params] {
+            try
+            {
+                auto buffer = std::make_unique<ReadBufferFromByteHDFS>(path, true, hdfs_params);
+                /// Forces connecting and opening the file, so the reader starts on a warm handle
+                buffer->getFileSize();
+
+                const std::lock_guard lock{mutex};
+                prefetched_buffers[path] = std::move(buffer);
+            }
+            catch (...)
+            {
+                /// Prefetch is best effort; the reader opens the file itself on a miss
+                tryLogCurrentException("CnchHiveReadPool");
+            }
+        });
+    }
+}
+
+std::unique_ptr<ReadBufferFromByteHDFS> CnchHiveReadPool::claimPrefetchedBuffer(const String & part_path)
+{
+    const std::lock_guard lock{mutex};
+    auto it = prefetched_buffers.find(part_path);
+    if (it == prefetched_buffers.end())
+        return nullptr;
+
+    auto buffer = std::move(it->second);
+    prefetched_buffers.erase(it);
+    return buffer;
+}
+
 Block CnchHiveReadPool::getHeader() const
 {
     return metadata_snapshot->getSampleBlockForColumns(column_names, data.getVirtuals(), data.getStorageID());
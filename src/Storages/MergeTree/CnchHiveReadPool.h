@@ -17,9 +17,11 @@
 
 #include <mutex>
 #include <Core/NamesAndTypes.h>
+#include <Storages/HDFS/ReadBufferFromByteHDFS.h>
 #include <Storages/Hive/HiveDataPart.h>
 #include <Storages/MergeTree/RowGroupsInDataPart.h>
 #include <Storages/StorageCloudHive.h>
+#include <Common/ThreadPool.h>
 
 namespace DB
 {
@@ -60,6 +62,15 @@ public:
     Block getHeader() const;
     CnchHiveReadTaskPtr getTask(const size_t & thread);
 
+    /// Opens the first file of every thread's task queue in the background (bounded by
+    /// max_hive_file_prefetch_threads), so HDFS connect and open latency overlaps with
+    /// pipeline construction instead of being paid inside the first read.
+    void prefetchFirstWave(const ContextPtr & context);
+
+    /// Hands out a pre-opened buffer for the given file, or nullptr when none was
+    /// prefetched; each buffer is claimed at most once.
+    std::unique_ptr<ReadBufferFromByteHDFS> claimPrefetchedBuffer(const String & part_path);
+
 private:
     struct BackoffState
     {
@@ -92,6 +103,10 @@ private:
     std::vector<size_t> threads_row_groups_sum;
     mutable std::mutex mutex;
 
+    std::unordered_map<String, std::unique_ptr<ReadBufferFromByteHDFS>> prefetched_buffers;
+    /// Declared last so its destructor waits for in-flight prefetch jobs before other members die
+    std::unique_ptr<ThreadPool> prefetch_pool;
+
     // Poco::Logger * log = Poco::Logger::get("CnchHiveReadPool");
 };
 
@@ -48,10 +48,16 @@ struct Settings;
     M(UInt64, max_hive_metastore_client_retry, 3, "", 0) \
     M(UInt64, get_hive_metastore_client_timeout, DBMS_DEFAULT_CONNECT_TIMEOUT_SEC * 1000, "", 0) \
     M(UInt64, max_hive_metastore_client_connections, 64, "", 0) \
+    /** partition listing cache and batching **/ \
+    M(Bool, enable_hive_partition_cache, true, "Cache partition listings per table, validated by the table DDL time and the TTL below", 0) \
+    M(UInt64, hive_partition_cache_ttl_sec, 300, "Drop cached partition listings after this long even if the table version is unchanged; 0 keeps them until the next DDL", 0) \
+    M(UInt64, hive_metastore_client_partition_batch_size, 1024, "Fetch full partition listings from the metastore in batches of this many partition names; 0 fetches everything in one call", 0) \
     /** allocate part policy**/ \
     M(Bool, use_simple_hash, true, "", 0) \
     /** parallel read parquet max threads **/ \
     M(UInt64, max_read_row_group_threads, 32, "", 0) \
+    M(UInt64, max_hive_file_prefetch_threads, 8, "Background threads pre-opening the first wave of hive files per query; 0 disables prefetch", 0) \
+    M(UInt64, hive_decoded_chunk_cache_bytes, 0, "Worker-local memory budget for caching decoded parquet/orc blocks keyed by file, row group and column set; 0 disables the cache", 0) \
     M(Bool, cnch_temporary_table, 0, "", 0) \
     /** HMS kerberos settings **/ \
     M(Bool, hive_metastore_client_kerberos_auth, 0, "Enable hms auth with Kerberos", 0) \
@@ -30,12 +30,14 @@ class ORCBlockInputFormat;
 CnchHiveThreadSelectBlockInputProcessor::CnchHiveThreadSelectBlockInputProcessor(
     const size_t & thread_,
     const std::shared_ptr<CnchHiveReadPool> & pool_,
-    const StorageCloudHive & /*storage_*/,
+    const StorageCloudHive & storage_,
     const StorageMetadataPtr & metadata_snapshot_,
     ContextPtr & context_,
     const UInt64 & /*max_block_size_*/)
     : SourceWithProgress(pool_->getHeader()), thread(thread_), pool(pool_), metadata_snapshot(metadata_snapshot_), context(context_)
 {
+    if (storage_.settings.hive_decoded_chunk_cache_bytes)
+        chunk_cache = &HiveChunkCache::instance(storage_.settings.hive_decoded_chunk_cache_bytes);
 }
 
 CnchHiveThreadSelectBlockInputProcessor::~CnchHiveThreadSelectBlockInputProcessor() = default;
@@ -55,6 +57,14 @@ Chunk CnchHiveThreadSelectBlockInputProcessor::generate()
         if (!task && !getNewTask())
             break;
 
+        if (cached_block)
+        {
+            res = std::move(*cached_block);
+            cached_block.reset();
+            task.reset();
+            continue;
+        }
+
         res = stream->read();
 
         LOG_TRACE(&Poco::Logger::get("CnchHiveThreadSelectBlockInputProcessor"), " parquet read rows: {}", res.rows());
@@ -64,6 +74,10 @@ Chunk CnchHiveThreadSelectBlockInputProcessor::generate()
         if (!parquet && !orc)
             throw Exception("Unexpected Format in CnchHive ,currently only support Parquet/ORC", ErrorCodes::LOGICAL_ERROR);
 
+        /// Empty results are cached too: a fully filtered row group is as expensive to re-decode
+        if (chunk_cache)
+            chunk_cache->set(chunk_cache_key, std::make_shared<Block>(res));
+
         // if(parquet->isFinished())
         // {
         //     task.reset();
@@ -93,12 +107,25 @@ bool CnchHiveThreadSelectBlockInputProcessor::getNewTask()
     const String part_path = part->getFullDataPartPath();
     const String part_format = part->getFormatName();
 
+    if (chunk_cache)
+    {
+        chunk_cache_key = HiveChunkCache::hash(part_path, current_row_group, getHeader());
+        if (auto block = chunk_cache->get(chunk_cache_key))
+        {
+            /// Serve the task from cache without touching the file
+            cached_block = *block;
+            return true;
+        }
+    }
+
     LOG_TRACE(
         &Poco::Logger::get("CnchHiveThreadSelectBlockInputStream"),
         "getNewTask current_row_group: {} part is {} ",
         current_row_group,
         part_path);
-    read_buf = std::make_unique<ReadBufferFromByteHDFS>(part_path, true, context->getHdfsConnectionParams());
+    read_buf = pool->claimPrefetchedBuffer(part_path);
+    if (!read_buf)
+        read_buf = std::make_unique<ReadBufferFromByteHDFS>(part_path, true, context->getHdfsConnectionParams());
 
     FormatSettings format_settings;
     if (part_format.find("Parquet") != String::npos)
@@ -18,6 +18,7 @@
 #include <DataStreams/IBlockInputStream.h>
 #include <Processors/Formats/InputStreamFromInputFormat.h>
 #include <Processors/Sources/SourceWithProgress.h>
+#include <Storages/Hive/HiveChunkCache.h>
 #include <Storages/MergeTree/CnchHiveReadPool.h>
 #include <Storages/StorageCloudHive.h>
 
@@ -62,6 +63,11 @@ private:
     std::unique_ptr<ReadBuffer> read_buf;
 
     BlockInputStreamPtr stream;
+
+    /// Decoded-chunk cache; on a hit the task is answered without opening the file
+    HiveChunkCache * chunk_cache = nullptr;
+    UInt128 chunk_cache_key{};
+    std::optional<Block> cached_block;
 };
 
 }
@@ -80,7 +80,12 @@ IMergeSelector::PartsRange DanceMergeSelector::select(const PartsRanges & partit
     for (auto & partition : partitions)
     {
         if (partition.size() >= 2)
-            num_parts_of_partitions[toPart(partition.front().data)->info.partition_id] += partition.size();
+        {
+            auto & partition_id = toPart(partition.front().data)->info.partition_id;
+            num_parts_of_partitions[partition_id] += partition.size();
+            if (settings.enable_write_amplification_budget)
+                accountWriteAmplification(partition_id, partition);
+        }
     }
 
     for (auto & partition : partitions)
@@ -109,7 +114,12 @@ IMergeSelector::PartsRanges DanceMergeSelector::selectMulti(const PartsRanges &
     for (auto & partition : partitions)
     {
         if (partition.size() >= 2)
-            num_parts_of_partitions[toPart(partition.front().data)->info.partition_id] += partition.size();
+        {
+            auto & partition_id = toPart(partition.front().data)->info.partition_id;
+            num_parts_of_partitions[partition_id] += partition.size();
+            if (settings.enable_write_amplification_budget)
+                accountWriteAmplification(partition_id, partition);
+        }
     }
 
     for (auto & partition : partitions)
@@ -207,6 +217,7 @@ void DanceMergeSelector::selectWithinPartition(const PartsRange & parts, const s
 
     auto & partition_id = toPart(parts.front().data)->info.partition_id;
     bool enable_batch_select = enable_batch_select_for_partition(partition_id);
+    bool over_wa_budget = settings.enable_write_amplification_budget && isOverWriteAmplificationBudget(partition_id);
 
     /// score_table[i][j] means begin with i and length is j --> range [i, i + j - 1]
     std::vector<std::vector<double>> score_table;
@@ -256,6 +267,18 @@ void DanceMergeSelector::selectWithinPartition(const PartsRange & parts, const s
             if (!allow(sum_size, max_size, min_age, end - begin))
                 continue;
 
+            if (over_wa_budget)
+            {
+                /// The partition has already been rewritten write_amplification_budget times.
+                /// Spend further writes only on merges with a high read-cost reduction per byte
+                /// written: collapsing (end - begin - 1) per-part fixed costs at the price of
+                /// rewriting sum_size bytes. Big-part consolidations fall below the threshold
+                /// and are deferred until enough small parts accumulate around them.
+                double benefit_per_byte = (end - begin - 1) * static_cast<double>(settings.size_fixed_cost_to_add) / sum_size;
+                if (benefit_per_byte < settings.write_amplification_min_benefit)
+                    continue;
+            }
+
             double current_score = score(end - begin, sum_size, settings.size_fixed_cost_to_add, settings.score_count_exp);
 
             size_t size_prev_at_left = begin == 0 ? 0 : parts[begin - 1].size;
@@ -321,6 +344,29 @@ void DanceMergeSelector::selectWithinPartition(const PartsRange & parts, const s
     }
 }
 
+void DanceMergeSelector::accountWriteAmplification(const String & partition_id, const PartsRange & parts)
+{
+    double & total = total_bytes_of_partitions[partition_id];
+    double & rewritten = rewritten_bytes_of_partitions[partition_id];
+    for (const auto & part : parts)
+    {
+        total += part.size;
+        /// A part of level L had its bytes written once at insert time and rewritten by
+        /// roughly L merges, so size * level reconstructs the partition's historical
+        /// rewrite volume from metadata the catalog already persists with every part.
+        rewritten += static_cast<double>(part.size) * part.level;
+    }
+}
+
+bool DanceMergeSelector::isOverWriteAmplificationBudget(const String & partition_id)
+{
+    double total = total_bytes_of_partitions[partition_id];
+    if (total <= 0)
+        return false;
+    double write_amplification = 1.0 + rewritten_bytes_of_partitions[partition_id] / total;
+    return write_amplification >= settings.write_amplification_budget;
+}
+
 bool DanceMergeSelector::allow(double sum_size, double max_size, double min_age, double range_size)
 {
     static size_t min_size_to_lower_base_log = log1p(1024 * 1024);
@@ -45,6 +45,13 @@ class MergeTreeMetaBase;
     /** Unique table will set it to a value <= 2^32 in order to prevent rowid(UInt32) overflow */ \
     /** Too large part has no advantage since we cannot utilize parallelism. We set max_total_rows_to_merge as 2147483647 **/ \
     M(UInt64, max_total_rows_to_merge, 2147483647, "", 0) \
+\
+    /** Defer low-value merges once the partition's estimated historical write amplification */ \
+    /** (reconstructed from part sizes and levels) reaches write_amplification_budget. */ \
+    M(Bool, enable_write_amplification_budget, false, "", 0) \
+    M(Float, write_amplification_budget, 8.0, "", 0) \
+    /** Min read-cost reduction per byte written for a range to be selected when over budget **/ \
+    M(Float, write_amplification_min_benefit, 0.05, "", 0) \
 \
     M(UInt64, max_parts_to_break, 10000, "", 0)
 
@@ -94,10 +101,15 @@ private:
     void selectWithinPartition(const PartsRange & parts, const size_t max_total_size_to_merge, MergeScheduler * merge_scheduler = nullptr);
     bool allow(double sum_size, double max_size, double min_age, double range_size);
 
+    void accountWriteAmplification(const String & partition_id, const PartsRange & parts);
+    bool isOverWriteAmplificationBudget(const String & partition_id);
+
     [[maybe_unused]] const MergeTreeMetaBase & data;
     const Settings settings;
 
     std::unordered_map<String, size_t> num_parts_of_partitions;
+    std::unordered_map<String, double> total_bytes_of_partitions;
+    std::unordered_map<String, double> rewritten_bytes_of_partitions;
     std::unordered_map<String, std::vector<BestRangeWithScore>> best_ranges;
 
     void selectRangesFromScoreTable(const PartsRange & parts, const std::vector<std::vector<double>> & score_table, size_t i, size_t j, size_t n, size_t max_width, std::vector<BestRangeWithScore> & out);
@@ -546,6 +546,10 @@ public:
     /// If true it means that the part is belongs to unique table engine and from dumper tool
     bool low_priority = false;
 
+    /// If true the part's data lives outside the table's default namespace (manifest-only
+    /// ATTACH from an external path) and relative_path must be persisted in the part model
+    bool external_relative_path = false;
+
     Int64 bucket_number = -1;               /// bucket_number > 0 if the part is assigned to bucket
     UInt64 table_definition_hash = 0;       // cluster by definition hash for data file
 
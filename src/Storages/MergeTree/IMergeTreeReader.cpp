@@ -27,9 +27,13 @@
 #include <Compression/CachedCompressedReadBuffer.h>
 #include <Columns/ColumnArray.h>
 #include <Columns/ColumnByteMap.h>
+#include <Interpreters/ExpressionActions.h>
 #include <Interpreters/inplaceBlockConversions.h>
 #include <Storages/MergeTree/IMergeTreeReader.h>
 #include <Storages/MergeTree/MergeTreeSuffix.h>
+#include <Common/HashTable/Hash.h>
+#include <Common/LRUCache.h>
+#include <Common/SipHash.h>
 #include <Common/typeid_cast.h>
 
 
@@ -39,6 +43,44 @@ namespace DB
 namespace
 {
     using OffsetColumns = std::map<std::string, ColumnPtr>;
+
+    /// Compiled adapter for reading parts written before a schema change. The
+    /// actions that synthesize missing defaults or cast changed types depend
+    /// only on the (part schema, query schema) pair, so they are built once and
+    /// shared by all readers with the same pair instead of being rebuilt for
+    /// every block. `actions` stays null when the pair needs no work.
+    struct CompiledSchemaAdapter
+    {
+        ExpressionActionsPtr actions;
+    };
+
+    using SchemaAdapterCache = LRUCache<UInt128, CompiledSchemaAdapter, UInt128TrivialHash>;
+
+    SchemaAdapterCache & getSchemaAdapterCache()
+    {
+        static SchemaAdapterCache cache(1024);
+        return cache;
+    }
+
+    void updateHashWithColumns(SipHash & hash, const Block & block)
+    {
+        for (const auto & column : block)
+        {
+            hash.update(column.name.data(), column.name.size() + 1);
+            const auto type_name = column.type->getName();
+            hash.update(type_name.data(), type_name.size() + 1);
+        }
+    }
+
+    void updateHashWithColumns(SipHash & hash, const NamesAndTypesList & columns_list)
+    {
+        for (const auto & column : columns_list)
+        {
+            hash.update(column.name.data(), column.name.size() + 1);
+            const auto type_name = column.type->getName();
+            hash.update(type_name.data(), type_name.size() + 1);
+        }
+    }
 }
 namespace ErrorCodes
 {
@@ -177,7 +219,12 @@ void IMergeTreeReader::fillMissingColumns(Columns & res_columns, bool & should_e
                 {
                     /// We must turn a constant column into a full column because the interpreter could infer
                     /// that it is constant everywhere but in some blocks (from other parts) it can be a full column.
-                    res_columns[i] = type->createColumnConstWithDefaultValue(num_rows)->convertToFullColumnIfConst();
+                    /// The materialized default is immutable, so consecutive blocks of the same size share
+                    /// one copy instead of re-materializing it (COW copies on modification).
+                    auto & cached = materialized_defaults_cache[name];
+                    if (!cached || cached->size() != num_rows)
+                        cached = type->createColumnConstWithDefaultValue(num_rows)->convertToFullColumnIfConst();
+                    res_columns[i] = cached;
                 }
             }
         }
@@ -212,15 +259,31 @@ void IMergeTreeReader::evaluateMissingDefaults(Block additional_columns, Columns
             additional_columns.insert({res_columns[pos], name_and_type->type, name_and_type->name});
         }
 
-        auto dag = DB::evaluateMissingDefaults(
-                additional_columns, columns, metadata_snapshot->getColumns(), storage.getContext());
-        if (dag)
+        /// Compile the adapter once per (part schema, query schema) pair. All
+        /// parts written before the same ALTER hash to the same key, so wide
+        /// tables pay the ActionsDAG construction per schema pair, not per block.
+        SipHash hash;
+        hash.update(getMetadataColumnsHash());
+        hash.update(static_cast<UInt8>(1));
+        updateHashWithColumns(hash, additional_columns);
+        updateHashWithColumns(hash, columns);
+        UInt128 key;
+        hash.get128(key);
+
+        auto adapter = getSchemaAdapterCache().getOrSet(key, [&]
         {
-            auto actions = std::make_shared<
-                ExpressionActions>(std::move(dag),
-                ExpressionActionsSettings::fromSettings(storage.getContext()->getSettingsRef()));
-            actions->execute(additional_columns);
-        }
+            auto compiled = std::make_shared<CompiledSchemaAdapter>();
+            auto dag = DB::evaluateMissingDefaults(
+                    additional_columns, columns, metadata_snapshot->getColumns(), storage.getContext());
+            if (dag)
+                compiled->actions = std::make_shared<
+                    ExpressionActions>(std::move(dag),
+                    ExpressionActionsSettings::fromSettings(storage.getContext()->getSettingsRef()));
+            return compiled;
+        }).first;
+
+        if (adapter->actions)
+            adapter->actions->execute(additional_columns);
 
         /// Move columns from block.
         name_and_type = columns.begin();
@@ -235,6 +298,20 @@ void IMergeTreeReader::evaluateMissingDefaults(Block additional_columns, Columns
     }
 }
 
+UInt128 IMergeTreeReader::getMetadataColumnsHash()
+{
+    if (!metadata_columns_hash)
+    {
+        SipHash hash;
+        const auto description = metadata_snapshot->getColumns().toString();
+        hash.update(description.data(), description.size());
+        UInt128 res;
+        hash.get128(res);
+        metadata_columns_hash = res;
+    }
+    return *metadata_columns_hash;
+}
+
 NameAndTypePair IMergeTreeReader::getColumnFromPart(const NameAndTypePair & required_column) const
 {
     auto name_in_storage = required_column.getNameInStorage();
@@ -297,7 +374,26 @@ void IMergeTreeReader::performRequiredConversions(Columns & res_columns, bool ch
             copy_block.insert({res_columns[pos], getColumnFromPart(*name_and_type).type, name_and_type->name});
         }
 
-        DB::performRequiredConversions(copy_block, columns, storage.getContext());
+        /// Type conversions depend on the same schema pair, reuse the compiled adapter.
+        SipHash hash;
+        hash.update(static_cast<UInt8>(2));
+        updateHashWithColumns(hash, copy_block);
+        updateHashWithColumns(hash, columns);
+        UInt128 key;
+        hash.get128(key);
+
+        auto adapter = getSchemaAdapterCache().getOrSet(key, [&]
+        {
+            auto compiled = std::make_shared<CompiledSchemaAdapter>();
+            if (auto dag = DB::createConversions(copy_block, columns, storage.getContext()))
+                compiled->actions = std::make_shared<
+                    ExpressionActions>(std::move(dag),
+                    ExpressionActionsSettings::fromSettings(storage.getContext()->getSettingsRef()));
+            return compiled;
+        }).first;
+
+        if (adapter->actions)
+            adapter->actions->execute(copy_block);
 
         /// Move columns from block.
         name_and_type = columns.begin();
@@ -470,6 +566,7 @@ void IMergeTreeReader::readData(
     double & avg_value_size_hint = avg_value_size_hints[name_and_type.name];
     ISerialization::DeserializeBinaryBulkSettings deserialize_settings;
     deserialize_settings.avg_value_size_hint = avg_value_size_hint;
+    deserialize_settings.low_cardinality_dictionary_pool = settings.low_cardinality_dictionary_pool;
 
     const auto & name = name_and_type.name;
     auto serialization = serializations[name];
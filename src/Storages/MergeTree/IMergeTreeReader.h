@@ -88,6 +88,10 @@ protected:
     /// Returns actual column type in part, which can differ from table metadata.
     NameAndTypePair getColumnFromPart(const NameAndTypePair & required_column) const;
 
+    /// Hash of the table columns description, part of the schema adapter cache key
+    /// (two tables with identical descriptions compile identical adapters).
+    UInt128 getMetadataColumnsHash();
+
     void checkNumberOfColumns(size_t num_columns_to_read) const;
 
     void addByteMapStreams(const NameAndTypePair & name_and_type, const String & col_name,
@@ -127,6 +131,13 @@ protected:
     StorageMetadataPtr metadata_snapshot;
     MarkRanges all_mark_ranges;
 
+    /// Lazily computed, see getMetadataColumnsHash().
+    std::optional<UInt128> metadata_columns_hash;
+
+    /// Materialized defaults of columns missing from the part, shared across
+    /// blocks of the same size by fillMissingColumns().
+    std::unordered_map<String, ColumnPtr> materialized_defaults_cache;
+
     using ColumnPosition = std::optional<size_t>;
     virtual ColumnPosition findColumnForOffsets(const String & column_name) const;
 
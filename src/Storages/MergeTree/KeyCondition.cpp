@@ -2022,6 +2022,33 @@ bool KeyCondition::matchesExactContinuousRange(const DataTypes & data_types) con
     return true;
 }
 
+std::optional<Range> KeyCondition::extractSingleColumnRange() const
+{
+    std::optional<Range> res;
+
+    /// An RPN built only from FUNCTION_IN_RANGE atoms and FUNCTION_AND evaluates to the
+    /// conjunction of all atoms regardless of its shape, so the ranges can be
+    /// intersected eagerly. Anything else makes the condition too complex for the
+    /// typed search and falls back to the generic path.
+    for (const auto & element : rpn)
+    {
+        if (element.function == RPNElement::FUNCTION_IN_RANGE)
+        {
+            if (element.key_column != 0 || !element.monotonic_functions_chain.empty())
+                return {};
+
+            if (!res)
+                res = element.range;
+            else
+                res = res->intersectWith(element.range);
+        }
+        else if (element.function != RPNElement::FUNCTION_AND)
+            return {};
+    }
+
+    return res;
+}
+
 BoolMask KeyCondition::checkInHyperrectangle(
     const std::vector<Range> & hyperrectangle,
     const DataTypes & data_types) const
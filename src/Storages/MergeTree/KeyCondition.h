@@ -212,6 +212,23 @@ public:
         std::swap(left_included, right_included);
     }
 
+    /// The intersection of two ranges (may be empty).
+    Range intersectWith(const Range & r) const
+    {
+        Range res = *this;
+        if (less(res.left, r.left) || (equals(res.left, r.left) && res.left_included && !r.left_included))
+        {
+            res.left = r.left;
+            res.left_included = r.left_included;
+        }
+        if (less(r.right, res.right) || (equals(r.right, res.right) && res.right_included && !r.right_included))
+        {
+            res.right = r.right;
+            res.right_included = r.right_included;
+        }
+        return res;
+    }
+
     String toString() const;
 };
 
@@ -312,6 +329,12 @@ public:
 
     bool matchesExactContinuousRange(const DataTypes & data_types) const;
 
+    /// If the condition is a conjunction of ranges over the first key column, without
+    /// monotonic function chains, return their intersection. Allows running the index
+    /// binary search directly over typed column values instead of comparing Fields
+    /// mark by mark.
+    std::optional<Range> extractSingleColumnRange() const;
+
 private:
     /// The expression is stored as Reverse Polish Notation.
     struct RPNElement
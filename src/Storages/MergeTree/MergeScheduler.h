@@ -18,6 +18,7 @@
 #include <Storages/MergeTree/MergeTreeDataMergerMutator.h>
 #include <Storages/MergeTree/SimpleMergeSelector.h>
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <queue>
@@ -148,6 +149,23 @@ public:
         }
     }
 
+    /// Part-count pressure feedback for the write path. Merge selection reports
+    /// the number of active parts in the busiest partition on every round, so
+    /// the value tracks the current merge backlog.
+    void recordPartsPressure(size_t max_parts_in_partition)
+    {
+        parts_pressure.store(max_parts_in_partition, std::memory_order_relaxed);
+    }
+
+    /// Ratio of the busiest partition's part count to parts_to_delay_insert,
+    /// clamped to [0, 1]: 0 - merges keep up, 1 - inserts are about to be delayed.
+    double partsPressure(size_t parts_to_delay) const
+    {
+        if (parts_to_delay == 0)
+            return 0;
+        return std::min(1.0, static_cast<double>(parts_pressure.load(std::memory_order_relaxed)) / parts_to_delay);
+    }
+
     void prepare();
     bool strategyOfTime();
     bool strategyOfSize(const MergeScheduler::PartSizeInfo & part_size_info, bool only_check = false);
@@ -163,6 +181,7 @@ private:
     TimeoutQueue timeout_queue;
     MergeTimeQueue merge_queue;
     size_t max_queue_size = 0;
+    std::atomic<size_t> parts_pressure{0};
     size_t max_bytes_to_merge = 0;
     size_t pre_max_rows = 0;
     QueriesInfo queries_info;
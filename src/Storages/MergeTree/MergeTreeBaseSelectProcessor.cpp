@@ -90,6 +90,27 @@ MergeTreeBaseSelectProcessor::MergeTreeBaseSelectProcessor(
         prewhere_actions->prewhere_column_name = prewhere_info->prewhere_column_name;
         prewhere_actions->remove_prewhere_column = prewhere_info->remove_prewhere_column;
         prewhere_actions->need_filter = prewhere_info->need_filter;
+
+        if (reader_settings.enable_adaptive_prewhere_conjuncts)
+        {
+            auto conjunct_dags = prewhere_info->prewhere_actions->splitIntoConjunctActions(prewhere_info->prewhere_column_name);
+
+            /// AND accepts any numeric argument, but the conjunct filters are combined as
+            /// plain UInt8 masks, so give up on decomposition if some argument is not UInt8.
+            bool conjuncts_are_uint8 = true;
+            for (const auto & dag : conjunct_dags)
+                conjuncts_are_uint8 &= WhichDataType(dag->getIndex().front()->result_type).isUInt8();
+            if (!conjuncts_are_uint8)
+                conjunct_dags.clear();
+
+            for (const auto & dag : conjunct_dags)
+            {
+                prewhere_actions->conjunct_actions.push_back(std::make_shared<ExpressionActions>(dag, actions_settings));
+                prewhere_actions->conjunct_column_names.push_back(dag->getIndex().front()->result_name);
+            }
+
+            prewhere_actions->conjunct_stats.resize(prewhere_actions->conjunct_actions.size());
+        }
     }
 }
 
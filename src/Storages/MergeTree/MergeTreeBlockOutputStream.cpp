@@ -1,4 +1,5 @@
 #include <Storages/MergeTree/MergeTreeBlockOutputStream.h>
+#include <Storages/MergeTree/MergeScheduler.h>
 #include <Storages/MergeTree/MergeTreeDataPartInMemory.h>
 #include <Storages/StorageMergeTree.h>
 #include <Interpreters/PartLog.h>
@@ -22,6 +23,56 @@ void MergeTreeBlockOutputStream::writePrefix()
 
 
 void MergeTreeBlockOutputStream::write(const Block & block)
+{
+    if (size_t target_bytes = accumulationTargetBytes())
+    {
+        /// Merges are behind: accumulate the incoming blocks so the partitions
+        /// get fewer, larger parts instead of many small ones.
+        if (accumulated_block)
+        {
+            MutableColumns columns = accumulated_block.mutateColumns();
+            for (size_t i = 0; i < columns.size(); ++i)
+                columns[i]->insertRangeFrom(*block.getByPosition(i).column, 0, block.rows());
+            accumulated_block.setColumns(std::move(columns));
+        }
+        else
+            accumulated_block = block;
+
+        if (accumulated_block.bytes() >= target_bytes)
+            flushAccumulated();
+        return;
+    }
+
+    /// Pressure may have dropped mid-insert; don't hold earlier blocks back.
+    flushAccumulated();
+    writeImpl(block);
+}
+
+void MergeTreeBlockOutputStream::writeSuffix()
+{
+    flushAccumulated();
+}
+
+size_t MergeTreeBlockOutputStream::accumulationTargetBytes() const
+{
+    const auto settings = storage.getSettings();
+    size_t max_bytes = settings->max_bytes_to_accumulate_under_merge_pressure;
+    if (!max_bytes || !storage.merge_scheduler)
+        return 0;
+    return static_cast<size_t>(max_bytes * storage.merge_scheduler->partsPressure(settings->parts_to_delay_insert));
+}
+
+void MergeTreeBlockOutputStream::flushAccumulated()
+{
+    if (!accumulated_block)
+        return;
+
+    Block block;
+    block.swap(accumulated_block);
+    writeImpl(block);
+}
+
+void MergeTreeBlockOutputStream::writeImpl(const Block & block)
 {
     auto part_blocks = storage.writer.splitBlockIntoParts(block, max_parts_per_block, metadata_snapshot, context);
     for (auto & current_block : part_blocks)
@@ -29,12 +29,25 @@ public:
     Block getHeader() const override;
     void write(const Block & block) override;
     void writePrefix() override;
+    void writeSuffix() override;
 
 private:
+    /// Split the block into parts and add them to the table.
+    void writeImpl(const Block & block);
+
+    /// Accumulation target in bytes derived from the merge scheduler's current
+    /// part-count pressure, see max_bytes_to_accumulate_under_merge_pressure.
+    /// 0 means write every block through as is.
+    size_t accumulationTargetBytes() const;
+    void flushAccumulated();
+
     StorageMergeTree & storage;
     StorageMetadataPtr metadata_snapshot;
     size_t max_parts_per_block;
     ContextPtr context;
+
+    /// Blocks accumulated while merges are under pressure, see write()
+    Block accumulated_block;
 };
 
 }
@@ -281,6 +281,8 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMerge(
     const MergeTreeData::DataPartPtr * prev_part = nullptr;
 
     size_t parts_selected_precondition = 0;
+    size_t parts_in_partition = 0;
+    size_t max_parts_in_partition = 0;
     for (const MergeTreeData::DataPartPtr & part : data_parts)
     {
         const String & partition_id = part->info.partition_id;
@@ -293,8 +295,11 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMerge(
             /// New partition frame.
             prev_partition_id = &partition_id;
             prev_part = nullptr;
+            parts_in_partition = 0;
         }
 
+        max_parts_in_partition = std::max(max_parts_in_partition, ++parts_in_partition);
+
         /// Check predicate only for the first part in each range.
         if (!prev_part)
         {
@@ -358,6 +363,11 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMerge(
         prev_part = &part;
     }
 
+    /// Feed the current part-count backlog back to the write path, which uses it
+    /// to grow its accumulation threshold when merges fall behind.
+    if (merge_scheduler)
+        merge_scheduler->recordPartsPressure(max_parts_in_partition);
+
     if (parts_selected_precondition == 0)
     {
         if (out_disable_reason)
@@ -468,6 +478,8 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMergeMulti(
     const MergeTreeData::DataPartPtr * prev_part = nullptr;
 
     size_t parts_selected_precondition = 0;
+    size_t parts_in_partition = 0;
+    size_t max_parts_in_partition = 0;
     for (const MergeTreeData::DataPartPtr & part : data_parts)
     {
         const String & partition_id = part->info.partition_id;
@@ -480,8 +492,11 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMergeMulti(
             /// New partition frame.
             prev_partition_id = &partition_id;
             prev_part = nullptr;
+            parts_in_partition = 0;
         }
 
+        max_parts_in_partition = std::max(max_parts_in_partition, ++parts_in_partition);
+
         /// Check predicate only for the first part in each range.
         if (!prev_part)
         {
@@ -545,6 +560,11 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMergeMulti(
         prev_part = &part;
     }
 
+    /// Feed the current part-count backlog back to the write path, which uses it
+    /// to grow its accumulation threshold when merges fall behind.
+    if (merge_scheduler)
+        merge_scheduler->recordPartsPressure(max_parts_in_partition);
+
     if (parts_selected_precondition == 0)
     {
         if (out_disable_reason)
@@ -1096,10 +1116,15 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
     MergeStageProgress horizontal_stage_progress(
         column_sizes ? column_sizes->keyColumnsWeight() : 1.0);
 
+    /// Small parts mostly carry identical LowCardinality dictionaries;
+    /// share the decoded ones between the per-part sources of this merge.
+    auto dictionary_pool = std::make_shared<LowCardinalityDictionaryPool>();
+
     for (const auto & part : parts)
     {
         auto input = std::make_unique<MergeTreeSequentialSource>(
-            data, metadata_snapshot, part, merging_column_names, read_with_direct_io, true);
+            data, metadata_snapshot, part, merging_column_names, read_with_direct_io, true,
+            /*quiet=*/ false, dictionary_pool);
 
         input->setProgressCallback(
             MergeProgressCallback(merge_entry, watch_prev_elapsed, horizontal_stage_progress));
@@ -1182,7 +1207,12 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
     QueryPipeline pipeline;
     pipeline.init(Pipe::unitePipes(std::move(pipes)));
     pipeline.addTransform(std::move(merged_transform));
-    pipeline.setMaxThreads(1);
+    /// With a thread budget > 1 PipelineExecutingBlockInputStream switches to the asynchronous
+    /// executor: the per-part sources prefetch concurrently with the merging transform and the
+    /// caller thread writes the output in parallel with production. This keeps a merge over
+    /// remote parts busy on either network or CPU instead of idling on both in turn.
+    size_t merge_pipeline_threads = std::min(parts.size(), size_t(data_settings->max_merge_reading_threads));
+    pipeline.setMaxThreads(std::max(size_t(1), merge_pipeline_threads));
     BlockInputStreamPtr merged_stream = std::make_shared<PipelineExecutingBlockInputStream>(std::move(pipeline));
 
     if (deduplicate)
@@ -1312,7 +1342,7 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
                     auto column_part_source = std::make_shared<MergeTreeSequentialSource>(
                         data, metadata_snapshot, parts[part_num], /*delete_bitmap*/nullptr, column_names_, read_with_direct_io,
                         /*take_column_types_from_storage*/true,
-                        /*quiet=*/ false);
+                        /*quiet=*/ false, dictionary_pool);
 
                     column_part_source->setProgressCallback(MergeProgressCallback(merge_entry, watch_prev_elapsed, column_progress));
 
@@ -16,6 +16,7 @@
 #include "MergeTreeDataPartCNCH.h"
 
 #include <IO/LimitReadBuffer.h>
+#include <IO/ReadBufferFromMemory.h>
 #include <Storages/DiskCache/DiskCacheFactory.h>
 #include <Storages/DiskCache/MetaFileDiskCacheSegment.h>
 #include <Storages/HDFS/ReadBufferFromByteHDFS.h>
@@ -292,7 +293,11 @@ void MergeTreeDataPartCNCH::loadFromFileSystem(bool load_hint_mutation)
     }
 
     MergeTreeDataPartChecksum meta_info_pos;
-    auto checksums_ptr = loadChecksumsForPart(false);
+    /// The data footer (primary.idx/checksums.txt/metainfo.txt offsets) is merged into
+    /// the checksums entry shared through ChecksumsCache, so going through getChecksums()
+    /// lets one remote footer fetch serve every query instantiating this part instead of
+    /// re-reading the footer here per part object
+    auto checksums_ptr = getChecksums();
     meta_info_pos = checksums_ptr->files["metainfo.txt"];
 
     String data_rel_path = fs::path(getFullRelativePath()) / DATA_FILE;
@@ -338,7 +343,10 @@ const ImmutableDeleteBitmapPtr & MergeTreeDataPartCNCH::getDeleteBitmap(bool all
     if (parent_part)
         throw Exception("Projection part has no bitmap", ErrorCodes::LOGICAL_ERROR);
 
-    if (!storage.getInMemoryMetadataPtr()->hasUniqueKey() || deleted)
+    /// Parts of tables without UNIQUE KEY normally have no bitmap, but lightweight
+    /// deletes may leave one (see enable_delete_bitmap_for_normal_table); in that case
+    /// the bitmap is loaded through the same cache path as for unique tables.
+    if (deleted || (!storage.getInMemoryMetadataPtr()->hasUniqueKey() && delete_bitmap_metas.empty()))
     {
         if (delete_bitmap != nullptr)
             throw Exception("Delete bitmap for part " + name + " is not null", ErrorCodes::LOGICAL_ERROR);
@@ -526,13 +534,23 @@ MergeTreeDataPartCNCH::IndexPtr MergeTreeDataPartCNCH::loadIndex()
     String data_rel_path = fs::path(getFullRelativePath()) / DATA_FILE;
     auto data_file = openForReading(volume->getDisk(), data_rel_path, file_size);
     LimitReadBuffer buf = readPartFile(*data_file, file_offset, file_size);
-    index = loadIndexFromBuffer(buf, primary_key);
 
     if (enableDiskCache())
     {
-        auto index_seg = std::make_shared<PrimaryIndexDiskCacheSegment>(shared_from_this());
+        /// Keep the fetched bytes in a refcounted buffer, parse the index from it and hand
+        /// the same buffer to the disk cache, so warming the cache costs neither a second
+        /// remote read nor a copy
+        auto value = std::make_shared<Memory<>>(file_size);
+        buf.readStrict(value->data(), file_size);
+        ReadBufferFromMemory index_buf(value->data(), file_size);
+        index = loadIndexFromBuffer(index_buf, primary_key);
+
         auto disk_cache = DiskCacheFactory::instance().getDefault().first;
-        disk_cache->cacheSegmentsToLocalDisk({std::move(index_seg)});
+        disk_cache->setWriteBehind(PrimaryIndexDiskCacheSegment(shared_from_this()).getSegmentName(), value, file_size);
+    }
+    else
+    {
+        index = loadIndexFromBuffer(buf, primary_key);
     }
 
     return index;
@@ -976,8 +994,17 @@ void MergeTreeDataPartCNCH::preload(ThreadPool & pool) const
         serialization->enumerateStreams(callback, substream_path);
     };
 
+    /// Preloading every column of a wide part may move much more data than the first
+    /// queries will touch; preload_max_columns allows warming only the leading columns
+    /// (which usually cover the primary key and the hottest filters).
+    const size_t max_columns = storage.getSettings()->preload_max_columns;
+    size_t preloaded_columns = 0;
+
     for (const NameAndTypePair & column : *columns_ptr)
     {
+        if (max_columns && preloaded_columns >= max_columns)
+            break;
+
         if (column.type->isMap() && !column.type->isMapKVStore())
         {
             /// TODO: map
@@ -985,6 +1012,7 @@ void MergeTreeDataPartCNCH::preload(ThreadPool & pool) const
         else
         {
             addSegments(column);
+            ++preloaded_columns;
         }
     }
 
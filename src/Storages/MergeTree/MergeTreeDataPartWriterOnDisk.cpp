@@ -31,6 +31,12 @@
 #include <Columns/ColumnByteMap.h>
 #include <DataTypes/DataTypeNullable.h>
 #include <Common/FieldVisitorToString.h>
+#include <Common/Stopwatch.h>
+#include <IO/WriteBufferFromString.h>
+#include <Parsers/ASTExpressionList.h>
+#include <Parsers/ASTFunction.h>
+#include <Parsers/ASTIdentifier.h>
+#include <Parsers/queryToString.h>
 #include <utility>
 
 namespace DB
@@ -448,6 +454,107 @@ void MergeTreeDataPartWriterOnDisk::addByteMapStreams(
     column.type->enumerateStreams(serializations[column.name], callback);
 }
 
+void MergeTreeDataPartWriterOnDisk::selectAdaptiveCodec(const NameAndTypePair & name_and_type, const IColumn & column)
+{
+    const auto & [name, type] = name_and_type;
+
+    size_t max_sample_bytes = storage.getSettings()->adaptive_compression_sample_bytes;
+    size_t rows = column.size();
+    if (!rows || !max_sample_bytes)
+        return;
+
+    /// Serialize a bounded sample of the column the same way it will hit the streams,
+    /// all substreams concatenated into one buffer.
+    size_t avg_value_size = std::max<size_t>(1, column.byteSize() / rows);
+    size_t sample_rows = std::min(rows, std::max<size_t>(1, max_sample_bytes / avg_value_size));
+
+    WriteBufferFromOwnString sample_buf;
+    ISerialization::SerializeBinaryBulkSettings sample_settings;
+    sample_settings.getter = [&sample_buf](const ISerialization::SubstreamPath &) -> WriteBuffer * { return &sample_buf; };
+
+    ISerialization::SerializeBinaryBulkStatePtr sample_state;
+    serializations[name]->serializeBinaryBulkStatePrefix(sample_settings, sample_state);
+    serializations[name]->serializeBinaryBulkWithMultipleStreams(column, 0, sample_rows, sample_settings, sample_state);
+    serializations[name]->serializeBinaryBulkStateSuffix(sample_settings, sample_state);
+
+    const String & sample = sample_buf.str();
+    /// Too little data to judge; the default codec is as good a guess as any.
+    if (sample.size() < 1024)
+        return;
+
+    /// Candidate codec pipelines: generic ones always, type-specialized ones where the
+    /// type allows (a specialized codec needs a generic one behind it to actually shrink).
+    std::vector<ASTs> candidates = {{std::make_shared<ASTIdentifier>("LZ4")}, {std::make_shared<ASTIdentifier>("ZSTD")}};
+    WhichDataType which(type);
+    if (which.isInt() || which.isUInt() || which.isDateOrDateTime() || which.isEnum())
+    {
+        candidates.push_back({std::make_shared<ASTIdentifier>("Delta"), std::make_shared<ASTIdentifier>("LZ4")});
+        candidates.push_back({std::make_shared<ASTIdentifier>("DoubleDelta"), std::make_shared<ASTIdentifier>("LZ4")});
+    }
+    else if (which.isFloat())
+        candidates.push_back({std::make_shared<ASTIdentifier>("Gorilla"), std::make_shared<ASTIdentifier>("LZ4")});
+
+    struct Trial
+    {
+        CompressionCodecPtr codec;
+        size_t compressed_size;
+        UInt64 elapsed_ns;
+    };
+    std::vector<Trial> trials;
+    trials.reserve(candidates.size());
+
+    const auto & factory = CompressionCodecFactory::instance();
+    PODArray<char> compressed;
+    for (auto & families : candidates)
+    {
+        auto desc = std::make_shared<ASTFunction>();
+        desc->name = "CODEC";
+        desc->arguments = std::make_shared<ASTExpressionList>();
+        desc->arguments->children = std::move(families);
+        desc->children.push_back(desc->arguments);
+
+        auto codec = factory.get(desc, type);
+        UInt32 source_size = static_cast<UInt32>(sample.size());
+        compressed.resize(codec->getCompressedReserveSize(source_size));
+
+        Stopwatch watch;
+        UInt32 compressed_size = codec->compress(sample.data(), source_size, compressed.data());
+        trials.push_back({std::move(codec), compressed_size, watch.elapsedNanoseconds()});
+    }
+
+    size_t best_size = trials.front().compressed_size;
+    for (const auto & trial : trials)
+        best_size = std::min(best_size, trial.compressed_size);
+
+    /// Among the candidates within 5% of the best ratio take the fastest one: a slower
+    /// codec has to pay for its CPU with a visibly better ratio.
+    const Trial * chosen = nullptr;
+    for (const auto & trial : trials)
+        if (trial.compressed_size <= best_size + best_size / 20 && (!chosen || trial.elapsed_ns < chosen->elapsed_ns))
+            chosen = &trial;
+
+    IDataType::StreamCallbackWithType callback = [&](const ISerialization::SubstreamPath & substream_path, const IDataType &)
+    {
+        /// Auxiliary substreams (offsets, null maps) keep the generic-only rule of addStreams.
+        if (!ISerialization::isSpecialCompressionAllowed(substream_path))
+            return;
+
+        String stream_name = ISerialization::getFileNameForStream(name_and_type, substream_path);
+        if (auto it = column_streams.find(stream_name); it != column_streams.end())
+            it->second->compressed_buf.setCodec(chosen->codec);
+    };
+    type->enumerateStreams(serializations[name], callback);
+
+    LOG_DEBUG(
+        getLogger(),
+        "Adaptive codec for column {}: {} ({} -> {} bytes on {} sample rows)",
+        backQuoteIfNeed(name),
+        queryToString(chosen->codec->getCodecDesc()),
+        sample.size(),
+        chosen->compressed_size,
+        sample_rows);
+}
+
 /// Column must not be empty. (column.size() !== 0)
 void MergeTreeDataPartWriterOnDisk::writeUncompactedByteMapColumn(
     const NameAndTypePair & name_and_type,
@@ -750,6 +857,9 @@ void MergeTreeDataPartWriterOnDisk::writeColumn(
 
     if (inserted)
     {
+        if (adaptive_codec_pending_columns.erase(name))
+            selectAdaptiveCodec(name_and_type, column);
+
         ISerialization::SerializeBinaryBulkSettings serialize_settings;
         serialize_settings.getter = createStreamGetter(name_and_type, offset_columns);
         serializations[name]->serializeBinaryBulkStatePrefix(serialize_settings, it->second);
@@ -948,18 +1058,14 @@ void MergeTreeDataPartWriterOnDisk::writeSingleGranule(
     serialization->serializeBinaryBulkWithMultipleStreams(column, granule.start_row, granule.rows_to_write, serialize_settings, serialization_state);
 
     /// So that instead of the marks pointing to the end of the compressed block, there were marks pointing to the beginning of the next one.
-    serialization->enumerateStreams([&] (const ISerialization::SubstreamPath & substream_path)
+    for (const auto & resolved : getResolvedStreams(name_and_type, serialize_settings.path))
     {
-        bool is_offsets = !substream_path.empty() && substream_path.back().type == ISerialization::Substream::ArraySizes;
-
-        String stream_name = ISerialization::getFileNameForStream(name_and_type, substream_path);
-
         /// Don't write offsets more than one time for Nested type.
-        if (is_offsets && offset_columns.count(stream_name))
-            return;
+        if (resolved.is_offsets && offset_columns.count(resolved.stream_name))
+            continue;
 
-        column_streams[stream_name]->compressed.nextIfAtEnd();
-    }, serialize_settings.path);
+        resolved.stream->compressed.nextIfAtEnd();
+    }
 }
 
 StreamsWithMarks MergeTreeDataPartWriterOnDisk::getCurrentMarksForColumn(
@@ -968,33 +1074,58 @@ StreamsWithMarks MergeTreeDataPartWriterOnDisk::getCurrentMarksForColumn(
     ISerialization::SubstreamPath & path)
 {
     StreamsWithMarks result;
-    serializations[column.name]->enumerateStreams([&] (const ISerialization::SubstreamPath & substream_path)
+    for (const auto & resolved : getResolvedStreams(column, path))
     {
-        bool is_offsets = !substream_path.empty() && substream_path.back().type == ISerialization::Substream::ArraySizes;
-
-        String stream_name = ISerialization::getFileNameForStream(column, substream_path);
-
         /// Don't write offsets more than one time for Nested type.
-        if (is_offsets && offset_columns.count(stream_name))
-            return;
+        if (resolved.is_offsets && offset_columns.count(resolved.stream_name))
+            continue;
 
-        Stream & stream = *column_streams[stream_name];
+        Stream & stream = *resolved.stream;
 
         /// There could already be enough data to compress into the new block.
         if (stream.compressed.offset() >= settings.min_compress_block_size)
             stream.compressed.next();
 
         StreamNameAndMark stream_with_mark;
-        stream_with_mark.stream_name = stream_name;
+        stream_with_mark.stream_name = resolved.stream_name;
         stream_with_mark.mark.offset_in_compressed_file = stream.plain_hashing.count();
         stream_with_mark.mark.offset_in_decompressed_block = stream.compressed.offset();
 
         result.push_back(stream_with_mark);
-    }, path);
+    }
 
     return result;
 }
 
+const MergeTreeDataPartWriterOnDisk::ResolvedStreams &
+MergeTreeDataPartWriterOnDisk::getResolvedStreams(const NameAndTypePair & column, ISerialization::SubstreamPath & path)
+{
+    auto [it, inserted] = resolved_streams_cache.try_emplace(column.name);
+    if (inserted)
+    {
+        serializations[column.name]->enumerateStreams(
+            [&](const ISerialization::SubstreamPath & substream_path)
+            {
+                ResolvedStream resolved;
+                resolved.stream_name = ISerialization::getFileNameForStream(column, substream_path);
+                resolved.is_offsets = !substream_path.empty() && substream_path.back().type == ISerialization::Substream::ArraySizes;
+
+                auto stream_it = column_streams.find(resolved.stream_name);
+                if (stream_it == column_streams.end())
+                    throw Exception(
+                        ErrorCodes::LOGICAL_ERROR,
+                        "No stream {} for column {}",
+                        resolved.stream_name,
+                        backQuoteIfNeed(column.name));
+                resolved.stream = stream_it->second.get();
+
+                it->second.push_back(std::move(resolved));
+            },
+            path);
+    }
+    return it->second;
+}
+
 StreamsWithMarks MergeTreeDataPartWriterOnDisk::copyLastNonWrittenMarks(
     const NameAndTypePair & source_column,
     const StreamsWithMarks & source_marks,
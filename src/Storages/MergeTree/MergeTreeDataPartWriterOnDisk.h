@@ -174,6 +174,12 @@ protected:
          const String & col_name,
          const ASTPtr & effective_codec_desc);
 
+    /// Trial candidate codecs on a serialized sample of the first written block of the
+    /// column and switch its data streams to the winner. Candidates and scoring are
+    /// described at the implementation; only columns registered in
+    /// adaptive_codec_pending_columns are ever trialed.
+    void selectAdaptiveCodec(const NameAndTypePair & name_and_type, const IColumn & column);
+
     ISerialization::StreamCallback finalizeStreams(const String & name);
 
     /// Write data of one column.
@@ -284,6 +290,26 @@ protected:
     using ColumnStreams = std::map<String, StreamPtr>;
     ColumnStreams column_streams;
 
+    /** Substream names and streams of a column in enumerateStreams order, resolved once
+      * per column. The per-granule paths used to rebuild every substream file name and
+      * look it up in column_streams for each granule, which dominated the mark/flush
+      * bookkeeping cost of wide inserts; a column's substream set is fixed after its
+      * streams are added, so the resolution can be done a single time.
+      */
+    struct ResolvedStream
+    {
+        String stream_name;
+        bool is_offsets = false;
+        Stream * stream = nullptr;
+    };
+    using ResolvedStreams = std::vector<ResolvedStream>;
+    std::unordered_map<String, ResolvedStreams> resolved_streams_cache;
+
+    const ResolvedStreams & getResolvedStreams(const NameAndTypePair & column, ISerialization::SubstreamPath & path);
+
+    /// Columns whose codec is still to be chosen adaptively on their first written block.
+    NameSet adaptive_codec_pending_columns;
+
     using SerializationState = ISerialization::SerializeBinaryBulkStatePtr;
     using SerializationStates = std::unordered_map<String, SerializationState>;
 
@@ -129,7 +129,13 @@ MergeTreeDataPartWriterWide::MergeTreeDataPartWriterWide(
         else if (isMapImplicitKeyNotKV(it.name))
             addByteMapStreams({it}, parseMapNameFromImplicitColName(it.name), default_codec->getFullCodecDesc());
         else
+        {
             addStreams(it, columns.getCodecDescOrDefault(it.name, default_codec));
+            /// Columns with no CODEC clause of their own may get a better codec picked
+            /// from the first written block.
+            if (storage.getSettings()->enable_adaptive_compression_codec && !columns.hasCompressionCodec(it.name))
+                adaptive_codec_pending_columns.insert(it.name);
+        }
     }
 }
 
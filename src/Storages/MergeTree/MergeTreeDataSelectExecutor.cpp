@@ -27,6 +27,7 @@
 #include <Storages/MergeTree/MergeTreeDataSelectExecutor.h>
 #include <Storages/MergeTree/MergeTreeReadPool.h>
 #include <Storages/MergeTree/MergeTreeIndices.h>
+#include <Storages/MergeTree/MergeTreeIndexAdvisor.h>
 #include <Storages/MergeTree/MergeTreeIndexReader.h>
 #include <Storages/MergeTree/KeyCondition.h>
 #include <Storages/MergeTree/MergeTreeDataPartUUID.h>
@@ -46,6 +47,8 @@
 #include <QueryPlan/ReadFromMergeTree.h>
 #include <QueryPlan/UnionStep.h>
 
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
 #include <Core/UUID.h>
 #include <DataTypes/DataTypeDate.h>
 #include <DataTypes/DataTypeEnum.h>
@@ -826,6 +829,62 @@ DataTypes MergeTreeDataSelectExecutor::get_set_element_types(const NamesAndTypes
     return set_element_types;
 }
 
+/// Feed the index advisor with filter columns that no primary key, partition key or
+/// skip index covers, so it can suggest indexes that would have pruned this scan.
+static void adviseSkipIndexes(
+    const StorageID & storage_id,
+    const StorageMetadataPtr & metadata_snapshot,
+    const SelectQueryInfo & query_info,
+    const RangesInDataParts & parts_with_ranges)
+{
+    const auto * select = query_info.query ? query_info.query->as<ASTSelectQuery>() : nullptr;
+    if (!select)
+        return;
+
+    std::vector<ASTPtr> filters;
+    if (select->where())
+        filters.push_back(select->where());
+    if (select->prewhere())
+        filters.push_back(select->prewhere());
+    if (filters.empty())
+        return;
+
+    NameSet covered;
+    for (const auto & name : metadata_snapshot->getPrimaryKey().column_names)
+        covered.insert(name);
+    for (const auto & name : metadata_snapshot->getColumnsRequiredForPartitionKey())
+        covered.insert(name);
+    for (const auto & index : metadata_snapshot->getSecondaryIndices())
+        for (const auto & name : index.column_names)
+            covered.insert(name);
+
+    NameSet filter_columns;
+    std::function<void(const ASTPtr &)> collect = [&](const ASTPtr & node)
+    {
+        if (!node)
+            return;
+        if (const auto * identifier = node->as<ASTIdentifier>())
+            filter_columns.insert(identifier->name());
+        for (const auto & child : node->children)
+            collect(child);
+    };
+    for (const auto & filter : filters)
+        collect(filter);
+
+    size_t granules_scanned = 0;
+    for (const auto & part : parts_with_ranges)
+        granules_scanned += part.getMarksCount();
+
+    const auto & columns = metadata_snapshot->getColumns();
+    for (const auto & name : filter_columns)
+    {
+        if (covered.count(name) || !columns.hasPhysical(name))
+            continue;
+        MergeTreeIndexAdvisor::instance().recordUnindexedFilter(
+            storage_id, name, columns.getPhysical(name).type, granules_scanned);
+    }
+}
+
 RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipIndexes(
     MergeTreeMetaBase::DataPartsVector && parts,
     StorageMetadataPtr metadata_snapshot,
@@ -837,7 +896,7 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
     size_t num_streams,
     ReadFromMergeTree::IndexStats & index_stats,
     bool use_skip_indexes,
-    const MergeTreeMetaBase & /*data_*/,
+    const MergeTreeMetaBase & data_,
     bool use_sampling,
     RelativeSize relative_sample_size)
 {
@@ -1063,6 +1122,9 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
             .num_granules_after = index_and_condition.total_granules - index_and_condition.granules_dropped});
     }
 
+    if (settings.enable_index_advisor)
+        adviseSkipIndexes(data_.getStorageID(), metadata_snapshot, query_info, parts_with_ranges);
+
     return parts_with_ranges;
 }
 
@@ -1389,6 +1451,110 @@ size_t MergeTreeDataSelectExecutor::minMarksForConcurrentRead(
 }
 
 
+/// First position in [0, size) for which the predicate holds; `size` if none does.
+/// The predicate must be monotonic (false...false true...true). Both ends of the search
+/// interval are updated with conditional moves, so the loop does not depend on branch
+/// prediction.
+template <typename Pred>
+static size_t firstMarkMatching(size_t size, Pred pred)
+{
+    size_t lo = 0;
+    size_t hi = size;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        bool matched = pred(mid);
+        lo = matched ? lo : mid + 1;
+        hi = matched ? mid : hi;
+    }
+    return lo;
+}
+
+/// Binary search of a continuous key range over the marks of a single-column primary
+/// key, comparing raw column values. Mark i holds the first key of granule i, so the
+/// granule preceding the first mark >= left bound may still contain matching rows at
+/// its tail and is kept.
+template <typename Bound, typename GetMarkValue>
+static MarkRange searchMarkRangeTyped(
+    size_t marks_count, const Range & range, const Bound & left, const Bound & right, GetMarkValue get_mark_value)
+{
+    size_t begin = 0;
+    size_t end = marks_count;
+
+    if (!range.left.isNegativeInfinity())
+    {
+        size_t pos = range.left_included
+            ? firstMarkMatching(marks_count, [&](size_t i) { return !(get_mark_value(i) < left); })
+            : firstMarkMatching(marks_count, [&](size_t i) { return get_mark_value(i) > left; });
+        begin = pos == 0 ? 0 : pos - 1;
+    }
+
+    if (!range.right.isPositiveInfinity())
+    {
+        end = range.right_included
+            ? firstMarkMatching(marks_count, [&](size_t i) { return get_mark_value(i) > right; })
+            : firstMarkMatching(marks_count, [&](size_t i) { return !(get_mark_value(i) < right); });
+    }
+
+    if (end < begin)
+        end = begin;
+    return MarkRange(begin, end);
+}
+
+template <typename T>
+static std::optional<MarkRange> searchMarkRangeOnNumericIndex(const ColumnVector<T> & column, size_t marks_count, const Range & range)
+{
+    /// Compare in the Field's 64-bit domain instead of casting the bound down, so a
+    /// bound outside the column type's range cannot wrap.
+    using CompareType = NearestFieldType<T>;
+    static constexpr auto expected_field_type = is_signed_v<T> ? Field::Types::Int64 : Field::Types::UInt64;
+
+    if (!range.left.isNegativeInfinity() && range.left.getType() != expected_field_type)
+        return {};
+    if (!range.right.isPositiveInfinity() && range.right.getType() != expected_field_type)
+        return {};
+
+    CompareType left = range.left.isNegativeInfinity() ? CompareType{} : range.left.get<CompareType>();
+    CompareType right = range.right.isPositiveInfinity() ? CompareType{} : range.right.get<CompareType>();
+
+    const auto & data = column.getData();
+    return searchMarkRangeTyped(marks_count, range, left, right, [&](size_t i) { return static_cast<CompareType>(data[i]); });
+}
+
+static std::optional<MarkRange> searchMarkRangeOnStringIndex(const ColumnString & column, size_t marks_count, const Range & range)
+{
+    if (!range.left.isNegativeInfinity() && range.left.getType() != Field::Types::String)
+        return {};
+    if (!range.right.isPositiveInfinity() && range.right.getType() != Field::Types::String)
+        return {};
+
+    String left = range.left.isNegativeInfinity() ? String{} : range.left.get<String>();
+    String right = range.right.isPositiveInfinity() ? String{} : range.right.get<String>();
+
+    return searchMarkRangeTyped(
+        marks_count, range, StringRef(left), StringRef(right), [&](size_t i) { return column.getDataAt(i); });
+}
+
+/// Map a continuous key range onto marks for the primary key types common in point
+/// lookups (integers, Date, DateTime, String), bypassing per-mark Field construction.
+/// Returns nothing when the index column type is not covered; callers fall back to the
+/// generic Field-based search.
+static std::optional<MarkRange> markRangeFromPlainRangeOnIndexColumn(const IColumn & index_column, size_t marks_count, const Range & range)
+{
+    if (const auto * column_uint64 = typeid_cast<const ColumnUInt64 *>(&index_column))
+        return searchMarkRangeOnNumericIndex(*column_uint64, marks_count, range);
+    if (const auto * column_uint32 = typeid_cast<const ColumnUInt32 *>(&index_column))
+        return searchMarkRangeOnNumericIndex(*column_uint32, marks_count, range);
+    if (const auto * column_uint16 = typeid_cast<const ColumnUInt16 *>(&index_column))
+        return searchMarkRangeOnNumericIndex(*column_uint16, marks_count, range);
+    if (const auto * column_int64 = typeid_cast<const ColumnInt64 *>(&index_column))
+        return searchMarkRangeOnNumericIndex(*column_int64, marks_count, range);
+    if (const auto * column_string = typeid_cast<const ColumnString *>(&index_column))
+        return searchMarkRangeOnStringIndex(*column_string, marks_count, range);
+
+    return {};
+}
+
 /// Calculates a set of mark ranges, that could possibly contain keys, required by condition.
 /// In other words, it removes subranges from whole range, that definitely could not contain required keys.
 MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
@@ -1537,6 +1703,26 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
         /// we can use binary search algorithm to find the left and right endpoint key marks of such interval.
         /// The returned value is the minimum range of marks, containing all keys for which KeyCondition holds
 
+        /// For a single-column primary key of a common type the search can run directly
+        /// over the raw index column, without building Field objects per probed mark.
+        if (used_key_size == 1 && !key_condition.hasMonotonicFunctionsChain())
+        {
+            if (auto plain_range = key_condition.extractSingleColumnRange())
+            {
+                /// The final mark is an empty sentinel; search only real marks.
+                size_t search_marks_count = has_final_mark ? marks_count - 1 : marks_count;
+                if (auto typed_range = markRangeFromPlainRangeOnIndexColumn(*index[0], search_marks_count, *plain_range))
+                {
+                    if (typed_range->begin < typed_range->end)
+                        res.push_back(*typed_range);
+
+                    LOG_TRACE(log, "Used typed binary search over index for part {}, produced {} range",
+                        part->name, res.empty() ? "an empty" : "a continuous");
+                    return res;
+                }
+            }
+        }
+
         LOG_TRACE(log, "Running binary search on index range for part {} ({} marks)", part->name, marks_count);
 
         size_t steps = 0;
@@ -22,6 +22,7 @@
 #pragma once
 #include <cstddef>
 #include <Core/Settings.h>
+#include <DataTypes/Serializations/LowCardinalityDictionaryPool.h>
 #include <Storages/MergeTree/MergeTreeSettings.h>
 
 
@@ -36,6 +37,10 @@ struct MergeTreeReaderSettings
 {
     size_t min_bytes_to_use_direct_io = 0;
     size_t min_bytes_to_use_mmap_io = 0;
+    /// Read local disk cache segment files through the asynchronous AIO buffer
+    /// when they are at least this large, independent of min_bytes_to_use_direct_io.
+    /// 0 keeps cache reads on the synchronous path.
+    size_t min_bytes_to_use_aio_for_disk_cache = 0;
     MMappedFileCachePtr mmap_cache;
     size_t max_read_buffer_size = DBMS_DEFAULT_BUFFER_SIZE;
     /// If save_marks_in_cache is false, then, if marks are not in cache,
@@ -45,6 +50,15 @@ struct MergeTreeReaderSettings
     bool convert_nested_to_subcolumns = false;
     /// Validate checksums on reading (should be always enabled in production).
     bool checksum_on_read = true;
+    /// Key the uncompressed cache by the checksum of the compressed block instead of
+    /// (path, offset), so entries survive merges that rewrite byte-identical blocks.
+    bool use_content_addressed_uncompressed_cache = false;
+    /// Split a multi-conjunct prewhere condition and evaluate the conjuncts one by one
+    /// over a shrinking set of rows, most selective conjunct (by observed statistics) first.
+    bool enable_adaptive_prewhere_conjuncts = false;
+    /// If set, LowCardinality dictionaries decoded by this reader are shared with
+    /// other readers of the same operation (used by merges over many small parts).
+    LowCardinalityDictionaryPoolPtr low_cardinality_dictionary_pool;
 };
 
 struct MergeTreeWriterSettings
@@ -0,0 +1,92 @@
+#include <Storages/MergeTree/MergeTreeIndexAdvisor.h>
+
+#include <algorithm>
+#include <common/logger_useful.h>
+
+namespace DB
+{
+
+MergeTreeIndexAdvisor::MergeTreeIndexAdvisor() : log(&Poco::Logger::get("MergeTreeIndexAdvisor"))
+{
+}
+
+MergeTreeIndexAdvisor & MergeTreeIndexAdvisor::instance()
+{
+    static MergeTreeIndexAdvisor ret;
+    return ret;
+}
+
+void MergeTreeIndexAdvisor::recordUnindexedFilter(
+    const StorageID & storage_id, const String & column, const DataTypePtr & type, size_t granules_scanned)
+{
+    /// minmax works when values correlate with insertion order (numbers, dates);
+    /// bloom_filter handles point lookups on strings. Other types are not advised.
+    String index_type;
+    WhichDataType which(type);
+    if (which.isNativeInt() || which.isNativeUInt() || which.isFloat() || which.isDateOrDateTime())
+        index_type = "minmax";
+    else if (which.isStringOrFixedString() || which.isUUID())
+        index_type = "bloom_filter";
+    else
+        return;
+
+    std::lock_guard lock(mutex);
+
+    auto & stats = tables[storage_id.getFullTableName()][column];
+    stats.index_type = index_type;
+    ++stats.queries;
+    stats.granules_scanned += granules_scanned;
+
+    if (++records_since_report < report_period)
+        return;
+    records_since_report = 0;
+
+    const String * best_table = nullptr;
+    const String * best_column = nullptr;
+    const ColumnStats * best_stats = nullptr;
+    for (const auto & [table_name, columns] : tables)
+    {
+        for (const auto & [column_name, column_stats] : columns)
+        {
+            if (!best_stats || column_stats.granules_scanned > best_stats->granules_scanned)
+            {
+                best_table = &table_name;
+                best_column = &column_name;
+                best_stats = &column_stats;
+            }
+        }
+    }
+
+    if (best_stats)
+        LOG_INFO(
+            log,
+            "Consider: ALTER TABLE {} ADD INDEX advised_{} {} TYPE {} GRANULARITY 4 "
+            "({} queries filtered on it and scanned {} granules; merges materialize the index without a mutation)",
+            *best_table,
+            *best_column,
+            *best_column,
+            best_stats->index_type,
+            best_stats->queries,
+            best_stats->granules_scanned);
+}
+
+std::vector<MergeTreeIndexAdvisor::Candidate> MergeTreeIndexAdvisor::getRecommendations(size_t min_queries) const
+{
+    std::vector<Candidate> res;
+
+    {
+        std::lock_guard lock(mutex);
+        for (const auto & [table_name, columns] : tables)
+            for (const auto & [column_name, stats] : columns)
+                if (stats.queries >= min_queries)
+                    res.push_back({table_name, column_name, stats.index_type, stats.queries, stats.granules_scanned});
+    }
+
+    std::sort(res.begin(), res.end(), [](const auto & lhs, const auto & rhs)
+    {
+        return lhs.granules_scanned > rhs.granules_scanned;
+    });
+    return res;
+}
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+#include <Core/Types.h>
+#include <DataTypes/IDataType.h>
+#include <Interpreters/StorageID.h>
+
+namespace Poco { class Logger; }
+
+namespace DB
+{
+
+/** Collects filter columns that queries use but no primary key or skip index covers,
+  * together with the number of granules those queries had to scan. Once a column shows
+  * up often enough the advisor logs a ready-to-run ALTER TABLE ... ADD INDEX statement
+  * (minmax for numeric and date columns, bloom_filter for strings). An added index is
+  * materialized by subsequent merges for free, so no blocking mutation is needed to
+  * retrofit it.
+  *
+  * Recording is driven by MergeTreeDataSelectExecutor and gated by the
+  * enable_index_advisor setting.
+  */
+class MergeTreeIndexAdvisor : private boost::noncopyable
+{
+public:
+    static MergeTreeIndexAdvisor & instance();
+
+    /// Remember that a query filtered on an uncovered column; granules_scanned is the
+    /// number of granules the query read, i.e. an upper bound on what an index could skip.
+    void recordUnindexedFilter(const StorageID & storage_id, const String & column, const DataTypePtr & type, size_t granules_scanned);
+
+    struct Candidate
+    {
+        String table;
+        String column;
+        String index_type; /// minmax or bloom_filter
+        size_t queries = 0;
+        size_t granules_scanned = 0;
+    };
+
+    /// Candidates seen by at least min_queries queries, most scanned granules first.
+    std::vector<Candidate> getRecommendations(size_t min_queries = 10) const;
+
+private:
+    MergeTreeIndexAdvisor();
+
+    struct ColumnStats
+    {
+        String index_type;
+        size_t queries = 0;
+        size_t granules_scanned = 0;
+    };
+
+    /// Log the current top recommendation once per this many recorded filters.
+    static constexpr size_t report_period = 1000;
+
+    mutable std::mutex mutex;
+    std::unordered_map<String, std::unordered_map<String, ColumnStats>> tables;
+    size_t records_since_report = 0;
+
+    Poco::Logger * log;
+};
+
+}
@@ -0,0 +1,406 @@
+#include <Storages/MergeTree/MergeTreeIndexInverted.h>
+
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+#include <Parsers/ASTFunction.h>
+#include <Parsers/ASTLiteral.h>
+#include <Storages/MergeTree/RPNBuilder.h>
+
+#include <Poco/Logger.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+    extern const int INCORRECT_QUERY;
+}
+
+/// Extracts all tokens of the string. The string is a whole column value, so every
+/// token is bounded by separators (or the value's ends) and is complete.
+static std::vector<String> stringToTokens(const String & string, TokenExtractorPtr token_extractor)
+{
+    std::vector<String> tokens;
+
+    const char * data = string.data();
+    size_t size = string.size();
+
+    size_t cur = 0;
+    size_t token_start = 0;
+    size_t token_len = 0;
+    while (cur < size && token_extractor->nextInField(data, size, &cur, &token_start, &token_len))
+        tokens.emplace_back(data + token_start, token_len);
+
+    return tokens;
+}
+
+/// Extracts tokens from a LIKE pattern; nextLike() already drops tokens adjacent to
+/// unescaped % and _, and tokens anchored at the pattern's ends are complete because
+/// LIKE matches the whole value.
+static std::vector<String> likeStringToTokens(const String & pattern, TokenExtractorPtr token_extractor)
+{
+    std::vector<String> tokens;
+
+    size_t cur = 0;
+    String token;
+    while (cur < pattern.size() && token_extractor->nextLike(pattern, &cur, token))
+        tokens.push_back(token);
+
+    return tokens;
+}
+
+MergeTreeIndexGranuleInverted::MergeTreeIndexGranuleInverted(const String & index_name_, size_t columns_number)
+    : index_name(index_name_), token_sets(columns_number)
+{
+}
+
+void MergeTreeIndexGranuleInverted::serializeBinary(WriteBuffer & ostr) const
+{
+    if (empty())
+        throw Exception("Attempt to write empty inverted index " + backQuote(index_name), ErrorCodes::LOGICAL_ERROR);
+
+    for (const auto & tokens : token_sets)
+    {
+        writeVarUInt(tokens.size(), ostr);
+        for (const auto & token : tokens)
+            writeStringBinary(token, ostr);
+    }
+}
+
+void MergeTreeIndexGranuleInverted::deserializeBinary(ReadBuffer & istr)
+{
+    for (auto & tokens : token_sets)
+    {
+        tokens.clear();
+
+        size_t size = 0;
+        readVarUInt(size, istr);
+
+        String token;
+        for (size_t i = 0; i < size; ++i)
+        {
+            readStringBinary(token, istr);
+            tokens.insert(tokens.end(), token);
+        }
+    }
+    has_elems = true;
+}
+
+MergeTreeIndexAggregatorInverted::MergeTreeIndexAggregatorInverted(
+    const Names & index_columns_, const String & index_name_, TokenExtractorPtr token_extractor_)
+    : index_columns(index_columns_)
+    , index_name(index_name_)
+    , token_extractor(token_extractor_)
+    , granule(std::make_shared<MergeTreeIndexGranuleInverted>(index_name, index_columns.size()))
+{
+}
+
+MergeTreeIndexGranulePtr MergeTreeIndexAggregatorInverted::getGranuleAndReset()
+{
+    auto new_granule = std::make_shared<MergeTreeIndexGranuleInverted>(index_name, index_columns.size());
+    new_granule.swap(granule);
+    return new_granule;
+}
+
+void MergeTreeIndexAggregatorInverted::update(const Block & block, size_t * pos, size_t limit)
+{
+    if (*pos >= block.rows())
+        throw Exception(
+            "The provided position is not less than the number of block rows. Position: " + toString(*pos)
+                + ", Block rows: " + toString(block.rows()) + ".",
+            ErrorCodes::LOGICAL_ERROR);
+
+    size_t rows_read = std::min(limit, block.rows() - *pos);
+
+    for (size_t col = 0; col < index_columns.size(); ++col)
+    {
+        const auto & column = block.getByName(index_columns[col]).column;
+        auto & tokens = granule->token_sets[col];
+        for (size_t i = 0; i < rows_read; ++i)
+        {
+            auto ref = column->getDataAt(*pos + i);
+
+            size_t cur = 0;
+            size_t token_start = 0;
+            size_t token_len = 0;
+            while (cur < ref.size && token_extractor->nextInColumn(ref.data, ref.size, &cur, &token_start, &token_len))
+                tokens.emplace(ref.data + token_start, token_len);
+        }
+    }
+    granule->has_elems = true;
+    *pos += rows_read;
+}
+
+MergeTreeConditionInverted::MergeTreeConditionInverted(
+    const SelectQueryInfo & query_info, ContextPtr context, const Block & index_sample_block, TokenExtractorPtr token_extractor_)
+    : index_columns(index_sample_block.getNames()), token_extractor(token_extractor_)
+{
+    rpn = std::move(
+        RPNBuilder<RPNElement>(
+            query_info, context,
+            [this](const ASTPtr & node, ContextPtr /* context */, Block & block_with_constants, RPNElement & out) -> bool
+            {
+                return this->atomFromAST(node, block_with_constants, out);
+            }).extractRPN());
+}
+
+bool MergeTreeConditionInverted::alwaysUnknownOrTrue() const
+{
+    /// Check like in KeyCondition.
+    std::vector<bool> rpn_stack;
+
+    for (const auto & element : rpn)
+    {
+        if (element.function == RPNElement::FUNCTION_UNKNOWN
+            || element.function == RPNElement::ALWAYS_TRUE)
+        {
+            rpn_stack.push_back(true);
+        }
+        else if (element.function == RPNElement::FUNCTION_EQUALS
+             || element.function == RPNElement::FUNCTION_NOT_EQUALS
+             || element.function == RPNElement::FUNCTION_MULTI_SEARCH
+             || element.function == RPNElement::ALWAYS_FALSE)
+        {
+            rpn_stack.push_back(false);
+        }
+        else if (element.function == RPNElement::FUNCTION_NOT)
+        {
+            // do nothing
+        }
+        else if (element.function == RPNElement::FUNCTION_AND)
+        {
+            bool arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            bool arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 && arg2;
+        }
+        else if (element.function == RPNElement::FUNCTION_OR)
+        {
+            bool arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            bool arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 || arg2;
+        }
+        else
+            throw Exception("Unexpected function type in MergeTreeConditionInverted::RPNElement", ErrorCodes::LOGICAL_ERROR);
+    }
+
+    return rpn_stack[0];
+}
+
+bool MergeTreeConditionInverted::mayBeTrueOnGranule(MergeTreeIndexGranulePtr idx_granule) const
+{
+    std::shared_ptr<MergeTreeIndexGranuleInverted> granule
+        = std::dynamic_pointer_cast<MergeTreeIndexGranuleInverted>(idx_granule);
+    if (!granule)
+        throw Exception("Inverted index condition got a granule with the wrong type.", ErrorCodes::LOGICAL_ERROR);
+
+    auto contains_all = [&](size_t key_column, const std::vector<String> & tokens)
+    {
+        for (const auto & token : tokens)
+            if (!granule->contains(key_column, token))
+                return false;
+        return true;
+    };
+
+    /// Check like in KeyCondition.
+    std::vector<BoolMask> rpn_stack;
+    for (const auto & element : rpn)
+    {
+        if (element.function == RPNElement::FUNCTION_UNKNOWN)
+        {
+            rpn_stack.emplace_back(true, true);
+        }
+        else if (element.function == RPNElement::FUNCTION_EQUALS
+             || element.function == RPNElement::FUNCTION_NOT_EQUALS)
+        {
+            rpn_stack.emplace_back(contains_all(element.key_column, element.tokens), true);
+
+            if (element.function == RPNElement::FUNCTION_NOT_EQUALS)
+                rpn_stack.back() = !rpn_stack.back();
+        }
+        else if (element.function == RPNElement::FUNCTION_MULTI_SEARCH)
+        {
+            bool found = false;
+            for (const auto & alternative : element.set_tokens)
+                found = found || contains_all(element.key_column, alternative);
+
+            rpn_stack.emplace_back(found, true);
+        }
+        else if (element.function == RPNElement::FUNCTION_NOT)
+        {
+            rpn_stack.back() = !rpn_stack.back();
+        }
+        else if (element.function == RPNElement::FUNCTION_AND)
+        {
+            auto arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            auto arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 & arg2;
+        }
+        else if (element.function == RPNElement::FUNCTION_OR)
+        {
+            auto arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            auto arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 | arg2;
+        }
+        else if (element.function == RPNElement::ALWAYS_FALSE)
+        {
+            rpn_stack.emplace_back(false, true);
+        }
+        else if (element.function == RPNElement::ALWAYS_TRUE)
+        {
+            rpn_stack.emplace_back(true, false);
+        }
+        else
+            throw Exception("Unexpected function type in MergeTreeConditionInverted::RPNElement", ErrorCodes::LOGICAL_ERROR);
+    }
+
+    if (rpn_stack.size() != 1)
+        throw Exception("Unexpected stack size in MergeTreeConditionInverted::mayBeTrueOnGranule", ErrorCodes::LOGICAL_ERROR);
+
+    return rpn_stack[0].can_be_true;
+}
+
+bool MergeTreeConditionInverted::getKey(const ASTPtr & node, size_t & key_column_num)
+{
+    auto it = std::find(index_columns.begin(), index_columns.end(), node->getColumnName());
+    if (it == index_columns.end())
+        return false;
+
+    key_column_num = static_cast<size_t>(it - index_columns.begin());
+    return true;
+}
+
+bool MergeTreeConditionInverted::atomFromAST(const ASTPtr & node, Block & block_with_constants, RPNElement & out)
+{
+    Field const_value;
+    DataTypePtr const_type;
+    if (const auto * func = typeid_cast<const ASTFunction *>(node.get()))
+    {
+        const ASTs & args = typeid_cast<const ASTExpressionList &>(*func->arguments).children;
+
+        if (args.size() != 2)
+            return false;
+
+        size_t key_column_num = -1; /// Number of a key column (inside key_column_names array)
+        const auto & func_name = func->name;
+
+        if (!KeyCondition::getConstant(args[1], block_with_constants, const_value, const_type) || !getKey(args[0], key_column_num))
+            return false;
+
+        if (const_type && const_type->getTypeId() != TypeIndex::String
+                       && const_type->getTypeId() != TypeIndex::FixedString
+                       && const_type->getTypeId() != TypeIndex::Array)
+            return false;
+
+        out.key_column = key_column_num;
+
+        if (func_name == "equals" || func_name == "notEquals" || func_name == "hasToken")
+        {
+            out.function = func_name == "notEquals" ? RPNElement::FUNCTION_NOT_EQUALS : RPNElement::FUNCTION_EQUALS;
+            out.tokens = stringToTokens(const_value.get<String>(), token_extractor);
+            return !out.tokens.empty();
+        }
+        else if (func_name == "like" || func_name == "notLike")
+        {
+            out.function = func_name == "notLike" ? RPNElement::FUNCTION_NOT_EQUALS : RPNElement::FUNCTION_EQUALS;
+            out.tokens = likeStringToTokens(const_value.get<String>(), token_extractor);
+            return !out.tokens.empty();
+        }
+        else if (func_name == "startsWith" || func_name == "endsWith")
+        {
+            /// The token at the open end of the prefix/suffix may be a fragment of a
+            /// longer token in the data, so it cannot be required to be present.
+            out.function = RPNElement::FUNCTION_EQUALS;
+            out.tokens = stringToTokens(const_value.get<String>(), token_extractor);
+            if (out.tokens.empty())
+                return false;
+            if (func_name == "startsWith")
+                out.tokens.pop_back();
+            else
+                out.tokens.erase(out.tokens.begin());
+            return !out.tokens.empty();
+        }
+        else if (func_name == "multiSearchAny")
+        {
+            out.function = RPNElement::FUNCTION_MULTI_SEARCH;
+            for (const auto & element : const_value.get<Array>())
+            {
+                if (element.getType() != Field::Types::String)
+                    return false;
+
+                /// The needle may match in the middle of a token, so both boundary
+                /// tokens are fragments. An alternative with no complete token left
+                /// cannot prune anything, which makes the whole atom useless.
+                auto tokens = stringToTokens(element.get<String>(), token_extractor);
+                if (tokens.size() <= 2)
+                    return false;
+                tokens.erase(tokens.begin());
+                tokens.pop_back();
+                out.set_tokens.push_back(std::move(tokens));
+            }
+            return !out.set_tokens.empty();
+        }
+
+        return false;
+    }
+    else if (KeyCondition::getConstant(node, block_with_constants, const_value, const_type))
+    {
+        /// Check constant like in KeyCondition
+        if (const_value.getType() == Field::Types::UInt64
+            || const_value.getType() == Field::Types::Int64
+            || const_value.getType() == Field::Types::Float64)
+        {
+            /// Zero in all types is represented in memory the same way as in UInt64.
+            out.function = const_value.get<UInt64>()
+                           ? RPNElement::ALWAYS_TRUE
+                           : RPNElement::ALWAYS_FALSE;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+MergeTreeIndexGranulePtr MergeTreeIndexInverted::createIndexGranule() const
+{
+    return std::make_shared<MergeTreeIndexGranuleInverted>(index.name, index.column_names.size());
+}
+
+MergeTreeIndexAggregatorPtr MergeTreeIndexInverted::createIndexAggregator() const
+{
+    return std::make_shared<MergeTreeIndexAggregatorInverted>(index.column_names, index.name, token_extractor.get());
+}
+
+MergeTreeIndexConditionPtr MergeTreeIndexInverted::createIndexCondition(const SelectQueryInfo & query, ContextPtr context) const
+{
+    return std::make_shared<MergeTreeConditionInverted>(query, context, index.sample_block, token_extractor.get());
+}
+
+bool MergeTreeIndexInverted::mayBenefitFromIndexForIn(const ASTPtr &) const
+{
+    return false;
+}
+
+MergeTreeIndexPtr invertedIndexCreator(const IndexDescription & index)
+{
+    return std::make_shared<MergeTreeIndexInverted>(index, std::make_unique<SplitTokenExtractor>());
+}
+
+void invertedIndexValidator(const IndexDescription & index, bool /*attach*/)
+{
+    if (!index.arguments.empty())
+        throw Exception("`inverted` index must not have any arguments.", ErrorCodes::INCORRECT_QUERY);
+
+    for (const auto & data_type : index.data_types)
+    {
+        if (data_type->getTypeId() != TypeIndex::String && data_type->getTypeId() != TypeIndex::FixedString)
+            throw Exception("Inverted index can be used only with `String` or `FixedString` column.", ErrorCodes::INCORRECT_QUERY);
+    }
+}
+
+}
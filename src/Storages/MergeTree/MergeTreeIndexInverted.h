@@ -0,0 +1,135 @@
+#pragma once
+
+#include <set>
+#include <Storages/MergeTree/KeyCondition.h>
+#include <Storages/MergeTree/MergeTreeIndexFullText.h>
+#include <Storages/MergeTree/MergeTreeIndices.h>
+
+namespace DB
+{
+
+/** Inverted text index for log search: each index granule stores the exact set of
+  * tokens occurring in it, so hasToken/equals/LIKE conditions produce exact granule
+  * masks instead of the probabilistic answers of tokenbf_v1. A granule that does not
+  * contain the needle's tokens is skipped with certainty, which removes the bloom
+  * filter's false-positive reads on high-cardinality log data.
+  *
+  * Tokenization reuses SplitTokenExtractor, so the same queries that can use
+  * tokenbf_v1 can use this index.
+  */
+struct MergeTreeIndexGranuleInverted final : public IMergeTreeIndexGranule
+{
+    explicit MergeTreeIndexGranuleInverted(const String & index_name_, size_t columns_number);
+
+    ~MergeTreeIndexGranuleInverted() override = default;
+
+    void serializeBinary(WriteBuffer & ostr) const override;
+    void deserializeBinary(ReadBuffer & istr) override;
+
+    bool empty() const override { return !has_elems; }
+
+    bool contains(size_t column, const String & token) const { return token_sets[column].count(token) != 0; }
+
+    String index_name;
+
+    /// Sorted unique tokens per indexed column.
+    std::vector<std::set<String>> token_sets;
+    bool has_elems = false;
+};
+
+using MergeTreeIndexGranuleInvertedPtr = std::shared_ptr<MergeTreeIndexGranuleInverted>;
+
+struct MergeTreeIndexAggregatorInverted final : IMergeTreeIndexAggregator
+{
+    MergeTreeIndexAggregatorInverted(const Names & index_columns_, const String & index_name_, TokenExtractorPtr token_extractor_);
+
+    ~MergeTreeIndexAggregatorInverted() override = default;
+
+    bool empty() const override { return !granule || granule->empty(); }
+    MergeTreeIndexGranulePtr getGranuleAndReset() override;
+
+    void update(const Block & block, size_t * pos, size_t limit) override;
+
+    Names index_columns;
+    String index_name;
+    TokenExtractorPtr token_extractor;
+
+    MergeTreeIndexGranuleInvertedPtr granule;
+};
+
+class MergeTreeConditionInverted final : public IMergeTreeIndexCondition
+{
+public:
+    MergeTreeConditionInverted(
+        const SelectQueryInfo & query_info,
+        ContextPtr context,
+        const Block & index_sample_block,
+        TokenExtractorPtr token_extractor_);
+
+    ~MergeTreeConditionInverted() override = default;
+
+    bool alwaysUnknownOrTrue() const override;
+    bool mayBeTrueOnGranule(MergeTreeIndexGranulePtr idx_granule) const override;
+
+private:
+    /// Uses RPN like KeyCondition.
+    struct RPNElement
+    {
+        enum Function
+        {
+            /// Atoms of a Boolean expression.
+            FUNCTION_EQUALS,
+            FUNCTION_NOT_EQUALS,
+            FUNCTION_MULTI_SEARCH,
+            FUNCTION_UNKNOWN, /// Can take any value.
+            /// Operators of the logical expression.
+            FUNCTION_NOT,
+            FUNCTION_AND,
+            FUNCTION_OR,
+            /// Constants
+            ALWAYS_FALSE,
+            ALWAYS_TRUE,
+        };
+
+        Function function = FUNCTION_UNKNOWN;
+        size_t key_column = 0;
+
+        /// For FUNCTION_EQUALS and FUNCTION_NOT_EQUALS: the granule must contain
+        /// all of these tokens for the needle to possibly occur in it.
+        std::vector<String> tokens;
+
+        /// For FUNCTION_MULTI_SEARCH: one token list per alternative.
+        std::vector<std::vector<String>> set_tokens;
+    };
+
+    using RPN = std::vector<RPNElement>;
+
+    bool atomFromAST(const ASTPtr & node, Block & block_with_constants, RPNElement & out);
+    bool getKey(const ASTPtr & node, size_t & key_column_num);
+
+    Names index_columns;
+    TokenExtractorPtr token_extractor;
+    RPN rpn;
+};
+
+class MergeTreeIndexInverted final : public IMergeTreeIndex
+{
+public:
+    MergeTreeIndexInverted(const IndexDescription & index_, std::unique_ptr<ITokenExtractor> && token_extractor_)
+        : IMergeTreeIndex(index_), token_extractor(std::move(token_extractor_))
+    {
+    }
+
+    ~MergeTreeIndexInverted() override = default;
+
+    MergeTreeIndexGranulePtr createIndexGranule() const override;
+    MergeTreeIndexAggregatorPtr createIndexAggregator() const override;
+
+    MergeTreeIndexConditionPtr createIndexCondition(const SelectQueryInfo & query, ContextPtr context) const override;
+
+    bool mayBenefitFromIndexForIn(const ASTPtr & node) const override;
+
+    std::unique_ptr<ITokenExtractor> token_extractor;
+};
+
+}
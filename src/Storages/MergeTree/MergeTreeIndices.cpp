@@ -98,6 +98,9 @@ MergeTreeIndexFactory::MergeTreeIndexFactory()
 
     registerCreator("bloom_filter", bloomFilterIndexCreatorNew);
     registerValidator("bloom_filter", bloomFilterIndexValidatorNew);
+
+    registerCreator("inverted", invertedIndexCreator);
+    registerValidator("inverted", invertedIndexValidator);
 }
 
 MergeTreeIndexFactory & MergeTreeIndexFactory::instance()
@@ -135,4 +135,7 @@ void bloomFilterIndexValidator(const IndexDescription & index, bool attach);
 MergeTreeIndexPtr bloomFilterIndexCreatorNew(const IndexDescription & index);
 void bloomFilterIndexValidatorNew(const IndexDescription & index, bool attach);
 
+MergeTreeIndexPtr invertedIndexCreator(const IndexDescription & index);
+void invertedIndexValidator(const IndexDescription & index, bool attach);
+
 }
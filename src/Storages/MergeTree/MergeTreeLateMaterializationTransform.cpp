@@ -0,0 +1,177 @@
+#include <Storages/MergeTree/MergeTreeLateMaterializationTransform.h>
+
+#include <IO/WriteHelpers.h>
+#include <Interpreters/Context.h>
+#include <Interpreters/castColumn.h>
+#include <Storages/MergeTree/IMergeTreeDataPart.h>
+#include <Storages/MergeTree/IMergeTreeReader.h>
+#include <Storages/MergeTree/MergeTreeIOSettings.h>
+
+#include <map>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+    extern const int NO_SUCH_DATA_PART;
+}
+
+MergeTreeLateMaterializationTransform::MergeTreeLateMaterializationTransform(
+    const Block & input_header_,
+    const Block & output_header_,
+    const StoragePtr & storage_,
+    const NamesWithAliases & fetch_columns_,
+    const String & part_name_column_,
+    const String & part_row_number_column_,
+    ContextPtr context_)
+    : ISimpleTransform(input_header_, output_header_, true)
+    , storage_holder(storage_)
+    , storage(dynamic_cast<MergeTreeMetaBase &>(*storage_))
+    , metadata_snapshot(storage_->getInMemoryMetadataPtr())
+    , fetch_columns(fetch_columns_)
+    , part_name_column(part_name_column_)
+    , part_row_number_column(part_row_number_column_)
+    , context(std::move(context_))
+    , mark_cache(storage.getContext()->getMarkCache())
+{
+    Names physical_names;
+    for (const auto & item : fetch_columns)
+        physical_names.push_back(item.first);
+    columns_for_reader = metadata_snapshot->getColumns().getByNames(ColumnsDescription::AllPhysical, physical_names, false);
+}
+
+namespace
+{
+
+/// Index of the mark whose rows contain the given row number.
+size_t findMarkByRowNumber(const MergeTreeIndexGranularity & index_granularity, size_t row_number)
+{
+    size_t left = 0;
+    size_t right = index_granularity.getMarksCountWithoutFinal();
+    /// Invariant: getMarkStartingRow(left) <= row_number < getMarkStartingRow(right)
+    while (right - left > 1)
+    {
+        size_t middle = (left + right) / 2;
+        if (index_granularity.getMarkStartingRow(middle) <= row_number)
+            left = middle;
+        else
+            right = middle;
+    }
+    return left;
+}
+
+}
+
+void MergeTreeLateMaterializationTransform::transform(Chunk & chunk)
+{
+    size_t num_rows = chunk.getNumRows();
+    const auto & input_header = getInputPort().getHeader();
+    auto input_columns = chunk.detachColumns();
+
+    ColumnPtr part_names = input_columns[input_header.getPositionByName(part_name_column)]->convertToFullColumnIfConst();
+    ColumnPtr row_numbers = input_columns[input_header.getPositionByName(part_row_number_column)]->convertToFullColumnIfConst();
+
+    /// For every input row, the fetched columns it should take its values from and the row inside them.
+    struct RowSource
+    {
+        std::shared_ptr<Columns> columns;
+        size_t row = 0;
+    };
+    std::vector<RowSource> row_sources(num_rows);
+
+    /// Group rows by part, then by mark, so that every part is opened once and its
+    /// marks are visited in ascending order.
+    std::map<StringRef, std::vector<size_t>> rows_per_part;
+    for (size_t i = 0; i < num_rows; ++i)
+        rows_per_part[part_names->getDataAt(i)].push_back(i);
+
+    MergeTreeReaderSettings reader_settings{.save_marks_in_cache = false};
+
+    for (const auto & [part_name_ref, part_rows] : rows_per_part)
+    {
+        String part_name = part_name_ref.toString();
+        auto data_part = storage.getPartIfExists(
+            part_name, {MergeTreeMetaBase::DataPartState::Committed, MergeTreeMetaBase::DataPartState::Outdated});
+        if (!data_part)
+            throw Exception(
+                "Part " + part_name + " is not found, cannot materialize columns for it", ErrorCodes::NO_SUCH_DATA_PART);
+
+        const auto & index_granularity = data_part->index_granularity;
+
+        std::map<size_t, std::vector<size_t>> rows_per_mark;
+        for (size_t i : part_rows)
+            rows_per_mark[findMarkByRowNumber(index_granularity, row_numbers->getUInt(i))].push_back(i);
+
+        auto reader = data_part->getReader(
+            columns_for_reader, metadata_snapshot, MarkRanges{MarkRange(0, data_part->getMarksCount())},
+            /* uncompressed_cache = */ nullptr, mark_cache.get(), reader_settings);
+
+        for (const auto & [mark, mark_rows] : rows_per_mark)
+        {
+            size_t mark_starting_row = index_granularity.getMarkStartingRow(mark);
+
+            size_t rows_to_read = 0;
+            for (size_t i : mark_rows)
+                rows_to_read = std::max(rows_to_read, row_numbers->getUInt(i) - mark_starting_row + 1);
+
+            auto fetched = std::make_shared<Columns>(columns_for_reader.size());
+            size_t rows_read = reader->readRows(mark, /* continue_reading = */ false, rows_to_read, *fetched);
+
+            /// All requested columns may be missing in the part; fill them with defaults then.
+            if (rows_read == 0)
+                rows_read = rows_to_read;
+            if (rows_read < rows_to_read)
+                throw Exception(
+                    "Read only " + toString(rows_read) + " rows of " + toString(rows_to_read) + " from mark "
+                        + toString(mark) + " of part " + part_name, ErrorCodes::LOGICAL_ERROR);
+
+            bool should_evaluate_missing_defaults = false;
+            reader->fillMissingColumns(*fetched, should_evaluate_missing_defaults, rows_read);
+            if (should_evaluate_missing_defaults)
+                reader->evaluateMissingDefaults({}, *fetched);
+            reader->performRequiredConversions(*fetched);
+
+            for (size_t i : mark_rows)
+                row_sources[i] = {fetched, row_numbers->getUInt(i) - mark_starting_row};
+        }
+    }
+
+    /// Assemble the output: pass-through columns keep their input values, fetched
+    /// columns are gathered from the per-mark reads in the original row order.
+    const auto & output_header = getOutputPort().getHeader();
+    Columns res_columns;
+    res_columns.reserve(output_header.columns());
+
+    for (const auto & output_column : output_header)
+    {
+        if (input_header.has(output_column.name))
+        {
+            res_columns.push_back(input_columns[input_header.getPositionByName(output_column.name)]);
+            continue;
+        }
+
+        size_t fetch_pos = 0;
+        while (fetch_pos < fetch_columns.size() && fetch_columns[fetch_pos].second != output_column.name)
+            ++fetch_pos;
+        if (fetch_pos == fetch_columns.size())
+            throw Exception(
+                "Column " + output_column.name + " is neither passed through nor fetched", ErrorCodes::LOGICAL_ERROR);
+
+        const auto & reader_column = *std::next(columns_for_reader.begin(), fetch_pos);
+        MutableColumnPtr gathered = reader_column.type->createColumn();
+        gathered->reserve(num_rows);
+        for (size_t i = 0; i < num_rows; ++i)
+            gathered->insertFrom(*(*row_sources[i].columns)[fetch_pos], row_sources[i].row);
+
+        ColumnPtr column = std::move(gathered);
+        if (!output_column.type->equals(*reader_column.type))
+            column = castColumn({column, reader_column.type, reader_column.name}, output_column.type);
+        res_columns.push_back(std::move(column));
+    }
+
+    chunk.setColumns(std::move(res_columns), num_rows);
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <Core/Names.h>
+#include <MergeTreeCommon/MergeTreeMetaBase.h>
+#include <Processors/ISimpleTransform.h>
+
+namespace DB
+{
+
+/// Fetches the remaining columns of a top-N query for the rows that survived the
+/// partial sort (see LateMaterializationStep).
+///
+/// The input chunk carries, besides the pass-through columns, a row locator: the
+/// `_part` and `_part_row_number` virtual columns produced by the narrowed scan.
+/// For every chunk the transform groups the rows by part, reads the columns to
+/// fetch mark by mark around the located rows, and assembles the output block in
+/// the original row order. Since the partial TopN above the scan has already cut
+/// the stream to at most `limit` rows, only a handful of granules are touched.
+class MergeTreeLateMaterializationTransform : public ISimpleTransform
+{
+public:
+    MergeTreeLateMaterializationTransform(
+        const Block & input_header_,
+        const Block & output_header_,
+        const StoragePtr & storage_,
+        const NamesWithAliases & fetch_columns_,
+        const String & part_name_column_,
+        const String & part_row_number_column_,
+        ContextPtr context_);
+
+    String getName() const override { return "MergeTreeLateMaterializationTransform"; }
+
+protected:
+    void transform(Chunk & chunk) override;
+
+private:
+    /// Keeps the storage alive while the transform holds a reference to it.
+    StoragePtr storage_holder;
+    MergeTreeMetaBase & storage;
+    StorageMetadataPtr metadata_snapshot;
+    /// Physical column name in the table -> symbol it has in the output header.
+    NamesWithAliases fetch_columns;
+    NamesAndTypesList columns_for_reader;
+    String part_name_column;
+    String part_row_number_column;
+    ContextPtr context;
+    MarkCachePtr mark_cache;
+};
+
+}
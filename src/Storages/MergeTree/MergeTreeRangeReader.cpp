@@ -26,6 +26,7 @@
 #include <Interpreters/castColumn.h>
 #include <DataTypes/DataTypeNothing.h>
 #include <DataTypes/DataTypeFactory.h>
+#include <algorithm>
 
 #ifdef __SSE2__
 #include <emmintrin.h>
@@ -577,9 +578,27 @@ MergeTreeRangeReader::MergeTreeRangeReader(
             sample_block.erase(prewhere_info->row_level_column_name);
         }
 
+        Block block_before_prewhere = sample_block;
+
         if (prewhere_info->prewhere_actions)
             prewhere_info->prewhere_actions->execute(sample_block, true);
 
+        /// Per-conjunct evaluation keeps the source columns as is and appends the filter
+        /// column at the end; use it only when this matches what prewhere_actions produce.
+        if (!prewhere_info->conjunct_actions.empty())
+        {
+            block_before_prewhere.insert(
+                {DataTypeUInt8().createColumn(), std::make_shared<DataTypeUInt8>(), prewhere_info->prewhere_column_name});
+
+            use_prewhere_conjuncts = sample_block.columns() == block_before_prewhere.columns();
+            for (size_t i = 0; use_prewhere_conjuncts && i < sample_block.columns(); ++i)
+            {
+                const auto & expected = sample_block.getByPosition(i);
+                const auto & actual = block_before_prewhere.getByPosition(i);
+                use_prewhere_conjuncts = expected.name == actual.name && expected.type->equals(*actual.type);
+            }
+        }
+
         if (prewhere_info->remove_prewhere_column)
             sample_block.erase(prewhere_info->prewhere_column_name);
     }
@@ -1051,6 +1070,87 @@ static ColumnPtr combineFilterEqualSize(ColumnPtr first, ColumnPtr second)
     return mut_first;
 }
 
+void MergeTreeRangeReader::executePrewhereConjuncts(Block & block) const
+{
+    const auto & conjuncts = prewhere_info->conjunct_actions;
+    auto & stats = prewhere_info->conjunct_stats;
+    size_t num_rows = block.rows();
+
+    /// Evaluate the conjunct which removed the biggest fraction of rows so far first.
+    /// Until the first block is processed all pass rates are equal and the original
+    /// (optimizer) order is kept.
+    std::vector<size_t> order(conjuncts.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+
+    auto pass_rate = [&stats](size_t i)
+    {
+        return stats[i].rows_before ? static_cast<double>(stats[i].rows_after) / stats[i].rows_before : 1.0;
+    };
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return pass_rate(lhs) < pass_rate(rhs); });
+
+    /// Conjuncts are executed on copies of the columns they look at, so that the block
+    /// itself stays unfiltered; only these copies are shrunk as rows are filtered out.
+    Block current;
+    for (const auto & actions : conjuncts)
+        for (const auto & name : actions->getRequiredColumns())
+            if (!current.has(name))
+                current.insert(block.getByName(name));
+
+    auto mut_filter = ColumnUInt8::create(num_rows, 1);
+    auto & total_filter = mut_filter->getData();
+    size_t num_surviving = num_rows;
+
+    for (size_t pos = 0; pos < order.size() && num_surviving > 0; ++pos)
+    {
+        size_t idx = order[pos];
+        const auto & actions = conjuncts[idx];
+
+        Block conjunct_block;
+        for (const auto & name : actions->getRequiredColumns())
+            conjunct_block.insert(current.getByName(name));
+
+        size_t conjunct_rows = num_surviving;
+        actions->execute(conjunct_block, conjunct_rows);
+
+        ColumnPtr filter_column
+            = conjunct_block.getByName(prewhere_info->conjunct_column_names[idx]).column->convertToFullColumnIfConst();
+        const auto & filter_data = typeid_cast<const ColumnUInt8 &>(*filter_column).getData();
+
+        size_t num_passed = countBytesInFilter(filter_data);
+        stats[idx].rows_before += num_surviving;
+        stats[idx].rows_after += num_passed;
+
+        if (num_passed == num_surviving)
+            continue;
+
+        /// Scatter the partial filter back to the positions of still surviving rows.
+        size_t next_surviving = 0;
+        for (size_t row = 0; row < num_rows; ++row)
+        {
+            if (total_filter[row])
+            {
+                total_filter[row] = filter_data[next_surviving];
+                ++next_surviving;
+            }
+        }
+
+        num_surviving = num_passed;
+
+        /// Shrink the columns so that the remaining conjuncts see only surviving rows.
+        if (pos + 1 < order.size() && num_surviving > 0)
+        {
+            for (size_t i = 0; i < current.columns(); ++i)
+            {
+                auto & column = current.getByPosition(i).column;
+                column = column->filter(filter_data, num_passed);
+            }
+        }
+    }
+
+    block.insert({std::move(mut_filter), std::make_shared<DataTypeUInt8>(), prewhere_info->prewhere_column_name});
+}
+
 void MergeTreeRangeReader::executePrewhereActionsAndFilterColumns(ReadResult & result)
 {
     if (!prewhere_info)
@@ -1120,7 +1220,10 @@ void MergeTreeRangeReader::executePrewhereActionsAndFilterColumns(ReadResult & r
                 block.setColumns(columns);
         }
 
-        prewhere_info->prewhere_actions->execute(block);
+        if (use_prewhere_conjuncts)
+            executePrewhereConjuncts(block);
+        else
+            prewhere_info->prewhere_actions->execute(block);
 
         prewhere_column_pos = block.getPositionByName(prewhere_info->prewhere_column_name);
 
@@ -53,6 +53,23 @@ struct PrewhereExprInfo
     String prewhere_column_name;
     bool remove_prewhere_column = false;
     bool need_filter = false;
+
+    /// Per-conjunct parts of prewhere_actions if the prewhere condition is a top-level
+    /// conjunction (see ActionsDAG::splitIntoConjunctActions). When not empty, the range
+    /// reader may evaluate conjuncts one by one over a shrinking set of rows instead of
+    /// executing prewhere_actions at once, ordering them by the selectivity observed so far.
+    std::vector<ExpressionActionsPtr> conjunct_actions;
+    /// Result column name of every conjunct.
+    Names conjunct_column_names;
+
+    struct ConjunctStat
+    {
+        size_t rows_before = 0;
+        size_t rows_after = 0;
+    };
+    /// Observed per-conjunct row counts. Mutable because range readers see only const info;
+    /// every select processor owns its PrewhereExprInfo and processes blocks in one thread.
+    mutable std::vector<ConjunctStat> conjunct_stats;
 };
 
 /// MergeTreeReader iterator which allows sequential reading for arbitrary number of rows between pairs of marks in the same part.
@@ -256,6 +273,9 @@ private:
     ReadResult startReadingChain(size_t max_rows, MarkRanges & ranges);
     Columns continueReadingChain(ReadResult & result, size_t & num_rows);
     void executePrewhereActionsAndFilterColumns(ReadResult & result);
+    /// Evaluate prewhere conjuncts one by one, most selective first by observed statistics,
+    /// and append the combined filter to the block under the prewhere column name.
+    void executePrewhereConjuncts(Block & block) const;
 
     IMergeTreeReader * merge_tree_reader = nullptr;
     const MergeTreeIndexGranularity * index_granularity = nullptr;
@@ -269,6 +289,9 @@ private:
 
     bool last_reader_in_chain = false;
     bool is_initialized = false;
+    /// Whether per-conjunct prewhere evaluation is applicable for this reader
+    /// (set in the constructor if the conjunct path reproduces the sample block).
+    bool use_prewhere_conjuncts = false;
 };
 
 }
@@ -21,6 +21,7 @@
 
 #include <Storages/MergeTree/MergeTreeReadPool.h>
 #include <Storages/MergeTree/MergeTreeBaseSelectProcessor.h>
+#include <Core/UUID.h>
 #include <Common/formatReadable.h>
 #include <common/range.h>
 
@@ -51,7 +52,9 @@ MergeTreeReadPool::MergeTreeReadPool(
     const Names & column_names_,
     const BackoffSettings & backoff_settings_,
     size_t preferred_block_size_bytes_,
-    const bool do_not_steal_tasks_)
+    const bool do_not_steal_tasks_,
+    const bool enable_shared_scan_,
+    const bool enable_scan_fairness_)
     : backoff_settings{backoff_settings_}
     , backoff_state{threads_}
     , data{data_}
@@ -65,12 +68,51 @@ MergeTreeReadPool::MergeTreeReadPool(
     /// parts don't contain duplicate MergeTreeDataPart's.
     const auto per_part_sum_marks = fillPerPartInfo(parts_ranges, delete_bitmap_getter_, check_columns_);
     fillPerThreadInfo(threads_, sum_marks_, per_part_sum_marks, parts_ranges, min_marks_for_concurrent_read_);
+
+    if (enable_shared_scan_)
+    {
+        Strings part_keys;
+        part_keys.reserve(parts_ranges.size());
+        for (const auto & part : parts_ranges)
+            part_keys.push_back(sharedScanKey(*part.data_part));
+        shared_scan_handle = SharedScanTracker::instance().startScan(std::move(part_keys));
+    }
+
+    if (enable_scan_fairness_)
+        scan_quota_handle = ScanQuotaArbiter::instance().registerQuery();
+}
+
+String MergeTreeReadPool::sharedScanKey(const IMergeTreeDataPart & part) const
+{
+    return UUIDHelpers::UUIDToString(data.getStorageUUID()) + "/" + part.name;
+}
+
+bool MergeTreeReadPool::isSharedScan(const IMergeTreeDataPart & part) const
+{
+    return shared_scan_handle && SharedScanTracker::instance().isSharedScan(sharedScanKey(part));
 }
 
 
 MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read, const size_t thread, const Names & ordered_names)
 {
-    const std::lock_guard lock{mutex};
+    size_t estimated_task_bytes = 0;
+    MergeTreeReadTaskPtr task;
+    {
+        const std::lock_guard lock{mutex};
+        task = getTaskImpl(min_marks_to_read, thread, ordered_names, estimated_task_bytes);
+    }
+
+    /// Charge the task against the worker-level fair arbiter outside of the pool lock:
+    /// heavy queries may briefly wait here while lighter ones are served first.
+    if (task && scan_quota_handle)
+        ScanQuotaArbiter::instance().acquire(*scan_quota_handle, estimated_task_bytes);
+
+    return task;
+}
+
+MergeTreeReadTaskPtr MergeTreeReadPool::getTaskImpl(
+    const size_t min_marks_to_read, const size_t thread, const Names & ordered_names, size_t & estimated_task_bytes)
+{
 
     /// If number of threads was lowered due to backoff, then will assign work only for maximum 'backoff_state.current_threads' threads.
     if (thread >= backoff_state.current_threads)
@@ -155,6 +197,12 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
         }
     }
 
+    size_t marks_to_read = 0;
+    for (const auto & range : ranges_to_get_from_part)
+        marks_to_read += range.end - range.begin;
+    const size_t avg_mark_bytes = part.data_part->getBytesOnDisk() / std::max<size_t>(1, part.data_part->getMarksCount());
+    estimated_task_bytes = marks_to_read * avg_mark_bytes;
+
     auto curr_task_size_predictor = !per_part_size_predictor[part_idx] ? nullptr
         : std::make_unique<MergeTreeBlockSizePredictor>(*per_part_size_predictor[part_idx]); /// make a copy
 
@@ -24,6 +24,8 @@
 #include <Core/NamesAndTypes.h>
 #include <Storages/MergeTree/RangesInDataPart.h>
 #include <Storages/MergeTree/MergeTreeBlockReadUtils.h>
+#include <Storages/MergeTree/SharedScanTracker.h>
+#include <Storages/MergeTree/ScanQuotaArbiter.h>
 #include <MergeTreeCommon/MergeTreeMetaBase.h>
 #include <Storages/SelectQueryInfo.h>
 #include <mutex>
@@ -97,7 +99,9 @@ public:
         const PrewhereInfoPtr & prewhere_info_,
         const bool check_columns_, const Names & column_names_,
         const BackoffSettings & backoff_settings_, size_t preferred_block_size_bytes_,
-        const bool do_not_steal_tasks_ = false);
+        const bool do_not_steal_tasks_ = false,
+        const bool enable_shared_scan_ = false,
+        const bool enable_scan_fairness_ = false);
 
     MergeTreeReadTaskPtr getTask(const size_t min_marks_to_read, const size_t thread, const Names & ordered_names);
 
@@ -110,9 +114,15 @@ public:
     /// This method tells which mark ranges we have to read if we start from @from mark range
     MarkRanges getRestMarks(const IMergeTreeDataPart & part, const MarkRange & from) const;
 
+    /// Whether another concurrent query is scanning the same part right now, see SharedScanTracker
+    bool isSharedScan(const IMergeTreeDataPart & part) const;
+
     Block getHeader() const;
 
 private:
+    MergeTreeReadTaskPtr getTaskImpl(
+        const size_t min_marks_to_read, const size_t thread, const Names & ordered_names, size_t & estimated_task_bytes);
+
     std::vector<size_t> fillPerPartInfo(
         const RangesInDataParts & parts, MergeTreeMetaBase::DeleteBitmapGetter delete_bitmap_getter, const bool check_columns);
 
@@ -162,8 +172,14 @@ private:
 
     std::set<size_t> remaining_thread_tasks;
 
+    String sharedScanKey(const IMergeTreeDataPart & part) const;
+
     RangesInDataParts parts_ranges;
 
+    SharedScanTracker::ScanHandlePtr shared_scan_handle;
+
+    ScanQuotaArbiter::QueryHandlePtr scan_quota_handle;
+
     mutable std::mutex mutex;
 
     Poco::Logger * log = &Poco::Logger::get("MergeTreeReadPool");
@@ -91,6 +91,9 @@ MergeTreeReaderCompact::CompactDataReader::CompactDataReader(
         if (!settings.checksum_on_read)
             buffer->disableChecksumming();
 
+        if (settings.use_content_addressed_uncompressed_cache)
+            buffer->setContentAddressedKeys();
+
         cached_buffer = std::move(buffer);
         data_buffer = cached_buffer.get();
     }
@@ -440,6 +443,7 @@ void MergeTreeReaderCompact::readCompactData(
     ISerialization::DeserializeBinaryBulkSettings deserialize_settings;
     deserialize_settings.getter = buffer_getter;
     deserialize_settings.avg_value_size_hint = avg_value_size_hints[name];
+    deserialize_settings.low_cardinality_dictionary_pool = settings.low_cardinality_dictionary_pool;
 
     if (name_and_type.isSubcolumn())
     {
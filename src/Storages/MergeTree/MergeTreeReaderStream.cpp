@@ -132,6 +132,9 @@ MergeTreeReaderStream::MergeTreeReaderStream(
         if (!settings.checksum_on_read)
             buffer->disableChecksumming();
 
+        if (settings.use_content_addressed_uncompressed_cache)
+            buffer->setContentAddressedKeys();
+
         cached_buffer = std::move(buffer);
         data_buffer = cached_buffer.get();
     }
@@ -39,10 +39,11 @@ MergeTreeSequentialSource::MergeTreeSequentialSource(
     Names columns_to_read_,
     bool read_with_direct_io_,
     bool take_column_types_from_storage,
-    bool quiet)
+    bool quiet,
+    LowCardinalityDictionaryPoolPtr dictionary_pool_)
     : MergeTreeSequentialSource(storage_, metadata_snapshot_,
     data_part_, data_part_->getDeleteBitmap(), columns_to_read_, read_with_direct_io_,
-    take_column_types_from_storage, quiet) {}
+    take_column_types_from_storage, quiet, std::move(dictionary_pool_)) {}
 
 MergeTreeSequentialSource::MergeTreeSequentialSource(
     const MergeTreeMetaBase & storage_,
@@ -52,7 +53,8 @@ MergeTreeSequentialSource::MergeTreeSequentialSource(
     Names columns_to_read_,
     bool read_with_direct_io_,
     bool take_column_types_from_storage,
-    bool quiet)
+    bool quiet,
+    LowCardinalityDictionaryPoolPtr dictionary_pool_)
     : SourceWithProgress(metadata_snapshot_->getSampleBlockForColumns(
             columns_to_read_, storage_.getVirtuals(), storage_.getStorageID()))
     , storage(storage_)
@@ -97,6 +99,7 @@ MergeTreeSequentialSource::MergeTreeSequentialSource(
         .min_bytes_to_use_direct_io = read_with_direct_io ? 1UL : std::numeric_limits<size_t>::max(),
         .max_read_buffer_size = DBMS_DEFAULT_BUFFER_SIZE,
         .save_marks_in_cache = false,
+        .low_cardinality_dictionary_pool = std::move(dictionary_pool_),
     };
 
     reader = data_part->getReader(columns_for_reader, metadata_snapshot,
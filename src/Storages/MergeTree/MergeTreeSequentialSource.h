@@ -35,6 +35,8 @@ class MergeTreeSequentialSource : public SourceWithProgress
 public:
     /// NOTE: in case you want to read part with row id included, please add extra `_part_row_number` to
     /// the columns you want to read.
+    /// `dictionary_pool` may be shared between the sources of one merge so that
+    /// identical LowCardinality dictionaries are decoded only once across parts.
     MergeTreeSequentialSource(
         const MergeTreeMetaBase & storage_,
         const StorageMetadataPtr & metadata_snapshot_,
@@ -42,7 +44,8 @@ public:
         Names columns_to_read_,
         bool read_with_direct_io_,
         bool take_column_types_from_storage,
-        bool quiet = false);
+        bool quiet = false,
+        LowCardinalityDictionaryPoolPtr dictionary_pool_ = nullptr);
 
     MergeTreeSequentialSource(
         const MergeTreeMetaBase & storage_,
@@ -52,7 +55,8 @@ public:
         Names columns_to_read_,
         bool read_with_direct_io_,
         bool take_column_types_from_storage,
-        bool quiet = false);
+        bool quiet = false,
+        LowCardinalityDictionaryPoolPtr dictionary_pool_ = nullptr);
 
     ~MergeTreeSequentialSource() override;
 
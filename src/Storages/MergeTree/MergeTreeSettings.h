@@ -45,6 +45,8 @@ struct Settings;
 #define LIST_OF_MERGE_TREE_SETTINGS(M) \
     M(UInt64, min_compress_block_size, 0, "When granule is written, compress the data in buffer if the size of pending uncompressed data is larger or equal than the specified threshold. If this setting is not set, the corresponding global setting is used.", 0) \
     M(UInt64, max_compress_block_size, 0, "Compress the pending uncompressed data in buffer if its size is larger or equal than the specified threshold. Block of data will be compressed even if the current granule is not finished. If this setting is not set, the corresponding global setting is used.", 0) \
+    M(Bool, enable_adaptive_compression_codec, false, "For columns without an explicit CODEC clause, trial generic and type-specialized codecs on the first written block of each column and keep the best one for the rest of the part.", 0) \
+    M(UInt64, adaptive_compression_sample_bytes, 1024 * 1024, "Maximal number of serialized bytes per column that every candidate codec compresses during the adaptive trial.", 0) \
     M(UInt64, index_granularity, 8192, "How many rows correspond to one primary key value.", 0) \
     \
     /** Data storing format settings. */ \
@@ -58,6 +60,7 @@ struct Settings;
     \
     /** Merge settings. */ \
     M(UInt64, merge_max_block_size, DEFAULT_MERGE_BLOCK_SIZE, "How many rows in blocks should be formed for merge operations.", 0) \
+    M(MaxThreads, max_merge_reading_threads, 0, "Thread budget of one merge pipeline. When > 1, source parts are read by concurrent prefetching threads overlapped with the merging stage, which helps merges over remote (e.g. S3-backed) parts. 0 keeps the whole merge on a single thread.", 0) \
     M(UInt64, max_bytes_to_merge_at_max_space_in_pool, 150ULL * 1024 * 1024 * 1024, "Maximum in total size of parts to merge, when there are maximum free threads in background pool (or entries in replication queue).", 0) \
     M(UInt64, max_bytes_to_merge_at_min_space_in_pool, 1024 * 1024, "Maximum in total size of parts to merge, when there are minimum free threads in background pool (or entries in replication queue).", 0) \
     M(UInt64, max_replicated_merges_in_queue, 16, "How many tasks of merging and mutating parts are allowed simultaneously in ReplicatedMergeTree queue.", 0) \
@@ -88,6 +91,7 @@ struct Settings;
     M(UInt64, parts_to_throw_insert, 300, "If more than this number active parts in single partition, throw 'Too many parts ...' exception.", 0) \
     M(UInt64, inactive_parts_to_throw_insert, 0, "If more than this number inactive parts in single partition, throw 'Too many inactive parts ...' exception.", 0) \
     M(UInt64, max_delay_to_insert, 1, "Max delay of inserting data into MergeTree table in seconds, if there are a lot of unmerged parts in single partition.", 0) \
+    M(UInt64, max_bytes_to_accumulate_under_merge_pressure, 0, "If non-zero, INSERT blocks are accumulated before being split into parts when merges fall behind: the accumulation target grows linearly with the ratio of the busiest partition's part count to parts_to_delay_insert, up to this many bytes. Produces fewer, larger parts at high ingest rates. 0 disables the feedback.", 0) \
     M(UInt64, max_parts_in_total, 100000, "If more than this number active parts in all partitions in total, throw 'Too many parts ...' exception.", 0) \
     \
     /** Replication settings. */ \
@@ -204,12 +208,15 @@ struct Settings;
     M(Bool, enable_addition_bg_task, false, "", 0) \
     M(Int64, max_addition_bg_task_num, 32, "", 0) \
     M(Int64, max_addition_mutation_task_num, 10, "", 0) \
+    M(Bool, cnch_merge_enable_batch_mutations, true, "Apply all pending compatible mutations in a single rewrite pass per part instead of one pass per mutation.", 0) \
+    M(Bool, cnch_merge_enable_checkpoint, false, "Persist vertical merge progress in the local temporary part directory so that a retried merge task for the same output part resumes from the last fully gathered column instead of starting over.", 0) \
     M(Int64, max_partition_for_multi_select, 3, "", 0) \
     \
     /** Settings for parts cache on server for MergeTasks. Cache speed up the task scheduling. */             \
     M(UInt64, cnch_merge_parts_cache_timeout, 10 * 60, "", 0)                                  \
     M(UInt64, cnch_merge_parts_cache_min_count, 1000, "", 0)                                                  \
     M(UInt64, cnch_merge_max_total_rows_to_merge, 50000000, "", 0) \
+    M(UInt64, cnch_merge_max_bytes_inflight_per_worker, 0, "Cap on the total bytes of source parts a single worker may be merging/mutating at once. New tasks are placed on workers with headroom. 0 means no cap.", 0) \
     \
     /* Unique table related settings */\
     M(Bool, cloud_enable_staging_area, false, "", 0) \
@@ -219,6 +226,8 @@ struct Settings;
     M(UInt64, staged_part_lifetime_threshold_ms_to_block_kafka_consume, 10000, "", 0) \
     M(Seconds, unique_acquire_write_lock_timeout, 300, "", 0) \
     M(MaxThreads, cnch_parallel_dumping_threads, 8, "", 0) \
+    M(MaxThreads, cnch_parallel_dedup_threads, 8, "Max threads to dedup independent partitions of a unique table concurrently", 0) \
+    M(Bool, enable_delete_bitmap_for_normal_table, false, "Allow lightweight DELETE FROM on this table without UNIQUE KEY: matching rows are marked in delete bitmaps that readers apply at query time, and rows are removed physically when the parts are merged. DELETE and merge commits synchronize on the table lock.", 0) \
     \
     /* Metastore settings */\
     M(Bool, enable_metastore, true, "Use KV metastore to manage data parts.", 0) \
@@ -226,6 +235,10 @@ struct Settings;
     \
     M(Bool, enable_local_disk_cache, true, "Enable local disk cache", 0) \
     M(Bool, enable_preload_parts, false, "Enable preload parts", 0) \
+    M(UInt64, preload_max_columns, 0, "Preload only the marks and data streams of the first N physical columns of newly committed parts; checksums and the primary index are always preloaded. 0 - preload all columns.", 0) \
+    M(UInt64, insert_buffer_flush_interval_milliseconds, 1000, "How long blocks of buffered INSERTs (enable_insert_buffering) may wait before they are flushed through the part-dump path.", 0) \
+    M(UInt64, insert_buffer_max_bytes, 64 * 1024 * 1024, "Flush the insert buffer inline once this many bytes have accumulated for the table. 0 - no byte threshold.", 0) \
+    M(UInt64, insert_buffer_max_rows, 1048576, "Flush the insert buffer inline once this many rows have accumulated for the table. 0 - no row threshold.", 0) \
     \
     /* Renamed settings - cannot be ignored */\
     M(Bool, enable_nullable_sorting_key, false, "Alias of `allow_nullable_key`", 0) \
@@ -245,6 +258,8 @@ struct Settings;
     M(UInt64, cnch_gc_round_robin_partitions_number, 10, "", 0) \
     M(UInt64, gc_remove_part_thread_pool_size, 2, "Turn up the thread pool size to speed up GC processing of parts", 0) \
     M(UInt64, gc_remove_part_batch_size, 5000, "", 0) \
+    M(UInt64, gc_partition_scan_thread_pool_size, 1, "Number of partitions to scan concurrently when collecting garbage parts. 1 - scan partitions one by one", 0) \
+    M(UInt64, gc_partition_scan_max_rate, 0, "Max number of partition scans per second against the metastore during GC, shared by all scan threads of the table. 0 - unlimited", 0) \
     \
     /** uuid of CnchMergeTree, as we won't use uuid in CloudMergeTree */ \
     M(String, cnch_table_uuid, "", "Used for CloudMergeTree to get uuid of Cnch Table for ingestion task, like Kafka", 0) \
@@ -96,7 +96,10 @@ bool MergeTreeThreadSelectBlockInputProcessor::getNewTask()
     {
         auto rest_mark_ranges = pool->getRestMarks(*task->data_part, task->mark_ranges[0]);
 
-        if (use_uncompressed_cache)
+        /// Also use the cache when another query is scanning the same part right now:
+        /// concurrent loads of a block are collapsed into one physical read whose
+        /// decompressed data serves all the scans, see SharedScanTracker.
+        if (use_uncompressed_cache || pool->isSharedScan(*task->data_part))
             owned_uncompressed_cache = storage.getContext()->getUncompressedCache();
         owned_mark_cache = storage.getContext()->getMarkCache();
 
@@ -122,6 +125,9 @@ bool MergeTreeThreadSelectBlockInputProcessor::getNewTask()
         /// in other case we can reuse readers, anyway they will be "seeked" to required mark
         if (part_name != last_readed_part_name)
         {
+            /// A sibling scan may have started since the last task
+            if (!owned_uncompressed_cache && pool->isSharedScan(*task->data_part))
+                owned_uncompressed_cache = storage.getContext()->getUncompressedCache();
             auto rest_mark_ranges = pool->getRestMarks(*task->data_part, task->mark_ranges[0]);
             /// retain avg_value_size_hints
             reader = task->data_part->getReader(
@@ -319,7 +319,7 @@ bool MergedReadBufferWithSegmentCache::seekToMarkInSegmentCache(size_t segment_i
                             cache_path, {
                                 .buffer_size = buffer_size,
                                 .estimated_size = estimated_range_bytes,
-                                .aio_threshold = settings.min_bytes_to_use_direct_io,
+                                .aio_threshold = cacheReadAIOThreshold(),
                                 .mmap_threshold = settings.min_bytes_to_use_mmap_io,
                                 .mmap_cache = settings.mmap_cache.get()
                             }
@@ -337,7 +337,7 @@ bool MergedReadBufferWithSegmentCache::seekToMarkInSegmentCache(size_t segment_i
                         cache_path, {
                             .buffer_size = buffer_size,
                             .estimated_size = estimated_range_bytes,
-                            .aio_threshold = settings.min_bytes_to_use_direct_io,
+                            .aio_threshold = cacheReadAIOThreshold(),
                             .mmap_threshold = settings.min_bytes_to_use_mmap_io,
                             .mmap_cache = settings.mmap_cache.get()
                         }
@@ -424,6 +424,15 @@ void MergedReadBufferWithSegmentCache::initSourceBufferIfNeeded()
     }
 }
 
+size_t MergedReadBufferWithSegmentCache::cacheReadAIOThreshold() const
+{
+    // Cached segment files sit on local disks, so they can opt into the
+    // asynchronous AIO read path at their own threshold without forcing
+    // direct io on the rest of the query
+    return settings.min_bytes_to_use_aio_for_disk_cache ? settings.min_bytes_to_use_aio_for_disk_cache
+                                                        : settings.min_bytes_to_use_direct_io;
+}
+
 size_t MergedReadBufferWithSegmentCache::toSourceDataOffset(size_t logical_offset) const
 {
     return logical_offset + source_data_offset;
@@ -79,6 +79,8 @@ private:
     bool seekToMarkInSegmentCache(size_t segment_idx, const MarkInCompressedFile& mark_pos);
     void initSourceBufferIfNeeded();
 
+    inline size_t cacheReadAIOThreshold() const;
+
     inline size_t toSourceDataOffset(size_t logical_offset) const;
     inline size_t fromSourceDataOffset(size_t physical_offset) const;
 
@@ -14,6 +14,8 @@
  */
 
 #pragma once
+#include <unordered_set>
+#include <Core/Types.h>
 #include <Storages/Hive/HiveDataPart_fwd.h>
 
 namespace DB
@@ -25,6 +27,8 @@ struct BlocksInDataPart
 {
     HiveDataPartCNCHPtr data_part;
     size_t total_blocks;
+    /// Blocks pruned by statistics or the server-side skip list; never scheduled for reading
+    std::unordered_set<Int64> skipped_blocks;
 
     BlocksInDataPart() = default;
 
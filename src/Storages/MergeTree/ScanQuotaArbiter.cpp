@@ -0,0 +1,55 @@
+#include <Storages/MergeTree/ScanQuotaArbiter.h>
+
+#include <chrono>
+#include <limits>
+
+namespace DB
+{
+
+ScanQuotaArbiter::QueryHandle::~QueryHandle()
+{
+    auto & arbiter = ScanQuotaArbiter::instance();
+    {
+        std::lock_guard lock(arbiter.mutex);
+        arbiter.queries.erase(this);
+    }
+    arbiter.cv.notify_all();
+}
+
+ScanQuotaArbiter::QueryHandlePtr ScanQuotaArbiter::registerQuery()
+{
+    QueryHandlePtr handle(new QueryHandle());
+
+    std::lock_guard lock(mutex);
+    /// Start at the minimum of the running queries: the new query gets prompt slots
+    /// without accumulating unbounded credit against them.
+    UInt64 min_served = std::numeric_limits<UInt64>::max();
+    for (const auto * query : queries)
+        min_served = std::min(min_served, query->served_bytes);
+    handle->served_bytes = queries.empty() ? 0 : min_served;
+
+    queries.insert(handle.get());
+    return handle;
+}
+
+void ScanQuotaArbiter::acquire(QueryHandle & handle, size_t bytes)
+{
+    std::unique_lock lock(mutex);
+    handle.waiting = true;
+    cv.wait_for(lock, std::chrono::milliseconds(MAX_WAIT_MS), [&]
+    {
+        UInt64 min_waiting = std::numeric_limits<UInt64>::max();
+        for (const auto * query : queries)
+            if (query->waiting && query != &handle)
+                min_waiting = std::min(min_waiting, query->served_bytes);
+
+        /// Proceed when no lighter query is waiting behind us
+        return min_waiting == std::numeric_limits<UInt64>::max()
+            || handle.served_bytes <= min_waiting + BURST_BYTES;
+    });
+    handle.waiting = false;
+    handle.served_bytes += bytes;
+    cv.notify_all();
+}
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Core/Types.h>
+#include <common/singleton.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace DB
+{
+
+/** Worker-level fair arbiter for scan task dispatch across concurrent queries.
+  *
+  * Every MergeTreeReadPool registers one handle and charges the estimated bytes of
+  * each task it hands out. A query may only take its next task while its served
+  * bytes do not run too far ahead of the least-served query currently waiting for a
+  * slot, so a wide analytical scan cannot monopolize the read threads: a point query
+  * (few served bytes) is admitted immediately while the heavy query briefly waits.
+  * Waits are bounded, so dispatch stays work-conserving even when the light query
+  * stalls elsewhere.
+  */
+class ScanQuotaArbiter : public ext::singleton<ScanQuotaArbiter>
+{
+public:
+    /// One query's scan registration; unregisters itself on destruction
+    class QueryHandle : private boost::noncopyable
+    {
+    public:
+        ~QueryHandle();
+
+    private:
+        friend class ScanQuotaArbiter;
+        QueryHandle() = default;
+        UInt64 served_bytes = 0;
+        bool waiting = false;
+    };
+    using QueryHandlePtr = std::unique_ptr<QueryHandle>;
+
+    QueryHandlePtr registerQuery();
+
+    /// Charge `bytes` for the next task of the query; may briefly block when
+    /// lighter concurrent queries are waiting for a scan slot
+    void acquire(QueryHandle & handle, size_t bytes);
+
+private:
+    /// How far ahead (in served bytes) one query may run past the least-served waiting query
+    static constexpr UInt64 BURST_BYTES = 64UL << 20;
+    /// Upper bound on a single wait, keeps dispatch work-conserving
+    static constexpr UInt64 MAX_WAIT_MS = 100;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::unordered_set<QueryHandle *> queries;
+};
+
+}
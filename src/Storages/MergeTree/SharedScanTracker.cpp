@@ -0,0 +1,33 @@
+#include <Storages/MergeTree/SharedScanTracker.h>
+
+namespace DB
+{
+
+SharedScanTracker::ScanHandle::~ScanHandle()
+{
+    auto & tracker = SharedScanTracker::instance();
+    std::lock_guard lock(tracker.mutex);
+    for (const auto & key : part_keys)
+    {
+        auto it = tracker.active_scans.find(key);
+        if (it != tracker.active_scans.end() && --it->second == 0)
+            tracker.active_scans.erase(it);
+    }
+}
+
+SharedScanTracker::ScanHandlePtr SharedScanTracker::startScan(Strings part_keys)
+{
+    std::lock_guard lock(mutex);
+    for (const auto & key : part_keys)
+        ++active_scans[key];
+    return ScanHandlePtr(new ScanHandle(std::move(part_keys)));
+}
+
+bool SharedScanTracker::isSharedScan(const String & part_key) const
+{
+    std::lock_guard lock(mutex);
+    auto it = active_scans.find(part_key);
+    return it != active_scans.end() && it->second > 1;
+}
+
+}
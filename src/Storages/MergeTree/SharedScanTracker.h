@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Core/Types.h>
+#include <common/singleton.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace DB
+{
+
+/** Worker-level registry of the data parts currently being scanned.
+  *
+  * At high concurrency many queries scan the same parts at once (e.g. dashboards all
+  * reading today's partition), each performing its own physical reads of the same
+  * granules. The read path uses this registry to detect the overlap and route such
+  * reads through the uncompressed cache even when a scan is too large to use it on
+  * its own: UncompressedCache::getOrSet deduplicates concurrent loads of a block, so
+  * a single physical read and decompression serves every subscribing query.
+  */
+class SharedScanTracker : public ext::singleton<SharedScanTracker>
+{
+public:
+    /// One query's scan over a set of parts; unregisters itself on destruction
+    class ScanHandle : private boost::noncopyable
+    {
+    public:
+        ~ScanHandle();
+
+    private:
+        friend class SharedScanTracker;
+        explicit ScanHandle(Strings part_keys_) : part_keys(std::move(part_keys_)) {}
+        Strings part_keys;
+    };
+    using ScanHandlePtr = std::unique_ptr<ScanHandle>;
+
+    ScanHandlePtr startScan(Strings part_keys);
+
+    /// Whether more than one registered scan is currently reading the part
+    bool isSharedScan(const String & part_key) const;
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<String, size_t> active_scans;
+};
+
+}
@@ -28,8 +28,15 @@
 #include <Common/HostWithPorts.h>
 #include <Common/Status.h>
 #include <Common/ConsistentHashUtils/Hash.h>
+#include <Common/ThreadPool.h>
+#include <Common/thread_local_rng.h>
 #include <common/logger_useful.h>
 #include <Interpreters/Context.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteBufferFromFile.h>
+#include <IO/WriteHelpers.h>
+#include <Poco/File.h>
 
 namespace DB
 {
@@ -90,7 +97,12 @@ std::vector<std::shared_ptr<MergeTreePartition>> TableMetaEntry::getPartitionLis
 PartCacheManager::PartCacheManager(ContextMutablePtr context_)
     : WithMutableContext(context_)
 {
-    part_cache_ptr = std::make_shared<CnchDataPartCache>(getContext()->getConfigRef().getUInt("size_of_cached_parts", 100000));
+    part_cache_ptr = std::make_shared<CnchDataPartCache>(
+        getContext()->getConfigRef().getUInt("size_of_cached_parts", 100000),
+        getContext()->getConfigRef().getUInt("part_cache_shards", CnchDataPartCache::DEFAULT_SHARD_COUNT));
+    use_part_model_slab = getContext()->getConfigRef().getBool("part_cache_use_slab", false);
+    use_delta_sync = getContext()->getConfigRef().getBool("part_cache_delta_sync", false);
+    snapshot_dir = getContext()->getConfigRef().getString("part_cache_snapshot_path", "");
     metrics_updater = getContext()->getSchedulePool().createTask("PartMetricsUpdater",[this](){
         try
         {
@@ -127,6 +139,31 @@ PartCacheManager::PartCacheManager(ContextMutablePtr context_)
         /// schedule every hour.
         this->meta_lock_cleaner->scheduleAfter(3 * 1000);
     });
+    snapshot_dumper = getContext()->getSchedulePool().createTask("PartCacheSnapshotDumper", [this](){
+        try
+        {
+            dumpPartCacheSnapshots();
+        }
+        catch(...)
+        {
+            tryLogDebugCurrentException(__PRETTY_FUNCTION__);
+        }
+        this->snapshot_dumper->scheduleAfter(getContext()->getConfigRef().getUInt("part_cache_snapshot_interval_seconds", 300) * 1000);
+    });
+    audit_interval_seconds = getContext()->getConfigRef().getUInt("part_cache_audit_interval_seconds", 300);
+    audit_sample_partitions = getContext()->getConfigRef().getUInt("part_cache_audit_sample_partitions", 100);
+    audit_staleness_grace_seconds = getContext()->getConfigRef().getUInt("part_cache_audit_staleness_grace_seconds", 60);
+    cache_auditor = getContext()->getSchedulePool().createTask("PartCacheAuditor", [this](){
+        try
+        {
+            auditPartCache();
+        }
+        catch(...)
+        {
+            tryLogDebugCurrentException(__PRETTY_FUNCTION__);
+        }
+        this->cache_auditor->scheduleAfter(audit_interval_seconds * 1000);
+    });
     active_table_loader = getContext()->getSchedulePool().createTask("ActiveTablesLoader", [this](){
         // load tables when server start up.
         try
@@ -145,6 +182,16 @@ PartCacheManager::PartCacheManager(ContextMutablePtr context_)
         metrics_initializer->activateAndSchedule();
         meta_lock_cleaner->activateAndSchedule();
         active_table_loader->activateAndSchedule();
+        if (!snapshot_dir.empty())
+        {
+            snapshot_dumper->activate();
+            snapshot_dumper->scheduleAfter(getContext()->getConfigRef().getUInt("part_cache_snapshot_interval_seconds", 300) * 1000);
+        }
+        if (audit_interval_seconds)
+        {
+            cache_auditor->activate();
+            cache_auditor->scheduleAfter(audit_interval_seconds * 1000);
+        }
     }
 }
 
@@ -223,6 +270,11 @@ void PartCacheManager::mayUpdateTableMeta(const IStorage & storage)
         load_nhut(meta_ptr);
         load_table_partitions(meta_ptr);
 
+        /// Takeover path: the table was not active on this server before. Try to pre-fill the part
+        /// cache from the local snapshot so queries do not rebuild the whole state from metastore.
+        if (!snapshot_dir.empty() && getContext()->getServerType() == ServerType::cnch_server)
+            tryLoadTableFromSnapshot(storage, uuid, meta_ptr);
+
         /// may reload partition metrics.
         if (getContext()->getServerType() == ServerType::cnch_server)
             meta_ptr->partition_metrics_loaded = false;
@@ -266,8 +318,15 @@ bool PartCacheManager::checkIfCacheValidWithNHUT(const UUID & uuid, const UInt64
         /// try invalid the part cache if the cached nhut is old enough;
         if (table_entry->need_invalid_cache && getContext()->getPhysicalTimestamp() - table_entry->cached_non_host_update_ts > 9000)
         {
-            LOG_DEBUG(&Poco::Logger::get("PartCacheManager::getTableMeta"), "invalid part cache for {}. NHUT is {}", UUIDHelpers::UUIDToString(uuid), table_entry->cached_non_host_update_ts);
-            invalidPartCache(uuid);
+            if (use_delta_sync && tryDeltaSyncTableParts(uuid, table_entry))
+            {
+                table_entry->need_invalid_cache = false;
+            }
+            else
+            {
+                LOG_DEBUG(&Poco::Logger::get("PartCacheManager::getTableMeta"), "invalid part cache for {}. NHUT is {}", UUIDHelpers::UUIDToString(uuid), table_entry->cached_non_host_update_ts);
+                invalidPartCache(uuid);
+            }
         }
 
         return false;
@@ -336,6 +395,20 @@ UInt64 PartCacheManager::getTableLastUpdateTime(const UUID & uuid)
     return last_update_time;
 }
 
+UInt64 PartCacheManager::getPartitionLastSyncVersion(const UUID & uuid, const String & partition_id)
+{
+    TableMetaEntryPtr table_entry = getTableMeta(uuid);
+    if (!table_entry)
+        return 0;
+
+    auto partitions = table_entry->getPartitions({partition_id});
+    auto it = partitions.find(partition_id);
+    if (it == partitions.end())
+        return 0;
+
+    return it->second->last_sync_version.load(std::memory_order_relaxed);
+}
+
 void PartCacheManager::setTableClusterStatus(const UUID & uuid, const bool clustered)
 {
     TableMetaEntryPtr table_entry = getTableMeta(uuid);
@@ -535,6 +608,15 @@ void PartCacheManager::invalidPartCache(const UUID & uuid, const DataPartsVector
     }
 }
 
+/// Called under the partition write lock after parts have been merged into the cache.
+inline static void advanceLastSyncVersion(const PartitionInfoPtr & partition_info_ptr, const DataModelPartWrapperVector & parts_wrapper_vector)
+{
+    UInt64 max_version = partition_info_ptr->last_sync_version.load(std::memory_order_relaxed);
+    for (const auto & part_wrapper_ptr : parts_wrapper_vector)
+        max_version = std::max({max_version, part_wrapper_ptr->part_model->commit_time(), UInt64(part_wrapper_ptr->info->mutation)});
+    partition_info_ptr->last_sync_version.store(max_version, std::memory_order_relaxed);
+}
+
 void PartCacheManager::insertDataPartsIntoCache(const IStorage & table, const pb::RepeatedPtrField<Protos::DataModelPart> & parts_model, const bool is_merged_parts, const bool should_update_metrics)
 {
     /// Only cache MergeTree tables
@@ -552,10 +634,19 @@ void PartCacheManager::insertDataPartsIntoCache(const IStorage & table, const pb
     /// Do all parse jobs outside lock
     std::unordered_map<String, DataModelPartWrapperVector> partitionid_to_parts;
     std::unordered_map<String, std::shared_ptr<MergeTreePartition>> partitionid_to_partition;
+    std::unordered_map<String, PartModelSlabPtr> partitionid_to_slab;
     auto & storage = dynamic_cast<const MergeTreeMetaBase &>(table);
     for (auto & part_model : parts_model)
     {
-        auto part_wrapper_ptr = createPartWrapperFromModel(storage, part_model);
+        PartModelSlabPtr slab;
+        if (use_part_model_slab)
+        {
+            auto & slab_ref = partitionid_to_slab[part_model.part_info().partition_id()];
+            if (!slab_ref)
+                slab_ref = std::make_shared<PartModelSlab>();
+            slab = slab_ref;
+        }
+        auto part_wrapper_ptr = createPartWrapperFromModel(storage, part_model, slab);
         const auto & partition_id = part_wrapper_ptr->info->partition_id;
         if (!partitionid_to_partition.contains(partition_id))
             partitionid_to_partition[partition_id] = createParitionFromMetaString(storage, part_model.partition_minmax());
@@ -634,6 +725,7 @@ void PartCacheManager::insertDataPartsIntoCache(const IStorage & table, const pb
                 /// Force LRU cache update status (weight/evict).
                 part_cache_ptr->set({uuid, partition_id}, cached);
             }
+            advanceLastSyncVersion(partition_info_ptr, parts_wrapper_vector);
         }
         if (should_update_metrics)
         {
@@ -710,24 +802,41 @@ void PartCacheManager::loadActiveTables()
     LOG_DEBUG(&Poco::Logger::get("PartCacheManager"), "Reloading {} active tables.", tables_meta.size());
 
     auto rpc_port = getContext()->getRPCPort();
+    /// With tens of thousands of tables, constructing the storage and probing the
+    /// topology per table dominates server cold start when done serially.
+    size_t load_threads = getContext()->getConfigRef().getUInt("active_table_load_threads", 16);
+    ThreadPool load_pool(std::min(tables_meta.size(), load_threads));
     for (auto & table_meta : tables_meta)
     {
         if (table_meta.database() == "cnch_system" || table_meta.database() == "system" || Status::isDeleted(table_meta.status()))
             continue;
 
-        auto entry = getTableMeta(RPCHelpers::createUUID(table_meta.uuid()));
-        if (!entry)
+        load_pool.scheduleOrThrowOnError([this, rpc_port, table_meta_ptr = &table_meta]()
         {
-            StoragePtr table = Catalog::CatalogFactory::getTableByDataModel(getContext(), &table_meta);
+            try
+            {
+                auto entry = getTableMeta(RPCHelpers::createUUID(table_meta_ptr->uuid()));
+                if (!entry)
+                {
+                    StoragePtr table = Catalog::CatalogFactory::getTableByDataModel(getContext(), table_meta_ptr);
 
-            auto host_port = getContext()->getCnchTopologyMaster()->getTargetServer(UUIDHelpers::UUIDToString(table->getStorageUUID()), true);
-            if (host_port.empty())
-                continue;
+                    auto host_port = getContext()->getCnchTopologyMaster()->getTargetServer(UUIDHelpers::UUIDToString(table->getStorageUUID()), true);
+                    if (host_port.empty())
+                        return;
 
-            if (isLocalServer(host_port.getRPCAddress(), toString(rpc_port)))
-                mayUpdateTableMeta(*table);
-        }
+                    if (isLocalServer(host_port.getRPCAddress(), toString(rpc_port)))
+                        mayUpdateTableMeta(*table);
+                }
+            }
+            catch (...)
+            {
+                /// A single broken table should not prevent loading the rest; its
+                /// meta entry will be loaded lazily on first access instead.
+                tryLogDebugCurrentException(__PRETTY_FUNCTION__);
+            }
+        });
     }
+    load_pool.wait();
 }
 
 void PartCacheManager::updateTablePartitionsMetrics(bool skip_if_already_loaded)
@@ -750,6 +859,364 @@ void PartCacheManager::updateTablePartitionsMetrics(bool skip_if_already_loaded)
     }
 }
 
+bool PartCacheManager::tryDeltaSyncTableParts(const UUID & uuid, const TableMetaEntryPtr & table_entry)
+{
+    try
+    {
+        auto cnch_catalog = getContext()->getCnchCatalog();
+        auto storage = cnch_catalog->tryGetTableByUUID(*getContext(), UUIDHelpers::UUIDToString(uuid), TxnTimestamp::maxTS());
+        if (!storage)
+            return false;
+
+        /// Only partitions whose cache is loaded need repair; the others reload lazily anyway.
+        std::vector<PartitionInfoPtr> loaded_partitions;
+        Strings partition_ids;
+        auto & meta_partitions = table_entry->partitions;
+        for (auto it = meta_partitions.begin(); it != meta_partitions.end(); it++)
+        {
+            if ((*it)->cache_status == CacheStatus::LOADED)
+            {
+                loaded_partitions.push_back(*it);
+                partition_ids.push_back((*it)->partition_id);
+            }
+        }
+        if (loaded_partitions.empty())
+            return true;
+
+        auto current_versions = cnch_catalog->getPartitionsPartsVersion(storage, partition_ids);
+        const auto & merge_tree_storage = dynamic_cast<const MergeTreeMetaBase &>(*storage);
+
+        for (auto & partition_info_ptr : loaded_partitions)
+        {
+            const auto & partition_id = partition_info_ptr->partition_id;
+            auto found = current_versions.find(partition_id);
+            UInt64 synced_version = partition_info_ptr->last_sync_version;
+
+            /// Without a version record (data written before the protocol was introduced) or a
+            /// synced version we cannot prove freshness, so fall back to reloading this partition.
+            if (found == current_versions.end() || !synced_version)
+            {
+                auto partition_write_lock = partition_info_ptr->writeLock();
+                partition_info_ptr->cache_status = CacheStatus::UINIT;
+                part_cache_ptr->remove({uuid, partition_id});
+                continue;
+            }
+
+            if (found->second <= synced_version)
+                continue;
+
+            auto delta = cnch_catalog->getDataPartsDeltaInPartitions(storage, {partition_id}, TxnTimestamp{synced_version});
+            DataModelPartWrapperVector delta_wrappers;
+            delta_wrappers.reserve(delta.size());
+            for (auto & part_model_ptr : delta)
+                delta_wrappers.push_back(createPartWrapperFromModelPtr(merge_tree_storage, part_model_ptr));
+
+            auto partition_write_lock = partition_info_ptr->writeLock();
+            if (partition_info_ptr->cache_status != CacheStatus::LOADED)
+                continue;
+            auto cached = part_cache_ptr->get({uuid, partition_id});
+            if (!cached)
+            {
+                partition_info_ptr->cache_status = CacheStatus::UINIT;
+                continue;
+            }
+            for (auto & part_wrapper_ptr : delta_wrappers)
+            {
+                auto it = cached->find(part_wrapper_ptr->name);
+                /// do not overwrite if the cached data is newer.
+                if (it == cached->end() || (*it)->part_model->commit_time() < part_wrapper_ptr->part_model->commit_time())
+                    cached->update(part_wrapper_ptr->name, part_wrapper_ptr);
+            }
+            /// Force LRU cache update status (weight/evict).
+            part_cache_ptr->set({uuid, partition_id}, cached);
+            advanceLastSyncVersion(partition_info_ptr, delta_wrappers);
+            if (partition_info_ptr->last_sync_version < found->second)
+                partition_info_ptr->last_sync_version = found->second;
+
+            LOG_DEBUG(
+                &Poco::Logger::get("PartCacheManager"),
+                "Delta synced {} parts for table {} partition {} since version {}",
+                delta_wrappers.size(), UUIDHelpers::UUIDToString(uuid), partition_id, synced_version);
+        }
+        return true;
+    }
+    catch (...)
+    {
+        tryLogDebugCurrentException(__PRETTY_FUNCTION__);
+        return false;
+    }
+}
+
+void PartCacheManager::auditPartCache()
+{
+    auto cnch_catalog = getContext()->getCnchCatalog();
+
+    std::unordered_map<UUID, TableMetaEntryPtr> tables;
+    {
+        std::unique_lock<std::mutex> lock(cache_mutex);
+        tables = active_tables;
+    }
+
+    UInt64 checked = 0;
+    UInt64 stale = 0;
+    UInt64 max_staleness = 0;
+    size_t budget = audit_sample_partitions;
+
+    for (auto & [uuid, meta_ptr] : tables)
+    {
+        if (!budget)
+            break;
+
+        /// Only loaded partitions with a synced version can diverge silently: unloaded ones
+        /// are re-fetched from the Catalog on first use anyway.
+        std::vector<PartitionInfoPtr> candidates;
+        auto & meta_partitions = meta_ptr->partitions;
+        for (auto it = meta_partitions.begin(); it != meta_partitions.end(); it++)
+        {
+            if ((*it)->cache_status == CacheStatus::LOADED && (*it)->last_sync_version)
+                candidates.push_back(*it);
+        }
+        if (candidates.empty())
+            continue;
+
+        std::shuffle(candidates.begin(), candidates.end(), thread_local_rng);
+        if (candidates.size() > budget)
+            candidates.resize(budget);
+
+        auto storage = cnch_catalog->tryGetTableByUUID(*getContext(), UUIDHelpers::UUIDToString(uuid), TxnTimestamp::maxTS());
+        if (!storage)
+            continue;
+
+        Strings partition_ids;
+        partition_ids.reserve(candidates.size());
+        for (const auto & partition_info_ptr : candidates)
+            partition_ids.push_back(partition_info_ptr->partition_id);
+
+        auto current_versions = cnch_catalog->getPartitionsPartsVersion(storage, partition_ids);
+        budget -= candidates.size();
+        checked += candidates.size();
+
+        UInt64 now_sec = time(nullptr);
+        for (const auto & partition_info_ptr : candidates)
+        {
+            auto found = current_versions.find(partition_info_ptr->partition_id);
+            if (found == current_versions.end() || found->second <= partition_info_ptr->last_sync_version)
+                continue;
+
+            /// The cache is behind the Catalog. Age it by the commit time of the missed
+            /// version; a lag within the grace period is normal write propagation delay.
+            UInt64 commit_sec = TxnTimestamp(found->second).toSecond();
+            UInt64 staleness = now_sec > commit_sec ? now_sec - commit_sec : 0;
+            if (staleness < audit_staleness_grace_seconds)
+                continue;
+
+            ++stale;
+            max_staleness = std::max(max_staleness, staleness);
+            LOG_WARNING(
+                &Poco::Logger::get("PartCacheManager"),
+                "Cache audit: table {} partition {} is stale for {}s (cached version {}, catalog version {})",
+                UUIDHelpers::UUIDToString(uuid), partition_info_ptr->partition_id, staleness,
+                partition_info_ptr->last_sync_version, found->second);
+        }
+    }
+
+    audit_checked_partitions = checked;
+    audit_stale_partitions = stale;
+    audit_max_staleness_seconds = max_staleness;
+}
+
+PartCacheManager::CacheAuditResult PartCacheManager::getCacheAuditResult() const
+{
+    return {audit_checked_partitions.load(), audit_stale_partitions.load(), audit_max_staleness_seconds.load()};
+}
+
+namespace
+{
+    /// Local part list snapshot layout: magic, format version, partition count, then for each
+    /// partition its id, synced version and the length-prefixed serialized part models.
+    constexpr UInt64 PART_CACHE_SNAPSHOT_MAGIC = 0x434E434853505054UL;
+    constexpr UInt32 PART_CACHE_SNAPSHOT_FORMAT_VERSION = 1;
+
+    struct PartitionSnapshot
+    {
+        String partition_id;
+        UInt64 synced_version;
+        std::vector<String> part_models;
+    };
+}
+
+String PartCacheManager::getSnapshotFilePath(const UUID & uuid) const
+{
+    return snapshot_dir + "/" + UUIDHelpers::UUIDToString(uuid) + ".snapshot";
+}
+
+void PartCacheManager::dumpPartCacheSnapshots()
+{
+    Poco::File(snapshot_dir).createDirectories();
+
+    std::unordered_map<UUID, TableMetaEntryPtr> tables;
+    {
+        std::unique_lock<std::mutex> lock(cache_mutex);
+        tables = active_tables;
+    }
+
+    for (auto & [uuid, meta_ptr] : tables)
+    {
+        std::vector<PartitionSnapshot> partition_snapshots;
+        auto & meta_partitions = meta_ptr->partitions;
+        for (auto it = meta_partitions.begin(); it != meta_partitions.end(); it++)
+        {
+            auto & partition_info_ptr = *it;
+            auto partition_read_lock = partition_info_ptr->readLock();
+            if (partition_info_ptr->cache_status != CacheStatus::LOADED)
+                continue;
+            /// Without a synced version the snapshot could not be validated on restore anyway.
+            UInt64 synced_version = partition_info_ptr->last_sync_version;
+            if (!synced_version)
+                continue;
+            auto cached = part_cache_ptr->get({uuid, partition_info_ptr->partition_id});
+            if (!cached)
+                continue;
+            PartitionSnapshot snapshot{partition_info_ptr->partition_id, synced_version, {}};
+            snapshot.part_models.reserve(cached->size());
+            for (auto part_it = cached->begin(); part_it != cached->end(); part_it++)
+                snapshot.part_models.push_back((*part_it)->part_model->SerializeAsString());
+            partition_snapshots.push_back(std::move(snapshot));
+        }
+
+        if (partition_snapshots.empty())
+            continue;
+
+        /// Write to a temporary file and rename so a restore never sees a half written snapshot.
+        String file_path = getSnapshotFilePath(uuid);
+        String tmp_file_path = file_path + ".tmp";
+        {
+            WriteBufferFromFile out(tmp_file_path);
+            writeIntBinary(PART_CACHE_SNAPSHOT_MAGIC, out);
+            writeIntBinary(PART_CACHE_SNAPSHOT_FORMAT_VERSION, out);
+            writeVarUInt(partition_snapshots.size(), out);
+            for (auto & snapshot : partition_snapshots)
+            {
+                writeStringBinary(snapshot.partition_id, out);
+                writeIntBinary(snapshot.synced_version, out);
+                writeVarUInt(snapshot.part_models.size(), out);
+                for (auto & serialized : snapshot.part_models)
+                    writeStringBinary(serialized, out);
+            }
+            out.next();
+            out.sync();
+        }
+        Poco::File(tmp_file_path).renameTo(file_path);
+    }
+}
+
+void PartCacheManager::tryLoadTableFromSnapshot(const IStorage & storage, const UUID & uuid, const TableMetaEntryPtr & table_entry)
+{
+    try
+    {
+        String file_path = getSnapshotFilePath(uuid);
+        if (!Poco::File(file_path).exists())
+            return;
+
+        std::vector<PartitionSnapshot> partition_snapshots;
+        {
+            ReadBufferFromFile in(file_path);
+            UInt64 magic;
+            UInt32 format_version;
+            readIntBinary(magic, in);
+            readIntBinary(format_version, in);
+            if (magic != PART_CACHE_SNAPSHOT_MAGIC || format_version != PART_CACHE_SNAPSHOT_FORMAT_VERSION)
+                return;
+            size_t partition_count;
+            readVarUInt(partition_count, in);
+            partition_snapshots.resize(partition_count);
+            for (auto & snapshot : partition_snapshots)
+            {
+                readStringBinary(snapshot.partition_id, in);
+                readIntBinary(snapshot.synced_version, in);
+                size_t part_count;
+                readVarUInt(part_count, in);
+                snapshot.part_models.resize(part_count);
+                for (auto & serialized : snapshot.part_models)
+                    readStringBinary(serialized, in);
+            }
+        }
+
+        auto cnch_catalog = getContext()->getCnchCatalog();
+        auto storage_ptr = cnch_catalog->tryGetTableByUUID(*getContext(), UUIDHelpers::UUIDToString(uuid), TxnTimestamp::maxTS());
+        if (!storage_ptr)
+            return;
+
+        Strings partition_ids;
+        partition_ids.reserve(partition_snapshots.size());
+        for (auto & snapshot : partition_snapshots)
+            partition_ids.push_back(snapshot.partition_id);
+        auto current_versions = cnch_catalog->getPartitionsPartsVersion(storage_ptr, partition_ids);
+        auto meta_partitions = table_entry->getPartitions(partition_ids);
+
+        const auto & merge_tree_storage = dynamic_cast<const MergeTreeMetaBase &>(storage);
+        size_t restored_partitions = 0;
+        bool need_delta_sync = false;
+        for (auto & snapshot : partition_snapshots)
+        {
+            auto found_partition = meta_partitions.find(snapshot.partition_id);
+            if (found_partition == meta_partitions.end())
+                continue;
+            /// A partition without a version record cannot be proven fresh; and a catalog version
+            /// below the snapshot one means the version records were rebuilt. Reload those lazily.
+            auto found_version = current_versions.find(snapshot.partition_id);
+            if (found_version == current_versions.end() || found_version->second < snapshot.synced_version)
+                continue;
+
+            /// Parse jobs outside lock.
+            DataModelPartWrapperVector parts_wrapper_vector;
+            parts_wrapper_vector.reserve(snapshot.part_models.size());
+            PartModelSlabPtr slab = use_part_model_slab ? std::make_shared<PartModelSlab>() : nullptr;
+            bool parse_ok = true;
+            for (auto & serialized : snapshot.part_models)
+            {
+                Protos::DataModelPart part_model;
+                if (!part_model.ParseFromString(serialized))
+                {
+                    parse_ok = false;
+                    break;
+                }
+                parts_wrapper_vector.push_back(createPartWrapperFromModel(merge_tree_storage, part_model, slab));
+            }
+            if (!parse_ok)
+                continue;
+
+            auto & partition_info_ptr = found_partition->second;
+            auto partition_write_lock = partition_info_ptr->writeLock();
+            /// Someone may have loaded the partition from metastore concurrently.
+            if (partition_info_ptr->cache_status != CacheStatus::UINIT)
+                continue;
+            auto cached = std::make_shared<DataPartModelsMap>();
+            cached->insert(parts_wrapper_vector, [](const DataModelPartWrapperPtr & part_wrapper_ptr) { return part_wrapper_ptr->name; });
+            part_cache_ptr->insert({uuid, snapshot.partition_id}, cached);
+            partition_info_ptr->last_sync_version = snapshot.synced_version;
+            partition_info_ptr->cache_status = CacheStatus::LOADED;
+            restored_partitions++;
+            if (found_version->second > snapshot.synced_version)
+                need_delta_sync = true;
+        }
+
+        /// Replay the parts committed after the snapshot was taken through the regular delta path.
+        if (need_delta_sync)
+            tryDeltaSyncTableParts(uuid, table_entry);
+
+        if (restored_partitions)
+            LOG_DEBUG(
+                &Poco::Logger::get("PartCacheManager"),
+                "Restored {} of {} partitions for table {} from local snapshot",
+                restored_partitions, partition_snapshots.size(), UUIDHelpers::UUIDToString(uuid));
+    }
+    catch (...)
+    {
+        tryLogDebugCurrentException(__PRETTY_FUNCTION__);
+    }
+}
+
 inline static bool isVisible(const DB::DataModelPartWrapperPtr & part_wrapper_ptr, const UInt64 & ts)
 {
     return ts == 0
@@ -777,7 +1244,7 @@ DB::ServerDataPartsVector PartCacheManager::getOrSetServerDataPartsInPartitions(
         DataModelPartPtrVector fetched = load_func(partitions,  meta_ptr->getPartitionIDs());
         for (auto & part_model_ptr : fetched)
         {
-            auto part_wrapper_ptr = createPartWrapperFromModel(storage, *part_model_ptr);
+            auto part_wrapper_ptr = createPartWrapperFromModelPtr(storage, part_model_ptr);
             if (isVisible(part_wrapper_ptr, ts))
                 res.push_back(std::make_shared<ServerDataPart>(part_wrapper_ptr));
         }
@@ -859,6 +1326,7 @@ DB::ServerDataPartsVector PartCacheManager::getServerPartsInternal(
     {
         /// Save data part model as well as data part to avoid build them with metaentry lock.
         std::unordered_map<String, DataModelPartWrapperVector> partition_to_parts;
+        std::unordered_map<String, PartModelSlabPtr> partition_to_slab;
         DataModelPartPtrVector fetched = load_func(partitions_not_cached, all_existing_partitions);
 
         /// The load_func may include partitions that not in the required `partitions_not_cache`
@@ -867,7 +1335,18 @@ DB::ServerDataPartsVector PartCacheManager::getServerPartsInternal(
 
         for (auto & part_model_ptr : fetched)
         {
-            auto part_wrapper_ptr = createPartWrapperFromModel(storage, *part_model_ptr);
+            PartModelSlabPtr slab;
+            if (use_part_model_slab && partitions_set.contains(part_model_ptr->part_info().partition_id()))
+            {
+                auto & slab_ref = partition_to_slab[part_model_ptr->part_info().partition_id()];
+                if (!slab_ref)
+                    slab_ref = std::make_shared<PartModelSlab>();
+                slab = slab_ref;
+            }
+            /// Without a slab, hand the fetched model through to the wrapper instead of copying;
+            /// zero-copy fetched models stay in their parse-time arena all the way to the cache.
+            auto part_wrapper_ptr
+                = slab ? createPartWrapperFromModel(storage, *part_model_ptr, slab) : createPartWrapperFromModelPtr(storage, part_model_ptr);
             const auto & partition_id = part_wrapper_ptr->info->partition_id;
             if (!partitions_set.contains(partition_id))
                 continue;
@@ -933,6 +1412,7 @@ DB::ServerDataPartsVector PartCacheManager::getServerPartsInternal(
                     part_cache_ptr->set({uuid, partition_id}, cached);
                 }
 
+                advanceLastSyncVersion(partition_info_ptr, *parts_wrapper_vector);
                 partition_info_ptr->cache_status = CacheStatus::LOADED;
             }
 
@@ -1025,9 +1505,14 @@ ServerDataPartsVector PartCacheManager::getServerPartsByPartition(const MergeTre
                 std::unordered_map<String, DataModelPartWrapperVector> partition_to_parts;
                 fetched = load_func({partition_id}, {partition_id});
                 DataModelPartWrapperVector fetched_data;
+                PartModelSlabPtr slab;
+                if (use_part_model_slab && !fetched.empty())
+                    slab = std::make_shared<PartModelSlab>();
                 for (auto & dataModelPartPtr : fetched)
                 {
-                    fetched_data.push_back(createPartWrapperFromModel(storage, *dataModelPartPtr));
+                    fetched_data.push_back(
+                        slab ? createPartWrapperFromModel(storage, *dataModelPartPtr, slab)
+                             : createPartWrapperFromModelPtr(storage, dataModelPartPtr));
                 }
 
                 /// It happens that new parts have been inserted into cache during loading parts from bytekv, we need merge them to make 
@@ -1059,6 +1544,7 @@ ServerDataPartsVector PartCacheManager::getServerPartsByPartition(const MergeTre
                     part_cache_ptr->set({uuid, partition_id}, cached);
                 }
 
+                advanceLastSyncVersion(partition_info_ptr, fetched_data);
                 partition_info_ptr->cache_status = CacheStatus::LOADED;
 
                 /// Release partition lock before construct ServerDataPart
@@ -1185,6 +1671,8 @@ void PartCacheManager::shutDown()
     metrics_initializer->deactivate();
     active_table_loader->deactivate();
     meta_lock_cleaner->deactivate();
+    snapshot_dumper->deactivate();
+    cache_auditor->deactivate();
 }
 
 }
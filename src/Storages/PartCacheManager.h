@@ -104,6 +104,10 @@ public:
 
     UInt64 getTableLastUpdateTime(const UUID & uuid);
 
+    /// Highest part commit version merged into the host server's part cache for the partition.
+    /// Returns 0 if this server is not the table's host server or the partition is unknown.
+    UInt64 getPartitionLastSyncVersion(const UUID & uuid, const String & partition_id);
+
     bool getTableClusterStatus(const UUID & uuid);
 
     void setTableClusterStatus(const UUID & uuid, bool clustered);
@@ -131,6 +135,16 @@ public:
     /// Get count and weight in Part cache
     std::pair<UInt64, UInt64> dumpPartCache();
 
+    /// Result of the last part cache coherence audit, published via AsynchronousMetrics.
+    struct CacheAuditResult
+    {
+        UInt64 checked_partitions = 0;
+        UInt64 stale_partitions = 0;
+        UInt64 max_staleness_seconds = 0;
+    };
+
+    CacheAuditResult getCacheAuditResult() const;
+
     std::unordered_map<String, std::pair<size_t, size_t>> getTableCacheInfo();
 
     using LoadPartsFunc = std::function<DataModelPartPtrVector(const Strings&, const Strings&)>;
@@ -151,6 +165,24 @@ public:
 private:
     mutable std::mutex cache_mutex;
     CnchDataPartCachePtr part_cache_ptr;
+    /// If enabled, part models destined for the cache are packed into one slab per partition
+    /// (see PartModelSlab) instead of being allocated one by one.
+    bool use_part_model_slab{false};
+    /// If enabled, a stale part cache is repaired by fetching only the parts committed since the
+    /// per-partition synced version from the Catalog instead of dropping the whole table cache.
+    bool use_delta_sync{false};
+    /// Directory for local part-list snapshot files; empty means snapshotting is disabled.
+    String snapshot_dir;
+    /// Interval of the background cache coherence audit; 0 disables the auditor.
+    UInt64 audit_interval_seconds{0};
+    /// At most this many loaded partitions are re-checked against the Catalog per audit run.
+    size_t audit_sample_partitions{0};
+    /// A partition lagging less than this is not reported: commits propagate to the host
+    /// server's cache asynchronously, so a short lag is normal and not a coherence bug.
+    UInt64 audit_staleness_grace_seconds{0};
+    std::atomic<UInt64> audit_checked_partitions{0};
+    std::atomic<UInt64> audit_stale_partitions{0};
+    std::atomic<UInt64> audit_max_staleness_seconds{0};
     std::unordered_map<UUID, TableMetaEntryPtr> active_tables;
 
     /// A cache for the NHUT which has been written to bytekv. Do not need to update NHUT each time when non-host server commit parts
@@ -167,8 +199,26 @@ private:
     BackgroundSchedulePool::TaskHolder metrics_initializer;  // Used to collect metrics if it is not ready.
     BackgroundSchedulePool::TaskHolder active_table_loader; // Used to load table when server start up, only execute once;
     BackgroundSchedulePool::TaskHolder meta_lock_cleaner; // remove unused meta lock periodically;
+    BackgroundSchedulePool::TaskHolder snapshot_dumper; // checkpoint loaded part lists to local disk periodically;
+    BackgroundSchedulePool::TaskHolder cache_auditor; // re-check sampled cached partitions against the Catalog;
 
     void updateTablePartitionsMetrics(bool skip_if_already_loaded);
+
+    /// Bring the cached partitions of one table up to date by fetching only the parts committed
+    /// since each partition's last synced version. Returns false if delta sync is not possible
+    /// (e.g. no version records yet) and the caller should fall back to full invalidation.
+    bool tryDeltaSyncTableParts(const UUID & uuid, const TableMetaEntryPtr & table_entry);
+
+    /// Local part-list snapshots for fast takeover. Loaded partitions of active tables are
+    /// periodically checkpointed to disk; on takeover a snapshot whose per-partition versions
+    /// still match the Catalog is restored directly into the cache and only the delta since the
+    /// snapshot is replayed, instead of rebuilding the whole table state from the metastore.
+    void dumpPartCacheSnapshots();
+    /// Sample loaded partitions and compare their synced versions against the authoritative
+    /// versions in the Catalog, so cache staleness shows up in metrics instead of query results.
+    void auditPartCache();
+    void tryLoadTableFromSnapshot(const IStorage & storage, const UUID & uuid, const TableMetaEntryPtr & table_entry);
+    String getSnapshotFilePath(const UUID & uuid) const;
     void reloadPartitionMetrics(const UUID & uuid, const TableMetaEntryPtr & table_meta);
     void cleanMetaLock();
     // load tables belongs to current server according to the topology. The task is performed asynchronously.
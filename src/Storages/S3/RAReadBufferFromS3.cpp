@@ -32,6 +32,8 @@ namespace ProfileEvents
     extern const Event ReadBufferFromS3ReadFailed;
     extern const Event ReadBufferFromS3ReadBytes;
     extern const Event ReadBufferFromS3ReadMicro;
+    extern const Event ReadBufferFromS3CoalescedSeeks;
+    extern const Event ReadBufferFromS3CoalescedGapBytes;
 }
 
 namespace DB
@@ -45,9 +47,10 @@ namespace ErrorCodes
 
 S3ReadAheadReader::S3ReadAheadReader(const std::shared_ptr<Aws::S3::S3Client>& client_,
     const String& bucket_, const String& key_, Poco::Logger* logger_,
-    int max_buffer_expand_times_):
+    int max_buffer_expand_times_, size_t merge_gap_threshold_):
         client(client_), obj_bucket(bucket_), obj_key(key_), buffer_size(0),
         max_buffer_expand_times(max_buffer_expand_times_), buffer_expand_times(0),
+        merge_gap_threshold(merge_gap_threshold_),
         current_offset(0), reader_end_offset(0), reader(std::make_unique<Aws::S3::Model::GetObjectResult>()),
         logger(logger_)
 {}
@@ -180,6 +183,21 @@ size_t S3ReadAheadReader::seek(size_t offset)
             current_offset = offset;
             return offset;
         }
+        else if (offset - reader_end_offset <= merge_gap_threshold)
+        {
+            // The next range is adjacent to the previous one up to a small gap:
+            // keep the grown read ahead window, so the next get stays large and
+            // covers what would otherwise be several small requests
+            ProfileEvents::increment(ProfileEvents::ReadBufferFromS3CoalescedSeeks, 1);
+            ProfileEvents::increment(ProfileEvents::ReadBufferFromS3CoalescedGapBytes, offset - reader_end_offset);
+
+            LOG_TRACE(logger, "Seek gap of {} bytes within merge threshold, keep read ahead window of {}",
+                offset - reader_end_offset, buffer_size);
+
+            current_offset = offset;
+            reader_end_offset = offset;
+            return offset;
+        }
     }
 
     // Cache miss, reset read ahead state
@@ -195,10 +213,11 @@ size_t S3ReadAheadReader::seek(size_t offset)
 
 RAReadBufferFromS3::RAReadBufferFromS3(const std::shared_ptr<Aws::S3::S3Client>& client_,
     const String& bucket_, const String& key_, size_t read_retry_,
-    size_t buffer_size_, char* existing_memory_, size_t alignment_, const ThrottlerPtr& throttler_):
+    size_t buffer_size_, char* existing_memory_, size_t alignment_, const ThrottlerPtr& throttler_,
+    size_t merge_gap_threshold_):
         ReadBufferFromFileBase(buffer_size_, existing_memory_, alignment_),
         read_retry(read_retry_), throttler(throttler_), log(&Poco::Logger::get("RAReadBufferFromS3")),
-        reader(client_, bucket_, key_, log) {}
+        reader(client_, bucket_, key_, log, 8, merge_gap_threshold_) {}
 
 bool RAReadBufferFromS3::nextImpl()
 {
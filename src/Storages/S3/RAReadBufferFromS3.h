@@ -39,7 +39,7 @@ class S3ReadAheadReader
 public:
     S3ReadAheadReader(const std::shared_ptr<Aws::S3::S3Client>& client_,
         const String& bucket_, const String& key_, Poco::Logger* logger_,
-        int max_buffer_expand_times_ = 8);
+        int max_buffer_expand_times_ = 8, size_t merge_gap_threshold_ = 0);
 
     bool read(BufferBase::Buffer& buffer_, size_t size_);
     size_t seek(size_t offset_);
@@ -62,6 +62,11 @@ private:
     int max_buffer_expand_times;
     int buffer_expand_times;
 
+    // Forward seeks whose gap to the previous range is within this threshold
+    // keep the grown read ahead window instead of resetting it, merging
+    // adjacent ranges into fewer large gets. 0 disables merging
+    size_t merge_gap_threshold;
+
     // Offset of first byte in reader
     size_t current_offset;
 
@@ -78,7 +83,8 @@ public:
     RAReadBufferFromS3(const std::shared_ptr<Aws::S3::S3Client>& client_,
         const String& bucket_, const String& key_, size_t read_retry_ = 3,
         size_t buffer_size_ = DBMS_DEFAULT_BUFFER_SIZE, char* existing_memory_ = nullptr,
-        size_t alignment_ = 0, const ThrottlerPtr& throttler_ = nullptr);
+        size_t alignment_ = 0, const ThrottlerPtr& throttler_ = nullptr,
+        size_t merge_gap_threshold_ = 0);
 
     virtual bool nextImpl() override;
 
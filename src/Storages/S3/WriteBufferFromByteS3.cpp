@@ -71,7 +71,8 @@ WriteBufferFromByteS3::WriteBufferFromByteS3(
     size_t buf_size_,
     char* mem_,
     size_t alignment_,
-    bool allow_overwrite_)
+    bool allow_overwrite_,
+    UInt64 max_parallel_uploads_)
     : WriteBufferFromFileBase(buf_size_, mem_, alignment_)
     , key(key_)
     , object_metadata(object_metadata_)
@@ -81,6 +82,7 @@ WriteBufferFromByteS3::WriteBufferFromByteS3(
     , temporary_buffer(nullptr)
     , last_part_size(0)
     , total_write_size(0)
+    , max_parallel_uploads(std::max<UInt64>(max_parallel_uploads_, 1))
     , log(&Poco::Logger::get("WriteBufferFromS3"))
 {
     if (!allow_overwrite_ && s3_util.exists(key_))
@@ -88,6 +90,11 @@ WriteBufferFromByteS3::WriteBufferFromByteS3(
         throw Exception(fmt::format("Object {} already exists, abort", key_),
             ErrorCodes::S3_OBJECT_ALREADY_EXISTS);
     }
+    if (max_parallel_uploads > 1)
+    {
+        upload_pool = std::make_unique<ThreadPool>(max_parallel_uploads, max_parallel_uploads,
+            max_parallel_uploads);
+    }
     allocateBuffer();
 }
 
@@ -237,6 +244,45 @@ void WriteBufferFromByteS3::writePart()
         LOG_WARNING(log, "Maximum part number in S3 protocol has reached (too many parts). Server may not accept this whole upload.");
     }
 
+    if (upload_pool)
+    {
+        // Fail early if a previous part upload already failed
+        {
+            std::lock_guard lock(upload_mutex);
+            if (upload_exception)
+                std::rethrow_exception(upload_exception);
+            part_tags.emplace_back();
+        }
+        size_t part_number = part_tags.size();
+
+        // Hand the filled buffer to an upload stream and keep writing into a fresh one;
+        // scheduling blocks once max_parallel_uploads parts are in flight
+        auto buffer = std::move(temporary_buffer);
+        allocateBuffer();
+
+        upload_pool->scheduleOrThrowOnError([this, buffer, size, part_number]
+        {
+            RECORD_S3_OP_TIME(log, ProfileEvents::WriteBufferFromS3WriteOpMicro,
+                "Write part " + std::to_string(part_number) + " for " + multipart_upload_id + " with size " + std::to_string(size));
+            ProfileEvents::increment(ProfileEvents::WriteBufferFromS3WriteOp, 1);
+            ProfileEvents::increment(ProfileEvents::WriteBufferFromS3WriteOpBytes, size);
+            try
+            {
+                String tag = s3_util.uploadPart(key, multipart_upload_id, part_number, size, buffer);
+                std::lock_guard lock(upload_mutex);
+                part_tags[part_number - 1] = tag;
+            }
+            catch (...)
+            {
+                ProfileEvents::increment(ProfileEvents::WriteBufferFromS3WriteOpFailed, 1);
+                std::lock_guard lock(upload_mutex);
+                if (!upload_exception)
+                    upload_exception = std::current_exception();
+            }
+        });
+        return;
+    }
+
     String tag;
     RECORD_S3_OP_TIME(log, ProfileEvents::WriteBufferFromS3WriteOpMicro,
         "Write part for " + multipart_upload_id + " with size " + std::to_string(size) + ", tag: " + tag);
@@ -255,8 +301,24 @@ void WriteBufferFromByteS3::writePart()
     }
 }
 
+void WriteBufferFromByteS3::waitUploads()
+{
+    if (!upload_pool)
+        return;
+
+    upload_pool->wait();
+
+    std::lock_guard lock(upload_mutex);
+    if (upload_exception)
+        std::rethrow_exception(std::exchange(upload_exception, nullptr));
+}
+
 void WriteBufferFromByteS3::completeMultipartUpload()
 {
+    /// Part tags are indexed by part number, so waiting for in flight uploads
+    /// is enough to get them in order
+    waitUploads();
+
     if (part_tags.empty() || multipart_upload_id.empty())
     {
         throw Exception("Failed to complete multipart upload. No parts have uploaded",
@@ -284,6 +346,11 @@ void WriteBufferFromByteS3::abortMultipartUpload()
         throw Exception("Trying to abort multi part upload but no multi part has been created",
             ErrorCodes::LOGICAL_ERROR);
     }
+
+    // Let in flight part uploads drain before invalidating the upload id,
+    // failures of those parts don't matter anymore
+    if (upload_pool)
+        upload_pool->wait();
     RECORD_S3_OP_TIME(log, ProfileEvents::WriteBufferFromS3ControlOpMicro,
         "Abort multi part upload " + multipart_upload_id);
     ProfileEvents::increment(ProfileEvents::WriteBufferFromS3ControlOp, 1);
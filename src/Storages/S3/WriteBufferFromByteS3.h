@@ -16,9 +16,11 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <common/logger_useful.h>
 
+#include <Common/ThreadPool.h>
 #include <IO/BufferWithOwnMemory.h>
 #include <IO/WriteBuffer.h>
 #include <IO/WriteBufferFromFileBase.h>
@@ -61,6 +63,14 @@ private:
     String multipart_upload_id;
     std::vector<String> part_tags;
 
+    /// When max_parallel_uploads > 1 completed parts are pushed by a pool of
+    /// upload streams while the writer keeps filling the next part; the bounded
+    /// pool queue provides backpressure on the writer
+    UInt64 max_parallel_uploads;
+    std::unique_ptr<ThreadPool> upload_pool;
+    std::mutex upload_mutex;
+    std::exception_ptr upload_exception;
+
     Poco::Logger * log;
 
 public:
@@ -75,7 +85,8 @@ public:
         size_t buf_size_ = DBMS_DEFAULT_BUFFER_SIZE,
         char* mem_ = nullptr,
         size_t alignment_ = 0,
-        bool allow_overwrite_ = false);
+        bool allow_overwrite_ = false,
+        UInt64 max_parallel_uploads_ = 1);
 
     ~WriteBufferFromByteS3() override;
 
@@ -105,6 +116,7 @@ private:
 
     void createMultipartUpload();
     void writePart();
+    void waitUploads();
     void completeMultipartUpload();
     void abortMultipartUpload();
 
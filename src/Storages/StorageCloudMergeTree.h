@@ -46,6 +46,8 @@ public:
     bool supportsPrewhere() const override { return true; }
     bool supportsIndexForIn() const override { return true; }
     bool supportsMapImplicitColumn() const override { return true; }
+    /// Unique tables need the single-stream dedup/lock path in the write suffix.
+    bool supportsParallelInsert() const override { return !getInMemoryMetadataPtr()->hasUniqueKey(); }
 
     StoragePolicyPtr getStoragePolicy(StorageLocation location) const override;
     const String& getRelativeDataPath(StorageLocation location) const override;
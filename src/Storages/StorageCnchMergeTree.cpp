@@ -29,6 +29,7 @@
 #include <DataTypes/DataTypeTuple.h>
 #include <Databases/DatabaseOnDisk.h>
 #include <IO/ConnectionTimeoutsContext.h>
+#include <IO/ReadBufferFromString.h>
 #include <Interpreters/ClusterProxy/SelectStreamFactory.h>
 #include <Interpreters/ClusterProxy/executeQuery.h>
 #include <Interpreters/Context.h>
@@ -37,6 +38,7 @@
 #include <Interpreters/TranslateQualifiedNamesVisitor.h>
 #include <Interpreters/VirtualWarehousePool.h>
 #include <Interpreters/evaluateConstantExpression.h>
+#include <Interpreters/executeQuery.h>
 #include <Interpreters/inplaceBlockConversions.h>
 #include <Interpreters/trySetVirtualWarehouse.h>
 #include <MergeTreeCommon/CnchBucketTableCommon.h>
@@ -46,8 +48,10 @@
 #include <Parsers/ASTSetQuery.h>
 #include <Parsers/queryToString.h>
 #include <Storages/AlterCommands.h>
+#include <Storages/CnchInsertBuffer.h>
 #include <Storages/MergeTree/CloudMergeTreeBlockOutputStream.h>
 #include <Storages/MergeTree/CnchAttachProcessor.h>
+#include <Storages/MergeTree/IMergeTreeDataPart.h>
 #include <Storages/MergeTree/PartitionPruner.h>
 #include <Storages/PartitionCommands.h>
 #include <Storages/StorageMaterializedView.h>
@@ -66,6 +70,7 @@
 #include <Parsers/ASTPartition.h>
 #include <Parsers/ASTSelectQuery.h>
 #include <Parsers/ASTTablesInSelectQuery.h>
+#include <Processors/Executors/PullingAsyncPipelineExecutor.h>
 #include <Processors/Sources/NullSource.h>
 #include <QueryPlan/BuildQueryPipelineSettings.h>
 #include <QueryPlan/Optimizations/QueryPlanOptimizationSettings.h>
@@ -285,6 +290,23 @@ PrepareContextResult StorageCnchMergeTree::prepareReadContext(
         // only partial part is useful in getDeleteBitmapMetaForParts for unique table.
         getDeleteBitmapMetaForParts(parts, local_context, local_context->getCurrentTransactionID());
     }
+    else if (!parts.empty() && getSettings()->enable_delete_bitmap_for_normal_table)
+    {
+        /// Lightweight deletes may have left bitmaps on some of the parts; fetch them
+        /// tolerantly since parts without deleted rows have no bitmap at all.
+        getDeleteBitmapMetaForParts(parts, local_context, local_context->getCurrentTransactionID(), /*force_found*/ false);
+    }
+
+    /// Staged-inclusive read: also serve parts that the dedup worker has not published
+    /// yet. They carry no delete bitmaps, so such reads may return duplicates.
+    if (metadata_snapshot->hasUniqueKey() && local_context->getSettingsRef().enable_staging_area_for_read)
+    {
+        auto staged_parts = local_context->getCnchCatalog()->getStagedServerDataParts(
+            shared_from_this(), local_context->getCurrentTransactionID(), nullptr);
+        auto visible_staged_parts = CnchPartsHelper::calcVisibleParts(staged_parts, /*flatten*/ false);
+        LOG_INFO(log, "Number of staged parts to read: {}", visible_staged_parts.size());
+        std::move(visible_staged_parts.begin(), visible_staged_parts.end(), std::back_inserter(parts));
+    }
 
     String local_table_name = getCloudTableName(local_context);
     auto bucket_numbers = getRequiredBucketNumbers(query_info, local_context);
@@ -304,10 +326,12 @@ Strings StorageCnchMergeTree::selectPartitionsByPredicate(
     /// Note that this step still leaves false-positive parts. For example, the partition key is `toMonth(date)` and the query
     /// condition is `date > '2022-02-22' and date < '2022-03-22'` then this step won't eliminate any partition.
 
-    /// The partition pruning rules come from 3 types:
+    /// The partition pruning rules come from 4 types:
     /// (1) TTL
     /// (2) Columns in predicate that exactly match the partition key
     /// (3) `_partition_id` or `_partition_value` if they're in predicate
+    /// (4) Aggregated per-partition minmax index maintained in the catalog, which covers the raw
+    ///     partition key source columns, e.g. `date` under a `toMonth(date)` partition key
 
     /// (1) Prune partition by partition level TTL
     TTLTableDescription table_ttl = getInMemoryMetadata().getTableTTLs();
@@ -391,6 +415,37 @@ Strings StorageCnchMergeTree::selectPartitionsByPredicate(
                         prev_sz - partition_list.size());
             }
         }
+
+        /// (4) Prune partitions by the aggregated minmax index stored in the catalog's partition metas.
+        /// Unlike rule (2) it works on the raw partition key source columns, so `date > '2022-02-22'`
+        /// can drop whole partitions even under a `toMonth(date)` partition key.
+        auto minmax_column_names = getMinMaxColumnsNames(partition_key);
+        if (local_context->getSettingsRef().enable_partition_minmax_prune && !partition_list.empty() && !minmax_column_names.empty())
+        {
+            KeyCondition minmax_condition(
+                query_info, local_context, minmax_column_names, getMinMaxExpr(partition_key, ExpressionActionsSettings::fromContext(local_context)));
+            if (!minmax_condition.alwaysUnknownOrTrue())
+            {
+                auto minmax_map = local_context->getCnchCatalog()->getPartitionMinMax(shared_from_this());
+                if (!minmax_map.empty())
+                {
+                    auto minmax_column_types = getMinMaxColumnsTypes(partition_key);
+                    prev_sz = partition_list.size();
+                    std::erase_if(partition_list, [&](const auto & partition) {
+                        auto it = minmax_map.find(partition->getID(*this));
+                        /// Partitions without a maintained aggregate cannot be pruned
+                        if (it == minmax_map.end())
+                            return false;
+                        IMergeTreeDataPart::MinMaxIndex minmax_idx;
+                        ReadBufferFromString buf(it->second);
+                        minmax_idx.load(*this, buf);
+                        return !minmax_condition.checkInHyperrectangle(minmax_idx.hyperrectangle, minmax_column_types).can_be_true;
+                    });
+                    if (partition_list.size() < prev_sz)
+                        LOG_DEBUG(log, "Aggregated minmax index in catalog droped {} partitions", prev_sz - partition_list.size());
+                }
+            }
+        }
     }
     Strings res_partitions;
     for (const auto & partition : partition_list)
@@ -705,6 +760,21 @@ StorageCnchMergeTree::write(const ASTPtr & query, const StorageMetadataPtr & met
     if (insert_query.table_id.database_name.empty())
         insert_query.table_id.database_name = local_context->getCurrentDatabase();
 
+    /// High-frequency small inserts may opt into the shared per-table buffer: the
+    /// blocks are accumulated in memory and flushed through the normal part-dump
+    /// path in the background under a single transaction. Unique tables keep the
+    /// synchronous path, their commit carries the dedup semantics.
+    if (local_context->getSettingsRef().enable_insert_buffering && !metadata_snapshot->hasUniqueKey()
+        && local_context->getServerType() == ServerType::cnch_server)
+    {
+        const auto & merge_tree_settings = *getSettings();
+        CnchInsertBuffer::FlushThresholds thresholds{
+            .flush_interval_ms = merge_tree_settings.insert_buffer_flush_interval_milliseconds,
+            .max_bytes = merge_tree_settings.insert_buffer_max_bytes,
+            .max_rows = merge_tree_settings.insert_buffer_max_rows};
+        return std::make_shared<CnchInsertBufferBlockOutputStream>(getStorageID(), metadata_snapshot, thresholds, local_context);
+    }
+
     return std::make_shared<CloudMergeTreeBlockOutputStream>(*this, metadata_snapshot, local_context, enable_staging_area);
 }
 
@@ -1168,7 +1238,7 @@ void StorageCnchMergeTree::getDeleteBitmapMetaForStagedParts(
 }
 
 void StorageCnchMergeTree::getDeleteBitmapMetaForParts(
-    const ServerDataPartsVector & parts, ContextPtr local_context, TxnTimestamp start_time) const
+    const ServerDataPartsVector & parts, ContextPtr local_context, TxnTimestamp start_time, bool force_found) const
 {
     auto catalog = local_context->getCnchCatalog();
     if (!catalog)
@@ -1200,12 +1270,24 @@ void StorageCnchMergeTree::getDeleteBitmapMetaForParts(
     auto bitmap_it = bitmaps.begin();
     for (auto & part : parts)
     {
-        /// search for the first bitmap
-        while (bitmap_it != bitmaps.end() && !(*bitmap_it)->sameBlock(part->info()))
-            bitmap_it++;
+        if (!force_found)
+        {
+            /// Tolerant mode for tables where bitmaps are optional (lightweight deletes
+            /// on ordinary tables): parts without a matching bitmap are simply skipped.
+            while (bitmap_it != bitmaps.end() && (*(*bitmap_it)) <= part->info() && !(*bitmap_it)->sameBlock(part->info()))
+                bitmap_it++;
+            if (bitmap_it == bitmaps.end() || !(*bitmap_it)->sameBlock(part->info()))
+                continue;
+        }
+        else
+        {
+            /// search for the first bitmap
+            while (bitmap_it != bitmaps.end() && !(*bitmap_it)->sameBlock(part->info()))
+                bitmap_it++;
 
-        if (bitmap_it == bitmaps.end())
-            throw Exception("Delete bitmap metadata of " + part->name() + " is not found", ErrorCodes::LOGICAL_ERROR);
+            if (bitmap_it == bitmaps.end())
+                throw Exception("Delete bitmap metadata of " + part->name() + " is not found", ErrorCodes::LOGICAL_ERROR);
+        }
 
         /// add all visible bitmaps (from new to old) part
         bool found_base = false;
@@ -1266,6 +1348,112 @@ void StorageCnchMergeTree::executeDedupForRepair(const ASTPtr & partition, Conte
     txn->commitV2();
 }
 
+void StorageCnchMergeTree::executeLightweightDelete(const ASTPtr & predicate, ContextPtr local_context)
+{
+    if (getInMemoryMetadataPtr()->hasUniqueKey())
+        throw Exception("DELETE FROM unique table should go through the dedup path", ErrorCodes::LOGICAL_ERROR);
+
+    if (!getSettings()->enable_delete_bitmap_for_normal_table)
+        throw Exception(
+            "DELETE FROM a table without UNIQUE KEY requires table setting enable_delete_bitmap_for_normal_table = 1",
+            ErrorCodes::SUPPORT_IS_DISABLED);
+
+    auto txn = local_context->getCurrentTransaction();
+    if (!txn)
+        throw Exception("Transaction is not set", ErrorCodes::LOGICAL_ERROR);
+    txn->setMainTableUUID(getStorageUUID());
+
+    /// Deletes and merges synchronize on the table lock: a merge re-checks the bitmaps of its
+    /// source parts under the lock before committing, so marking rows here cannot race with a
+    /// merge dropping the parts that carry the marks.
+    LockInfoPtr table_lock = std::make_shared<LockInfo>(txn->getTransactionID());
+    table_lock->setMode(LockMode::X);
+    table_lock->setTimeout(local_context->getSettingsRef().lock_acquire_timeout.value.totalMilliseconds());
+    table_lock->setUUID(getStorageUUID());
+    auto cnch_lock = txn->createLockHolder({std::move(table_lock)});
+    cnch_lock->lock();
+
+    /// Collect the row numbers of the matching rows for every part. The subquery runs in its
+    /// own transaction created after the lock was taken, so its snapshot cannot contain parts
+    /// that a concurrent merge dropped before we acquired the lock.
+    std::unordered_map<String, DeleteBitmapPtr> deletes_by_part;
+    size_t total_rows_to_delete = 0;
+    {
+        auto select_context = Context::createCopy(local_context);
+        select_context->makeQueryContext();
+        select_context->setCurrentQueryId(""); /// generate random query_id
+        select_context->getClientInfo().query_kind = ClientInfo::QueryKind::SECONDARY_QUERY;
+        select_context->setCurrentTransaction(nullptr, /*finish_txn*/ false);
+
+        String select_query = "SELECT `_part`, `_part_row_number` FROM " + getStorageID().getFullTableName() + " WHERE "
+            + serializeAST(*predicate);
+
+        auto process_block = [&](const Block & block) {
+            if (!block || block.rows() == 0)
+                return;
+            const auto & part_column = *block.getByName("_part").column;
+            const auto & row_number_column = *block.getByName("_part_row_number").column;
+            for (size_t i = 0, rows = block.rows(); i < rows; ++i)
+            {
+                auto & bitmap = deletes_by_part[part_column.getDataAt(i).toString()];
+                if (!bitmap)
+                    bitmap = std::make_shared<Roaring>();
+                bitmap->add(static_cast<UInt32>(row_number_column.getUInt(i)));
+            }
+            total_rows_to_delete += block.rows();
+        };
+
+        BlockIO select_io = executeQuery(select_query, select_context, /*internal*/ true);
+        if (select_io.pipeline.initialized())
+        {
+            PullingAsyncPipelineExecutor executor(select_io.pipeline);
+            Block block;
+            while (executor.pull(block))
+                process_block(block);
+        }
+        else if (select_io.in)
+        {
+            while (Block block = select_io.in->read())
+                process_block(block);
+        }
+        select_io.onFinish();
+    }
+
+    if (!deletes_by_part.empty())
+    {
+        /// List the visible parts (with their current bitmaps, which ordinary parts may not
+        /// have) at a timestamp taken under the lock, and attach the new marks to them.
+        TxnTimestamp ts = local_context->getTimestamp();
+        MergeTreeDataPartsCNCHVector parts = getUniqueTableMeta(ts, /*input_partitions*/ {}, /*force_bitmap*/ false);
+
+        LocalDeleteBitmaps bitmaps_to_dump;
+        UInt64 txn_id = txn->getTransactionID().toUInt64();
+        for (const auto & part : parts)
+        {
+            auto it = deletes_by_part.find(part->name);
+            if (it == deletes_by_part.end())
+                continue;
+
+            if (auto base_bitmap = part->getDeleteBitmap(/*allow_null*/ true))
+                bitmaps_to_dump.push_back(LocalDeleteBitmap::createBaseOrDelta(part->info, base_bitmap, it->second, txn_id));
+            else
+                bitmaps_to_dump.push_back(LocalDeleteBitmap::createBase(part->info, it->second, txn_id));
+            deletes_by_part.erase(it);
+        }
+
+        /// Parts can only disappear from the snapshot through a merge commit, which the lock excludes.
+        if (!deletes_by_part.empty())
+            throw Exception(
+                "Part " + deletes_by_part.begin()->first + " disappeared while executing DELETE FROM", ErrorCodes::LOGICAL_ERROR);
+
+        CnchDataWriter cnch_writer(*this, local_context, ManipulationType::Insert);
+        cnch_writer.dumpAndCommitCnchParts(/*temp_parts*/ {}, bitmaps_to_dump);
+        LOG_INFO(log, "DELETE FROM marked {} rows as deleted in {} parts", total_rows_to_delete, bitmaps_to_dump.size());
+    }
+
+    txn->commitV2();
+}
+
 void StorageCnchMergeTree::waitForStagedPartsToPublish(ContextPtr local_context)
 {
     UInt64 wait_timeout_seconds = local_context->getSettingsRef().receive_timeout.value.totalSeconds();
@@ -2045,7 +2233,27 @@ void StorageCnchMergeTree::dropPartsImpl(
 
     if (svr_parts_to_drop.size() == 1)
     {
-        auto part = svr_parts_to_drop.front();
+        drop_ranges = createPartTombstones(svr_parts_to_drop, txn);
+    }
+    else
+    {
+        // drop_range parts should belong to the primary transaction
+        drop_ranges = createDropRangesFromParts(svr_parts_to_drop, txn);
+    }
+
+    auto bitmap_tombstones = createDeleteBitmapTombstones(drop_ranges, txn->getPrimaryTransactionID());
+
+    CnchDataWriter cnch_writer(*this, local_context, ManipulationType::Drop);
+    cnch_writer.dumpAndCommitCnchParts(drop_ranges, bitmap_tombstones);
+}
+
+StorageCnchMergeTree::MutableDataPartsVector
+StorageCnchMergeTree::createPartTombstones(const ServerDataPartsVector & parts_to_drop, const TransactionCnchPtr & txn)
+{
+    MutableDataPartsVector tombstones;
+    tombstones.reserve(parts_to_drop.size());
+    for (const auto & part : parts_to_drop)
+    {
         auto drop_part_info = part->info();
         drop_part_info.level += 1;
         drop_part_info.mutation = txn->getPrimaryTransactionID().toUInt64();
@@ -2069,18 +2277,10 @@ void StorageCnchMergeTree::dropPartsImpl(
             drop_part->secondary_txn_id = txn->getTransactionID();
         }
 
-        drop_ranges.emplace_back(std::move(drop_part));
+        tombstones.emplace_back(std::move(drop_part));
     }
-    else
-    {
-        // drop_range parts should belong to the primary transaction
-        drop_ranges = createDropRangesFromParts(svr_parts_to_drop, txn);
-    }
-
-    auto bitmap_tombstones = createDeleteBitmapTombstones(drop_ranges, txn->getPrimaryTransactionID());
 
-    CnchDataWriter cnch_writer(*this, local_context, ManipulationType::Drop);
-    cnch_writer.dumpAndCommitCnchParts(drop_ranges, bitmap_tombstones);
+    return tombstones;
 }
 
 StorageCnchMergeTree::MutableDataPartsVector
@@ -2457,6 +2657,8 @@ std::optional<UInt64> StorageCnchMergeTree::totalRows(const ContextPtr & query_c
     const auto & metadata_snapshot = getInMemoryMetadataPtr();
     if (metadata_snapshot->hasUniqueKey())
         getDeleteBitmapMetaForParts(parts, query_context, query_context->getCurrentTransactionID());
+    else if (getSettings()->enable_delete_bitmap_for_normal_table)
+        getDeleteBitmapMetaForParts(parts, query_context, query_context->getCurrentTransactionID(), /*force_found*/ false);
     size_t rows = 0;
     for (const auto & part : parts)
     {
@@ -2482,6 +2684,8 @@ StorageCnchMergeTree::totalRowsByPartitionPredicate(const SelectQueryInfo & quer
     const auto & metadata_snapshot = getInMemoryMetadataPtr();
     if (metadata_snapshot->hasUniqueKey())
         getDeleteBitmapMetaForParts(parts, local_context, local_context->getCurrentTransactionID());
+    else if (getSettings()->enable_delete_bitmap_for_normal_table)
+        getDeleteBitmapMetaForParts(parts, local_context, local_context->getCurrentTransactionID(), /*force_found*/ false);
 
     bool partition_column_valid = std::any_of(column_names_to_return.begin(), column_names_to_return.end(), [](const auto & name) {
         return name == "_partition_id" || name == "_partition_value";
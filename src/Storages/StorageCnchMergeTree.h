@@ -42,9 +42,15 @@ public:
     bool supportsIndexForIn() const override { return true; }
     bool supportsMapImplicitColumn() const override { return true; }
     bool supportsTrivialCount() const override { return true; }
+    /// Unique tables need the single-stream dedup/lock path in the write suffix.
+    bool supportsParallelInsert() const override { return !getInMemoryMetadataPtr()->hasUniqueKey(); }
     
-    /// Whether support DELETE FROM. We only support for Unique MergeTree for now.
-    bool supportsLightweightDelete() const override { return getInMemoryMetadataPtr()->hasUniqueKey(); }
+    /// Whether support DELETE FROM. Supported for Unique MergeTree, and for ordinary
+    /// tables that opted into delete bitmaps via enable_delete_bitmap_for_normal_table.
+    bool supportsLightweightDelete() const override
+    {
+        return getInMemoryMetadataPtr()->hasUniqueKey() || getSettings()->enable_delete_bitmap_for_normal_table;
+    }
 
     std::optional<UInt64> totalRows(const ContextPtr &) const override;
     std::optional<UInt64> totalRowsByPartitionPredicate(const SelectQueryInfo &, ContextPtr) const override;
@@ -117,12 +123,17 @@ public:
     void getDeleteBitmapMetaForParts(const MergeTreeDataPartsCNCHVector & parts, ContextPtr context, TxnTimestamp start_time, bool force_found = true);
     /// For staged parts, delete bitmap represents delete_flag info which is optional, it's valid if it doesn't have delete_bitmap metadata.
     void getDeleteBitmapMetaForStagedParts(const MergeTreeDataPartsCNCHVector & parts, ContextPtr context, TxnTimestamp start_time);
-    void getDeleteBitmapMetaForParts(const ServerDataPartsVector & parts, ContextPtr context, TxnTimestamp start_time) const;
+    void getDeleteBitmapMetaForParts(const ServerDataPartsVector & parts, ContextPtr context, TxnTimestamp start_time, bool force_found = true) const;
     void getDeleteBitmapMetaForParts(IMergeTreeDataPartsVector & parts, ContextPtr context, TxnTimestamp start_time, bool force_found = true);
 
     /// Used by the "SYSTEM DEDUP" command to repair unique table by removing duplicate keys in visible parts.
     void executeDedupForRepair(const ASTPtr & partition, ContextPtr context);
 
+    /// Used by "DELETE FROM" on tables without UNIQUE KEY (requires table setting
+    /// enable_delete_bitmap_for_normal_table): marks the matching rows in delete bitmaps
+    /// instead of rewriting the parts. Deleted rows are dropped physically on merge.
+    void executeLightweightDelete(const ASTPtr & predicate, ContextPtr context);
+
     /// Used by the "SYSTEM SYNC DEDUP WORKER" command to wait for all staged parts to publish
     void waitForStagedPartsToPublish(ContextPtr context);
 
@@ -174,6 +185,8 @@ public:
     using PartitionDropInfos = std::unordered_map<String, PartitionDropInfo>;
     MutableDataPartsVector createDropRangesFromPartitions(const PartitionDropInfos & partition_infos, const TransactionCnchPtr & txn);
     MutableDataPartsVector createDropRangesFromParts(const ServerDataPartsVector & parts_to_drop, const TransactionCnchPtr & txn);
+    /// Create per-part DROP tombstones. Unlike drop ranges, they cover only the given parts.
+    MutableDataPartsVector createPartTombstones(const ServerDataPartsVector & parts_to_drop, const TransactionCnchPtr & txn);
     LocalDeleteBitmaps createDeleteBitmapTombstones(const IMutableMergeTreeDataPartsVector & drop_range_parts, UInt64 txnID);
 
     StorageCnchMergeTree * checkStructureAndGetCnchMergeTree(const StoragePtr & source_table) const;
@@ -623,6 +623,10 @@ void StorageMaterializedView::refresh(const ASTPtr & partition,  ContextPtr loca
                 refreshing_partition_id = "";
             }
         }
+        else if (local_context->getSettingsRef().incremental_refresh_materialized_view)
+        {
+            refreshIncremental(local_context, async);
+        }
         else
         {
             MergeTreeData::DataPartsVector parts;
@@ -750,6 +754,16 @@ void StorageMaterializedView::refreshImpl(const ASTPtr & partition, ContextPtr l
             out->writeSuffix();
         }
 
+        /// Remember the highest block number folded into the target so a later
+        /// incremental refresh only has to aggregate parts above it.
+        Int64 max_block = 0;
+        for (auto & part : parts)
+            max_block = std::max(max_block, part->info.max_block);
+        {
+            std::lock_guard watermark_lock(refresh_watermark_mutex);
+            refresh_watermarks[refreshing_partition_id] = max_block;
+        }
+
         /// After complete refreshing, reset the values
         refreshing = false;
         refreshing_partition_id = "";
@@ -773,6 +787,138 @@ void StorageMaterializedView::refreshImpl(const ASTPtr & partition, ContextPtr l
     }
 }
 
+void StorageMaterializedView::refreshIncremental(ContextPtr local_context, bool async)
+{
+    auto select_table = DatabaseCatalog::instance().getTable(getInMemoryMetadataPtr()->select.select_table_id, local_context);
+    auto * merge_tree = dynamic_cast<MergeTreeData *>(select_table.get());
+    if (!merge_tree)
+        throw Exception("Select table " + backQuoteIfNeed(select_table->getStorageID().getDatabaseName()) + "." + backQuoteIfNeed(select_table->getStorageID().getTableName()) +
+                            " is not merge tree engine.", ErrorCodes::LOGICAL_ERROR);
+
+    struct PartitionDelta
+    {
+        MergeTreeData::DataPartsVector delta_parts;
+        MergeTreeData::DataPartPtr sample_part;
+        Int64 max_block = 0;
+        bool full_rebuild = false;
+    };
+    std::map<String, PartitionDelta> deltas;
+
+    auto parts = merge_tree->getDataPartsVector();
+    {
+        std::lock_guard watermark_lock(refresh_watermark_mutex);
+        for (const auto & part : parts)
+        {
+            auto & delta = deltas[part->info.partition_id];
+            delta.sample_part = part;
+            delta.max_block = std::max(delta.max_block, part->info.max_block);
+            auto it = refresh_watermarks.find(part->info.partition_id);
+            if (it == refresh_watermarks.end())
+                delta.full_rebuild = true; /// no baseline yet: first refresh of this partition, or a restart
+            else if (part->info.min_block > it->second)
+                delta.delta_parts.push_back(part);
+            else if (part->info.max_block > it->second)
+                /// the part straddles the mark: new rows were already merged with old
+                /// ones and cannot be aggregated separately any more
+                delta.full_rebuild = true;
+        }
+    }
+
+    FormatSettings format_settings;
+    for (auto & [partition_id, delta] : deltas)
+    {
+        if (delta.full_rebuild)
+        {
+            WriteBufferFromOwnString buf;
+            delta.sample_part->partition.serializeText(*merge_tree, buf, format_settings);
+            const String & partition_text = buf.str();
+            Tokens tokens(partition_text.data(), partition_text.data() + partition_text.size());
+            IParser::Pos token_iterator(tokens, local_context->getSettingsRef().max_query_size);
+            ASTPtr part_ast;
+            Expected expected;
+            if (!ParserPartition(ParserSettings::valueOf(local_context->getSettingsRef().dialect_type)).parse(token_iterator, part_ast, expected))
+                continue;
+            refreshImpl(part_ast, local_context, async);
+        }
+        else if (!delta.delta_parts.empty())
+        {
+            refreshDeltaParts(partition_id, delta.delta_parts, delta.max_block, local_context, async);
+        }
+        else
+            LOG_DEBUG(&Poco::Logger::get("refreshIncremental"), "partition-{} has no new parts since last refresh, skipping", partition_id);
+    }
+}
+
+void StorageMaterializedView::refreshDeltaParts(
+    const String & partition_id,
+    const std::vector<std::shared_ptr<const IMergeTreeDataPart>> & delta_parts,
+    Int64 new_watermark,
+    ContextPtr local_context,
+    bool async)
+{
+    try
+    {
+        bool old_val = false;
+        if (!refreshing.compare_exchange_strong(old_val, true, std::memory_order_seq_cst, std::memory_order_relaxed))
+            throw Exception("only one ongoing refreshing task is accepted, please wait for the current task to complete.", ErrorCodes::LOGICAL_ERROR);
+
+        refreshing_partition_id = partition_id;
+
+        bool cascading = local_context->getSettingsRef().cascading_refresh_materialized_view;
+        auto select_table = DatabaseCatalog::instance().getTable(getInMemoryMetadataPtr()->select.select_table_id, local_context);
+
+        bool disable_deduplication_for_children = select_table->supportsDeduplication();
+        auto view_context = Context::createCopy(local_context);
+        if (disable_deduplication_for_children)
+            view_context->setSetting("insert_deduplicate", false);
+
+        auto target_table = getTargetTable();
+        auto metadata_snapshot = target_table->getInMemoryMetadataPtr();
+        BlockOutputStreamPtr out;
+        if (cascading)
+            out = std::make_shared<PushingToViewsBlockOutputStream>(target_table, metadata_snapshot, view_context, ASTPtr());
+        else
+            out = write(ASTPtr(), metadata_snapshot, local_context);
+
+        /// No partition drop here: the delta aggregate is appended and the target
+        /// table merges it into the existing state, the same way deltas of normal
+        /// materialized view inserts are folded in.
+        out->writePrefix();
+        for (const auto & part : delta_parts)
+        {
+            auto in = generateInput(getInnerQuery(), out->getHeader(), "_part", part->name, local_context);
+            copyData(*in, *out);
+            LOG_DEBUG(&Poco::Logger::get("refreshDeltaParts"), "folded delta part-{} of partition-{} into view target", part->name, partition_id);
+        }
+        out->writeSuffix();
+
+        {
+            std::lock_guard watermark_lock(refresh_watermark_mutex);
+            refresh_watermarks[partition_id] = new_watermark;
+        }
+
+        refreshing = false;
+        refreshing_partition_id = "";
+    }
+    catch (const Exception & e)
+    {
+        refreshing = false;
+        refreshing_partition_id = "";
+        if (async)
+            LOG_ERROR(&Poco::Logger::get("refreshDeltaParts"), e.message());
+        else
+            throw;
+    }
+    catch (...)
+    {
+        refreshing = false;
+        refreshing_partition_id = "";
+
+        if (!async)
+            throw;
+    }
+}
+
 ASTPtr StorageMaterializedView::normalizeInnerQuery()
 {
     std::unique_lock lock(inner_query_mutex);
@@ -33,6 +33,8 @@
 namespace DB
 {
 
+class IMergeTreeDataPart;
+
 class StorageMaterializedView final : public shared_ptr_helper<StorageMaterializedView>, public IStorage, WithMutableContext
 {
     friend struct shared_ptr_helper<StorageMaterializedView>;
@@ -129,6 +131,18 @@ public:
 private:
     void refreshImpl(const ASTPtr & partition, ContextPtr local_context, bool async);
 
+    /// Incremental maintenance: fold only base parts whose block numbers lie
+    /// entirely above the per-partition refresh watermark into the target, and
+    /// fall back to a full partition rebuild where a part straddles the mark
+    /// (new rows already merged with old ones) or no mark exists yet.
+    void refreshIncremental(ContextPtr local_context, bool async);
+    void refreshDeltaParts(
+        const String & partition_id,
+        const std::vector<std::shared_ptr<const IMergeTreeDataPart>> & delta_parts,
+        Int64 new_watermark,
+        ContextPtr local_context,
+        bool async);
+
     /// Will be initialized in constructor
     StorageID target_table_id = StorageID::createEmpty();
 
@@ -138,6 +152,13 @@ private:
     String refreshing_partition_id;
     std::mutex inner_query_mutex;
     ASTPtr normalized_inner_query;
+
+    /// Highest base-table block number per partition already folded into the
+    /// target, advanced by every successful refresh. Kept in memory only: the
+    /// first refresh of a partition after a restart rebuilds it wholesale and
+    /// re-establishes the mark.
+    std::mutex refresh_watermark_mutex;
+    std::unordered_map<String, Int64> refresh_watermarks;
     void checkStatementCanBeForwarded() const;
 
 protected:
@@ -1136,7 +1136,7 @@ bool StorageMergeTree::scheduleDataProcessingJob(IBackgroundJobExecutor & execut
         executor.execute({[this, metadata_snapshot, merge_entry, mutate_entry, share_lock] () mutable
         {
             return mutateSelectedPart(metadata_snapshot, *mutate_entry, share_lock);
-        }, PoolType::MERGE_MUTATE});
+        }, PoolType::MERGE_MUTATE, JobPriority::LOW});
         return true;
     }
     else if (auto cmp_lock = time_after_previous_cleanup.compareAndRestartDeferred(1))
@@ -1151,7 +1151,7 @@ bool StorageMergeTree::scheduleDataProcessingJob(IBackgroundJobExecutor & execut
             clearOldMutations();
             clearEmptyParts();
             return true;
-        }, PoolType::MERGE_MUTATE});
+        }, PoolType::MERGE_MUTATE, JobPriority::HIGH});
         return true;
     }
     return false;
@@ -3247,10 +3247,18 @@ bool StorageReplicatedMergeTree::scheduleDataProcessingJob(IBackgroundJobExecuto
     }
     else
     {
+        /// DROP_RANGE entries (TTL expiry, DROP PARTITION) must not wait behind queued
+        /// merges, while mutations should not crowd merges out of the pool.
+        auto priority = JobPriority::NORMAL;
+        if (selected_entry->log_entry->type == LogEntry::DROP_RANGE)
+            priority = JobPriority::HIGH;
+        else if (selected_entry->log_entry->type == LogEntry::MUTATE_PART)
+            priority = JobPriority::LOW;
+
         executor.execute({[this, selected_entry] () mutable
         {
             return processQueueEntry(selected_entry);
-        }, PoolType::MERGE_MUTATE});
+        }, PoolType::MERGE_MUTATE, priority});
         return true;
     }
 }
@@ -0,0 +1,40 @@
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Optimizer/CostModel/CostCalibration.h>
+#include <Storages/System/StorageSystemCostCalibration.h>
+
+
+namespace DB
+{
+
+NamesAndTypesList StorageSystemCostCalibration::getNamesAndTypes()
+{
+    return {
+        {"virtual_warehouse", std::make_shared<DataTypeString>()},
+        {"scan_rows", std::make_shared<DataTypeUInt64>()},
+        {"scan_bytes", std::make_shared<DataTypeUInt64>()},
+        {"scan_us_per_byte", std::make_shared<DataTypeFloat64>()},
+        {"exchange_rows", std::make_shared<DataTypeUInt64>()},
+        {"exchange_us_per_row", std::make_shared<DataTypeFloat64>()},
+        {"cpu_baseline_rows", std::make_shared<DataTypeUInt64>()},
+        {"cpu_baseline_us_per_row", std::make_shared<DataTypeFloat64>()},
+    };
+}
+
+void StorageSystemCostCalibration::fillData(MutableColumns & res_columns, ContextPtr, const SelectQueryInfo &) const
+{
+    for (const auto & snapshot : CostCalibration::instance().getSnapshots())
+    {
+        size_t i = 0;
+        res_columns[i++]->insert(snapshot.virtual_warehouse);
+        res_columns[i++]->insert(snapshot.scan_rows);
+        res_columns[i++]->insert(snapshot.scan_bytes);
+        res_columns[i++]->insert(snapshot.scan_us_per_byte);
+        res_columns[i++]->insert(snapshot.exchange_rows);
+        res_columns[i++]->insert(snapshot.exchange_us_per_row);
+        res_columns[i++]->insert(snapshot.cpu_baseline_rows);
+        res_columns[i++]->insert(snapshot.cpu_baseline_us_per_row);
+    }
+}
+
+}
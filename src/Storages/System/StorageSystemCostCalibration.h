@@ -0,0 +1,30 @@
+#pragma once
+
+#include <common/shared_ptr_helper.h>
+#include <Storages/System/IStorageSystemOneBlock.h>
+
+
+namespace DB
+{
+
+class Context;
+
+
+/** Cost model coefficients fitted from execution profiles, per virtual warehouse.
+  */
+class StorageSystemCostCalibration final : public shared_ptr_helper<StorageSystemCostCalibration>,
+                                           public IStorageSystemOneBlock<StorageSystemCostCalibration>
+{
+    friend struct shared_ptr_helper<StorageSystemCostCalibration>;
+public:
+    std::string getName() const override { return "SystemCostCalibration"; }
+
+    static NamesAndTypesList getNamesAndTypes();
+
+protected:
+    using IStorageSystemOneBlock::IStorageSystemOneBlock;
+
+    void fillData(MutableColumns & res_columns, ContextPtr context, const SelectQueryInfo & query_info) const override;
+};
+
+}
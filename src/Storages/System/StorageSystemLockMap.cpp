@@ -38,6 +38,7 @@ NamesAndTypesList StorageSystemLockMap::getNamesAndTypes()
         {"conflicted_modes", std::make_shared<DataTypeString>()},
         {"granted_txns", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
         {"waiting_txns", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
+        {"waiting_times_ms", std::make_shared<DataTypeArray>(std::make_shared<DataTypeUInt64>())},
     };
 }
 
@@ -63,8 +64,14 @@ void StorageSystemLockMap::fillData(MutableColumns & res_columns, ContextPtr, co
                 for (const auto & granted_req : lock_context.getGrantedList())
                     granted_txns.emplace_back(granted_req->getTransactionID().toUInt64());
 
+                /// ages of the queued requests, aligned with waiting_txns; long-lived entries
+                /// with a busy queue are the signature of lock convoying
+                Array waiting_times_ms;
                 for (const auto & waiting_req : lock_context.getWaitingList())
+                {
                     waiting_txns.emplace_back(waiting_req->getTransactionID().toUInt64());
+                    waiting_times_ms.emplace_back(waiting_req->getPendingWaitMilliseconds());
+                }
 
                 size_t c = 0;
                 res_columns[c++]->insert(toString(static_cast<LockLevel>(level)));
@@ -75,6 +82,7 @@ void StorageSystemLockMap::fillData(MutableColumns & res_columns, ContextPtr, co
                 res_columns[c++]->insert(lockModesToDebugString(conflicted_mode));
                 res_columns[c++]->insert(granted_txns);
                 res_columns[c++]->insert(waiting_txns);
+                res_columns[c++]->insert(waiting_times_ms);
             }
         }
 
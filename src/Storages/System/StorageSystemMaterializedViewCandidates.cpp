@@ -0,0 +1,56 @@
+#include <DataTypes/DataTypeArray.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Interpreters/Context.h>
+#include <Optimizer/MaterializedView/MaterializedViewAdvisor.h>
+#include <Storages/System/StorageSystemMaterializedViewCandidates.h>
+
+
+namespace DB
+{
+
+NamesAndTypesList StorageSystemMaterializedViewCandidates::getNamesAndTypes()
+{
+    return {
+        {"database", std::make_shared<DataTypeString>()},
+        {"table", std::make_shared<DataTypeString>()},
+        {"group_by_columns", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())},
+        {"aggregates", std::make_shared<DataTypeArray>(std::make_shared<DataTypeString>())},
+        {"hits", std::make_shared<DataTypeUInt64>()},
+        {"estimated_scan_rows", std::make_shared<DataTypeUInt64>()},
+        {"estimated_result_rows", std::make_shared<DataTypeUInt64>()},
+        {"estimated_bytes_saved_per_query", std::make_shared<DataTypeUInt64>()},
+        {"projected_speedup", std::make_shared<DataTypeFloat64>()},
+        {"suggested_query", std::make_shared<DataTypeString>()},
+    };
+}
+
+void StorageSystemMaterializedViewCandidates::fillData(MutableColumns & res_columns, ContextPtr context, const SelectQueryInfo &) const
+{
+    size_t top_k = context->getSettingsRef().materialized_view_advisor_top_k;
+    for (const auto & candidate : MaterializedViewAdvisor::instance().getTopCandidates(top_k))
+    {
+        size_t i = 0;
+        res_columns[i++]->insert(candidate.database);
+        res_columns[i++]->insert(candidate.table);
+
+        Array group_by_columns;
+        for (const auto & column : candidate.group_by_columns)
+            group_by_columns.emplace_back(column);
+        res_columns[i++]->insert(group_by_columns);
+
+        Array aggregates;
+        for (const auto & aggregate : candidate.aggregates)
+            aggregates.emplace_back(aggregate);
+        res_columns[i++]->insert(aggregates);
+
+        res_columns[i++]->insert(candidate.hits);
+        res_columns[i++]->insert(candidate.estimated_scan_rows);
+        res_columns[i++]->insert(candidate.estimated_result_rows);
+        res_columns[i++]->insert(candidate.estimated_bytes_saved_per_query);
+        res_columns[i++]->insert(candidate.projectedSpeedup());
+        res_columns[i++]->insert(candidate.suggestedQuery());
+    }
+}
+
+}
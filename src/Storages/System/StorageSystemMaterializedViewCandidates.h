@@ -0,0 +1,30 @@
+#pragma once
+
+#include <common/shared_ptr_helper.h>
+#include <Storages/System/IStorageSystemOneBlock.h>
+
+
+namespace DB
+{
+
+class Context;
+
+
+/** Aggregation materialized views recommended by the advisor, ordered by score.
+  */
+class StorageSystemMaterializedViewCandidates final : public shared_ptr_helper<StorageSystemMaterializedViewCandidates>,
+                                                     public IStorageSystemOneBlock<StorageSystemMaterializedViewCandidates>
+{
+    friend struct shared_ptr_helper<StorageSystemMaterializedViewCandidates>;
+public:
+    std::string getName() const override { return "SystemMaterializedViewCandidates"; }
+
+    static NamesAndTypesList getNamesAndTypes();
+
+protected:
+    using IStorageSystemOneBlock::IStorageSystemOneBlock;
+
+    void fillData(MutableColumns & res_columns, ContextPtr context, const SelectQueryInfo & query_info) const override;
+};
+
+}
@@ -62,6 +62,8 @@ NamesAndTypesList StorageSystemVirtualWarehouses::getNamesAndTypes()
         {"mem_threshold_for_recall", std::make_shared<DataTypeUInt32>()},
         {"cooldown_seconds_after_auto_link", std::make_shared<DataTypeUInt32>()},
         {"cooldown_seconds_after_auto_unlink", std::make_shared<DataTypeUInt32>()},
+        {"spillover_vw", std::make_shared<DataTypeString>()},
+        {"max_spillover_concurrent_queries", std::make_shared<DataTypeUInt32>()},
     };
 }
 
@@ -115,6 +117,8 @@ void StorageSystemVirtualWarehouses::fillData(MutableColumns & res_columns, cons
         res_columns[i++]->insert(vw_settings.mem_threshold_for_recall);
         res_columns[i++]->insert(vw_settings.cooldown_seconds_after_auto_link);
         res_columns[i++]->insert(vw_settings.cooldown_seconds_after_auto_unlink);
+        res_columns[i++]->insert(vw_settings.spillover_vw);
+        res_columns[i++]->insert(vw_settings.max_spillover_concurrent_queries);
     }
 }
 
@@ -28,6 +28,8 @@
 #include <Storages/System/StorageSystemBuildOptions.h>
 #include <Storages/System/StorageSystemCollations.h>
 #include <Storages/System/StorageSystemClusters.h>
+#include <Storages/System/StorageSystemCostCalibration.h>
+#include <Storages/System/StorageSystemMaterializedViewCandidates.h>
 #include <Storages/System/StorageSystemCnchStagedParts.h>
 #include <Storages/System/StorageSystemColumns.h>
 #include <Storages/System/StorageSystemDatabases.h>
@@ -205,6 +207,8 @@ void attachSystemTablesServer(IDatabase & system_database, bool has_zookeeper)
     attach<StorageSystemClusters>(system_database, "clusters");
     attach<StorageSystemGraphite>(system_database, "graphite_retentions");
     attach<StorageSystemMacros>(system_database, "macros");
+    attach<StorageSystemCostCalibration>(system_database, "optimizer_cost_calibration");
+    attach<StorageSystemMaterializedViewCandidates>(system_database, "materialized_view_candidates");
     attach<StorageSystemReplicatedFetches>(system_database, "replicated_fetches");
     attach<StorageSystemPartMovesBetweenShards>(system_database, "part_moves_between_shards");
 #if USE_RDKAFKA
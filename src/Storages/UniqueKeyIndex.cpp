@@ -17,6 +17,9 @@
 #include <Common/Coding.h>
 #include <Common/Exception.h>
 
+#include <algorithm>
+#include <numeric>
+
 namespace DB
 {
 namespace ErrorCodes
@@ -72,6 +75,59 @@ bool UniqueKeyIndex::lookup(const String & key, UInt32 & rowid)
     }
 }
 
+void UniqueKeyIndex::multiLookup(const std::vector<String> & keys, std::vector<UInt32> & rowids, std::vector<UInt8> & found)
+{
+    rowids.assign(keys.size(), 0);
+    found.assign(keys.size(), 0);
+    if (!index_reader || keys.empty())
+        return;
+
+    /// Table::MultiGet requires keys in comparator (bytewise) order, so probe
+    /// through a sorted permutation and let callers pass keys as-is.
+    std::vector<size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&keys](size_t lhs, size_t rhs) { return keys[lhs] < keys[rhs]; });
+
+    std::vector<Slice> sorted_keys;
+    sorted_keys.reserve(keys.size());
+    for (size_t idx : order)
+        sorted_keys.emplace_back(keys[idx]);
+
+    std::vector<String> values;
+    std::vector<IndexFile::Status> statuses;
+    auto status = index_reader->MultiGet(IndexFile::ReadOptions(), sorted_keys, &values, &statuses);
+    if (!status.ok())
+        throw Exception("Failed to lookup keys: " + status.ToString(), ErrorCodes::UNKNOWN_EXCEPTION);
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        if (statuses[i].ok())
+        {
+            Slice input(values[i]);
+            if (!GetVarint32(&input, &rowids[order[i]]))
+                throw Exception("Failed to decode rowid", ErrorCodes::UNKNOWN_EXCEPTION);
+            found[order[i]] = 1;
+        }
+        else if (!statuses[i].IsNotFound())
+        {
+            throw Exception("Failed to lookup key: " + statuses[i].ToString(), ErrorCodes::UNKNOWN_EXCEPTION);
+        }
+    }
+}
+
+bool UniqueKeyIndex::getLargestKeyBound(String & key) const
+{
+    if (!index_reader)
+        return false;
+
+    auto status = index_reader->LargestKeyUpperBound(&key);
+    if (status.ok())
+        return true;
+    if (status.IsNotFound())
+        return false;
+    throw Exception("Failed to get largest key bound: " + status.ToString(), ErrorCodes::UNKNOWN_EXCEPTION);
+}
+
 std::unique_ptr<IndexFile::Iterator> UniqueKeyIndex::new_iterator(const IndexFile::ReadOptions & options)
 {
     if (!index_reader)
@@ -40,6 +40,19 @@ public:
     /// throws exception if error.
     bool lookup(const String & key, UInt32 & rowid);
 
+    /// Batched version of lookup() for many keys.
+    /// Sets found[i] to 1 and fills rowids[i] for every keys[i] present in the index.
+    /// Keys are probed in sorted order so that keys falling into the same index block
+    /// share one block read; prefer this over per-key lookup() when probing many keys.
+    /// throws exception if error.
+    void multiLookup(const std::vector<String> & keys, std::vector<UInt32> & rowids, std::vector<UInt8> & found);
+
+    /// Sets "key" to an upper bound of the largest key in the index and returns true.
+    /// The bound comes from the in-memory index block, so no data block is read.
+    /// Returns false if the index contains no entries.
+    /// throws exception if error.
+    bool getLargestKeyBound(String & key) const;
+
     /// Return an iterator over KVs in this file.
     /// Note: client should make sure the UniqueKeyIndex object lives longer than the returned iterator.
     std::unique_ptr<IndexFile::Iterator> new_iterator(const IndexFile::ReadOptions & options);
@@ -62,6 +62,30 @@ GetTimestampResp TSOClient::getTimestamp()
     return resp;
 }
 
+UInt64 TimestampWindow::tryAllocate(UInt64 now_ms)
+{
+    std::lock_guard lock(mutex);
+    if (next_ts == 0 || next_ts > max_ts || now_ms > expire_at_ms)
+        return 0;
+    return next_ts++;
+}
+
+UInt64 TimestampWindow::refillAndAllocate(UInt64 max_timestamp, UInt32 size, UInt64 ttl_ms, UInt64 now_ms)
+{
+    UInt64 first_ts = max_timestamp - (size - 1);
+
+    std::lock_guard lock(mutex);
+    /// A concurrent refill may have installed a newer window before this grant arrived.
+    /// Never roll the window back, otherwise local allocation would lose monotonicity.
+    if (max_timestamp > max_ts)
+    {
+        next_ts = first_ts + 1;
+        max_ts = max_timestamp;
+        expire_at_ms = now_ms + ttl_ms;
+    }
+    return first_ts;
+}
+
 GetTimestampsResp TSOClient::getTimestamps(UInt32 size)
 {
     GetTimestampsReq req;
@@ -77,11 +101,28 @@ GetTimestampsResp TSOClient::getTimestamps(UInt32 size)
     return resp;
 }
 
+static UInt64 nowMilliseconds()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 UInt64 getTSOResponse(const Context & context, TSORequestType type, size_t size)
 {
     const auto & config = context.getConfigRef();
     int tos_max_retry = config.getInt("tso_service.tso_max_retry_count", 3);
     bool use_tso_fallback = config.getBool("tso_service.use_fallback", true);
+    UInt32 window_size = config.getUInt("tso_service.client_window_size", 0);
+    UInt64 window_ttl_ms = config.getUInt64("tso_service.client_window_ttl_ms", 100);
+
+    /// Single timestamps are leased from a process-wide window so the TSO round trip
+    /// leaves the hot path: one GetTimestamps RPC serves up to window_size requests.
+    static TimestampWindow timestamp_window;
+    bool use_window = type == TSORequestType::GetTimestamp && window_size > 1;
+    if (use_window)
+    {
+        if (UInt64 leased_ts = timestamp_window.tryAllocate(nowMilliseconds()))
+            return leased_ts;
+    }
 
     std::string new_leader;
     int retry = tos_max_retry;
@@ -96,6 +137,14 @@ UInt64 getTSOResponse(const Context & context, TSORequestType type, size_t size)
             {
                 case TSORequestType::GetTimestamp:
                 {
+                    if (use_window)
+                    {
+                        auto response = tso_client->getTimestamps(window_size);
+                        if (response.is_leader())
+                            return timestamp_window.refillAndAllocate(
+                                response.max_timestamp(), window_size, window_ttl_ms, nowMilliseconds());
+                        break;
+                    }
                     auto response = tso_client->getTimestamp();
                     if (response.is_leader())
                         return response.timestamp();
@@ -17,6 +17,8 @@
 #include <CloudServices/RpcClientBase.h>
 #include <Protos/tso.pb.h>
 
+#include <mutex>
+
 namespace DB::TSO
 {
 class TSO_Stub;
@@ -41,6 +43,32 @@ private:
 
 using TSOClientPtr = std::shared_ptr<TSOClient>;
 
+/** Client-side lease of a contiguous timestamp range granted by a single GetTimestamps RPC.
+  * Callers allocate timestamps from the window locally and only go back to the TSO leader
+  * when the window is exhausted or expired, collapsing thousands of GetTimestamp round
+  * trips into one RPC per window. Allocation is strictly monotonic: the granting fetch_add
+  * on the leader advances the TSO beyond every leased timestamp, so timestamps handed out
+  * by later RPCs (from any server) are always larger than the whole window. The TTL bounds
+  * how long a leased timestamp may lag behind the timestamps the leader currently serves.
+  */
+class TimestampWindow
+{
+public:
+    /// Returns the next leased timestamp, or 0 if the window is exhausted or expired.
+    UInt64 tryAllocate(UInt64 now_ms);
+
+    /// Installs [max_timestamp - size + 1, max_timestamp] as the new window and returns its
+    /// first timestamp. If a concurrent refill already installed a newer window, the older
+    /// grant is dropped after consuming this single timestamp from it.
+    UInt64 refillAndAllocate(UInt64 max_timestamp, UInt32 size, UInt64 ttl_ms, UInt64 now_ms);
+
+private:
+    std::mutex mutex;
+    UInt64 next_ts = 0;
+    UInt64 max_ts = 0; /// inclusive
+    UInt64 expire_at_ms = 0;
+};
+
 enum class TSORequestType
 {
     GetTimestamp,
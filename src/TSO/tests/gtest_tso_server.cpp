@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <TSO/TSOClient.h>
 #include <TSO/TSOImpl.h>
 
 
@@ -32,3 +33,39 @@ TEST(TSOImpl, testSetGetClock)
     EXPECT_EQ(cur_ts_actual.physical , physical_time_expected);
     EXPECT_EQ(cur_ts_actual.logical, logical_time_expected);
 }
+
+TEST(TimestampWindow, testAllocateMonotonic)
+{
+    TimestampWindow window;
+
+    /// window of 4 timestamps [97, 100] granted at t=0 with ttl 100ms
+    EXPECT_EQ(window.refillAndAllocate(100, 4, 100, 0), 97);
+    EXPECT_EQ(window.tryAllocate(0), 98);
+    EXPECT_EQ(window.tryAllocate(50), 99);
+    EXPECT_EQ(window.tryAllocate(100), 100);
+
+    /// exhausted window allocates nothing
+    EXPECT_EQ(window.tryAllocate(100), 0);
+}
+
+TEST(TimestampWindow, testExpiry)
+{
+    TimestampWindow window;
+
+    EXPECT_EQ(window.refillAndAllocate(100, 4, 100, 0), 97);
+    EXPECT_EQ(window.tryAllocate(100), 98);
+
+    /// ttl passed, remaining timestamps are dropped
+    EXPECT_EQ(window.tryAllocate(101), 0);
+}
+
+TEST(TimestampWindow, testStaleRefillDoesNotRollBack)
+{
+    TimestampWindow window;
+
+    EXPECT_EQ(window.refillAndAllocate(200, 4, 100, 0), 197);
+
+    /// a grant that raced with a newer one is consumed once but never installed
+    EXPECT_EQ(window.refillAndAllocate(100, 4, 100, 0), 97);
+    EXPECT_EQ(window.tryAllocate(0), 198);
+}
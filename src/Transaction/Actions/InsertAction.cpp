@@ -82,9 +82,10 @@ void InsertAction::executeV2()
 /// Post progressing
 void InsertAction::postCommit(TxnTimestamp commit_time)
 {
-    /// set commit time for part and bitmaps
-    global_context.getCnchCatalog()->setCommitTime(
-        table, Catalog::CommitItems{{parts.begin(), parts.end()}, delete_bitmaps, {staged_parts.begin(), staged_parts.end()}}, commit_time, txn_id);
+    /// set commit time for part and bitmaps (unless already written with it in the commit batch)
+    if (!commit_time_packed)
+        global_context.getCnchCatalog()->setCommitTime(
+            table, Catalog::CommitItems{{parts.begin(), parts.end()}, delete_bitmaps, {staged_parts.begin(), staged_parts.end()}}, commit_time, txn_id);
 
     for (auto & part : parts)
         part->commit_time = commit_time;
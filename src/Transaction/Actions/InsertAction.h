@@ -58,6 +58,16 @@ public:
 
     void setBlockID(UInt64 * block_id_) { block_id = block_id_; }
 
+    /// For Kafka transactions the part metadata can be packed into the same metastore
+    /// commit as the record flip and the offsets, see CnchServerTransaction::commit()
+    StoragePtr getTable() const { return table; }
+    const MutableMergeTreeDataPartsCNCHVector & getParts() const { return parts; }
+    const DeleteBitmapMetaPtrVector & getDeleteBitmaps() const { return delete_bitmaps; }
+    const MutableMergeTreeDataPartsCNCHVector & getStagedParts() const { return staged_parts; }
+    /// Marks that parts were committed with their commit time already set, so postCommit
+    /// does not need to rewrite them
+    void setCommitTimePacked() { commit_time_packed = true; }
+
     static UInt32 collectNewParts(MutableMergeTreeDataPartsCNCHVector const& parts_);
 
     UInt32 getSize() const override { return parts.size() + delete_bitmaps.size(); }
@@ -69,6 +79,7 @@ private:
     MutableMergeTreeDataPartsCNCHVector staged_parts;
 
     bool executed{false};
+    bool commit_time_packed{false};
     Poco::Logger * log{&Poco::Logger::get("InsertAction")};
     UInt64 * block_id = nullptr;
 };
@@ -13,6 +13,7 @@
 #include <Poco/Logger.h>
 
 #include <atomic>
+#include <map>
 
 namespace DB
 {
@@ -149,12 +150,62 @@ bool CnchLockHolder::tryLock()
     Stopwatch watch;
     SCOPE_EXIT({ LOG_DEBUG(&Poco::Logger::get("CnchLock"), "acquire {} locks in {} ms", cnch_locks.size(), watch.elapsedMilliseconds()); });
 
+    /// Coalesce locks that target the same remote server into one acquireLocks call,
+    /// so a scope covering many partitions pays a single round trip per server instead
+    /// of one per lock. Local locks go to the LockManager directly as before.
+    std::vector<CnchLock *> local_locks;
+    std::map<String, std::pair<CnchServerClientPtr, std::vector<CnchLock *>>> remote_groups;
     for (const auto & lock : cnch_locks)
+    {
+        auto client = lock->getTargetServer();
+        if (!client)
+        {
+            local_locks.push_back(lock.get());
+        }
+        else
+        {
+            auto & group = remote_groups[(*client)->getRPCAddress()];
+            group.first = *client;
+            group.second.push_back(lock.get());
+        }
+    }
+
+    for (auto * lock : local_locks)
     {
         if (!lock->tryLock())
             return false;
     }
 
+    for (auto & [address, group] : remote_groups)
+    {
+        if (group.second.size() == 1)
+        {
+            if (!group.second.front()->tryLock())
+                return false;
+            continue;
+        }
+
+        LOG_DEBUG(
+            &Poco::Logger::get("CnchLockManagerClient"),
+            "try lock {} locks in one batch, target server: {}", group.second.size(), address);
+
+        std::vector<LockInfoPtr> lock_infos;
+        lock_infos.reserve(group.second.size());
+        for (auto * lock : group.second)
+        {
+            lock->server_client = group.first;
+            lock_infos.push_back(lock->lock_info);
+        }
+
+        group.first->acquireLocks(lock_infos);
+
+        bool all_locked = true;
+        for (auto * lock : group.second)
+            all_locked &= (lock->locked = (lock->lock_info->status == LockStatus::LOCK_OK));
+        if (!all_locked)
+            return false;
+    }
+
     /// init heartbeat task if needed
     if (!report_lock_heartbeat_task)
     {
@@ -16,6 +16,7 @@
 #include <Transaction/CnchServerTransaction.h>
 
 #include <Catalog/Catalog.h>
+#include <Transaction/Actions/InsertAction.h>
 #include <common/scope_guard.h>
 #include <Common/Exception.h>
 #include <Common/ProfileEvents.h>
@@ -164,11 +165,23 @@ void CnchServerTransaction::precommit()
         throw Exception("Transaction is not in running status, but in " + String(txnStatusToString(status)), ErrorCodes::LOGICAL_ERROR);
 
     for (auto & action : actions)
+    {
+        /// Kafka single-insert transactions defer the catalog part write so that it can be
+        /// packed into the same metastore commit as the record flip and the offsets.
+        if (packPartsIntoCommitBatch() && action->as<InsertAction>())
+            continue;
         action->executeV2();
+    }
 
     txn_record.prepared = true;
 }
 
+bool CnchServerTransaction::packPartsIntoCommitBatch() const
+{
+    return isPrimary() && !consumer_group.empty() && actions.size() == 1
+        && global_context->getSettingsRef().kafka_combined_metastore_commit;
+}
+
 TxnTimestamp CnchServerTransaction::commit()
 {
     LOG_DEBUG(log, "Transaction {} starts commit", txn_record.txnID().toUInt64());
@@ -194,7 +207,25 @@ TxnTimestamp CnchServerTransaction::commit()
                              .setCommitTs(commit_ts)
                              .setMainTableUUID(getMainTableUUID());
                 Stopwatch stop_watch;
-                auto success = global_context->getCnchCatalog()->setTransactionRecordStatusWithOffsets(txn_record, target_record, consumer_group, tpl);
+                bool success;
+                auto * insert_action = packPartsIntoCommitBatch() ? actions.front()->as<InsertAction>() : nullptr;
+                if (insert_action)
+                {
+                    /// One metastore commit carries the parts, the offsets and the record flip;
+                    /// precommit skipped the part write and postCommit skips the time rewrite.
+                    const auto & parts = insert_action->getParts();
+                    const auto & staged_parts = insert_action->getStagedParts();
+                    success = global_context->getCnchCatalog()->setTransactionRecordStatusWithOffsetsAndParts(
+                        txn_record, target_record, consumer_group, tpl, insert_action->getTable(),
+                        Catalog::CommitItems{
+                            {parts.begin(), parts.end()},
+                            insert_action->getDeleteBitmaps(),
+                            {staged_parts.begin(), staged_parts.end()}});
+                    if (success)
+                        insert_action->setCommitTimePacked();
+                }
+                else
+                    success = global_context->getCnchCatalog()->setTransactionRecordStatusWithOffsets(txn_record, target_record, consumer_group, tpl);
 
                 txn_record = std::move(target_record);
                 if (success)
@@ -60,6 +60,10 @@ public:
     void clean(TxnCleanTask & task) override;
 
     void removeIntermediateData() override;
+
+    /// Whether the part metadata of a Kafka single-insert transaction should be packed
+    /// into the same metastore commit as the record flip and the consumed offsets
+    bool packPartsIntoCommitBatch() const;
 protected:
     static constexpr size_t MAX_RETRY = 3;
     std::vector<ActionPtr> actions;
@@ -31,12 +31,13 @@ namespace ErrorCodes
     extern const int BRPC_TIMEOUT;
 }
 
-CnchWorkerTransaction::CnchWorkerTransaction(const ContextPtr & context_, CnchServerClientPtr client)
+CnchWorkerTransaction::CnchWorkerTransaction(const ContextPtr & context_, CnchServerClientPtr client, bool read_only)
     : ICnchTransaction(context_), server_client(std::move(client))
 {
     checkServerClient();
-    auto [start_ts, txn_id] = server_client->createTransaction();
+    auto [start_ts, txn_id] = server_client->createTransaction({0}, read_only);
     TransactionRecord record;
+    record.read_only = read_only;
     record.setID(txn_id).setInitiator(txnInitiatorToString(CnchTransactionInitiator::Worker)).setStatus(CnchTransactionStatus::Running);
     setTransactionRecord(std::move(record));
     is_initiator = true;
@@ -31,8 +31,10 @@ class CnchWorkerTransaction : public ICnchTransaction
 {
 public:
     // ctor for worker initiated tranasction
-    // Create a server transaction on cnch server using `client`
-    CnchWorkerTransaction(const ContextPtr & context_, CnchServerClientPtr client);
+    // Create a server transaction on cnch server using `client`.
+    // With read_only the server only allocates the snapshot timestamp; no transaction
+    // record is ever written to the metastore and nothing has to be cleaned afterwards.
+    CnchWorkerTransaction(const ContextPtr & context_, CnchServerClientPtr client, bool read_only = false);
 
     // ctor for kafka initiated transaction
     // Create a server transaction on server, and maintain kafka_table_id in the transaction
@@ -36,6 +36,7 @@
 #include <common/logger_useful.h>
 #include "Transaction/LockRequest.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -91,6 +92,13 @@ public:
     void setMainTableUUID(const UUID & uuid) { main_table_uuid = uuid; }
     UUID getMainTableUUID() const { return main_table_uuid; }
 
+    /// Commit barrier for parallel insert sinks sharing this transaction.
+    /// Each sink registers itself when it starts writing; the sink whose
+    /// deregistration drops the count to zero performs the visibility commit.
+    size_t registerInsertSink() { return ++active_insert_sinks; }
+    size_t deregisterInsertSink() { return --active_insert_sinks; }
+    size_t getActiveInsertSinks() const { return active_insert_sinks.load(); }
+
     void setKafkaTpl(const String & consumer_group, const cppkafka::TopicPartitionList & tpl);
     void getKafkaTpl(String & consumer_group, cppkafka::TopicPartitionList & tpl) const;
 
@@ -211,6 +219,8 @@ protected:
     InsertionLabelPtr insertion_label;
     std::weak_ptr<CnchLockHolder> lock_holder;
 
+    std::atomic<size_t> active_insert_sinks{0};
+
 private:
     String creator;
     mutable bthread::RecursiveMutex mutex;
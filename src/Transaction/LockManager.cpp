@@ -7,11 +7,17 @@
 #include <Transaction/TransactionCommon.h>
 #include <common/logger_useful.h>
 #include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
 #include <Common/Stopwatch.h>
 
 #include <chrono>
 #include <cassert>
 
+namespace ProfileEvents
+{
+    extern const Event LockManagerLockWaits;
+    extern const Event LockManagerLockWaitMilliseconds;
+}
 
 namespace DB
 {
@@ -50,6 +56,8 @@ LockStatus LockContext::lock(LockRequest * request)
             incConflictedModeCount(request->getMode());
             auto pos = waitingList.insert(waitingList.end(), request);
             request->setLockResult(LockStatus::LOCK_WAITING, pos);
+            request->setEnqueueTime(std::chrono::steady_clock::now());
+            ProfileEvents::increment(ProfileEvents::LockManagerLockWaits);
             return LockStatus::LOCK_WAITING;
         }
     }
@@ -104,6 +112,7 @@ void LockContext::scheduleWaitingRequests()
         decConflictedModeCount(request->getMode());
         incGrantedModeCount(request->getMode());
         incGrantedTxnCounts(request->getTransactionID());
+        ProfileEvents::increment(ProfileEvents::LockManagerLockWaitMilliseconds, request->getPendingWaitMilliseconds());
         auto pos = grantedList.insert(grantedList.end(), request);
         request->setLockResult(LockStatus::LOCK_OK, pos);
         request->notify();
@@ -135,6 +135,20 @@ void LockRequest::notify()
     cv.notify_one();
 }
 
+void LockRequest::setEnqueueTime(std::chrono::steady_clock::time_point tp)
+{
+    std::lock_guard lg(mutex);
+    enqueue_time = tp;
+}
+
+UInt64 LockRequest::getPendingWaitMilliseconds() const
+{
+    std::lock_guard lg(mutex);
+    if (enqueue_time == std::chrono::steady_clock::time_point{})
+        return 0;
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - enqueue_time).count();
+}
+
 bool LockRequest::wait()
 {
     std::unique_lock lk(mutex);
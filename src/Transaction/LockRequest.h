@@ -18,6 +18,7 @@
 #include <Transaction/LockDefines.h>
 #include <Transaction/TxnTimestamp.h>
 
+#include <chrono>
 #include <condition_variable>
 #include <list>
 #include <mutex>
@@ -54,6 +55,11 @@ public:
     void setTimeout(UInt64 t) { timeout = t; }
     void notify();
 
+    /// Record the moment the request entered a waiting list, so queueing time can be
+    /// observed in system.lock_map while the request waits and accounted once granted.
+    void setEnqueueTime(std::chrono::steady_clock::time_point tp);
+    UInt64 getPendingWaitMilliseconds() const;
+
 private:
     bool wait();
 
@@ -68,6 +74,7 @@ private:
 
     LockRequestItor request_itor;
     LockStatus status{LockStatus::LOCK_INIT};
+    std::chrono::steady_clock::time_point enqueue_time{};
 
     mutable std::mutex mutex;
     std::condition_variable cv;
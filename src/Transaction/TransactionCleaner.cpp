@@ -16,9 +16,10 @@
 #include <Transaction/TransactionCleaner.h>
 
 #include <Catalog/Catalog.h>
+#include <CloudServices/CnchServerClient.h>
+#include <CloudServices/CnchServerClientPool.h>
 #include <Common/serverLocality.h>
 #include <MergeTreeCommon/CnchTopologyMaster.h>
-// #include <MergeTreeCommon/CnchServerClientPool.h>
 #include <Storages/MergeTree/MergeTreeDataPartCNCH_fwd.h>
 #include <Transaction/TransactionCoordinatorRcCnch.h>
 #include <Transaction/TxnTimestamp.h>
@@ -99,15 +100,6 @@ void TransactionCleaner::cleanCommittedTxn(const TransactionRecord & txn_record)
         for (const auto & [uuid, resources] : undo_buffer)
         {
             LOG_DEBUG(log, "Get undo buffer of the table {}\n", uuid);
-            auto host_port = global_context.getCnchTopologyMaster()->getTargetServer(uuid, false);
-            auto rpc_address = host_port.getRPCAddress();
-            if (!isLocalServer(rpc_address, std::to_string(global_context.getRPCPort())))
-            {
-                // TODO: need to fix for multi-table txn
-                LOG_DEBUG(log, "Forward clean task for txn {} to server {}", txn_record.txnID().toUInt64(), rpc_address);
-                // global_context.getCnchServerClientPool().get(rpc_address)->cleanTransaction(txn_record);
-                return;
-            }
             StoragePtr table = catalog->tryGetTableByUUID(global_context, uuid, TxnTimestamp::maxTS(), true);
             if (!table)
                 continue;
@@ -122,7 +114,32 @@ void TransactionCleaner::cleanCommittedTxn(const TransactionRecord & txn_record)
                 task.undo_size = intermediate_parts.size() + undo_bitmaps.size();
             }
 
-            catalog->setCommitTime(table, Catalog::CommitItems{intermediate_parts, undo_bitmaps, staged_parts}, txn_record.commitTs(), txn_record.txnID());
+            auto host_port = global_context.getCnchTopologyMaster()->getTargetServer(uuid, false);
+            auto rpc_address = host_port.getRPCAddress();
+            if (!isLocalServer(rpc_address, std::to_string(global_context.getRPCPort())))
+            {
+                /// The commit time write must go through the table's host server so its part
+                /// cache is updated together with the metastore. Forward just this table's
+                /// write instead of bailing out on the whole transaction, otherwise the commit
+                /// time of a multi-table txn never gets inlined into part metadata and every
+                /// visibility check keeps consulting the transaction record.
+                LOG_DEBUG(
+                    log,
+                    "Forward commit time write of txn {} for table {} to host server {}",
+                    txn_record.txnID().toUInt64(),
+                    uuid,
+                    rpc_address);
+                global_context.getCnchServerClientPool().get(host_port)->redirectSetCommitTime(
+                    table,
+                    Catalog::CommitItems{intermediate_parts, undo_bitmaps, staged_parts},
+                    txn_record.commitTs(),
+                    txn_record.txnID());
+            }
+            else
+            {
+                catalog->setCommitTime(
+                    table, Catalog::CommitItems{intermediate_parts, undo_bitmaps, staged_parts}, txn_record.commitTs(), txn_record.txnID());
+            }
         }
 
         catalog->clearUndoBuffer(txn_record.txnID());
@@ -35,6 +35,9 @@ namespace ProfileEvents
 extern const Event CnchTxnReadTxnCreated;
 extern const Event CnchTxnWriteTxnCreated;
 extern const Event CnchTxnExpired;
+extern const Event CnchTxnCommitted;
+extern const Event CnchTxnCommitV2Failed;
+extern const Event CnchTxnFinishedTransactionRecord;
 }
 
 namespace DB
@@ -45,6 +48,7 @@ namespace ErrorCodes
     extern const int LOGICAL_ERROR;
     extern const int CNCH_TRANSACTION_NOT_INITIALIZED;
     extern const int CNCH_TRANSACTION_HAS_BEEN_CREATED;
+    extern const int CNCH_TRANSACTION_COMMIT_ERROR;
 }
 
 TransactionCnchPtr TransactionCoordinatorRcCnch::createTransaction(const CreateTransactionOption & opt)
@@ -195,9 +199,131 @@ TxnTimestamp TransactionCoordinatorRcCnch::commitV1(TransactionCnchPtr & txn) co
 
 TxnTimestamp TransactionCoordinatorRcCnch::commitV2(TransactionCnchPtr & txn) const
 {
+    if (canUseGroupCommit(txn))
+        return commitViaGroupCommit(std::static_pointer_cast<CnchServerTransaction>(txn));
     return txn->commitV2();
 }
 
+bool TransactionCoordinatorRcCnch::canUseGroupCommit(const TransactionCnchPtr & txn) const
+{
+    if (!group_commit_window_ms)
+        return false;
+
+    /// Only plain primary implicit transactions qualify: Kafka commits carry offsets and
+    /// labelled inserts pack additional CAS requests into the record write, secondary txns
+    /// are committed through their explicit transaction.
+    if (!dynamic_cast<CnchServerTransaction *>(txn.get()))
+        return false;
+    if (txn->isReadOnly() || !txn->isPrimary() || txn->getInsertionLabel())
+        return false;
+
+    String consumer_group;
+    cppkafka::TopicPartitionList tpl;
+    txn->getKafkaTpl(consumer_group, tpl);
+    return consumer_group.empty();
+}
+
+TxnTimestamp TransactionCoordinatorRcCnch::commitViaGroupCommit(const CnchServerTransactionPtr & txn) const
+{
+    try
+    {
+        txn->precommit();
+
+        auto pending = std::make_shared<PendingGroupCommit>();
+        pending->txn = txn;
+        {
+            std::unique_lock lock(group_commit_mutex);
+            group_commit_queue.push_back(pending);
+            /// The first committer of a window arms the flush timer; a full batch flushes at once.
+            if (group_commit_queue.size() >= group_commit_max_batch)
+                group_commit_task->schedule();
+            else if (group_commit_queue.size() == 1)
+                group_commit_task->scheduleAfter(group_commit_window_ms);
+        }
+
+        {
+            std::unique_lock lock(group_commit_mutex);
+            group_commit_cv.wait(lock, [&] { return pending->done; });
+        }
+        if (pending->exception)
+            std::rethrow_exception(pending->exception);
+        return pending->commit_ts;
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+        txn->rollback();
+        throw;
+    }
+}
+
+void TransactionCoordinatorRcCnch::flushGroupCommits() const
+{
+    std::vector<PendingGroupCommitPtr> batch;
+    {
+        std::unique_lock lock(group_commit_mutex);
+        batch.swap(group_commit_queue);
+    }
+    if (batch.empty())
+        return;
+
+    try
+    {
+        /// Independent micro-batch inserts can share one commit timestamp.
+        TxnTimestamp commit_ts = getContext()->getTimestamp();
+        std::vector<std::pair<TransactionRecord, TransactionRecord>> records;
+        records.reserve(batch.size());
+        for (auto & pending : batch)
+        {
+            TransactionRecord target_record = pending->txn->getTransactionRecord();
+            target_record.setStatus(CnchTransactionStatus::Finished)
+                         .setCommitTs(commit_ts)
+                         .setMainTableUUID(pending->txn->getMainTableUUID());
+            records.emplace_back(pending->txn->getTransactionRecord(), target_record);
+        }
+
+        auto results = getContext()->getCnchCatalog()->setTransactionRecords(records);
+
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            if (results[i])
+            {
+                auto txn_lock = batch[i]->txn->getLock();
+                batch[i]->txn->txn_record = std::move(records[i].second);
+                batch[i]->commit_ts = commit_ts;
+                ProfileEvents::increment(ProfileEvents::CnchTxnCommitted);
+                ProfileEvents::increment(ProfileEvents::CnchTxnFinishedTransactionRecord);
+            }
+            else
+            {
+                ProfileEvents::increment(ProfileEvents::CnchTxnCommitV2Failed);
+                batch[i]->exception = std::make_exception_ptr(Exception(
+                    "Transaction " + batch[i]->txn->getTransactionID().toString()
+                        + " group commit failed because txn record has been changed by other transactions",
+                    ErrorCodes::CNCH_TRANSACTION_COMMIT_ERROR));
+            }
+        }
+        LOG_DEBUG(log, "Group committed {} transactions at {}\n", batch.size(), commit_ts.toUInt64());
+    }
+    catch (...)
+    {
+        tryLogCurrentException(log, __PRETTY_FUNCTION__);
+        auto exception = std::current_exception();
+        for (auto & pending : batch)
+        {
+            ProfileEvents::increment(ProfileEvents::CnchTxnCommitV2Failed);
+            pending->exception = exception;
+        }
+    }
+
+    {
+        std::lock_guard lock(group_commit_mutex);
+        for (auto & pending : batch)
+            pending->done = true;
+    }
+    group_commit_cv.notify_all();
+}
+
 CnchTransactionStatus TransactionCoordinatorRcCnch::getTransactionStatus(const TxnTimestamp & txnID) const
 {
     TransactionCnchPtr txn;
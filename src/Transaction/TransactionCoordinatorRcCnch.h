@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <optional>
 #include <Transaction/IntentLock.h>
 #include <Transaction/TimestampCacheManager.h>
@@ -75,11 +76,18 @@ public:
               getContext()->getConfigRef().getUInt("cnch_transaction_cleaner_dm_max_threads", 32),
               getContext()->getConfigRef().getUInt("cnch_transaction_cleaner_dm_queue_size", 10000)))
         , scan_interval(getContext()->getConfigRef().getInt("cnch_transaction_list_scan_interval", 10 * 60 * 1000)) // default 10 mins
+        , group_commit_window_ms(getContext()->getConfigRef().getUInt64("cnch_transaction_group_commit_window_ms", 0)) // 0 disables group commit
+        , group_commit_max_batch(getContext()->getConfigRef().getUInt64("cnch_transaction_group_commit_max_batch", 128))
         , log(&Poco::Logger::get("TransactionCoordinator"))
     {
         scan_active_txns_task = getContext()->getSchedulePool().createTask("ScanActiveTxnsTask", [this]() { scanActiveTransactions(); });
         scan_active_txns_task->activate();
         scan_active_txns_task->scheduleAfter(scan_interval);
+        if (group_commit_window_ms)
+        {
+            group_commit_task = getContext()->getSchedulePool().createTask("TxnGroupCommitFlusher", [this]() { flushGroupCommits(); });
+            group_commit_task->activate();
+        }
     }
 
     ~TransactionCoordinatorRcCnch()
@@ -168,6 +176,12 @@ public:
     void shutdown()
     {
         scan_active_txns_task->deactivate();
+        if (group_commit_task)
+        {
+            /// commit whatever is still queued so no committer is left waiting forever.
+            flushGroupCommits();
+            group_commit_task->deactivate();
+        }
         txn_cleaner->finalize();
     }
 
@@ -176,6 +190,21 @@ private:
 
     void scanActiveTransactions();
 
+    /// Group commit: the final record writes of independent small transactions are coalesced
+    /// into one metastore batch write, bounded by a time window of group_commit_window_ms.
+    struct PendingGroupCommit
+    {
+        CnchServerTransactionPtr txn;
+        TxnTimestamp commit_ts {0};
+        bool done = false;
+        std::exception_ptr exception;
+    };
+    using PendingGroupCommitPtr = std::shared_ptr<PendingGroupCommit>;
+
+    bool canUseGroupCommit(const TransactionCnchPtr & txn) const;
+    TxnTimestamp commitViaGroupCommit(const CnchServerTransactionPtr & txn) const;
+    void flushGroupCommits() const;
+
     mutable std::mutex list_mutex;
     /// transaction related data structure, including txn info, tsCache, mutex.
     std::map<TxnTimestamp, TransactionCnchPtr> active_txn_list;
@@ -192,6 +221,14 @@ private:
     UInt64 scan_interval;
     BackgroundSchedulePool::TaskHolder scan_active_txns_task;
 
+    // group commit state
+    UInt64 group_commit_window_ms;
+    UInt64 group_commit_max_batch;
+    mutable std::mutex group_commit_mutex;
+    mutable std::condition_variable group_commit_cv;
+    mutable std::vector<PendingGroupCommitPtr> group_commit_queue;
+    BackgroundSchedulePool::TaskHolder group_commit_task;
+
     Poco::Logger * log;
 };
 
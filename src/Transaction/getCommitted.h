@@ -79,8 +79,9 @@ void getCommitted(std::vector<T> & elements, const TxnTimestamp & ts, Catalog::C
             txn_ids.insert(txn_id);
         }
     }
-    // get txn records status in batch
-    auto records = catalog->getTransactionRecords(std::vector<TxnTimestamp>(txn_ids.begin(), txn_ids.end()), 100000);
+    // get txn records status in batch; final-state records are served from the catalog's
+    // in-memory cache, so repeated visibility checks don't re-fetch the same committed txns
+    auto records = catalog->getTransactionRecordsCached(std::vector<TxnTimestamp>(txn_ids.begin(), txn_ids.end()), 100000);
     for (const auto & record : records)
     {
         if (record.status() == CnchTransactionStatus::Finished)
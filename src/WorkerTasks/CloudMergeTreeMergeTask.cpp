@@ -15,10 +15,14 @@
 
 #include <WorkerTasks/CloudMergeTreeMergeTask.h>
 
+#include <Catalog/Catalog.h>
+#include <CloudServices/CnchPartsHelper.h>
 #include <CloudServices/commitCnchParts.h>
 #include <Interpreters/Context.h>
 #include <Storages/MergeTree/MergeTreeDataPartCNCH.h>
 #include <Storages/StorageCloudMergeTree.h>
+#include <Transaction/CnchLock.h>
+#include <Transaction/ICnchTransaction.h>
 #include <WorkerTasks/MergeTreeDataMerger.h>
 
 namespace DB
@@ -27,6 +31,7 @@ namespace DB
 namespace ErrorCodes
 {
     extern const int ABORTED;
+    extern const int LOGICAL_ERROR;
 }
 
 CloudMergeTreeMergeTask::CloudMergeTreeMergeTask(
@@ -38,11 +43,53 @@ CloudMergeTreeMergeTask::CloudMergeTreeMergeTask(
 {
 }
 
+/// - source parts should belong to one partition and be sorted in (min_block, max_block) order
+DeleteBitmapMetaPtrVector CloudMergeTreeMergeTask::getDeleteBitmapMetas(TxnTimestamp ts)
+{
+    auto catalog = getContext()->getCnchCatalog();
+    const auto & partition_id = params.source_data_parts[0]->info.partition_id;
+    DeleteBitmapMetaPtrVector all_bitmaps = catalog->getDeleteBitmapsInPartitions(params.storage, {partition_id}, ts);
+
+    /// construct bitmap version chain, remove invisible ones
+    DeleteBitmapMetaPtrVector bitmaps;
+    CnchPartsHelper::calcVisibleDeleteBitmaps(all_bitmaps, bitmaps);
+
+    auto bitmap_it = bitmaps.begin();
+    DeleteBitmapMetaPtrVector res(params.source_data_parts.size());
+    for (size_t i = 0; i < params.source_data_parts.size(); ++i)
+    {
+        const auto & part = params.source_data_parts[i];
+        /// unlike unique tables, ordinary parts have a bitmap only if some of their rows were deleted
+        while (bitmap_it != bitmaps.end() && (*(*bitmap_it)) <= part->info)
+        {
+            if ((*bitmap_it)->sameBlock(part->info))
+                res[i] = *bitmap_it;
+            bitmap_it++;
+        }
+    }
+    return res;
+}
+
 void CloudMergeTreeMergeTask::executeImpl()
 {
     auto lock = storage.lockForShare(RWLockImpl::NO_QUERY, storage.getSettings()->lock_acquire_timeout_for_background_operations);
 
     auto & cloud_table = dynamic_cast<StorageCloudMergeTree &>(*params.storage.get());
+
+    /// Lightweight deletes may have left bitmaps on the source parts; attach them so the
+    /// merge filters out the deleted rows instead of copying them into the merged part.
+    const bool with_delete_bitmaps
+        = !storage.getInMemoryMetadataPtr()->hasUniqueKey() && storage.getSettings()->enable_delete_bitmap_for_normal_table;
+    DeleteBitmapMetaPtrVector source_bitmap_metas;
+    if (with_delete_bitmaps)
+    {
+        source_bitmap_metas = getDeleteBitmapMetas(getContext()->getTimestamp());
+        for (size_t i = 0; i < source_bitmap_metas.size(); ++i)
+        {
+            if (source_bitmap_metas[i])
+                params.source_data_parts[i]->setDeleteBitmapMeta(source_bitmap_metas[i]);
+        }
+    }
     MergeTreeDataMerger merger(cloud_table, params, getContext(), manipulation_entry->get(), [&]() {
         if (isCancelled())
             return true;
@@ -59,10 +106,12 @@ void CloudMergeTreeMergeTask::executeImpl()
     auto merged_part = merger.mergePartsToTemporaryPart();
 
     IMutableMergeTreeDataPartsVector temp_parts;
+    LocalDeleteBitmaps bitmaps_to_dump;
     std::vector<ReservationPtr> reserved_spaces; // hold space
 
-    for (auto & part : params.source_data_parts)
+    for (size_t part_index = 0; part_index < params.source_data_parts.size(); ++part_index)
     {
+        const auto & part = params.source_data_parts[part_index];
         /// TODO: Double check, set drop part's mutation to current txnid and hint_mutation to corresponding part's mutation.
         if (part->info.level == MergeTreePartInfo::MAX_LEVEL)
             throw Exception(ErrorCodes::BAD_ARGUMENTS, "Drop part info level is MAX_LEVEL");
@@ -88,6 +137,11 @@ void CloudMergeTreeMergeTask::executeImpl()
         drop_part->covered_parts_rows = part->rows_count;
         drop_part->covered_parts_size = part->bytes_on_disk;
         temp_parts.push_back(std::move(drop_part));
+
+        /// end the bitmap chain of the dropped part; the merged part contains no deleted rows
+        if (with_delete_bitmaps && source_bitmap_metas[part_index])
+            bitmaps_to_dump.push_back(
+                LocalDeleteBitmap::createTombstone(drop_part_info, getContext()->getCurrentTransactionID().toUInt64()));
     }
 
     temp_parts.push_back(std::move(merged_part));
@@ -96,6 +150,42 @@ void CloudMergeTreeMergeTask::executeImpl()
         throw Exception("Merge task " + params.task_id + " is cancelled", ErrorCodes::ABORTED);
 
     CnchDataWriter cnch_writer(storage, getContext(), ManipulationType::Merge, params.task_id);
+
+    if (with_delete_bitmaps)
+    {
+        /// Deletes and merges synchronize on the table lock. Re-check the source parts'
+        /// bitmaps under the lock: if a DELETE marked rows after we read them, committing
+        /// the merged part would resurrect those rows, so give up and let the merge retry.
+        auto txn = getContext()->getCurrentTransaction();
+        if (!txn)
+            throw Exception("Transaction is not set", ErrorCodes::LOGICAL_ERROR);
+
+        LockInfoPtr partition_lock = std::make_shared<LockInfo>(txn->getTransactionID());
+        partition_lock->setMode(LockMode::X);
+        partition_lock->setTimeout(storage.getSettings()->lock_acquire_timeout_for_background_operations.value.totalMilliseconds());
+        partition_lock->setUUID(storage.getStorageUUID());
+        partition_lock->setPartition(params.source_data_parts[0]->info.partition_id);
+        auto cnch_lock = txn->createLockHolder({std::move(partition_lock)});
+        if (!cnch_lock->tryLock())
+            throw Exception("Failed to acquire lock for merge task " + params.task_id, ErrorCodes::ABORTED);
+
+        auto latest_metas = getDeleteBitmapMetas(getContext()->getTimestamp());
+        for (size_t i = 0; i < latest_metas.size(); ++i)
+        {
+            UInt64 seen_commit_time = source_bitmap_metas[i] ? source_bitmap_metas[i]->getCommitTime() : 0;
+            UInt64 latest_commit_time = latest_metas[i] ? latest_metas[i]->getCommitTime() : 0;
+            if (seen_commit_time != latest_commit_time)
+                throw Exception(
+                    "Merge task " + params.task_id + " is aborted: delete bitmap of part " + params.source_data_parts[i]->name
+                        + " changed during merge",
+                    ErrorCodes::ABORTED);
+        }
+
+        DumpedData data = cnch_writer.dumpAndCommitCnchParts(temp_parts, bitmaps_to_dump);
+        cnch_writer.preload(data.parts);
+        return;
+    }
+
     DumpedData data = cnch_writer.dumpAndCommitCnchParts(temp_parts);
     cnch_writer.preload(data.parts);
 }
@@ -16,6 +16,7 @@
 #include <WorkerTasks/ManipulationTask.h>
 
 #include <Interpreters/Context_fwd.h>
+#include <Storages/MergeTree/DeleteBitmapMeta.h>
 
 namespace DB
 {
@@ -29,6 +30,11 @@ public:
     void executeImpl() override;
 
 private:
+    /// Latest visible delete bitmap meta of every source part at `ts`, aligned with
+    /// params.source_data_parts; entries are null for parts without deleted rows.
+    /// Only used for tables with enable_delete_bitmap_for_normal_table.
+    DeleteBitmapMetaPtrVector getDeleteBitmapMetas(TxnTimestamp ts);
+
     StorageCloudMergeTree & storage;
 };
 
@@ -23,6 +23,9 @@
 #include <DataStreams/MaterializingBlockInputStream.h>
 #include <DataTypes/IDataType.h>
 #include <DataTypes/DataTypeByteMap.h>
+#include <IO/ReadBufferFromString.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
 #include <Processors/Executors/PipelineExecutingBlockInputStream.h>
 #include <Processors/Merges/AggregatingSortedTransform.h>
 #include <Processors/Merges/CollapsingSortedTransform.h>
@@ -40,6 +43,9 @@
 #include <Storages/MergeTree/MergedColumnOnlyOutputStream.h>
 #include <WorkerTasks/ManipulationTaskParams.h>
 
+#include <mutex>
+#include <set>
+
 namespace ProfileEvents
 {
     extern const Event CloudMergeStarted;
@@ -99,6 +105,94 @@ namespace
             sort_description.emplace_back(header.getPositionByName(sort_columns[i]), 1, 1);
         return sort_description;
     }
+
+    /// Vertical merge checkpoints (see cnch_merge_enable_checkpoint). The manifest lives
+    /// next to the column files in the temporary part directory and gets one synced record
+    /// per fully gathered column, so a retried merge task for the same output part redoes
+    /// only the horizontal stage and the columns that were in flight when the worker died.
+    constexpr auto MERGE_CHECKPOINT_FILE_NAME = "merge_checkpoint.txt";
+
+    struct MergeCheckpointRecord
+    {
+        size_t rows = 0;
+        size_t marks = 0;
+        MergeTreeDataPartChecksums checksums;
+        IMergedBlockOutputStream::WrittenOffsetColumns offset_columns;
+    };
+    using MergeCheckpointRecords = std::map<String, MergeCheckpointRecord>;
+
+    String getMergeCheckpointHeader(const MergeTreeDataPartsVector & source_parts, UInt64 merge_block_size)
+    {
+        WriteBufferFromOwnString out;
+        out << "merge checkpoint format version: 1\n";
+        out << "merge block size: " << merge_block_size << "\n";
+        out << "sources: " << toDebugString(source_parts) << "\n";
+        return out.str();
+    }
+
+    void writeMergeCheckpointRecord(const String & column_name, const MergeCheckpointRecord & record, WriteBuffer & out)
+    {
+        writeBinary(column_name, out);
+        writeVarUInt(record.rows, out);
+        writeVarUInt(record.marks, out);
+        writeVarUInt(record.offset_columns.size(), out);
+        for (const auto & offset_column : record.offset_columns)
+            writeBinary(offset_column, out);
+        writeBinary(record.checksums.getSerializedString(), out);
+    }
+
+    MergeCheckpointRecords loadMergeCheckpoint(const DiskPtr & disk, const String & path, const String & expected_header, Poco::Logger * log)
+    {
+        MergeCheckpointRecords records;
+        if (!disk->exists(path))
+            return records;
+
+        try
+        {
+            auto in = disk->readFile(path);
+            String header;
+            header.resize(expected_header.size());
+            in->readStrict(header.data(), header.size());
+            if (header != expected_header)
+            {
+                LOG_DEBUG(log, "Ignoring merge checkpoint {} left by a different merge", fullPath(disk, path));
+                return records;
+            }
+
+            while (!in->eof())
+            {
+                String column_name;
+                MergeCheckpointRecord record;
+                readBinary(column_name, *in);
+                readVarUInt(record.rows, *in);
+                readVarUInt(record.marks, *in);
+                size_t offset_columns_count = 0;
+                readVarUInt(offset_columns_count, *in);
+                for (size_t i = 0; i < offset_columns_count; ++i)
+                {
+                    String offset_column;
+                    readBinary(offset_column, *in);
+                    record.offset_columns.insert(std::move(offset_column));
+                }
+                String checksums_data;
+                readBinary(checksums_data, *in);
+                record.checksums = MergeTreeDataPartChecksums::deserializeFrom(checksums_data);
+                records[std::move(column_name)] = std::move(record);
+            }
+        }
+        catch (...)
+        {
+            /// The trailing record may be truncated if the worker died while appending it.
+            /// Records read so far are still complete and usable.
+            tryLogCurrentException(log, "while loading merge checkpoint " + fullPath(disk, path));
+        }
+        return records;
+    }
+
+    /// Guards against two merge tasks of the same output part resuming into one directory,
+    /// e.g. when the server reschedules a task whose worker thread is still alive.
+    std::mutex active_checkpoint_dirs_mutex;
+    std::set<String> active_checkpoint_dirs;
 }
 
 MergeTreeDataMerger::MergeTreeDataMerger(
@@ -121,9 +215,19 @@ MergeTreeDataMerger::MergeTreeDataMerger(
     if (build_rowid_mappings && data.merging_params.mode != MergeTreeMetaBase::MergingParams::Ordinary)
         throw Exception(
             ErrorCodes::LOGICAL_ERROR, "Rowid mapping is only supported for Ordinal mode, got {}", data.merging_params.getModeName());
+    checkpoint_enabled = data_settings->cnch_merge_enable_checkpoint && data_settings->enable_vertical_merge_algorithm;
     space_reservation = data.reserveSpace(estimateNeededDiskSpace(params.source_data_parts), IStorage::StorageLocation::AUXILITY);
 }
 
+MergeTreeDataMerger::~MergeTreeDataMerger()
+{
+    if (!registered_checkpoint_dir.empty())
+    {
+        std::lock_guard lock(active_checkpoint_dirs_mutex);
+        active_checkpoint_dirs.erase(registered_checkpoint_dir);
+    }
+}
+
 void MergeTreeDataMerger::prepareColumnNamesAndTypes(
     const StorageMetadataPtr & metadata_snapshot,
     const MergeTreeMetaBase::MergingParams & merging_params,
@@ -205,14 +309,36 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::prepareNewParts(
 {
     String TMP_PREFIX = "tmp_merge_";
     const auto & new_part_name = parent_part ? source_data_parts.front()->name : params.new_part_names.front();
-    String new_part_tmp_path = parent_part ? (new_part_name + ".proj") : (TMP_PREFIX + toString(UInt64(context->getCurrentCnchStartTime())) + '-' + new_part_name);
+    String new_part_tmp_path;
+    if (parent_part)
+        new_part_tmp_path = new_part_name + ".proj";
+    else if (checkpoint_enabled)
+        /// The name must be stable across retries so that a new attempt finds the
+        /// checkpoint of a failed one. The output part name is derived from the source
+        /// parts, hence identical for a reselection of the same range.
+        new_part_tmp_path = TMP_PREFIX + "ckpt_" + new_part_name;
+    else
+        new_part_tmp_path = TMP_PREFIX + toString(UInt64(context->getCurrentCnchStartTime())) + '-' + new_part_name;
 
     DiskPtr disk = space_reservation->getDisk();
     /// Check directory
     if (!parent_part)
     {
         String new_part_tmp_rel_path = data.getRelativeDataPath(IStorage::StorageLocation::AUXILITY) + "/" + new_part_tmp_path;
-        if (disk->exists(new_part_tmp_rel_path))
+        if (checkpoint_enabled)
+        {
+            {
+                std::lock_guard lock(active_checkpoint_dirs_mutex);
+                if (!active_checkpoint_dirs.emplace(new_part_tmp_rel_path).second)
+                    throw Exception(
+                        "Directory " + fullPath(disk, new_part_tmp_rel_path) + " is in use by another merge task",
+                        ErrorCodes::DIRECTORY_ALREADY_EXISTS);
+                registered_checkpoint_dir = new_part_tmp_rel_path;
+            }
+            if (disk->exists(new_part_tmp_rel_path))
+                LOG_DEBUG(log, "Reusing directory {} left by a previous merge attempt", fullPath(disk, new_part_tmp_rel_path));
+        }
+        else if (disk->exists(new_part_tmp_rel_path))
             throw Exception("Directory " + fullPath(disk, new_part_tmp_rel_path) + " already exists", ErrorCodes::DIRECTORY_ALREADY_EXISTS);
         disk->createDirectories(new_part_tmp_rel_path); /// TODO: could we remove it ?
     }
@@ -228,7 +354,10 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::prepareNewParts(
     /// TODO uuid
     new_data_part->setColumns(storage_columns);
     new_data_part->partition.assign(source_data_parts.front()->partition);
-    new_data_part->is_temp = parent_part == nullptr;
+    /// With checkpoints the directory must survive a failed attempt; the part becomes a
+    /// regular temporary part again once the merge completes (stale directories that are
+    /// never retried get reaped together with other tmp_ directories).
+    new_data_part->is_temp = parent_part == nullptr && !checkpoint_enabled;
 
     /// TODO: support TTL ?
 
@@ -387,6 +516,10 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPartImpl(
     Pipes pipes;
     UInt64 watch_prev_elapsed = 0;
 
+    /// Small parts produced by frequent inserts mostly carry identical LowCardinality
+    /// dictionaries; share the decoded ones between the per-part sources of this merge.
+    auto dictionary_pool = std::make_shared<LowCardinalityDictionaryPool>();
+
     for (const auto & part : source_data_parts)
     {
         /// CnchMergePrefetcher::PartFutureFiles * future_files = prefetcher ? prefetcher->tryGetFutureFiles(part->name) : nullptr;
@@ -399,7 +532,8 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPartImpl(
             merging_column_names,
             false, // read_with_direct_io: We believe source parts will be mostly in page cache
             true, /// take_column_types_from_storage
-            false /// quiet
+            false, /// quiet
+            dictionary_pool
         );
         input->setProgressCallback(ManipulationProgressCallback(manipulation_entry, watch_prev_elapsed, horizontal_stage_progress));
 
@@ -621,10 +755,68 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPartImpl(
             /*blocks_are_granules_size = */ false,
             context->getSettingsRef().optimize_map_column_serialization);
 
+        bool use_checkpoint = checkpoint_enabled && !parent_part;
+        MergeCheckpointRecords checkpoint_records;
+        std::unique_ptr<WriteBufferFromFileBase> checkpoint_out;
+        if (use_checkpoint)
+        {
+            DiskPtr disk = space_reservation->getDisk();
+            String checkpoint_path = new_data_part->getFullRelativePath() + MERGE_CHECKPOINT_FILE_NAME;
+            String checkpoint_header = getMergeCheckpointHeader(source_data_parts, merge_block_size);
+            checkpoint_records = loadMergeCheckpoint(disk, checkpoint_path, checkpoint_header, log);
+
+            /// Column files of a previous attempt align with the redone horizontal stage
+            /// only if it produced the very same granules.
+            size_t marks_count = to->getIndexGranularity().getMarksCount();
+            for (const auto & [column_name, record] : checkpoint_records)
+            {
+                if (record.rows != rows_written || record.marks != marks_count)
+                {
+                    LOG_WARNING(
+                        log,
+                        "Merge checkpoint of {} does not match the redone horizontal stage ({} rows in {} marks vs {} rows in {} marks), gathering all columns from scratch",
+                        new_data_part->name, record.rows, record.marks, rows_written, marks_count);
+                    checkpoint_records.clear();
+                    break;
+                }
+            }
+
+            /// Rewrite the manifest instead of appending: a record truncated by the death
+            /// of the previous attempt would otherwise cut off everything written after it.
+            checkpoint_out = disk->writeFile(checkpoint_path);
+            writeString(checkpoint_header, *checkpoint_out);
+            for (const auto & [column_name, record] : checkpoint_records)
+                writeMergeCheckpointRecord(column_name, record, *checkpoint_out);
+            checkpoint_out->next();
+            checkpoint_out->sync();
+
+            if (!checkpoint_records.empty())
+                LOG_INFO(log, "Resuming vertical merge of {} from checkpoint with {} gathered columns",
+                    new_data_part->name, checkpoint_records.size());
+        }
+
         for (auto & [column_name, column_type] : gathering_columns)
         {
             if (column_type->isMap() && !column_type->isMapKVStore())
                 continue;
+
+            if (auto checkpointed = checkpoint_records.find(column_name); checkpointed != checkpoint_records.end())
+            {
+                /// The column was fully gathered by a previous attempt and its files are
+                /// still in the part directory, only account for them.
+                written_offset_columns->insert(checkpointed->second.offset_columns.begin(), checkpointed->second.offset_columns.end());
+                MergeTreeDataPartChecksums restored_checksums = checkpointed->second.checksums;
+                additional_column_checksums.add(std::move(restored_checksums));
+
+                manipulation_entry->columns_written.fetch_add(1, std::memory_order_relaxed);
+                manipulation_entry->progress.store(
+                    manipulation_entry->progress.load(std::memory_order_relaxed) + column_sizes->columnWeight(column_name),
+                    std::memory_order_relaxed);
+
+                LOG_DEBUG(log, "Skipped gathering column {} restored from merge checkpoint", column_name);
+                normal_columns_gathered += 1;
+                continue;
+            }
             // gather each column
             /// Prepare progress
             Float64 progress_before = manipulation_entry->progress.load(std::memory_order_relaxed);
@@ -646,7 +838,9 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPartImpl(
                     nullptr, // delete bitmap
                     Names{column_name},
                     false, /// read_with_direct_io: We believe source parts will be mostly in page cache
-                    true // take_column_types_from_storage
+                    true, // take_column_types_from_storage
+                    false, /// quiet
+                    dictionary_pool
                 );
                 column_part_source->setProgressCallback(
                     ManipulationProgressCallback(manipulation_entry, watch_prev_elapsed, column_progress));
@@ -707,6 +901,19 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPartImpl(
 
             column_gathered_stream.readSuffix();
             auto changed_checksums = column_to.writeSuffixAndGetChecksums(new_data_part, additional_column_checksums);
+
+            if (checkpoint_out)
+            {
+                MergeCheckpointRecord record;
+                record.rows = rows_written;
+                record.marks = to->getIndexGranularity().getMarksCount();
+                record.checksums = changed_checksums;
+                record.offset_columns = *written_offset_columns;
+                writeMergeCheckpointRecord(column_name, record, *checkpoint_out);
+                checkpoint_out->next();
+                checkpoint_out->sync();
+            }
+
             additional_column_checksums.add(std::move(changed_checksums));
 
             /// Update profiles and progress
@@ -782,6 +989,11 @@ MergeTreeMutableDataPartPtr MergeTreeDataMerger::mergePartsToTemporaryPartImpl(
     else
         to->writeSuffixAndFinalizePart(new_data_part, false, &storage_columns, &additional_column_checksums);
 
+    /// The merge completed, no retry will ever resume from this directory: let the part
+    /// clean it up like a regular temporary part once the result has been dumped.
+    if (checkpoint_enabled && !parent_part)
+        new_data_part->is_temp = true;
+
     return new_data_part;
 }
 
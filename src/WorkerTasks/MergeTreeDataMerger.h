@@ -56,7 +56,7 @@ public:
         CheckCancelCallback check_cancel_,
         bool build_rowid_mappings = false);
 
-    ~MergeTreeDataMerger() = default;
+    ~MergeTreeDataMerger();
 
     MergeTreeMutableDataPartPtr mergePartsToTemporaryPart();
 
@@ -106,6 +106,10 @@ private:
     ManipulationListElement * task_manipulation_entry;
     CheckCancelCallback check_cancel;
     bool build_rowid_mappings;
+    /// See cnch_merge_enable_checkpoint. Implies a retry-stable name for the temporary
+    /// part directory, so that a new attempt finds the output of a failed one.
+    bool checkpoint_enabled = false;
+    String registered_checkpoint_dir;
     /// rowid mapping for each input part, only for normal parts
     std::vector<RowidMapping> rowid_mappings;
     Poco::Logger * log = nullptr;
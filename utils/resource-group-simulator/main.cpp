@@ -0,0 +1,289 @@
+/*
+ * Copyright (2022) Bytedance Ltd. and/or its affiliates
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+/** Replays a logged query workload against candidate resource group limits and
+  * predicts the queue wait distribution each group would see, so concurrency
+  * limits can be tuned offline instead of experimenting on production.
+  *
+  * Input (stdin or --input): TSV, one query per line:
+  *     enqueue_ms <TAB> group <TAB> duration_ms
+  * Extract it from the server with something like
+  *     SELECT toUnixTimestamp(a.event_time) * 1000, a.group, q.query_duration_ms
+  *     FROM system.resource_group_admission_log AS a
+  *     INNER JOIN system.query_log AS q ON a.query_id = q.query_id
+  *     WHERE q.type = 'QueryFinish'
+  *     ORDER BY a.event_time
+  *     FORMAT TSV
+  *
+  * Each candidate group is given as --group name:max_concurrent:max_queued:max_wait_ms.
+  *
+  * The model is the admission policy of IResourceGroup for a flat set of groups:
+  * a free slot admits immediately, otherwise the query queues FIFO up to
+  * max_queued and times out after max_wait_ms. The memory budget
+  * (query_estimated_memory_bytes / min_query_memory_usage bypass) and the
+  * parent-child hierarchy are not modelled.
+  */
+
+namespace
+{
+
+struct GroupConfig
+{
+    int64_t max_concurrent = 0;
+    int64_t max_queued = 0;
+    int64_t max_wait_ms = 0;
+};
+
+struct QueryEvent
+{
+    int64_t enqueue_ms = 0;
+    std::string group;
+    int64_t duration_ms = 0;
+};
+
+struct QueuedQuery
+{
+    int64_t enqueue_ms = 0;
+    int64_t deadline_ms = 0;
+    int64_t duration_ms = 0;
+};
+
+struct GroupState
+{
+    GroupConfig config;
+
+    int64_t running = 0;
+    std::queue<QueuedQuery> queued;
+
+    /// Results.
+    std::vector<int64_t> waits_ms;  /// One entry per admitted query.
+    uint64_t run_immediately = 0;
+    uint64_t dequeued = 0;
+    uint64_t timed_out = 0;
+    uint64_t rejected = 0;
+};
+
+/// (completion time, group) min-heap entry.
+using Completion = std::pair<int64_t, GroupState *>;
+
+struct CompletionGreater
+{
+    bool operator()(const Completion & lhs, const Completion & rhs) const { return lhs.first > rhs.first; }
+};
+
+using CompletionQueue = std::priority_queue<Completion, std::vector<Completion>, CompletionGreater>;
+
+void admitFromQueue(GroupState & group, int64_t now_ms, CompletionQueue & completions)
+{
+    while (group.running < group.config.max_concurrent && !group.queued.empty())
+    {
+        QueuedQuery head = group.queued.front();
+        group.queued.pop();
+
+        if (head.deadline_ms < now_ms)
+        {
+            /// Its wait budget ran out before a slot freed up.
+            ++group.timed_out;
+            continue;
+        }
+
+        ++group.dequeued;
+        group.waits_ms.push_back(now_ms - head.enqueue_ms);
+        ++group.running;
+        completions.push({now_ms + head.duration_ms, &group});
+    }
+}
+
+void drainCompletionsUpTo(int64_t now_ms, CompletionQueue & completions)
+{
+    while (!completions.empty() && completions.top().first <= now_ms)
+    {
+        auto [finish_ms, group] = completions.top();
+        completions.pop();
+        --group->running;
+        admitFromQueue(*group, finish_ms, completions);
+    }
+}
+
+int64_t percentile(std::vector<int64_t> & sorted_waits, double level)
+{
+    if (sorted_waits.empty())
+        return 0;
+    size_t index = static_cast<size_t>(level * static_cast<double>(sorted_waits.size() - 1) + 0.5);
+    return sorted_waits[std::min(index, sorted_waits.size() - 1)];
+}
+
+bool parseGroupConfig(const std::string & spec, std::string & name, GroupConfig & config)
+{
+    std::istringstream stream(spec);
+    std::string field;
+    std::vector<std::string> fields;
+    while (std::getline(stream, field, ':'))
+        fields.push_back(field);
+
+    if (fields.size() != 4)
+        return false;
+
+    name = fields[0];
+    config.max_concurrent = std::stoll(fields[1]);
+    config.max_queued = std::stoll(fields[2]);
+    config.max_wait_ms = std::stoll(fields[3]);
+    return true;
+}
+
+}
+
+
+int main(int argc, char ** argv)
+{
+    boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help,h", "produce help message")
+        ("group,g", boost::program_options::value<std::vector<std::string>>()->composing(),
+            "candidate group as name:max_concurrent:max_queued:max_wait_ms; may be given multiple times")
+        ("input,i", boost::program_options::value<std::string>(), "TSV workload file (default: stdin)");
+
+    boost::program_options::variables_map options;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), options);
+    boost::program_options::notify(options);
+
+    if (options.count("help") || !options.count("group"))
+    {
+        std::cout << "Usage: " << argv[0] << " --group vw_default:8:100:5000 [--group ...] [--input workload.tsv]" << std::endl;
+        std::cout << desc << std::endl;
+        return options.count("help") ? 0 : 1;
+    }
+
+    std::map<std::string, GroupState> groups;
+    for (const auto & spec : options["group"].as<std::vector<std::string>>())
+    {
+        std::string name;
+        GroupConfig config;
+        if (!parseGroupConfig(spec, name, config))
+        {
+            std::cerr << "Bad group spec '" << spec << "', expected name:max_concurrent:max_queued:max_wait_ms" << std::endl;
+            return 1;
+        }
+        groups[name].config = config;
+    }
+
+    std::ifstream file;
+    if (options.count("input"))
+    {
+        file.open(options["input"].as<std::string>());
+        if (!file)
+        {
+            std::cerr << "Cannot open " << options["input"].as<std::string>() << std::endl;
+            return 1;
+        }
+    }
+    std::istream & input = options.count("input") ? file : std::cin;
+
+    std::vector<QueryEvent> events;
+    std::string line;
+    size_t line_num = 0;
+    size_t unknown_group = 0;
+    while (std::getline(input, line))
+    {
+        ++line_num;
+        if (line.empty())
+            continue;
+
+        QueryEvent event;
+        std::istringstream fields(line);
+        if (!(fields >> event.enqueue_ms >> event.group >> event.duration_ms))
+        {
+            std::cerr << "Cannot parse line " << line_num << ": " << line << std::endl;
+            return 1;
+        }
+        if (!groups.count(event.group))
+        {
+            ++unknown_group;
+            continue;
+        }
+        events.push_back(std::move(event));
+    }
+
+    std::stable_sort(events.begin(), events.end(),
+        [](const QueryEvent & lhs, const QueryEvent & rhs) { return lhs.enqueue_ms < rhs.enqueue_ms; });
+
+    CompletionQueue completions;
+    for (const auto & event : events)
+    {
+        drainCompletionsUpTo(event.enqueue_ms, completions);
+        GroupState & group = groups[event.group];
+
+        if (group.running < group.config.max_concurrent)
+        {
+            ++group.run_immediately;
+            group.waits_ms.push_back(0);
+            ++group.running;
+            completions.push({event.enqueue_ms + event.duration_ms, &group});
+        }
+        else if (static_cast<int64_t>(group.queued.size()) < group.config.max_queued)
+        {
+            group.queued.push({event.enqueue_ms, event.enqueue_ms + group.config.max_wait_ms, event.duration_ms});
+        }
+        else
+        {
+            ++group.rejected;
+        }
+    }
+    drainCompletionsUpTo(INT64_MAX, completions);
+
+    /// Whatever is still queued after the last completion can only time out.
+    for (auto & [name, group] : groups)
+        group.timed_out += group.queued.size();
+
+    if (unknown_group)
+        std::cerr << "Skipped " << unknown_group << " queries of groups without a --group spec." << std::endl;
+
+    std::cout << "group\tadmitted\timmediate\tdequeued\ttimed_out\trejected\twait_mean_ms\twait_p50_ms\twait_p90_ms\twait_p99_ms\twait_max_ms" << std::endl;
+    for (auto & [name, group] : groups)
+    {
+        std::sort(group.waits_ms.begin(), group.waits_ms.end());
+        int64_t sum = 0;
+        for (int64_t wait : group.waits_ms)
+            sum += wait;
+        int64_t mean = group.waits_ms.empty() ? 0 : sum / static_cast<int64_t>(group.waits_ms.size());
+
+        std::cout << name
+            << '\t' << group.waits_ms.size()
+            << '\t' << group.run_immediately
+            << '\t' << group.dequeued
+            << '\t' << group.timed_out
+            << '\t' << group.rejected
+            << '\t' << mean
+            << '\t' << percentile(group.waits_ms, 0.5)
+            << '\t' << percentile(group.waits_ms, 0.9)
+            << '\t' << percentile(group.waits_ms, 0.99)
+            << '\t' << (group.waits_ms.empty() ? 0 : group.waits_ms.back())
+            << std::endl;
+    }
+
+    return 0;
+}